@@ -22,6 +22,8 @@ limitations under the License.
 #include "tensorflow/c/eager/c_api_experimental.h"
 #include "tensorflow/c/eager/tfe_tensorhandle_internal.h"
 #include "tensorflow/c/tf_status_internal.h"
+#include "tensorflow/c/tf_tensor.h"
+#include "tensorflow/c/tf_tensor_internal.h"
 #include "tensorflow/core/common_runtime/eager/tensor_handle.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor_reference.h"
@@ -390,4 +392,112 @@ TFE_TensorHandle* TFE_HandleFromDLPack(void* dlm, TF_Status* status,
   return handle;
 }
 
+void* TF_TensorToDLPack(TF_Tensor* tensor, TF_Status* status) {
+  if (tensor == nullptr) {
+    status->status = tensorflow::errors::InvalidArgument("Invalid tensor");
+    return nullptr;
+  }
+  // Aliases the underlying buffer; no copy is made.
+  Tensor src;
+  status->status = TF_TensorToTensor(tensor, &src);
+  if (!status->status.ok()) {
+    return nullptr;
+  }
+
+  TF_DataType data_type = static_cast<TF_DataType>(src.dtype());
+  auto tf_dlm_type = GetDlDataType(data_type, status);
+  if (!status->status.ok()) {
+    return nullptr;
+  }
+
+  TensorReference tensor_ref(src);  // This will call buf_->Ref()
+  auto* tf_dlm_tensor_ctx = new TfDlManagedTensorCtx(tensor_ref);
+
+  DLManagedTensor* dlm_tensor = &tf_dlm_tensor_ctx->tensor;
+  dlm_tensor->manager_ctx = tf_dlm_tensor_ctx;
+  dlm_tensor->deleter = &DLManagedTensorDeleter;
+  // Session-level TF_Tensors always live in host memory.
+  dlm_tensor->dl_tensor.device.device_type = DLDeviceType::kDLCPU;
+  dlm_tensor->dl_tensor.device.device_id = 0;
+  int ndim = src.dims();
+  dlm_tensor->dl_tensor.ndim = ndim;
+  dlm_tensor->dl_tensor.data = src.data();
+  dlm_tensor->dl_tensor.dtype = tf_dlm_type;
+
+  std::vector<int64_t>* shape_arr = &tf_dlm_tensor_ctx->shape;
+  std::vector<int64_t>* stride_arr = &tf_dlm_tensor_ctx->strides;
+  shape_arr->resize(ndim);
+  stride_arr->resize(ndim, 1);
+  for (int i = 0; i < ndim; i++) {
+    (*shape_arr)[i] = src.dim_size(i);
+  }
+  for (int i = ndim - 2; i >= 0; --i) {
+    (*stride_arr)[i] = (*shape_arr)[i + 1] * (*stride_arr)[i + 1];
+  }
+
+  dlm_tensor->dl_tensor.shape = shape_arr->data();
+  // See TFE_HandleToDLPack for why the strides array is filled in rather than
+  // left null for compact row-major data.
+  dlm_tensor->dl_tensor.strides = stride_arr->data();
+  dlm_tensor->dl_tensor.byte_offset = 0;
+  return static_cast<void*>(dlm_tensor);
+}
+
+TF_Tensor* TF_TensorFromDLPack(void* dlm, TF_Status* status) {
+  DLManagedTensor* dlmt = static_cast<DLManagedTensor*>(dlm);
+  if (dlmt == nullptr) {
+    status->status =
+        tensorflow::errors::InvalidArgument("Invalid DLManagedTensor");
+    return nullptr;
+  }
+  DLTensor* dl_tensor = &dlmt->dl_tensor;
+  if (dl_tensor->device.device_type != DLDeviceType::kDLCPU) {
+    status->status = tensorflow::errors::InvalidArgument(
+        "TF_TensorFromDLPack only supports host (CPU) DLPack tensors");
+    return nullptr;
+  }
+  TF_DataType dtype;
+  absl::Status s = TfDataTypeFormDlDataType(dl_tensor->dtype, &dtype);
+  if (!s.ok()) {
+    status->status = std::move(s);
+    return nullptr;
+  }
+
+  if (dl_tensor->byte_offset != 0) {
+    status->status = tensorflow::errors::InvalidArgument(
+        "Unsupported byte_offset (", dl_tensor->byte_offset,
+        ") from DLPack, must be zero");
+    return nullptr;
+  }
+
+  int num_dims = dl_tensor->ndim;
+  const int64_t* dims = dl_tensor->shape;
+  size_t total_bytes = dl_tensor->dtype.bits / 8;
+  for (int i = 0; i < num_dims; i++) {
+    total_bytes *= dims[i];
+  }
+
+  if (dl_tensor->strides != nullptr &&
+      !IsValidStrideCompactRowMajorData(dl_tensor->shape, dl_tensor->strides,
+                                        num_dims)) {
+    status->status = tensorflow::errors::InvalidArgument(
+        "Invalid strides array from DLPack");
+    return nullptr;
+  }
+
+  // The returned tensor owns the external buffer and invokes the
+  // DLManagedTensor deleter when deleted. TF_NewTensor may copy (and call the
+  // deleter eagerly) if the buffer does not satisfy TensorFlow's alignment
+  // preferences; either way the caller's capsule has been consumed.
+  TF_Tensor* tensor =
+      TF_NewTensor(dtype, dims, num_dims, dl_tensor->data, total_bytes,
+                   &DeallocatorWrapperFunc, dlmt);
+  if (tensor == nullptr) {
+    status->status = tensorflow::errors::InvalidArgument(
+        "Failed to create tensor from DLPack buffer: shape is inconsistent "
+        "with the provided buffer length");
+  }
+  return tensor;
+}
+
 }  // namespace tensorflow
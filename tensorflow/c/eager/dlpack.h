@@ -35,6 +35,21 @@ TF_CAPI_EXPORT extern TFE_TensorHandle* TFE_HandleFromDLPack(void* dlm,
 
 // Calls the destructor of DLManagedTensor, used in the destructor of PyCapsule.
 TF_CAPI_EXPORT extern void TFE_CallDLManagedTensorDeleter(void* dlm_ptr);
+
+// Converts a TF_Tensor (as used by the graph-session C API for feeds and
+// fetches) to DLPack (DLManagedTensor*) without copying the underlying
+// buffer, and returns the void* for further PyCapsule construction. The
+// returned DLManagedTensor holds a reference on the tensor's buffer, released
+// by its deleter.
+TF_CAPI_EXPORT extern void* TF_TensorToDLPack(TF_Tensor* tensor,
+                                              TF_Status* status);
+
+// Converts DLPack (DLManagedTensor*) to a TF_Tensor suitable for feeding to
+// the graph-session C API. Only host (CPU) DLPack tensors are supported. On
+// success the returned tensor takes ownership of the DLPack buffer and calls
+// its deleter when the tensor is deleted; no copy is made.
+TF_CAPI_EXPORT extern TF_Tensor* TF_TensorFromDLPack(void* dlm,
+                                                     TF_Status* status);
 }  // namespace tensorflow
 
 #endif  // TENSORFLOW_C_EAGER_DLPACK_H_
@@ -0,0 +1,30 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_C_EXPERIMENTAL_FILESYSTEM_PLUGINS_URING_URING_FILESYSTEM_H_
+#define TENSORFLOW_C_EXPERIMENTAL_FILESYSTEM_PLUGINS_URING_URING_FILESYSTEM_H_
+
+#include "tensorflow/c/experimental/filesystem/filesystem_interface.h"
+
+// Initialize the io_uring filesystem.
+//
+// The filesystem registers the `uring://` scheme for local files and services
+// reads and buffered writes through a per-file io_uring submission queue,
+// batching the chunked I/O a single `Read`/`Flush` generates into one
+// `io_uring_enter` call. On kernels without io_uring support it transparently
+// falls back to `pread`/`pwrite`. Exposed in a header so the filesystem can be
+// statically registered where dynamic plugin loading is unavailable.
+void TF_InitPlugin(TF_FilesystemPluginInfo* info);
+
+#endif  // TENSORFLOW_C_EXPERIMENTAL_FILESYSTEM_PLUGINS_URING_URING_FILESYSTEM_H_
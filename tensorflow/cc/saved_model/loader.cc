@@ -15,11 +15,14 @@ limitations under the License.
 
 #include "tensorflow/cc/saved_model/loader.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "absl/base/call_once.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
@@ -35,6 +38,7 @@ limitations under the License.
 #include "tensorflow/core/framework/node_def.pb.h"
 #include "tensorflow/core/framework/op_def.pb.h"
 #include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/io/path.h"
 #include "tensorflow/core/lib/monitoring/counter.h"
 #include "tensorflow/core/lib/monitoring/sampler.h"
@@ -43,6 +47,7 @@ limitations under the License.
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/platform/file_system_helper.h"
+#include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/core/platform/statusor.h"
 #include "tensorflow/core/protobuf/meta_graph.pb.h"
 #include "tensorflow/core/protobuf/saver.pb.h"
@@ -213,7 +218,6 @@ absl::Status RunOnce(const RunOptions& run_options,
 // RunInitOp will return OK if the initialization op was run successfully.
 // An empty init_op_name indicates that there are no init ops to run.
 absl::Status RunInitOp(const RunOptions& run_options, const string& export_dir,
-                       const MetaGraphDef& meta_graph_def,
                        const std::vector<AssetFileDef>& asset_file_defs,
                        Session* session, const string& init_op_name) {
   if (!init_op_name.empty()) {
@@ -292,6 +296,70 @@ absl::Status LoadGraphDefIntoSession(const SessionOptions& session_options,
   return (*session)->Create(std::move(graph_def));
 }
 
+// Builds the flattened signature table on `bundle`: one prebound callable per
+// signature, created eagerly so that per-request signature resolution is a
+// single hash probe instead of MetaGraphDef proto map traversals.
+//
+// Signatures with non-tensor arguments and signatures the session cannot
+// compile are skipped; sessions that do not support callables leave the table
+// empty, and callers fall back to GetSignatures().
+absl::Status BuildSignatureBindings(SavedModelBundle* bundle) {
+  for (const auto& entry : bundle->meta_graph_def.signature_def()) {
+    const string& signature_name = entry.first;
+    const SignatureDef& signature = entry.second;
+
+    SavedModelBundle::SignatureBinding binding;
+    CallableOptions callable_options;
+    // Proto maps are unordered; sort the argument names so that feed and
+    // fetch positions are deterministic across processes.
+    for (const auto& input : signature.inputs()) {
+      binding.input_args.push_back(input.first);
+    }
+    std::sort(binding.input_args.begin(), binding.input_args.end());
+    for (const auto& output : signature.outputs()) {
+      binding.output_args.push_back(output.first);
+    }
+    std::sort(binding.output_args.begin(), binding.output_args.end());
+
+    bool tensor_args_only = true;
+    for (const string& arg : binding.input_args) {
+      const string& tensor_name = signature.inputs().at(arg).name();
+      if (tensor_name.empty()) {
+        tensor_args_only = false;
+        break;
+      }
+      binding.input_tensor_names.push_back(tensor_name);
+      callable_options.add_feed(tensor_name);
+    }
+    for (const string& arg : binding.output_args) {
+      const string& tensor_name = signature.outputs().at(arg).name();
+      if (tensor_name.empty()) {
+        tensor_args_only = false;
+        break;
+      }
+      binding.output_tensor_names.push_back(tensor_name);
+      callable_options.add_fetch(tensor_name);
+    }
+    if (!tensor_args_only) {
+      continue;
+    }
+
+    const absl::Status status =
+        bundle->session->MakeCallable(callable_options, &binding.callable);
+    if (absl::IsUnimplemented(status)) {
+      bundle->signature_bindings.clear();
+      return absl::OkStatus();
+    }
+    if (!status.ok()) {
+      LOG(WARNING) << "Skipping prebound callable for signature '"
+                   << signature_name << "': " << status;
+      continue;
+    }
+    bundle->signature_bindings.emplace(signature_name, std::move(binding));
+  }
+  return absl::OkStatus();
+}
+
 absl::Status LoadSavedModelInternal(const SessionOptions& session_options,
                                     const RunOptions& run_options,
                                     const string& export_dir,
@@ -305,6 +373,7 @@ absl::Status LoadSavedModelInternal(const SessionOptions& session_options,
       session_options, bundle->meta_graph_def, &bundle->session));
   TF_RETURN_IF_ERROR(RestoreSession(run_options, bundle->meta_graph_def,
                                     export_dir, &bundle->session));
+  TF_RETURN_IF_ERROR(BuildSignatureBindings(bundle));
   return absl::OkStatus();
 }
 
@@ -426,6 +495,212 @@ class LiteSessionWrapper : public Session {
  private:
   const std::unique_ptr<Session> wrapped_;
 };
+
+// Session wrapper that defers variable restore and the init op until the
+// session is first used.  The underlying session already instantiates the
+// pruned subgraph for each distinct feed/fetch set lazily on its first Run,
+// so deferring the one-time initialization here completes the lazy-load path:
+// a freshly loaded multi-signature model pays only for the signatures that
+// actually receive traffic.
+class LazyInitSessionWrapper : public Session {
+ public:
+  LazyInitSessionWrapper(std::unique_ptr<Session> wrapped,
+                         RunOptions run_options, string export_dir,
+                         string restore_op_name, string filename_tensor_name,
+                         string init_op_name,
+                         std::vector<AssetFileDef> asset_file_defs)
+      : wrapped_(std::move(wrapped)),
+        run_options_(std::move(run_options)),
+        export_dir_(std::move(export_dir)),
+        restore_op_name_(std::move(restore_op_name)),
+        filename_tensor_name_(std::move(filename_tensor_name)),
+        init_op_name_(std::move(init_op_name)),
+        asset_file_defs_(std::move(asset_file_defs)) {}
+
+  // Runs variable restore and the init op exactly once.  Called implicitly by
+  // the first Run/MakeCallable; calling it eagerly moves the cost to load
+  // time.
+  absl::Status EnsureInitialized() {
+    absl::call_once(init_once_, [this]() {
+      absl::Status s;
+      if (!restore_op_name_.empty()) {
+        s = RunRestore(run_options_, export_dir_, restore_op_name_,
+                       filename_tensor_name_, asset_file_defs_,
+                       wrapped_.get());
+      }
+      if (s.ok()) {
+        s = RunInitOp(run_options_, export_dir_, asset_file_defs_,
+                      wrapped_.get(), init_op_name_);
+      }
+      init_status_ = s;
+    });
+    return init_status_;
+  }
+
+  absl::Status Create(const GraphDef& graph) override {
+    return wrapped_->Create(graph);
+  }
+  absl::Status Create(GraphDef&& graph) override {
+    return wrapped_->Create(std::move(graph));
+  }
+  absl::Status Create(const RunOptions& run_options,
+                      const GraphDef& graph) override {
+    return wrapped_->Create(run_options, graph);
+  }
+  absl::Status Create(const RunOptions& run_options,
+                      GraphDef&& graph) override {
+    return wrapped_->Create(run_options, std::move(graph));
+  }
+
+  absl::Status Extend(const GraphDef& graph) override {
+    return wrapped_->Extend(graph);
+  }
+  absl::Status Extend(GraphDef&& graph) override {
+    return wrapped_->Extend(std::move(graph));
+  }
+  absl::Status Extend(const RunOptions& run_options,
+                      const GraphDef& graph) override {
+    return wrapped_->Extend(run_options, graph);
+  }
+
+  absl::Status Run(const std::vector<std::pair<string, Tensor>>& inputs,
+                   const std::vector<string>& output_tensor_names,
+                   const std::vector<string>& target_node_names,
+                   std::vector<Tensor>* outputs) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->Run(inputs, output_tensor_names, target_node_names,
+                         outputs);
+  }
+
+  absl::Status Run(const RunOptions& run_options,
+                   const std::vector<std::pair<string, Tensor>>& inputs,
+                   const std::vector<string>& output_tensor_names,
+                   const std::vector<string>& target_node_names,
+                   std::vector<Tensor>* outputs,
+                   RunMetadata* run_metadata) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->Run(run_options, inputs, output_tensor_names,
+                         target_node_names, outputs, run_metadata);
+  }
+
+  absl::Status PRunSetup(const std::vector<string>& input_names,
+                         const std::vector<string>& output_names,
+                         const std::vector<string>& target_nodes,
+                         string* handle) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->PRunSetup(input_names, output_names, target_nodes,
+                               handle);
+  }
+
+  absl::Status PRun(const string& handle,
+                    const std::vector<std::pair<string, Tensor>>& inputs,
+                    const std::vector<string>& output_names,
+                    std::vector<Tensor>* outputs) override {
+    return wrapped_->PRun(handle, inputs, output_names, outputs);
+  }
+
+  absl::Status ListDevices(std::vector<DeviceAttributes>* response) override {
+    return wrapped_->ListDevices(response);
+  }
+
+  absl::Status Close(const RunOptions& run_options) override {
+    return wrapped_->Close(run_options);
+  }
+  absl::Status Close() override { return wrapped_->Close(); }
+
+  absl::Status LocalDeviceManager(const DeviceMgr** device_mgr) override {
+    return wrapped_->LocalDeviceManager(device_mgr);
+  }
+
+  absl::Status MakeCallable(const CallableOptions& callable_options,
+                            CallableHandle* out_handle) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->MakeCallable(callable_options, out_handle);
+  }
+
+  absl::Status RunCallable(CallableHandle handle,
+                           const std::vector<Tensor>& feed_tensors,
+                           std::vector<Tensor>* fetch_tensors,
+                           RunMetadata* run_metadata) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->RunCallable(handle, feed_tensors, fetch_tensors,
+                                 run_metadata);
+  }
+
+  absl::Status RunCallable(
+      CallableHandle handle, const std::vector<Tensor>& feed_tensors,
+      std::vector<Tensor>* fetch_tensors, RunMetadata* run_metadata,
+      const thread::ThreadPoolOptions& threadpool_options) override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->RunCallable(handle, feed_tensors, fetch_tensors,
+                                 run_metadata, threadpool_options);
+  }
+
+  absl::Status ReleaseCallable(CallableHandle handle) override {
+    return wrapped_->ReleaseCallable(handle);
+  }
+
+  absl::Status Finalize() override {
+    TF_RETURN_IF_ERROR(EnsureInitialized());
+    return wrapped_->Finalize();
+  }
+
+ private:
+  const std::unique_ptr<Session> wrapped_;
+  const RunOptions run_options_;
+  const string export_dir_;
+  // Empty if the model has no saver (no variables to restore).
+  const string restore_op_name_;
+  const string filename_tensor_name_;
+  // Empty if the model has no init op.
+  const string init_op_name_;
+  const std::vector<AssetFileDef> asset_file_defs_;
+
+  absl::once_flag init_once_;
+  absl::Status init_status_;
+};
+
+// Builds (and immediately releases) a callable for each named signature,
+// concurrently.  Nothing is executed; this primes the session-cached kernels
+// and the per-signature graph pruning and optimization passes so that the
+// first real request does not pay for them.
+absl::Status WarmupSignatures(
+    const protobuf::Map<string, SignatureDef>& signatures,
+    const std::vector<string>& warmup_signatures, Session* session) {
+  std::vector<absl::Status> statuses(warmup_signatures.size());
+  {
+    thread::ThreadPool pool(Env::Default(), "saved_model_warmup",
+                            std::max<int>(1, warmup_signatures.size()));
+    for (size_t i = 0; i < warmup_signatures.size(); ++i) {
+      pool.Schedule([&signatures, &warmup_signatures, &statuses, session,
+                     i]() {
+        const auto it = signatures.find(warmup_signatures[i]);
+        if (it == signatures.end()) {
+          statuses[i] = absl::NotFoundError(
+              absl::StrCat("Warmup signature \"", warmup_signatures[i],
+                           "\" not found in SavedModel"));
+          return;
+        }
+        CallableOptions callable_options;
+        for (const auto& input : it->second.inputs()) {
+          callable_options.add_feed(input.second.name());
+        }
+        for (const auto& output : it->second.outputs()) {
+          callable_options.add_fetch(output.second.name());
+        }
+        Session::CallableHandle handle;
+        statuses[i] = session->MakeCallable(callable_options, &handle);
+        if (statuses[i].ok()) {
+          session->ReleaseCallable(handle).IgnoreError();
+        }
+      });
+    }
+  }  // Joins the warmup pool.
+  for (const absl::Status& status : statuses) {
+    TF_RETURN_IF_ERROR(status);
+  }
+  return absl::OkStatus();
+}
 }  // namespace
 
 absl::Status LoadSavedModelInternal(const SessionOptions& session_options,
@@ -433,18 +708,24 @@ absl::Status LoadSavedModelInternal(const SessionOptions& session_options,
                                     const string& export_dir,
                                     const std::unordered_set<string>& tags,
                                     SavedModelBundleLite* const bundle) {
-  MetaGraphDef meta_graph_def;
-  TF_RETURN_IF_ERROR(
-      ReadMetaGraphDefFromSavedModel(export_dir, tags, &meta_graph_def));
+  // The MetaGraphDef is transient here (only the signature map outlives
+  // loading), so parse it on an arena: a large GraphDef parse allocates
+  // millions of small proto objects, and the arena replaces the per-object
+  // heap traffic and teardown with a wholesale release once the session holds
+  // the graph.
+  protobuf::Arena arena;
+  TF_ASSIGN_OR_RETURN(
+      MetaGraphDef * meta_graph_def,
+      ReadMetaGraphDefFromSavedModel(export_dir, tags, &arena));
   std::unique_ptr<Session> session;
   TF_RETURN_IF_ERROR(LoadGraphDefIntoSession(
-      session_options, std::move(*meta_graph_def.mutable_graph_def()),
+      session_options, std::move(*meta_graph_def->mutable_graph_def()),
       &session));
   TF_RETURN_IF_ERROR(
-      RestoreSession(run_options, meta_graph_def, export_dir, &session));
+      RestoreSession(run_options, *meta_graph_def, export_dir, &session));
   *bundle = SavedModelBundleLite(
       std::make_unique<LiteSessionWrapper>(std::move(session)),
-      std::move(*meta_graph_def.mutable_signature_def()));
+      std::move(*meta_graph_def->mutable_signature_def()));
   return absl::OkStatus();
 }
 
@@ -515,8 +796,8 @@ absl::Status RestoreSession(const RunOptions& run_options,
   string init_op_name;
   TF_RETURN_IF_ERROR(
       internal::GetInitOp(export_dir, meta_graph, &init_op_name));
-  TF_RETURN_IF_ERROR(RunInitOp(run_options, export_dir, meta_graph,
-                               asset_file_defs, session->get(), init_op_name));
+  TF_RETURN_IF_ERROR(RunInitOp(run_options, export_dir, asset_file_defs,
+                               session->get(), init_op_name));
   load_latency_by_stage->GetCell(export_dir, "restore_graph")
       ->Add(restore_graph_walltime);
   // Record wall time spent in init op.
@@ -547,6 +828,68 @@ absl::Status LoadSavedModel(const SessionOptions& session_options,
   return absl::OkStatus();
 }
 
+absl::Status LoadSavedModelLazyInit(
+    const SessionOptions& session_options, const RunOptions& run_options,
+    const string& export_dir, const std::unordered_set<string>& tags,
+    const std::vector<string>& warmup_signatures,
+    SavedModelBundleLite* const bundle) {
+  metrics::SavedModelReadApi(kCCLoadLabel).IncrementBy(1);
+  const uint64 start_microseconds = Env::Default()->NowMicros();
+
+  // Same session hardening as the eager SavedModelBundleLite overload.
+  SessionOptions rewritten_options(session_options);
+  rewritten_options.config.mutable_experimental()
+      ->set_optimize_for_static_graph(true);
+  rewritten_options.config.mutable_experimental()
+      ->set_disable_output_partition_graphs(true);
+
+  // As in LoadSavedModelInternal, the MetaGraphDef is dropped once the
+  // session holds the graph, so parse it on an arena scoped to this load.
+  protobuf::Arena arena;
+  TF_ASSIGN_OR_RETURN(
+      MetaGraphDef * meta_graph_def,
+      ReadMetaGraphDefFromSavedModel(export_dir, tags, &arena));
+  std::vector<AssetFileDef> asset_file_defs;
+  TF_RETURN_IF_ERROR(
+      internal::GetAssetFileDefs(*meta_graph_def, &asset_file_defs));
+  string init_op_name;
+  TF_RETURN_IF_ERROR(
+      internal::GetInitOp(export_dir, *meta_graph_def, &init_op_name));
+  string restore_op_name;
+  string filename_tensor_name;
+  if (meta_graph_def->has_saver_def()) {
+    restore_op_name = meta_graph_def->saver_def().restore_op_name();
+    filename_tensor_name = meta_graph_def->saver_def().filename_tensor_name();
+  }
+
+  std::unique_ptr<Session> session;
+  TF_RETURN_IF_ERROR(LoadGraphDefIntoSession(
+      rewritten_options, std::move(*meta_graph_def->mutable_graph_def()),
+      &session));
+
+  auto lazy_session = std::make_unique<LazyInitSessionWrapper>(
+      std::move(session), run_options, export_dir, std::move(restore_op_name),
+      std::move(filename_tensor_name), std::move(init_op_name),
+      std::move(asset_file_defs));
+
+  if (!warmup_signatures.empty()) {
+    TF_RETURN_IF_ERROR(lazy_session->EnsureInitialized());
+    TF_RETURN_IF_ERROR(WarmupSignatures(meta_graph_def->signature_def(),
+                                        warmup_signatures,
+                                        lazy_session.get()));
+  }
+
+  *bundle = SavedModelBundleLite(
+      std::make_unique<LiteSessionWrapper>(std::move(lazy_session)),
+      std::move(*meta_graph_def->mutable_signature_def()));
+  LOG(INFO) << "SavedModel lazy-init load for tags { "
+            << absl::StrJoin(tags, " ") << " }; " << warmup_signatures.size()
+            << " signature(s) warmed up. Took "
+            << GetLatencyMicroseconds(start_microseconds) << " microseconds.";
+  metrics::SavedModelReadPath().Set(export_dir);
+  return absl::OkStatus();
+}
+
 bool MaybeSavedModelDirectory(const string& export_dir) {
   const string saved_model_pb_path =
       io::JoinPath(export_dir, kSavedModelFilenamePb);
@@ -19,7 +19,9 @@ limitations under the License.
 #define TENSORFLOW_CC_SAVED_MODEL_LOADER_H_
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "tensorflow/core/framework/graph_debug_info.pb.h"
 #include "tensorflow/core/lib/core/status.h"
@@ -47,10 +49,31 @@ class SavedModelBundleInterface {
 /// NOTE: Prefer to use SavedModelBundleLite in new code, as it consumes less
 /// RAM.
 struct SavedModelBundle : public SavedModelBundleInterface {
+  /// Flattened view of one signature, built once at load time: argument and
+  /// tensor names in sorted argument order, plus a session callable prebound
+  /// to the signature's feeds and fetches. Serving code can resolve a
+  /// signature with a single hash probe and call
+  /// `session->RunCallable(binding->callable, ...)` instead of traversing the
+  /// MetaGraphDef proto maps per request.
+  struct SignatureBinding {
+    /// Signature argument names, sorted; positions match the feed order of
+    /// `callable` and the entries of `input_tensor_names`.
+    std::vector<string> input_args;
+    std::vector<string> input_tensor_names;
+    /// Signature result names, sorted; positions match the fetch order of
+    /// `callable` and the entries of `output_tensor_names`.
+    std::vector<string> output_args;
+    std::vector<string> output_tensor_names;
+    Session::CallableHandle callable;
+  };
+
   /// A TensorFlow Session does not Close itself on destruction. To avoid
   /// resource leaks, we explicitly call Close on Sessions that we create.
   ~SavedModelBundle() override {
     if (session) {
+      for (const auto& entry : signature_bindings) {
+        session->ReleaseCallable(entry.second.callable).IgnoreError();
+      }
       session->Close().IgnoreError();
     }
   }
@@ -62,9 +85,20 @@ struct SavedModelBundle : public SavedModelBundleInterface {
     return meta_graph_def.signature_def();
   }
 
+  /// Returns the prebound binding for `signature_name`, or nullptr if no such
+  /// signature exists (or the session does not support callables, in which
+  /// case the table is empty and callers should fall back to GetSignatures()).
+  const SignatureBinding* LookupSignatureBinding(
+      const string& signature_name) const {
+    const auto it = signature_bindings.find(signature_name);
+    return it == signature_bindings.end() ? nullptr : &it->second;
+  }
+
   std::unique_ptr<Session> session;
   MetaGraphDef meta_graph_def;
   std::unique_ptr<GraphDebugInfo> debug_info;
+  /// Signature name -> prebound binding, populated by LoadSavedModel.
+  std::unordered_map<string, SignatureBinding> signature_bindings;
 };
 
 // A version of SavedModelBundle that avoids storing a potentially large
@@ -138,6 +172,26 @@ absl::Status LoadSavedModel(const SessionOptions& session_options,
                             const std::unordered_set<string>& tags,
                             SavedModelBundleLite* bundle);
 
+/// Loads a SavedModel with deferred ("lazy") initialization: the graph is
+/// created in the session, but variable restore and the init op do not run
+/// until the session is first used, and each signature's pruned subgraph is
+/// instantiated on its first Run. For multi-signature models where traffic
+/// hits a subset of signatures, this cuts cold-start to the cost of the
+/// signatures actually used.
+///
+/// "warmup_signatures" names signatures (keys of the SavedModel's
+/// SignatureDef map) to initialize before this call returns: variable restore
+/// and the init op run once, and the listed signatures' subgraphs are
+/// instantiated concurrently. If empty, all initialization is deferred to the
+/// first use of the session, which will block while restore and the init op
+/// run.
+absl::Status LoadSavedModelLazyInit(const SessionOptions& session_options,
+                                    const RunOptions& run_options,
+                                    const string& export_dir,
+                                    const std::unordered_set<string>& tags,
+                                    const std::vector<string>& warmup_signatures,
+                                    SavedModelBundleLite* bundle);
+
 /// Checks whether the provided directory could contain a SavedModel. Note that
 /// the method does not load any data by itself. If the method returns `false`,
 /// the export directory definitely does not contain a SavedModel. If the method
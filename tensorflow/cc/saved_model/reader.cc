@@ -141,6 +141,14 @@ Status ReadMetaGraphDefFromSavedModel(absl::string_view export_dir,
   return absl::OkStatus();
 }
 
+absl::StatusOr<MetaGraphDef*> ReadMetaGraphDefFromSavedModel(
+    absl::string_view export_dir, const std::unordered_set<string>& tags,
+    protobuf::Arena* arena) {
+  SavedModel* saved_model_proto = protobuf::Arena::Create<SavedModel>(arena);
+  TF_RETURN_IF_ERROR(ReadSavedModel(export_dir, saved_model_proto));
+  return FindMetaGraphDef(tags, saved_model_proto);
+}
+
 Status ReadSavedModelDebugInfoIfPresent(
     absl::string_view export_dir,
     std::unique_ptr<GraphDebugInfo>* debug_info_proto) {
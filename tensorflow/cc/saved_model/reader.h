@@ -24,6 +24,7 @@ limitations under the License.
 #include "absl/status/statusor.h"
 #include "tensorflow/core/framework/graph_debug_info.pb.h"
 #include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/protobuf/meta_graph.pb.h"
 #include "tensorflow/core/protobuf/saved_model.pb.h"
@@ -49,6 +50,16 @@ absl::Status ReadMetaGraphDefFromSavedModel(
     absl::string_view export_dir, const std::unordered_set<string>& tags,
     MetaGraphDef* meta_graph_def);
 
+// As above, but parses the SavedModel on `arena` and returns the matching
+// MetaGraphDef, owned by the arena. Callers that drop the proto after
+// constructing a Graph from it should prefer this overload: parsing a large
+// GraphDef allocates millions of small objects, and arena allocation replaces
+// the per-object heap traffic (and the matching per-object destruction) with
+// a wholesale release when the arena goes out of scope.
+absl::StatusOr<MetaGraphDef*> ReadMetaGraphDefFromSavedModel(
+    absl::string_view export_dir, const std::unordered_set<string>& tags,
+    protobuf::Arena* arena);
+
 // Store debug info from the SavedModel export dir.
 absl::Status ReadSavedModelDebugInfoIfPresent(
     absl::string_view export_dir,
@@ -73,6 +73,17 @@ TEST_F(ReaderTest, TagMatch) {
   CheckMetaGraphDef(meta_graph_def);
 }
 
+TEST_F(ReaderTest, TagMatchArena) {
+  protobuf::Arena arena;
+
+  const string export_dir = GetDataDependencyFilepath(TestDataSharded());
+  absl::StatusOr<MetaGraphDef*> meta_graph_def =
+      ReadMetaGraphDefFromSavedModel(export_dir, {kSavedModelTagServe}, &arena);
+  TF_ASSERT_OK(meta_graph_def.status());
+  EXPECT_EQ((*meta_graph_def)->GetArena(), &arena);
+  CheckMetaGraphDef(**meta_graph_def);
+}
+
 TEST_F(ReaderTest, NoTagMatch) {
   MetaGraphDef meta_graph_def;
 
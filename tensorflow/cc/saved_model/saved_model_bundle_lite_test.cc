@@ -148,6 +148,46 @@ TEST_F(LoaderTest, TagMatch) {
   CheckSavedModelBundle(export_dir, bundle);
 }
 
+TEST_F(LoaderTest, LazyInitDeferred) {
+  SavedModelBundleLite bundle;
+  SessionOptions session_options;
+  RunOptions run_options;
+
+  const string export_dir =
+      io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+  // No warmup: restore and the init op run on the first use of the session.
+  TF_ASSERT_OK(LoadSavedModelLazyInit(session_options, run_options, export_dir,
+                                      {kSavedModelTagServe},
+                                      /*warmup_signatures=*/{}, &bundle));
+  CheckSavedModelBundle(export_dir, bundle);
+}
+
+TEST_F(LoaderTest, LazyInitWithWarmup) {
+  SavedModelBundleLite bundle;
+  SessionOptions session_options;
+  RunOptions run_options;
+
+  const string export_dir =
+      io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+  TF_ASSERT_OK(LoadSavedModelLazyInit(session_options, run_options, export_dir,
+                                      {kSavedModelTagServe},
+                                      {"regress_x_to_y"}, &bundle));
+  CheckSavedModelBundle(export_dir, bundle);
+}
+
+TEST_F(LoaderTest, LazyInitUnknownWarmupSignature) {
+  SavedModelBundleLite bundle;
+  SessionOptions session_options;
+  RunOptions run_options;
+
+  const string export_dir =
+      io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+  Status st = LoadSavedModelLazyInit(session_options, run_options, export_dir,
+                                     {kSavedModelTagServe}, {"no-such-sig"},
+                                     &bundle);
+  ASSERT_TRUE(errors::IsNotFound(st));
+}
+
 TEST_F(LoaderTest, NoTagMatch) {
   SavedModelBundleLite bundle;
   RunOptions run_options;
@@ -21,6 +21,7 @@ limitations under the License.
 #include <utility>
 
 #include "absl/strings/str_cat.h"
+#include "tensorflow/compiler/jit/flags.h"
 #include "tensorflow/compiler/jit/xla_activity.pb.h"
 #include "tensorflow/compiler/jit/xla_activity_listener.h"
 #include "tensorflow/core/framework/attr_value.pb.h"
@@ -62,9 +63,6 @@ void RegisterExecutionForCluster(
 // signature before  we attempt to compile it.
 constexpr int64_t kDefaultCompilationThreshold = 2;
 
-// Maximum number of ongoing compilations.
-constexpr int64_t kMaxNumOngoingCompilations = kNumAsyncDeviceCompilerThreads;
-
 }  // namespace
 
 DeviceCompilationProfiler::~DeviceCompilationProfiler() {
@@ -166,6 +164,21 @@ bool DeviceCompilationProfiler::ShouldCompileCluster(
     return false;
   }
 
+  // An explicit cap on compiled variants per cluster. Shapes that were
+  // compiled before the cap was reached keep hitting their executables; the
+  // rest run through the fallback path.
+  const int64_t max_compiles_per_cluster =
+      GetMarkForCompilationPassFlags()->tf_xla_max_compiles_per_cluster;
+  if (max_compiles_per_cluster > 0 &&
+      it->second.compile_count >= max_compiles_per_cluster) {
+    VLOG(2) << "Not compiling cluster " << function.name()
+            << " because it was already compiled "
+            << it->second.compile_count
+            << " times (tf_xla_max_compiles_per_cluster="
+            << max_compiles_per_cluster << ").";
+    return false;
+  }
+
   // TODO(b/255826209): Figure out if Lazy compilation is still needed given
   // that we always compile a cluster the first time it is executed (explained
   // below) regardless of compilation mode. If it is not, clean up the related
@@ -180,8 +193,10 @@ bool DeviceCompilationProfiler::ShouldCompileCluster(
   }
 
   if (compile_mode == DeviceCompileMode::kAsync) {
-    // Asynchronous compilation is enabled.
-    if (num_ongoing_compilations_ >= kMaxNumOngoingCompilations) {
+    // Asynchronous compilation is enabled. One ongoing compilation per
+    // compiler thread at most; further signatures stay on the fallback path
+    // until a thread frees up.
+    if (num_ongoing_compilations_ >= GetNumAsyncDeviceCompilerThreads()) {
       VLOG(2) << "Not asynchronously compiling cluster " << function.name()
               << " because of too many ongoing compilations.";
       return false;
@@ -216,7 +216,7 @@ DeviceCompiler<ExecutableType, ClientType>::DeviceCompiler(
   cache_ = std::make_unique<DeviceCompilationCache<ExecutableType>>();
   async_compiler_threads_ = std::make_unique<tensorflow::thread::ThreadPool>(
       tensorflow::Env::Default(), "async_compiler_threads",
-      kNumAsyncDeviceCompilerThreads);
+      GetNumAsyncDeviceCompilerThreads());
 }
 
 template <typename ExecutableType, typename ClientType>
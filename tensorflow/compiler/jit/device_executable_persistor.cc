@@ -28,6 +28,10 @@ std::string XlaSerializedCacheKeyToFileName(const XlaSerializedCacheKey& key) {
       key.signature_fingerprint(), kXlaSerializedCacheKeySeparator,
       key.cluster_fingerprint(), kXlaSerializedCacheKeySeparator,
       key.device_type(),
+      key.device_compute_capability().empty()
+          ? ""
+          : absl::StrCat(kXlaSerializedCacheKeySeparator,
+                         key.device_compute_capability()),
       key.compiled_using_pjrt()
           ? absl::StrCat(kXlaSerializedCacheKeySeparator, "pjrt")
           : "",
@@ -83,6 +83,13 @@ class DeviceExecutablePersistor {
 
     // Cache is read-only if set to true.
     bool persistent_cache_directory_read_only = false;
+
+    // Compute capability of the device executables will run on (e.g. "8.0"
+    // for CUDA or "gfx90a" for ROCm). Part of the cache key, so that a cache
+    // directory shared across a heterogeneous fleet never serves an
+    // executable compiled for a different architecture. May be left empty for
+    // backends without such a notion.
+    std::string device_compute_capability;
   };
 
   DeviceExecutablePersistor(const Config& config,
@@ -156,6 +163,7 @@ class DeviceExecutablePersistor {
   const DeviceType device_type_;
   const bool disable_strict_signature_checks_;
   const std::string persistence_prefix_;
+  const std::string device_compute_capability_;
 
   // If non-empty, JIT-compiled executables are saved to and loaded from the
   // specified file system directory path.
@@ -175,6 +183,7 @@ DeviceExecutablePersistor<ExecutableType, ClientType>::
     : device_type_(device_type),
       disable_strict_signature_checks_(config.disable_strict_signature_checks),
       persistence_prefix_(config.persistence_prefix),
+      device_compute_capability_(config.device_compute_capability),
       persistent_cache_directory_(config.persistent_cache_directory),
       persistent_cache_directory_read_only_(
           config.persistent_cache_directory_read_only) {}
@@ -197,6 +206,7 @@ DeviceExecutablePersistor<ExecutableType, ClientType>::BuildSerializedCacheKey(
   key.set_device_type(device_type().type_string());
   key.set_prefix(persistence_prefix());
   key.set_compiled_using_pjrt(compiled_using_pjrt);
+  key.set_device_compute_capability(device_compute_capability_);
   return key;
 }
 
@@ -131,6 +131,13 @@ void AppendMarkForCompilationPassFlagsInternal(std::vector<Flag>* flag_list) {
            "Exclude the operations from auto-clustering. "
            "If multiple, separate them with commas."
            " Where, Some_other_ops"),
+      Flag("tf_xla_cluster_exclude_scopes",
+           &mark_for_compilation_flags->tf_xla_cluster_exclude_scopes,
+           "(experimental) "
+           "Exclude nodes whose name starts with one of the given name-scope "
+           "prefixes from auto-clustering. If multiple, separate them with "
+           "commas. Useful for declustering regions that profiling showed to "
+           "be slower under XLA than the native executor."),
       Flag("tf_xla_clustering_debug",
            &mark_for_compilation_flags->tf_xla_clustering_debug,
            "Dump graphs during XLA compilation."),
@@ -175,6 +182,11 @@ void AppendMarkForCompilationPassFlagsInternal(std::vector<Flag>* flag_list) {
            &mark_for_compilation_flags->tf_xla_persistent_cache_prefix,
            "Specifies the persistance cache prefix. Default is "
            "\"xla_compile_cache\""),
+      Flag("tf_xla_max_compiles_per_cluster",
+           &mark_for_compilation_flags->tf_xla_max_compiles_per_cluster,
+           "If non-zero, bounds the number of executables compiled per "
+           "cluster. Additional signatures run through the fallback path. "
+           "0 means unlimited."),
       Flag("tf_xla_sparse_core_disable_table_stacking",
            &sparse_core_flags->tf_xla_sparse_core_disable_table_stacking,
            "Disable table stacking for all the tables passed to the SparseCore"
@@ -245,6 +257,7 @@ void AllocateAndParseFlags() {
   mark_for_compilation_flags->tf_xla_disable_strict_signature_checks = false;
   mark_for_compilation_flags->tf_xla_persistent_cache_prefix =
       "xla_compile_cache";
+  mark_for_compilation_flags->tf_xla_max_compiles_per_cluster = 0;
 
   device_flags = new XlaDeviceFlags;
   device_flags->tf_xla_compile_on_demand = false;
@@ -263,6 +276,8 @@ void AllocateAndParseFlags() {
   ops_flags = new XlaOpsCommonFlags;
   ops_flags->tf_xla_always_defer_compilation = false;
   ops_flags->tf_xla_async_compilation = false;
+  // Matches kNumAsyncDeviceCompilerThreads in xla_compile_util.h.
+  ops_flags->tf_xla_async_compilation_threads = 10;
   ops_flags->tf_xla_use_device_api.enabled_for_xla_launch_ = true;
   ops_flags->tf_xla_use_device_api.enabled_for_compile_on_demand_ = true;
   ops_flags->tf_xla_use_device_api.enabled_for_compile_and_run_ = true;
@@ -334,6 +349,12 @@ void AllocateAndParseFlags() {
             "When lazy compilation is enabled, asynchronous compilation starts "
             "the cluster compilation in the background, and the fallback path "
             "is executed until the compilation has finished."),
+       Flag("tf_xla_async_compilation_threads",
+            &ops_flags->tf_xla_async_compilation_threads,
+            "Number of threads (and maximum number of concurrent "
+            "compilations) used for asynchronous compilation. Compilations "
+            "beyond the limit stay on the fallback path until a thread frees "
+            "up."),
        Flag("tf_xla_use_device_api_for_xla_launch",
             &ops_flags->tf_xla_use_device_api.enabled_for_xla_launch_,
             "If true, uses Device API (PjRt) for single device compilation and "
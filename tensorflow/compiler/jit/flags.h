@@ -68,6 +68,13 @@ struct MarkForCompilationPassFlags {
   // If non-empty, remove following operations from XLA clustering excludelist.
   string tf_xla_cluster_exclude_ops;
 
+  // If non-empty, exclude nodes whose name starts with one of the given
+  // name-scope prefixes (comma separated) from auto-clustering. Intended for
+  // profile-guided tuning: regions measured to run slower under XLA than the
+  // native executor can be declustered without modifying the model. Nodes
+  // explicitly marked for compilation are not affected.
+  string tf_xla_cluster_exclude_scopes;
+
   // Dump graphs during XLA compilation.
   bool tf_xla_clustering_debug;
 
@@ -111,6 +118,14 @@ struct MarkForCompilationPassFlags {
 
   // Specifies the persistance cache prefix. Default is "xla_compile_cache"
   string tf_xla_persistent_cache_prefix;
+
+  // If non-zero, bounds the number of executables compiled per cluster.
+  // Signatures that show up after the limit is reached run through the
+  // fallback path, while previously compiled shapes keep their executables.
+  // Useful for serving workloads with many distinct dynamic shapes, where the
+  // megamorphic-cluster heuristic kicks in too late or not at all. 0 (the
+  // default) means unlimited.
+  int64_t tf_xla_max_compiles_per_cluster;
 };
 
 // Flags associated with XLA Sparse Core.
@@ -151,6 +166,10 @@ struct XlaOpsCommonFlags {
   // If true, _XlaCompile compiles the cluster asynchronously with respect to
   // the main execution. The fallback path is taken while compilation happens.
   bool tf_xla_async_compilation;
+  // Number of threads (and maximum number of concurrent compilations) used
+  // for asynchronous compilation. Compilations beyond the limit stay on the
+  // fallback path until a thread frees up.
+  int64_t tf_xla_async_compilation_threads;
 
   class PjRtForSingleDeviceCompilationRollout {
    public:
@@ -34,6 +34,7 @@ limitations under the License.
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_join.h"
 #include "tensorflow/compiler/jit/compilability_check_util.h"
 #include "tensorflow/compiler/jit/deadness_analysis.h"
@@ -1238,6 +1239,29 @@ absl::flat_hash_set<string> CreateClusterExcludeList() {
   return excludelist;
 }
 
+std::vector<string> CreateScopeExcludeList() {
+  MarkForCompilationPassFlags* flags = GetMarkForCompilationPassFlags();
+  std::vector<string> excludelist;
+  for (auto s : absl::StrSplit(flags->tf_xla_cluster_exclude_scopes, ',')) {
+    if (!s.empty()) {
+      excludelist.push_back(string(s));
+    }
+  }
+  if (VLOG_IS_ON(2) && !excludelist.empty()) {
+    VLOG(2) << "XLA clustering will exclude nodes under the following name "
+               "scopes from auto clustering: "
+            << absl::StrJoin(excludelist, " ");
+  }
+  return excludelist;
+}
+
+bool IsScopeExcludedFromClustering(absl::string_view node_name,
+                                   absl::Span<const string> excluded_scopes) {
+  return absl::c_any_of(excluded_scopes, [&](const string& scope) {
+    return absl::StartsWith(node_name, scope);
+  });
+}
+
 absl::flat_hash_set<string> GetOrCreateAllowlist() {
   absl::flat_hash_map<string, std::vector<string>>* allowlist_table =
       tensorflow::GetAllowlistTable();
@@ -1312,6 +1336,7 @@ absl::Status MarkForCompilationPassImpl::FindCompilationCandidates() {
   }
 
   auto cluster_exclude_op_list = CreateClusterExcludeList();
+  std::vector<string> scope_exclude_list = CreateScopeExcludeList();
   bool allow_where_op = true;
   for (const auto& s : cluster_exclude_op_list) {
     if (s == "Where") {
@@ -1361,6 +1386,16 @@ absl::Status MarkForCompilationPassImpl::FindCompilationCandidates() {
       continue;
     }
 
+    // Skip nodes under name scopes the user declustered (typically because
+    // profiling showed the region to be slower under XLA than the native
+    // executor). Explicit compilation requests take precedence.
+    if (!is_xla_compile_attr_true && !scope_exclude_list.empty() &&
+        IsScopeExcludedFromClustering(node->name(), scope_exclude_list)) {
+      VLOG(2) << "Not clustering " << node->name()
+              << ": excluded by --tf_xla_cluster_exclude_scopes";
+      continue;
+    }
+
     RecursiveCompilabilityChecker::OperationFilter filter =
         CreateOperationFilter(*registration);
     filter.require_always_compilable = true;
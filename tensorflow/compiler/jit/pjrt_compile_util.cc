@@ -60,7 +60,7 @@ absl::Status CompileToPjRtLoadedExecutable(
   *client = pjrt_device_compiler->client();
 
   XlaCompiler::Options options = GenerateCompilerOptionsForPjRt(
-      *flr, device, platform_info, pjrt_device_compiler);
+      *flr, device, platform_info, pjrt_device_compiler, has_ref_vars);
 
   XlaCompiler::CompileOptions compile_options =
       GenerateCompileOptions(has_ref_vars, may_alias_resource_update);
@@ -177,9 +177,9 @@ absl::Status XlaCompileOnDemandOp::Compile(
       *ctx, platform_info_, ctx->function_library(), pjrt_device_compiler,
       profiler));
 
-  XlaCompiler::Options options =
-      GenerateCompilerOptionsForPjRt(*(ctx->function_library()), ctx->device(),
-                                     platform_info_, *pjrt_device_compiler);
+  XlaCompiler::Options options = GenerateCompilerOptionsForPjRt(
+      *(ctx->function_library()), ctx->device(), platform_info_,
+      *pjrt_device_compiler, /*has_ref_vars=*/true);
   // No detailed logging for on demand op.
   options.detailed_logging = false;
   XlaCompiler::CompileOptions compile_options = GetCompileOptions(true);
@@ -36,6 +36,12 @@ constexpr const char* kPjRtDeviceCompilationProfilerResourceName =
     "pjrt_device_compilation_profiler";
 }  // namespace
 
+int64_t GetNumAsyncDeviceCompilerThreads() {
+  const int64_t threads =
+      GetXlaOpsCommonFlags()->tf_xla_async_compilation_threads;
+  return threads > 0 ? threads : kNumAsyncDeviceCompilerThreads;
+}
+
 absl::StatusOr<std::unique_ptr<Graph>> CreateSingleOpGraph(
     const NodeDef& node_def, absl::Span<const XlaArgument> args,
     absl::Span<const DataType> result_types) {
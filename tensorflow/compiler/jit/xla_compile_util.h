@@ -23,9 +23,18 @@ limitations under the License.
 #include "tensorflow/core/graph/graph.h"
 
 namespace tensorflow {
-// The number of compiler threads to use for asynchronous device compilation.
+// The default number of compiler threads to use for asynchronous device
+// compilation.
 inline constexpr int64_t kNumAsyncDeviceCompilerThreads = 10;
 
+// The number of compiler threads (and the maximum number of concurrent
+// compilations) to use for asynchronous device compilation. Returns the
+// tf_xla_async_compilation_threads flag if it is set to a positive value and
+// kNumAsyncDeviceCompilerThreads otherwise. Serving jobs that see p99 latency
+// spikes when the traffic's shape distribution shifts can raise the flag to
+// drain the resulting compilation backlog faster.
+int64_t GetNumAsyncDeviceCompilerThreads();
+
 enum class DeviceCompileMode {
   kLazy,
   kStrict,
@@ -89,18 +89,19 @@ XlaCompiler::Options GenerateCompilerOptionsForPjRt(
     const FunctionLibraryRuntime& function_library,
     const DeviceBase* device_base, const XlaPlatformInfo& platform_info,
     const DeviceCompiler<xla::PjRtLoadedExecutable, xla::PjRtClient>*
-        pjrt_device_compiler) {
+        pjrt_device_compiler,
+    bool has_ref_vars) {
   return GenerateCompilerOptionsForPjRt(
       function_library.GetFunctionLibraryDefinition(),
       function_library.graph_def_version(), device_base, platform_info,
-      pjrt_device_compiler);
+      pjrt_device_compiler, has_ref_vars);
 }
 
 XlaCompiler::Options GenerateCompilerOptionsForPjRt(
     const FunctionLibraryDefinition* function_library_def,
     int graph_def_version, const DeviceBase* device_base,
     const XlaPlatformInfo& platform_info,
-    const PjRtDeviceCompiler* pjrt_device_compiler) {
+    const PjRtDeviceCompiler* pjrt_device_compiler, bool has_ref_vars) {
   XlaCompiler::Options options;
   absl::StatusOr<int> platform_device_id =
       tsl::GetPlatformDeviceIdFromDeviceParsedName(
@@ -129,7 +130,14 @@ XlaCompiler::Options GenerateCompilerOptionsForPjRt(
   }
   // TODO(b/255826209): Confirm below options are correctly set after testing.
   options.allow_cpu_custom_calls = false;
-  options.alias_passthrough_params = false;
+  // If reference variables are not present in the graph, we can safely alias
+  // passthrough parameters without performing a copy. The PjRt execution path
+  // tracks donatable inputs per launch, so unmodified resource variables flow
+  // through to outputs by reference instead of being copied every step. The
+  // aliases are may-alias, so XLA falls back to a copy whenever a buffer
+  // cannot be donated.
+  options.alias_passthrough_params =
+      !has_ref_vars && !platform_info.is_on_xla_device();
 
   LogOptions(options);
   return options;
@@ -39,21 +39,25 @@ XlaCompiler::Options GenerateCompilerOptionsForTfrtTpu(
     const FunctionLibraryRuntime& function_library);
 
 // Returns created options for XLA compiler when PjRt (Device API) is used for
-// compilation and execution.
+// compilation and execution. When `has_ref_vars` is false, parameters that are
+// passed through to outputs unchanged (e.g. unmodified resource variables) are
+// aliased to those outputs instead of being copied on every launch.
 XlaCompiler::Options GenerateCompilerOptionsForPjRt(
     const FunctionLibraryRuntime& function_library,
     const DeviceBase* device_base, const XlaPlatformInfo& platform_info,
     const DeviceCompiler<xla::PjRtLoadedExecutable, xla::PjRtClient>*
-        pjrt_device_compiler);
+        pjrt_device_compiler,
+    bool has_ref_vars);
 
 // Returns created options for XLA compiler when PjRt (Device API) is used for
-// compilation and execution.
+// compilation and execution. See above for the meaning of `has_ref_vars`.
 XlaCompiler::Options GenerateCompilerOptionsForPjRt(
     const FunctionLibraryDefinition* function_library_def,
     int graph_def_version, const DeviceBase* device_base,
     const XlaPlatformInfo& platform_info,
     const DeviceCompiler<xla::PjRtLoadedExecutable, xla::PjRtClient>*
-        pjrt_device_compiler);
+        pjrt_device_compiler,
+    bool has_ref_vars);
 
 // Returns created CompileOptions for XLA compiler.
 XlaCompiler::CompileOptions GenerateCompileOptions(
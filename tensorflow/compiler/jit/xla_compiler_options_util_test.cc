@@ -120,13 +120,14 @@ TEST_F(XlaCompilerOptionsTest, PjRtOptionsXlaDevice) {
 
   XlaCompiler::Options options = GenerateCompilerOptionsForPjRt(
       *device_setup_.flr(), device, platform_info,
-      /*pjrt_device_compiler=*/nullptr);
+      /*pjrt_device_compiler=*/nullptr, /*has_ref_vars=*/false);
 
   EXPECT_EQ(options.device_type, compilation_device_type);
   EXPECT_EQ(options.device_ordinal, 0);
   EXPECT_NE(options.flib_def, nullptr);
   EXPECT_EQ(options.graph_def_version, TF_GRAPH_DEF_VERSION);
   EXPECT_FALSE(options.allow_cpu_custom_calls);
+  // Aliasing is not used on XLA devices, even without reference variables.
   EXPECT_FALSE(options.alias_passthrough_params);
   // Check if options have the supplied shape determination functions set.
   TF_ASSERT_OK_AND_ASSIGN(
@@ -156,13 +157,14 @@ TEST_F(XlaCompilerOptionsTest, PjRtOptionsPjRtBaseDevice) {
 
   XlaCompiler::Options options = GenerateCompilerOptionsForPjRt(
       *device_setup_.flr(), device, platform_info,
-      /*pjrt_device_compiler=*/nullptr);
+      /*pjrt_device_compiler=*/nullptr, /*has_ref_vars=*/true);
 
   EXPECT_EQ(options.device_type, compilation_device_type);
   EXPECT_EQ(options.device_ordinal, 0);
   EXPECT_NE(options.flib_def, nullptr);
   EXPECT_EQ(options.graph_def_version, TF_GRAPH_DEF_VERSION);
   EXPECT_FALSE(options.allow_cpu_custom_calls);
+  // Reference variables disable passthrough-parameter aliasing.
   EXPECT_FALSE(options.alias_passthrough_params);
   // Check if options have the supplied shape determination functions set.
   TF_ASSERT_OK_AND_ASSIGN(
@@ -191,14 +193,17 @@ TEST_F(XlaCompilerOptionsTest, PjRtOptionsNonXlaDevice) {
   core::ScopedUnref pjrt_device_compiler_ref(pjrt_device_compiler);
 
   XlaCompiler::Options options = GenerateCompilerOptionsForPjRt(
-      *device_setup_.flr(), device, platform_info, pjrt_device_compiler);
+      *device_setup_.flr(), device, platform_info, pjrt_device_compiler,
+      /*has_ref_vars=*/false);
 
   EXPECT_EQ(options.device_type, compilation_device_type);
   EXPECT_EQ(options.device_ordinal, 0);
   EXPECT_NE(options.flib_def, nullptr);
   EXPECT_EQ(options.graph_def_version, TF_GRAPH_DEF_VERSION);
   EXPECT_FALSE(options.allow_cpu_custom_calls);
-  EXPECT_FALSE(options.alias_passthrough_params);
+  // Without reference variables on a non-XLA device, passthrough parameters
+  // are aliased to outputs.
+  EXPECT_TRUE(options.alias_passthrough_params);
   // Check whether options have default shape determination functions set.
   TF_ASSERT_OK_AND_ASSIGN(
       auto shape, options.shape_determination_fns.shape_representation_fn(
@@ -20,6 +20,7 @@ limitations under the License.
 #include <set>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "absl/algorithm/container.h"
@@ -35,6 +36,7 @@ limitations under the License.
 #include "xla/client/local_client.h"
 #include "xla/pjrt/pjrt_client.h"
 #include "xla/service/compiler.h"
+#include "xla/stream_executor/device_description.h"
 #include "xla/stream_executor/platform_manager.h"
 #include "xla/tsl/framework/device_type.h"
 #include "tensorflow/core/framework/function.h"
@@ -59,9 +61,43 @@ using XlaDeviceExecutablePersistor =
 using PjRtDeviceExecutablePersistor =
     DeviceExecutablePersistor<xla::PjRtLoadedExecutable, xla::PjRtClient>;
 
+// Returns the compute capability of the device executables will run on, e.g.
+// "8.0" for CUDA or "gfx90a" for ROCm, used as part of the persistent cache
+// key. Returns an empty string for backends without a compute capability.
+std::string GetDeviceComputeCapability(xla::LocalClient* local_client) {
+  if (local_client == nullptr) return "";
+  se::StreamExecutor* executor =
+      local_client->backend().default_stream_executor();
+  if (executor == nullptr) return "";
+  return std::visit(
+      [](const auto& cc) {
+        std::string capability = cc.ToString();
+        // The host backend leaves the default-constructed (0.0) CUDA compute
+        // capability in the device description.
+        return capability == "0.0" ? std::string() : capability;
+      },
+      executor->GetDeviceDescription().gpu_compute_capability());
+}
+
+std::string GetDeviceComputeCapability(xla::PjRtClient* pjrt_client) {
+  if (pjrt_client == nullptr || pjrt_client->addressable_devices().empty()) {
+    return "";
+  }
+  // PjRt GPU devices advertise their compute capability as a device attribute;
+  // other backends simply don't have the attribute.
+  const auto& attributes =
+      pjrt_client->addressable_devices().front()->Attributes();
+  auto it = attributes.find("compute_capability");
+  if (it == attributes.end()) return "";
+  const std::string* capability = std::get_if<std::string>(&it->second);
+  return capability != nullptr ? *capability : "";
+}
+
 XlaDeviceCompiler* CreateXlaDeviceCompiler(
-    const XlaDeviceExecutablePersistor::Config& persistor_config,
+    XlaDeviceExecutablePersistor::Config persistor_config,
     DeviceType compilation_device_type, xla::LocalClient* local_client) {
+  persistor_config.device_compute_capability =
+      GetDeviceComputeCapability(local_client);
   return new XlaDeviceCompiler(
       std::make_unique<XlaDeviceExecutablePersistor>(
           std::move(persistor_config), compilation_device_type),
@@ -78,6 +114,8 @@ PjRtDeviceCompiler* CreatePjRtDeviceCompiler(DeviceType compilation_device_type,
       GetMarkForCompilationPassFlags()->tf_xla_disable_strict_signature_checks,
       GetMarkForCompilationPassFlags()->tf_xla_persistent_cache_prefix,
       GetMarkForCompilationPassFlags()->tf_xla_persistent_cache_read_only);
+  persistor_config.device_compute_capability =
+      GetDeviceComputeCapability(pjrt_client);
 
   return new PjRtDeviceCompiler(
       std::make_unique<PjRtDeviceExecutablePersistor>(
@@ -32,6 +32,7 @@ limitations under the License.
 #include "tensorflow/compiler/mlir/tensorflow/utils/data_dumper_logger_config.h"
 #include "tensorflow/compiler/mlir/tensorflow/utils/dump_mlir_util.h"
 #include "tensorflow/compiler/mlir/tf2xla/internal/logging_hooks.h"
+#include "tensorflow/compiler/mlir/tf2xla/internal/utils/module_sharding_utils.h"
 #include "xla/tsl/lib/monitoring/counter.h"
 #include "tensorflow/core/platform/error_payloads.h"
 #include "tensorflow/core/platform/status.h"
@@ -151,7 +152,23 @@ absl::Status ExportFromTensorflowDialectToExecutor(
     }
   }
 
-  LogicalResult result = tf_to_executor.run(module);
+  LogicalResult result;
+  if (VLOG_IS_ON(1) ||
+      DEBUG_DATA_DUMPER()->ShouldDump(module_name.str(), kDebugGroupMain)) {
+    // Keep the single pass-manager run while debug dumping is active so the
+    // IR-printing instrumentation observes the whole module.
+    result = tf_to_executor.run(module);
+  } else {
+    // Shard independent entry functions across the context's thread pool;
+    // falls back to a whole-module run when sharding is not applicable.
+    absl::Status sharded_status = internal::RunPipelineShardedByEntryFunction(
+        module, AddTfDialectToExecutorPasses);
+    if (!sharded_status.ok()) {
+      VLOG(1) << "Sharded TF dialect to executor export failed: "
+              << sharded_status;
+    }
+    result = mlir::success(sharded_status.ok());
+  }
 
   if (VLOG_IS_ON(1) ||
       DEBUG_DATA_DUMPER()->ShouldDump(module_name.str(), kDebugGroupMain)) {
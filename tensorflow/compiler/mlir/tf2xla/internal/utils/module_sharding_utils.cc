@@ -0,0 +1,198 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/compiler/mlir/tf2xla/internal/utils/module_sharding_utils.h"
+
+#include <optional>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"  // from @llvm-project
+#include "mlir/IR/Builders.h"  // from @llvm-project
+#include "mlir/IR/BuiltinOps.h"  // from @llvm-project
+#include "mlir/IR/MLIRContext.h"  // from @llvm-project
+#include "mlir/IR/OwningOpRef.h"  // from @llvm-project
+#include "mlir/IR/SymbolTable.h"  // from @llvm-project
+#include "mlir/IR/Threading.h"  // from @llvm-project
+#include "mlir/Pass/PassManager.h"  // from @llvm-project
+#include "mlir/Support/LLVM.h"  // from @llvm-project
+#include "mlir/Support/LogicalResult.h"  // from @llvm-project
+
+namespace tensorflow {
+namespace tf2xla {
+namespace internal {
+
+namespace {
+
+// Collects `root` and every top-level operation it transitively references
+// through the symbol table into `reachable`, preserving discovery order.
+// Fails if `root` contains a region holding an unknown nested symbol table,
+// in which case the symbol uses cannot be enumerated.
+mlir::LogicalResult CollectReachableSymbols(
+    mlir::SymbolTable& symbol_table, mlir::Operation* root,
+    llvm::SetVector<mlir::Operation*>& reachable) {
+  llvm::SmallVector<mlir::Operation*> worklist = {root};
+  reachable.insert(root);
+  while (!worklist.empty()) {
+    mlir::Operation* op = worklist.pop_back_val();
+    std::optional<mlir::SymbolTable::UseRange> uses =
+        mlir::SymbolTable::getSymbolUses(op);
+    if (!uses.has_value()) return mlir::failure();
+    for (const mlir::SymbolTable::SymbolUse& use : *uses) {
+      mlir::Operation* symbol =
+          symbol_table.lookup(use.getSymbolRef().getRootReference());
+      if (symbol && reachable.insert(symbol)) worklist.push_back(symbol);
+    }
+  }
+  return mlir::success();
+}
+
+}  // namespace
+
+absl::Status RunPipelineShardedByEntryFunction(
+    mlir::ModuleOp module,
+    llvm::function_ref<void(mlir::OpPassManager&)> pipeline_builder) {
+  auto run_pipeline = [&](mlir::ModuleOp target) -> mlir::LogicalResult {
+    mlir::PassManager pm(target.getContext());
+    pipeline_builder(pm);
+    return pm.run(target);
+  };
+
+  llvm::SmallVector<mlir::func::FuncOp> entries;
+  bool shardable = module.getContext()->isMultithreadingEnabled();
+  for (mlir::Operation& op : module.getBody()->getOperations()) {
+    auto func = llvm::dyn_cast<mlir::func::FuncOp>(op);
+    if (!func) {
+      // Non-function top-level ops (e.g. saved-model globals) have no clear
+      // owning shard.
+      shardable = false;
+      break;
+    }
+    if (func.isPublic()) entries.push_back(func);
+  }
+  if (entries.size() < 2) shardable = false;
+
+  // Each shard clones the symbols reachable from its entry. An entry that
+  // reaches another public symbol would duplicate that symbol across shards,
+  // and public duplicates cannot be renamed during the merge, so fall back to
+  // a whole-module run in that case.
+  llvm::SmallVector<llvm::SetVector<mlir::Operation*>> reachable_per_entry;
+  if (shardable) {
+    mlir::SymbolTable symbol_table(module);
+    for (mlir::func::FuncOp entry : entries) {
+      llvm::SetVector<mlir::Operation*> reachable;
+      if (mlir::failed(CollectReachableSymbols(symbol_table, entry,
+                                               reachable))) {
+        shardable = false;
+        break;
+      }
+      for (mlir::Operation* op : reachable) {
+        auto func = llvm::cast<mlir::func::FuncOp>(op);
+        if (func != entry && func.isPublic()) {
+          shardable = false;
+          break;
+        }
+      }
+      if (!shardable) break;
+      reachable_per_entry.push_back(std::move(reachable));
+    }
+  }
+
+  if (!shardable) {
+    if (mlir::failed(run_pipeline(module))) {
+      return absl::InternalError(
+          "Failed to run pass pipeline on unsharded module.");
+    }
+    return absl::OkStatus();
+  }
+
+  // Private functions unreachable from any entry are carried by the first
+  // shard so the merged module does not silently drop them.
+  for (mlir::Operation& op : module.getBody()->getOperations()) {
+    bool assigned = llvm::any_of(
+        reachable_per_entry,
+        [&](const llvm::SetVector<mlir::Operation*>& reachable) {
+          return reachable.contains(&op);
+        });
+    if (!assigned) reachable_per_entry.front().insert(&op);
+  }
+
+  // Build one shard module per entry function, cloning its reachable symbols
+  // in their original order.
+  llvm::SmallVector<mlir::OwningOpRef<mlir::ModuleOp>> shards;
+  shards.reserve(entries.size());
+  for (const llvm::SetVector<mlir::Operation*>& reachable :
+       reachable_per_entry) {
+    mlir::OwningOpRef<mlir::ModuleOp> shard =
+        mlir::ModuleOp::create(module.getLoc());
+    (*shard)->setAttrs(module->getAttrDictionary());
+    mlir::OpBuilder builder(shard->getContext());
+    builder.setInsertionPointToEnd(shard->getBody());
+    for (mlir::Operation& op : module.getBody()->getOperations()) {
+      if (reachable.contains(&op)) builder.clone(op);
+    }
+    shards.push_back(std::move(shard));
+  }
+
+  // Lower the shards concurrently on the context's thread pool.
+  if (mlir::failed(mlir::failableParallelForEach(
+          module.getContext(), shards,
+          [&](mlir::OwningOpRef<mlir::ModuleOp>& shard) {
+            return run_pipeline(shard.get());
+          }))) {
+    return absl::InternalError("Failed to run pass pipeline on module shard.");
+  }
+
+  // Deterministic merge: replace the module body with the shard contents in
+  // the original entry order, renaming colliding private symbols.
+  for (mlir::Operation& op :
+       llvm::make_early_inc_range(module.getBody()->getOperations())) {
+    op.erase();
+  }
+  module->setAttrs(shards.front().get()->getAttrDictionary());
+  mlir::SymbolTable merged_symbol_table(module);
+  for (mlir::OwningOpRef<mlir::ModuleOp>& shard : shards) {
+    mlir::SymbolTable shard_symbol_table(shard.get());
+    for (mlir::Operation& op :
+         llvm::make_early_inc_range(shard.get().getBody()->getOperations())) {
+      auto symbol = llvm::dyn_cast<mlir::SymbolOpInterface>(&op);
+      if (symbol && merged_symbol_table.lookup(symbol.getNameAttr())) {
+        if (!symbol.isPrivate()) {
+          return absl::InternalError(
+              "Duplicate public symbol produced while merging module shards.");
+        }
+        if (mlir::failed(shard_symbol_table.renameToUnique(
+                &op, {&merged_symbol_table, &shard_symbol_table}))) {
+          return absl::InternalError(
+              "Failed to rename private symbol while merging module shards.");
+        }
+      }
+      op.remove();
+      if (symbol) {
+        merged_symbol_table.insert(&op);
+      } else {
+        module.getBody()->push_back(&op);
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace internal
+}  // namespace tf2xla
+}  // namespace tensorflow
@@ -0,0 +1,54 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_COMPILER_MLIR_TF2XLA_INTERNAL_UTILS_MODULE_SHARDING_UTILS_H_
+#define TENSORFLOW_COMPILER_MLIR_TF2XLA_INTERNAL_UTILS_MODULE_SHARDING_UTILS_H_
+
+#include "absl/status/status.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "mlir/IR/BuiltinOps.h"  // from @llvm-project
+#include "mlir/Pass/PassManager.h"  // from @llvm-project
+
+namespace tensorflow {
+namespace tf2xla {
+namespace internal {
+
+// Runs the pass pipeline built by `pipeline_builder` over `module`. When the
+// module has more than one public (entry) function, every top-level operation
+// is a function, and no entry transitively reaches another public symbol, the
+// module is sharded into one submodule per entry function — each shard
+// receives a clone of the symbols reachable from its entry — and the shards
+// are processed concurrently on the context's thread pool. Within a shard,
+// MLIR additionally parallelizes nested per-function passes as usual.
+//
+// The processed shards are merged back into `module` in the original entry
+// order, renaming colliding private symbols, so the resulting module is
+// deterministic and independent of thread scheduling. Private helpers shared
+// by several entries are duplicated, one copy per shard. Module-level
+// attribute changes made by the pipeline are preserved from the first shard
+// only.
+//
+// Falls back to a regular single pass-manager run when sharding is not
+// applicable (single entry, multithreading disabled, non-function top-level
+// ops, or entries reaching other public symbols).
+absl::Status RunPipelineShardedByEntryFunction(
+    mlir::ModuleOp module,
+    llvm::function_ref<void(mlir::OpPassManager&)> pipeline_builder);
+
+}  // namespace internal
+}  // namespace tf2xla
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_COMPILER_MLIR_TF2XLA_INTERNAL_UTILS_MODULE_SHARDING_UTILS_H_
@@ -0,0 +1,108 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/compiler/mlir/tf2xla/internal/utils/module_sharding_utils.h"
+
+#include <gtest/gtest.h>
+#include "mlir/Dialect/Func/IR/FuncOps.h"  // from @llvm-project
+#include "mlir/IR/BuiltinOps.h"  // from @llvm-project
+#include "mlir/IR/MLIRContext.h"  // from @llvm-project
+#include "mlir/IR/OwningOpRef.h"  // from @llvm-project
+#include "mlir/IR/SymbolTable.h"  // from @llvm-project
+#include "mlir/Parser/Parser.h"  // from @llvm-project
+#include "mlir/Pass/PassManager.h"  // from @llvm-project
+#include "mlir/Transforms/Passes.h"  // from @llvm-project
+
+namespace tensorflow {
+namespace tf2xla {
+namespace internal {
+
+namespace {
+
+using mlir::MLIRContext;
+using mlir::ModuleOp;
+using mlir::OwningOpRef;
+
+constexpr char kTwoEntryModule[] = R"mlir(
+module {
+  func.func private @helper(%arg0: tensor<f32>) -> tensor<f32> {
+    return %arg0 : tensor<f32>
+  }
+  func.func @entry_a(%arg0: tensor<f32>) -> tensor<f32> {
+    %0 = func.call @helper(%arg0) : (tensor<f32>) -> tensor<f32>
+    return %0 : tensor<f32>
+  }
+  func.func @entry_b(%arg0: tensor<f32>) -> tensor<f32> {
+    %0 = func.call @helper(%arg0) : (tensor<f32>) -> tensor<f32>
+    return %0 : tensor<f32>
+  }
+})mlir";
+
+constexpr char kSingleEntryModule[] = R"mlir(
+module {
+  func.func @main(%arg0: tensor<f32>) -> tensor<f32> {
+    return %arg0 : tensor<f32>
+  }
+})mlir";
+
+void AddCanonicalizer(mlir::OpPassManager& pm) {
+  pm.addPass(mlir::createCanonicalizerPass());
+}
+
+class ModuleShardingUtilsTest : public ::testing::Test {
+ protected:
+  OwningOpRef<ModuleOp> ParseModule(const char* source) {
+    context_.loadDialect<mlir::func::FuncDialect>();
+    return mlir::parseSourceString<ModuleOp>(source, &context_);
+  }
+
+  MLIRContext context_;
+};
+
+TEST_F(ModuleShardingUtilsTest, ShardsAndMergesMultiEntryModule) {
+  OwningOpRef<ModuleOp> module = ParseModule(kTwoEntryModule);
+  ASSERT_TRUE(module);
+
+  ASSERT_TRUE(
+      RunPipelineShardedByEntryFunction(module.get(), AddCanonicalizer).ok());
+
+  // Both entries survive the merge with their public names, and each call
+  // still resolves to a helper in the merged module.
+  mlir::SymbolTable symbol_table(module.get());
+  for (const char* entry_name : {"entry_a", "entry_b"}) {
+    auto entry = symbol_table.lookup<mlir::func::FuncOp>(entry_name);
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry.isPublic());
+    entry.walk([&](mlir::func::CallOp call) {
+      EXPECT_TRUE(symbol_table.lookup<mlir::func::FuncOp>(call.getCallee()));
+    });
+  }
+}
+
+TEST_F(ModuleShardingUtilsTest, SingleEntryFallsBackToWholeModuleRun) {
+  OwningOpRef<ModuleOp> module = ParseModule(kSingleEntryModule);
+  ASSERT_TRUE(module);
+
+  ASSERT_TRUE(
+      RunPipelineShardedByEntryFunction(module.get(), AddCanonicalizer).ok());
+
+  mlir::SymbolTable symbol_table(module.get());
+  EXPECT_TRUE(symbol_table.lookup<mlir::func::FuncOp>("main"));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace tf2xla
+}  // namespace tensorflow
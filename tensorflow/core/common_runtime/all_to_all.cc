@@ -112,6 +112,27 @@ void AllToAll::Run(StatusCallback done) {
 
   for (int i = 0; i < col_params_->group.group_size; ++i) {
     auto default_rank = col_params_->default_rank;
+    if (i == default_rank) {
+      // The chunk this device exchanges with itself does not need to go
+      // through the peer buf rendezvous; copy it straight to its output slot.
+      // This matters for workloads that issue many small all-to-alls (e.g.
+      // per-expert MoE dispatch), where the rendezvous bookkeeping dominates
+      // the cost of the local chunk. The copy accounts for both the send and
+      // the receive of the local chunk.
+      StatusCallback done_send = CheckCounterAndCallDone();
+      StatusCallback done_recv = CheckCounterAndCallDone();
+      CollectiveRemoteAccessLocal::MemCpyAsync(
+          col_ctx_->op_ctx->op_device_context(),
+          col_ctx_->op_ctx->op_device_context(), col_ctx_->device,
+          col_ctx_->device, col_ctx_->op_ctx->input_alloc_attr(0),
+          col_ctx_->op_ctx->output_alloc_attr(0), &input_chunks_[i],
+          &output_chunks_[i], /*dev_to_dev_stream_index*/ 0,
+          [done_send, done_recv](const absl::Status& s) {
+            done_send(s);
+            done_recv(s);
+          });
+      continue;
+    }
     // Issue send request from current device to all devices in group.
     DispatchSend(default_rank, i, &input_chunks_[i], CheckCounterAndCallDone());
     // Issue receive requests from all devices to current device.
@@ -0,0 +1,144 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/allocation_attribution.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_cat.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/profiler/lib/scoped_memory_debug_annotation.h"
+#include "tensorflow/core/util/env_var.h"
+
+namespace tensorflow {
+
+/*static*/ AllocationAttributionIndex* AllocationAttributionIndex::Get() {
+  static AllocationAttributionIndex* index = new AllocationAttributionIndex;
+  return index;
+}
+
+/*static*/ bool AllocationAttributionIndex::IsEnabled() {
+  static bool enabled = [] {
+    bool value = false;
+    absl::Status status =
+        ReadBoolFromEnvVar("TF_ALLOCATOR_ATTRIBUTION", false, &value);
+    if (!status.ok()) {
+      LOG(ERROR) << "AllocationAttributionIndex: " << status.message();
+    }
+    return value;
+  }();
+  return enabled;
+}
+
+void AllocationAttributionIndex::RecordAllocation(const string& allocator_name,
+                                                 const void* ptr,
+                                                 size_t num_bytes) {
+  const auto& annotation =
+      tsl::profiler::ScopedMemoryDebugAnnotation::CurrentAnnotation();
+  Attribution attribution;
+  attribution.allocator_name = allocator_name;
+  attribution.num_bytes = num_bytes;
+  attribution.op_name =
+      annotation.pending_op_name ? annotation.pending_op_name : "unknown";
+  attribution.step_id = annotation.pending_step_id;
+  attribution.region_type =
+      annotation.pending_region_type ? annotation.pending_region_type : "";
+  attribution.data_type = annotation.pending_data_type;
+  attribution.tensor_shape = annotation.pending_shape_func();
+  mutex_lock l(mu_);
+  live_[ptr] = std::move(attribution);
+}
+
+void AllocationAttributionIndex::RecordDeallocation(const void* ptr) {
+  mutex_lock l(mu_);
+  live_.erase(ptr);
+}
+
+void AllocationAttributionIndex::ExportToMemoryProfile(
+    profiler::MemoryProfile* profile) const {
+  mutex_lock l(mu_);
+  for (const auto& entry : live_) {
+    const Attribution& attribution = entry.second;
+    profiler::PerAllocatorMemoryProfile& per_allocator =
+        (*profile->mutable_memory_profile_per_allocator())
+            [attribution.allocator_name];
+    profiler::MemoryActivityMetadata* metadata =
+        per_allocator.add_special_allocations();
+    metadata->set_memory_activity(profiler::ALLOCATION);
+    metadata->set_requested_bytes(attribution.num_bytes);
+    metadata->set_allocation_bytes(attribution.num_bytes);
+    metadata->set_address(reinterpret_cast<uintptr_t>(entry.first));
+    metadata->set_tf_op_name(attribution.op_name);
+    metadata->set_step_id(attribution.step_id);
+    metadata->set_region_type(attribution.region_type);
+    metadata->set_data_type(
+        DataTypeString(static_cast<DataType>(attribution.data_type)));
+    metadata->set_tensor_shape(attribution.tensor_shape);
+  }
+  profile->set_num_hosts(1);
+}
+
+string AllocationAttributionIndex::SummarizeByOp(int top_n) const {
+  absl::flat_hash_map<string, std::pair<size_t, int64_t>> by_op;
+  {
+    mutex_lock l(mu_);
+    for (const auto& entry : live_) {
+      auto& bytes_and_count = by_op[entry.second.op_name];
+      bytes_and_count.first += entry.second.num_bytes;
+      ++bytes_and_count.second;
+    }
+  }
+  std::vector<std::pair<string, std::pair<size_t, int64_t>>> sorted(
+      by_op.begin(), by_op.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second.first > b.second.first;
+  });
+  if (sorted.size() > static_cast<size_t>(top_n)) sorted.resize(top_n);
+  string summary = "Live allocations by op:";
+  for (const auto& entry : sorted) {
+    absl::StrAppend(&summary, "\n  ",
+                    strings::HumanReadableNumBytes(entry.second.first), " in ",
+                    entry.second.second, " allocation(s) by ", entry.first);
+  }
+  return summary;
+}
+
+void* AttributionAllocator::AllocateRaw(
+    size_t alignment, size_t num_bytes,
+    const AllocationAttributes& allocation_attr) {
+  void* ptr = allocator_->AllocateRaw(alignment, num_bytes, allocation_attr);
+  if (ptr != nullptr) {
+    AllocationAttributionIndex::Get()->RecordAllocation(allocator_->Name(),
+                                                        ptr, num_bytes);
+  } else {
+    LOG(WARNING) << "Allocation of " << num_bytes << " bytes from "
+                 << allocator_->Name() << " failed. "
+                 << AllocationAttributionIndex::Get()->SummarizeByOp(
+                        /*top_n=*/10);
+  }
+  return ptr;
+}
+
+void AttributionAllocator::DeallocateRaw(void* ptr) {
+  AllocationAttributionIndex::Get()->RecordDeallocation(ptr);
+  allocator_->DeallocateRaw(ptr);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,129 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_ALLOCATION_ATTRIBUTION_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_ALLOCATION_ATTRIBUTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/profiler/protobuf/memory_profile.pb.h"
+
+namespace tensorflow {
+
+// Process-wide index of live allocations attributed to the op that made them.
+//
+// Unlike the chunk tags inside BFCAllocator, which are only compiled in under
+// TENSORFLOW_MEM_DEBUG, this index is available in production builds. It is
+// populated by AttributionAllocator from the thread-local
+// ScopedMemoryDebugAnnotation that OpKernelContext installs around tensor
+// allocations, so each entry carries the executing node's name and step id.
+// Enabled by setting TF_ALLOCATOR_ATTRIBUTION=1; when disabled (the default)
+// no wrapper is installed and allocation cost is unchanged.
+class AllocationAttributionIndex {
+ public:
+  // Returns the process-wide singleton.
+  static AllocationAttributionIndex* Get();
+
+  // Whether attribution was enabled via TF_ALLOCATOR_ATTRIBUTION. Read once
+  // at first use.
+  static bool IsEnabled();
+
+  // Records a live allocation made while the current thread's memory debug
+  // annotation identifies the executing op.
+  void RecordAllocation(const string& allocator_name, const void* ptr,
+                        size_t num_bytes);
+
+  // Removes the entry for `ptr`, if any. Safe to call for pointers that were
+  // allocated before attribution was recording.
+  void RecordDeallocation(const void* ptr);
+
+  // Exports the live allocations as one PerAllocatorMemoryProfile per
+  // allocator in `profile`, with one MemoryActivityMetadata entry per live
+  // allocation in `special_allocations`.
+  void ExportToMemoryProfile(profiler::MemoryProfile* profile) const;
+
+  // Returns a human-readable summary of live bytes grouped by op name, with
+  // the `top_n` largest consumers listed first. Used to annotate OOM logs.
+  string SummarizeByOp(int top_n) const;
+
+ private:
+  struct Attribution {
+    string allocator_name;
+    size_t num_bytes = 0;
+    string op_name;
+    int64_t step_id = 0;
+    string region_type;
+    int32 data_type = 0;
+    string tensor_shape;
+  };
+
+  AllocationAttributionIndex() = default;
+
+  mutable mutex mu_;
+  absl::flat_hash_map<const void*, Attribution> live_ TF_GUARDED_BY(mu_);
+};
+
+// Thin Allocator wrapper that mirrors every allocation and deallocation into
+// the AllocationAttributionIndex. Forwards all other queries to the wrapped
+// allocator. Like the other process-lifetime allocator wrappers, it does not
+// own the wrapped allocator. On a failed allocation it logs the top live
+// consumers by op so OOM reports name the offending ops without a debug build.
+class AttributionAllocator : public Allocator {
+ public:
+  explicit AttributionAllocator(Allocator* allocator)
+      : allocator_(allocator) {}
+  ~AttributionAllocator() override = default;
+
+  std::string Name() override { return allocator_->Name(); }
+  void* AllocateRaw(size_t alignment, size_t num_bytes) override {
+    return AllocateRaw(alignment, num_bytes, AllocationAttributes());
+  }
+  void* AllocateRaw(size_t alignment, size_t num_bytes,
+                    const AllocationAttributes& allocation_attr) override;
+  void DeallocateRaw(void* ptr) override;
+  bool TracksAllocationSizes() const override {
+    return allocator_->TracksAllocationSizes();
+  }
+  size_t RequestedSize(const void* ptr) const override {
+    return allocator_->RequestedSize(ptr);
+  }
+  size_t AllocatedSize(const void* ptr) const override {
+    return allocator_->AllocatedSize(ptr);
+  }
+  int64_t AllocationId(const void* ptr) const override {
+    return allocator_->AllocationId(ptr);
+  }
+  absl::optional<AllocatorStats> GetStats() override {
+    return allocator_->GetStats();
+  }
+  bool ClearStats() override { return allocator_->ClearStats(); }
+  AllocatorMemoryType GetMemoryType() const override {
+    return allocator_->GetMemoryType();
+  }
+
+ private:
+  Allocator* allocator_;  // not owned.
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_ALLOCATION_ATTRIBUTION_H_
@@ -0,0 +1,113 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/allocation_attribution.h"
+
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/profiler/lib/scoped_memory_debug_annotation.h"
+#include "tensorflow/core/profiler/protobuf/memory_profile.pb.h"
+
+namespace tensorflow {
+namespace {
+
+TEST(AllocationAttributionTest, TagsAllocationsWithPendingOp) {
+  AttributionAllocator allocator(cpu_allocator());
+  void* ptr = nullptr;
+  {
+    tsl::profiler::ScopedMemoryDebugAnnotation annotation("test_op",
+                                                          /*step_id=*/42);
+    ptr = allocator.AllocateRaw(Allocator::kAllocatorAlignment, 128);
+  }
+  ASSERT_NE(ptr, nullptr);
+
+  profiler::MemoryProfile profile;
+  AllocationAttributionIndex::Get()->ExportToMemoryProfile(&profile);
+  const auto& per_allocator = profile.memory_profile_per_allocator();
+  auto it = per_allocator.find(cpu_allocator()->Name());
+  ASSERT_NE(it, per_allocator.end());
+  bool found = false;
+  for (const auto& metadata : it->second.special_allocations()) {
+    if (metadata.address() == reinterpret_cast<uintptr_t>(ptr)) {
+      EXPECT_EQ(metadata.tf_op_name(), "test_op");
+      EXPECT_EQ(metadata.step_id(), 42);
+      EXPECT_EQ(metadata.requested_bytes(), 128);
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+
+  allocator.DeallocateRaw(ptr);
+  profiler::MemoryProfile after;
+  AllocationAttributionIndex::Get()->ExportToMemoryProfile(&after);
+  auto after_it = after.memory_profile_per_allocator().find(
+      cpu_allocator()->Name());
+  if (after_it != after.memory_profile_per_allocator().end()) {
+    for (const auto& metadata : after_it->second.special_allocations()) {
+      EXPECT_NE(metadata.address(), reinterpret_cast<uintptr_t>(ptr));
+    }
+  }
+}
+
+TEST(AllocationAttributionTest, SummarizeByOpRanksByLiveBytes) {
+  AttributionAllocator allocator(cpu_allocator());
+  void* big = nullptr;
+  void* small = nullptr;
+  {
+    tsl::profiler::ScopedMemoryDebugAnnotation annotation("big_op",
+                                                          /*step_id=*/1);
+    big = allocator.AllocateRaw(Allocator::kAllocatorAlignment, 1 << 20);
+  }
+  {
+    tsl::profiler::ScopedMemoryDebugAnnotation annotation("small_op",
+                                                          /*step_id=*/1);
+    small = allocator.AllocateRaw(Allocator::kAllocatorAlignment, 64);
+  }
+  ASSERT_NE(big, nullptr);
+  ASSERT_NE(small, nullptr);
+
+  string summary = AllocationAttributionIndex::Get()->SummarizeByOp(10);
+  EXPECT_NE(summary.find("big_op"), string::npos);
+  EXPECT_NE(summary.find("small_op"), string::npos);
+  EXPECT_LT(summary.find("big_op"), summary.find("small_op"));
+
+  allocator.DeallocateRaw(big);
+  allocator.DeallocateRaw(small);
+}
+
+TEST(AllocationAttributionTest, UnannotatedAllocationIsUnknown) {
+  AttributionAllocator allocator(cpu_allocator());
+  void* ptr = allocator.AllocateRaw(Allocator::kAllocatorAlignment, 32);
+  ASSERT_NE(ptr, nullptr);
+
+  profiler::MemoryProfile profile;
+  AllocationAttributionIndex::Get()->ExportToMemoryProfile(&profile);
+  auto it = profile.memory_profile_per_allocator().find(
+      cpu_allocator()->Name());
+  ASSERT_NE(it, profile.memory_profile_per_allocator().end());
+  bool found = false;
+  for (const auto& metadata : it->second.special_allocations()) {
+    if (metadata.address() == reinterpret_cast<uintptr_t>(ptr)) {
+      EXPECT_EQ(metadata.tf_op_name(), "unknown");
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+
+  allocator.DeallocateRaw(ptr);
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -68,7 +68,15 @@ const char* GetCollectiveName(const CollectiveParams* cp, bool nccl) {
       return nccl ? "NcclBroadcast" : "HierarchicalTreeBroadcast";
 
     case REDUCTION_COLLECTIVE:
-      return nccl ? "NcclReduce" : "RingReduce";
+      if (nccl) return "NcclReduce";
+      // A "hierarchical" hint selects the two-level reduce (intra-task
+      // reduce, ring over one leader per task, intra-task broadcast), which
+      // only pays off when the group spans multiple tasks.
+      if (cp->instance.impl_details.communication_hint == "hierarchical" &&
+          cp->group.num_tasks > 1) {
+        return "HierarchicalRingReduce";
+      }
+      return "RingReduce";
 
     case GATHER_COLLECTIVE:
       return nccl ? "NcclGather" : "RingGather";
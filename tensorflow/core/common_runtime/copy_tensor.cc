@@ -300,6 +300,72 @@ void CopyTensor::ViaDMA(StringPiece edge_name, DeviceContext* send_dev_context,
   done(absl::OkStatus());
 }
 
+// static
+void CopyTensor::ViaDMABatch(StringPiece edge_name,
+                             DeviceContext* send_dev_context,
+                             DeviceContext* recv_dev_context, Device* src,
+                             Device* dst,
+                             const AllocatorAttributes src_alloc_attr,
+                             const AllocatorAttributes dst_alloc_attr,
+                             absl::Span<const Tensor* const> inputs,
+                             absl::Span<Tensor* const> outputs,
+                             int dev_to_dev_stream_index, StatusCallback done,
+                             bool sync_dst_compute) {
+  DCHECK_EQ(inputs.size(), outputs.size());
+  if (inputs.empty()) {
+    done(absl::OkStatus());
+    return;
+  }
+
+  const DeviceType src_device_type(
+      src_alloc_attr.on_host() ? DEVICE_CPU : src->attributes().device_type());
+  const DeviceType dst_device_type(
+      dst_alloc_attr.on_host() ? DEVICE_CPU : dst->attributes().device_type());
+  const bool non_cpu_src = src_device_type != DeviceType(DEVICE_CPU);
+  const bool non_cpu_dst = dst_device_type != DeviceType(DEVICE_CPU);
+
+  // Host-to-device is the direction the batched DeviceContext API can
+  // coalesce into a single staged transfer. Variant and non-DMA-able tensors
+  // need the per-tensor path, which knows how to copy them element-wise.
+  if (!non_cpu_src && non_cpu_dst) {
+    bool all_dma = true;
+    for (const Tensor* input : inputs) {
+      if (input->dtype() == DT_VARIANT || input->dtype() == DT_RESOURCE ||
+          !DMAHelper::CanUseDMA(input)) {
+        all_dma = false;
+        break;
+      }
+    }
+    if (all_dma) {
+      tsl::profiler::ScopedAnnotation annotation([&] {
+        return absl::StrCat("#edge_name=", edge_name,
+                            ",batch_size=", inputs.size(), "#");
+      });
+      VLOG(4) << "Batch copy " << edge_name << " of " << inputs.size()
+              << " tensors";
+      recv_dev_context->CopyCPUTensorsToDevice(
+          inputs, dst, outputs, std::move(done), sync_dst_compute);
+      return;
+    }
+  }
+
+  // All other cases: issue per-tensor copies and aggregate the completions.
+  auto* status_cb = new ReffedStatusCallback(std::move(done));
+  core::ScopedUnref status_cb_unref(status_cb);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    status_cb->Ref();
+    ViaDMA(
+        edge_name, send_dev_context, recv_dev_context, src, dst,
+        src_alloc_attr, dst_alloc_attr, inputs[i], outputs[i],
+        dev_to_dev_stream_index,
+        [status_cb](const absl::Status& s) {
+          status_cb->UpdateStatus(s);
+          status_cb->Unref();
+        },
+        sync_dst_compute);
+  }
+}
+
 // static
 absl::Status CopyTensor::Register(DeviceType sender_device_type,
                                   DeviceType receiver_device_type,
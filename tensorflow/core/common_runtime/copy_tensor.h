@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_COMMON_RUNTIME_COPY_TENSOR_H_
 #define TENSORFLOW_CORE_COMMON_RUNTIME_COPY_TENSOR_H_
 
+#include "absl/types/span.h"
 #include "tensorflow/core/common_runtime/device.h"
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/device_base.h"
@@ -48,6 +49,25 @@ class CopyTensor {
                      int dev_to_dev_stream_index, StatusCallback done,
                      bool sync_dst_compute = true);
 
+  // Copies a batch of tensors between the same device pair. Host-to-device
+  // copies of DMA-able tensors are handed to the device context as one
+  // `CopyCPUTensorsToDevice` call, so contexts with staging support can
+  // coalesce the batch into a single transfer; all other cases fall back to
+  // one `ViaDMA` per tensor. `done` is invoked exactly once after every copy
+  // has completed, with the first error observed (if any).
+  //
+  // REQUIRES: `inputs.size() == outputs.size()`, and every output tensor
+  // allocated as for `ViaDMA`.
+  static void ViaDMABatch(StringPiece edge_name,
+                          DeviceContext* send_dev_context,
+                          DeviceContext* recv_dev_context, Device* src,
+                          Device* dst, const AllocatorAttributes src_alloc_attr,
+                          const AllocatorAttributes dst_alloc_attr,
+                          absl::Span<const Tensor* const> inputs,
+                          absl::Span<Tensor* const> outputs,
+                          int dev_to_dev_stream_index, StatusCallback done,
+                          bool sync_dst_compute = true);
+
   // Object used to call Register() at static-initialization time.
   // Note: This should only ever be used as a global-static object; no stack
   // or heap instances.
@@ -158,8 +158,7 @@ void EventMgr::PollLoop() {
       PollEvents(nullptr, &to_free);  // poll all streams
       events_still_pending = !callbacks_.empty();
     }
-    FreeMemory(to_free);
-    to_free.clear();
+    FreeMemory(&to_free);
 
     if (events_still_pending) {
       Env::Default()->SleepForMicroseconds(polling_active_delay_usecs_);
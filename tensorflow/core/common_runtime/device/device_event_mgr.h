@@ -74,7 +74,7 @@ class EventMgr {
       EnqueueCallback(stream, std::move(func));
       PollEvents(stream, &to_free);
     }
-    FreeMemory(to_free);
+    FreeMemory(&to_free);
   }
 
  private:
@@ -96,11 +96,19 @@ class EventMgr {
 
   EventMgr(se::StreamExecutor* se, const GPUOptions& gpu_options);
 
-  void FreeMemory(const ToFreeVector& to_free) {
-    for (const auto& iu : to_free) {
-      // The function must be called in another thread.
-      if (iu.func != nullptr) threadpool_.Schedule(iu.func);
-    }
+  // Runs the callbacks accumulated in `*to_free` and leaves it empty.  The
+  // whole batch is handed to the callback thread as a single closure, so a
+  // poll pass that retires many events costs one threadpool wakeup rather
+  // than one per event.
+  void FreeMemory(ToFreeVector* to_free) {
+    if (to_free->empty()) return;
+    // The functions must be called in another thread.
+    threadpool_.Schedule([batch = std::move(*to_free)]() {
+      for (const auto& iu : batch) {
+        if (iu.func != nullptr) iu.func();
+      }
+    });
+    to_free->clear();
   }
 
   // Set up `func` to be called once `stream` completes all its outstanding
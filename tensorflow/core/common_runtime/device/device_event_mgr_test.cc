@@ -75,7 +75,7 @@ class TEST_EventMgrHelper {
         mutex_lock l(em_->mu_);
         em_->PollEvents(nullptr, &to_free);
       }
-      em_->FreeMemory(to_free);
+      em_->FreeMemory(&to_free);
     }
   }
 
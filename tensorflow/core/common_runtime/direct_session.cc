@@ -40,6 +40,7 @@ limitations under the License.
 #include "tensorflow/core/common_runtime/process_util.h"
 #include "tensorflow/core/common_runtime/rendezvous_mgr.h"
 #include "tensorflow/core/common_runtime/scoped_allocator_mgr.h"
+#include "tensorflow/core/common_runtime/shared_kernel_cache.h"
 #include "tensorflow/core/common_runtime/step_stats_collector.h"
 #include "tensorflow/core/framework/function.h"
 #include "tensorflow/core/framework/graph.pb.h"
@@ -56,6 +57,7 @@ limitations under the License.
 #include "tensorflow/core/graph/graph_partition.h"
 #include "tensorflow/core/graph/subgraph.h"
 #include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/lib/core/blocking_counter.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/notification.h"
 #include "tensorflow/core/lib/core/refcount.h"
@@ -396,6 +398,7 @@ DirectSession::~DirectSession() {
     it.second.reset();
   }
   callables_.clear();
+  run_handles_.clear();
   for (auto d : device_mgr_->ListDevices()) {
     d->op_segment()->RemoveHold(session_handle_);
   }
@@ -884,6 +887,17 @@ absl::Status DirectSession::Run(
     collective_graph_key_ = executors_and_keys->collective_graph_key;
   }
 
+  return RunWithExecutorsAndKeys(run_options, inputs, output_names,
+                                 run_state_args.handle, executors_and_keys,
+                                 outputs, run_metadata, threadpool_options);
+}
+
+absl::Status DirectSession::RunWithExecutorsAndKeys(
+    const RunOptions& run_options, const NamedTensorList& inputs,
+    const std::vector<string>& output_names, const string& step_handle,
+    ExecutorsAndKeys* executors_and_keys, std::vector<Tensor>* outputs,
+    RunMetadata* run_metadata,
+    const thread::ThreadPoolOptions& threadpool_options) {
   // Configure a call frame for the step, which we use to feed and
   // fetch values to and from the executors.
   FunctionCallFrame call_frame(executors_and_keys->input_types,
@@ -910,7 +924,7 @@ absl::Status DirectSession::Run(
   const int64_t step_id = step_id_counter_.fetch_add(1);
 
   if (LogMemory::IsEnabled()) {
-    LogMemory::RecordStep(step_id, run_state_args.handle);
+    LogMemory::RecordStep(step_id, step_handle);
   }
 
   TF_RETURN_IF_ERROR(RunInternal(step_id, run_options, &call_frame,
@@ -1403,6 +1417,17 @@ absl::Status DirectSession::CreateExecutors(
     params.create_kernel =
         [this, lib, opseg](const std::shared_ptr<const NodeProperties>& props,
                            OpKernel** kernel) {
+          // Stateless, non-function kernels may be shared process-wide, so
+          // that sessions loading byte-identical graphs (e.g. A/B variants
+          // of one model) do not re-instantiate them.
+          if (SharedKernelCache::Eligible(props, lib)) {
+            auto create_fn = [lib, &props](OpKernel** kernel) {
+              return lib->CreateKernel(props, kernel);
+            };
+            return SharedKernelCache::Global()->FindOrCreate(
+                lib->device()->name(), props, lib->graph_def_version(),
+                create_fn, kernel);
+          }
           // NOTE(mrry): We must not share function kernels (implemented
           // using `CallOp`) between subgraphs, because `CallOp::handle_`
           // is tied to a particular subgraph. Even if the function itself
@@ -1420,6 +1445,7 @@ absl::Status DirectSession::CreateExecutors(
                                      kernel, create_fn);
         };
     params.delete_kernel = [lib](OpKernel* kernel) {
+      if (kernel && SharedKernelCache::Global()->Owns(kernel)) return;
       if (kernel && !OpSegment::ShouldOwnKernel(lib, kernel->type_string()))
         delete kernel;
     };
@@ -1720,17 +1746,47 @@ absl::Status DirectSession::CreateGraphs(
     }
   }
 
+  // The per-partition GraphDef-to-Graph conversions are independent of each
+  // other and dominate session-creation time for large multi-device graphs,
+  // so run them in parallel on a transient pool.
+  std::vector<std::pair<string, GraphDef>> partition_list;
+  partition_list.reserve(partitions.size());
   for (auto& partition : partitions) {
-    std::unique_ptr<Graph> device_graph(
-        new Graph(client_graph->flib_def.get()));
+    partition_list.emplace_back(partition.first, std::move(partition.second));
+  }
+  std::vector<std::unique_ptr<Graph>> device_graphs(partition_list.size());
+  std::vector<absl::Status> statuses(partition_list.size());
+  auto convert_one = [&client_graph, &partition_list, &device_graphs,
+                      &statuses](size_t i) {
+    auto device_graph = std::make_unique<Graph>(client_graph->flib_def.get());
     device_graph->SetConstructionContext(ConstructionContext::kDirectSession);
     GraphConstructorOptions device_opts;
     // There are internal operations (e.g., send/recv) that we now allow.
     device_opts.allow_internal_ops = true;
     device_opts.expect_device_spec = true;
-    TF_RETURN_IF_ERROR(ConvertGraphDefToGraph(
-        device_opts, std::move(partition.second), device_graph.get()));
-    outputs->emplace(partition.first, std::move(device_graph));
+    statuses[i] = ConvertGraphDefToGraph(
+        device_opts, std::move(partition_list[i].second), device_graph.get());
+    device_graphs[i] = std::move(device_graph);
+  };
+  if (partition_list.size() <= 1) {
+    for (size_t i = 0; i < partition_list.size(); ++i) convert_one(i);
+  } else {
+    const int num_threads = std::min<int>(
+        partition_list.size(), port::MaxParallelism());
+    thread::ThreadPool pool(options_.env, "convert_partitions", num_threads);
+    BlockingCounter counter(partition_list.size());
+    for (size_t i = 0; i < partition_list.size(); ++i) {
+      pool.Schedule([i, &convert_one, &counter] {
+        convert_one(i);
+        counter.DecrementCount();
+      });
+    }
+    counter.Wait();
+  }
+  for (size_t i = 0; i < partition_list.size(); ++i) {
+    TF_RETURN_IF_ERROR(statuses[i]);
+    outputs->emplace(std::move(partition_list[i].first),
+                     std::move(device_graphs[i]));
   }
 
   GraphOptimizationPassOptions optimization_options;
@@ -2040,6 +2096,92 @@ absl::Status DirectSession::ReleaseCallable(CallableHandle handle) {
   return absl::OkStatus();
 }
 
+absl::Status DirectSession::MakeRunHandle(
+    const std::vector<string>& feed_names,
+    const std::vector<string>& fetch_names,
+    const std::vector<string>& target_nodes, int64_t* out_handle) {
+  TF_RETURN_IF_ERROR(CheckNotClosed());
+  TF_RETURN_IF_ERROR(CheckGraphCreated("MakeRunHandle()"));
+
+  CallableOptions callable_options;
+  callable_options.mutable_feed()->Reserve(feed_names.size());
+  for (const string& feed : feed_names) {
+    callable_options.add_feed(feed);
+  }
+  callable_options.mutable_fetch()->Reserve(fetch_names.size());
+  for (const string& fetch : fetch_names) {
+    callable_options.add_fetch(fetch);
+  }
+  callable_options.mutable_target()->Reserve(target_nodes.size());
+  for (const string& target : target_nodes) {
+    callable_options.add_target(target);
+  }
+
+  // `CreateExecutors()` instantiates all kernels eagerly, so the executors
+  // for this handle are warm by the time this call returns.
+  std::unique_ptr<ExecutorsAndKeys> ek;
+  std::unique_ptr<FunctionInfo> func_info;
+  RunStateArgs run_state_args(callable_options.run_options().debug_options());
+  TF_RETURN_IF_ERROR(
+      CreateExecutors(callable_options, &ek, &func_info, &run_state_args));
+  {
+    mutex_lock l(run_handles_lock_);
+    *out_handle = next_run_handle_++;
+    RunHandleState& state = run_handles_[*out_handle];
+    state.executors_and_keys = std::move(ek);
+    state.function_info = std::move(func_info);
+    state.fetch_names = fetch_names;
+    state.step_handle = strings::StrCat("_run_handle/", *out_handle);
+  }
+  return absl::OkStatus();
+}
+
+absl::Status DirectSession::RunWithHandle(const RunOptions& run_options,
+                                          int64_t handle,
+                                          const NamedTensorList& inputs,
+                                          std::vector<Tensor>* outputs,
+                                          RunMetadata* run_metadata) {
+  TF_RETURN_IF_ERROR(CheckNotClosed());
+  TF_RETURN_IF_ERROR(CheckGraphCreated("RunWithHandle()"));
+  direct_session_runs->GetCell()->IncrementBy(1);
+
+  std::shared_ptr<ExecutorsAndKeys> executors_and_keys;
+  std::vector<string> fetch_names;
+  string step_handle;
+  {
+    mutex_lock l(run_handles_lock_);
+    auto it = run_handles_.find(handle);
+    if (it == run_handles_.end()) {
+      return errors::InvalidArgument("No such run handle: ", handle);
+    }
+    executors_and_keys = it->second.executors_and_keys;
+    fetch_names = it->second.fetch_names;
+    step_handle = it->second.step_handle;
+  }
+  {
+    mutex_lock l(collective_graph_key_lock_);
+    collective_graph_key_ = executors_and_keys->collective_graph_key;
+  }
+
+  size_t input_size = 0;
+  for (const auto& it : inputs) {
+    input_size += it.second.AllocatedBytes();
+  }
+  metrics::RecordGraphInputTensors(input_size);
+
+  return RunWithExecutorsAndKeys(run_options, inputs, fetch_names, step_handle,
+                                 executors_and_keys.get(), outputs,
+                                 run_metadata, thread::ThreadPoolOptions());
+}
+
+absl::Status DirectSession::ReleaseRunHandle(int64_t handle) {
+  mutex_lock l(run_handles_lock_);
+  if (run_handles_.erase(handle) == 0) {
+    return errors::InvalidArgument("No such run handle: ", handle);
+  }
+  return absl::OkStatus();
+}
+
 absl::Status DirectSession::Finalize() {
   mutex_lock l(graph_state_lock_);
   if (finalized_) {
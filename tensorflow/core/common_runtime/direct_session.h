@@ -132,6 +132,28 @@ class DirectSession : public Session {
 
   absl::Status ReleaseCallable(CallableHandle handle) override;
 
+  // NOTE: Experimental and subject to change.
+  //
+  // Builds and warms the executors (including kernel instantiation) for the
+  // given feed/fetch/target signature, and returns an opaque integer handle.
+  // `RunWithHandle()` calls using the handle skip executor-key string
+  // construction and the string-keyed executor cache lookup on the hot path.
+  // The order of `fetch_names` determines the order of the outputs produced
+  // by `RunWithHandle()`.
+  absl::Status MakeRunHandle(const std::vector<string>& feed_names,
+                             const std::vector<string>& fetch_names,
+                             const std::vector<string>& target_nodes,
+                             int64_t* out_handle);
+
+  // Like `Run()`, but uses the pre-built executors associated with `handle`.
+  absl::Status RunWithHandle(const RunOptions& run_options, int64_t handle,
+                             const NamedTensorList& inputs,
+                             std::vector<Tensor>* outputs,
+                             RunMetadata* run_metadata);
+
+  // Releases the executors associated with `handle`.
+  absl::Status ReleaseRunHandle(int64_t handle);
+
   absl::Status Finalize() override;
 
   const SessionOptions& options() const { return options_; }
@@ -269,6 +291,16 @@ class DirectSession : public Session {
                            RunMetadata* run_metadata,
                            const thread::ThreadPoolOptions& threadpool_options);
 
+  // Runs the executors in `executors_and_keys` with the given named `inputs`,
+  // producing `outputs` in the order of `output_names`. Shared by `Run()`
+  // (after executor lookup) and `RunWithHandle()`.
+  absl::Status RunWithExecutorsAndKeys(
+      const RunOptions& run_options, const NamedTensorList& inputs,
+      const std::vector<string>& output_names, const string& step_handle,
+      ExecutorsAndKeys* executors_and_keys, std::vector<Tensor>* outputs,
+      RunMetadata* run_metadata,
+      const thread::ThreadPoolOptions& threadpool_options);
+
   // Returns whether inter-op execution uses a global pool or the input
   // `run_options` requests being run on inter_op_thread_pool = 0 in case
   // multiple pools are configured.
@@ -376,6 +408,18 @@ class DirectSession : public Session {
   std::unordered_map<int64_t, Callable> callables_
       TF_GUARDED_BY(callables_lock_);
 
+  // State associated with a handle returned by `MakeRunHandle()`.
+  struct RunHandleState {
+    std::shared_ptr<ExecutorsAndKeys> executors_and_keys;
+    std::shared_ptr<FunctionInfo> function_info;
+    std::vector<string> fetch_names;
+    string step_handle;
+  };
+  mutex run_handles_lock_;
+  int64_t next_run_handle_ TF_GUARDED_BY(run_handles_lock_) = 0;
+  std::unordered_map<int64_t, RunHandleState> run_handles_
+      TF_GUARDED_BY(run_handles_lock_);
+
   // Holds mappings from handle to partial run state.
   std::unordered_map<string, std::unique_ptr<PartialRunState>> partial_runs_
       TF_GUARDED_BY(executor_lock_);
@@ -201,6 +201,38 @@ TEST_F(DirectSessionMinusAXTest, RunSimpleNetwork_Callable) {
   }
 }
 
+TEST_F(DirectSessionMinusAXTest, RunSimpleNetwork_RunHandle) {
+  Initialize({3, 2, -1, 0});
+  auto session = CreateSession();
+  ASSERT_TRUE(session != nullptr);
+  TF_ASSERT_OK(session->Create(def_));
+  auto* direct_session = static_cast<DirectSession*>(session.get());
+
+  int64_t handle;
+  TF_ASSERT_OK(
+      direct_session->MakeRunHandle({}, {y_ + ":0"}, {y_neg_}, &handle));
+
+  for (int i = 0; i < 2; ++i) {
+    std::vector<Tensor> outputs;
+    TF_ASSERT_OK(direct_session->RunWithHandle(RunOptions(), handle, {},
+                                               &outputs, nullptr));
+
+    ASSERT_EQ(1, outputs.size());
+    auto mat = outputs[0].matrix<float>();
+    ASSERT_TRUE(outputs[0].IsInitialized());
+    EXPECT_FLOAT_EQ(5.0, mat(0, 0));
+  }
+
+  TF_ASSERT_OK(direct_session->ReleaseRunHandle(handle));
+
+  std::vector<Tensor> outputs;
+  absl::Status s =
+      direct_session->RunWithHandle(RunOptions(), handle, {}, &outputs,
+                                    nullptr);
+  EXPECT_TRUE(errors::IsInvalidArgument(s));
+  EXPECT_TRUE(absl::StrContains(s.message(), "No such run handle"));
+}
+
 TEST_F(DirectSessionMinusAXTest, RunSimpleNetwork_OptimizeForStaticGraph) {
   Initialize({3, 2, -1, 0});
   SessionOptions options(DefaultSessionOptions());
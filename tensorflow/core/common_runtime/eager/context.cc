@@ -474,6 +474,7 @@ void EagerContext::ClearCachesAndDefaultExecutor() {
     mutex_lock ml(cache_mu_);
     default_executor_.WaitForAllPendingNodes().IgnoreError();
     kernel_cache_.clear();
+    compiled_op_kernels_.clear();
     for (auto& entry : registered_functions_) {
       entry.second->cached_kernel_keys->clear();
     }
@@ -1267,6 +1268,31 @@ void EagerContext::AddDeviceToCache(Fprint128 device_cache_key,
   device_cache_[device_cache_key] = device;
 }
 
+int64_t EagerContext::AddCompiledOpKernel(
+    core::RefCountPtr<KernelAndDevice> kernel) {
+  mutex_lock ml(cache_mu_);
+  const int64_t handle = next_compiled_op_handle_++;
+  compiled_op_kernels_[handle] = std::move(kernel);
+  return handle;
+}
+
+core::RefCountPtr<KernelAndDevice> EagerContext::GetCompiledOpKernel(
+    int64_t handle) {
+  tf_shared_lock l(cache_mu_);
+  auto iter = compiled_op_kernels_.find(handle);
+  if (iter == compiled_op_kernels_.end()) {
+    return nullptr;
+  }
+  core::RefCountPtr<KernelAndDevice> new_ref(iter->second.get());
+  new_ref->Ref();
+  return new_ref;
+}
+
+void EagerContext::ReleaseCompiledOpKernel(int64_t handle) {
+  mutex_lock ml(cache_mu_);
+  compiled_op_kernels_.erase(handle);
+}
+
 bool EagerContext::ShouldStoreGraphs() { return should_store_graphs_.load(); }
 
 void EagerContext::SetShouldStoreGraphs(bool value) {
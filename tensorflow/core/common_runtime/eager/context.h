@@ -288,6 +288,15 @@ class EagerContext : public ImmediateExecutionContext, public core::RefCounted {
       Fprint128 cache_key, core::RefCountPtr<KernelAndDevice> kernel);
   void AddDeviceToCache(Fprint128 device_cache_key, Device* device);
 
+  // Compiled eager ops: stable handles to prebaked kernels. Clients that
+  // repeatedly dispatch an op with a fixed name, attrs, device and input
+  // dtypes can resolve the kernel once via EagerCompileOp() (see
+  // eager/execute.h) and re-dispatch through the returned handle, skipping
+  // attribute hashing and kernel cache lookup entirely.
+  int64_t AddCompiledOpKernel(core::RefCountPtr<KernelAndDevice> kernel);
+  core::RefCountPtr<KernelAndDevice> GetCompiledOpKernel(int64_t handle);
+  void ReleaseCompiledOpKernel(int64_t handle);
+
   bool LogDevicePlacement() const { return log_device_placement_; }
   void SetLogDevicePlacement(bool enable) override {
     log_device_placement_ = enable;
@@ -780,6 +789,9 @@ class EagerContext : public ImmediateExecutionContext, public core::RefCounted {
       kernel_cache_ TF_GUARDED_BY(cache_mu_);
   std::unordered_map<string, RegisteredFunction*> registered_functions_
       TF_GUARDED_BY(cache_mu_);
+  int64_t next_compiled_op_handle_ TF_GUARDED_BY(cache_mu_) = 0;
+  std::unordered_map<int64_t, core::RefCountPtr<KernelAndDevice>>
+      compiled_op_kernels_ TF_GUARDED_BY(cache_mu_);
 
   std::unordered_map<string, std::unique_ptr<FunctionLibraryDefinition>>
       component_function_libraries_ TF_GUARDED_BY(cache_mu_);
@@ -32,10 +32,18 @@ bool IsAsyncWaitForRemoteFunctionEnabled() {
                                  true, &enabled));
   return enabled;
 }
+
+bool ArePerDeviceQueuesEnabled() {
+  bool enabled = false;
+  TF_CHECK_OK(ReadBoolFromEnvVar("TF_EAGER_PER_DEVICE_QUEUES", false,
+                                 &enabled));
+  return enabled;
+}
 }  // namespace
 
 EagerExecutor::EagerExecutor(bool async, bool enable_streaming_enqueue,
-                             int in_flight_nodes_limit)
+                             int in_flight_nodes_limit,
+                             bool allow_per_device_queues)
     : next_node_id_(0),
       ok_(true),
       thread_(async ? tensorflow::Env::Default()->StartThread(
@@ -46,7 +54,9 @@ EagerExecutor::EagerExecutor(bool async, bool enable_streaming_enqueue,
       enable_async_wait_for_remote_function_(
           IsAsyncWaitForRemoteFunctionEnabled()),
       enable_streaming_enqueue_(enable_streaming_enqueue),
-      in_flight_nodes_limit_(in_flight_nodes_limit) {
+      in_flight_nodes_limit_(in_flight_nodes_limit),
+      enable_per_device_queues_(async && allow_per_device_queues &&
+                                ArePerDeviceQueuesEnabled()) {
   if (async && in_flight_nodes_limit_ > 0) {
     VLOG(4) << "EagerExecutor InFlightNodes limit is set to "
             << in_flight_nodes_limit_;
@@ -65,6 +75,12 @@ EagerExecutor::~EagerExecutor() {
 }
 
 absl::Status EagerExecutor::ShutDown() {
+  if (enable_per_device_queues_) {
+    tensorflow::mutex_lock l(device_executors_mu_);
+    for (auto& entry : device_executors_) {
+      entry.second->ShutDown().IgnoreError();
+    }
+  }
   {
     bool has_thread;
     absl::Status status;
@@ -132,6 +148,38 @@ absl::Status EagerExecutor::SyncExecute(EagerNode* node) {
 }
 
 absl::Status EagerExecutor::AddOrExecute(std::unique_ptr<EagerNode> node) {
+  if (enable_per_device_queues_) {
+    Device* node_device = node->NodeDevice();
+    if (node_device != nullptr) {
+      // Order this node after any barrier (unknown-device) nodes held in this
+      // executor's own queue, then hand it to the device's child executor,
+      // whose queue preserves ordering among same-device nodes.
+      absl::Status barrier_status;
+      {
+        tensorflow::mutex_lock l(node_queue_mutex_);
+        barrier_status = WaitForAllPendingNodesLocked(&l);
+      }
+      if (!barrier_status.ok()) {
+        node->Abort(barrier_status);
+        return barrier_status;
+      }
+      return GetDeviceExecutor(node_device)->AddOrExecute(std::move(node));
+    }
+    // This node's device is unknown, so it acts as a barrier: drain the
+    // per-device child executors before it is queued on this executor.
+    absl::Status children_status;
+    {
+      tensorflow::mutex_lock l(device_executors_mu_);
+      for (auto& entry : device_executors_) {
+        children_status.Update(entry.second->WaitForAllPendingNodes());
+      }
+    }
+    if (!children_status.ok()) {
+      node->Abort(children_status);
+      return children_status;
+    }
+  }
+
   absl::Status status;
   core::RefCountPtr<NodeItem> item(new NodeItem);
   item->id = next_node_id_++;
@@ -196,8 +244,18 @@ absl::Status EagerExecutor::AddOrExecute(std::unique_ptr<EagerNode> node) {
 }
 
 absl::Status EagerExecutor::WaitForAllPendingNodes() {
-  tensorflow::mutex_lock l(node_queue_mutex_);
-  return WaitForAllPendingNodesLocked(&l);
+  absl::Status s;
+  {
+    tensorflow::mutex_lock l(node_queue_mutex_);
+    s = WaitForAllPendingNodesLocked(&l);
+  }
+  if (enable_per_device_queues_) {
+    tensorflow::mutex_lock l(device_executors_mu_);
+    for (auto& entry : device_executors_) {
+      s.Update(entry.second->WaitForAllPendingNodes());
+    }
+  }
+  return s;
 }
 
 absl::Status EagerExecutor::WaitForAllPendingNodesLocked(mutex_lock* lock) {
@@ -217,6 +275,13 @@ absl::Status EagerExecutor::WaitForAllPendingNodesLocked(mutex_lock* lock) {
 }
 
 void EagerExecutor::ClearError() {
+  if (enable_per_device_queues_) {
+    tensorflow::mutex_lock l(device_executors_mu_);
+    for (auto& entry : device_executors_) {
+      entry.second->ClearError();
+    }
+  }
+
   // TODO(iga): Check state_ and return an error if it is not kActive.
   if (ok()) return;
 
@@ -443,6 +508,17 @@ absl::Status EagerExecutor::MoveToUnfinished(core::RefCountPtr<NodeItem> item,
   return absl::OkStatus();
 }
 
+EagerExecutor* EagerExecutor::GetDeviceExecutor(const Device* device) {
+  tensorflow::mutex_lock l(device_executors_mu_);
+  std::unique_ptr<EagerExecutor>& executor = device_executors_[device];
+  if (executor == nullptr) {
+    executor = std::make_unique<EagerExecutor>(
+        /*async=*/true, enable_streaming_enqueue_, in_flight_nodes_limit_,
+        /*allow_per_device_queues=*/false);
+  }
+  return executor.get();
+}
+
 void EagerExecutor::AddCleanup(intptr_t key, std::function<void()> callback) {
   cleanups_[key].push_back(callback);
 }
@@ -79,6 +79,12 @@ class EagerNode {
 
   // Indicates whether a node failure should make the executor unusable.
   virtual bool Fatal() const { return true; }
+
+  // The local device this node's computation is bound to, if known. Returning
+  // nullptr means the device is unknown; in per-device queue mode (see
+  // EagerExecutor) such nodes act as barriers that are ordered against the
+  // nodes of every device.
+  virtual Device* NodeDevice() const { return nullptr; }
 };
 
 class AsyncEagerNode : public EagerNode {
@@ -115,8 +121,16 @@ class AsyncRemoteExecuteNode : public AsyncEagerNode {
 // TODO(agarwal): Implement optimizations over EagerNode traces.
 class EagerExecutor {
  public:
+  // `allow_per_device_queues` permits this executor to route async nodes with
+  // a known device (EagerNode::NodeDevice) to lazily created per-device child
+  // executors, so independent ops on different devices do not serialize
+  // through one drain thread. Ordering is preserved among nodes on the same
+  // device; nodes without a known device act as barriers across all devices.
+  // The mode only takes effect for async executors and when the
+  // TF_EAGER_PER_DEVICE_QUEUES environment variable is set to true.
   explicit EagerExecutor(bool async, bool enable_streaming_enqueue = true,
-                         int in_flight_nodes_limit = 0);
+                         int in_flight_nodes_limit = 0,
+                         bool allow_per_device_queues = true);
 
   ~EagerExecutor();
 
@@ -221,6 +235,10 @@ class EagerExecutor {
 
   absl::Status WaitImpl(bool wait_all, uint64 node_id);
 
+  // Returns the child executor for `device` in per-device queue mode,
+  // creating it on first use.
+  EagerExecutor* GetDeviceExecutor(const Device* device);
+
   std::atomic<uint64> next_node_id_;
 
   mutable mutex node_queue_mutex_;
@@ -278,6 +296,16 @@ class EagerExecutor {
   // async nodes reach this number, enqueuing to the eager async queue is
   // blocked.
   const int64_t in_flight_nodes_limit_;
+
+  // True iff async nodes with a known device are routed to per-device child
+  // executors instead of this executor's single queue.
+  const bool enable_per_device_queues_;
+
+  // Lazily created child executors, one per device. Children are plain
+  // single-queue async executors.
+  mutable mutex device_executors_mu_;
+  absl::flat_hash_map<const Device*, std::unique_ptr<EagerExecutor>>
+      device_executors_ TF_GUARDED_BY(device_executors_mu_);
 };
 
 inline bool EagerExecutor::Async() const { return thread_ != nullptr; }
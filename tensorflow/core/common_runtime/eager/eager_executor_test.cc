@@ -20,6 +20,7 @@ limitations under the License.
 #include "xla/tsl/lib/core/status_test_util.h"
 #include "xla/tsl/protobuf/error_codes.pb.h"
 #include "tensorflow/core/platform/status.h"
+#include "tensorflow/core/public/session_options.h"
 #include "tensorflow/core/platform/status_matchers.h"
 #include "tensorflow/core/platform/test.h"
 #include "tsl/platform/status.h"
@@ -281,5 +282,42 @@ TEST(EagerExecutorTest, TestAsyncExecutorAddNodesAfterShutdown) {
       async_executor->AddOrExecute(std::move(node)),
       tensorflow::testing::StatusIs(tensorflow::error::FAILED_PRECONDITION));
 }
+
+class TestDeviceAsyncEagerNode : public TestAsyncEagerNode {
+ public:
+  TestDeviceAsyncEagerNode(TestState* state, Device* device)
+      : TestAsyncEagerNode(state), device_(device) {}
+
+  Device* NodeDevice() const override { return device_; }
+
+ private:
+  Device* device_;
+};
+
+TEST(EagerExecutorTest, TestPerDeviceQueues) {
+  setenv("TF_EAGER_PER_DEVICE_QUEUES", "true", /*overwrite=*/1);
+  auto device = DeviceFactory::NewDevice(
+      "CPU", SessionOptions(), "/job:localhost/replica:0/task:0");
+  auto async_executor = std::make_unique<EagerExecutor>(
+      /*async=*/true, /*enable_streaming_enqueue=*/true);
+
+  // A node with a known device is routed to that device's child executor.
+  auto device_state = std::make_unique<TestState>();
+  TF_ASSERT_OK(async_executor->AddOrExecute(
+      std::make_unique<TestDeviceAsyncEagerNode>(device_state.get(),
+                                                 device.get())));
+
+  // A node with an unknown device acts as a barrier across all queues.
+  auto barrier_state = std::make_unique<TestState>();
+  TF_ASSERT_OK(async_executor->AddOrExecute(
+      std::make_unique<TestAsyncEagerNode>(barrier_state.get())));
+
+  TF_ASSERT_OK(async_executor->WaitForAllPendingNodes());
+  ASSERT_EQ(device_state->read_state(), TestState::State::kSuccess);
+  ASSERT_EQ(barrier_state->read_state(), TestState::State::kSuccess);
+
+  TF_ASSERT_OK(async_executor->ShutDown());
+  unsetenv("TF_EAGER_PER_DEVICE_QUEUES");
+}
 }  // namespace
 }  // namespace tensorflow
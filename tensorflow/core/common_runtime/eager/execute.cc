@@ -18,6 +18,7 @@ limitations under the License.
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <queue>
@@ -2245,6 +2246,61 @@ absl::Status EagerExecute(EagerOperation* op, TensorHandle** retvals,
   return DoEagerExecute(op, retvals, num_retvals);
 }
 
+absl::Status EagerCompileOp(EagerOperation* op, int64_t* out_handle) {
+  if (!op->IsLocal()) {
+    return errors::Unimplemented(
+        "EagerCompileOp is only supported for local ops.");
+  }
+  EagerContext& ctx = op->EagerContext();
+  core::RefCountPtr<KernelAndDevice> kernel;
+  // `retvals` is not touched by kernel resolution; `num_retvals` only bounds
+  // the number of outputs, so pass the maximum.
+  int num_retvals = std::numeric_limits<int>::max();
+  TF_RETURN_IF_ERROR(GetOrCreateKernelAndDevice(op, /*retvals=*/nullptr,
+                                                &num_retvals, &kernel));
+  *out_handle = ctx.AddCompiledOpKernel(std::move(kernel));
+  return absl::OkStatus();
+}
+
+absl::Status EagerExecuteCompiled(EagerOperation* op, int64_t handle,
+                                  TensorHandle** retvals, int* num_retvals) {
+  tsl::profiler::TraceMe activity(
+      [&] { return absl::StrCat("EagerExecuteCompiled: ", op->Name()); },
+      tsl::profiler::TraceMeLevel::kInfo);
+  EagerContext& ctx = op->EagerContext();
+  TF_RETURN_IF_ERROR(op->Executor().status());
+
+  core::RefCountPtr<KernelAndDevice> kernel = ctx.GetCompiledOpKernel(handle);
+  if (kernel == nullptr) {
+    return errors::NotFound("No compiled eager op with handle ", handle,
+                            ". It may have been released or the context "
+                            "caches may have been cleared.");
+  }
+
+  const int num_outputs = kernel->num_outputs();
+  if (num_outputs > *num_retvals) {
+    return errors::InvalidArgument("Expecting ", num_outputs,
+                                   " outputs, but *num_retvals is ",
+                                   *num_retvals);
+  }
+  *num_retvals = num_outputs;
+  if (std::get<Device*>(op->Device()) == nullptr) {
+    op->SetDevice(kernel->device());
+  }
+  TF_RETURN_IF_ERROR(ValidateInputTypeAndPlacement(&ctx, op, kernel));
+
+  absl::Status s = AddOrExecuteNode(std::move(kernel), op, retvals);
+  if (!s.ok()) {
+    for (int i = 0, end = num_outputs; i < end; ++i) {
+      if (retvals[i] != nullptr) {
+        retvals[i]->Unref();
+        retvals[i] = nullptr;
+      }
+    }
+  }
+  return s;
+}
+
 namespace {
 
 absl::Status LocalEagerCopyToDevice(TensorHandle* h, EagerContext* ctx,
@@ -55,6 +55,27 @@ absl::Status EagerKernelExecute(
     absl::Span<TensorHandle*> retvals,
     const absl::optional<ManagedStackTrace>& stack_trace = {});
 
+// Resolves the kernel for `op` exactly as EagerExecute would (including
+// device placement), registers it on the op's EagerContext, and returns a
+// stable handle in `*out_handle`. The handle freezes the op name, attrs,
+// device and input dtypes; subsequent EagerExecuteCompiled calls with the
+// same handle skip attribute hashing, placement and kernel lookup. The op is
+// not executed. The handle stays valid until released via
+// EagerContext::ReleaseCompiledOpKernel or the context caches are cleared.
+//
+// Only local, synchronous-placement ops are supported; remote ops and custom
+// devices must go through EagerExecute.
+absl::Status EagerCompileOp(EagerOperation* op, int64_t* out_handle);
+
+// Executes `op` using the prebaked kernel registered under `handle` by
+// EagerCompileOp. The caller must supply inputs with the same dtypes and
+// devices that the op was compiled with; input validation still runs, but no
+// placement or kernel resolution is performed.
+//
+// 'retvals' and '*num_retvals' follow the same contract as EagerExecute.
+absl::Status EagerExecuteCompiled(EagerOperation* op, int64_t handle,
+                                  TensorHandle** retvals, int* num_retvals);
+
 // Low-level utility to copy a tensor handle from one device to another. If
 // successful, result TensorHandle will be populated. If the caller requests for
 // the mirror flag, EagerCopyToDevice will attempt to add a mirror to the
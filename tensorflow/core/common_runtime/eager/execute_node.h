@@ -236,6 +236,8 @@ class AsyncExecuteNode : public EagerNode {
     return out;
   }
 
+  Device* NodeDevice() const override { return kernel_->device(); }
+
  private:
   EagerContext* ctx_;
   absl::InlinedVector<TensorHandle*, 4> inputs_;
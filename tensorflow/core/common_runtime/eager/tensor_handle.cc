@@ -536,7 +536,32 @@ Device* TensorHandle::DeviceOrHostCPU(const EagerContext& ctx) const {
   return (device_ == nullptr) ? ctx.HostCPU() : device_;
 }
 
+bool TensorHandle::CacheShapeIfReady(
+    const tensorflow::TensorShape** shape) const {
+  if (!IsReady()) return false;
+  TensorShape resolved;
+  absl::Status status = std::visit(
+      [&resolved](auto& data) { return data.Shape(&resolved); }, data_);
+  // Poisoned handles report their error through the status-returning
+  // accessors; do not cache.
+  if (!status.ok()) return false;
+  {
+    mutex_lock l(mu_);
+    if (!cached_shape_valid_.load(std::memory_order_relaxed)) {
+      cached_shape_ = std::move(resolved);
+      cached_shape_valid_.store(true, std::memory_order_release);
+    }
+  }
+  *shape = &cached_shape_;
+  return true;
+}
+
 absl::Status TensorHandle::Shape(tensorflow::TensorShape* shape) {
+  const TensorShape* cached;
+  if (TryGetCachedShape(&cached)) {
+    *shape = *cached;
+    return absl::OkStatus();
+  }
   if (!IsReady() && inference_shape_.IsFullyDefined()) {
     bool fill = inference_shape_.AsTensorShape(shape);
     DCHECK(fill);
@@ -610,6 +635,11 @@ absl::Status TensorHandle::CopyInferenceShape(TensorHandle* other) {
 
 absl::Status TensorHandle::Shape(tensorflow::PartialTensorShape* shape) const {
   DCHECK(shape != nullptr);
+  const TensorShape* cached;
+  if (TryGetCachedShape(&cached)) {
+    *shape = *cached;
+    return absl::OkStatus();
+  }
   if (!IsReady() && !inference_shape_.unknown_rank()) {
     *shape = inference_shape_;
     return absl::OkStatus();
@@ -629,6 +659,11 @@ absl::Status TensorHandle::Shape(tensorflow::PartialTensorShape* shape) const {
 
 absl::Status TensorHandle::NumDims(int* num_dims) const {
   DCHECK(num_dims != nullptr);
+  const TensorShape* cached;
+  if (TryGetCachedShape(&cached)) {
+    *num_dims = cached->dims();
+    return absl::OkStatus();
+  }
   if (!IsReady() && !inference_shape_.unknown_rank()) {
     *num_dims = inference_shape_.dims();
     return absl::OkStatus();
@@ -640,6 +675,11 @@ absl::Status TensorHandle::NumDims(int* num_dims) const {
 
 absl::Status TensorHandle::Dim(int dim_index, int64_t* dim) const {
   DCHECK(dim != nullptr);
+  const TensorShape* cached;
+  if (TryGetCachedShape(&cached)) {
+    *dim = cached->dim_size(dim_index);
+    return absl::OkStatus();
+  }
   if (!IsReady() && !inference_shape_.unknown_rank() &&
       inference_shape_.dim_size(dim_index) != -1) {
     *dim = inference_shape_.dim_size(dim_index);
@@ -653,6 +693,11 @@ absl::Status TensorHandle::Dim(int dim_index, int64_t* dim) const {
 
 absl::Status TensorHandle::NumElements(int64_t* num_elements) const {
   DCHECK(num_elements != nullptr);
+  const TensorShape* cached;
+  if (TryGetCachedShape(&cached)) {
+    *num_elements = cached->num_elements();
+    return absl::OkStatus();
+  }
   if (!IsReady() && inference_shape_.IsFullyDefined()) {
     *num_elements = inference_shape_.num_elements();
     return absl::OkStatus();
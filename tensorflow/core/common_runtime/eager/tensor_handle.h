@@ -16,6 +16,7 @@ limitations under the License.
 #define TENSORFLOW_CORE_COMMON_RUNTIME_EAGER_TENSOR_HANDLE_H_
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <queue>
@@ -45,6 +46,7 @@ limitations under the License.
 
 #include "tensorflow/core/lib/core/stringpiece.h"
 
+#include "tensorflow/core/platform/macros.h"
 #include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/thread_annotations.h"
 
@@ -175,6 +177,20 @@ class TensorHandle : public ImmediateExecutionTensorHandle {
 
   absl::Status Shape(tensorflow::TensorShape* shape);
 
+  // Non-virtual fast path for shape metadata. Returns true and points
+  // `*shape` at the handle's cached shape iff the handle is ready; once the
+  // cache is populated the query is a single atomic load. A ready handle's
+  // shape never changes, so the returned pointer stays valid for the life of
+  // the handle. On false, callers must use the status-returning accessors.
+  inline bool TryGetCachedShape(const tensorflow::TensorShape** shape) const {
+    if (TF_PREDICT_TRUE(
+            cached_shape_valid_.load(std::memory_order_acquire))) {
+      *shape = &cached_shape_;
+      return true;
+    }
+    return CacheShapeIfReady(shape);
+  }
+
   absl::Status Unprotect(const Device* d);
 
   // Checks if a mirror tensor exists for the specified device. Mirrors are only
@@ -301,6 +317,12 @@ class TensorHandle : public ImmediateExecutionTensorHandle {
   bool IsReady() const;
   absl::Status WaitReady(const char* caller) const;
 
+  // Slow path of TryGetCachedShape: if the handle is ready, resolves the
+  // shape once, publishes it in `cached_shape_` and returns true. A ready
+  // handle's shape never changes, so the cache is write-once: the shape is
+  // written under `mu_` and published via `cached_shape_valid_`.
+  bool CacheShapeIfReady(const tensorflow::TensorShape** shape) const;
+
   tensorflow::Device* device_;
 
   // Device in which the op producing this tensor was executed. Equals to
@@ -323,6 +345,12 @@ class TensorHandle : public ImmediateExecutionTensorHandle {
 
   mutable mutex mu_;
 
+  // Shape metadata cache for ready handles. See TryGetCachedShape. The shape
+  // is written at most once, under `mu_`, and published through
+  // `cached_shape_valid_`; after that it is read without locking.
+  mutable std::atomic<bool> cached_shape_valid_{false};
+  mutable tensorflow::TensorShape cached_shape_;
+
   // Map of local mirrors. This can include both ready and non-ready mirrors.
   std::unordered_map<const tensorflow::Device*, LocalTensorHandleData>
       local_mirrors_ TF_GUARDED_BY(mu_);
@@ -80,6 +80,41 @@ TEST(TensorHandle_ShapeTest, AsyncShape) {
   EXPECT_EQ(num_elements, 4);
 }
 
+TEST(TensorHandle_ShapeTest, CachedShapeFastPath) {
+  Tensor t(DT_UINT16, TensorShape({2, 3}));
+
+  StaticDeviceMgr device_mgr(DeviceFactory::NewDevice(
+      "CPU", {}, "/job:localhost/replica:0/task:0/device:CPU:0"));
+  auto ctx = new EagerContext(
+      SessionOptions(),
+      tensorflow::ContextDevicePlacementPolicy::DEVICE_PLACEMENT_SILENT, false,
+      &device_mgr, false, nullptr, nullptr, nullptr,
+      /*run_eager_op_as_function=*/true);
+  absl::Cleanup ctx_cleanup = [&]() { ctx->Unref(); };
+
+  // A non-ready handle has no cached shape.
+  TensorHandle* async_th = TensorHandle::CreateEmptyLocalHandle(
+      nullptr, nullptr, nullptr, DataType::DT_UINT16, ctx);
+  absl::Cleanup async_th_cleanup = [&]() { async_th->Unref(); };
+  const TensorShape* cached = nullptr;
+  EXPECT_FALSE(async_th->TryGetCachedShape(&cached));
+
+  // A ready handle resolves its shape once and serves repeat queries from
+  // the cache.
+  TensorHandle* sync_th =
+      TensorHandle::CreateLocalHandle(std::move(t), nullptr, nullptr, ctx);
+  absl::Cleanup sync_th_cleanup = [&]() { sync_th->Unref(); };
+  ASSERT_TRUE(sync_th->TryGetCachedShape(&cached));
+  EXPECT_TRUE(cached->IsSameSize(TensorShape({2, 3})));
+  const TensorShape* cached_again = nullptr;
+  ASSERT_TRUE(sync_th->TryGetCachedShape(&cached_again));
+  EXPECT_EQ(cached, cached_again);
+
+  int64_t num_elements = -1;
+  TF_EXPECT_OK(sync_th->NumElements(&num_elements));
+  EXPECT_EQ(num_elements, 6);
+}
+
 class FakeDevice : public Device {
  public:
   explicit FakeDevice(const DeviceAttributes& attr, bool is_local)
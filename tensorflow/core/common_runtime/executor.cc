@@ -31,6 +31,7 @@ limitations under the License.
 #include "tensorflow/core/common_runtime/executor_factory.h"
 #include "tensorflow/core/common_runtime/graph_view.h"
 #include "tensorflow/core/common_runtime/immutable_executor_state.h"
+#include "tensorflow/core/common_runtime/op_duration_sampler.h"
 #include "tensorflow/core/common_runtime/pending_counts.h"
 #include "tensorflow/core/common_runtime/propagator_state.h"
 #include "tensorflow/core/common_runtime/renamed_device.h"
@@ -61,6 +62,11 @@ limitations under the License.
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/gtl/manual_constructor.h"
 #include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/context.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
@@ -78,6 +84,7 @@ limitations under the License.
 #include "tensorflow/core/profiler/lib/traceme.h"
 #include "tensorflow/core/profiler/lib/traceme_encode.h"
 #include "tensorflow/core/protobuf/error_codes.pb.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tensorflow/core/util/determinism.h"
 #include "tensorflow/core/util/managed_stack_trace.h"
 #include "tensorflow/core/util/tensor_slice_reader_cache.h"
@@ -149,6 +156,10 @@ class ExecutorImpl : public Executor {
  public:
   explicit ExecutorImpl(const LocalExecutorParams& p) : immutable_state_(p) {}
 
+  ~ExecutorImpl() override {
+    kernel_stats_.MaybeSaveCostEstimates(immutable_state_.graph_view());
+  }
+
   absl::Status Initialize(const Graph& graph) {
     TF_RETURN_IF_ERROR(immutable_state_.Initialize(graph));
     kernel_stats_.Initialize(immutable_state_.graph_view());
@@ -177,6 +188,66 @@ class ExecutorImpl : public Executor {
           cost_estimates_[i] = kInitialCostEstimateCycles;
         }
       }
+      MaybeLoadCostEstimates(gview);
+    }
+
+    // Seeds the cost estimates from a sidecar file written by a previous
+    // process, so that scheduling decisions are warm from the first step
+    // after a restart. Enabled by pointing the
+    // TF_EXECUTOR_COST_ESTIMATE_DIR environment variable at a writable
+    // directory; files in it are keyed by a fingerprint of the executor's
+    // kernel names and types.
+    void MaybeLoadCostEstimates(const GraphView& gview) {
+      cost_estimate_path_ = CostEstimatePath(gview);
+      if (cost_estimate_path_.empty()) return;
+      string contents;
+      absl::Status s =
+          ReadFileToString(Env::Default(), cost_estimate_path_, &contents);
+      if (!s.ok()) return;  // Typically the first run: start cold.
+      const std::vector<string> lines = str_util::Split(contents, '\n');
+      gtl::FlatMap<StringPiece, uint64> loaded;
+      for (const string& line : lines) {
+        const size_t space = line.rfind(' ');
+        uint64 cycles;
+        if (space != string::npos &&
+            strings::safe_strtou64(line.substr(space + 1), &cycles)) {
+          loaded[StringPiece(line.data(), space)] = cycles;
+        }
+      }
+      for (int32_t i = 0; i < gview.num_nodes(); ++i) {
+        const NodeItem* item = gview.node(i);
+        if (item == nullptr || item->kernel == nullptr || !is_expensive_[i]) {
+          continue;
+        }
+        auto it = loaded.find(item->kernel->name());
+        if (it != loaded.end()) {
+          cost_estimates_[i].store(it->second, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Writes the learned cost estimates back to the sidecar file. Called
+    // when the owning executor is destroyed. Estimates keyed by kernel name
+    // may be shared between partitions with identical node names; the
+    // last writer wins, which is acceptable for a scheduling hint.
+    void MaybeSaveCostEstimates(const GraphView& gview) const {
+      if (cost_estimate_path_.empty()) return;
+      string contents;
+      for (int32_t i = 0; i < gview.num_nodes(); ++i) {
+        const NodeItem* item = gview.node(i);
+        if (item == nullptr || item->kernel == nullptr || !is_expensive_[i]) {
+          continue;
+        }
+        strings::StrAppend(
+            &contents, item->kernel->name(), " ",
+            cost_estimates_[i].load(std::memory_order_relaxed), "\n");
+      }
+      absl::Status s =
+          WriteStringToFile(Env::Default(), cost_estimate_path_, contents);
+      if (!s.ok()) {
+        VLOG(1) << "Failed to save executor cost estimates to "
+                << cost_estimate_path_ << ": " << s;
+      }
     }
 
     // Returns true iff the given node is considered "expensive". The
@@ -218,9 +289,36 @@ class ExecutorImpl : public Executor {
     static constexpr uint64 kOpIsExpensiveThresholdCycles = 8000;
     static constexpr uint64 kCostDecay = 10;
 
+    // Returns the path of the sidecar file holding persisted cost estimates
+    // for this executor's graph, or the empty string if persistence is
+    // disabled.
+    static string CostEstimatePath(const GraphView& gview) {
+      static const string* const dir = [] {
+        string d;
+        absl::Status s =
+            ReadStringFromEnvVar("TF_EXECUTOR_COST_ESTIMATE_DIR", "", &d);
+        if (!s.ok()) {
+          LOG(ERROR) << "Executor cost estimate persistence: " << s.message();
+        }
+        return new string(d);
+      }();
+      if (dir->empty()) return "";
+      uint64 fp = Fingerprint64("executor_cost_estimates");
+      for (int32_t i = 0; i < gview.num_nodes(); ++i) {
+        const NodeItem* item = gview.node(i);
+        if (item != nullptr && item->kernel != nullptr) {
+          fp = FingerprintCat64(fp, Fingerprint64(item->kernel->name()));
+          fp = FingerprintCat64(fp,
+                                Fingerprint64(item->kernel->type_string()));
+        }
+      }
+      return io::JoinPath(*dir, strings::StrCat("cost_estimates_", fp));
+    }
+
     std::vector<bool> is_expensive_;
     // std::unique_ptr<std::atomic<bool>[]> is_expensive_;
     std::unique_ptr<std::atomic_uint_fast64_t[]> cost_estimates_;
+    string cost_estimate_path_;
   };
 
   ImmutableExecutorState immutable_state_;
@@ -341,6 +439,89 @@ class ExecutorState {
   // REQUIRES: `!ready->empty()`.
   void ScheduleReady(TaggedNodeSeq* ready, TaggedNodeReadyQueue* inline_ready);
 
+  // A bounded, lock-free multi-producer multi-consumer ready-node queue
+  // (an array queue with per-cell sequence numbers, after Vyukov). Producers
+  // in `ScheduleReady` push newly ready nodes, and drain tasks running on
+  // worker threads pop and process them, so propagation of ready successors
+  // does not serialize on the underlying thread pool's queue lock.
+  class LockFreeReadyQueue {
+   public:
+    LockFreeReadyQueue() {
+      for (size_t i = 0; i < kCapacity; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    // Attempts to enqueue `node`. Returns false if the queue is full.
+    bool TryPush(const TaggedNode& node) {
+      size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell* cell = &cells_[pos & kMask];
+        const size_t seq = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t dif =
+            static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (dif == 0) {
+          if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            cell->node.Init(node);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (dif < 0) {
+          return false;  // Full.
+        } else {
+          pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Attempts to dequeue a node. Returns `nullopt` if the queue is empty.
+    absl::optional<TaggedNode> TryPop() {
+      size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell* cell = &cells_[pos & kMask];
+        const size_t seq = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t dif =
+            static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (dif == 0) {
+          if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                 std::memory_order_relaxed)) {
+            TaggedNode node = *cell->node;
+            cell->node.Destroy();
+            cell->sequence.store(pos + kCapacity, std::memory_order_release);
+            return node;
+          }
+        } else if (dif < 0) {
+          return absl::nullopt;  // Empty.
+        } else {
+          pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+   private:
+    // Must be a power of two. Sized to hold the ready set of large graphs;
+    // on overflow `TryPush` fails and the caller falls back to dispatching
+    // the node directly through the runner.
+    static constexpr size_t kCapacity = 4096;
+    static constexpr size_t kMask = kCapacity - 1;
+
+    struct Cell {
+      std::atomic<size_t> sequence;
+      gtl::ManualConstructor<TaggedNode> node;
+    };
+
+    Cell cells_[kCapacity];
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  };
+
+  // Hands off all nodes in `nodes` to worker threads through
+  // `lock_free_ready_queue_`, scheduling a bounded number of drain tasks
+  // rather than one closure per node.
+  void ScheduleViaLockFreeReadyQueue(const TaggedNodeSeq& nodes,
+                                     int64_t scheduled_nsec);
+
   // A wrapper for runner_ to keep track of the pending queue length. Op
   // execution should dispatch work using this function instead of using runner_
   // directly.
@@ -371,6 +552,12 @@ class ExecutorState {
   // TODO(fishx): Make it configurable if necessary.
   static constexpr uint64 kInlineScheduleReadyThreshold = 500;
 
+  // Maximum number of drain tasks dispatched per `ScheduleReady` call when
+  // the lock-free ready queue is enabled. Each drain task keeps popping until
+  // the queue is empty, and every subsequent `NodeDone` schedules more drain
+  // tasks, so a small number of wake-ups per batch is sufficient.
+  static constexpr int kMaxReadyQueueDrainTasks = 8;
+
   // Not owned.
   RendezvousInterface* rendezvous_;
   CollectiveExecutor* collective_executor_ = nullptr;
@@ -400,6 +587,9 @@ class ExecutorState {
   bool sync_on_finish_;
   const bool run_all_kernels_inline_;
 
+  // Non-null iff `Args::use_lock_free_ready_queue` was set.
+  const std::unique_ptr<LockFreeReadyQueue> lock_free_ready_queue_;
+
   PropagatorStateType propagator_;
 
   // Invoked when the execution finishes.
@@ -449,6 +639,9 @@ ExecutorState<PropagatorStateType>::ExecutorState(
       runner_(args.runner),
       sync_on_finish_(args.sync_on_finish),
       run_all_kernels_inline_(args.run_all_kernels_inline),
+      lock_free_ready_queue_(args.use_lock_free_ready_queue
+                                 ? std::make_unique<LockFreeReadyQueue>()
+                                 : nullptr),
       propagator_(immutable_state, step_id_, vlog_),
       num_outstanding_ops_(0) {
   if (args.user_intra_op_threadpool != nullptr) {
@@ -482,10 +675,34 @@ void ExecutorState<PropagatorStateType>::RunTask(Closure&& c, int sample_rate) {
     metrics::UpdateGraphPendingQueueLength(n_enqueues - n_dequeues);
   }
 
+  // When verbose tracing is on, stamp the task with its enqueue time so the
+  // dequeue side can report how long it waited in the threadpool queue,
+  // together with the queue depth at dequeue time. This attributes step time
+  // lost to scheduling (as opposed to compute) in the trace.
+  const int64_t enqueue_time_ns =
+      TF_PREDICT_FALSE(
+          tsl::profiler::TraceMe::Active(tsl::profiler::TraceMeLevel::kVerbose))
+          ? EnvTime::NowNanos()
+          : 0;
+
   // mutable is needed because std::forward<Closure> in the lambda body may move
   // the Closure `c`.
-  runner_([c = std::forward<Closure>(c)]() mutable {
-    num_dequeue_ops.fetch_add(1, std::memory_order_relaxed);
+  runner_([c = std::forward<Closure>(c), enqueue_time_ns]() mutable {
+    auto n_dequeues =
+        num_dequeue_ops.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (TF_PREDICT_FALSE(enqueue_time_ns != 0)) {
+      tsl::profiler::TraceMe::InstantActivity(
+          [&] {
+            return tsl::profiler::TraceMeEncode(
+                "ExecutorState::RunTask::Dequeue",
+                {{"queuing_time_us",
+                  (EnvTime::NowNanos() - enqueue_time_ns) / 1000},
+                 {"queue_depth",
+                  num_enqueue_ops.load(std::memory_order_relaxed) -
+                      n_dequeues}});
+          },
+          tsl::profiler::TraceMeLevel::kVerbose);
+    }
     std::forward<Closure>(c)();
   });
 }
@@ -614,7 +831,15 @@ absl::Status ExecutorState<PropagatorStateType>::ProcessSync(
     constexpr int kKernelExecutionTrackingInvocationSkipCount = 16;
     if (is_expensive ||
         timer.start_cycles % kKernelExecutionTrackingInvocationSkipCount == 0) {
-      kernel_stats_->UpdateCostEstimate(item, timer.ElapsedCycles());
+      const uint64 elapsed_cycles = timer.ElapsedCycles();
+      kernel_stats_->UpdateCostEstimate(item, elapsed_cycles);
+      // Feed the same sampled timing to the always-on duration sampler, so
+      // the monitoring tier adds no timer reads of its own.
+      OpDurationSampler* duration_sampler = OpDurationSampler::Get();
+      if (TF_PREDICT_FALSE(duration_sampler->enabled())) {
+        duration_sampler->RecordCycles(op_kernel->type_string_view(),
+                                       op_kernel->name_view(), elapsed_cycles);
+      }
     }
   } else {
     device->Compute(op_kernel, &ctx);
@@ -921,6 +1146,10 @@ void ExecutorState<PropagatorStateType>::ProcessInline(
       params->outputs_required_array = item.outputs_required.get();
       params->inputs = *inputs;
       params->input_alloc_attrs = input_alloc_attrs;
+      // ProcessOutputs() consumes outputs before the context is destroyed and
+      // checks output_is_inline(), so the context's inline output storage can
+      // be used instead of heap-allocating a Tensor object per output.
+      params->inline_output_storage = true;
 
       if (item.kernel_is_async) {
         ProcessAsync(item, *params, tagged_node, first_input, stats,
@@ -1176,9 +1405,10 @@ absl::Status ExecutorState<PropagatorStateType>::ProcessOutputs(
                              FormatNodeDefForError(item.kernel->def())));
       }
     }
-    if (!val.is_ref()) {
+    if (!val.is_ref() && !ctx->output_is_inline(i)) {
       // If OpKernelContext returns outputs via pass-by-value, we
-      // don't need this trouble.
+      // don't need this trouble.  Tensors in the context's inline output
+      // storage are owned by the context itself.
       delete val.tensor;
     }
   }
@@ -1302,17 +1532,58 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
   } else {
     const TaggedNode* curr_expensive_node = nullptr;
     TaggedNodeSeq expensive_nodes;
+    // Counts of how this call resolved the inline-vs-threadpool decision,
+    // reported as an instant trace event below so schedule decisions can be
+    // correlated with queueing time in the profile.
+    int num_inline_scheduled = 0;
+    int num_pool_scheduled = 0;
     if (inline_ready == nullptr) {
-      // Schedule to run all the ready ops in thread pool.
+      if (lock_free_ready_queue_) {
+        ScheduleViaLockFreeReadyQueue(*ready, scheduled_nsec);
+        ready->clear();
+        return;
+      }
+      // Schedule to run all the ready ops in thread pool. Ops whose measured
+      // cost is below the expensive threshold are batched into shared tasks,
+      // since a per-op thread wakeup costs more than running the op itself.
+      TaggedNodeSeq inexpensive_nodes;
       for (auto& tagged_node : *ready) {
-        RunTask([=]() { Process(tagged_node, scheduled_nsec); },
-                /*sample_rate=*/ready->size());
+        const NodeItem& item = *tagged_node.node_item;
+        if (tagged_node.get_is_dead() || !kernel_stats_->IsExpensive(item)) {
+          inexpensive_nodes.push_back(tagged_node);
+        } else {
+          ++num_pool_scheduled;
+          RunTask([=]() { Process(tagged_node, scheduled_nsec); },
+                  /*sample_rate=*/ready->size());
+        }
+      }
+      num_pool_scheduled += inexpensive_nodes.size();
+      // Each chunk runs its nodes sequentially in one task. While a task
+      // holds unprocessed nodes they remain accounted for in
+      // `num_outstanding_ops_`, so only the final `Process` call in the
+      // final task can complete the step.
+      auto it = inexpensive_nodes.begin();
+      while (it < inexpensive_nodes.end()) {
+        auto end = it;
+        std::advance(end, kInlineScheduleReadyThreshold);
+        if (end > inexpensive_nodes.end()) {
+          end = inexpensive_nodes.end();
+        }
+        TaggedNodeSeq ready_chunk{it, end};
+        it = end;
+        RunTask([this, ready_chunk = std::move(ready_chunk),
+                 scheduled_nsec]() {
+          for (auto& tagged_node : ready_chunk) {
+            Process(tagged_node, scheduled_nsec);
+          }
+        });
       }
     } else {
       for (auto& tagged_node : *ready) {
         const NodeItem& item = *tagged_node.node_item;
         if (tagged_node.get_is_dead() || !kernel_stats_->IsExpensive(item)) {
           // Inline this inexpensive node.
+          ++num_inline_scheduled;
           inline_ready->push_back(tagged_node);
         } else {
           if (curr_expensive_node) {
@@ -1324,6 +1595,7 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
     }
     if (curr_expensive_node) {
       if (inline_ready->empty()) {
+        ++num_inline_scheduled;
         inline_ready->push_back(*curr_expensive_node);
       } else {
         // There are inline nodes to run already. We dispatch this expensive
@@ -1332,7 +1604,10 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
       }
     }
     if (!expensive_nodes.empty()) {
-      if (expensive_nodes.size() < kInlineScheduleReadyThreshold) {
+      num_pool_scheduled += expensive_nodes.size();
+      if (lock_free_ready_queue_) {
+        ScheduleViaLockFreeReadyQueue(expensive_nodes, scheduled_nsec);
+      } else if (expensive_nodes.size() < kInlineScheduleReadyThreshold) {
         for (auto& tagged_node : expensive_nodes) {
           RunTask(std::bind(&ExecutorState::Process, this, tagged_node,
                             scheduled_nsec),
@@ -1372,10 +1647,56 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
         }
       }
     }
+    tsl::profiler::TraceMe::InstantActivity(
+        [&] {
+          return tsl::profiler::TraceMeEncode(
+              "ExecutorState::ScheduleDecision",
+              {{"inlined", num_inline_scheduled},
+               {"dispatched", num_pool_scheduled}});
+        },
+        tsl::profiler::TraceMeLevel::kVerbose);
   }
   ready->clear();
 }
 
+template <class PropagatorStateType>
+void ExecutorState<PropagatorStateType>::ScheduleViaLockFreeReadyQueue(
+    const TaggedNodeSeq& nodes, int64_t scheduled_nsec) {
+  // Each dispatched drain task owns one ready node, which it processes only
+  // after the shared queue is empty.  The owned node is accounted for in
+  // `num_outstanding_ops_` until that final `Process` call, so the step
+  // cannot complete (and `this` cannot be destroyed by `Finish`) while any
+  // drain task has yet to run, even if its siblings drain the entire queue
+  // first.  Only the nodes beyond the drain-task count go through the queue.
+  const int num_drain_tasks =
+      std::min<int>(nodes.size(), kMaxReadyQueueDrainTasks);
+  for (size_t i = num_drain_tasks; i < nodes.size(); ++i) {
+    const TaggedNode& tagged_node = nodes[i];
+    if (!lock_free_ready_queue_->TryPush(tagged_node)) {
+      // The queue is full; dispatch this node directly.
+      RunTask([=]() { Process(tagged_node, scheduled_nsec); },
+              /*sample_rate=*/nodes.size());
+    }
+  }
+  for (int i = 0; i < num_drain_tasks; ++i) {
+    TaggedNode owned_node = nodes[i];
+    RunTask(
+        [this, owned_node, scheduled_nsec]() {
+          // Any node popped here is processed while `owned_node` still holds
+          // the step open, so these calls cannot complete the step.
+          absl::optional<TaggedNode> node = lock_free_ready_queue_->TryPop();
+          while (node) {
+            Process(*node, scheduled_nsec);
+            node = lock_free_ready_queue_->TryPop();
+          }
+          // Processing the owned node may complete the step and destroy
+          // `this`, so it must be the final statement that touches `this`.
+          Process(owned_node, scheduled_nsec);
+        },
+        /*sample_rate=*/num_drain_tasks);
+  }
+}
+
 template <class PropagatorStateType>
 void ExecutorState<PropagatorStateType>::ScheduleFinish() {
   // Checks condition to decide if needs to invoke Finish(). If there are
@@ -125,6 +125,14 @@ class Executor {
     // If true, all kernels will be treated as "inexpensive", and hence executed
     // on the scheduling thread.
     bool run_all_kernels_inline = false;
+
+    // If true, ready nodes are handed off to worker threads through a
+    // lock-free multi-producer multi-consumer queue instead of dispatching
+    // one closure per node through `runner`. This reduces contention on the
+    // underlying thread pool's queue lock when many nodes become ready
+    // simultaneously (e.g. wide graphs running with a large number of
+    // intra-op threads).
+    bool use_lock_free_ready_queue = false;
   };
   typedef std::function<void(const absl::Status&)> DoneCallback;
 
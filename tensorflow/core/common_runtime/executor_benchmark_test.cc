@@ -0,0 +1,178 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// A maintained benchmark suite for the executor and session layer, covering
+// scheduling overhead as a function of graph shape (width, depth, fan-in),
+// the cost of cheap/expensive op mixes, feed/fetch overhead, and rendezvous
+// throughput. Unlike the ad-hoc BM_executor benchmarks in executor_test.cc,
+// the graph generators here are deterministic, so results are comparable
+// between runs and releases.
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/common_runtime/kernel_benchmark_testlib.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.pb.h"
+#include "tensorflow/core/graph/algorithm.h"
+#include "tensorflow/core/graph/graph.h"
+#include "tensorflow/core/graph/testlib.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/platform/test_benchmark.h"
+
+namespace tensorflow {
+namespace {
+
+#define ALICE "/job:j/replica:0/task:0/cpu:0"
+#define BOB "/job:j/replica:0/task:0/device:GPU:0"
+
+// Builds a graph of `depth` layers of `width` no-op nodes. Each node takes
+// `fanin` control dependencies from the previous layer, spread round-robin so
+// every node in a layer has the same in-degree and out-degree. Measures pure
+// scheduling overhead: no kernel does any work.
+void BM_ExecutorLayeredGraph(::testing::benchmark::State& state) {
+  const int width = state.range(0);
+  const int depth = state.range(1);
+  const int fanin = state.range(2);
+
+  Graph* g = new Graph(OpRegistry::Global());
+  std::vector<Node*> prev_layer;
+  std::vector<Node*> layer;
+  for (int d = 0; d < depth; ++d) {
+    layer.clear();
+    for (int w = 0; w < width; ++w) {
+      std::vector<Node*> control_inputs;
+      if (!prev_layer.empty()) {
+        for (int k = 0; k < fanin; ++k) {
+          control_inputs.push_back(prev_layer[(w + k) % prev_layer.size()]);
+        }
+      }
+      layer.push_back(test::graph::NoOp(g, control_inputs));
+    }
+    prev_layer = layer;
+  }
+
+  FixupSourceAndSinkEdges(g);
+  test::Benchmark("cpu", g, /*old_benchmark_api=*/false).Run(state);
+
+  const int num_nodes = width * depth;
+  state.SetLabel(strings::StrCat("Nodes = ", num_nodes));
+  state.SetItemsProcessed(num_nodes * static_cast<int64_t>(state.iterations()));
+}
+
+// Wide graphs: scheduling many independent nodes per layer.
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({256, 4, 1});
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({1024, 4, 1});
+// Deep graphs: long dependency chains.
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({4, 256, 1});
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({4, 1024, 1});
+// Fan-in: propagation cost as each node waits on more predecessors.
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({32, 32, 1});
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({32, 32, 4});
+BENCHMARK(BM_ExecutorLayeredGraph)->UseRealTime()->Args({32, 32, 16});
+
+// Builds a graph of `num_ops` independent ops where `expensive_pct` percent
+// are 64x64 matmuls and the rest are identities on a scalar. Exercises the
+// executor's expensive-op tracking and inline-versus-threadpool scheduling.
+void BM_ExecutorOpMix(::testing::benchmark::State& state) {
+  const int num_ops = state.range(0);
+  const int expensive_pct = state.range(1);
+
+  Graph* g = new Graph(OpRegistry::Global());
+  Tensor big(DT_FLOAT, TensorShape({64, 64}));
+  big.flat<float>().setRandom();
+  Tensor small(DT_FLOAT, TensorShape({}));
+  small.scalar<float>()() = 1.0;
+  Node* big_const = test::graph::Constant(g, big);
+  Node* small_const = test::graph::Constant(g, small);
+  for (int i = 0; i < num_ops; ++i) {
+    if (i % 100 < expensive_pct) {
+      test::graph::Matmul(g, big_const, big_const, false, false);
+    } else {
+      test::graph::Identity(g, small_const);
+    }
+  }
+
+  FixupSourceAndSinkEdges(g);
+  test::Benchmark("cpu", g, /*old_benchmark_api=*/false).Run(state);
+
+  state.SetLabel(strings::StrCat("Expensive% = ", expensive_pct));
+  state.SetItemsProcessed(num_ops * static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ExecutorOpMix)->UseRealTime()->Args({256, 0});
+BENCHMARK(BM_ExecutorOpMix)->UseRealTime()->Args({256, 10});
+BENCHMARK(BM_ExecutorOpMix)->UseRealTime()->Args({256, 50});
+BENCHMARK(BM_ExecutorOpMix)->UseRealTime()->Args({256, 100});
+
+// Feeds `num_tensors` scalar tensors through rendezvous, passes each through
+// an identity, and fetches all results. Measures per-tensor feed/fetch cost.
+void BM_ExecutorFeedFetch(::testing::benchmark::State& state) {
+  const int num_tensors = state.range(0);
+
+  Graph* g = new Graph(OpRegistry::Global());
+  Tensor val(DT_FLOAT, TensorShape({}));
+  val.scalar<float>()() = 3.14;
+  std::vector<std::pair<string, Tensor>> inputs;
+  std::vector<string> outputs;
+  for (int i = 0; i < num_tensors; ++i) {
+    Node* x = test::graph::Recv(g, strings::StrCat("x", i), "float", ALICE, 1,
+                                BOB);
+    Node* y = test::graph::Identity(g, x);
+    Node* z = test::graph::Send(g, y, strings::StrCat("z", i), BOB, 1, ALICE);
+    inputs.emplace_back(test::GetRendezvousKey(x), val);
+    outputs.push_back(test::GetRendezvousKey(z));
+  }
+
+  FixupSourceAndSinkEdges(g);
+  test::Benchmark("cpu", g, /*old_benchmark_api=*/false)
+      .RunWithRendezvousArgs(inputs, outputs, state);
+  state.SetItemsProcessed(num_tensors *
+                          static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ExecutorFeedFetch)->Arg(1)->Arg(16)->Arg(256);
+
+// Builds `num_pairs` intra-graph Send/Recv pairs over the local rendezvous,
+// all runnable in parallel. Measures rendezvous handoff throughput.
+void BM_ExecutorSendRecv(::testing::benchmark::State& state) {
+  const int num_pairs = state.range(0);
+
+  Graph* g = new Graph(OpRegistry::Global());
+  Tensor val(DT_FLOAT, TensorShape({}));
+  val.scalar<float>()() = 1.0;
+  Node* c = test::graph::Constant(g, val);
+  for (int i = 0; i < num_pairs; ++i) {
+    const string tensor_name = strings::StrCat("t", i);
+    test::graph::Send(g, c, tensor_name, ALICE, 1, ALICE);
+    test::graph::Recv(g, tensor_name, "float", ALICE, 1, ALICE);
+  }
+
+  FixupSourceAndSinkEdges(g);
+  test::Benchmark("cpu", g, /*old_benchmark_api=*/false).Run(state);
+  state.SetItemsProcessed(num_pairs * static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ExecutorSendRecv)->UseRealTime()->Arg(1)->Arg(64)->Arg(1024);
+
+#undef ALICE
+#undef BOB
+
+}  // namespace
+}  // namespace tensorflow
@@ -101,9 +101,12 @@ class ExecutorTest : public ::testing::Test {
     args.rendezvous = rendez;
     args.stats_collector = &step_stats_collector_;
     args.runner = runner_;
+    args.use_lock_free_ready_queue = use_lock_free_ready_queue_;
     return exec_->Run(args);
   }
 
+  bool use_lock_free_ready_queue_ = false;
+
   thread::ThreadPool* thread_pool_ = nullptr;
   std::unique_ptr<Device> device_;
   Executor* exec_ = nullptr;
@@ -265,6 +268,22 @@ TEST_F(ExecutorTest, RandomTree) {
   EXPECT_EQ(4096.0, V(out));
 }
 
+TEST_F(ExecutorTest, RandomTreeLockFreeReadyQueue) {
+  use_lock_free_ready_queue_ = true;
+  auto g = std::make_unique<Graph>(OpRegistry::Global());
+  BuildTree(4096, g.get());
+  Create(std::move(g));
+  Rendezvous::Args args;
+  TF_ASSERT_OK(
+      rendez_->Send(Key(ALICE, kIncarnation, BOB, "a"), args, V(1.0), false));
+  TF_ASSERT_OK(Run(rendez_));
+  Tensor out = V(-1);
+  bool is_dead = false;
+  TF_ASSERT_OK(
+      rendez_->Recv(Key(BOB, kIncarnation, ALICE, "b"), args, &out, &is_dead));
+  EXPECT_EQ(4096.0, V(out));
+}
+
 void BuildConcurrentAddAssign(Graph* g) {
   auto one = test::graph::Constant(g, V(1.0));
   // A variable holds one float.
@@ -759,6 +759,16 @@ void BaseGPUDevice::LogOutputs(OpKernel* op_kernel, OpKernelContext* context) {
 }
 
 void BaseGPUDevice::Compute(OpKernel* op_kernel, OpKernelContext* context) {
+  // NOTE: This is the natural point to capture per-step kernel launch
+  // sequences into a CUDA graph and replay them to amortize launch overhead.
+  // We deliberately do not: the BFC allocator may hand out different device
+  // addresses for the same tensors on every step, and many kernels perform
+  // host-side work (shape computation, allocation, callbacks) inside
+  // Compute(), so a recorded graph would silently read and write stale
+  // buffers. Launch batching requires static buffer assignment, which XLA
+  // provides; compiled clusters use stream_executor command buffers (CUDA
+  // graphs) via xla/stream_executor/command_buffer.h.
+  //
   // NOTE(tucker): We need to discriminate between Eigen GPU
   // operations and all others.  If an operation is Eigen
   // implemented (or otherwise tries to launch a GPU kernel
@@ -36,6 +36,7 @@ limitations under the License.
 #include "xla/tsl/framework/device_id.h"
 #include "xla/tsl/framework/device_id_utils.h"
 #include "xla/tsl/util/env_var.h"
+#include "tensorflow/core/common_runtime/allocation_attribution.h"
 #include "tensorflow/core/common_runtime/device/device_host_allocator.h"
 #include "tensorflow/core/common_runtime/device_id_utils.h"
 #include "tensorflow/core/common_runtime/gpu/gpu_bfc_allocator.h"
@@ -211,6 +212,12 @@ Allocator* GPUProcessState::GetGPUAllocator(
 #endif
     }
 
+    if (AllocationAttributionIndex::IsEnabled()) {
+      // Wrap the allocator to attribute live allocations to the ops that
+      // made them, for OOM diagnosis in production builds.
+      gpu_allocator = new AttributionAllocator(gpu_allocator);
+    }
+
     Allocator* recording_allocator = nullptr;
     if (process_state_->ProcessState::FLAGS_brain_gpu_record_mem_types) {
       ProcessState::MemDesc md;
@@ -18,6 +18,7 @@ limitations under the License.
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "absl/status/status.h"
@@ -52,6 +53,7 @@ limitations under the License.
 #include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/lib/strings/stringprintf.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/stream_executor.h"
 #include "tensorflow/core/platform/tensor_coding.h"
 #include "tensorflow/core/profiler/lib/scoped_annotation.h"
@@ -214,6 +216,41 @@ void GPUUtil::SetProtoFromGPU(const Tensor& tensor, Device* dev,
       });
 }
 
+namespace {
+
+// Ensures peer access from the sending executor to the receiving executor is
+// enabled before a cross-device memcpy is issued, so the copy goes directly
+// over the interconnect instead of being staged through host memory by the
+// driver. The device factory enables peering between the devices it creates,
+// but copies involving executors it did not pair up (e.g. plugin-created
+// devices, or pairs whose enable call failed at startup) would otherwise
+// silently take the staged path. Each (from, to) pair is probed only once;
+// EnablePeerAccessTo is idempotent if peering is already on.
+void EnsurePeerAccess(se::StreamExecutor* from, se::StreamExecutor* to) {
+  if (from == nullptr || to == nullptr || from == to) return;
+  static mutex* mu = new mutex;
+  static auto* probed_pairs =
+      new std::set<std::pair<se::StreamExecutor*, se::StreamExecutor*>>;
+  mutex_lock l(*mu);
+  if (!probed_pairs->insert({from, to}).second) return;
+  if (!from->CanEnablePeerAccessTo(to)) {
+    LOG(WARNING) << "Direct peer access from device ordinal "
+                 << from->device_ordinal() << " to device ordinal "
+                 << to->device_ordinal()
+                 << " is not available; device-to-device copies between them "
+                    "will be staged through host memory by the driver.";
+    return;
+  }
+  absl::Status status = from->EnablePeerAccessTo(to);
+  if (!status.ok()) {
+    LOG(WARNING) << "Unable to enable peer access from device ordinal "
+                 << from->device_ordinal() << " to device ordinal "
+                 << to->device_ordinal() << ", status: " << status;
+  }
+}
+
+}  // namespace
+
 // static
 void GPUUtil::DeviceToDeviceCopy(
     DeviceContext* send_dev_context, DeviceContext* recv_dev_context,
@@ -278,6 +315,8 @@ void GPUUtil::DeviceToDeviceCopy(
       }
     }
 
+    EnsurePeerAccess(send_stream->parent(), recv_stream->parent());
+
     VLOG(2) << "src_ptr " << src_ptr << " dst_ptr " << dst_ptr;
     s = send_device_to_device_stream->Memcpy(&gpu_dst_ptr, gpu_src_ptr,
                                              total_bytes);
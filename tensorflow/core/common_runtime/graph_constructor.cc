@@ -676,6 +676,7 @@ absl::Status GraphConstructor::ValidateInputMapAndControlDependencies() {
 
 absl::Status GraphConstructor::BuildNodeIndex() {
   // Validate the node names and add them to gdef_nodes_ and gdef_prefixes_.
+  gdef_nodes_.reserve(node_def_count());
   for (int n = 0; n < node_def_count(); ++n) {
     const NodeDef& node_def = get_node_def(n);
     if (!IsValidNodeName(node_def.name(), opts_.allow_internal_ops)) {
@@ -1186,6 +1187,15 @@ absl::Status GraphConstructor::Convert() {
         g_->AddFunctionLibrary(*std::move(library), library_traces));
   }
 
+  // Pre-size the graph's node and edge tables so that importing a large
+  // GraphDef does not repeatedly reallocate them as nodes are added one at a
+  // time below. Every input of every NodeDef becomes at most one edge.
+  int64_t total_inputs = 0;
+  for (int n = 0; n < node_def_count(); ++n) {
+    total_inputs += get_node_def(n).input_size();
+  }
+  g_->ReserveNodesAndEdges(node_def_count(), total_inputs);
+
   std::vector<InputInfo> inputs;
   int processed = 0;
 
@@ -49,6 +49,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/gtl/flatset.h"
+#include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/lib/strings/stringprintf.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/types.h"
@@ -861,6 +862,56 @@ absl::Status GraphExecutionState::OptimizeGraph(
 #endif  // IS_MOBILE_PLATFORM
 }
 
+namespace {
+
+// Upper bound on the number of pruned-graph blueprints retained per
+// GraphExecutionState.  Serving workloads cycle through a modest number of
+// feed/fetch combinations; the least recently used blueprint is evicted
+// beyond this.
+constexpr size_t kMaxPrunedGraphCacheEntries = 16;
+
+// Deterministic rendering of every BuildGraphOptions field that influences
+// the ClientGraph produced by BuildGraph().
+string BuildGraphCacheKey(const BuildGraphOptions& options) {
+  const CallableOptions& callable = options.callable_options;
+  string key = strings::StrCat(absl::StrJoin(callable.feed(), ","), "->",
+                               absl::StrJoin(callable.fetch(), ","),
+                               "/targets:", absl::StrJoin(callable.target(), ","));
+  for (const TensorConnection& connection : callable.tensor_connection()) {
+    strings::StrAppend(&key, "/tc:", connection.from_tensor(), ":",
+                       connection.to_tensor());
+  }
+  // The device maps are unordered; render them sorted by tensor name.
+  const std::map<string, string> feed_devices(callable.feed_devices().begin(),
+                                              callable.feed_devices().end());
+  for (const auto& entry : feed_devices) {
+    strings::StrAppend(&key, "/feed_dev:", entry.first, "@", entry.second);
+  }
+  const std::map<string, string> fetch_devices(callable.fetch_devices().begin(),
+                                               callable.fetch_devices().end());
+  for (const auto& entry : fetch_devices) {
+    strings::StrAppend(&key, "/fetch_dev:", entry.first, "@", entry.second);
+  }
+  strings::StrAppend(
+      &key, "/skip_sync:", static_cast<int>(callable.fetch_skip_sync()),
+      "/fc:", static_cast<int>(options.use_function_convention),
+      "/cgk:", options.collective_graph_key,
+      "/co:", static_cast<int>(options.collective_order));
+  return key;
+}
+
+}  // namespace
+
+std::unique_ptr<ClientGraph> GraphExecutionState::ClientGraphFromBlueprint(
+    const PrunedGraphBlueprint& blueprint) {
+  auto client_graph = std::make_unique<ClientGraph>(
+      std::make_unique<FunctionLibraryDefinition>(*blueprint.flib_def),
+      blueprint.feed_types, blueprint.fetch_types,
+      blueprint.collective_graph_key);
+  CopyGraph(*blueprint.graph, &client_graph->graph);
+  return client_graph;
+}
+
 absl::Status GraphExecutionState::BuildGraph(
     const BuildGraphOptions& options, std::unique_ptr<ClientGraph>* out) {
   VLOG(1) << "BuildGraph";
@@ -872,6 +923,27 @@ absl::Status GraphExecutionState::BuildGraph(
         "Attempted to prune a graph that has not been fully initialized.");
   }
 
+  // When this state represents a graph that was pruned at construction time,
+  // BuildGraph is only ever called once for its single feed/fetch signature,
+  // so there is nothing worth caching.
+  const bool use_pruned_graph_cache =
+      session_options_ == nullptr ||
+      !session_options_->config.graph_options().place_pruned_graph();
+  const string cache_key =
+      use_pruned_graph_cache ? BuildGraphCacheKey(options) : "";
+  if (use_pruned_graph_cache) {
+    mutex_lock l(pruned_graph_cache_mu_);
+    auto iter = pruned_graph_cache_.find(cache_key);
+    if (iter != pruned_graph_cache_.end()) {
+      VLOG(1) << "BuildGraph: serving cached pruning for " << cache_key;
+      iter->second.last_used = ++pruned_graph_cache_ticks_;
+      *out = ClientGraphFromBlueprint(iter->second);
+      metrics::UpdateGraphBuildTime(Env::Default()->NowMicros() -
+                                    start_time_usecs);
+      return absl::OkStatus();
+    }
+  }
+
   // Grappler optimization might change the structure of a graph itself, and
   // also it can add/prune functions to/from the library.
   std::unique_ptr<Graph> optimized_graph;
@@ -976,6 +1048,29 @@ absl::Status GraphExecutionState::BuildGraph(
                       rewrite_metadata.fetch_types, collective_graph_key));
   CopyGraph(*optimized_graph, &dense_copy->graph);
 
+  if (use_pruned_graph_cache) {
+    mutex_lock l(pruned_graph_cache_mu_);
+    if (pruned_graph_cache_.size() >= kMaxPrunedGraphCacheEntries) {
+      auto lru = pruned_graph_cache_.begin();
+      for (auto it = pruned_graph_cache_.begin();
+           it != pruned_graph_cache_.end(); ++it) {
+        if (it->second.last_used < lru->second.last_used) {
+          lru = it;
+        }
+      }
+      pruned_graph_cache_.erase(lru);
+    }
+    PrunedGraphBlueprint& blueprint = pruned_graph_cache_[cache_key];
+    blueprint.flib_def =
+        std::make_unique<FunctionLibraryDefinition>(*dense_copy->flib_def);
+    blueprint.graph = std::make_unique<Graph>(blueprint.flib_def.get());
+    CopyGraph(dense_copy->graph, blueprint.graph.get());
+    blueprint.feed_types = dense_copy->feed_types;
+    blueprint.fetch_types = dense_copy->fetch_types;
+    blueprint.collective_graph_key = dense_copy->collective_graph_key;
+    blueprint.last_used = ++pruned_graph_cache_ticks_;
+  }
+
   // TODO(vrv): We should check invariants of the graph here.
   metrics::UpdateGraphBuildTime(Env::Default()->NowMicros() - start_time_usecs);
   *out = std::move(dense_copy);
@@ -17,6 +17,7 @@ limitations under the License.
 #define TENSORFLOW_CORE_COMMON_RUNTIME_GRAPH_EXECUTION_STATE_H_
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,6 +31,7 @@ limitations under the License.
 #include "tensorflow/core/graph/graph.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 
 namespace tensorflow {
@@ -204,6 +206,26 @@ class GraphExecutionState {
   absl::Status PruneGraph(const BuildGraphOptions& options, Graph* graph,
                           subgraph::RewriteGraphMetadata* out_rewrite_metadata);
 
+  // A cached result of BuildGraph() for one BuildGraphOptions signature: the
+  // optimized, pruned graph together with the metadata needed to stamp out a
+  // ClientGraph.  Re-creating a callable with feeds, fetches and targets that
+  // were built before then costs a copy of the pruned subgraph instead of a
+  // fresh Grappler run and pruning pass over the full graph.
+  struct PrunedGraphBlueprint {
+    std::unique_ptr<FunctionLibraryDefinition> flib_def;
+    std::unique_ptr<Graph> graph;
+    DataTypeVector feed_types;
+    DataTypeVector fetch_types;
+    int64_t collective_graph_key;
+    // Tick of the last BuildGraph() call served from this blueprint; the
+    // entry with the smallest tick is evicted when the cache is full.
+    uint64 last_used = 0;
+  };
+
+  // Stamps a new ClientGraph out of `blueprint`.
+  static std::unique_ptr<ClientGraph> ClientGraphFromBlueprint(
+      const PrunedGraphBlueprint& blueprint);
+
   // The GraphExecutionState must store a copy of the original GraphDef if
   // either of the following conditions holds:
   //
@@ -231,6 +253,13 @@ class GraphExecutionState {
   // The dataflow graph owned by this object.
   Graph* graph_;
 
+  // Blueprints of previously built client graphs, keyed by a rendering of
+  // the BuildGraphOptions that produced them (see BuildGraph).
+  mutable mutex pruned_graph_cache_mu_;
+  std::map<string, PrunedGraphBlueprint> pruned_graph_cache_
+      TF_GUARDED_BY(pruned_graph_cache_mu_);
+  uint64 pruned_graph_cache_ticks_ TF_GUARDED_BY(pruned_graph_cache_mu_) = 0;
+
   // Whether to run Placer.
   bool run_placer_;
 
@@ -0,0 +1,492 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/common_runtime/hierarchical_ring_reducer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/common_runtime/collective_rma_local.h"
+#include "tensorflow/core/common_runtime/collective_util.h"
+#include "tensorflow/core/common_runtime/device_mgr.h"
+#include "tensorflow/core/common_runtime/dma_helper.h"
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/framework/device_base.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/notification.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/profiler/lib/traceme.h"
+
+namespace tensorflow {
+
+namespace {
+// Phases of the algorithm, used to keep BufRendezvous keys distinct.
+constexpr int kPhaseLocalReduce = 1;
+constexpr int kPhaseRingScatter = 2;
+constexpr int kPhaseRingGather = 3;
+constexpr int kPhaseLocalBroadcast = 4;
+
+// Key to be used for BufRendezvous by HierarchicalRingReducer.
+string ReduceBufKey(const string& exec_key, int phase, int step, int subdiv,
+                    int src_rank, int dst_rank) {
+  return strings::StrCat(exec_key, ":hrr:", phase, ":", step, ":", subdiv, ":",
+                         src_rank, ":", dst_rank);
+}
+}  // namespace
+
+HierarchicalRingReducer::HierarchicalRingReducer()
+    : col_ctx_(nullptr), col_params_(nullptr), done_(nullptr) {}
+
+absl::Status HierarchicalRingReducer::InitializeCollectiveParams(
+    CollectiveParams* col_params) {
+  CHECK_EQ(col_params->instance.type, REDUCTION_COLLECTIVE);
+  CHECK_EQ(col_params->instance.impl_details.collective_name,
+           "HierarchicalRingReduce");
+  const string& device_name =
+      col_params->group.members[col_params->default_rank].device.name();
+  // Start by counting the devices in each task.
+  // Precondition: device_names must be sorted so that all devices in
+  // the same task are adjacent.
+  std::vector<int> dev_per_task;
+  const string* prior_task_name = &col_params->group.members[0].task;
+  int dev_count = 1;
+  for (int di = 1; di < col_params->group.group_size; ++di) {
+    if (col_params->group.members[di].task != *prior_task_name) {
+      dev_per_task.push_back(dev_count);
+      dev_count = 1;
+      prior_task_name = &col_params->group.members[di].task;
+    } else {
+      ++dev_count;
+    }
+  }
+  dev_per_task.push_back(dev_count);
+  CHECK_EQ(col_params->group.num_tasks, dev_per_task.size());
+
+  int num_tasks = col_params->group.num_tasks;
+  // If there is just 1 task there is one subdiv comprising all devices.
+  // Otherwise the first subdiv is the inter-task ring over one leader device
+  // per task, and then there are N more subdivs, where N is #task.
+  int num_subdivs = num_tasks + (num_tasks > 1 ? 1 : 0);
+  col_params->instance.impl_details.subdiv_permutations.resize(num_subdivs);
+  col_params->subdiv_rank.reserve(num_subdivs);
+
+  // Inter-task subdiv.  The leader of each task is its first device.  If a
+  // device does not participate in the subdiv, set subdiv_rank to -1.
+  if (num_tasks > 1) {
+    const int sdi = 0;
+    std::vector<int>& perm =
+        col_params->instance.impl_details.subdiv_permutations[sdi];
+    CHECK_EQ(perm.size(), 0);
+    int device_count = 0;
+    for (int ti = 0; ti < num_tasks; ti++) {
+      perm.push_back(device_count);
+      if (col_params->group.members[device_count].device.name() ==
+          device_name) {
+        col_params->subdiv_rank.push_back(ti);
+      }
+      device_count += dev_per_task[ti];
+    }
+    if (col_params->subdiv_rank.empty()) col_params->subdiv_rank.push_back(-1);
+  }
+
+  // Intra-task subdivs.  Pick all devices in task ti for subdiv sdi.  If a
+  // device does not participate in the subdiv, set subdiv_rank to -1.
+  int abs_di = 0;
+  for (int ti = 0; ti < num_tasks; ti++) {
+    const int sdi = ti + (num_tasks > 1 ? 1 : 0);
+    std::vector<int>& perm =
+        col_params->instance.impl_details.subdiv_permutations[sdi];
+    CHECK_EQ(perm.size(), 0);
+    bool participate = false;
+    for (int di = 0; di < dev_per_task[ti]; di++) {
+      perm.push_back(abs_di);
+      if (col_params->group.members[abs_di].device.name() == device_name) {
+        participate = true;
+        col_params->subdiv_rank.push_back(di);
+      }
+      abs_di++;
+    }
+    if (!participate) col_params->subdiv_rank.push_back(-1);
+  }
+
+  VLOG(2) << collective_util::SubdivPermDebugString(*col_params);
+  return absl::OkStatus();
+}
+
+absl::Status HierarchicalRingReducer::InitializeCollectiveContext(
+    std::shared_ptr<CollectiveContext> col_ctx) {
+  CHECK(col_ctx->dev_mgr);
+  col_ctx_ = col_ctx;
+  col_params_ = col_ctx->col_params.get();
+  return collective_util::InitializeDeviceAndLocality(
+      col_ctx->dev_mgr, col_ctx->device_name, &col_ctx->device,
+      &col_ctx->device_locality);
+}
+
+void HierarchicalRingReducer::Run(StatusCallback done) {
+  CHECK(col_ctx_);
+  CHECK(col_params_);
+  // Like `RingReducer`, this implementation doesn't require non-overlapping
+  // collectives, so unblock any collective that is blocked on this instance.
+  col_ctx_->col_exec->UnblockDependencies(*col_params_);
+  done_ = std::move(done);
+
+  const int num_tasks = col_params_->group.num_tasks;
+  // Every device participates in exactly one intra-task subdiv.
+  const int local_subdiv_base = num_tasks > 1 ? 1 : 0;
+  int local_subdiv = -1;
+  for (int sd = local_subdiv_base;
+       sd < static_cast<int>(col_params_->subdiv_rank.size()); ++sd) {
+    if (col_params_->subdiv_rank[sd] >= 0) {
+      local_subdiv = sd;
+      break;
+    }
+  }
+  CHECK_GE(local_subdiv, 0);
+  const bool is_leader = col_params_->subdiv_rank[local_subdiv] == 0;
+
+  // Leaders reduce in place on the output buffer, so they start by copying
+  // input to output if they're not already the same.  Non-leaders send their
+  // input and have their output entirely overwritten by the final intra-task
+  // broadcast.
+  if (is_leader && (col_ctx_->input != col_ctx_->output) &&
+      (DMAHelper::base(col_ctx_->input) != DMAHelper::base(col_ctx_->output))) {
+    // We are running in a blockable thread and the callback can't block so
+    // just wait here on the copy.
+    Notification note;
+    absl::Status status;
+    tsl::profiler::TraceMe activity("MemCpyAsync",
+                                    tsl::profiler::TraceMeLevel::kInfo);
+    CollectiveRemoteAccessLocal::MemCpyAsync(
+        col_ctx_->op_ctx->op_device_context(),
+        col_ctx_->op_ctx->op_device_context(), col_ctx_->device,
+        col_ctx_->device, col_ctx_->op_ctx->input_alloc_attr(0),
+        col_ctx_->op_ctx->output_alloc_attr(0), col_ctx_->input,
+        col_ctx_->output, 0 /*dev_to_dev_stream_index*/,
+        [&note, &status](const absl::Status& s) {
+          status.Update(s);
+          note.Notify();
+        });
+    note.WaitForNotification();
+    if (!status.ok()) {
+      done_(status);
+      return;
+    }
+  }
+
+  RunLocalReduce(local_subdiv);
+  if (is_leader && status().ok()) {
+    RunLeaderRing();
+  }
+  if (status().ok()) {
+    RunLocalBroadcast(local_subdiv);
+  }
+  VLOG(2) << "device=" << col_ctx_->device_name << " return status "
+          << status();
+  done_(status());
+}
+
+absl::Status HierarchicalRingReducer::status() const {
+  mutex_lock l(status_mu_);
+  return status_;
+}
+
+void HierarchicalRingReducer::StartAbort(const absl::Status& s) {
+  // In abort mode we stop issuing additional PostToPeer and RecvFromPeer
+  // calls, but we need to wait for all of the outstanding callbacks to be
+  // invoked before quitting.
+  bool abort_started = false;
+  {
+    mutex_lock l(status_mu_);
+    if (status_.ok()) {
+      LOG(ERROR) << "Aborting HierarchicalRingReduce with " << s;
+      abort_started = true;
+      status_.Update(s);
+    }
+  }
+  // If this is the initial entry to abort mode and it's not a cancellation,
+  // then invoke StartAbort on the CollectiveExecutor that invoked us.  That
+  // should start cancellation on all of the outstanding CollectiveRemoteAccess
+  // actions, including those of our peers.
+  if (abort_started) {
+    if (col_ctx_->op_ctx->cancellation_manager() == nullptr ||
+        (!col_ctx_->op_ctx->cancellation_manager()->IsCancelled() &&
+         !col_ctx_->op_ctx->cancellation_manager()->IsCancelling())) {
+      col_ctx_->col_exec->StartAbort(s);
+    }
+  }
+}
+
+void HierarchicalRingReducer::ComputeBinOp(OpKernel* op, Tensor* output,
+                                           Tensor* input) {
+  absl::Status s = collective_util::ComputeBinOp(
+      col_ctx_->op_ctx, col_ctx_->op_params, col_ctx_->device, op, output,
+      input);
+  if (!s.ok()) StartAbort(s);
+}
+
+void HierarchicalRingReducer::RunLocalReduce(int subdiv) {
+  tsl::profiler::TraceMe activity("LocalReduce",
+                                  tsl::profiler::TraceMeLevel::kInfo);
+  const int my_rank = col_params_->subdiv_rank[subdiv];
+  const int num_local = static_cast<int>(
+      col_params_->instance.impl_details.subdiv_permutations[subdiv].size());
+  if (num_local == 1) return;
+  if (my_rank > 0) {
+    // Send this device's contribution to the task leader.
+    Notification note;
+    DispatchSend(kPhaseLocalReduce, 0, subdiv, /*dst_rank=*/0, my_rank,
+                 col_ctx_->input, [this, &note](const absl::Status& s) {
+                   if (!s.ok()) StartAbort(s);
+                   note.Notify();
+                 });
+    note.WaitForNotification();
+  } else {
+    // Leader: merge each local peer's contribution into output.
+    AllocatorAttributes attr = col_ctx_->op_ctx->output_alloc_attr(0);
+    Tensor tmp(col_ctx_->device->GetAllocator(attr), col_ctx_->output->dtype(),
+               col_ctx_->output->shape());
+    for (int src_rank = 1; src_rank < num_local && status().ok(); ++src_rank) {
+      Notification note;
+      DispatchRecv(kPhaseLocalReduce, 0, subdiv, src_rank, /*dst_rank=*/0,
+                   &tmp, [this, &note](const absl::Status& s) {
+                     if (!s.ok()) StartAbort(s);
+                     note.Notify();
+                   });
+      note.WaitForNotification();
+      if (status().ok()) {
+        ComputeBinOp(col_params_->merge_op, col_ctx_->output, &tmp);
+      }
+    }
+  }
+}
+
+void HierarchicalRingReducer::RunLeaderRing() {
+  tsl::profiler::TraceMe activity("LeaderRing",
+                                  tsl::profiler::TraceMeLevel::kInfo);
+  const int num_tasks = col_params_->group.num_tasks;
+  // Rank in the inter-task ring; with a single task the "ring" is this
+  // device alone and only final_op application below remains.
+  const int my_rank = num_tasks > 1 ? col_params_->subdiv_rank[0] : 0;
+  DCHECK_GE(my_rank, 0);
+
+  AllocatorAttributes attr = col_ctx_->op_ctx->output_alloc_attr(0);
+  ca_.reset(MakeCollectiveAdapter(col_ctx_->output, num_tasks,
+                                  col_ctx_->device->GetAllocator(attr)));
+
+  if (col_params_->final_op) {
+    // Create an on-device scalar value from group_size that is needed to
+    // finalize the owned chunk after the reduce-scatter pass.
+    Tensor group_size_val = ca_->Scalar(col_params_->group.group_size);
+    if (col_params_->group.device_type != "CPU") {
+      group_size_tensor_ = ca_->Scalar(
+          col_ctx_->device->GetAllocator(col_ctx_->op_ctx->input_alloc_attr(0)),
+          AllocationAttributes());
+      DeviceContext* op_dev_ctx = col_ctx_->op_ctx->op_device_context();
+      Notification note;
+      absl::Status copy_status;
+      op_dev_ctx->CopyCPUTensorToDevice(
+          &group_size_val, col_ctx_->device, &group_size_tensor_,
+          [&note, &copy_status](const absl::Status& s) {
+            copy_status.Update(s);
+            note.Notify();
+          });
+      note.WaitForNotification();
+      if (!copy_status.ok()) StartAbort(copy_status);
+    } else {
+      group_size_tensor_ = group_size_val;
+    }
+  }
+
+  // Runs one ring step: concurrently send `send_tensor` to the next leader
+  // and receive from the previous leader into `recv_tensor`, then wait for
+  // both.  Either tensor may be null to skip that side (empty tail chunks).
+  auto ring_step = [this, num_tasks, my_rank](int phase, int step,
+                                              const Tensor* send_tensor,
+                                              Tensor* recv_tensor) {
+    const int next_rank = (my_rank + 1) % num_tasks;
+    const int prev_rank = (my_rank + num_tasks - 1) % num_tasks;
+    mutex mu;
+    int pending_count = 0;  // TF_GUARDED_BY(mu)
+    condition_variable all_done;
+    auto op_done = [this, &mu, &pending_count,
+                    &all_done](const absl::Status& s) {
+      if (!s.ok()) StartAbort(s);
+      mutex_lock l(mu);
+      --pending_count;
+      if (pending_count == 0) all_done.notify_all();
+    };
+    if (send_tensor != nullptr) {
+      {
+        mutex_lock l(mu);
+        ++pending_count;
+      }
+      DispatchSend(phase, step, /*subdiv=*/0, next_rank, my_rank, send_tensor,
+                   op_done);
+    }
+    if (recv_tensor != nullptr) {
+      {
+        mutex_lock l(mu);
+        ++pending_count;
+      }
+      DispatchRecv(phase, step, /*subdiv=*/0, prev_rank, my_rank, recv_tensor,
+                   op_done);
+    }
+    {
+      mutex_lock l(mu);
+      while (pending_count > 0) all_done.wait(l);
+    }
+  };
+
+  // Reduce-scatter: after step s each leader has merged the partial value of
+  // chunk (my_rank - s - 1) mod t; after t-1 steps it owns the fully reduced
+  // chunk (my_rank + 1) mod t.
+  for (int s = 0; s < num_tasks - 1 && status().ok(); ++s) {
+    const int send_chunk = (my_rank - s + num_tasks) % num_tasks;
+    const int recv_chunk = (my_rank - s - 1 + num_tasks) % num_tasks;
+    Tensor send_t = ca_->ChunkAlias(send_chunk);
+    Tensor recv_tmp = ca_->TempChunk(recv_chunk);
+    ring_step(kPhaseRingScatter, s,
+              ca_->ChunkBytes(send_chunk) > 0 ? &send_t : nullptr,
+              ca_->ChunkBytes(recv_chunk) > 0 ? &recv_tmp : nullptr);
+    if (status().ok() && ca_->ChunkBytes(recv_chunk) > 0) {
+      Tensor recv_alias = ca_->ChunkAlias(recv_chunk);
+      ComputeBinOp(col_params_->merge_op, &recv_alias, &recv_tmp);
+    }
+  }
+
+  // Apply final_op to the owned chunk; the all-gather below then distributes
+  // finalized values, so every element is finalized exactly once.
+  if (status().ok() && col_params_->final_op) {
+    const int owned_chunk = (my_rank + 1) % num_tasks;
+    if (ca_->ChunkBytes(owned_chunk) > 0) {
+      Tensor owned_alias = ca_->ChunkAlias(owned_chunk);
+      ComputeBinOp(col_params_->final_op, &owned_alias, &group_size_tensor_);
+    }
+  }
+
+  // All-gather: circulate the finalized chunks so that every leader ends up
+  // with the complete tensor.
+  for (int s = 0; s < num_tasks - 1 && status().ok(); ++s) {
+    const int send_chunk = (my_rank + 1 - s + num_tasks) % num_tasks;
+    const int recv_chunk = (my_rank - s + num_tasks) % num_tasks;
+    Tensor send_t = ca_->ChunkAlias(send_chunk);
+    Tensor recv_t = ca_->ChunkAlias(recv_chunk);
+    ring_step(kPhaseRingGather, s,
+              ca_->ChunkBytes(send_chunk) > 0 ? &send_t : nullptr,
+              ca_->ChunkBytes(recv_chunk) > 0 ? &recv_t : nullptr);
+  }
+
+  // Recover the output from the adaptor.
+  ca_->ConsumeFinalValue(col_ctx_->output);
+  ca_.reset();
+}
+
+void HierarchicalRingReducer::RunLocalBroadcast(int subdiv) {
+  tsl::profiler::TraceMe activity("LocalBroadcast",
+                                  tsl::profiler::TraceMeLevel::kInfo);
+  const int my_rank = col_params_->subdiv_rank[subdiv];
+  const int num_local = static_cast<int>(
+      col_params_->instance.impl_details.subdiv_permutations[subdiv].size());
+  if (num_local == 1) return;
+  if (my_rank == 0) {
+    // Leader: send the reduced tensor to every other local device.
+    mutex mu;
+    int pending_count = 0;  // TF_GUARDED_BY(mu)
+    condition_variable all_done;
+    for (int dst_rank = 1; dst_rank < num_local; ++dst_rank) {
+      {
+        mutex_lock l(mu);
+        ++pending_count;
+      }
+      DispatchSend(kPhaseLocalBroadcast, 0, subdiv, dst_rank, /*src_rank=*/0,
+                   col_ctx_->output,
+                   [this, &mu, &pending_count,
+                    &all_done](const absl::Status& s) {
+                     if (!s.ok()) StartAbort(s);
+                     mutex_lock l(mu);
+                     --pending_count;
+                     if (pending_count == 0) all_done.notify_all();
+                   });
+    }
+    {
+      mutex_lock l(mu);
+      while (pending_count > 0) all_done.wait(l);
+    }
+  } else {
+    Notification note;
+    DispatchRecv(kPhaseLocalBroadcast, 0, subdiv, /*src_rank=*/0, my_rank,
+                 col_ctx_->output, [this, &note](const absl::Status& s) {
+                   if (!s.ok()) StartAbort(s);
+                   note.Notify();
+                 });
+    note.WaitForNotification();
+  }
+}
+
+void HierarchicalRingReducer::DispatchSend(int phase, int step, int subdiv,
+                                           int dst_rank, int src_rank,
+                                           const Tensor* src_tensor,
+                                           const StatusCallback& done) {
+  string send_buf_key = ReduceBufKey(col_ctx_->exec_key, phase, step, subdiv,
+                                     src_rank, dst_rank);
+  int dst_idx =
+      col_params_->instance.impl_details.subdiv_permutations[subdiv][dst_rank];
+  VLOG(3) << "DispatchSend " << send_buf_key << " from_device "
+          << col_ctx_->device_name << " to_device "
+          << col_params_->group.members[dst_idx].device.name()
+          << " subdiv=" << subdiv << " dst_rank=" << dst_rank
+          << " dst_idx=" << dst_idx;
+  col_ctx_->col_exec->remote_access()->PostToPeer(
+      col_params_->group.members[dst_idx].device.name(),
+      col_params_->group.members[dst_idx].task, send_buf_key, col_ctx_->device,
+      col_ctx_->op_ctx->op_device_context(),
+      col_ctx_->op_ctx->output_alloc_attr(0), src_tensor,
+      col_ctx_->device_locality, col_ctx_->op_ctx->cancellation_manager(),
+      done);
+}
+
+void HierarchicalRingReducer::DispatchRecv(int phase, int step, int subdiv,
+                                           int src_rank, int dst_rank,
+                                           Tensor* dst_tensor,
+                                           const StatusCallback& done) {
+  string recv_buf_key = ReduceBufKey(col_ctx_->exec_key, phase, step, subdiv,
+                                     src_rank, dst_rank);
+  int src_idx =
+      col_params_->instance.impl_details.subdiv_permutations[subdiv][src_rank];
+  VLOG(3) << "DispatchRecv " << recv_buf_key << " from_device "
+          << col_params_->group.members[src_idx].device.name() << " to_device "
+          << col_ctx_->device_name << " subdiv=" << subdiv
+          << " src_rank=" << src_rank << " src_idx=" << src_idx;
+  col_ctx_->col_exec->remote_access()->RecvFromPeer(
+      col_params_->group.members[src_idx].device.name(),
+      col_params_->group.members[src_idx].task,
+      col_params_->group.members[src_idx].is_local, recv_buf_key,
+      col_ctx_->device, col_ctx_->op_ctx->op_device_context(),
+      col_ctx_->op_ctx->output_alloc_attr(0), dst_tensor,
+      col_ctx_->device_locality, 0 /*stream_index*/,
+      col_ctx_->op_ctx->cancellation_manager(), done);
+}
+
+namespace {
+REGISTER_COLLECTIVE(HierarchicalRingReduce, HierarchicalRingReducer);
+}  // namespace
+
+}  // namespace tensorflow
@@ -0,0 +1,108 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_HIERARCHICAL_RING_REDUCER_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_HIERARCHICAL_RING_REDUCER_H_
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/core/common_runtime/base_collective_executor.h"
+#include "tensorflow/core/framework/collective.h"
+
+namespace tensorflow {
+
+// Two-level implementation of collective reduction for multi-task groups
+// whose intra-task interconnect (e.g. NVLink) is much faster than the
+// inter-task network.  A flat ring over all devices sends every tensor byte
+// across task boundaries once per ring hop; this implementation first
+// reduces each task's inputs onto one leader device over the fast local
+// links, then runs a chunked ring (reduce-scatter + all-gather) over just
+// the leaders, and finally re-broadcasts the result within each task.  Each
+// cross-task link therefore carries roughly 2/T of the tensor per leader
+// hop instead of the full tensor per device hop.
+//
+// Selected through CollectiveParams by setting
+// instance.impl_details.communication_hint = "hierarchical" on a
+// REDUCTION_COLLECTIVE with more than one task.
+class HierarchicalRingReducer : public CollectiveImplementationInterface {
+ public:
+  HierarchicalRingReducer();
+  ~HierarchicalRingReducer() override = default;
+
+  // Establishes the subdiv permutations for the two levels.  If the group
+  // spans t tasks, t > 1, subdiv 0 comprises one leader device (the first
+  // device) per task and subdivs 1..t are the per-task device sets.  For a
+  // single task there is one subdiv comprising all devices.
+  absl::Status InitializeCollectiveParams(
+      CollectiveParams* col_params) override;
+
+  // Initializes members of CollectiveContext not yet initialized, i.e. device
+  // and device_locality.  Also saves the CollectiveContext in this object.
+  absl::Status InitializeCollectiveContext(
+      std::shared_ptr<CollectiveContext> col_ctx) override;
+
+  // Executes the hierarchical reduction.  Must be called in a blockable
+  // thread.
+  void Run(StatusCallback done) override;
+
+ private:
+  // Thread-safe accessor for the overall status.
+  absl::Status status() const;
+
+  // Called when a bad status is received that implies we should terminate
+  // execution and return a bad status.
+  void StartAbort(const absl::Status& s);
+
+  // Intra-task phase: non-leader devices send their input to the task
+  // leader, which merges each into its output with merge_op.
+  void RunLocalReduce(int subdiv);
+
+  // Inter-task phase, leaders only: chunked ring over subdiv 0, i.e.
+  // reduce-scatter followed by all-gather, with final_op applied to the
+  // owned chunk in between.  With a single task this degenerates to
+  // applying final_op to the whole output.
+  void RunLeaderRing();
+
+  // Intra-task phase: the task leader sends the fully reduced tensor to
+  // every other device in its task.
+  void RunLocalBroadcast(int subdiv);
+
+  // Applies `op` elementwise in place as output = op(output, input).
+  void ComputeBinOp(OpKernel* op, Tensor* output, Tensor* input);
+
+  // Sends `src_tensor` asynchronously from this device to device at
+  // `dst_rank` in `subdiv`.  Calls `done` upon completion.  `phase` and
+  // `step` disambiguate the BufRendezvous key across phases and ring steps.
+  void DispatchSend(int phase, int step, int subdiv, int dst_rank,
+                    int src_rank, const Tensor* src_tensor,
+                    const StatusCallback& done);
+
+  // Receives a tensor into `dst_tensor` at this device from device at
+  // `src_rank` in `subdiv`.  Calls `done` upon completion.
+  void DispatchRecv(int phase, int step, int subdiv, int src_rank,
+                    int dst_rank, Tensor* dst_tensor,
+                    const StatusCallback& done);
+
+  std::shared_ptr<CollectiveContext> col_ctx_;
+  const CollectiveParams* col_params_;  // Not owned
+  StatusCallback done_;
+  std::unique_ptr<CollectiveAdapter> ca_;
+  Tensor group_size_tensor_;
+  mutable mutex status_mu_;
+  absl::Status status_ TF_GUARDED_BY(status_mu_);
+};
+
+}  // namespace tensorflow
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_HIERARCHICAL_RING_REDUCER_H_
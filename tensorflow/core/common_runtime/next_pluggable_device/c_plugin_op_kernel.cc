@@ -292,7 +292,7 @@ absl::Status CPluginOpKernelContext::GetFunctionLibraryDefinition(
   TF_RETURN_IF_ERROR(
       BufferToMessage(serialized_function_library_ptr.get(), &fdef_lib));
   auto flib_def_ptr =
-      new FunctionLibraryDefinition(OpRegistry::Global(), fdef_lib);
+      new FunctionLibraryDefinition(OpRegistry::Global(), std::move(fdef_lib));
   *flib_def = flib_def_ptr;
   return absl::OkStatus();
 }
@@ -0,0 +1,102 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/op_duration_sampler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/lib/monitoring/sampler.h"
+#include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/platform/env_time.h"
+#include "tensorflow/core/platform/profile_utils/cpu_utils.h"
+
+namespace tensorflow {
+namespace {
+
+auto* op_duration_usecs_histogram = monitoring::Sampler<1>::New(
+    {"/tensorflow/core/op_duration_usecs",
+     "Sampled kernel execution durations in microseconds, by op type.",
+     "op_type"},
+    // 1us .. ~8s.
+    {monitoring::Buckets::Exponential(1, 2, 24)});
+
+}  // namespace
+
+OpDurationSampler* OpDurationSampler::Get() {
+  static OpDurationSampler* sampler = new OpDurationSampler;
+  return sampler;
+}
+
+OpDurationSampler::OpDurationSampler()
+    : usecs_per_cycle_(
+          1e6 / std::max<double>(1.0, static_cast<double>(
+                                          profile_utils::CpuUtils::
+                                              GetCycleCounterFrequency()))) {
+  const char* env = std::getenv("TF_OP_DURATION_SAMPLING");
+  enabled_.store(env != nullptr && std::strcmp(env, "0") != 0,
+                 std::memory_order_relaxed);
+}
+
+void OpDurationSampler::RecordCycles(absl::string_view op_type,
+                                     absl::string_view node_name,
+                                     uint64 elapsed_cycles) {
+  const uint64 duration_usecs =
+      static_cast<uint64>(elapsed_cycles * usecs_per_cycle_);
+  const std::string op_type_str(op_type);
+  op_duration_usecs_histogram->GetCell(op_type_str)->Add(duration_usecs);
+
+  Reservoir* reservoir;
+  {
+    mutex_lock l(mu_);
+    std::unique_ptr<Reservoir>& slot = reservoirs_[op_type_str];
+    if (slot == nullptr) {
+      slot = std::make_unique<Reservoir>();
+    }
+    reservoir = slot.get();
+  }
+
+  // Vitter's algorithm R: each of the first `count` recordings ends up in
+  // the reservoir with equal probability.
+  Exemplar exemplar{std::string(node_name), duration_usecs,
+                    EnvTime::NowMicros()};
+  mutex_lock l(reservoir->mu);
+  ++reservoir->count;
+  if (reservoir->samples.size() < kReservoirSize) {
+    reservoir->samples.push_back(std::move(exemplar));
+  } else {
+    const uint64 index = random::New64() % reservoir->count;
+    if (index < reservoir->samples.size()) {
+      reservoir->samples[index] = std::move(exemplar);
+    }
+  }
+}
+
+std::map<std::string, std::vector<OpDurationSampler::Exemplar>>
+OpDurationSampler::CollectExemplars() const {
+  std::map<std::string, std::vector<Exemplar>> result;
+  mutex_lock l(mu_);
+  for (const auto& entry : reservoirs_) {
+    mutex_lock reservoir_lock(entry.second->mu);
+    result[entry.first] = entry.second->samples;
+  }
+  return result;
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,99 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_OP_DURATION_SAMPLER_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_OP_DURATION_SAMPLER_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// Always-on, low-overhead sampling of per-op kernel durations.
+//
+// The executor feeds this from the same sampled kernel timings it already
+// collects to maintain its cost estimates, so enabling it adds no extra
+// timer reads on the hot path: all expensive kernel executions and ~1/16 of
+// inexpensive ones are recorded. Durations are accumulated into a tfstreamz
+// histogram keyed by op type (exported on demand through the standard
+// monitoring collection), and a small reservoir of exemplars (node name,
+// duration, timestamp) is kept per op type so a production regression can
+// be attributed to concrete nodes without turning on full tracing with
+// ProfilerSession.
+//
+// Disabled by default; enable by setting TF_OP_DURATION_SAMPLING=1 in the
+// environment (checked once at startup) or by calling SetEnabled(true).
+//
+// Thread safe.
+class OpDurationSampler {
+ public:
+  struct Exemplar {
+    std::string node_name;
+    uint64 duration_usecs;
+    // Time the exemplar was recorded, in microseconds since the epoch.
+    uint64 timestamp_usecs;
+  };
+
+  static OpDurationSampler* Get();
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  // Records one sampled kernel execution. `elapsed_cycles` comes from the
+  // executor's KernelTimer; conversion to wall time uses the calibrated
+  // cycle counter frequency.
+  void RecordCycles(absl::string_view op_type, absl::string_view node_name,
+                    uint64 elapsed_cycles);
+
+  // Returns a snapshot of the current exemplar reservoirs, keyed by op type.
+  std::map<std::string, std::vector<Exemplar>> CollectExemplars() const;
+
+ private:
+  OpDurationSampler();
+
+  // Number of exemplars kept per op type.
+  static constexpr int kReservoirSize = 8;
+
+  struct Reservoir {
+    mutable mutex mu;
+    // Total number of recordings for this op type, including those not kept.
+    int64_t count TF_GUARDED_BY(mu) = 0;
+    std::vector<Exemplar> samples TF_GUARDED_BY(mu);
+  };
+
+  std::atomic<bool> enabled_;
+  const double usecs_per_cycle_;
+
+  mutable mutex mu_;  // guards the reservoir map structure, not the entries.
+  std::map<std::string, std::unique_ptr<Reservoir>> reservoirs_
+      TF_GUARDED_BY(mu_);
+
+  OpDurationSampler(const OpDurationSampler&) = delete;
+  void operator=(const OpDurationSampler&) = delete;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_OP_DURATION_SAMPLER_H_
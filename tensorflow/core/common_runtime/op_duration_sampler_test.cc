@@ -0,0 +1,57 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/op_duration_sampler.h"
+
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+TEST(OpDurationSamplerTest, EnabledToggle) {
+  OpDurationSampler* sampler = OpDurationSampler::Get();
+  // Disabled by default unless TF_OP_DURATION_SAMPLING is set for the test.
+  sampler->SetEnabled(true);
+  EXPECT_TRUE(sampler->enabled());
+  sampler->SetEnabled(false);
+  EXPECT_FALSE(sampler->enabled());
+}
+
+TEST(OpDurationSamplerTest, RecordsExemplars) {
+  OpDurationSampler* sampler = OpDurationSampler::Get();
+  sampler->RecordCycles("MatMul", "model/dense/MatMul", 1000000);
+  sampler->RecordCycles("Relu", "model/dense/Relu", 500);
+
+  auto exemplars = sampler->CollectExemplars();
+  ASSERT_EQ(exemplars.count("MatMul"), 1);
+  ASSERT_EQ(exemplars.count("Relu"), 1);
+  ASSERT_FALSE(exemplars["MatMul"].empty());
+  EXPECT_EQ(exemplars["MatMul"][0].node_name, "model/dense/MatMul");
+  EXPECT_GT(exemplars["MatMul"][0].timestamp_usecs, 0);
+}
+
+TEST(OpDurationSamplerTest, ReservoirIsBounded) {
+  OpDurationSampler* sampler = OpDurationSampler::Get();
+  for (int i = 0; i < 1000; ++i) {
+    sampler->RecordCycles("Add", "model/add", 100 + i);
+  }
+  auto exemplars = sampler->CollectExemplars();
+  ASSERT_EQ(exemplars.count("Add"), 1);
+  EXPECT_LE(exemplars["Add"].size(), 8);
+  EXPECT_FALSE(exemplars["Add"].empty());
+}
+
+}  // namespace
+}  // namespace tensorflow
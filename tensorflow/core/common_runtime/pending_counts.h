@@ -97,6 +97,14 @@ class PendingCounts {
     memcpy(bytes_, other.bytes_, other.num_bytes_);
   }
 
+  // Resets this to a copy of the counts in "other", reusing the existing
+  // byte buffer. Requires that both objects were created from the same
+  // layout.
+  void CopyFrom(const PendingCounts& other) {
+    DCHECK_EQ(num_bytes_, other.num_bytes_);
+    memcpy(bytes_, other.bytes_, num_bytes_);
+  }
+
   ~PendingCounts() { delete[] bytes_; }
 
   void set_initial_count(Handle h, size_t pending_count) {
@@ -0,0 +1,155 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/placement_cache.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "tensorflow/core/common_runtime/device.h"
+#include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/logging.h"
+
+namespace tensorflow {
+namespace {
+
+// Fingerprints the placement-relevant state of `graph`: every op node's
+// definition (name, op, attrs, inputs) together with its requested and
+// pre-assigned devices.
+uint64 GraphFingerprint(const Graph& graph) {
+  uint64 fp = Fingerprint64("placement_cache");
+  for (const Node* node : graph.op_nodes()) {
+    string serialized;
+    SerializeToStringDeterministic(node->def(), &serialized);
+    fp = FingerprintCat64(fp, Fingerprint64(serialized));
+    fp = FingerprintCat64(fp, Fingerprint64(node->requested_device()));
+    if (node->has_assigned_device_name()) {
+      fp = FingerprintCat64(fp, Fingerprint64(node->assigned_device_name()));
+    }
+  }
+  return fp;
+}
+
+uint64 DeviceSetFingerprint(const DeviceSet& devices) {
+  std::vector<string> names;
+  names.reserve(devices.devices().size());
+  for (const Device* device : devices.devices()) {
+    names.push_back(device->name());
+  }
+  std::sort(names.begin(), names.end());
+  uint64 fp = Fingerprint64("device_set");
+  for (const string& name : names) {
+    fp = FingerprintCat64(fp, Fingerprint64(name));
+  }
+  return fp;
+}
+
+}  // namespace
+
+/* static */ PlacementCache* PlacementCache::Get() {
+  static PlacementCache* cache = []() -> PlacementCache* {
+    const char* dir = std::getenv("TF_PLACEMENT_CACHE_DIR");
+    if (dir == nullptr || *dir == '\0') return nullptr;
+    return new PlacementCache(dir);
+  }();
+  return cache;
+}
+
+PlacementCache::PlacementCache(const std::string& directory)
+    : directory_(directory) {}
+
+std::string PlacementCache::EntryPath(const Graph& graph,
+                                      const DeviceSet& devices) const {
+  return io::JoinPath(
+      directory_, absl::StrCat("placement_", GraphFingerprint(graph), "_",
+                               DeviceSetFingerprint(devices), ".txt"));
+}
+
+bool PlacementCache::TryApply(const std::string& entry_path, Graph* graph,
+                              const DeviceSet& devices) const {
+  string contents;
+  if (!ReadFileToString(Env::Default(), entry_path, &contents).ok()) {
+    return false;
+  }
+
+  absl::flat_hash_map<absl::string_view, absl::string_view> cached;
+  for (absl::string_view line :
+       absl::StrSplit(contents, '\n', absl::SkipEmpty())) {
+    std::pair<absl::string_view, absl::string_view> parts =
+        absl::StrSplit(line, absl::MaxSplits('\t', 1));
+    cached.emplace(parts.first, parts.second);
+  }
+
+  // Validate the whole entry before touching the graph, so a stale or
+  // partial entry leaves the graph unchanged for constraint solving.
+  std::vector<std::pair<Node*, string>> assignments;
+  assignments.reserve(graph->num_op_nodes());
+  for (Node* node : graph->op_nodes()) {
+    auto it = cached.find(node->name());
+    if (it == cached.end()) {
+      VLOG(1) << "Placement cache entry " << entry_path
+              << " does not cover node " << node->name();
+      return false;
+    }
+    const Device* device = devices.FindDeviceByName(string(it->second));
+    if (device == nullptr) {
+      VLOG(1) << "Placement cache entry " << entry_path
+              << " refers to missing device " << it->second;
+      return false;
+    }
+    if (node->has_assigned_device_name() &&
+        node->assigned_device_name() != device->name()) {
+      VLOG(1) << "Placement cache entry " << entry_path
+              << " disagrees with pre-assigned node " << node->name();
+      return false;
+    }
+    assignments.emplace_back(node, device->name());
+  }
+
+  for (const auto& assignment : assignments) {
+    assignment.first->set_assigned_device_name(assignment.second);
+  }
+  VLOG(1) << "Replayed placement of " << assignments.size() << " nodes from "
+          << entry_path;
+  return true;
+}
+
+absl::Status PlacementCache::Record(const std::string& entry_path,
+                                    const Graph& graph) const {
+  string contents;
+  for (const Node* node : graph.op_nodes()) {
+    if (!node->has_assigned_device_name()) {
+      return errors::Internal("Cannot record placement of unplaced node ",
+                              node->name());
+    }
+    absl::StrAppend(&contents, node->name(), "\t",
+                    node->assigned_device_name(), "\n");
+  }
+  TF_RETURN_IF_ERROR(Env::Default()->RecursivelyCreateDir(directory_));
+  return WriteStringToFile(Env::Default(), entry_path, contents);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,74 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_PLACEMENT_CACHE_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_PLACEMENT_CACHE_H_
+
+#include <string>
+
+#include "tensorflow/core/common_runtime/device_set.h"
+#include "tensorflow/core/graph/graph.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// A persisted cache of placement decisions, keyed by fingerprints of the
+// graph and of the device set it was placed against. On fleets whose
+// topology never changes, loading the same model repeatedly re-solves an
+// identical placement problem; this cache lets Placer::Run() skip
+// colocation-graph construction and constraint solving entirely and replay
+// the previously computed assignment instead.
+//
+// The cache is enabled by pointing the TF_PLACEMENT_CACHE_DIR environment
+// variable at a writable directory. Each placed graph is stored as one text
+// file named after the (graph, device set) fingerprints, holding one
+// "node-name<TAB>device-name" line per op node. An entry is replayed only if
+// it covers every op node of the graph, every recorded device still exists
+// in the current device set, and it agrees with any pre-assigned nodes;
+// otherwise the placer falls back to constraint solving and refreshes the
+// entry.
+class PlacementCache {
+ public:
+  // Returns the process-wide cache, or nullptr if caching is disabled
+  // (TF_PLACEMENT_CACHE_DIR is unset). The result, when non-null, is valid
+  // for the lifetime of the process.
+  static PlacementCache* Get();
+
+  explicit PlacementCache(const std::string& directory);
+
+  // Computes the cache file path for (`graph`, `devices`). Must be called
+  // before placement: device assignments feed the graph fingerprint, so the
+  // key of a placed graph differs from the key it will be looked up under.
+  std::string EntryPath(const Graph& graph, const DeviceSet& devices) const;
+
+  // Attempts to assign every op node of `graph` from the entry at
+  // `entry_path`, validating each recorded device against `devices`. Returns
+  // true and assigns all nodes on a full hit; returns false and leaves
+  // `graph` untouched otherwise.
+  bool TryApply(const std::string& entry_path, Graph* graph,
+                const DeviceSet& devices) const;
+
+  // Records the assignments of the (fully placed) `graph` at `entry_path` so
+  // a later load against the same device set can replay them.
+  absl::Status Record(const std::string& entry_path, const Graph& graph) const;
+
+ private:
+  const std::string directory_;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_PLACEMENT_CACHE_H_
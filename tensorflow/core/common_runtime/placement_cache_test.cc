@@ -0,0 +1,133 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/placement_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "tensorflow/core/common_runtime/device.h"
+#include "tensorflow/core/common_runtime/device_set.h"
+#include "tensorflow/core/common_runtime/graph_constructor.h"
+#include "tensorflow/core/framework/device_attributes.pb.h"
+#include "tensorflow/core/framework/function_testlib.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/graph/graph.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+using ::tensorflow::test::function::GDef;
+using ::tensorflow::test::function::NDef;
+
+constexpr char kDevice0[] = "/job:a/replica:0/task:0/device:FakeCPU:0";
+constexpr char kDevice1[] = "/job:a/replica:0/task:0/device:FakeCPU:1";
+
+// A device with just a name and type; the cache only inspects names.
+class FakeDevice : public Device {
+ public:
+  explicit FakeDevice(const string& name) : Device(nullptr, Attributes(name)) {}
+
+  absl::Status Sync() override {
+    return errors::Unimplemented("FakeDevice::Sync()");
+  }
+
+ private:
+  static DeviceAttributes Attributes(const string& name) {
+    DeviceAttributes attributes;
+    attributes.set_name(name);
+    attributes.set_device_type("FakeCPU");
+    return attributes;
+  }
+};
+
+class PlacementCacheTest : public ::testing::Test {
+ protected:
+  PlacementCacheTest()
+      : device0_(std::make_unique<FakeDevice>(kDevice0)),
+        device1_(std::make_unique<FakeDevice>(kDevice1)),
+        cache_(io::JoinPath(testing::TmpDir(), "placement_cache")) {
+    devices_.AddDevice(device0_.get());
+    devices_.AddDevice(device1_.get());
+  }
+
+  // Builds a small unplaced graph of NoOps.
+  std::unique_ptr<Graph> MakeGraph() {
+    GraphDef graph_def = GDef({NDef("x", "NoOp"), NDef("y", "NoOp")});
+    auto graph = std::make_unique<Graph>(OpRegistry::Global());
+    TF_CHECK_OK(ConvertGraphDefToGraph({}, graph_def, graph.get()));
+    return graph;
+  }
+
+  Node* FindNode(Graph* graph, const string& name) {
+    for (Node* node : graph->op_nodes()) {
+      if (node->name() == name) return node;
+    }
+    return nullptr;
+  }
+
+  std::unique_ptr<FakeDevice> device0_;
+  std::unique_ptr<FakeDevice> device1_;
+  DeviceSet devices_;
+  PlacementCache cache_;
+};
+
+TEST_F(PlacementCacheTest, RoundTrip) {
+  std::unique_ptr<Graph> graph = MakeGraph();
+  const string entry_path = cache_.EntryPath(*graph, devices_);
+  EXPECT_FALSE(cache_.TryApply(entry_path, graph.get(), devices_));
+
+  FindNode(graph.get(), "x")->set_assigned_device_name(kDevice0);
+  FindNode(graph.get(), "y")->set_assigned_device_name(kDevice1);
+  TF_ASSERT_OK(cache_.Record(entry_path, *graph));
+
+  std::unique_ptr<Graph> replayed = MakeGraph();
+  EXPECT_EQ(cache_.EntryPath(*replayed, devices_), entry_path);
+  EXPECT_TRUE(cache_.TryApply(entry_path, replayed.get(), devices_));
+  EXPECT_EQ(FindNode(replayed.get(), "x")->assigned_device_name(), kDevice0);
+  EXPECT_EQ(FindNode(replayed.get(), "y")->assigned_device_name(), kDevice1);
+}
+
+TEST_F(PlacementCacheTest, MissingDeviceInvalidatesEntry) {
+  std::unique_ptr<Graph> graph = MakeGraph();
+  const string entry_path = cache_.EntryPath(*graph, devices_);
+  FindNode(graph.get(), "x")->set_assigned_device_name(kDevice0);
+  FindNode(graph.get(), "y")->set_assigned_device_name(kDevice1);
+  TF_ASSERT_OK(cache_.Record(entry_path, *graph));
+
+  DeviceSet smaller;
+  smaller.AddDevice(device0_.get());
+  std::unique_ptr<Graph> replayed = MakeGraph();
+  EXPECT_FALSE(cache_.TryApply(entry_path, replayed.get(), smaller));
+  EXPECT_FALSE(FindNode(replayed.get(), "x")->has_assigned_device_name());
+}
+
+TEST_F(PlacementCacheTest, DisagreeingPreAssignmentInvalidatesEntry) {
+  std::unique_ptr<Graph> graph = MakeGraph();
+  const string entry_path = cache_.EntryPath(*graph, devices_);
+  FindNode(graph.get(), "x")->set_assigned_device_name(kDevice0);
+  FindNode(graph.get(), "y")->set_assigned_device_name(kDevice1);
+  TF_ASSERT_OK(cache_.Record(entry_path, *graph));
+
+  std::unique_ptr<Graph> replayed = MakeGraph();
+  FindNode(replayed.get(), "x")->set_assigned_device_name(kDevice1);
+  EXPECT_FALSE(cache_.TryApply(entry_path, replayed.get(), devices_));
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/colocation_graph.h"
 #include "tensorflow/core/common_runtime/device.h"
+#include "tensorflow/core/common_runtime/placement_cache.h"
 #include "tensorflow/core/framework/attr_value_util.h"
 #include "tensorflow/core/framework/device_attributes.pb.h"
 #include "tensorflow/core/framework/function.h"
@@ -238,6 +239,22 @@ absl::Status Placer::Run(const GraphOptimizationPassOptions& options) {
     }
   }
 
+  // An optional persisted placement cache (TF_PLACEMENT_CACHE_DIR) replays a
+  // previous assignment of this exact graph against this exact device set,
+  // skipping colocation-graph construction and constraint solving. The entry
+  // path must be computed before any node is assigned.
+  PlacementCache* placement_cache = PlacementCache::Get();
+  string placement_cache_path;
+  if (placement_cache != nullptr) {
+    placement_cache_path = placement_cache->EntryPath(*graph_, *devices_);
+    if (placement_cache->TryApply(placement_cache_path, graph_, *devices_)) {
+      for (Node* node : graph_->op_nodes()) {
+        LogDeviceAssignment(node, log_device_placement_);
+      }
+      return absl::OkStatus();
+    }
+  }
+
   FunctionStack stack(function_name_);
   ColocationGraph colocation_graph(graph_, stack, flib_def_, devices_,
                                    default_local_device_, allow_soft_placement_,
@@ -356,6 +373,15 @@ absl::Status Placer::Run(const GraphOptimizationPassOptions& options) {
                                     log_device_placement_));
   }
 
+  if (placement_cache != nullptr) {
+    absl::Status cache_status =
+        placement_cache->Record(placement_cache_path, *graph_);
+    if (!cache_status.ok()) {
+      LOG(WARNING) << "Failed to record placement cache entry "
+                   << placement_cache_path << ": " << cache_status;
+    }
+  }
+
   if (VLOG_IS_ON(3)) {
     DumpGraphToFile(
         strings::StrCat(options.debug_filename_prefix, "placer_output"),
@@ -641,9 +641,12 @@ absl::Status ProcessFunctionLibraryRuntime::InstantiateMultiDevice(
   absl::InlinedVector<absl::Status, 4UL> instantiate_status(num_subgraphs);
 
   // Before instantiating component functions, determine synchronous execution.
+  // A lone component is analyzed even when small function optimizations are
+  // off: if it cannot touch a rendezvous, Run() passes arguments to it
+  // directly instead of moving them through a per-call rendezvous.
   data->enable_sync_execution = false;
-  if (options.allow_small_function_optimizations) {
-    data->enable_sync_execution = true;
+  if (options.allow_small_function_optimizations || num_subgraphs == 1) {
+    data->enable_sync_execution = options.allow_small_function_optimizations;
     for (const auto& pair : *subgraphs) {
       ComponentFunctionData* comp_data = &data->glue_[pair.first];
       const Graph* subgraph = pair.second.get();
@@ -1022,6 +1025,114 @@ absl::Status ProcessFunctionLibraryRuntime::RunMultiDeviceSync(
   return absl::OkStatus();
 }
 
+const ProcessFunctionLibraryRuntime::ComponentFunctionData*
+ProcessFunctionLibraryRuntime::GetDirectPassComponent(
+    const MultiDeviceFunctionData* data) const {
+  if (data == nullptr || data->glue_.size() != 1 || data->is_cross_process_ ||
+      data->has_remote_outputs) {
+    return nullptr;
+  }
+  const auto& pair = *data->glue_.begin();
+  // Only a component with no send/recv or async ops is guaranteed never to
+  // touch the rendezvous.
+  if (pair.second.async_attributes.summary() != AsyncAttributes::kSafeForSync) {
+    return nullptr;
+  }
+  if (GetFLR(pair.first) == nullptr) return nullptr;
+  return &pair.second;
+}
+
+absl::Status ProcessFunctionLibraryRuntime::RunSingleComponentDirectSync(
+    const FunctionLibraryRuntime::Options& opts,
+    const MultiDeviceFunctionData* data, absl::Span<const Tensor> args,
+    std::vector<Tensor>* rets) const {
+  const auto& pair = *data->glue_.begin();
+  const string& target = pair.first;
+  const ComponentFunctionData& comp_data = pair.second;
+
+  InternalArgs comp_args;
+  TF_RETURN_IF_ERROR(GetComponentArgs(args, comp_data, &comp_args));
+
+  FunctionLibraryRuntime* flr = GetFLR(target);
+  FunctionLibraryRuntime::Options opts_copy = opts;
+  opts_copy.args_alloc_attrs = comp_data.arg_alloc_attrs;
+  opts_copy.rets_alloc_attrs = comp_data.ret_alloc_attrs;
+  opts_copy.remote_execution = false;
+  // When target device has private thread pool, use the target device runner
+  thread::ThreadPool* pool = flr->device()->tensorflow_device_thread_pool();
+  opts_copy.runner = (pool == nullptr) ? opts.runner : flr->runner();
+
+  VLOG(1) << "Running lone component function of " << data->function_name_
+          << " on device " << target << " with direct-pass arguments";
+  std::vector<Tensor> comp_rets;
+  absl::Status run_status = flr->RunSync(
+      opts_copy, comp_data.handle, GetLocalArgs(comp_args.args), &comp_rets);
+  if (!run_status.ok()) {
+    VLOG(2) << "Component function execution failed: " << run_status;
+    const string function_and_msg = strings::StrCat(
+        errors::FormatFunctionForError(data->function_name_), " ",
+        run_status.message());
+    return errors::CreateWithUpdatedMessage(run_status, function_and_msg);
+  }
+  rets->resize(data->num_outputs_);
+  for (int i = 0; i < comp_rets.size(); ++i) {
+    (*rets)[comp_data.ret_indices[i]] = comp_rets[i];
+  }
+  return absl::OkStatus();
+}
+
+void ProcessFunctionLibraryRuntime::RunSingleComponentDirectAsync(
+    const FunctionLibraryRuntime::Options& opts,
+    const MultiDeviceFunctionData* data, absl::Span<const Tensor> args,
+    std::vector<Tensor>* rets,
+    FunctionLibraryRuntime::DoneCallback done) const {
+  const auto& pair = *data->glue_.begin();
+  const string& target = pair.first;
+  const ComponentFunctionData& comp_data = pair.second;
+
+  InternalArgs comp_args;
+  absl::Status s = GetComponentArgs(args, comp_data, &comp_args);
+  if (!s.ok()) {
+    done(s);
+    return;
+  }
+
+  FunctionLibraryRuntime* flr = GetFLR(target);
+  FunctionLibraryRuntime::Options opts_copy = opts;
+  opts_copy.args_alloc_attrs = comp_data.arg_alloc_attrs;
+  opts_copy.rets_alloc_attrs = comp_data.ret_alloc_attrs;
+  opts_copy.remote_execution = false;
+  // When target device has private thread pool, use the target device runner
+  thread::ThreadPool* pool = flr->device()->tensorflow_device_thread_pool();
+  opts_copy.runner = (pool == nullptr) ? opts.runner : flr->runner();
+
+  VLOG(1) << "Running lone component function of " << data->function_name_
+          << " on device " << target << " with direct-pass arguments";
+  std::vector<Tensor>* comp_rets = new std::vector<Tensor>;
+  flr->Run(
+      opts_copy, comp_data.handle, GetLocalArgs(comp_args.args), comp_rets,
+      // `data` (and thus `comp_data`) is owned by mdevice_data_ and is
+      // constant and alive until the handle is released, which cannot happen
+      // before `done` runs.
+      [comp_rets, rets, data, comp_data = &comp_data,
+       done = std::move(done)](const absl::Status& status) {
+        std::unique_ptr<std::vector<Tensor>> comp_rets_releaser(comp_rets);
+        if (!status.ok()) {
+          VLOG(2) << "Component function execution failed: " << status;
+          const string function_and_msg = strings::StrCat(
+              errors::FormatFunctionForError(data->function_name_), " ",
+              status.message());
+          done(errors::CreateWithUpdatedMessage(status, function_and_msg));
+          return;
+        }
+        rets->resize(data->num_outputs_);
+        for (int i = 0; i < comp_rets->size(); ++i) {
+          (*rets)[comp_data->ret_indices[i]] = (*comp_rets)[i];
+        }
+        done(absl::OkStatus());
+      });
+}
+
 void ProcessFunctionLibraryRuntime::RunMultiDeviceAsync(
     const FunctionLibraryRuntime::Options& opts,
     FunctionLibraryRuntime::Handle outer_handle, std::vector<FunctionRet>* rets,
@@ -1384,6 +1495,16 @@ void ProcessFunctionLibraryRuntime::Run(
     FunctionLibraryRuntime::Handle handle, absl::Span<const Tensor> args,
     std::vector<Tensor>* rets,
     FunctionLibraryRuntime::DoneCallback done) const {
+  if (opts.rendezvous == nullptr && !opts.create_rendezvous) {
+    const MultiDeviceFunctionData* multi_device_data = IsMultiDevice(handle);
+    if (GetDirectPassComponent(multi_device_data) != nullptr) {
+      // The lone local component cannot touch a rendezvous, so skip creating
+      // the per-call rendezvous and pass the arguments through directly.
+      RunSingleComponentDirectAsync(opts, multi_device_data, args, rets,
+                                    std::move(done));
+      return;
+    }
+  }
   FunctionLibraryRuntime::Options new_opts = opts;
   tsl::core::RefCountPtr<Rendezvous> created_rendezvous = nullptr;
   if (!opts.rendezvous) {
@@ -1569,6 +1690,12 @@ absl::Status ProcessFunctionLibraryRuntime::RunSync(
     FunctionLibraryRuntime::Handle handle, absl::Span<const Tensor> args,
     std::vector<Tensor>* rets) const {
   MultiDeviceFunctionData* multi_device_data = IsMultiDevice(handle);
+  if (orig_opts.rendezvous == nullptr && !orig_opts.create_rendezvous &&
+      GetDirectPassComponent(multi_device_data) != nullptr) {
+    metrics::IncrementTestCounter("pflr_runsync", "direct");
+    return RunSingleComponentDirectSync(orig_opts, multi_device_data, args,
+                                        rets);
+  }
   if (multi_device_data && multi_device_data->enable_sync_execution) {
     metrics::IncrementTestCounter("pflr_runsync", "sync");
     FunctionLibraryRuntime::Options new_opts = orig_opts;
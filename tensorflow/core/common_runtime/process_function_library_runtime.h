@@ -435,6 +435,30 @@ class ProcessFunctionLibraryRuntime {
                                  InternalArgs* args)>
           get_component_args) const;
 
+  // Returns the lone component function of `data` if its arguments can be
+  // passed to its FunctionLibraryRuntime directly, i.e. the function
+  // partitioned into a single component that runs locally and cannot touch a
+  // rendezvous (no send/recv or async ops). Returns nullptr otherwise. Such
+  // calls skip the per-call rendezvous entirely.
+  const ComponentFunctionData* GetDirectPassComponent(
+      const MultiDeviceFunctionData* data) const;
+
+  // Runs the lone component function of `data` on its local
+  // FunctionLibraryRuntime, passing `args` through directly without creating
+  // a rendezvous.
+  // REQUIRES: GetDirectPassComponent(data) != nullptr.
+  absl::Status RunSingleComponentDirectSync(
+      const FunctionLibraryRuntime::Options& opts,
+      const MultiDeviceFunctionData* data, absl::Span<const Tensor> args,
+      std::vector<Tensor>* rets) const;
+
+  // Asynchronous counterpart of `RunSingleComponentDirectSync`.
+  void RunSingleComponentDirectAsync(
+      const FunctionLibraryRuntime::Options& opts,
+      const MultiDeviceFunctionData* data, absl::Span<const Tensor> args,
+      std::vector<Tensor>* rets,
+      FunctionLibraryRuntime::DoneCallback done) const;
+
   void RunMultiDeviceAsync(
       const FunctionLibraryRuntime::Options& opts,
       FunctionLibraryRuntime::Handle handle, std::vector<FunctionRet>* rets,
@@ -1130,6 +1130,21 @@ TEST_F(ProcessFunctionLibraryRuntimeTest, MultiDevice_CreateKernelsEagerly) {
   EXPECT_TRUE(errors::IsInternal(status));
 }
 
+TEST_F(ProcessFunctionLibraryRuntimeTest, MultiDevice_DirectPassSingleCpu) {
+  Init({test::function::XTimesTwo()});
+
+  // A function that partitions into a single local component with no
+  // send/recv ops takes the direct-pass argument path, which does not create
+  // a per-call rendezvous.
+  FunctionLibraryRuntime::Options opts;
+  auto x = test::AsTensor<float>({1, 2, 3, 4});
+  Tensor y;
+  TF_CHECK_OK(Run("XTimesTwo", opts, {{"T", DT_FLOAT}},
+                  MakeOptions("CPU:0", {"CPU:0"}, {"CPU:0"}), {x}, {&y}));
+  test::ExpectTensorEqual<float>(y, test::AsTensor<float>({2, 4, 6, 8}));
+  EXPECT_EQ(0, rendezvous_cache_->Size());
+}
+
 TEST_F(ProcessFunctionLibraryRuntimeTest, MultiDevice_StateHandle) {
   auto T = DT_INT32;
   // The expected sequence of outputs from this function is [6, 4, 0, 1, ...].
@@ -20,6 +20,7 @@ limitations under the License.
 #include <vector>
 
 #include "absl/base/call_once.h"
+#include "tensorflow/core/common_runtime/allocation_attribution.h"
 #include "tensorflow/core/common_runtime/bfc_allocator.h"
 #include "tensorflow/core/common_runtime/pool_allocator.h"
 #include "tensorflow/core/framework/allocator.h"
@@ -126,6 +127,11 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
       // at the cost of performance.
       allocator = new TrackingAllocator(allocator, true);
     }
+    if (AllocationAttributionIndex::IsEnabled()) {
+      // Wrap the allocator to attribute live allocations to the ops that
+      // made them, for OOM diagnosis in production builds.
+      allocator = new AttributionAllocator(allocator);
+    }
     cpu_allocators_.push_back(allocator);
     if (cpu_allocators_.size() < cpu_allocators_cache_.max_size()) {
       cpu_allocators_cache_[cpu_allocators_.size() - 1] = allocator;
@@ -138,6 +144,69 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
   return cpu_allocators_[numa_node];
 }
 
+namespace {
+
+// Routes each allocation to the per-NUMA-node CPU allocator of the calling
+// thread's node, and each deallocation back to the pool that owns the memory
+// (determined from the pointer's node affinity). Unbound threads use node 0.
+class NUMALocalCPUAllocator : public Allocator {
+ public:
+  NUMALocalCPUAllocator(ProcessState* process_state, int num_nodes)
+      : process_state_(process_state), num_nodes_(num_nodes) {}
+
+  string Name() override { return "numa_local_cpu"; }
+
+  void* AllocateRaw(size_t alignment, size_t num_bytes) override {
+    return AllocatorForNode(CurrentNode())->AllocateRaw(alignment, num_bytes);
+  }
+
+  void DeallocateRaw(void* ptr) override {
+    int numa_node = port::NUMAGetMemAffinity(ptr);
+    if (numa_node == port::kNUMANoAffinity) numa_node = CurrentNode();
+    AllocatorForNode(numa_node)->DeallocateRaw(ptr);
+  }
+
+  absl::optional<AllocatorStats> GetStats() override {
+    return AllocatorForNode(CurrentNode())->GetStats();
+  }
+
+  AllocatorMemoryType GetMemoryType() const override {
+    return AllocatorMemoryType::kHostPageable;
+  }
+
+ private:
+  int CurrentNode() const {
+    const int numa_node = port::NUMAGetThreadNodeAffinity();
+    return numa_node == port::kNUMANoAffinity ? 0 : numa_node % num_nodes_;
+  }
+
+  Allocator* AllocatorForNode(int numa_node) {
+    return process_state_->GetCPUAllocator(numa_node);
+  }
+
+  ProcessState* const process_state_;  // Not owned.
+  const int num_nodes_;
+};
+
+}  // namespace
+
+Allocator* ProcessState::GetNUMAAwareCPUAllocator() {
+  const int num_nodes = port::NUMANumNodes();
+  if (!numa_enabled_ || num_nodes <= 1) {
+    return GetCPUAllocator(port::kNUMANoAffinity);
+  }
+  // Materialize the per-node allocators eagerly so that the hot path always
+  // hits the lock-free cache in GetCPUAllocator.
+  for (int numa_node = 0; numa_node < num_nodes; ++numa_node) {
+    GetCPUAllocator(numa_node);
+  }
+  mutex_lock lock(mu_);
+  if (numa_aware_cpu_allocator_ == nullptr) {
+    numa_aware_cpu_allocator_ = new NUMALocalCPUAllocator(this, num_nodes);
+  }
+  return numa_aware_cpu_allocator_;
+}
+
 void ProcessState::AddCPUAllocVisitor(SubAllocator::Visitor visitor) {
   VLOG(1) << "AddCPUAllocVisitor";
   mutex_lock lock(mu_);
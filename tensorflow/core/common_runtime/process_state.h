@@ -66,6 +66,13 @@ class ProcessState : public ProcessStateInterface {
   // Treats numa_node == kNUMANoAffinity as numa_node == 0.
   Allocator* GetCPUAllocator(int numa_node) override;
 
+  // Returns an allocator that routes each allocation to the per-NUMA-node
+  // CPU allocator of the calling thread's node, so threads on different
+  // sockets draw from node-local pools instead of sharing one global region.
+  // Falls back to GetCPUAllocator(kNUMANoAffinity) when NUMA is disabled or
+  // the host has a single node.
+  Allocator* GetNUMAAwareCPUAllocator();
+
   // Registers alloc visitor for the CPU allocator(s).
   // REQUIRES: must be called before GetCPUAllocator.
   void AddCPUAllocVisitor(SubAllocator::Visitor v);
@@ -109,6 +116,9 @@ class ProcessState : public ProcessStateInterface {
   std::atomic<int> cpu_allocators_cached_;
   std::array<Allocator*, 8> cpu_allocators_cache_;
 
+  // Lazily created by GetNUMAAwareCPUAllocator. Never deleted.
+  Allocator* numa_aware_cpu_allocator_ TF_GUARDED_BY(mu_) = nullptr;
+
   // Optional RecordingAllocators that wrap the corresponding
   // Allocators for runtime attribute use analysis.
   MDMap mem_desc_map_;
@@ -35,12 +35,14 @@ PropagatorState::PropagatorState(const ImmutableExecutorState& immutable_state,
   // We assume root_frame_->frame_name.empty().
   root_frame_ = new FrameState(immutable_state_, 1);
   root_frame_->frame_id = 0;  // must be 0
+  root_frame_->entry_arena = &entry_arena_;
   root_frame_->InitializeFrameInfo(immutable_state_.get_root_frame_info());
 
   // Initialize iteration 0.
   root_frame_->SetIteration(
       0, new PropagatorState::IterationState(0, root_frame_->pending_counts,
-                                             root_frame_->total_input_tensors));
+                                             root_frame_->total_input_tensors,
+                                             &entry_arena_));
 
   outstanding_frames_.emplace(root_frame_->frame_id, root_frame_);
 }
@@ -285,13 +287,15 @@ void PropagatorState::FindOrCreateChildFrame(FrameState* frame,
   temp->frame_id = child_id;
   temp->parent_frame = frame;
   temp->parent_iter = iter_state;
+  temp->entry_arena = &entry_arena_;
   temp->InitializeFrameInfo(frame_info);
 
   // Initialize iteration 0.
   {
     mutex_lock l(temp->mu);
     temp->SetIteration(0, new IterationState(0, temp->pending_counts,
-                                             temp->total_input_tensors));
+                                             temp->total_input_tensors,
+                                             &entry_arena_));
   }
 
   {
@@ -752,9 +756,17 @@ PropagatorState::IterationState*
 PropagatorState::FrameState::IncrementIteration(TaggedNodeSeq* ready) {
   iteration_count++;
 
-  // Initialize the next iteration.
-  IterationState* next_iter =
-      new IterationState(iteration_count, pending_counts, total_input_tensors);
+  // Initialize the next iteration, recycling a retired iteration state when
+  // one is available so that loop-heavy graphs do not allocate per iteration.
+  IterationState* next_iter;
+  if (!iteration_freelist.empty()) {
+    next_iter = iteration_freelist.back();
+    iteration_freelist.pop_back();
+    next_iter->ResetForReuse(iteration_count, pending_counts);
+  } else {
+    next_iter = new IterationState(iteration_count, pending_counts,
+                                   total_input_tensors, entry_arena);
+  }
   SetIteration(iteration_count, next_iter);
   num_outstanding_iterations++;
   {
@@ -775,7 +787,8 @@ bool PropagatorState::FrameState::CleanupIterations(IterationState* iter_state,
                                                     TaggedNodeSeq* ready) {
   int64_t curr_iter = iter_state->iter_num;
   while (curr_iter <= iteration_count && IsIterationDone(iter_state)) {
-    delete iter_state;
+    // Keep the retired state for reuse by later iterations of this frame.
+    iteration_freelist.push_back(iter_state);
     SetIteration(curr_iter, nullptr);
     --num_outstanding_iterations;
     ++curr_iter;
@@ -23,6 +23,7 @@ limitations under the License.
 #include "tensorflow/core/common_runtime/pending_counts.h"
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/control_flow.h"
+#include "tensorflow/core/lib/core/arena.h"
 #include "tensorflow/core/lib/gtl/flatmap.h"
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/platform/env.h"
@@ -123,20 +124,83 @@ class PropagatorState {
   typedef absl::InlinedVector<TaggedNode, 8UL> TaggedNodeSeq;
 
  private:
+  // Thread-safe arena that backs the per-iteration `Entry` arrays for one
+  // step. Released arrays are recycled for subsequent iterations of the same
+  // size, so steady-state loop iteration turnover performs no heap
+  // allocations; the underlying blocks are freed wholesale when the
+  // propagator (and hence the step) is destroyed.
+  class EntryArena {
+   public:
+    EntryArena() : arena_(kBlockSize) {}
+
+    // Returns an array of `count` default-constructed entries.
+    Entry* AllocateEntries(int count) {
+      char* bytes = nullptr;
+      {
+        mutex_lock l(mu_);
+        auto it = free_lists_.find(count);
+        if (it != free_lists_.end() && !it->second.empty()) {
+          bytes = it->second.back();
+          it->second.pop_back();
+        } else {
+          bytes = arena_.AllocAligned(count * sizeof(Entry), alignof(Entry));
+        }
+      }
+      Entry* entries = reinterpret_cast<Entry*>(bytes);
+      for (int i = 0; i < count; ++i) new (&entries[i]) Entry;
+      return entries;
+    }
+
+    // Destroys `entries` in place and makes the storage available to later
+    // `AllocateEntries` calls of the same size.
+    void ReleaseEntries(Entry* entries, int count) {
+      for (int i = 0; i < count; ++i) entries[i].~Entry();
+      mutex_lock l(mu_);
+      free_lists_[count].push_back(reinterpret_cast<char*>(entries));
+    }
+
+   private:
+    static constexpr size_t kBlockSize = 256 * 1024;
+
+    mutex mu_;
+    core::Arena arena_ TF_GUARDED_BY(mu_);
+    // Recycled arrays, keyed by entry count. All iterations of a frame share
+    // one entry count, so reuse hits are the common case in loops.
+    gtl::FlatMap<int, std::vector<char*>> free_lists_ TF_GUARDED_BY(mu_);
+  };
+
   // The state of an iteration in a particular frame.
   struct IterationState {
     explicit IterationState(int64_t iter_num,
                             const PendingCounts* pending_counts,
-                            int total_input_tensors)
+                            int total_input_tensors, EntryArena* entry_arena)
         : iter_num(iter_num),
-          input_tensors(new Entry[total_input_tensors]),
+          input_tensors(entry_arena->AllocateEntries(total_input_tensors)),
+          num_input_tensors(total_input_tensors),
+          entry_arena(entry_arena),
           outstanding_ops(0),
           outstanding_frame_count(0),
           counts(*pending_counts) {  // Initialize with copy of *pending_counts
     }
 
-    const int64_t
-        iter_num;  // The index of this iteration in the enclosing loop.
+    // Re-initializes this object to represent iteration `next_iter_num` of
+    // the same frame, recycling the storage of a retired iteration.
+    // Equivalent to destruction followed by construction, minus the heap
+    // traffic: the Entry array cycles through the arena's free list and the
+    // pending counts buffer is reused in place.
+    void ResetForReuse(int64_t next_iter_num,
+                       const PendingCounts* pending_counts) {
+      entry_arena->ReleaseEntries(input_tensors, num_input_tensors);
+      input_tensors = entry_arena->AllocateEntries(num_input_tensors);
+      iter_num = next_iter_num;
+      outstanding_ops.store(0, std::memory_order_relaxed);
+      outstanding_frame_count = 0;
+      counts.CopyFrom(*pending_counts);
+    }
+
+    // The index of this iteration in the enclosing loop. Only mutated by
+    // `ResetForReuse` when a retired iteration state is recycled.
+    int64_t iter_num;
 
     // One copy per iteration. For iteration k, i-th node's j-th input is in
     // input_tensors[k][immutable_state_.nodes[i].input_start + j]. An entry is
@@ -148,6 +212,12 @@ class PropagatorState {
     // edge. The latter node is never run concurrently with the former node.
     Entry* input_tensors;
 
+    // The number of elements in `input_tensors`.
+    const int num_input_tensors;
+
+    // The arena that owns the storage of `input_tensors`.
+    EntryArena* const entry_arena;
+
     // The number of outstanding ops for each iteration.
     std::atomic<size_t> outstanding_ops;
 
@@ -206,7 +276,9 @@ class PropagatorState {
       return counts.adjust_for_activation_atomic(h, increment_dead);
     }
 
-    ~IterationState() { delete[] input_tensors; }
+    ~IterationState() {
+      entry_arena->ReleaseEntries(input_tensors, num_input_tensors);
+    }
 
    private:
     PendingCounts counts;
@@ -287,6 +359,11 @@ class PropagatorState {
     IterationState** const iterations_raw TF_GUARDED_BY(mu);
     IterationState* iterations_first TF_GUARDED_BY(mu);
 
+    // Retired iteration states available for reuse by `IncrementIteration`.
+    // Bounded by the number of iteration slots above.
+    absl::InlinedVector<IterationState*, 12UL> iteration_freelist
+        TF_GUARDED_BY(mu);
+
    public:
     // The NextIteration nodes to enter a new iteration. If the number of
     // outstanding iterations reaches the limit, we will defer the start of
@@ -312,6 +389,10 @@ class PropagatorState {
     int total_input_tensors = 0;
     std::vector<const NodeItem*>* nodes = nullptr;
 
+    // The step-wide arena backing the `Entry` arrays of this frame's
+    // iterations. Owned by the `PropagatorState`.
+    EntryArena* entry_arena = nullptr;
+
     // Lock ordering: ExecutorState.mu_ < mu < iter_mu;
     // during structured traversal: parent_frame->mu < mu.
     mutex mu;
@@ -419,6 +500,9 @@ class PropagatorState {
         delete iterations[i];
         iterations[i] = nullptr;
       }
+      for (IterationState* iteration : iteration_freelist) {
+        delete iteration;
+      }
     }
 
    private:
@@ -533,6 +617,10 @@ class PropagatorState {
   const int64_t step_id_;
   const bool vlog_;
 
+  // Backs the `Entry` arrays of all iterations in this step. Must outlive all
+  // frames, which hold pointers to it.
+  EntryArena entry_arena_;
+
   mutex mu_;
 
   // The root frame in which the execution of this step is started.
@@ -15,6 +15,7 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/rendezvous_mgr.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 #include "tensorflow/core/common_runtime/copy_tensor.h"
@@ -35,6 +36,16 @@ limitations under the License.
 namespace tensorflow {
 
 namespace {
+
+// Minimum number of buckets in the LocalRendezvous table. Sharding by device
+// count alone leaves a single bucket on one-device hosts, so send/recv-heavy
+// graphs serialize on one lock even when every transfer uses a distinct key.
+constexpr int kMinRendezvousShards = 16;
+
+int NumRendezvousShards(const DeviceMgr* device_mgr) {
+  return std::max(device_mgr->NumDevices(), kMinRendezvousShards);
+}
+
 void SameWorkerRecvDone(const DeviceMgr* device_mgr,
                         const Rendezvous::ParsedKey& parsed,
                         const Rendezvous::Args& send_args,
@@ -169,7 +180,7 @@ void IntraProcessRecvAsyncImpl(const DeviceMgr* device_mgr,
 RefCountedIntraProcessRendezvous::RefCountedIntraProcessRendezvous(
     const DeviceMgr* device_mgr)
     : device_mgr_(device_mgr),
-      local_(this, /* num_shards= */ device_mgr->NumDevices()) {}
+      local_(this, /* num_shards= */ NumRendezvousShards(device_mgr)) {}
 
 RefCountedIntraProcessRendezvous::~RefCountedIntraProcessRendezvous() {
   VLOG(5) << "Destructor of IntraProcessRendezvous: " << this;
@@ -201,7 +212,7 @@ absl::Status RefCountedIntraProcessRendezvous::GetLocalRendezvousStatus() {
 PrivateIntraProcessRendezvous::PrivateIntraProcessRendezvous(
     const DeviceMgr* device_mgr)
     : device_mgr_(device_mgr),
-      local_(nullptr, /* num_shards= */ device_mgr->NumDevices()) {}
+      local_(nullptr, /* num_shards= */ NumRendezvousShards(device_mgr)) {}
 
 PrivateIntraProcessRendezvous::~PrivateIntraProcessRendezvous() {}
 
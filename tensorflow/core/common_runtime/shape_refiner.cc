@@ -21,19 +21,31 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/strings/escaping.h"
 #include "tensorflow/core/common_runtime/eval_const_tensor.h"
 #include "tensorflow/core/common_runtime/function_utils.h"
 #include "tensorflow/core/common_runtime/graph_constructor.h"
 #include "tensorflow/core/framework/bounds_check.h"
 #include "tensorflow/core/framework/common_shape_fns.h"
 #include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/framework/node_def_util.h"
 #include "tensorflow/core/framework/shape_inference.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/tensor_shape.pb.h"
 #include "tensorflow/core/framework/versions.pb.h"
 #include "tensorflow/core/graph/algorithm.h"
 #include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/numbers.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tsl/platform/statusor.h"
 
 namespace tensorflow {
@@ -64,6 +76,167 @@ namespace {
 constexpr char kArgOp[] = "_Arg";
 constexpr char kRetvalOp[] = "_Retval";
 
+// Process-wide memoization of per-node shape inference results.
+//
+// The cache key fingerprints everything a shape function may observe for the
+// cacheable subset of nodes: the op type, its attributes, the graph-def
+// version, and the inferred shapes of its inputs. Nodes whose inference
+// depends on anything else — function calls, resource/variant handle data, or
+// constant input values requested via input_tensor() — are never cached.
+//
+// Enabled by pointing TF_SHAPE_INFERENCE_CACHE_DIR at a writable directory.
+// Entries are loaded from that directory on first use and persisted at
+// process exit, so repeated imports of identical graphs, including imports in
+// other processes, skip re-running the shape functions.
+class ShapeInferenceCache {
+ public:
+  // Returns the process-wide cache, or nullptr when the cache is disabled.
+  static ShapeInferenceCache* Get() {
+    static const string* const dir = [] {
+      string d;
+      absl::Status status =
+          ReadStringFromEnvVar("TF_SHAPE_INFERENCE_CACHE_DIR", "", &d);
+      if (!status.ok()) {
+        LOG(ERROR) << status.message();
+      }
+      return new string(d);
+    }();
+    if (dir->empty()) return nullptr;
+    static ShapeInferenceCache cache(*dir);
+    return &cache;
+  }
+
+  // If `key` is present and compatible with `c`, sets the output shapes of
+  // `c` from the cached entry and returns true.
+  bool Lookup(uint64 key, InferenceContext* c) {
+    std::vector<TensorShapeProto> shapes;
+    {
+      mutex_lock l(mu_);
+      auto it = entries_.find(key);
+      if (it == entries_.end()) return false;
+      shapes = it->second;
+    }
+    if (static_cast<int>(shapes.size()) != c->num_outputs()) return false;
+    for (int i = 0; i < c->num_outputs(); ++i) {
+      ShapeHandle shape;
+      if (!c->MakeShapeFromShapeProto(shapes[i], &shape).ok()) return false;
+      c->set_output(i, shape);
+    }
+    return true;
+  }
+
+  void Insert(uint64 key, InferenceContext* c) {
+    std::vector<TensorShapeProto> shapes(c->num_outputs());
+    for (int i = 0; i < c->num_outputs(); ++i) {
+      c->ShapeHandleToProto(c->output(i), &shapes[i]);
+    }
+    mutex_lock l(mu_);
+    entries_.emplace(key, std::move(shapes));
+    dirty_ = true;
+  }
+
+ private:
+  explicit ShapeInferenceCache(const string& dir)
+      : path_(io::JoinPath(dir, "shape_inference_cache")) {
+    Merge(&entries_);
+    VLOG(1) << "Loaded " << entries_.size()
+            << " shape inference cache entries from " << path_;
+  }
+
+  // Persists the entries at process exit. Concurrent writers race on the
+  // shared file, but processes importing identical graphs produce identical
+  // entries, so a lost update only costs re-inference next time.
+  ~ShapeInferenceCache() {
+    mutex_lock l(mu_);
+    if (!dirty_) return;
+    Merge(&entries_);
+    string contents;
+    for (const auto& entry : entries_) {
+      strings::StrAppend(&contents, entry.first);
+      for (const TensorShapeProto& shape : entry.second) {
+        strings::StrAppend(&contents, "\t",
+                           absl::BytesToHexString(shape.SerializeAsString()));
+      }
+      strings::StrAppend(&contents, "\n");
+    }
+    absl::Status status = WriteStringToFile(Env::Default(), path_, contents);
+    if (!status.ok()) {
+      VLOG(1) << "Failed to write shape inference cache: " << status;
+    }
+  }
+
+  // Folds the entries currently on disk into `entries`, keeping existing
+  // in-memory entries on key collisions. Malformed lines are skipped.
+  void Merge(absl::flat_hash_map<uint64, std::vector<TensorShapeProto>>*
+                 entries) const {
+    string contents;
+    if (!ReadFileToString(Env::Default(), path_, &contents).ok()) return;
+    for (const string& line : str_util::Split(contents, '\n')) {
+      if (line.empty()) continue;
+      const std::vector<string> fields = str_util::Split(line, '\t');
+      uint64 key;
+      if (!strings::safe_strtou64(fields[0], &key)) continue;
+      std::vector<TensorShapeProto> shapes(fields.size() - 1);
+      bool ok = true;
+      for (size_t i = 1; i < fields.size(); ++i) {
+        if (!shapes[i - 1].ParseFromString(
+                absl::HexStringToBytes(fields[i]))) {
+          ok = false;
+          break;
+        }
+      }
+      if (ok) entries->emplace(key, std::move(shapes));
+    }
+  }
+
+  const string path_;
+  mutex mu_;
+  absl::flat_hash_map<uint64, std::vector<TensorShapeProto>> entries_
+      TF_GUARDED_BY(mu_);
+  bool dirty_ TF_GUARDED_BY(mu_) = false;
+};
+
+// Whether shape inference for `node` observes only what the cache key above
+// captures. Must hold before a lookup or an insert is attempted.
+bool CacheEligible(const FunctionLibraryDefinition* flib, const Node* node,
+                   const OpRegistrationData* op_reg_data,
+                   InferenceContext* c) {
+  if (op_reg_data->shape_inference_fn == nullptr) return false;
+  if (flib != nullptr && IsFunctionCall(*flib, *node)) return false;
+  for (int i = 0; i < c->num_inputs(); ++i) {
+    if (c->input_handle_shapes_and_types(i) != nullptr) return false;
+  }
+  return true;
+}
+
+// Whether a finished inference produced a result the cache can represent:
+// no constant input values were consulted and no handle data was emitted.
+bool CacheableResult(InferenceContext* c) {
+  for (int i = 0; i < c->num_inputs(); ++i) {
+    if (c->requested_input_tensor(i) ||
+        c->requested_input_tensor_as_partial_shape(i)) {
+      return false;
+    }
+  }
+  for (int i = 0; i < c->num_outputs(); ++i) {
+    if (c->output_handle_shapes_and_types(i) != nullptr) return false;
+  }
+  return true;
+}
+
+uint64 NodeShapeKey(const Node* node, int graph_def_version,
+                    InferenceContext* c) {
+  uint64 fp = Fingerprint64(node->type_string());
+  fp = FingerprintCat64(fp, graph_def_version);
+  fp = FingerprintCat64(fp, Fingerprint64(SummarizeAttrs(node->def())));
+  for (int i = 0; i < c->num_inputs(); ++i) {
+    TensorShapeProto proto;
+    c->ShapeHandleToProto(c->input(i), &proto);
+    fp = FingerprintCat64(fp, Fingerprint64(proto.SerializeAsString()));
+  }
+  return fp;
+}
+
 }  // namespace
 
 // Runs shape inference for the given node using the given ShapeRefiner.
@@ -263,9 +436,29 @@ absl::Status ShapeRefiner::AddNodeInternal(
         "', did you forget to define it?");
   }
 
+  // Serve the result from the shape inference cache when possible.
+  ShapeInferenceCache* cache = ShapeInferenceCache::Get();
+  uint64 cache_key = 0;
+  bool cache_eligible = false;
+  if (cache != nullptr) {
+    cache_eligible =
+        CacheEligible(function_library_, node, op_reg_data, ic.get());
+    if (cache_eligible) {
+      cache_key = NodeShapeKey(node, graph_def_version_, ic.get());
+      if (cache->Lookup(cache_key, ic.get())) {
+        node_to_context_[node].swap(ic);
+        return absl::OkStatus();
+      }
+    }
+  }
+
   // Run the shape inference function, and return if there was an error.
   TF_RETURN_IF_ERROR(RunShapeFn(node, op_reg_data, ic.get(), outer_context));
 
+  if (cache_eligible && CacheableResult(ic.get())) {
+    cache->Insert(cache_key, ic.get());
+  }
+
   // Store the resulting context object in the map.
   node_to_context_[node].swap(ic);
 
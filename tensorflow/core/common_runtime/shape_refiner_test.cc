@@ -151,6 +151,27 @@ TEST_F(ShapeRefinerTest, MatMul) {
   EXPECT_SHAPE("[2,2]", m, mm, 0);
 }
 
+TEST_F(ShapeRefinerTest, ShapeInferenceCache) {
+  // Run the same graph through two refiners with the cache enabled; the
+  // second import is served from the cache and must infer identical shapes.
+  setenv("TF_SHAPE_INFERENCE_CACHE_DIR", testing::TmpDir().c_str(), 1);
+
+  Scope root = Scope::NewRootScope();
+  auto a = ops::Const(root, {{1.0f}, {2.0f}});
+  auto b = ops::Const(root, {{1.0f, 2.0f}});
+  auto mm = ops::MatMul(root, a, b);
+
+  for (int pass = 0; pass < 2; ++pass) {
+    ShapeRefiner m(TF_GRAPH_DEF_VERSION, OpRegistry::Global());
+    TF_ASSERT_OK(m.AddNode(a.node()));
+    TF_ASSERT_OK(m.AddNode(b.node()));
+    TF_ASSERT_OK(m.AddNode(mm.node()));
+    EXPECT_SHAPE("[2,2]", m, mm, 0);
+  }
+
+  unsetenv("TF_SHAPE_INFERENCE_CACHE_DIR");
+}
+
 TEST_F(ShapeRefinerTest, BadShapes) {
   ShapeRefiner m(TF_GRAPH_DEF_VERSION, OpRegistry::Global());
   Scope root = Scope::NewRootScope();
@@ -0,0 +1,96 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/shared_kernel_cache.h"
+
+#include <memory>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/util/env_var.h"
+
+namespace tensorflow {
+
+/* static */ SharedKernelCache* SharedKernelCache::Global() {
+  static SharedKernelCache* cache = new SharedKernelCache;
+  return cache;
+}
+
+/* static */ bool SharedKernelCache::Enabled() {
+  static const bool enabled = [] {
+    bool enable = false;
+    absl::Status s =
+        ReadBoolFromEnvVar("TF_SHARED_KERNEL_CACHE", false, &enable);
+    if (!s.ok()) {
+      LOG(ERROR) << "SharedKernelCache: " << s.message();
+    }
+    return enable;
+  }();
+  return enabled;
+}
+
+/* static */ bool SharedKernelCache::Eligible(
+    const std::shared_ptr<const NodeProperties>& props,
+    FunctionLibraryRuntime* flib) {
+  if (!Enabled()) return false;
+  if (props->op_def == nullptr || props->op_def->is_stateful()) return false;
+  const string& op = props->node_def.op();
+  // Function-call and functional control-flow kernels hold handles into a
+  // session's function library and must not be shared.
+  static const auto* const kFunctionCallOps = new absl::flat_hash_set<string>(
+      {"PartitionedCall", "StatefulPartitionedCall", "SymbolicGradient",
+       "RemoteCall", "While", "StatelessWhile", "If", "StatelessIf", "Case",
+       "StatelessCase", "For"});
+  if (kFunctionCallOps->contains(op)) return false;
+  if (flib != nullptr &&
+      flib->GetFunctionLibraryDefinition()->Contains(op)) {
+    return false;
+  }
+  return true;
+}
+
+absl::Status SharedKernelCache::FindOrCreate(
+    const string& device_name,
+    const std::shared_ptr<const NodeProperties>& props, int graph_def_version,
+    const std::function<absl::Status(OpKernel**)>& create_fn,
+    OpKernel** kernel) {
+  const uint64 fingerprint =
+      Fingerprint64(props->node_def.SerializeAsString());
+  const string key =
+      strings::StrCat(device_name, "/", graph_def_version, "/", fingerprint);
+  mutex_lock l(mu_);
+  auto it = kernels_.find(key);
+  if (it == kernels_.end()) {
+    OpKernel* created = nullptr;
+    TF_RETURN_IF_ERROR(create_fn(&created));
+    it = kernels_.emplace(key, absl::WrapUnique(created)).first;
+    owned_.insert(created);
+  }
+  *kernel = it->second.get();
+  return absl::OkStatus();
+}
+
+bool SharedKernelCache::Owns(const OpKernel* kernel) const {
+  // When sharing is disabled the cache is always empty; skip the lock so
+  // that per-kernel deleters on the default path stay uncontended.
+  if (!Enabled()) return false;
+  mutex_lock l(mu_);
+  return owned_.contains(kernel);
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,89 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_SHARED_KERNEL_CACHE_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_SHARED_KERNEL_CACHE_H_
+
+#include <functional>
+#include <memory>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "tensorflow/core/framework/function.h"
+#include "tensorflow/core/framework/node_properties.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/status.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// A process-wide cache of instantiated OpKernels, keyed by the fingerprint of
+// the node definition plus the device. Lets sessions created from
+// byte-identical GraphDefs (e.g. A/B variants of one serving model) share
+// stateless kernels instead of re-instantiating them per session.
+//
+// Only kernels that are safe to share are cached: the op must be stateless
+// and must not be a function call (function kernels hold handles into a
+// session's FunctionLibraryRuntime). Sharing is off by default and enabled
+// with the TF_SHARED_KERNEL_CACHE environment variable.
+//
+// Cached kernels are owned by the cache for the lifetime of the process,
+// mirroring OpSegment's ownership model for session-owned kernels.
+class SharedKernelCache {
+ public:
+  static SharedKernelCache* Global();
+
+  // Returns true if kernel sharing is enabled via TF_SHARED_KERNEL_CACHE.
+  // The environment variable is read once and cached.
+  static bool Enabled();
+
+  // Returns true if kernel sharing is enabled and `props` describes an op
+  // that is safe to share across sessions.
+  static bool Eligible(const std::shared_ptr<const NodeProperties>& props,
+                       FunctionLibraryRuntime* flib);
+
+  // Returns in `*kernel` the cached kernel for (device_name, props,
+  // graph_def_version), invoking `create_fn` to instantiate it on a miss.
+  // The cache retains ownership of the kernel.
+  absl::Status FindOrCreate(
+      const string& device_name,
+      const std::shared_ptr<const NodeProperties>& props,
+      int graph_def_version,
+      const std::function<absl::Status(OpKernel**)>& create_fn,
+      OpKernel** kernel);
+
+  // Returns true if `kernel` is owned by the cache, in which case the caller
+  // must not delete it. Returns false without taking the cache's lock when
+  // sharing is disabled, so kernel deleters on the default path never
+  // serialize on the process-global mutex.
+  bool Owns(const OpKernel* kernel) const;
+
+ private:
+  SharedKernelCache() = default;
+
+  mutable mutex mu_;
+  absl::flat_hash_map<string, std::unique_ptr<OpKernel>> kernels_
+      TF_GUARDED_BY(mu_);
+  absl::flat_hash_set<const OpKernel*> owned_ TF_GUARDED_BY(mu_);
+
+  SharedKernelCache(const SharedKernelCache&) = delete;
+  void operator=(const SharedKernelCache&) = delete;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_SHARED_KERNEL_CACHE_H_
@@ -44,6 +44,11 @@ class ThreadPoolDeviceFactory : public DeviceFactory {
     if (iter != options.config.device_count().end()) {
       n = iter->second;
     }
+    if (options.config.experimental().use_numa_affinity()) {
+      // Must precede the first GetCPUAllocator call, otherwise ProcessState
+      // creates a single node-agnostic allocator pool.
+      ProcessState::singleton()->EnableNUMA();
+    }
     for (int i = 0; i < n; i++) {
       string name = strings::StrCat(name_prefix, "/device:CPU:", i);
       std::unique_ptr<ThreadPoolDevice> tpd;
@@ -57,9 +62,15 @@ class ThreadPoolDeviceFactory : public DeviceFactory {
         }
         DeviceLocality dev_locality;
         dev_locality.set_numa_node(numa_node);
+        // With a single CPU device on a multi-node host, route allocations to
+        // the pool of the calling thread's node; with one device per node,
+        // bind each device to its node's pool.
+        Allocator* allocator =
+            (n == 1 && num_numa_nodes > 1)
+                ? ProcessState::singleton()->GetNUMAAwareCPUAllocator()
+                : ProcessState::singleton()->GetCPUAllocator(numa_node);
         tpd = std::make_unique<ThreadPoolDevice>(
-            options, name, Bytes(256 << 20), dev_locality,
-            ProcessState::singleton()->GetCPUAllocator(numa_node));
+            options, name, Bytes(256 << 20), dev_locality, allocator);
       } else {
         tpd = std::make_unique<ThreadPoolDevice>(
             options, name, Bytes(256 << 20), DeviceLocality(),
@@ -23,11 +23,15 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "tensorflow/core/framework/full_type.pb.h"
 #include "tensorflow/core/framework/full_type_util.h"
 #include "tensorflow/core/framework/op_def_builder.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
 #include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/util/dump_graph.h"
 
 namespace tensorflow {
@@ -125,6 +129,63 @@ absl::Status update_inferred_type(Node* target, const FullTypeDef& t,
   return absl::OkStatus();
 }
 
+// Memoized solutions of the pass, keyed by graph fingerprint. Function bodies
+// are instantiated as separate graphs, and large models commonly contain
+// hundreds of instantiations of the same function; memoization lets repeated
+// runs apply the previously inferred types by table lookup instead of
+// re-running fixed-point iteration.
+struct TypeSolutionCache {
+  // Bounds the memory retained by the cache; entries beyond this are simply
+  // not recorded.
+  static constexpr size_t kMaxSolutions = 1024;
+
+  mutex mu;
+  // Maps graph fingerprint to the (node name, inferred type) pairs the pass
+  // produced for that graph.
+  absl::flat_hash_map<uint64, std::vector<std::pair<string, FullTypeDef>>>
+      solutions TF_GUARDED_BY(mu);
+};
+
+TypeSolutionCache* GetTypeSolutionCache() {
+  static TypeSolutionCache* cache = new TypeSolutionCache();
+  return cache;
+}
+
+// Fingerprints the type-relevant state of `g`: every op node's full
+// definition, which covers ops, attrs, connectivity and any pre-existing type
+// annotations.
+uint64 GraphFingerprint(const Graph& g) {
+  uint64 fp = Fingerprint64("type_inference");
+  for (const Node* n : g.op_nodes()) {
+    string serialized;
+    SerializeToStringDeterministic(n->def(), &serialized);
+    fp = FingerprintCat64(fp, Fingerprint64(serialized));
+  }
+  return fp;
+}
+
+// Applies a memoized solution to `g`. Returns false if some recorded node
+// name is missing from the graph (i.e. a fingerprint collision), in which
+// case the graph is left partially annotated and the caller must run the full
+// pass to reach the correct fixed point.
+bool ApplyTypeSolution(
+    const std::vector<std::pair<string, FullTypeDef>>& solution, Graph* g) {
+  absl::flat_hash_map<absl::string_view, Node*> nodes_by_name;
+  nodes_by_name.reserve(g->num_nodes());
+  for (Node* n : g->nodes()) {
+    nodes_by_name.emplace(n->name(), n);
+  }
+  for (const auto& name_and_type : solution) {
+    auto it = nodes_by_name.find(name_and_type.first);
+    if (it == nodes_by_name.end()) {
+      return false;
+    }
+    *(it->second->mutable_def()->mutable_experimental_type()) =
+        name_and_type.second;
+  }
+  return true;
+}
+
 absl::StatusOr<FullTypeDef> run_inference(const string& fn_name,
                                           const TypeRefVector& in_types) {
   // TODO(b/224776031): Things remaining to implement:
@@ -156,6 +217,31 @@ absl::Status TypeInferencePass::Run(
     n->UpdateProperties();
   }
 
+  // If an identical graph has already been through the pass, reuse its
+  // solution instead of re-running fixed-point iteration.
+  TypeSolutionCache* solution_cache = GetTypeSolutionCache();
+  const uint64 fingerprint = GraphFingerprint(*g);
+  {
+    std::vector<std::pair<string, FullTypeDef>> solution;
+    bool have_solution = false;
+    {
+      mutex_lock l(solution_cache->mu);
+      auto it = solution_cache->solutions.find(fingerprint);
+      if (it != solution_cache->solutions.end()) {
+        solution = it->second;
+        have_solution = true;
+      }
+    }
+    if (have_solution && ApplyTypeSolution(solution, g)) {
+      VLOG(1) << "Reusing memoized type solution for fingerprint "
+              << fingerprint;
+      if (VLOG_IS_ON(1)) {
+        DumpGraphToFile("forward_type_inference_after", *g, flib_def);
+      }
+      return absl::OkStatus();
+    }
+  }
+
   // Cache type inference functions, to avoid repeated flib_def lookups.
   ForwardInferMap forward;
   ReverseInferMap reverse;
@@ -329,6 +415,21 @@ absl::Status TypeInferencePass::Run(
     DumpGraphToFile("forward_type_inference_after", *g, flib_def);
   }
 
+  // Record the solution so that future instantiations of the same graph can
+  // skip the fixed-point iteration above.
+  std::vector<std::pair<string, FullTypeDef>> solution;
+  for (const Node* n : g->op_nodes()) {
+    if (n->def().has_experimental_type()) {
+      solution.emplace_back(n->name(), n->def().experimental_type());
+    }
+  }
+  {
+    mutex_lock l(solution_cache->mu);
+    if (solution_cache->solutions.size() < TypeSolutionCache::kMaxSolutions) {
+      solution_cache->solutions.emplace(fingerprint, std::move(solution));
+    }
+  }
+
   return absl::OkStatus();
 }
 
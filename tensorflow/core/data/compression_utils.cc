@@ -15,11 +15,15 @@ limitations under the License.
 #include "tensorflow/core/data/compression_utils.h"
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "dictBuilder/zdict.h"
+#include "zstd.h"
 #include "tensorflow/core/common_runtime/dma_helper.h"
 #include "tensorflow/core/framework/dataset.pb.h"
 #include "tensorflow/core/framework/tensor.pb.h"
@@ -39,6 +43,12 @@ namespace {
 // version.
 constexpr int kCompressedElementVersion = 0;
 
+// Elements whose `data` is a zstd frame rather than snappy-compressed bytes,
+// produced by `ZstdCompressElement`. The frame may have been compressed with
+// a dictionary, in which case the same dictionary must be passed to
+// `UncompressElement`.
+constexpr int kZstdCompressedElementVersion = 1;
+
 }  // namespace
 
 class Iov {
@@ -64,8 +74,14 @@ class Iov {
   size_t num_bytes_;
 };
 
-absl::Status CompressElement(const std::vector<Tensor>& element,
-                             CompressedElement* out) {
+namespace {
+
+// Gathers the tensor data of `element` into an iov array and fills out the
+// per-component metadata of `out`. `nonmemcpyable` backs the iov entries for
+// serialized tensors and must outlive `*iov`.
+absl::Status BuildElementIov(const std::vector<Tensor>& element,
+                             CompressedElement* out, tstring* nonmemcpyable,
+                             std::unique_ptr<Iov>* iov_out) {
   // First pass: preprocess the non`memcpy`able tensors.
   size_t num_string_tensors = 0;
   size_t num_string_tensor_strings = 0;
@@ -89,10 +105,11 @@ absl::Status CompressElement(const std::vector<Tensor>& element,
   // string).
   // - All other tensors are serialized and copied into a string (a `tstring`
   // for access to `resize_unitialized`).
-  Iov iov{element.size() + num_string_tensor_strings - num_string_tensors};
-  tstring nonmemcpyable;
-  nonmemcpyable.resize_uninitialized(total_nonmemcpyable_size);
-  char* nonmemcpyable_pos = nonmemcpyable.mdata();
+  iov_out->reset(
+      new Iov(element.size() + num_string_tensor_strings - num_string_tensors));
+  Iov& iov = **iov_out;
+  nonmemcpyable->resize_uninitialized(total_nonmemcpyable_size);
+  char* nonmemcpyable_pos = nonmemcpyable->mdata();
   int nonmemcpyable_component_index = 0;
   for (int i = 0; i < element.size(); ++i) {
     const auto& component = element[i];
@@ -122,25 +139,239 @@ absl::Status CompressElement(const std::vector<Tensor>& element,
       metadata->add_uncompressed_bytes(proto.ByteSizeLong());
     }
   }
+  return absl::OkStatus();
+}
+
+// Per-thread zstd compression state. Contexts are expensive to create
+// relative to compressing a small element, so each thread keeps one and
+// reuses it across elements; digested dictionaries are likewise cached and
+// only rebuilt when the dictionary bytes or level change.
+class ZstdCompressor {
+ public:
+  static ZstdCompressor& Get() {
+    static thread_local ZstdCompressor* compressor = new ZstdCompressor;
+    return *compressor;
+  }
+
+  absl::Status Compress(Iov& iov, int compression_level,
+                        absl::string_view dictionary, std::string* out) {
+    if (cctx_ == nullptr) {
+      return errors::Internal("Failed to create zstd compression context.");
+    }
+    ZSTD_CCtx_reset(cctx_, ZSTD_reset_session_and_parameters);
+    ZSTD_CCtx_setParameter(cctx_, ZSTD_c_compressionLevel, compression_level);
+    if (!dictionary.empty()) {
+      if (cdict_ == nullptr || dictionary != dictionary_ ||
+          compression_level != dictionary_level_) {
+        ZSTD_freeCDict(cdict_);
+        cdict_ = ZSTD_createCDict(dictionary.data(), dictionary.size(),
+                                  compression_level);
+        if (cdict_ == nullptr) {
+          return errors::Internal("Failed to digest zstd dictionary.");
+        }
+        dictionary_ = std::string(dictionary);
+        dictionary_level_ = compression_level;
+      }
+      const size_t ret = ZSTD_CCtx_refCDict(cctx_, cdict_);
+      if (ZSTD_isError(ret)) {
+        return errors::Internal("Failed to reference zstd dictionary: ",
+                                ZSTD_getErrorName(ret));
+      }
+    }
 
-  if (iov.NumBytes() > kuint32max) {
+    out->resize(ZSTD_compressBound(iov.NumBytes()));
+    ZSTD_outBuffer output = {&(*out)[0], out->size(), 0};
+    // Stream the iov pieces through the context so scattered tensor data
+    // need not be copied into a contiguous input buffer first.
+    for (size_t i = 0; i < iov.NumPieces(); ++i) {
+      ZSTD_inBuffer input = {iov.Data()[i].iov_base, iov.Data()[i].iov_len, 0};
+      const ZSTD_EndDirective mode =
+          (i + 1 == iov.NumPieces()) ? ZSTD_e_end : ZSTD_e_continue;
+      size_t remaining;
+      do {
+        remaining = ZSTD_compressStream2(cctx_, &output, &input, mode);
+        if (ZSTD_isError(remaining)) {
+          return errors::Internal("Failed to compress using zstd: ",
+                                  ZSTD_getErrorName(remaining));
+        }
+      } while (mode == ZSTD_e_end ? remaining != 0 : input.pos < input.size);
+    }
+    if (iov.NumPieces() == 0) {
+      ZSTD_inBuffer input = {nullptr, 0, 0};
+      size_t remaining;
+      do {
+        remaining = ZSTD_compressStream2(cctx_, &output, &input, ZSTD_e_end);
+        if (ZSTD_isError(remaining)) {
+          return errors::Internal("Failed to compress using zstd: ",
+                                  ZSTD_getErrorName(remaining));
+        }
+      } while (remaining != 0);
+    }
+    out->resize(output.pos);
+    return absl::OkStatus();
+  }
+
+ private:
+  ZstdCompressor() : cctx_(ZSTD_createCCtx()) {}
+
+  ZSTD_CCtx* const cctx_;
+  ZSTD_CDict* cdict_ = nullptr;
+  std::string dictionary_;
+  int dictionary_level_ = 0;
+};
+
+// Per-thread zstd decompression state; see ZstdCompressor.
+class ZstdDecompressor {
+ public:
+  static ZstdDecompressor& Get() {
+    static thread_local ZstdDecompressor* decompressor = new ZstdDecompressor;
+    return *decompressor;
+  }
+
+  absl::Status Decompress(const std::string& data, Iov& iov,
+                          absl::string_view dictionary) {
+    if (dctx_ == nullptr) {
+      return errors::Internal("Failed to create zstd decompression context.");
+    }
+    ZSTD_DCtx_reset(dctx_, ZSTD_reset_session_and_parameters);
+    if (!dictionary.empty()) {
+      if (ddict_ == nullptr || dictionary != dictionary_) {
+        ZSTD_freeDDict(ddict_);
+        ddict_ = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (ddict_ == nullptr) {
+          return errors::Internal("Failed to digest zstd dictionary.");
+        }
+        dictionary_ = std::string(dictionary);
+      }
+      const size_t ret = ZSTD_DCtx_refDDict(dctx_, ddict_);
+      if (ZSTD_isError(ret)) {
+        return errors::Internal("Failed to reference zstd dictionary: ",
+                                ZSTD_getErrorName(ret));
+      }
+    }
+
+    ZSTD_inBuffer input = {data.data(), data.size(), 0};
+    size_t ret = 1;
+    for (size_t i = 0; i < iov.NumPieces(); ++i) {
+      ZSTD_outBuffer output = {iov.Data()[i].iov_base, iov.Data()[i].iov_len,
+                               0};
+      while (output.pos < output.size) {
+        ret = ZSTD_decompressStream(dctx_, &output, &input);
+        if (ZSTD_isError(ret)) {
+          return errors::Internal("Failed to perform zstd decompression: ",
+                                  ZSTD_getErrorName(ret));
+        }
+        if ((ret == 0 || input.pos == input.size) &&
+            output.pos < output.size) {
+          return errors::Internal(
+              "Zstd data ended before filling the uncompressed size the "
+              "tensor metadata suggests.");
+        }
+      }
+    }
+    if (iov.NumPieces() == 0) {
+      // Consume the (empty) frame so the completeness check below holds.
+      ZSTD_outBuffer output = {nullptr, 0, 0};
+      ret = ZSTD_decompressStream(dctx_, &output, &input);
+      if (ZSTD_isError(ret)) {
+        return errors::Internal("Failed to perform zstd decompression: ",
+                                ZSTD_getErrorName(ret));
+      }
+    }
+    if (ret != 0 || input.pos != input.size) {
+      return errors::Internal(
+          "Uncompressed size mismatch between the zstd frame and the tensor "
+          "metadata.");
+    }
+    return absl::OkStatus();
+  }
+
+ private:
+  ZstdDecompressor() : dctx_(ZSTD_createDCtx()) {}
+
+  ZSTD_DCtx* const dctx_;
+  ZSTD_DDict* ddict_ = nullptr;
+  std::string dictionary_;
+};
+
+}  // namespace
+
+absl::Status CompressElement(const std::vector<Tensor>& element,
+                             CompressedElement* out) {
+  tstring nonmemcpyable;
+  std::unique_ptr<Iov> iov;
+  TF_RETURN_IF_ERROR(BuildElementIov(element, out, &nonmemcpyable, &iov));
+
+  if (iov->NumBytes() > kuint32max) {
     return errors::OutOfRange("Encountered dataset element of size ",
-                              iov.NumBytes(),
+                              iov->NumBytes(),
                               ", exceeding the 4GB Snappy limit.");
   }
-  if (!port::Snappy_CompressFromIOVec(iov.Data(), iov.NumBytes(),
+  if (!port::Snappy_CompressFromIOVec(iov->Data(), iov->NumBytes(),
                                       out->mutable_data())) {
     return errors::Internal("Failed to compress using snappy.");
   }
   out->set_version(kCompressedElementVersion);
-  VLOG(3) << "Compressed element from " << iov.NumBytes() << " bytes to "
+  VLOG(3) << "Compressed element from " << iov->NumBytes() << " bytes to "
+          << out->data().size() << " bytes";
+  return absl::OkStatus();
+}
+
+absl::Status ZstdCompressElement(const std::vector<Tensor>& element,
+                                 CompressedElement* out,
+                                 absl::string_view dictionary,
+                                 int compression_level) {
+  tstring nonmemcpyable;
+  std::unique_ptr<Iov> iov;
+  TF_RETURN_IF_ERROR(BuildElementIov(element, out, &nonmemcpyable, &iov));
+  TF_RETURN_IF_ERROR(ZstdCompressor::Get().Compress(
+      *iov, compression_level, dictionary, out->mutable_data()));
+  out->set_version(kZstdCompressedElementVersion);
+  VLOG(3) << "Compressed element from " << iov->NumBytes() << " bytes to "
           << out->data().size() << " bytes";
   return absl::OkStatus();
 }
 
+absl::Status TrainZstdDictionary(
+    const std::vector<std::vector<Tensor>>& samples, size_t dictionary_size,
+    std::string* dictionary) {
+  std::string buffer;
+  std::vector<size_t> sample_sizes;
+  sample_sizes.reserve(samples.size());
+  for (const auto& element : samples) {
+    CompressedElement discarded_metadata;
+    tstring nonmemcpyable;
+    std::unique_ptr<Iov> iov;
+    TF_RETURN_IF_ERROR(
+        BuildElementIov(element, &discarded_metadata, &nonmemcpyable, &iov));
+    for (size_t i = 0; i < iov->NumPieces(); ++i) {
+      buffer.append(static_cast<const char*>(iov->Data()[i].iov_base),
+                    iov->Data()[i].iov_len);
+    }
+    sample_sizes.push_back(iov->NumBytes());
+  }
+  dictionary->resize(dictionary_size);
+  const size_t ret =
+      ZDICT_trainFromBuffer(&(*dictionary)[0], dictionary_size, buffer.data(),
+                            sample_sizes.data(), sample_sizes.size());
+  if (ZDICT_isError(ret)) {
+    return errors::InvalidArgument("Failed to train zstd dictionary: ",
+                                   ZDICT_getErrorName(ret));
+  }
+  dictionary->resize(ret);
+  return absl::OkStatus();
+}
+
+absl::Status UncompressElement(const CompressedElement& compressed,
+                               std::vector<Tensor>* out) {
+  return UncompressElement(compressed, /*dictionary=*/{}, out);
+}
+
 absl::Status UncompressElement(const CompressedElement& compressed,
+                               absl::string_view dictionary,
                                std::vector<Tensor>* out) {
-  if (compressed.version() != kCompressedElementVersion) {
+  if (compressed.version() != kCompressedElementVersion &&
+      compressed.version() != kZstdCompressedElementVersion) {
     return errors::Internal("Unsupported compressed element version: ",
                             compressed.version());
   }
@@ -194,22 +425,28 @@ absl::Status UncompressElement(const CompressedElement& compressed,
 
   // Step 2: Uncompress into the iovec.
   const std::string& compressed_data = compressed.data();
-  size_t uncompressed_size;
-  if (!port::Snappy_GetUncompressedLength(
-          compressed_data.data(), compressed_data.size(), &uncompressed_size)) {
-    return errors::Internal(
-        "Could not get snappy uncompressed length. Compressed data size: ",
-        compressed_data.size());
-  }
-  if (uncompressed_size != static_cast<size_t>(iov.NumBytes())) {
-    return errors::Internal(
-        "Uncompressed size mismatch. Snappy expects ", uncompressed_size,
-        " whereas the tensor metadata suggests ", iov.NumBytes());
-  }
-  if (!port::Snappy_UncompressToIOVec(compressed_data.data(),
-                                      compressed_data.size(), iov.Data(),
-                                      iov.NumPieces())) {
-    return errors::Internal("Failed to perform snappy decompression.");
+  if (compressed.version() == kZstdCompressedElementVersion) {
+    TF_RETURN_IF_ERROR(
+        ZstdDecompressor::Get().Decompress(compressed_data, iov, dictionary));
+  } else {
+    size_t uncompressed_size;
+    if (!port::Snappy_GetUncompressedLength(compressed_data.data(),
+                                            compressed_data.size(),
+                                            &uncompressed_size)) {
+      return errors::Internal(
+          "Could not get snappy uncompressed length. Compressed data size: ",
+          compressed_data.size());
+    }
+    if (uncompressed_size != static_cast<size_t>(iov.NumBytes())) {
+      return errors::Internal(
+          "Uncompressed size mismatch. Snappy expects ", uncompressed_size,
+          " whereas the tensor metadata suggests ", iov.NumBytes());
+    }
+    if (!port::Snappy_UncompressToIOVec(compressed_data.data(),
+                                        compressed_data.size(), iov.Data(),
+                                        iov.NumPieces())) {
+      return errors::Internal("Failed to perform snappy decompression.");
+    }
   }
 
   // Third pass: deserialize nonstring, non`memcpy`able tensors.
@@ -15,6 +15,7 @@ limitations under the License.
 #include "tensorflow/core/data/compression_utils.h"
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -89,6 +90,50 @@ TEST_P(ParameterizedCompressionUtilsTest, RoundTrip) {
       ExpectEqual(element, round_trip_element, /*compare_order=*/true));
 }
 
+TEST_P(ParameterizedCompressionUtilsTest, ZstdRoundTrip) {
+  std::vector<Tensor> element = GetParam();
+  CompressedElement compressed;
+  TF_ASSERT_OK(ZstdCompressElement(element, &compressed));
+  EXPECT_EQ(1, compressed.version());
+  std::vector<Tensor> round_trip_element;
+  TF_ASSERT_OK(UncompressElement(compressed, &round_trip_element));
+  TF_EXPECT_OK(
+      ExpectEqual(element, round_trip_element, /*compare_order=*/true));
+}
+
+TEST(CompressionUtilsTest, ZstdDictionaryRoundTrip) {
+  // Small, similar elements: the case where a trained dictionary helps.
+  std::vector<std::vector<Tensor>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(CreateTensors<tstring>(
+        TensorShape{1},
+        {{"this is sample element number " + std::to_string(i) +
+          " of the training corpus for the compression dictionary"}}));
+  }
+  std::string dictionary;
+  TF_ASSERT_OK(TrainZstdDictionary(samples, /*dictionary_size=*/4096,
+                                   &dictionary));
+  EXPECT_FALSE(dictionary.empty());
+
+  std::vector<Tensor> element = CreateTensors<tstring>(
+      TensorShape{1},
+      {{"this is sample element number 9999 of the training corpus for the "
+        "compression dictionary"}});
+  CompressedElement compressed;
+  TF_ASSERT_OK(ZstdCompressElement(element, &compressed, dictionary));
+
+  std::vector<Tensor> round_trip_element;
+  TF_ASSERT_OK(UncompressElement(compressed, dictionary, &round_trip_element));
+  TF_EXPECT_OK(
+      ExpectEqual(element, round_trip_element, /*compare_order=*/true));
+
+  // Without the dictionary, decompression must fail rather than produce
+  // wrong data.
+  std::vector<Tensor> wrong_element;
+  EXPECT_THAT(UncompressElement(compressed, &wrong_element),
+              StatusIs(error::INTERNAL));
+}
+
 TEST_P(ParameterizedCompressionUtilsTest, CompressedElementVersion) {
   std::vector<Tensor> element = GetParam();
   CompressedElement compressed;
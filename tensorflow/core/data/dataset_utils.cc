@@ -20,6 +20,7 @@ limitations under the License.
 #include <cctype>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <random>
 #include <string>
@@ -841,6 +842,36 @@ absl::Status CopyBatch(AnyContext ctx,
           std::move(batch_elements.at(index)[component_index]),
           &batch_component, index);
     };
+    // Fast path: when every element of this component is backed by memory
+    // immediately following the previous element (e.g. views sliced out of a
+    // shared reader block), the whole component is copied with one memcpy
+    // instead of one copy per element.
+    if (DataTypeCanUseMemcpy(first_element.dtype())) {
+      const int64_t bytes_per_element = first_element.TotalBytes();
+      bool contiguous = bytes_per_element > 0;
+      const char* base = contiguous
+                             ? batch_elements.at(0)[component_index]
+                                   .tensor_data()
+                                   .data()
+                             : nullptr;
+      for (int64_t i = 0; contiguous && i < num_batch_elements; ++i) {
+        const Tensor& element = batch_elements.at(i)[component_index];
+        if (element.shape() != first_element_shape) {
+          return errors::InvalidArgument(
+              "Cannot batch tensors with different shapes in component ",
+              component_index, ". First element had shape ",
+              first_element_shape.DebugString(), " and element ", i,
+              " had shape ", element.shape().DebugString(), ".");
+        }
+        contiguous =
+            element.tensor_data().data() == base + i * bytes_per_element;
+      }
+      if (contiguous) {
+        memcpy(const_cast<char*>(batch_component.tensor_data().data()), base,
+               bytes_per_element * num_batch_elements);
+        continue;
+      }
+    }
     const auto total_bytes =
         first_element.AllocatedBytes() * num_batch_elements;
     // Use parallelism for creating the batch as long as the final batch is at
@@ -0,0 +1,152 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/data/replay_utils.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorflow/core/data/snapshot_utils.h"
+#include "tensorflow/core/data/standalone.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/io/compression.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/env_time.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/protobuf/snapshot.pb.h"
+
+namespace tensorflow {
+namespace data {
+namespace {
+
+// Snapshot file format version used for the elements file; version 2 is the
+// TFRecord-based format.
+constexpr int kReplaySnapshotVersion = 2;
+
+}  // namespace
+
+absl::Status WriteReplayArtifact(
+    Env* env, const GraphDef& dataset_graph,
+    const std::vector<std::vector<Tensor>>& elements,
+    const std::string& artifact_directory) {
+  TF_RETURN_IF_ERROR(env->RecursivelyCreateDir(artifact_directory));
+  TF_RETURN_IF_ERROR(WriteBinaryProto(
+      env, io::JoinPath(artifact_directory, kReplayDatasetGraphFilename),
+      dataset_graph));
+
+  DataTypeVector dtypes;
+  if (!elements.empty()) {
+    dtypes.reserve(elements[0].size());
+    for (const Tensor& component : elements[0]) {
+      dtypes.push_back(component.dtype());
+    }
+  }
+  for (const std::vector<Tensor>& element : elements) {
+    if (element.size() != dtypes.size()) {
+      return errors::InvalidArgument(
+          "All captured elements must have the same number of components; "
+          "expected ",
+          dtypes.size(), " but found an element with ", element.size(), ".");
+    }
+  }
+
+  experimental::SnapshotMetadataRecord metadata;
+  metadata.set_version(kReplaySnapshotVersion);
+  metadata.set_num_elements(elements.size());
+  metadata.set_creation_timestamp(EnvTime::NowMicros());
+  for (DataType dtype : dtypes) {
+    metadata.add_dtype(dtype);
+  }
+  TF_RETURN_IF_ERROR(
+      snapshot_util::WriteMetadataFile(env, artifact_directory, &metadata));
+
+  std::unique_ptr<snapshot_util::Writer> writer;
+  TF_RETURN_IF_ERROR(snapshot_util::Writer::Create(
+      env, io::JoinPath(artifact_directory, kReplayElementsFilename),
+      io::compression::kSnappy, kReplaySnapshotVersion, dtypes, &writer));
+  for (const std::vector<Tensor>& element : elements) {
+    TF_RETURN_IF_ERROR(writer->WriteTensors(element));
+  }
+  return writer->Close();
+}
+
+absl::Status CaptureReplayArtifact(Env* env, const GraphDef& dataset_graph,
+                                   int64_t num_elements,
+                                   const std::string& artifact_directory) {
+  standalone::Dataset::Params params;
+  std::unique_ptr<standalone::Dataset> dataset;
+  TF_RETURN_IF_ERROR(
+      standalone::Dataset::FromGraph(params, dataset_graph, &dataset));
+  std::unique_ptr<standalone::Iterator> iterator;
+  TF_RETURN_IF_ERROR(dataset->MakeIterator(&iterator));
+
+  std::vector<std::vector<Tensor>> elements;
+  for (int64_t i = 0; i < num_elements; ++i) {
+    std::vector<Tensor> element;
+    bool end_of_input = false;
+    TF_RETURN_IF_ERROR(iterator->GetNext(&element, &end_of_input));
+    if (end_of_input) break;
+    elements.push_back(std::move(element));
+  }
+  return WriteReplayArtifact(env, dataset_graph, elements, artifact_directory);
+}
+
+absl::Status ReadReplayArtifactGraph(Env* env,
+                                     const std::string& artifact_directory,
+                                     GraphDef* dataset_graph) {
+  return ReadBinaryProto(
+      env, io::JoinPath(artifact_directory, kReplayDatasetGraphFilename),
+      dataset_graph);
+}
+
+absl::Status ReadReplayArtifactElements(
+    Env* env, const std::string& artifact_directory,
+    std::vector<std::vector<Tensor>>* elements) {
+  experimental::SnapshotMetadataRecord metadata;
+  bool file_exists;
+  TF_RETURN_IF_ERROR(snapshot_util::ReadMetadataFile(env, artifact_directory,
+                                                     &metadata, &file_exists));
+  if (!file_exists) {
+    return errors::NotFound("Replay artifact metadata not found in ",
+                            artifact_directory);
+  }
+  DataTypeVector dtypes;
+  for (int dtype : metadata.dtype()) {
+    dtypes.push_back(static_cast<DataType>(dtype));
+  }
+
+  std::unique_ptr<snapshot_util::Reader> reader;
+  TF_RETURN_IF_ERROR(snapshot_util::Reader::Create(
+      env, io::JoinPath(artifact_directory, kReplayElementsFilename),
+      io::compression::kSnappy, metadata.version(), dtypes, &reader));
+  elements->clear();
+  elements->reserve(metadata.num_elements());
+  for (int64_t i = 0; i < metadata.num_elements(); ++i) {
+    std::vector<Tensor> element;
+    TF_RETURN_IF_ERROR(reader->ReadTensors(&element));
+    elements->push_back(std::move(element));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace data
+}  // namespace tensorflow
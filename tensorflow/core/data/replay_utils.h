@@ -0,0 +1,76 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_DATA_REPLAY_UTILS_H_
+#define TENSORFLOW_CORE_DATA_REPLAY_UTILS_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/platform/env.h"
+
+namespace tensorflow {
+namespace data {
+
+// Utilities for capturing a slow input pipeline into a self-contained replay
+// artifact and reading it back for offline benchmarking, without access to
+// the original job or its input files.
+//
+// An artifact is a directory holding:
+// - the serialized dataset graph (`dataset_graph.pb`),
+// - a snapshot metadata record with the element dtypes and count
+//   (`snapshot.metadata`, reusing the snapshot_utils metadata format),
+// - a window of captured elements written with the snappy-compressed
+//   snapshot TFRecord format (`elements.snapshot`).
+
+// Name of the file inside a replay artifact holding the dataset GraphDef.
+constexpr char kReplayDatasetGraphFilename[] = "dataset_graph.pb";
+
+// Name of the file inside a replay artifact holding the captured elements.
+constexpr char kReplayElementsFilename[] = "elements.snapshot";
+
+// Writes a replay artifact for `dataset_graph` with the given
+// already-materialized `elements` into `artifact_directory`, creating the
+// directory if needed. All elements must have the same arity and dtypes.
+absl::Status WriteReplayArtifact(
+    Env* env, const GraphDef& dataset_graph,
+    const std::vector<std::vector<Tensor>>& elements,
+    const std::string& artifact_directory);
+
+// Captures up to `num_elements` elements from a fresh iterator over
+// `dataset_graph` and writes them together with the graph into
+// `artifact_directory`. Stops early if the pipeline ends first.
+absl::Status CaptureReplayArtifact(Env* env, const GraphDef& dataset_graph,
+                                   int64_t num_elements,
+                                   const std::string& artifact_directory);
+
+// Reads the dataset graph back from a replay artifact.
+absl::Status ReadReplayArtifactGraph(Env* env,
+                                     const std::string& artifact_directory,
+                                     GraphDef* dataset_graph);
+
+// Reads the captured elements back from a replay artifact.
+absl::Status ReadReplayArtifactElements(
+    Env* env, const std::string& artifact_directory,
+    std::vector<std::vector<Tensor>>* elements);
+
+}  // namespace data
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_DATA_REPLAY_UTILS_H_
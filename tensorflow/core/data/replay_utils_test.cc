@@ -0,0 +1,81 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/data/replay_utils.h"
+
+#include <string>
+#include <vector>
+
+#include "tensorflow/core/data/dataset_test_base.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace data {
+namespace {
+
+class ReplayUtilsTest : public DatasetOpsTestBase {};
+
+TEST_F(ReplayUtilsTest, RoundTrip) {
+  GraphDef dataset_graph;
+  dataset_graph.add_node()->set_name("dataset");
+
+  std::vector<std::vector<Tensor>> elements;
+  for (int i = 0; i < 10; ++i) {
+    elements.push_back(
+        {CreateTensor<int64_t>(TensorShape{1}, {i}),
+         CreateTensor<tstring>(TensorShape{1}, {absl::StrCat("elem-", i)})});
+  }
+
+  Env* env = Env::Default();
+  std::string artifact_directory =
+      io::JoinPath(testing::TmpDir(), "replay_artifact");
+  TF_ASSERT_OK(
+      WriteReplayArtifact(env, dataset_graph, elements, artifact_directory));
+
+  GraphDef read_graph;
+  TF_ASSERT_OK(ReadReplayArtifactGraph(env, artifact_directory, &read_graph));
+  EXPECT_EQ(read_graph.node_size(), 1);
+  EXPECT_EQ(read_graph.node(0).name(), "dataset");
+
+  std::vector<std::vector<Tensor>> read_elements;
+  TF_ASSERT_OK(
+      ReadReplayArtifactElements(env, artifact_directory, &read_elements));
+  ASSERT_EQ(read_elements.size(), elements.size());
+  for (size_t i = 0; i < elements.size(); ++i) {
+    TF_EXPECT_OK(ExpectEqual(elements[i], read_elements[i],
+                             /*compare_order=*/true));
+  }
+}
+
+TEST_F(ReplayUtilsTest, EmptyWindow) {
+  GraphDef dataset_graph;
+  Env* env = Env::Default();
+  std::string artifact_directory =
+      io::JoinPath(testing::TmpDir(), "empty_replay_artifact");
+  TF_ASSERT_OK(
+      WriteReplayArtifact(env, dataset_graph, {}, artifact_directory));
+
+  std::vector<std::vector<Tensor>> read_elements;
+  TF_ASSERT_OK(
+      ReadReplayArtifactElements(env, artifact_directory, &read_elements));
+  EXPECT_TRUE(read_elements.empty());
+}
+
+}  // namespace
+}  // namespace data
+}  // namespace tensorflow
@@ -17,6 +17,7 @@ limitations under the License.
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -33,6 +34,7 @@ limitations under the License.
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/substitute.h"
 #include "absl/time/time.h"
@@ -73,6 +75,27 @@ bool IsColocatedTask(const TaskInfo& task) {
   });
 }
 
+// Returns the zone advertised by the task's worker through a "ZONE:<zone>"
+// worker tag, or an empty string if the worker does not advertise a zone.
+std::string TaskZone(const TaskInfo& task) {
+  for (const std::string& worker_tag : task.worker_tags()) {
+    if (absl::StartsWithIgnoreCase(worker_tag, kZoneWorkerTagPrefix)) {
+      return worker_tag.substr(kZoneWorkerTagPrefix.size());
+    }
+  }
+  return "";
+}
+
+// Returns the zone this client runs in, as configured by the
+// `TF_DATA_SERVICE_CLIENT_ZONE` environment variable. Empty if unconfigured.
+const std::string& ClientZone() {
+  static const std::string* const zone = []() {
+    const char* env = std::getenv("TF_DATA_SERVICE_CLIENT_ZONE");
+    return new std::string(env == nullptr ? "" : env);
+  }();
+  return *zone;
+}
+
 absl::StatusOr<DataTransferServerInfo> GetTransferServer(
     const std::string& protocol, const TaskInfo& task_info) {
   for (const auto& transfer_server : task_info.transfer_servers()) {
@@ -530,12 +553,20 @@ void DataServiceClient::UpdateTasks(const ClientHeartbeatResponse& resp)
       }
     }
   }
+  // Only prefer same-zone reads when some worker actually runs in this
+  // client's zone, so that a client outside every worker zone still reads
+  // from the full cluster.
+  const bool has_same_zone_task =
+      !ClientZone().empty() &&
+      absl::c_any_of(resp.task_info(), [](const TaskInfo& task) {
+        return TaskZone(task) == ClientZone();
+      });
   for (auto& task : resp.task_info()) {
     auto it = task_id_to_task.find(task.task_id());
     if (it == task_id_to_task.end()) {
       continue;
     }
-    if (!ShouldReadFromTask(task)) {
+    if (!ShouldReadFromTask(task, has_same_zone_task)) {
       VLOG(3) << "Skipping untargeted worker task " << task.task_id();
       should_finish_iteration_ = false;
       continue;
@@ -549,7 +580,8 @@ void DataServiceClient::UpdateTasks(const ClientHeartbeatResponse& resp)
   }
 }
 
-bool DataServiceClient::ShouldReadFromTask(const TaskInfo& task) const
+bool DataServiceClient::ShouldReadFromTask(const TaskInfo& task,
+                                           bool has_same_zone_task) const
     TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
   if (IsCoordinatedRead()) {
     return true;
@@ -567,6 +599,16 @@ bool DataServiceClient::ShouldReadFromTask(const TaskInfo& task) const
   if (params_.target_workers == TARGET_WORKERS_AUTO && is_cross_tf_host_read) {
     return false;
   }
+
+  // Cross-zone reads are billed as inter-zone egress. When same-zone workers
+  // exist, tf.data service avoids reading from workers in other zones. Local
+  // tasks always run in the client's zone.
+  const bool is_cross_zone_read =
+      !is_local_task && TaskZone(task) != ClientZone();
+  if (params_.target_workers == TARGET_WORKERS_AUTO && has_same_zone_task &&
+      is_cross_zone_read) {
+    return false;
+  }
   return true;
 }
 
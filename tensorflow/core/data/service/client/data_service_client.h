@@ -167,7 +167,11 @@ class DataServiceClient {
       const DataTransferServerInfo& transfer_server, const TaskInfo& task_info);
   void Heartbeat();
   void UpdateTasks(const ClientHeartbeatResponse& resp);
-  bool ShouldReadFromTask(const TaskInfo& task) const;
+  // Returns true if this client should read from the given task.
+  // `has_same_zone_task` reports whether any task in the current heartbeat
+  // response runs in this client's zone; when true, cross-zone tasks are
+  // skipped to avoid inter-zone egress.
+  bool ShouldReadFromTask(const TaskInfo& task, bool has_same_zone_task) const;
   void RecordTFMetrics(const ClientHeartbeatResponse& resp);
   void UpdateBufferSize();
   void UpdateWorkerThreads();
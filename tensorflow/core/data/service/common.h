@@ -39,6 +39,12 @@ constexpr int kDataServiceVersion = 9;
 // workers on other TF hosts when the host runs a local tf.data service worker.
 constexpr absl::string_view kColocatedWorkerTag = "COLOCATED";
 
+// Workers may advertise the zone (or rack) they run in by adding a
+// "ZONE:<zone>" entry to their `worker_tags` config. Clients that know their
+// own zone (see the `TF_DATA_SERVICE_CLIENT_ZONE` environment variable) prefer
+// reading from same-zone workers to avoid cross-zone egress.
+constexpr absl::string_view kZoneWorkerTagPrefix = "ZONE:";
+
 // Container to hold the result of a `GetNext` call.
 struct GetNextResult final {
   explicit GetNextResult() = default;
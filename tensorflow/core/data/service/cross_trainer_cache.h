@@ -20,6 +20,7 @@ limitations under the License.
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -91,6 +92,21 @@ class CachableSequence {
   virtual size_t GetElementSizeBytes(const ElementType&) const = 0;
 };
 
+// An optional second cache tier consulted before the upstream sequence when
+// the in-memory cache needs to grow. This allows serving cache misses from a
+// cheaper source than recomputing the element, e.g. from a sibling worker
+// that caches the same sequence. The tier is best-effort: a miss or an error
+// falls back to the upstream `CachableSequence`.
+template <class ElementType>
+class CrossTrainerCacheRemoteTier {
+ public:
+  virtual ~CrossTrainerCacheRemoteTier() = default;
+
+  // Returns the element at `element_index` of the shared sequence, or
+  // `std::nullopt` if the tier does not hold that element.
+  virtual StatusOr<std::optional<ElementType>> Get(size_t element_index) = 0;
+};
+
 // Sliding-window cache shared across concurrent trainers.
 template <class ElementType>
 class CrossTrainerCache {
@@ -98,9 +114,13 @@ class CrossTrainerCache {
   // Creates a `CrossTrainerCache` with `max_cache_size_bytes` of memory budget.
   // The cache should be able to hold at least one element, i.e.:
   // REQUIRES: `max_cache_size_bytes >= max(GetElementSizeBytes(*))`
+  // If `remote_tier` is non-null, cache misses are first looked up in the
+  // remote tier before reading from `cachable_sequence`.
   explicit CrossTrainerCache(
       size_t max_cache_size_bytes,
-      std::unique_ptr<CachableSequence<ElementType>> cachable_sequence);
+      std::unique_ptr<CachableSequence<ElementType>> cachable_sequence,
+      std::unique_ptr<CrossTrainerCacheRemoteTier<ElementType>> remote_tier =
+          nullptr);
   virtual ~CrossTrainerCache() = default;
   CrossTrainerCache(const CrossTrainerCache&) = delete;
   CrossTrainerCache& operator=(const CrossTrainerCache&) = delete;
@@ -158,6 +178,9 @@ class CrossTrainerCache {
   // The element sequence over which the sliding window cache operates.
   std::unique_ptr<CachableSequence<ElementType>> cachable_sequence_;
 
+  // Optional second cache tier consulted before `cachable_sequence_`.
+  std::unique_ptr<CrossTrainerCacheRemoteTier<ElementType>> remote_tier_;
+
   mutable mutex mu_;
   mutable condition_variable cv_;
 
@@ -183,9 +206,11 @@ class CrossTrainerCache {
 template <class ElementType>
 CrossTrainerCache<ElementType>::CrossTrainerCache(
     size_t max_cache_size_bytes,
-    std::unique_ptr<CachableSequence<ElementType>> cachable_sequence)
+    std::unique_ptr<CachableSequence<ElementType>> cachable_sequence,
+    std::unique_ptr<CrossTrainerCacheRemoteTier<ElementType>> remote_tier)
     : max_cache_size_bytes_(max_cache_size_bytes),
-      cachable_sequence_(std::move(cachable_sequence)) {
+      cachable_sequence_(std::move(cachable_sequence)),
+      remote_tier_(std::move(remote_tier)) {
   DCHECK_GT(max_cache_size_bytes, 0)
       << "CrossTrainerCache size must be greater than 0.";
   VLOG(2) << "Initialized tf.data service cross-trainer cache with "
@@ -280,9 +305,32 @@ size_t CrossTrainerCache<ElementType>::GetElementIndex(
 template <class ElementType>
 absl::Status CrossTrainerCache<ElementType>::ExtendCache()
     TF_LOCKS_EXCLUDED(mu_) {
-  TF_ASSIGN_OR_RETURN(ElementType element, cachable_sequence_->GetNext());
+  std::optional<ElementType> element;
+  if (remote_tier_) {
+    // Only one thread extends the cache at a time and evictions preserve
+    // `cache_start_index_ + cache_.size()`, so the next absolute element index
+    // is stable while the lock is released for the remote read.
+    size_t next_element_index;
+    {
+      mutex_lock l(mu_);
+      next_element_index = cache_start_index_ + cache_.size();
+    }
+    StatusOr<std::optional<ElementType>> remote_element =
+        remote_tier_->Get(next_element_index);
+    if (remote_element.ok()) {
+      element = std::move(*remote_element);
+    } else {
+      LOG(WARNING) << "Failed to read element " << next_element_index
+                   << " from the tf.data service cross-trainer cache remote "
+                   << "tier. Falling back to the upstream source: "
+                   << remote_element.status();
+    }
+  }
+  if (!element.has_value()) {
+    TF_ASSIGN_OR_RETURN(element, cachable_sequence_->GetNext());
+  }
   size_t new_element_size_bytes =
-      cachable_sequence_->GetElementSizeBytes(element);
+      cachable_sequence_->GetElementSizeBytes(*element);
   if (new_element_size_bytes > max_cache_size_bytes_) {
     return errors::InvalidArgument(
         "tf.data service element size is larger than cache size in bytes. Got ",
@@ -293,7 +341,7 @@ absl::Status CrossTrainerCache<ElementType>::ExtendCache()
   mutex_lock l(mu_);
   TF_RETURN_IF_ERROR(status_);
   FreeSpace(new_element_size_bytes);
-  cache_.push_back(std::make_shared<ElementType>(std::move(element)));
+  cache_.push_back(std::make_shared<ElementType>(std::move(*element)));
   cache_size_bytes_ += new_element_size_bytes;
   return absl::OkStatus();
 }
@@ -121,6 +121,31 @@ size_t ElementOrErrorDataset<Tensor>::GetElementSizeBytes(
   return element.TotalBytes();
 }
 
+// Remote tier that serves `element_index + 100` for the first `num_elements`
+// elements and misses afterwards.
+class FiniteRemoteTier : public CrossTrainerCacheRemoteTier<int64_t> {
+ public:
+  explicit FiniteRemoteTier(size_t num_elements)
+      : num_elements_(num_elements) {}
+
+  absl::StatusOr<std::optional<int64_t>> Get(size_t element_index) override {
+    if (element_index >= num_elements_) {
+      return std::optional<int64_t>();
+    }
+    return std::optional<int64_t>(element_index + 100);
+  }
+
+ private:
+  const size_t num_elements_;
+};
+
+class UnavailableRemoteTier : public CrossTrainerCacheRemoteTier<int64_t> {
+ public:
+  absl::StatusOr<std::optional<int64_t>> Get(size_t element_index) override {
+    return errors::Unavailable("Sibling worker is unreachable.");
+  }
+};
+
 std::vector<int64_t> GetRange(const size_t range) {
   std::vector<int64_t> result;
   for (int64_t i = 0; i < range; ++i) {
@@ -162,6 +187,30 @@ TEST(CrossTrainerCacheTest, GetFromMultipleTrainers) {
   }
 }
 
+TEST(CrossTrainerCacheTest, RemoteTierServesCacheMisses) {
+  CrossTrainerCache<int64_t> cache(
+      /*max_cache_size_bytes=*/1024, std::make_unique<InfiniteRange>(),
+      std::make_unique<FiniteRemoteTier>(/*num_elements=*/5));
+  // The first five elements come from the remote tier.
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_THAT(cache.Get("Trainer ID"), IsOkAndHolds(Pointee(i + 100)));
+  }
+  // After the remote tier misses, elements come from the upstream sequence.
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_THAT(cache.Get("Trainer ID"), IsOkAndHolds(Pointee(i)));
+  }
+}
+
+TEST(CrossTrainerCacheTest, RemoteTierErrorFallsBackToUpstream) {
+  const size_t num_elements = 10;
+  CrossTrainerCache<int64_t> cache(
+      /*max_cache_size_bytes=*/1024, std::make_unique<InfiniteRange>(),
+      std::make_unique<UnavailableRemoteTier>());
+  for (size_t i = 0; i < num_elements; ++i) {
+    EXPECT_THAT(cache.Get("Trainer ID"), IsOkAndHolds(Pointee(i)));
+  }
+}
+
 TEST(CrossTrainerCacheTest, SlowTrainersSkipData) {
   CrossTrainerCache<int64_t> cache(
       /*max_cache_size_bytes=*/5 * sizeof(int64_t),
@@ -0,0 +1,573 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/data/service/socket_data_transfer.h"
+
+#include "tensorflow/core/platform/platform.h"
+
+#if !defined(PLATFORM_WINDOWS)
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "tensorflow/core/data/service/data_transfer.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/stringpiece.h"
+#include "tensorflow/core/platform/thread_annotations.h"
+
+namespace tensorflow {
+namespace data {
+namespace {
+
+// Wire format. All integers are fixed-width little-endian.
+//
+// Request frame (client -> server):
+//   uint32 length, followed by `length` bytes of serialized GetElementRequest.
+// Requests are tiny, so proto-encoding them is not a bottleneck.
+//
+// Response frame (server -> client):
+//   uint32 status code (absl::StatusCode; 0 is OK)
+//   uint32 status message length + message bytes (only if the code is not OK)
+// For an OK status:
+//   uint8  end_of_sequence
+//   uint8  skip
+//   uint64 element_index
+//   uint32 number of components
+// Per component:
+//   uint32 dtype
+//   uint8  is_raw  (1: raw tensor bytes, 0: serialized TensorProto)
+//   uint32 rank + uint64 dims[rank]  (only if is_raw)
+//   uint64 payload length + payload bytes
+// Raw payloads are written straight from (and read straight into) tensor
+// buffers with writev/read; they are never proto-encoded. Only dtypes for
+// which `DataTypeCanUseMemcpy` holds are sent raw; strings and variants fall
+// back to TensorProto payloads.
+
+absl::Status IOError(const char* op) {
+  return errors::Unavailable("raw_tcp data transfer: ", op,
+                             " failed: ", strerror(errno));
+}
+
+// Reads exactly `n` bytes into `dst`.
+absl::Status ReadFully(int fd, char* dst, size_t n) {
+  while (n > 0) {
+    ssize_t r = read(fd, dst, n);
+    if (r == 0) {
+      return errors::Cancelled("raw_tcp data transfer: connection closed.");
+    }
+    if (r < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return IOError("read");
+    }
+    dst += r;
+    n -= r;
+  }
+  return absl::OkStatus();
+}
+
+// Writes all the buffers in `iov`, handling partial writes.
+absl::Status WriteAll(int fd, std::vector<iovec> iov) {
+  size_t i = 0;
+  while (i < iov.size()) {
+    ssize_t written = writev(
+        fd, &iov[i], std::min<size_t>(iov.size() - i, IOV_MAX));
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return IOError("writev");
+    }
+    size_t remaining = written;
+    while (i < iov.size() && remaining >= iov[i].iov_len) {
+      remaining -= iov[i].iov_len;
+      ++i;
+    }
+    if (i < iov.size()) {
+      iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + remaining;
+      iov[i].iov_len -= remaining;
+    }
+  }
+  return absl::OkStatus();
+}
+
+void AppendFixed32(std::string& dst, uint32_t value) {
+  char buf[sizeof(uint32_t)];
+  core::EncodeFixed32(buf, value);
+  dst.append(buf, sizeof(buf));
+}
+
+void AppendFixed64(std::string& dst, uint64_t value) {
+  char buf[sizeof(uint64_t)];
+  core::EncodeFixed64(buf, value);
+  dst.append(buf, sizeof(buf));
+}
+
+absl::Status ReadFixed32(int fd, uint32_t* value) {
+  char buf[sizeof(uint32_t)];
+  TF_RETURN_IF_ERROR(ReadFully(fd, buf, sizeof(buf)));
+  *value = core::DecodeFixed32(buf);
+  return absl::OkStatus();
+}
+
+absl::Status ReadFixed64(int fd, uint64_t* value) {
+  char buf[sizeof(uint64_t)];
+  TF_RETURN_IF_ERROR(ReadFully(fd, buf, sizeof(buf)));
+  *value = core::DecodeFixed64(buf);
+  return absl::OkStatus();
+}
+
+class SocketDataTransferServer : public DataTransferServer {
+ public:
+  explicit SocketDataTransferServer(GetElementT get_element)
+      : get_element_(std::move(get_element)) {}
+
+  ~SocketDataTransferServer() override {
+    {
+      mutex_lock l(mu_);
+      stopped_ = true;
+      if (listen_fd_ >= 0) {
+        shutdown(listen_fd_, SHUT_RDWR);
+        close(listen_fd_);
+        listen_fd_ = -1;
+      }
+      for (int fd : connection_fds_) {
+        if (fd >= 0) {
+          shutdown(fd, SHUT_RDWR);
+        }
+      }
+    }
+    // Joins the accept thread, then the connection threads. The threads are
+    // moved out before joining so that `mu_` is not held while they finish.
+    accept_thread_.reset();
+    std::vector<std::unique_ptr<Thread>> connection_threads;
+    {
+      mutex_lock l(mu_);
+      connection_threads = std::move(connection_threads_);
+    }
+    connection_threads.clear();
+    mutex_lock l(mu_);
+    for (int fd : connection_fds_) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+    connection_fds_.clear();
+  }
+
+  absl::Status Start(const experimental::WorkerConfig& config) override {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+      return IOError("socket");
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(static_cast<uint16_t>(config.data_transfer_port()));
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        listen(fd, SOMAXCONN) < 0) {
+      absl::Status s = IOError("bind/listen");
+      close(fd);
+      return s;
+    }
+    socklen_t addr_len = sizeof(addr);
+    if (getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) < 0) {
+      absl::Status s = IOError("getsockname");
+      close(fd);
+      return s;
+    }
+    port_ = ntohs(addr.sin_port);
+    {
+      mutex_lock l(mu_);
+      listen_fd_ = fd;
+    }
+    accept_thread_ = absl::WrapUnique(Env::Default()->StartThread(
+        /*thread_options=*/{}, /*name=*/"tf_data_service_raw_tcp_accept",
+        [this, fd] { AcceptLoop(fd); }));
+    LOG(INFO) << "Started tf.data service raw_tcp data transfer server on "
+              << "port " << port_ << ".";
+    return absl::OkStatus();
+  }
+
+  int Port() const override { return port_; }
+
+ private:
+  void AcceptLoop(int listen_fd) {
+    while (true) {
+      int fd = accept(listen_fd, /*addr=*/nullptr, /*addrlen=*/nullptr);
+      if (fd < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        // The listener was closed during shutdown.
+        return;
+      }
+      int one = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      mutex_lock l(mu_);
+      if (stopped_) {
+        close(fd);
+        return;
+      }
+      connection_fds_.push_back(fd);
+      connection_threads_.push_back(absl::WrapUnique(Env::Default()->StartThread(
+          /*thread_options=*/{}, /*name=*/"tf_data_service_raw_tcp_connection",
+          [this, fd] { ServeConnection(fd); })));
+    }
+  }
+
+  void ServeConnection(int fd) {
+    while (true) {
+      uint32_t request_size;
+      if (!ReadFixed32(fd, &request_size).ok()) {
+        break;
+      }
+      std::string request_bytes(request_size, '\0');
+      if (!ReadFully(fd, &request_bytes[0], request_size).ok()) {
+        break;
+      }
+      GetElementRequest req;
+      if (!req.ParseFromString(request_bytes)) {
+        break;
+      }
+      GetElementResult result;
+      absl::Status status = get_element_(&req, &result);
+      if (!WriteResponse(fd, status, result).ok()) {
+        break;
+      }
+    }
+    mutex_lock l(mu_);
+    for (int& connection_fd : connection_fds_) {
+      if (connection_fd == fd) {
+        connection_fd = -1;
+      }
+    }
+    close(fd);
+  }
+
+  absl::Status WriteResponse(int fd, const absl::Status& status,
+                             const GetElementResult& result) {
+    std::string header;
+    AppendFixed32(header, static_cast<uint32_t>(status.code()));
+    if (!status.ok()) {
+      std::string message(status.message());
+      AppendFixed32(header, message.size());
+      header.append(message);
+      return WriteAll(fd, {{&header[0], header.size()}});
+    }
+    header.push_back(result.end_of_sequence ? 1 : 0);
+    header.push_back(result.skip ? 1 : 0);
+    AppendFixed64(header, static_cast<uint64_t>(result.element_index));
+    AppendFixed32(header, result.components.size());
+
+    // Build all headers and proto payloads first so that the iovec pointers
+    // taken below remain stable.
+    std::vector<std::string> component_headers(result.components.size());
+    std::vector<std::string> proto_payloads;
+    for (int i = 0; i < result.components.size(); ++i) {
+      const Tensor& tensor = result.components[i];
+      std::string& component_header = component_headers[i];
+      AppendFixed32(component_header, static_cast<uint32_t>(tensor.dtype()));
+      if (DataTypeCanUseMemcpy(tensor.dtype())) {
+        component_header.push_back(1);
+        AppendFixed32(component_header, tensor.dims());
+        for (int d = 0; d < tensor.dims(); ++d) {
+          AppendFixed64(component_header, tensor.dim_size(d));
+        }
+        AppendFixed64(component_header, tensor.tensor_data().size());
+      } else {
+        component_header.push_back(0);
+        TensorProto proto;
+        tensor.AsProtoTensorContent(&proto);
+        proto_payloads.emplace_back();
+        if (!proto.SerializeToString(&proto_payloads.back())) {
+          return errors::Internal(
+              "raw_tcp data transfer: failed to serialize tensor proto.");
+        }
+        AppendFixed64(component_header, proto_payloads.back().size());
+      }
+    }
+
+    std::vector<iovec> iov;
+    iov.reserve(1 + 2 * result.components.size());
+    iov.push_back({&header[0], header.size()});
+    int proto_index = 0;
+    for (int i = 0; i < result.components.size(); ++i) {
+      iov.push_back({&component_headers[i][0], component_headers[i].size()});
+      const Tensor& tensor = result.components[i];
+      if (DataTypeCanUseMemcpy(tensor.dtype())) {
+        StringPiece data = tensor.tensor_data();
+        if (!data.empty()) {
+          iov.push_back({const_cast<char*>(data.data()), data.size()});
+        }
+      } else {
+        std::string& payload = proto_payloads[proto_index++];
+        if (!payload.empty()) {
+          iov.push_back({&payload[0], payload.size()});
+        }
+      }
+    }
+    return WriteAll(fd, std::move(iov));
+  }
+
+  const GetElementT get_element_;
+  int port_ = -1;
+
+  mutex mu_;
+  bool stopped_ TF_GUARDED_BY(mu_) = false;
+  int listen_fd_ TF_GUARDED_BY(mu_) = -1;
+  std::vector<int> connection_fds_ TF_GUARDED_BY(mu_);
+  std::vector<std::unique_ptr<Thread>> connection_threads_ TF_GUARDED_BY(mu_);
+
+  // This has to be destroyed before the connection threads are joined; see
+  // the destructor.
+  std::unique_ptr<Thread> accept_thread_;
+};
+
+class SocketDataTransferClient : public DataTransferClient {
+ public:
+  explicit SocketDataTransferClient(Config config)
+      : address_(std::move(config.address)), allocator_(config.allocator) {}
+
+  ~SocketDataTransferClient() override {
+    mutex_lock l(mu_);
+    CloseConnection();
+  }
+
+  absl::Status GetElement(const GetElementRequest& req,
+                          GetElementResult& result) override {
+    mutex_lock l(mu_);
+    if (cancelled_) {
+      return errors::Cancelled(
+          "raw_tcp data transfer client was cancelled.");
+    }
+    TF_RETURN_IF_ERROR(EnsureConnected());
+    absl::Status status = GetElementInternal(req, result);
+    if (!status.ok()) {
+      // The stream position is unknown after a failure; reconnect on the next
+      // call.
+      CloseConnection();
+    }
+    return status;
+  }
+
+  void TryCancel() override {
+    cancelled_ = true;
+    // Unblocks a thread waiting in `read` without grabbing `mu_`.
+    int fd = fd_;
+    if (fd >= 0) {
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+
+ private:
+  absl::Status EnsureConnected() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (fd_ >= 0) {
+      return absl::OkStatus();
+    }
+    size_t colon = address_.rfind(':');
+    if (colon == std::string::npos) {
+      return errors::InvalidArgument(
+          "raw_tcp data transfer: malformed address: ", address_);
+    }
+    std::string host = address_.substr(0, colon);
+    std::string port = address_.substr(colon + 1);
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    int rc = getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+    if (rc != 0) {
+      return errors::Unavailable("raw_tcp data transfer: failed to resolve ",
+                                 address_, ": ", gai_strerror(rc));
+    }
+    absl::Status status =
+        errors::Unavailable("raw_tcp data transfer: no address for ", address_);
+    for (addrinfo* ai = addresses; ai != nullptr; ai = ai->ai_next) {
+      int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+      if (fd < 0) {
+        status = IOError("socket");
+        continue;
+      }
+      if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        fd_ = fd;
+        status = absl::OkStatus();
+        break;
+      }
+      status = IOError("connect");
+      close(fd);
+    }
+    freeaddrinfo(addresses);
+    return status;
+  }
+
+  absl::Status GetElementInternal(const GetElementRequest& req,
+                                  GetElementResult& result)
+      TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    std::string frame;
+    std::string request_bytes;
+    if (!req.SerializeToString(&request_bytes)) {
+      return errors::Internal(
+          "raw_tcp data transfer: failed to serialize request.");
+    }
+    AppendFixed32(frame, request_bytes.size());
+    frame.append(request_bytes);
+    TF_RETURN_IF_ERROR(WriteAll(fd_, {{&frame[0], frame.size()}}));
+
+    uint32_t code;
+    TF_RETURN_IF_ERROR(ReadFixed32(fd_, &code));
+    if (code != 0) {
+      uint32_t message_size;
+      TF_RETURN_IF_ERROR(ReadFixed32(fd_, &message_size));
+      std::string message(message_size, '\0');
+      TF_RETURN_IF_ERROR(ReadFully(fd_, &message[0], message_size));
+      return absl::Status(static_cast<absl::StatusCode>(code), message);
+    }
+    char flags[2];
+    TF_RETURN_IF_ERROR(ReadFully(fd_, flags, sizeof(flags)));
+    result.end_of_sequence = flags[0] != 0;
+    result.skip = flags[1] != 0;
+    uint64_t element_index;
+    TF_RETURN_IF_ERROR(ReadFixed64(fd_, &element_index));
+    result.element_index = element_index;
+    uint32_t num_components;
+    TF_RETURN_IF_ERROR(ReadFixed32(fd_, &num_components));
+    result.components.clear();
+    result.components.reserve(num_components);
+    for (uint32_t i = 0; i < num_components; ++i) {
+      uint32_t dtype_raw;
+      TF_RETURN_IF_ERROR(ReadFixed32(fd_, &dtype_raw));
+      const DataType dtype = static_cast<DataType>(dtype_raw);
+      char is_raw;
+      TF_RETURN_IF_ERROR(ReadFully(fd_, &is_raw, 1));
+      if (is_raw) {
+        uint32_t rank;
+        TF_RETURN_IF_ERROR(ReadFixed32(fd_, &rank));
+        TensorShape shape;
+        for (uint32_t d = 0; d < rank; ++d) {
+          uint64_t dim;
+          TF_RETURN_IF_ERROR(ReadFixed64(fd_, &dim));
+          TF_RETURN_IF_ERROR(shape.AddDimWithStatus(dim));
+        }
+        uint64_t payload_size;
+        TF_RETURN_IF_ERROR(ReadFixed64(fd_, &payload_size));
+        Tensor tensor = allocator_ != nullptr ? Tensor(allocator_, dtype, shape)
+                                              : Tensor(dtype, shape);
+        StringPiece data = tensor.tensor_data();
+        if (data.size() != payload_size) {
+          return errors::DataLoss(
+              "raw_tcp data transfer: expected ", data.size(),
+              " payload bytes for a ", DataTypeString(dtype), " tensor of shape ",
+              shape.DebugString(), " but the server sent ", payload_size, ".");
+        }
+        // Reads straight into the tensor buffer.
+        TF_RETURN_IF_ERROR(
+            ReadFully(fd_, const_cast<char*>(data.data()), payload_size));
+        result.components.push_back(std::move(tensor));
+      } else {
+        uint64_t payload_size;
+        TF_RETURN_IF_ERROR(ReadFixed64(fd_, &payload_size));
+        std::string payload(payload_size, '\0');
+        TF_RETURN_IF_ERROR(ReadFully(fd_, &payload[0], payload_size));
+        TensorProto proto;
+        if (!proto.ParseFromString(payload)) {
+          return errors::DataLoss(
+              "raw_tcp data transfer: failed to parse tensor proto.");
+        }
+        Tensor tensor;
+        if (!tensor.FromProto(proto)) {
+          return errors::DataLoss(
+              "raw_tcp data transfer: failed to parse tensor from proto.");
+        }
+        result.components.push_back(std::move(tensor));
+      }
+    }
+    return absl::OkStatus();
+  }
+
+  void CloseConnection() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (fd_ >= 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  const std::string address_;
+  Allocator* const allocator_;
+  std::atomic<bool> cancelled_{false};
+
+  mutex mu_;
+  // Also read without `mu_` by `TryCancel`.
+  std::atomic<int> fd_{-1};
+};
+
+class RawTcpTransferRegistrar {
+ public:
+  RawTcpTransferRegistrar() {
+    DataTransferServer::Register(
+        kRawTcpTransferProtocol,
+        [](DataTransferServer::GetElementT get_element,
+           std::shared_ptr<DataTransferServer>* server) {
+          *server =
+              std::make_shared<SocketDataTransferServer>(std::move(get_element));
+          return absl::OkStatus();
+        });
+    DataTransferClient::Register(
+        kRawTcpTransferProtocol,
+        [](DataTransferClient::Config config,
+           std::unique_ptr<DataTransferClient>* client) {
+          *client = std::make_unique<SocketDataTransferClient>(std::move(config));
+          return absl::OkStatus();
+        });
+  }
+};
+
+static RawTcpTransferRegistrar raw_tcp_transfer_registrar;
+
+}  // namespace
+}  // namespace data
+}  // namespace tensorflow
+
+#endif  // !defined(PLATFORM_WINDOWS)
@@ -0,0 +1,34 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_DATA_SERVICE_SOCKET_DATA_TRANSFER_H_
+#define TENSORFLOW_CORE_DATA_SERVICE_SOCKET_DATA_TRANSFER_H_
+
+namespace tensorflow {
+namespace data {
+
+// Name of the raw-socket data transfer protocol. Elements are framed as a
+// small fixed-width header plus the raw tensor buffers over a plain TCP
+// socket, skipping protobuf encoding of the payload bytes. Workers start a
+// server for it when `WorkerConfig.data_transfer_protocol` is set to this
+// name; clients select it through the usual data transfer protocol plumbing
+// and fall back to gRPC if the connection cannot be established. Only
+// available on POSIX platforms.
+constexpr const char kRawTcpTransferProtocol[] = "raw_tcp";
+
+}  // namespace data
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_DATA_SERVICE_SOCKET_DATA_TRANSFER_H_
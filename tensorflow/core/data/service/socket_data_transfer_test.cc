@@ -0,0 +1,149 @@
+/* Copyright 2024 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/data/service/socket_data_transfer.h"
+
+#include "tensorflow/core/platform/platform.h"
+
+#if !defined(PLATFORM_WINDOWS)
+
+#include <memory>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "tensorflow/core/data/service/data_transfer.h"
+#include "tensorflow/core/data/service/worker.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/framework/types.pb.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/status_matchers.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/protobuf/error_codes.pb.h"
+#include "tensorflow/core/protobuf/service_config.pb.h"
+
+namespace tensorflow {
+namespace data {
+namespace {
+
+using ::tensorflow::testing::StatusIs;
+
+// Starts a raw_tcp transfer server on a free port, serving `get_element`, and
+// connects a raw_tcp client to it over loopback.
+void StartServerAndClient(DataTransferServer::GetElementT get_element,
+                          std::shared_ptr<DataTransferServer>& server,
+                          std::unique_ptr<DataTransferClient>& client) {
+  TF_ASSERT_OK(DataTransferServer::Build(kRawTcpTransferProtocol, get_element,
+                                         &server));
+  experimental::WorkerConfig config;
+  config.set_data_transfer_port(0);
+  TF_ASSERT_OK(server->Start(config));
+  ASSERT_GT(server->Port(), 0);
+
+  DataTransferClient::Config client_config;
+  client_config.protocol = kRawTcpTransferProtocol;
+  client_config.address = absl::StrCat("localhost:", server->Port());
+  TF_ASSERT_OK(DataTransferClient::Build(kRawTcpTransferProtocol,
+                                         client_config, &client));
+}
+
+TEST(SocketDataTransferTest, RoundTripsRawTensors) {
+  auto get_element = [](const GetElementRequest* req,
+                        GetElementResult* result) {
+    result->components.push_back(
+        test::AsTensor<int64_t>({1, 2, 3, 4, 5, 6}, TensorShape({2, 3})));
+    result->components.push_back(test::AsScalar<float>(0.5));
+    result->element_index = req->task_id();
+    return absl::OkStatus();
+  };
+  std::shared_ptr<DataTransferServer> server;
+  std::unique_ptr<DataTransferClient> client;
+  StartServerAndClient(get_element, server, client);
+
+  for (int i = 0; i < 10; ++i) {
+    GetElementRequest req;
+    req.set_task_id(i);
+    GetElementResult result;
+    TF_ASSERT_OK(client->GetElement(req, result));
+    EXPECT_FALSE(result.end_of_sequence);
+    EXPECT_EQ(result.element_index, i);
+    ASSERT_EQ(result.components.size(), 2);
+    test::ExpectTensorEqual<int64_t>(
+        result.components[0],
+        test::AsTensor<int64_t>({1, 2, 3, 4, 5, 6}, TensorShape({2, 3})));
+    test::ExpectTensorEqual<float>(result.components[1],
+                                   test::AsScalar<float>(0.5));
+  }
+}
+
+TEST(SocketDataTransferTest, RoundTripsStringTensors) {
+  // Strings cannot be memcpy'd, so they take the TensorProto path.
+  auto get_element = [](const GetElementRequest* req,
+                        GetElementResult* result) {
+    result->components.push_back(
+        test::AsTensor<tstring>({"hello", "world"}, TensorShape({2})));
+    return absl::OkStatus();
+  };
+  std::shared_ptr<DataTransferServer> server;
+  std::unique_ptr<DataTransferClient> client;
+  StartServerAndClient(get_element, server, client);
+
+  GetElementRequest req;
+  GetElementResult result;
+  TF_ASSERT_OK(client->GetElement(req, result));
+  ASSERT_EQ(result.components.size(), 1);
+  test::ExpectTensorEqual<tstring>(
+      result.components[0],
+      test::AsTensor<tstring>({"hello", "world"}, TensorShape({2})));
+}
+
+TEST(SocketDataTransferTest, EndOfSequence) {
+  auto get_element = [](const GetElementRequest* req,
+                        GetElementResult* result) {
+    result->end_of_sequence = true;
+    return absl::OkStatus();
+  };
+  std::shared_ptr<DataTransferServer> server;
+  std::unique_ptr<DataTransferClient> client;
+  StartServerAndClient(get_element, server, client);
+
+  GetElementRequest req;
+  GetElementResult result;
+  TF_ASSERT_OK(client->GetElement(req, result));
+  EXPECT_TRUE(result.end_of_sequence);
+  EXPECT_TRUE(result.components.empty());
+}
+
+TEST(SocketDataTransferTest, PropagatesErrors) {
+  auto get_element = [](const GetElementRequest* req,
+                        GetElementResult* result) {
+    return errors::NotFound("no such task");
+  };
+  std::shared_ptr<DataTransferServer> server;
+  std::unique_ptr<DataTransferClient> client;
+  StartServerAndClient(get_element, server, client);
+
+  GetElementRequest req;
+  GetElementResult result;
+  EXPECT_THAT(client->GetElement(req, result),
+              StatusIs(error::NOT_FOUND, "no such task"));
+}
+
+}  // namespace
+}  // namespace data
+}  // namespace tensorflow
+
+#endif  // !defined(PLATFORM_WINDOWS)
@@ -17,13 +17,23 @@ limitations under the License.
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "grpcpp/client_context.h"
+#include "grpcpp/create_channel.h"
+#include "grpcpp/security/credentials.h"
+#include "grpcpp/support/channel_arguments.h"
+#include "grpcpp/support/status.h"
+#include "absl/strings/str_cat.h"
 #include "tensorflow/core/data/service/byte_size.h"
 #include "tensorflow/core/data/service/common.h"
+#include "tensorflow/core/data/service/credentials_factory.h"
 #include "tensorflow/core/data/service/cross_trainer_cache.h"
 #include "tensorflow/core/data/service/data_transfer.h"
+#include "tensorflow/core/data/service/grpc_util.h"
+#include "tensorflow/core/data/service/worker.grpc.pb.h"
 #include "tensorflow/core/data/service/thread_safe_buffer.h"
 #include "tensorflow/core/data/service/worker.pb.h"
 #include "tensorflow/core/data/standalone.h"
@@ -32,6 +42,8 @@ limitations under the License.
 #include "tensorflow/core/framework/model.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor_util.h"
+#include "tensorflow/core/framework/types.pb.h"
+#include "tensorflow/core/framework/variant.h"
 #include "tensorflow/core/lib/gtl/cleanup.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
@@ -49,6 +61,95 @@ constexpr int64_t kWaitBeforeSkipUs = 100 * 1000;  // 100ms.
 constexpr size_t kDefaultCrossTrainerCacheSizeBytes =
     10 * (size_t{1} << 30);  // 10GB
 
+// Serves cross-trainer cache misses from a sibling worker's cache over the
+// worker protocol. The sibling sees this worker as one more trainer reading
+// its cache sequentially, so no new RPC is needed. A read only counts as a
+// tier hit if the sibling returns the exact element index this worker's cache
+// is about to produce; otherwise the caches have drifted apart and the
+// element is computed from the local input pipeline instead.
+class SiblingWorkerCacheTier
+    : public CrossTrainerCacheRemoteTier<GetElementResult> {
+ public:
+  SiblingWorkerCacheTier(const experimental::WorkerConfig& worker_config,
+                         const TaskDef& task_def)
+      : protocol_(worker_config.protocol()),
+        sibling_address_(worker_config.cross_trainer_cache_sibling_address()),
+        sibling_task_id_(worker_config.cross_trainer_cache_sibling_task_id() > 0
+                             ? worker_config.cross_trainer_cache_sibling_task_id()
+                             : task_def.task_id()),
+        trainer_id_(absl::StrCat("/sibling_worker/",
+                                 worker_config.worker_address())) {}
+
+  absl::StatusOr<std::optional<GetElementResult>> Get(
+      size_t element_index) override {
+    mutex_lock l(mu_);
+    TF_RETURN_IF_ERROR(EnsureStubInitialized());
+    GetElementRequest req;
+    req.set_task_id(sibling_task_id_);
+    req.set_trainer_id(trainer_id_);
+    GetElementResponse resp;
+    grpc::ClientContext ctx;
+    grpc::Status s = stub_->GetElement(&ctx, req, &resp);
+    if (!s.ok()) {
+      return grpc_util::WrapError(
+          absl::StrCat("Failed to get element from sibling worker ",
+                       sibling_address_),
+          s);
+    }
+    if (resp.end_of_sequence() || resp.skip_task() ||
+        resp.element_index() != static_cast<int64_t>(element_index)) {
+      return std::optional<GetElementResult>();
+    }
+    GetElementResult result;
+    result.element_index = resp.element_index();
+    switch (resp.element_case()) {
+      case GetElementResponse::kCompressed: {
+        Tensor tensor(DT_VARIANT, TensorShape{});
+        tensor.scalar<Variant>()() = std::move(resp.compressed());
+        result.components.push_back(tensor);
+        break;
+      }
+      case GetElementResponse::kUncompressed:
+        for (const auto& component : resp.uncompressed().components()) {
+          result.components.emplace_back();
+          if (!result.components.back().FromProto(component)) {
+            return errors::Internal(
+                "Failed to parse tensor from sibling worker ",
+                sibling_address_);
+          }
+        }
+        break;
+      case GetElementResponse::ELEMENT_NOT_SET:
+        break;
+    }
+    return std::optional<GetElementResult>(std::move(result));
+  }
+
+ private:
+  absl::Status EnsureStubInitialized() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (stub_) {
+      return absl::OkStatus();
+    }
+    std::shared_ptr<grpc::ChannelCredentials> credentials;
+    TF_RETURN_IF_ERROR(
+        CredentialsFactory::CreateClientCredentials(protocol_, &credentials));
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(-1);
+    auto channel =
+        grpc::CreateCustomChannel(sibling_address_, credentials, args);
+    stub_ = WorkerService::NewStub(channel);
+    return absl::OkStatus();
+  }
+
+  const std::string protocol_;
+  const std::string sibling_address_;
+  const int64_t sibling_task_id_;
+  const std::string trainer_id_;
+
+  mutex mu_;
+  std::unique_ptr<WorkerService::Stub> stub_ TF_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 StandaloneTaskIterator::StandaloneTaskIterator(
@@ -100,8 +201,13 @@ absl::Status TaskRunner::Create(const experimental::WorkerConfig& worker_config,
         worker_config.cross_trainer_cache_size_bytes() > 0
             ? worker_config.cross_trainer_cache_size_bytes()
             : kDefaultCrossTrainerCacheSizeBytes;
-    out = std::make_unique<CachingTaskRunner>(std::move(iterator),
-                                              max_cache_size_bytes);
+    std::unique_ptr<CrossTrainerCacheRemoteTier<GetElementResult>> remote_tier;
+    if (!worker_config.cross_trainer_cache_sibling_address().empty()) {
+      remote_tier =
+          std::make_unique<SiblingWorkerCacheTier>(worker_config, task_def);
+    }
+    out = std::make_unique<CachingTaskRunner>(
+        std::move(iterator), max_cache_size_bytes, std::move(remote_tier));
   } else {
     out = std::make_unique<FirstComeFirstServedTaskRunner>(std::move(iterator));
   }
@@ -177,11 +283,13 @@ std::shared_ptr<model::Model> FirstComeFirstServedTaskRunner::model() const {
   return model_;
 }
 
-CachingTaskRunner::CachingTaskRunner(std::unique_ptr<TaskIterator> iterator,
-                                     size_t max_cache_size_bytes)
+CachingTaskRunner::CachingTaskRunner(
+    std::unique_ptr<TaskIterator> iterator, size_t max_cache_size_bytes,
+    std::unique_ptr<CrossTrainerCacheRemoteTier<GetElementResult>> remote_tier)
     : fcfs_task_runner_(std::move(iterator)),
       cache_(max_cache_size_bytes,
-             std::make_unique<GetElementResultSequence>(fcfs_task_runner_)) {
+             std::make_unique<GetElementResultSequence>(fcfs_task_runner_),
+             std::move(remote_tier)) {
   LOG(INFO) << "Initialized tf.data service cross-trainer cache with "
             << ByteSize::Bytes(max_cache_size_bytes) << " of memory.";
 }
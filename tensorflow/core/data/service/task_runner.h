@@ -154,8 +154,12 @@ class FirstComeFirstServedTaskRunner : public TaskRunner {
 // read the full dataset.
 class CachingTaskRunner : public TaskRunner {
  public:
-  explicit CachingTaskRunner(std::unique_ptr<TaskIterator> iterator,
-                             size_t max_cache_size_bytes);
+  // If `remote_tier` is non-null, cache misses are first read from it (e.g.
+  // from a sibling worker's cache) before being computed from `iterator`.
+  explicit CachingTaskRunner(
+      std::unique_ptr<TaskIterator> iterator, size_t max_cache_size_bytes,
+      std::unique_ptr<CrossTrainerCacheRemoteTier<GetElementResult>>
+          remote_tier = nullptr);
   ~CachingTaskRunner() override;
 
   // Gets the next element from the cross-trainer cache, blocking if the data is
@@ -483,6 +483,7 @@ absl::Status DataServiceWorkerImpl::GetElement(const GetElementRequest* request,
   TF_RETURN_IF_ERROR(GetElementResult(request, &result));
   response->set_end_of_sequence(result.end_of_sequence);
   response->set_skip_task(result.skip);
+  response->set_element_index(result.element_index);
   if (!response->end_of_sequence() && !response->skip_task()) {
     TF_RETURN_IF_ERROR(
         MoveElementToResponse(std::move(result.components), *response));
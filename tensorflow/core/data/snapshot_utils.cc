@@ -128,6 +128,10 @@ absl::Status Writer::Create(Env* env, const std::string& filename,
       *out_writer =
           std::make_unique<TFRecordWriter>(filename, compression_type);
       break;
+    case 3:
+      *out_writer =
+          std::make_unique<ColumnarWriter>(filename, compression_type, dtypes);
+      break;
     default:
       return errors::InvalidArgument("Snapshot writer version: ", version,
                                      " is not supported.");
@@ -200,6 +204,56 @@ TFRecordWriter::~TFRecordWriter() {
   }
 }
 
+std::string ColumnFileName(const std::string& filename, int column_index) {
+  if (column_index == 0) {
+    return filename;
+  }
+  return absl::StrCat(filename, ".column_", column_index);
+}
+
+ColumnarWriter::ColumnarWriter(const std::string& filename,
+                               const std::string& compression_type,
+                               const DataTypeVector& dtypes)
+    : filename_(filename),
+      compression_type_(compression_type),
+      dtypes_(dtypes) {}
+
+absl::Status ColumnarWriter::Initialize(tensorflow::Env* env) {
+  column_writers_.reserve(dtypes_.size());
+  for (int i = 0; i < dtypes_.size(); ++i) {
+    column_writers_.push_back(std::make_unique<TFRecordWriter>(
+        ColumnFileName(filename_, i), compression_type_));
+    TF_RETURN_IF_ERROR(column_writers_.back()->Initialize(env));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ColumnarWriter::WriteTensors(const std::vector<Tensor>& tensors) {
+  if (tensors.size() != column_writers_.size()) {
+    return errors::InvalidArgument(
+        "Columnar snapshot writer expected an element with ",
+        column_writers_.size(), " components but got ", tensors.size(), ".");
+  }
+  for (int i = 0; i < tensors.size(); ++i) {
+    TF_RETURN_IF_ERROR(column_writers_[i]->WriteTensors({tensors[i]}));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ColumnarWriter::Sync() {
+  for (auto& column_writer : column_writers_) {
+    TF_RETURN_IF_ERROR(column_writer->Sync());
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ColumnarWriter::Close() {
+  for (auto& column_writer : column_writers_) {
+    TF_RETURN_IF_ERROR(column_writer->Close());
+  }
+  return absl::OkStatus();
+}
+
 CustomWriter::CustomWriter(const std::string& filename,
                            const std::string& compression_type,
                            const DataTypeVector& dtypes)
@@ -378,6 +432,10 @@ absl::Status Reader::Create(Env* env, const std::string& filename,
       *out_reader =
           std::make_unique<TFRecordReader>(filename, compression_type, dtypes);
       break;
+    case 3:
+      *out_reader =
+          std::make_unique<ColumnarReader>(filename, compression_type, dtypes);
+      break;
     default:
       return errors::InvalidArgument("Snapshot reader version: ", version,
                                      " is not supported.");
@@ -808,6 +866,47 @@ absl::Status TFRecordReader::ReadTensors(std::vector<Tensor>* read_tensors) {
   return absl::OkStatus();
 }
 
+ColumnarReader::ColumnarReader(const std::string& filename,
+                               const string& compression,
+                               const DataTypeVector& dtypes,
+                               std::vector<int> columns)
+    : filename_(filename),
+      compression_(compression),
+      dtypes_(dtypes),
+      columns_(std::move(columns)) {}
+
+absl::Status ColumnarReader::Initialize(Env* env) {
+  std::vector<int> columns = columns_;
+  if (columns.empty()) {
+    for (int i = 0; i < dtypes_.size(); ++i) {
+      columns.push_back(i);
+    }
+  }
+  column_readers_.reserve(columns.size());
+  for (int column : columns) {
+    if (column < 0 || column >= dtypes_.size()) {
+      return errors::InvalidArgument(
+          "Columnar snapshot reader column index ", column,
+          " is out of range for an element with ", dtypes_.size(),
+          " components.");
+    }
+    column_readers_.push_back(std::make_unique<TFRecordReaderImpl>(
+        ColumnFileName(filename_, column), compression_));
+    TF_RETURN_IF_ERROR(column_readers_.back()->Initialize(env));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status ColumnarReader::ReadTensors(std::vector<Tensor>* read_tensors) {
+  read_tensors->clear();
+  read_tensors->reserve(column_readers_.size());
+  for (auto& column_reader : column_readers_) {
+    TF_ASSIGN_OR_RETURN(Tensor tensor, column_reader->GetNext());
+    read_tensors->push_back(std::move(tensor));
+  }
+  return absl::OkStatus();
+}
+
 CustomReader::CustomReader(const std::string& filename,
                            const string& compression_type, const int version,
                            const DataTypeVector& dtypes)
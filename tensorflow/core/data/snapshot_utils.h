@@ -129,6 +129,38 @@ class TFRecordWriter : public Writer {
   std::unique_ptr<io::RecordWriter> record_writer_;
 };
 
+// Returns the name of the file holding column `column_index` of a columnar
+// snapshot whose base file name is `filename`. Column 0 lives in the base
+// file itself so that directory listings keep seeing one file per checkpoint.
+std::string ColumnFileName(const std::string& filename, int column_index);
+
+// Writes snapshots in a columnar layout: each component of an element is
+// appended to its own TFRecord stream and compressed independently of the
+// other components. Readers that need only a subset of components then do
+// I/O and decompression proportional to the columns they select.
+class ColumnarWriter : public Writer {
+ public:
+  ColumnarWriter(const std::string& filename,
+                 const std::string& compression_type,
+                 const DataTypeVector& dtypes);
+
+  absl::Status Initialize(tensorflow::Env* env) override;
+
+  absl::Status WriteTensors(const std::vector<Tensor>& tensors) override;
+
+  absl::Status Sync() override;
+
+  absl::Status Close() override;
+
+  ~ColumnarWriter() override = default;
+
+ private:
+  const std::string filename_;
+  const std::string compression_type_;
+  const DataTypeVector dtypes_;
+  std::vector<std::unique_ptr<TFRecordWriter>> column_writers_;
+};
+
 // Writes snapshot with a custom (legacy) file format.
 class CustomWriter : public Writer {
  public:
@@ -310,6 +342,31 @@ class TFRecordReader : public Reader {
   const DataTypeVector dtypes_;
 };
 
+// Reads snapshots previously written with `ColumnarWriter`. If `columns` is
+// non-empty, only those components are read and returned, in the given order;
+// the other column files are never opened, so consumers that project a subset
+// of features do proportional I/O.
+class ColumnarReader : public Reader {
+ public:
+  ColumnarReader(const std::string& filename, const string& compression,
+                 const DataTypeVector& dtypes, std::vector<int> columns = {});
+
+  // Initializes the reader, opening one reader per selected column.
+  absl::Status Initialize(Env* env) override;
+
+  // Reads the selected components of the next element into `read_tensors`.
+  // Returns OK on success, OutOfRange for end of file, or an error status if
+  // there is an error.
+  absl::Status ReadTensors(std::vector<Tensor>* read_tensors) override;
+
+ private:
+  const std::string filename_;
+  const string compression_;
+  const DataTypeVector dtypes_;
+  const std::vector<int> columns_;
+  std::vector<std::unique_ptr<TFRecordReaderImpl>> column_readers_;
+};
+
 // Reads snapshots previously written with `CustomWriter`.
 class CustomReader : public Reader {
  public:
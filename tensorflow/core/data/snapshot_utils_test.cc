@@ -19,6 +19,8 @@ limitations under the License.
 #include <string>
 #include <vector>
 
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "tensorflow/core/data/service/test_util.h"
 #include "tensorflow/core/framework/tensor.pb.h"
 #include "tensorflow/core/lib/core/status_test_util.h"
@@ -87,6 +89,9 @@ void SnapshotRoundTrip(std::string compression_type, int version) {
   }
 
   TF_ASSERT_OK(Env::Default()->DeleteFile(filename));
+  for (int i = 1; i < dtypes.size(); ++i) {
+    Env::Default()->DeleteFile(ColumnFileName(filename, i)).IgnoreError();
+  }
 }
 
 TEST(SnapshotUtilTest, CombinationRoundTripTest) {
@@ -97,6 +102,50 @@ TEST(SnapshotUtilTest, CombinationRoundTripTest) {
   SnapshotRoundTrip(io::compression::kNone, 2);
   SnapshotRoundTrip(io::compression::kGzip, 2);
   SnapshotRoundTrip(io::compression::kSnappy, 2);
+
+  SnapshotRoundTrip(io::compression::kNone, 3);
+  SnapshotRoundTrip(io::compression::kGzip, 3);
+  SnapshotRoundTrip(io::compression::kSnappy, 3);
+}
+
+TEST(SnapshotUtilTest, ColumnarReaderProjectsColumns) {
+  std::vector<Tensor> tensors;
+  tensorflow::DataTypeVector dtypes;
+  GenerateTensorVector(dtypes, tensors);
+  // Make the columns distinguishable.
+  for (int i = 0; i < tensors.size(); ++i) {
+    tensors[i] = Tensor(absl::StrCat("Column ", i));
+  }
+
+  std::string filename;
+  EXPECT_TRUE(Env::Default()->LocalTempFilename(&filename));
+
+  std::unique_ptr<Writer> writer;
+  TF_ASSERT_OK(Writer::Create(Env::Default(), filename, io::compression::kGzip,
+                              /*version=*/3, dtypes, &writer));
+  for (int i = 0; i < 10; ++i) {
+    TF_ASSERT_OK(writer->WriteTensors(tensors));
+  }
+  TF_ASSERT_OK(writer->Close());
+
+  // Reading a projection only opens the selected column files.
+  ColumnarReader reader(filename, io::compression::kGzip, dtypes,
+                        /*columns=*/{7, 2});
+  TF_ASSERT_OK(reader.Initialize(Env::Default()));
+  for (int i = 0; i < 10; ++i) {
+    std::vector<Tensor> read_tensors;
+    TF_ASSERT_OK(reader.ReadTensors(&read_tensors));
+    ASSERT_EQ(read_tensors.size(), 2);
+    EXPECT_EQ(read_tensors[0].scalar<tstring>()(), "Column 7");
+    EXPECT_EQ(read_tensors[1].scalar<tstring>()(), "Column 2");
+  }
+  std::vector<Tensor> unused;
+  EXPECT_TRUE(absl::IsOutOfRange(reader.ReadTensors(&unused)));
+
+  TF_ASSERT_OK(Env::Default()->DeleteFile(filename));
+  for (int i = 1; i < dtypes.size(); ++i) {
+    Env::Default()->DeleteFile(ColumnFileName(filename, i)).IgnoreError();
+  }
 }
 
 TEST(SnapshotUtilTest, MetadataFileRoundTrip) {
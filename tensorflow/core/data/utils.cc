@@ -44,7 +44,14 @@ std::string LocalityOptimizedPath(const std::string& path) { return path; }
 absl::StatusOr<bool> DisableCompressionAtRuntime(
     const std::string& data_transfer_protocol, DeploymentMode deployment_mode,
     DataServiceMetadata::Compression compression) {
-  return false;
+  if (compression != DataServiceMetadata::COMPRESSION_SNAPPY) {
+    return false;
+  }
+  // When the client is restricted to workers in its own process (the "local"
+  // data transfer protocol, see `kLocalTransferProtocol` in
+  // data/service/worker_client.h), elements are handed over as in-memory
+  // tensors and never cross the wire, so compressing them is pure overhead.
+  return data_transfer_protocol == "local";
 }
 
 void LogFilenames(const std::vector<std::string>& files) {}
@@ -55,6 +55,27 @@ TEST(LocalityOptimizedPath, TfDataPath) {
   EXPECT_EQ(LocalityOptimizedPath(file), file);
 }
 
+TEST(DisableCompressionAtRuntime, LocalProtocol) {
+  EXPECT_TRUE(DisableCompressionAtRuntime(
+                  "local", DEPLOYMENT_MODE_COLOCATED,
+                  DataServiceMetadata::COMPRESSION_SNAPPY)
+                  .value());
+}
+
+TEST(DisableCompressionAtRuntime, GrpcProtocol) {
+  EXPECT_FALSE(DisableCompressionAtRuntime(
+                   "grpc", DEPLOYMENT_MODE_COLOCATED,
+                   DataServiceMetadata::COMPRESSION_SNAPPY)
+                   .value());
+}
+
+TEST(DisableCompressionAtRuntime, CompressionOff) {
+  EXPECT_FALSE(DisableCompressionAtRuntime(
+                   "local", DEPLOYMENT_MODE_COLOCATED,
+                   DataServiceMetadata::COMPRESSION_OFF)
+                   .value());
+}
+
 TEST(LocalityOptimizedPath, LogFilenames) {
   EXPECT_NO_FATAL_FAILURE(LogFilenames(
       std::vector<std::string>({"/path/file1", "file2.txt", "a"})));
@@ -161,6 +161,20 @@ class BaseRemoteRendezvous : public RemoteRendezvous {
   void RecvLocalAsync(const ParsedKey& parsed, DoneCallback done);
 
  protected:
+  // Initiates the transfer of a remotely-produced tensor, typically by
+  // issuing a RecvTensor RPC to the producing worker.
+  //
+  // The transfer is pull-based: the RPC is issued as soon as the consuming
+  // RecvOp executes, and the producing worker parks the request (see
+  // RecvLocalAsync) until the tensor is Send()'d, so the network round trip
+  // already overlaps with producer compute. Transfers are tensor-granular,
+  // however: a producer publishes a tensor to the rendezvous exactly once,
+  // after the producing kernel completes, so compute and wire transfer cannot
+  // overlap *within* a single tensor. Streaming partially-complete tensors
+  // (e.g. finished row ranges of a large gradient) would require partial
+  // publication in the producer kernel contract and a chunked RecvTensor
+  // protocol, neither of which exists today; splitting the tensor in the
+  // graph is the supported way to get sub-tensor pipelining.
   virtual void RecvFromRemoteAsync(const Rendezvous::ParsedKey& parsed,
                                    const Rendezvous::Args& args,
                                    DoneCallback done) = 0;
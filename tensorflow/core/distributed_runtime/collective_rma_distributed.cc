@@ -14,8 +14,12 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/distributed_runtime/collective_rma_distributed.h"
 
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "tensorflow/core/common_runtime/base_collective_executor.h"
 #include "tensorflow/core/common_runtime/copy_tensor.h"
@@ -26,23 +30,158 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/cancellable_call.h"
 #include "tensorflow/core/distributed_runtime/request_id.h"
 #include "tensorflow/core/distributed_runtime/worker_cache.h"
+#include "tensorflow/core/framework/allocation_description.pb.h"
+#include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/cancellation.h"
 #include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/protobuf_internal.h"
 #include "tensorflow/core/profiler/lib/scoped_memory_debug_annotation.h"
 #include "tensorflow/core/protobuf/transport_options.pb.h"
 #include "tensorflow/core/protobuf/worker.pb.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 
 namespace {
 
+// Chunk size in bytes for splitting one large tensor transfer into several
+// concurrent RecvBuf RPCs, so that network receive on this side overlaps
+// with reads of later chunks on the peer.  Zero (the default) preserves the
+// single-RPC behavior.  Both workers must run a version that understands
+// chunked RecvBuf requests for this to be enabled safely.
+int64_t RecvBufChunkBytes() {
+  static const int64_t chunk_bytes = []() {
+    int64_t bytes;
+    TF_CHECK_OK(ReadInt64FromEnvVar("TF_COLLECTIVE_RECV_BUF_CHUNK_BYTES",
+                                    /*default_val=*/0, &bytes));
+    return bytes;
+  }();
+  return chunk_bytes;
+}
+
+// Upper bound on the number of staging buffers retained per size class by
+// StagingBufferPool.  Zero (the default) disables pooling and staging
+// buffers are allocated directly from the device allocator per transfer.
+int64_t StagingBufferPoolLimit() {
+  static const int64_t limit = []() {
+    int64_t v;
+    TF_CHECK_OK(ReadInt64FromEnvVar("TF_COLLECTIVE_STAGING_BUFFER_POOL_SIZE",
+                                    /*default_val=*/0, &v));
+    return v;
+  }();
+  return limit;
+}
+
+// Process-wide cache of the CPU staging buffers used for GPU-destined
+// RecvBuf transfers.  Buffers are retained across steps keyed by
+// (allocator, size class), so steady-state collective steps with stable
+// transfer sizes reuse the same gpu-registered memory instead of going to
+// the allocator on every exchange, which shows up as stragglers in
+// all-reduce timing when the allocator is under concurrent load.
+class StagingBufferPool {
+ public:
+  static StagingBufferPool* Global() {
+    static StagingBufferPool* pool = new StagingBufferPool;
+    return pool;
+  }
+
+  // Rounds `bytes` up to a power of two so that steps with stable transfer
+  // sizes map onto a small set of free lists.
+  static size_t SizeClass(size_t bytes) {
+    size_t size_class = 1024;
+    while (size_class < bytes) size_class <<= 1;
+    return size_class;
+  }
+
+  void* Allocate(Allocator* allocator, size_t size_class) {
+    {
+      mutex_lock l(mu_);
+      auto it = free_lists_.find(std::make_pair(allocator, size_class));
+      if (it != free_lists_.end() && !it->second.empty()) {
+        void* ptr = it->second.back();
+        it->second.pop_back();
+        return ptr;
+      }
+    }
+    return allocator->AllocateRaw(Allocator::kAllocatorAlignment, size_class);
+  }
+
+  void Release(Allocator* allocator, size_t size_class, void* ptr) {
+    {
+      mutex_lock l(mu_);
+      std::vector<void*>& free_list =
+          free_lists_[std::make_pair(allocator, size_class)];
+      if (static_cast<int64_t>(free_list.size()) < StagingBufferPoolLimit()) {
+        free_list.push_back(ptr);
+        return;
+      }
+    }
+    allocator->DeallocateRaw(ptr);
+  }
+
+ private:
+  mutex mu_;
+  absl::flat_hash_map<std::pair<Allocator*, size_t>, std::vector<void*>>
+      free_lists_ TF_GUARDED_BY(mu_);
+};
+
+// TensorBuffer that returns its memory to the staging buffer pool when the
+// last Tensor referencing it goes away.
+class PooledStagingBuffer : public TensorBuffer {
+ public:
+  PooledStagingBuffer(Allocator* allocator, size_t size_class, void* data)
+      : TensorBuffer(data), allocator_(allocator), size_class_(size_class) {}
+
+  ~PooledStagingBuffer() override {
+    StagingBufferPool::Global()->Release(allocator_, size_class_, data());
+  }
+
+  size_t size() const override { return size_class_; }
+  TensorBuffer* root_buffer() override { return this; }
+  void FillAllocationDescription(AllocationDescription* proto) const override {
+    proto->set_requested_bytes(size_class_);
+    proto->set_allocator_name(allocator_->Name());
+  }
+
+ private:
+  Allocator* const allocator_;
+  const size_t size_class_;
+};
+
+// Returns a staging tensor of the given type and shape backed by
+// `allocator`.  With pooling enabled the backing memory is drawn from (and
+// eventually returned to) the process-wide staging buffer pool; otherwise
+// this is an ordinary allocation released with the tensor.
+std::unique_ptr<Tensor> AllocateStagingTensor(Allocator* allocator,
+                                              DataType dtype,
+                                              const TensorShape& shape) {
+  const int64_t dtype_size = DataTypeSize(dtype);
+  if (StagingBufferPoolLimit() > 0 && dtype_size > 0) {
+    const size_t size_class =
+        StagingBufferPool::SizeClass(shape.num_elements() * dtype_size);
+    void* data = StagingBufferPool::Global()->Allocate(allocator, size_class);
+    if (data != nullptr) {
+      auto* buf = new PooledStagingBuffer(allocator, size_class, data);
+      auto tensor = std::make_unique<Tensor>(dtype, shape, buf);
+      buf->Unref();
+      return tensor;
+    }
+  }
+  return std::make_unique<Tensor>(allocator, dtype, shape);
+}
+
 class RecvBufCall : public CancellableCall {
  public:
+  // Requests the [offset, offset + num_bytes) byte range of the buffer
+  // identified by `key`.  For an unchunked transfer offset is 0, num_bytes
+  // is the whole buffer and num_chunks is 1.
   RecvBufCall(int64_t step_id, const string& peer_device,
               const string& peer_task, const string& key, Device* to_device,
               DeviceContext* to_device_ctx,
               const AllocatorAttributes& to_alloc_attr, Tensor* to_tensor,
+              int64_t offset, int64_t num_bytes, int32_t num_chunks,
               const DeviceLocality& client_locality,
               const DeviceAttributes& server_attributes,
               CancellationManager* cancel_mgr, WorkerCacheInterface* wc)
@@ -51,12 +190,17 @@ class RecvBufCall : public CancellableCall {
     req_.set_buf_rendezvous_key(key);
     *req_.mutable_client_locality() = client_locality;
     *req_.mutable_server_locality() = server_attributes.locality();
-    req_.set_num_bytes(to_tensor->TotalBytes());
-    req_.set_buf_ptr(reinterpret_cast<int64_t>(DMAHelper::base(to_tensor)));
+    req_.set_num_bytes(num_bytes);
+    req_.set_buf_ptr(reinterpret_cast<int64_t>(
+        reinterpret_cast<char*>(DMAHelper::base(to_tensor)) + offset));
     req_.set_src_device(peer_device);
     req_.set_src_incarnation(server_attributes.incarnation());
     req_.set_dst_device(to_device->name());
     req_.set_request_id(GetUniqueRequestId());
+    if (num_chunks > 1) {
+      req_.set_offset(offset);
+      req_.set_num_chunks(num_chunks);
+    }
   }
 
   ~RecvBufCall() override {}
@@ -104,6 +248,36 @@ absl::Status PopulateTensorFromResponse(const RecvBufResponse& response,
   return absl::OkStatus();
 }
 
+// Scatters the bytes of one chunk response into *cpu_tensor at byte
+// `offset`.  As in PopulateTensorFromResponse, absent transport options
+// mean the bytes were already copied into the buf_ptr from the request,
+// which for a chunk request points at the slice's offset.
+absl::Status PopulateTensorSliceFromResponse(const RecvBufResponse& response,
+                                             Tensor* cpu_tensor,
+                                             int64_t offset,
+                                             int64_t expected_bytes) {
+  if (!response.has_transport_options()) return absl::OkStatus();
+
+  RecvBufRespExtra extra;
+  response.transport_options().UnpackTo(&extra);
+  int64_t num_bytes = 0;
+  for (const auto& chunk : extra.tensor_content()) {
+    num_bytes += chunk.size();
+  }
+  if (num_bytes != expected_bytes) {
+    return errors::Internal("Tensor Size Mismatch: RecvBufResponse returned ",
+                            num_bytes, " bytes for chunk at offset ", offset,
+                            ", expected: ", expected_bytes);
+  }
+  char* head = reinterpret_cast<char*>(DMAHelper::base(cpu_tensor)) + offset;
+  for (const auto& tensor_content_chunk : extra.tensor_content()) {
+    memcpy(head, std::string(tensor_content_chunk).data(),
+           tensor_content_chunk.size());
+    head += tensor_content_chunk.size();
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace
 
 void CollectiveRemoteAccessDistributed::RecvFromPeer(
@@ -158,14 +332,113 @@ void CollectiveRemoteAccessDistributed::RecvFromPeer(
         step_id_, "dynamic", to_tensor->dtype(),
         [to_tensor]() { return to_tensor->shape().DebugString(); });
 
-    state->cpu_tensor =
-        std::make_unique<Tensor>(cpu_dev->GetAllocator(cpu_attr),
-                                 to_tensor->dtype(), to_tensor->shape());
+    state->cpu_tensor = AllocateStagingTensor(
+        cpu_dev->GetAllocator(cpu_attr), to_tensor->dtype(),
+        to_tensor->shape());
     dst_tensor = state->cpu_tensor.get();
   } else {
     dst_tensor = to_tensor;
   }
 
+  const int64_t total_bytes = dst_tensor->TotalBytes();
+  const int64_t configured_chunk_bytes = RecvBufChunkBytes();
+  int64_t num_chunks =
+      configured_chunk_bytes > 0
+          ? (total_bytes + configured_chunk_bytes - 1) / configured_chunk_bytes
+          : 1;
+  // Cap the number of concurrent RPCs; with very small configured chunk
+  // sizes the per-RPC overhead would otherwise dominate.
+  constexpr int64_t kMaxRecvBufChunks = 16;
+  num_chunks = std::min(num_chunks, kMaxRecvBufChunks);
+  if (num_chunks > 1) {
+    // Chunked transfer: issue all chunk RPCs concurrently so that network
+    // receive, response unpacking and the peer-side reads pipeline within
+    // this single tensor.  Each response is scattered into dst_tensor at
+    // its byte offset; the device copy happens once after the last chunk
+    // lands.  Every chunk RPC runs to completion even after a failure so
+    // that the server can release the buffer it parks for this transfer.
+    const int64_t chunk_bytes = (total_bytes + num_chunks - 1) / num_chunks;
+    // Recompute the chunk count so that no chunk starts past the end of the
+    // buffer after rounding chunk_bytes up.
+    num_chunks = (total_bytes + chunk_bytes - 1) / chunk_bytes;
+    struct ChunkState {
+      mutex mu;
+      int64_t chunks_done TF_GUARDED_BY(mu) = 0;
+      absl::Status status TF_GUARDED_BY(mu);
+      std::vector<std::unique_ptr<RecvBufCall>> calls;
+    };
+    ChunkState* cs = new ChunkState;
+    cs->calls.reserve(num_chunks);
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      const int64_t offset = i * chunk_bytes;
+      cs->calls.push_back(std::make_unique<RecvBufCall>(
+          step_id_, peer_device, peer_task, key, to_device, to_device_ctx,
+          to_alloc_attr, dst_tensor, offset,
+          std::min(chunk_bytes, total_bytes - offset),
+          static_cast<int32_t>(num_chunks), client_locality,
+          state->server_attributes, cancellation_manager, worker_cache_));
+    }
+    CancellationToken abortion_token =
+        abortion_cancel_mgr_.get_cancellation_token();
+    bool already_aborted = !abortion_cancel_mgr_.RegisterCallback(
+        abortion_token, [cs] {
+          for (auto& call : cs->calls) call->Cancel();
+        });
+    if (already_aborted) {
+      delete cs;
+      delete state;
+      done(errors::Cancelled("collective ops already aborted"));
+      return;
+    }
+    auto chunk_done = [this, state, cs, num_chunks, chunk_bytes, total_bytes,
+                       to_device, to_alloc_attr, to_device_ctx, to_tensor,
+                       cpu_dev, dev_to_dev_stream_index, dst_tensor,
+                       abortion_token, done](int64_t chunk_idx,
+                                             const absl::Status& s) {
+      absl::Status chunk_status = s;
+      if (chunk_status.ok()) {
+        const int64_t offset = chunk_idx * chunk_bytes;
+        chunk_status = PopulateTensorSliceFromResponse(
+            cs->calls[chunk_idx]->resp_, dst_tensor, offset,
+            std::min(chunk_bytes, total_bytes - offset));
+      }
+      absl::Status status;
+      bool last = false;
+      {
+        mutex_lock l(cs->mu);
+        if (!chunk_status.ok() && cs->status.ok()) cs->status = chunk_status;
+        ++cs->chunks_done;
+        last = (cs->chunks_done == num_chunks);
+        status = cs->status;
+      }
+      if (!last) return;
+      abortion_cancel_mgr_.DeregisterCallback(abortion_token);
+      delete cs;
+      if (status.ok() && to_device->tensorflow_accelerator_device_info()) {
+        AllocatorAttributes cpu_attr;
+        cpu_attr.set_gpu_compatible(true);
+        CopyTensor::ViaDMA("",  // edge name (non-existent)
+                           nullptr /*send_dev_ctx*/, to_device_ctx, cpu_dev,
+                           to_device, cpu_attr, to_alloc_attr, dst_tensor,
+                           to_tensor, dev_to_dev_stream_index,
+                           [this, state, done](const absl::Status& s) {
+                             delete state;
+                             // This callback must not block, so execute
+                             // done in another thread.
+                             work_queue_->Schedule([s, done] { done(s); });
+                           });
+        return;
+      }
+      delete state;
+      done(status);
+    };
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      cs->calls[i]->Start(
+          [chunk_done, i](const absl::Status& s) { chunk_done(i, s); });
+    }
+    return;
+  }
+
   // Logic to be executed on the RecvBufAsync callback.
   auto recv_buf_callback =
       [this, state, to_device, to_alloc_attr, to_device_ctx, to_tensor, cpu_dev,
@@ -213,8 +486,9 @@ void CollectiveRemoteAccessDistributed::RecvFromPeer(
 
   state->call = std::make_unique<RecvBufCall>(
       step_id_, peer_device, peer_task, key, to_device, to_device_ctx,
-      to_alloc_attr, dst_tensor, client_locality, state->server_attributes,
-      cancellation_manager, worker_cache_);
+      to_alloc_attr, dst_tensor, /*offset=*/0, total_bytes, /*num_chunks=*/1,
+      client_locality, state->server_attributes, cancellation_manager,
+      worker_cache_);
   CancellationToken abortion_token =
       abortion_cancel_mgr_.get_cancellation_token();
   bool already_aborted = !abortion_cancel_mgr_.RegisterCallback(
@@ -0,0 +1,170 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/distributed_runtime/coordination/coordination_service_host_barrier_proxy.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "xla/tsl/distributed_runtime/coordination/coordination_service_agent.h"
+#include "tensorflow/core/platform/platform.h"
+
+#if !defined(PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include "absl/log/log.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tsl/profiler/lib/traceme.h"
+#endif  // !defined(PLATFORM_WINDOWS)
+
+namespace tensorflow {
+
+#if defined(PLATFORM_WINDOWS)
+
+absl::Status WaitAtHostLocalBarrier(
+    tsl::CoordinationServiceAgent* agent,
+    const std::vector<CoordinatedTask>& representative_tasks,
+    int num_local_tasks, absl::string_view key, absl::Duration timeout) {
+  return absl::UnimplementedError(
+      "Host-local barrier aggregation is not supported on Windows");
+}
+
+#else  // !defined(PLATFORM_WINDOWS)
+
+namespace {
+
+// Layout of the per-barrier shared-memory segment.  shm_open creates it
+// zero-filled, so kPending must be 0.  Lock-free atomics are address-free
+// on all supported platforms and therefore safe across processes.
+constexpr int32_t kPending = 0;
+constexpr int32_t kPassed = 1;
+constexpr int32_t kFailed = 2;
+
+struct HostBarrierSegment {
+  std::atomic<int32_t> num_entered;
+  std::atomic<int32_t> state;       // kPending/kPassed/kFailed
+  std::atomic<int32_t> error_code;  // absl::StatusCode when kFailed
+  std::atomic<int32_t> num_exited;
+};
+
+std::string ShmNameForKey(absl::string_view key) {
+  // shm names must be short, start with '/' and contain no further
+  // slashes, so hash the barrier key.
+  return absl::StrCat("/tf_coord_barrier_", Fingerprint64(key));
+}
+
+}  // namespace
+
+absl::Status WaitAtHostLocalBarrier(
+    tsl::CoordinationServiceAgent* agent,
+    const std::vector<CoordinatedTask>& representative_tasks,
+    int num_local_tasks, absl::string_view key, absl::Duration timeout) {
+  if (num_local_tasks <= 1) {
+    // Nothing to aggregate on this host.
+    if (representative_tasks.size() <= 1) return absl::OkStatus();
+    return agent->WaitAtBarrier(key, timeout, representative_tasks);
+  }
+  tsl::profiler::TraceMe traceme("WaitAtHostLocalBarrier");
+
+  const std::string shm_name = ShmNameForKey(key);
+  int fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0) {
+    return absl::InternalError(absl::StrCat("shm_open failed for barrier key=",
+                                            key, ": ", strerror(errno)));
+  }
+  // Safe to call concurrently from every co-hosted task since the size is
+  // the same; the kernel zero-fills the segment on creation.
+  if (ftruncate(fd, sizeof(HostBarrierSegment)) != 0) {
+    absl::Status s = absl::InternalError(absl::StrCat(
+        "ftruncate failed for barrier key=", key, ": ", strerror(errno)));
+    close(fd);
+    return s;
+  }
+  void* mem = mmap(nullptr, sizeof(HostBarrierSegment),
+                   PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    return absl::InternalError(absl::StrCat("mmap failed for barrier key=",
+                                            key, ": ", strerror(errno)));
+  }
+  auto* segment = static_cast<HostBarrierSegment*>(mem);
+
+  const absl::Time deadline = absl::Now() + timeout;
+  const int32_t arrived =
+      segment->num_entered.fetch_add(1, std::memory_order_acq_rel) + 1;
+  VLOG(1) << "HostLocalBarrier " << key << " enter: arrived=" << arrived
+          << " of " << num_local_tasks;
+
+  absl::Status status;
+  if (arrived == num_local_tasks) {
+    // This task is the host representative: the only one that talks to the
+    // coordination leader for this barrier round.
+    if (representative_tasks.size() > 1) {
+      tsl::profiler::TraceMe wait_traceme(
+          "WaitAtHostLocalBarrier::WaitAtBarrier");
+      status = agent->WaitAtBarrier(key, timeout, representative_tasks);
+    }
+    segment->error_code.store(static_cast<int32_t>(status.code()),
+                              std::memory_order_relaxed);
+    segment->state.store(status.ok() ? kPassed : kFailed,
+                         std::memory_order_release);
+  } else {
+    // Poll the segment with backoff until the representative publishes the
+    // outcome.  Polling avoids process-shared mutexes, whose ownership is
+    // unrecoverable if a co-hosted task crashes while holding one.
+    int64_t sleep_micros = 100;
+    while (segment->state.load(std::memory_order_acquire) == kPending &&
+           absl::Now() < deadline) {
+      Env::Default()->SleepForMicroseconds(sleep_micros);
+      sleep_micros = std::min<int64_t>(sleep_micros * 2, 2000);
+    }
+    const int32_t state = segment->state.load(std::memory_order_acquire);
+    if (state == kPending) {
+      status = absl::DeadlineExceededError(
+          absl::StrCat("HostLocalBarrier timeout: key=", key));
+    } else if (state == kFailed) {
+      status = absl::Status(
+          static_cast<absl::StatusCode>(
+              segment->error_code.load(std::memory_order_relaxed)),
+          absl::StrCat("Coordination barrier failed: key=", key));
+    }
+  }
+
+  const int32_t exited =
+      segment->num_exited.fetch_add(1, std::memory_order_acq_rel) + 1;
+  munmap(mem, sizeof(HostBarrierSegment));
+  if (exited == num_local_tasks) {
+    // Last task out removes the segment so the key can be reused.
+    shm_unlink(shm_name.c_str());
+    VLOG(1) << "HostLocalBarrier " << key << " segment removed.";
+  }
+  return status;
+}
+
+#endif  // defined(PLATFORM_WINDOWS)
+
+}  // namespace tensorflow
@@ -0,0 +1,58 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_CORE_DISTRIBUTED_RUNTIME_COORDINATION_COORDINATION_SERVICE_HOST_BARRIER_PROXY_H_
+#define TENSORFLOW_CORE_DISTRIBUTED_RUNTIME_COORDINATION_COORDINATION_SERVICE_HOST_BARRIER_PROXY_H_
+
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "xla/tsl/distributed_runtime/coordination/coordination_service_agent.h"
+#include "xla/tsl/protobuf/coordination_service.pb.h"
+
+namespace tensorflow {
+
+// A host-local aggregation tier for the coordination service's barrier.
+// BarrierProxy aggregates threads within one task; this function aggregates
+// co-hosted *tasks* (processes).  The tasks on one host rendezvous in a
+// POSIX shared-memory segment keyed by the barrier key, and only the last
+// task to arrive -- the host representative -- issues WaitAtBarrier to the
+// coordination leader on behalf of the whole host.  Leader-side barrier
+// traffic therefore scales with the number of hosts rather than the number
+// of tasks, which matters for many-process-per-host CPU jobs.
+//
+// `representative_tasks` lists the tasks participating in the leader-side
+// barrier, one per host; any co-hosted task may end up acting as the
+// representative, so all of a host's tasks must be interchangeable from the
+// leader's point of view (e.g. list each host's task 0 and run the leader
+// barrier with per-host keys), or simply pass all tasks and accept that the
+// leader sees one early arrival per host.  If `representative_tasks` has at
+// most one entry the leader-side barrier is skipped entirely.
+// `num_local_tasks` is the number of co-hosted tasks expected to call this
+// function with the same `key`; keys must not be reused while a barrier
+// round with the same key is still in progress on the host.
+//
+// Returns the leader barrier's status to every co-hosted task, or
+// DeadlineExceeded if the host-local rendezvous does not complete within
+// `timeout`.  Not implemented on Windows.
+absl::Status WaitAtHostLocalBarrier(
+    tsl::CoordinationServiceAgent* agent,
+    const std::vector<CoordinatedTask>& representative_tasks,
+    int num_local_tasks, absl::string_view key, absl::Duration timeout);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_DISTRIBUTED_RUNTIME_COORDINATION_COORDINATION_SERVICE_HOST_BARRIER_PROXY_H_
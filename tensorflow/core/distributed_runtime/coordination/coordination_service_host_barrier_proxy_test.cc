@@ -0,0 +1,220 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/distributed_runtime/coordination/coordination_service_host_barrier_proxy.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+#include "xla/tsl/distributed_runtime/call_options.h"
+#include "xla/tsl/distributed_runtime/coordination/coordination_client.h"
+#include "xla/tsl/distributed_runtime/coordination/coordination_service_agent.h"
+#include "xla/tsl/protobuf/coordination_config.pb.h"
+#include "xla/tsl/protobuf/coordination_service.pb.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/platform/threadpool.h"
+
+namespace tensorflow {
+namespace {
+
+using ::testing::_;
+using ::testing::Return;
+using tsl::CallOptions;
+using tsl::CoordinationClient;
+using tsl::CoordinationServiceAgent;
+
+class MockCoordinationServiceAgent : public CoordinationServiceAgent {
+ public:
+  MOCK_METHOD(absl::Status, WaitAtBarrier,
+              (std::string_view barrier_id, absl::Duration timeout,
+               const std::vector<CoordinatedTask>& tasks),
+              (override));
+  MOCK_METHOD(absl::Status, CancelBarrier, (std::string_view barrier_id),
+              (override));
+
+  // All the following member functions are not needed for testing.
+  MOCK_METHOD(absl::Status, Initialize,
+              (Env * env, std::string_view job_name, int task_id,
+               const CoordinationServiceConfig& configs,
+               std::unique_ptr<CoordinationClient> leader_client,
+               StatusCallback error_fn, bool recoverable),
+              (override));
+  MOCK_METHOD(absl::Status, Initialize,
+              (Env * env, std::string_view job_name, int task_id,
+               const CoordinationServiceConfig& configs,
+               std::unique_ptr<CoordinationClient> leader_client,
+               StatusCallback error_fn),
+              (override));
+  MOCK_METHOD(absl::Status, Initialize,
+              (Env * env, const CoordinatedTask& task,
+               const CoordinationServiceConfig& configs,
+               std::unique_ptr<CoordinationClient> leader_client,
+               StatusCallback error_fn),
+              (override));
+  MOCK_METHOD(bool, IsInitialized, (), (override));
+  MOCK_METHOD(bool, IsConnected, (), (override));
+  MOCK_METHOD(bool, IsError, (), (override));
+  MOCK_METHOD(absl::Status, Connect, (), (override));
+  MOCK_METHOD(absl::Status, WaitForAllTasks, (const DeviceInfo& local_devices),
+              (override));
+  MOCK_METHOD(const DeviceInfo&, GetClusterDeviceInfo, (), (override));
+  MOCK_METHOD(absl::StatusOr<CoordinatedTask>, GetOwnTask, (), (override));
+  MOCK_METHOD(absl::StatusOr<std::vector<CoordinatedTaskStateInfo>>,
+              GetTaskState, (const std::vector<CoordinatedTask>& task),
+              (override));
+  MOCK_METHOD(absl::Status, ReportError, (const absl::Status& error),
+              (override));
+  MOCK_METHOD(absl::Status, Shutdown, (), (override));
+  MOCK_METHOD(absl::Status, Reset, (), (override));
+  MOCK_METHOD(absl::StatusOr<std::string>, GetKeyValue, (std::string_view key),
+              (override));
+  MOCK_METHOD(absl::StatusOr<std::string>, GetKeyValue,
+              (std::string_view key, absl::Duration timeout), (override));
+  MOCK_METHOD(std::shared_ptr<CallOptions>, GetKeyValueAsync,
+              (std::string_view key, StatusOrValueCallback done), (override));
+  MOCK_METHOD(absl::StatusOr<std::string>, TryGetKeyValue,
+              (std::string_view key), (override));
+  MOCK_METHOD(absl::StatusOr<std::vector<KeyValueEntry>>, GetKeyValueDir,
+              (std::string_view key), (override));
+  MOCK_METHOD(void, GetKeyValueDirAsync,
+              (std::string_view key, StatusOrValueDirCallback done),
+              (override));
+  MOCK_METHOD(absl::Status, InsertKeyValue,
+              (std::string_view key, std::string_view value), (override));
+  MOCK_METHOD(absl::Status, InsertKeyValue,
+              (std::string_view key, std::string_view value,
+               bool allow_overwrite),
+              (override));
+  MOCK_METHOD(absl::Status, DeleteKeyValue, (std::string_view key), (override));
+  MOCK_METHOD(absl::Status, UpdateKeyValue,
+              (std::string_view key, std::string_view value), (override));
+  MOCK_METHOD(absl::Status, StartWatchKey,
+              (std::string_view key, ChangedKeyValuesCallback on_change),
+              (override));
+  MOCK_METHOD(absl::Status, StopWatchKey, (std::string_view key), (override));
+  MOCK_METHOD(void, WaitAtBarrierAsync,
+              (std::string_view barrier_id, absl::Duration timeout,
+               const std::vector<CoordinatedTask>& tasks, StatusCallback done),
+              (override));
+  MOCK_METHOD(void, CancelBarrierAsync,
+              (std::string_view barrier_id, StatusCallback done), (override));
+  MOCK_METHOD(absl::StatusOr<std::vector<CoordinatedTask>>, GetAliveTasks,
+              (const std::vector<CoordinatedTask>& tasks), (override));
+  MOCK_METHOD(absl::StatusOr<Env*>, GetEnv, (), (override));
+  MOCK_METHOD(void, SetError, (const absl::Status& error), (override));
+  MOCK_METHOD(absl::Status, ActivateWatch,
+              (std::string_view key,
+               (const std::map<std::string, std::string>&)),
+              (override));
+};
+
+constexpr auto kTestTimeout = absl::Seconds(10);
+const int kThreadPoolSize = 32;
+
+// The host-local rendezvous goes through a shared-memory segment that works
+// identically across threads and across processes, so co-hosted tasks are
+// simulated with threads here.
+void TestHostLocalBarrierWait(const std::string& key, int num_hosts,
+                              int num_local_tasks, int num_tasks_entered,
+                              std::optional<absl::Status> agent_wait_status,
+                              const absl::Status& expected_status,
+                              absl::Duration timeout = kTestTimeout) {
+  auto agent = std::make_unique<MockCoordinationServiceAgent>();
+  const std::vector<CoordinatedTask> representative_tasks(num_hosts);
+  std::atomic<int> expected_status_count = 0;
+  // A round that times out leaves its shared-memory segment behind, so make
+  // keys unique across test runs.
+  const std::string full_key =
+      absl::StrCat(key, "_", Env::Default()->NowMicros());
+
+  if (agent_wait_status.has_value()) {
+    EXPECT_CALL(*agent, WaitAtBarrier(full_key, timeout, _))
+        .WillOnce(Return(agent_wait_status.value()));
+  } else {
+    EXPECT_CALL(*agent, WaitAtBarrier(_, _, _)).Times(0);
+  }
+
+  {
+    thread::ThreadPool pool(Env::Default(), /*name=*/"TestPool",
+                            kThreadPoolSize);
+    for (int i = 0; i < num_tasks_entered; ++i) {
+      pool.Schedule([&]() {
+        absl::Status status = WaitAtHostLocalBarrier(
+            agent.get(), representative_tasks, num_local_tasks, full_key,
+            timeout);
+        expected_status_count += (status.code() == expected_status.code());
+      });
+    }
+  }
+  ASSERT_EQ(expected_status_count, num_tasks_entered);
+}
+
+TEST(HostBarrierProxyTest, AllLocalTasksExitBarrier) {
+  TestHostLocalBarrierWait(
+      /*key=*/"all_local_tasks_exit", /*num_hosts=*/2, /*num_local_tasks=*/8,
+      /*num_tasks_entered=*/8,
+      /*agent_wait_status=*/absl::OkStatus(),
+      /*expected_status=*/absl::OkStatus());
+}
+
+TEST(HostBarrierProxyTest, AgentIsIgnoredIfThereIsOnlyOneHost) {
+  TestHostLocalBarrierWait(
+      /*key=*/"single_host", /*num_hosts=*/1, /*num_local_tasks=*/8,
+      /*num_tasks_entered=*/8,
+      /*agent_wait_status=*/{},
+      /*expected_status=*/absl::OkStatus());
+}
+
+TEST(HostBarrierProxyTest, AgentErrorBroadcastedToAllLocalTasks) {
+  TestHostLocalBarrierWait(
+      /*key=*/"agent_error_broadcasted", /*num_hosts=*/2,
+      /*num_local_tasks=*/8,
+      /*num_tasks_entered=*/8,
+      /*agent_wait_status=*/absl::InternalError("agent error"),
+      /*expected_status=*/absl::InternalError("agent error"));
+}
+
+TEST(HostBarrierProxyTest, TimeoutIfNotEnoughLocalTasksEntered) {
+  TestHostLocalBarrierWait(
+      /*key=*/"not_enough_local_tasks", /*num_hosts=*/2, /*num_local_tasks=*/8,
+      /*num_tasks_entered=*/7,
+      /*agent_wait_status=*/{},
+      /*expected_status=*/absl::DeadlineExceededError("timeout"),
+      /*timeout=*/absl::Seconds(1));
+}
+
+TEST(HostBarrierProxyTest, SingleLocalTaskWaitsDirectly) {
+  auto agent = std::make_unique<MockCoordinationServiceAgent>();
+  const std::vector<CoordinatedTask> representative_tasks(2);
+  EXPECT_CALL(*agent, WaitAtBarrier("single_local_task", kTestTimeout, _))
+      .WillOnce(Return(absl::OkStatus()));
+  TF_EXPECT_OK(WaitAtHostLocalBarrier(agent.get(), representative_tasks,
+                                      /*num_local_tasks=*/1,
+                                      "single_local_task", kTestTimeout));
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -16,7 +16,9 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/graph_mgr.h"
 
 #include <chrono>  // NOLINT(build/c++11)
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -52,6 +54,7 @@ limitations under the License.
 #include "tensorflow/core/framework/versions.pb.h"
 #include "tensorflow/core/graph/graph.h"
 #include "tensorflow/core/graph/graph_partition.h"
+#include "tensorflow/core/lib/core/blocking_counter.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/mutex.h"
@@ -105,6 +108,33 @@ static string SplitByDevice(const Node* node) {
   return node->assigned_device_name();
 }
 
+// Runs "fn" for indices [0, n) on "pool" and returns the first non-OK status,
+// if any. Runs inline when "pool" is null or there is a single index, so the
+// total work is the same as invoking the closures sequentially.
+static absl::Status RunForAllIndices(
+    thread::ThreadPool* pool, int n,
+    const std::function<absl::Status(int)>& fn) {
+  if (pool == nullptr || n <= 1) {
+    for (int i = 0; i < n; ++i) {
+      TF_RETURN_IF_ERROR(fn(i));
+    }
+    return absl::OkStatus();
+  }
+  std::vector<absl::Status> statuses(n);
+  BlockingCounter counter(n);
+  for (int i = 0; i < n; ++i) {
+    pool->Schedule([i, &fn, &statuses, &counter] {
+      statuses[i] = fn(i);
+      counter.DecrementCount();
+    });
+  }
+  counter.Wait();
+  for (const absl::Status& status : statuses) {
+    TF_RETURN_IF_ERROR(status);
+  }
+  return absl::OkStatus();
+}
+
 // Validates "gdef" device specifications.
 static absl::Status ValidateGraphDefForDevices(const GraphDef& gdef) {
   DeviceNameUtils::ParsedName parsed;
@@ -205,17 +235,27 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
     TF_RETURN_IF_ERROR(AddControlEdges(popts, &partitions));
   }
 
+  // Constructs each partition's graph in parallel on the worker's compute
+  // pool; partitions are independent of each other.
   std::unordered_map<string, std::unique_ptr<Graph>> partition_graphs;
+  std::vector<std::pair<GraphDef*, Graph*>> partition_defs;
+  partition_defs.reserve(partitions.size());
   for (auto& partition : partitions) {
-    std::unique_ptr<Graph> device_graph(new Graph(OpRegistry::Global()));
-    GraphConstructorOptions device_opts;
-    // There are internal operations (e.g., send/recv) that we now allow.
-    device_opts.allow_internal_ops = true;
-    device_opts.expect_device_spec = true;
-    TF_RETURN_IF_ERROR(ConvertGraphDefToGraph(
-        device_opts, std::move(partition.second), device_graph.get()));
+    auto device_graph = std::make_unique<Graph>(OpRegistry::Global());
+    partition_defs.emplace_back(&partition.second, device_graph.get());
     partition_graphs.emplace(partition.first, std::move(device_graph));
   }
+  TF_RETURN_IF_ERROR(RunForAllIndices(
+      worker_env_->compute_pool, static_cast<int>(partition_defs.size()),
+      [&partition_defs](int i) {
+        GraphConstructorOptions device_opts;
+        // There are internal operations (e.g., send/recv) that we now allow.
+        device_opts.allow_internal_ops = true;
+        device_opts.expect_device_spec = true;
+        return ConvertGraphDefToGraph(device_opts,
+                                      std::move(*partition_defs[i].first),
+                                      partition_defs[i].second);
+      }));
 
   GraphOptimizationPassOptions optimization_options;
   optimization_options.flib_def = item->lib_def.get();
@@ -223,26 +263,32 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
   TF_RETURN_IF_ERROR(OptimizationPassRegistry::Global()->RunGrouping(
       OptimizationPassRegistry::POST_PARTITIONING, optimization_options));
 
-  LocalExecutorParams params;
-
-  item->units.reserve(partitions.size());
   item->graph_mgr = this;
   const auto& optimizer_opts = graph_options.optimizer_options();
-  GraphOptimizer optimizer(optimizer_opts);
+
+  // Initializes each partition's execution unit in parallel on the worker's
+  // compute pool; graph optimization, kernel instantiation and executor
+  // construction dominate registration time and are independent across
+  // partitions. Units are staged in a local vector and only moved into the
+  // item once every partition has initialized successfully, so that
+  // `Item::~Item` only ever sees fully-initialized units.
+  const int num_partitions = partition_graphs.size();
+  std::vector<std::pair<const string*, std::unique_ptr<Graph>*>>
+      partition_list;
+  partition_list.reserve(num_partitions);
   for (auto& p : partition_graphs) {
-    const string& device_name = p.first;
-    std::unique_ptr<Graph>& subgraph = p.second;
-    item->units.resize(item->units.size() + 1);
-    ExecutionUnit* unit = &(item->units.back());
+    partition_list.emplace_back(&p.first, &p.second);
+  }
+  std::vector<ExecutionUnit> units(num_partitions);
+  // Not a vector<bool>, which cannot be written concurrently per index.
+  std::vector<char> hold_added(num_partitions, 0);
+  auto init_partition = [&](int i) -> absl::Status {
+    const string& device_name = *partition_list[i].first;
+    std::unique_ptr<Graph>& subgraph = *partition_list[i].second;
+    ExecutionUnit* unit = &units[i];
 
     // Find the device.
-    absl::Status s = device_mgr_->LookupDevice(device_name, &unit->device);
-    if (!s.ok()) {
-      // Remove the empty unit from the item as the item destructor wants all
-      // units to have valid devices.
-      item->units.pop_back();
-      return s;
-    }
+    TF_RETURN_IF_ERROR(device_mgr_->LookupDevice(device_name, &unit->device));
 
     // Give the device an opportunity to rewrite its subgraph.
     TF_RETURN_IF_ERROR(unit->device->MaybeRewriteGraph(&subgraph));
@@ -252,6 +298,7 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
     // to ensure the kernels cached for the session are alive.
     auto opseg = unit->device->op_segment();
     opseg->AddHold(handle);
+    hold_added[i] = 1;
 
     // Function library runtime.
     FunctionLibraryRuntime* lib = item->proc_flr->GetFLR(unit->device->name());
@@ -261,6 +308,7 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
     }
 
     // Construct the root executor for the subgraph.
+    LocalExecutorParams params;
     params.device = unit->device;
     params.function_library = lib;
     params.create_kernel =
@@ -288,6 +336,7 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
       }
     };
 
+    GraphOptimizer optimizer(optimizer_opts);
     optimizer.Optimize(lib, worker_env_->env, params.device, &subgraph,
                        GraphOptimizer::Options());
 
@@ -302,10 +351,27 @@ absl::Status GraphMgr::InitItem(const string& handle, const GraphDef& gdef,
                           unit->device->name(), subgraph.get()));
     unit->graph = std::move(subgraph);
     unit->build_cost_model = graph_options.build_cost_model();
-    if (unit->build_cost_model > 0) {
-      skip_cost_models_ = false;
+    return NewLocalExecutor(params, *unit->graph, &unit->root);
+  };
+  absl::Status init_status = RunForAllIndices(worker_env_->compute_pool,
+                                              num_partitions, init_partition);
+  if (!init_status.ok()) {
+    // Roll back partially-initialized units. The units are not yet owned by
+    // the item, so release their executors and op-segment holds here.
+    for (int i = 0; i < num_partitions; ++i) {
+      delete units[i].root;
+      if (hold_added[i]) {
+        units[i].device->op_segment()->RemoveHold(handle);
+      }
     }
-    TF_RETURN_IF_ERROR(NewLocalExecutor(params, *unit->graph, &unit->root));
+    return init_status;
+  }
+  item->units.reserve(num_partitions);
+  for (ExecutionUnit& unit : units) {
+    item->units.push_back(std::move(unit));
+  }
+  if (num_partitions > 0 && graph_options.build_cost_model() > 0) {
+    skip_cost_models_ = false;
   }
   return absl::OkStatus();
 }
@@ -140,7 +140,8 @@ static void EncodeSkeleton(const Tensor& val, io::ProtoEncodeHelper* e) {
 
 absl::Status EncodeTensorToByteBuffer(bool is_dead, const Tensor& val,
                                       bool require_ack,
-                                      ::grpc::ByteBuffer* result) {
+                                      ::grpc::ByteBuffer* result,
+                                      bool is_bfloat16_truncated) {
   const int kLargeTensorBytes = 1024;
   const int64_t kProtoBufLimitBytes = 1LL << 31;
 
@@ -156,6 +157,9 @@ absl::Status EncodeTensorToByteBuffer(bool is_dead, const Tensor& val,
     response.set_is_dead(is_dead);
   }
   response.set_require_ack(require_ack);
+  if (is_bfloat16_truncated) {
+    response.set_is_bfloat16_truncated(true);
+  }
   response.set_send_start_micros(Env::Default()->NowMicros());
   if (!DataTypeCanUseMemcpy(val.dtype())) {
     // Straightforward but slow path for complicated kinds of tensor data
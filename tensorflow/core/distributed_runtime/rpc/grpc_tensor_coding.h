@@ -46,10 +46,16 @@ void EncodeRecvTensorResponseToByteBuffer(const RecvTensorResponse& proto,
 //
 // "val" holds the tensor value to be encoded.
 //
+// "is_bfloat16_truncated" is the value to encode for
+// "RecvTensorResponse::is_bfloat16_truncated" (the sender narrowed an fp32
+// tensor to bfloat16 on the wire and the receiver must widen it back; only
+// set when the request advertised accept_bfloat16_truncation).
+//
 // Discards original contents of *result.
 absl::Status EncodeTensorToByteBuffer(bool is_dead, const Tensor& val,
                                       bool require_ack,
-                                      ::grpc::ByteBuffer* result);
+                                      ::grpc::ByteBuffer* result,
+                                      bool is_bfloat16_truncated = false);
 
 }  // namespace grpc
 }  // namespace tensorflow
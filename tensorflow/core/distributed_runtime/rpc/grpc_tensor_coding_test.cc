@@ -103,6 +103,34 @@ TEST_F(GrpcTensorCodingTest, Simple) {
 
 TEST_F(GrpcTensorCodingTest, StringTensor) { DoTestForStrings(DT_STRING); }
 
+TEST_F(GrpcTensorCodingTest, Bfloat16TruncatedFlag) {
+  Tensor t(DT_BFLOAT16, TensorShape({2, 3}));
+  gtl::InlinedVector<bfloat16, 4> v;
+  for (int i = 0; i < 6; i++) v.push_back(static_cast<bfloat16>(i));
+  test::FillValues<bfloat16>(&t, v);
+
+  ::grpc::ByteBuffer buf;
+  TF_EXPECT_OK(grpc::EncodeTensorToByteBuffer(/*is_dead=*/false, t,
+                                              /*require_ack=*/false, &buf,
+                                              /*is_bfloat16_truncated=*/true));
+
+  std::vector<::grpc::Slice> slices;
+  (void)buf.Dump(&slices);
+  string tmp;
+  for (const auto& s : slices) {
+    tmp.append(reinterpret_cast<const char*>(s.begin()), s.size());
+  }
+
+  RecvTensorResponse response;
+  EXPECT_TRUE(response.ParseFromString(tmp));
+  EXPECT_TRUE(response.is_bfloat16_truncated());
+
+  Tensor result_tensor;
+  EXPECT_TRUE(result_tensor.FromProto(response.tensor()));
+  EXPECT_EQ(result_tensor.dtype(), DT_BFLOAT16);
+  EXPECT_EQ(t.DebugString(), result_tensor.DebugString());
+}
+
 TEST_F(GrpcTensorCodingTest, LargeTensor) {
   Tensor t(DT_INT8, TensorShape({1, 1 + (1LL << 31)}));
   ::grpc::ByteBuffer buf;
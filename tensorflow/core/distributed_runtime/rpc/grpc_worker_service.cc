@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/rpc/grpc_worker_service.h"
 
 #include <deque>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -445,6 +446,23 @@ void GrpcWorker::EnableResponseCache() {
   response_cache_ = std::make_unique<RpcResponseCache>();
 }
 
+namespace {
+
+// Minimum element count before fp32->bfloat16 wire truncation pays for the
+// conversion pass. Small tensors fit in a single slice anyway.
+constexpr int64_t kMinBfloat16TruncationElements = 1024;
+
+// Whether "val" should be narrowed to bfloat16 before encoding, given that
+// the requester advertised accept_bfloat16_truncation. Dtype-aware: only
+// fp32 payloads benefit; everything else (including genuinely-bf16 or
+// integer tensors) is sent verbatim.
+bool ShouldTruncateToBfloat16(const Tensor& val) {
+  return val.dtype() == DT_FLOAT &&
+         val.NumElements() >= kMinBfloat16TruncationElements;
+}
+
+}  // namespace
+
 // GrpcRecvTensorAsync: unlike the other Worker methods, which use protocol
 // buffers for a response object, to avoid extra protocol buffer serialization
 // overhead we generate our response directly into a ::grpc::ByteBuffer object
@@ -463,8 +481,19 @@ void GrpcWorker::GrpcRecvTensorAsync(CallOptions* opts,
                          const absl::Status& status) {
     absl::Status updated_status;
     if (status.ok()) {
-      updated_status = grpc::EncodeTensorToByteBuffer(is_dead, tensor,
-                                                      cache_enabled, response);
+      if (!is_dead && request->accept_bfloat16_truncation() &&
+          ShouldTruncateToBfloat16(tensor)) {
+        // The tensor is host-resident here (accelerator-sourced values are
+        // copied to host before rendezvous_done), so the cast runs on CPU.
+        Tensor narrowed(DT_BFLOAT16, tensor.shape());
+        narrowed.flat<bfloat16>() = tensor.flat<float>().cast<bfloat16>();
+        updated_status = grpc::EncodeTensorToByteBuffer(
+            is_dead, narrowed, cache_enabled, response,
+            /*is_bfloat16_truncated=*/true);
+      } else {
+        updated_status = grpc::EncodeTensorToByteBuffer(
+            is_dead, tensor, cache_enabled, response);
+      }
       if (!updated_status.ok()) {
         updated_status = absl::InternalError(absl::StrCat(
             "Failed to encode tensor to byte buffer: ",
@@ -604,10 +633,49 @@ void SetTensorInRecvBufResp(int64_t max_chunk_bytes, const Tensor* tensor,
   }
   response->mutable_transport_options()->PackFrom(extra);
 }
+
+// Packs the [offset, offset + num_bytes) byte range of *tensor into the
+// response, chunked the same way as SetTensorInRecvBufResp.
+void SetTensorSliceInRecvBufResp(int64_t max_chunk_bytes, const Tensor* tensor,
+                                 int64_t offset, int64_t num_bytes,
+                                 RecvBufResponse* response) {
+  RecvBufRespExtra extra;
+  const char* head =
+      reinterpret_cast<const char*>(DMAHelper::base(tensor)) + offset;
+  while (num_bytes > 0) {
+    int64_t bytes =
+        max_chunk_bytes > 0 ? std::min(num_bytes, max_chunk_bytes) : num_bytes;
+    extra.add_tensor_content(std::string(head, bytes));
+    head += bytes;
+    num_bytes -= bytes;
+  }
+  response->mutable_transport_options()->PackFrom(extra);
+}
 }  // namespace
 
+// An in-progress chunked RecvBuf transfer.  The first chunk request for a
+// given (step_id, buf_rendezvous_key) consumes the BufRendezvous entry and,
+// if necessary, copies the source tensor into host memory; the buffer is
+// then parked here and each chunk request is answered with its byte
+// subrange.  `release` frees the underlying hook (and any host copy) and is
+// invoked once all num_chunks slices have been served.
+struct GrpcWorker::ChunkedRecvBufState {
+  mutex mu;
+  bool ready TF_GUARDED_BY(mu) = false;
+  absl::Status status TF_GUARDED_BY(mu);
+  const Tensor* src_tensor TF_GUARDED_BY(mu) = nullptr;
+  std::function<void()> release TF_GUARDED_BY(mu);
+  int32 chunks_served TF_GUARDED_BY(mu) = 0;
+  // Chunk requests that arrived before the buffer was ready.
+  std::vector<std::function<void()>> waiters TF_GUARDED_BY(mu);
+};
+
 void GrpcWorker::RecvBufAsync(CallOptions* opts, const RecvBufRequest* request,
                               RecvBufResponse* response, StatusCallback done) {
+  if (request->num_chunks() > 1) {
+    RecvBufChunkAsync(opts, request, response, std::move(done));
+    return;
+  }
   const int64_t request_id = request->request_id();
   const int64_t step_id = request->step_id();
   bool cache_enabled = (response_cache_ != nullptr && request_id != 0);
@@ -725,6 +793,176 @@ void GrpcWorker::RecvBufAsync(CallOptions* opts, const RecvBufRequest* request,
       /*cancellation_manager=*/nullptr);
 }
 
+void GrpcWorker::RecvBufChunkAsync(CallOptions* opts,
+                                   const RecvBufRequest* request,
+                                   RecvBufResponse* response,
+                                   StatusCallback done) {
+  // Chunked transfers bypass the response cache: each chunk carries its own
+  // request_id but the cache stores whole tensors, so a cached reply would
+  // resend the full buffer.
+  const int64_t step_id = request->step_id();
+  absl::Status s = recent_request_ids_.TrackUnique(
+      request->request_id(), "RecvBuf (GrpcWorker)", *request);
+  if (!s.ok()) {
+    done(s);
+    return;
+  }
+
+  const string key =
+      strings::StrCat(step_id, ";", request->buf_rendezvous_key());
+  std::shared_ptr<ChunkedRecvBufState> state;
+  bool first_chunk = false;
+  {
+    mutex_lock l(chunked_recv_buf_mu_);
+    auto it = chunked_recv_buf_.find(key);
+    if (it == chunked_recv_buf_.end()) {
+      state = std::make_shared<ChunkedRecvBufState>();
+      chunked_recv_buf_[key] = state;
+      first_chunk = true;
+    } else {
+      state = it->second;
+    }
+  }
+
+  // Serves this request's byte range out of the parked buffer, releasing
+  // the buffer after the last chunk.  Requires the buffer to be ready.
+  std::function<void()> serve_chunk = [this, key, state, request, response,
+                                       done = std::move(done)]() {
+    absl::Status chunk_status;
+    bool last = false;
+    {
+      mutex_lock l(state->mu);
+      chunk_status = state->status;
+      if (chunk_status.ok()) {
+        const int64_t total_bytes = state->src_tensor->TotalBytes();
+        if (request->offset() < 0 || request->num_bytes() < 0 ||
+            request->offset() + request->num_bytes() > total_bytes) {
+          chunk_status = errors::InvalidArgument(
+              "RecvBuf chunk [", request->offset(), ", ",
+              request->offset() + request->num_bytes(),
+              ") out of range for ", total_bytes, " byte buffer ",
+              request->buf_rendezvous_key());
+        } else {
+          SetTensorSliceInRecvBufResp(recv_buf_max_chunk_, state->src_tensor,
+                                      request->offset(), request->num_bytes(),
+                                      response);
+        }
+      }
+      ++state->chunks_served;
+      last = (state->chunks_served == request->num_chunks());
+      if (last) {
+        if (state->release) state->release();
+        state->release = nullptr;
+        state->src_tensor = nullptr;
+      }
+    }
+    if (last) {
+      mutex_lock l(chunked_recv_buf_mu_);
+      chunked_recv_buf_.erase(key);
+    }
+    response->set_send_start_micros(env_->env->NowMicros());
+    done(chunk_status);
+  };
+
+  {
+    mutex_lock l(state->mu);
+    if (!state->ready) {
+      state->waiters.push_back(std::move(serve_chunk));
+      serve_chunk = nullptr;
+    }
+  }
+  if (serve_chunk) serve_chunk();
+  if (!first_chunk) return;
+
+  // First chunk request for this key: consume the BufRendezvous entry and
+  // park the source bytes for the remaining chunks.  This mirrors the
+  // consumer_callback in RecvBufAsync except that the hook is held until
+  // every chunk has been served.
+  auto buf_ready = [state](const absl::Status& s, const Tensor* src,
+                           std::function<void()> release) {
+    std::vector<std::function<void()>> waiters;
+    {
+      mutex_lock l(state->mu);
+      state->ready = true;
+      state->status = s;
+      state->src_tensor = src;
+      state->release = std::move(release);
+      waiters.swap(state->waiters);
+    }
+    for (auto& waiter : waiters) waiter();
+  };
+  CollectiveExecutor::Handle ce_handle(
+      env_->collective_executor_mgr->FindOrCreate(step_id), true);
+  CollectiveRemoteAccess* rma = ce_handle.get()->remote_access();
+  auto consumer_callback = [this, request, buf_ready](
+                               const absl::Status& status,
+                               BufRendezvous::Hook* hook) {
+    absl::Status s = status;
+    if (s.ok()) {
+      if (hook == nullptr) {
+        s = errors::Internal("Invalid null hook for key ",
+                             request->buf_rendezvous_key());
+      } else {
+        if (!DMAHelper::CanUseDMA(hook->prod_value)) {
+          s = errors::Internal("Tensor value for key ",
+                               request->buf_rendezvous_key(),
+                               " is not of a type supported by RecvBuf");
+        }
+      }
+    } else {
+      if (hook != nullptr) {
+        LOG(ERROR) << "Got hook " << hook << " with status " << s
+                   << " from ConsumeBuf";
+      }
+    }
+
+    if (s.ok()) {
+      // The RPC source tensor needs to be in CPU RAM.  If not already
+      // there make a copy using memory appropriate to the purpose.
+      const size_t num_bytes = hook->prod_value->TotalBytes();
+      const bool on_host =
+          hook->prod_dev->attributes().device_type() == "CPU" ||
+          hook->prod_attr.on_host();
+      if ((!on_host) && (num_bytes > 0)) {
+        Device* cpu_dev = nullptr;
+        s = env_->device_mgr->LookupDevice("CPU:0", &cpu_dev);
+        if (s.ok()) {
+          AllocatorAttributes cpu_attr;
+          cpu_attr.set_gpu_compatible(true);
+          cpu_attr.set_nic_compatible(true);
+          tsl::profiler::ScopedMemoryDebugAnnotation op_annotation(
+              "GrpcWorker::RecvBufChunkAsync::consumer_callback",
+              request->step_id(), "dynamic", hook->prod_value->dtype(),
+              [hook]() { return hook->prod_value->shape().DebugString(); });
+          Tensor* cpu_tensor =
+              new Tensor(cpu_dev->GetAllocator(cpu_attr),
+                         hook->prod_value->dtype(), hook->prod_value->shape());
+          hook->prod_ctx->CopyDeviceTensorToCPU(
+              hook->prod_value, "empty_name", hook->prod_dev, cpu_tensor,
+              [hook, cpu_tensor, buf_ready](const absl::Status& s) {
+                buf_ready(s, cpu_tensor, [hook, cpu_tensor]() {
+                  BufRendezvous::DoneWithHook(hook);
+                  delete cpu_tensor;
+                });
+              });
+          return;
+        }
+      }
+    }
+
+    if (hook == nullptr) {
+      buf_ready(s, nullptr, nullptr);
+    } else {
+      buf_ready(s, hook->prod_value,
+                [hook]() { BufRendezvous::DoneWithHook(hook); });
+    }
+  };
+  rma->buf_rendezvous()->ConsumeBuf(
+      request->buf_rendezvous_key(), request->src_device(),
+      request->src_incarnation(), consumer_callback,
+      /*cancellation_manager=*/nullptr);
+}
+
 void GrpcWorker::LoggingAsync(const LoggingRequest* request,
                               LoggingResponse* response, StatusCallback done) {
   auto env = this->env();
@@ -24,6 +24,7 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/rpc/grpc_worker_service_impl.h"
 #include "tensorflow/core/distributed_runtime/rpc/rpc_response_cache.h"
 #include "tensorflow/core/distributed_runtime/worker.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/protobuf/worker.pb.h"
 
 namespace grpc {
@@ -68,8 +69,20 @@ class GrpcWorker : public Worker {
   void RemoveCacheEntryForId(int64_t request_id);
 
  private:
+  // Implements RecvBufAsync for requests with num_chunks > 1, i.e. one
+  // slice of a transfer the client has split into several concurrent RPCs.
+  void RecvBufChunkAsync(CallOptions* opts, const RecvBufRequest* request,
+                         RecvBufResponse* response, StatusCallback done);
+
   std::unique_ptr<RpcResponseCache> response_cache_;
   const int32 recv_buf_max_chunk_;
+
+  // In-progress chunked RecvBuf transfers, keyed by
+  // "<step_id>;<buf_rendezvous_key>".  See RecvBufChunkAsync.
+  struct ChunkedRecvBufState;
+  mutex chunked_recv_buf_mu_;
+  std::unordered_map<string, std::shared_ptr<ChunkedRecvBufState>>
+      chunked_recv_buf_ TF_GUARDED_BY(chunked_recv_buf_mu_);
 };
 
 std::unique_ptr<GrpcWorker> NewGrpcWorker(WorkerEnv* worker_env,
@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "tensorflow/core/distributed_runtime/rpc/rpc_rendezvous_mgr.h"
 
+#include <functional>
+#include <thread>
+
 #include "tensorflow/core/common_runtime/device.h"
 #include "tensorflow/core/common_runtime/device_mgr.h"
 #include "tensorflow/core/common_runtime/dma_helper.h"
@@ -23,6 +26,7 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/tensor_coding.h"
 #include "tensorflow/core/distributed_runtime/worker_cache.h"
 #include "tensorflow/core/distributed_runtime/worker_interface.h"
+#include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/types.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/strings/numbers.h"
@@ -31,11 +35,25 @@ limitations under the License.
 #include "tensorflow/core/platform/macros.h"
 #include "tensorflow/core/platform/notification.h"
 #include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 
 namespace {
 
+// Whether to advertise fp32->bfloat16 wire truncation to RecvTensor senders
+// (RecvTensorRequest.accept_bfloat16_truncation). Halves the bytes of large
+// fp32 tensors on the wire at the cost of mantissa precision, so it is opt-in.
+bool WireBfloat16TruncationEnabled() {
+  static bool result = [] {
+    bool value = false;
+    TF_CHECK_OK(ReadBoolFromEnvVar("TF_GRPC_RECV_TENSOR_BFLOAT16_TRUNCATION",
+                                   /*default_val=*/false, &value));
+    return value;
+  }();
+  return result;
+}
+
 class RpcRemoteRendezvous : public BaseRemoteRendezvous {
  public:
   RpcRemoteRendezvous(const WorkerEnv* env, int64_t step_id)
@@ -69,6 +87,14 @@ class RpcRecvTensorCall : public BaseRecvTensorCall {
     req_.set_step_id(step_id);
     req_.set_rendezvous_key(key.data(), key.size());
     req_.set_request_id(GetUniqueRequestId());
+    // Only offer bfloat16 wire truncation when the response parses into host
+    // memory (mirrors TensorResponse::InitAlloc); widening back to fp32 is a
+    // CPU pass over the received buffer.
+    if (WireBfloat16TruncationEnabled() &&
+        (alloc_attrs.on_host() ||
+         dst_device->attributes().device_type() == "CPU")) {
+      req_.set_accept_bfloat16_truncation(true);
+    }
   }
 
   void Reset() {
@@ -83,6 +109,8 @@ class RpcRecvTensorCall : public BaseRecvTensorCall {
     // opts_ appropriately.
     req_.Clear();
     resp_.Clear();
+    widened_ = Tensor();
+    has_widened_ = false;
     {
       mutex_lock l(mu_);
       status_ = absl::OkStatus();
@@ -122,10 +150,31 @@ class RpcRecvTensorCall : public BaseRecvTensorCall {
     wi_ = nullptr;
   }
 
-  const Tensor& tensor() const { return resp_.tensor(); }
+  const Tensor& tensor() const {
+    return has_widened_ ? widened_ : resp_.tensor();
+  }
 
   bool is_dead() const { return resp_.metadata().is_dead(); }
 
+  // Widens a bfloat16-truncated wire payload back to the fp32 tensor the
+  // sender narrowed (see RecvTensorResponse.is_bfloat16_truncated). Must only
+  // be called after a successful RPC whose response set that flag.
+  absl::Status WidenTruncatedTensor() {
+    const Tensor& narrow = resp_.tensor();
+    if (narrow.dtype() != DT_BFLOAT16) {
+      return errors::Internal(
+          "RecvTensor response was marked bfloat16-truncated but carries "
+          "dtype ",
+          DataTypeString(narrow.dtype()));
+    }
+    Tensor widened(dst_device_->GetAllocator(alloc_attrs_), DT_FLOAT,
+                   narrow.shape());
+    widened.flat<float>() = narrow.flat<bfloat16>().cast<float>();
+    widened_ = std::move(widened);
+    has_widened_ = true;
+    return absl::OkStatus();
+  }
+
   Device* dst_device() const { return dst_device_; }
   const Rendezvous::Args& recv_args() const { return recv_args_; }
   const Rendezvous::DoneCallback& done() const { return done_; }
@@ -175,6 +224,10 @@ class RpcRecvTensorCall : public BaseRecvTensorCall {
   CallOptions opts_;
   RecvTensorRequest req_;
   TensorResponse resp_;
+  // Holds the fp32 tensor recovered from a bfloat16-truncated response;
+  // tensor() returns it instead of resp_.tensor() when has_widened_ is set.
+  Tensor widened_;
+  bool has_widened_ = false;
   Rendezvous::Args recv_args_;
   Rendezvous::DoneCallback done_;
 
@@ -185,21 +238,31 @@ class RpcRecvTensorCall : public BaseRecvTensorCall {
   void operator=(const RpcRecvTensorCall&) = delete;
 };
 
+// Recycles RpcRecvTensorCall objects, and with them the RecvTensorRequest
+// and TensorResponse protos they embed: Clear() retains the protos' internal
+// buffers, so a recycled call issues its RPC without re-growing them.
+//
+// The pool is sharded by calling thread so that, at high RecvTensor rates
+// (parameter-server setups issue tens of thousands of these per second), the
+// freelist itself is not serialized behind a single process-wide mutex.
 class RpcRecvTensorFreeList {
  public:
   RpcRecvTensorFreeList() {}
   ~RpcRecvTensorFreeList() {
-    for (size_t i = 0; i < objects_.size(); i++) {
-      delete objects_[i];
+    for (Shard& shard : shards_) {
+      for (size_t i = 0; i < shard.objects.size(); i++) {
+        delete shard.objects[i];
+      }
     }
   }
 
   RpcRecvTensorCall* New() {
+    Shard& shard = shards_[ShardIndex()];
     {
-      mutex_lock l(mu_);
-      if (!objects_.empty()) {
-        RpcRecvTensorCall* result = objects_.back();
-        objects_.pop_back();
+      mutex_lock l(shard.mu);
+      if (!shard.objects.empty()) {
+        RpcRecvTensorCall* result = shard.objects.back();
+        shard.objects.pop_back();
         return result;
       }
     }
@@ -208,10 +271,11 @@ class RpcRecvTensorFreeList {
 
   void Release(RpcRecvTensorCall* obj) {
     obj->Reset();
+    Shard& shard = shards_[ShardIndex()];
     {
-      mutex_lock l(mu_);
-      if (objects_.size() < kMaxObjects) {
-        objects_.push_back(obj);
+      mutex_lock l(shard.mu);
+      if (shard.objects.size() < kMaxObjectsPerShard) {
+        shard.objects.push_back(obj);
         return;
       }
     }
@@ -219,10 +283,22 @@ class RpcRecvTensorFreeList {
   }
 
  private:
-  static constexpr int kMaxObjects = 1000;
+  static constexpr int kNumShards = 8;
+  static constexpr int kMaxObjectsPerShard = 128;
+
+  // New() and Release() for one call typically run on different threads, so
+  // objects migrate between shards; that is fine, the sharding exists only to
+  // spread lock traffic.
+  size_t ShardIndex() const {
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) %
+           kNumShards;
+  }
 
-  mutex mu_;
-  std::vector<RpcRecvTensorCall*> objects_ TF_GUARDED_BY(mu_);
+  struct Shard {
+    mutex mu;
+    std::vector<RpcRecvTensorCall*> objects TF_GUARDED_BY(mu);
+  };
+  Shard shards_[kNumShards];
 };
 
 static RpcRecvTensorFreeList* get_call_freelist() {
@@ -295,6 +371,9 @@ void RpcRemoteRendezvous::RecvFromRemoteAsync(
     // If StartAbort was called prior to DeregisterCall, then the
     // current status should be bad.
     absl::Status s = call->status();
+    if (s.ok() && call->resp_.metadata().is_bfloat16_truncated()) {
+      s = call->WidenTruncatedTensor();
+    }
     // NOTE: `*session()` can potentially be deleted before we return from
     // `call->done()(...)`, so we must release the worker before calling the
     // callback.
@@ -35,13 +35,38 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/graph_mgr.h"
 #include "tensorflow/core/distributed_runtime/remote_device.h"
 #include "tensorflow/core/distributed_runtime/worker_cache_wrapper.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
 #include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/protobuf/cluster.pb.h"
 #include "tensorflow/core/protobuf/tensorflow_server.pb.h"
 #include "tensorflow/core/util/device_name_utils.h"
 
 namespace tensorflow {
 namespace {
+// Maximum number of retired `WorkerSession`s kept around for reuse. Retired
+// sessions hold on to a private DeviceMgr and worker cache, so only a handful
+// of distinct cluster configurations are worth retaining.
+constexpr int kMaxRetiredSessions = 4;
+
+// Fingerprints the parts of a session's configuration that determine the
+// worker-side state (cluster membership, worker cache and device set), so that
+// sequential master sessions with an identical configuration can reuse a
+// retired `WorkerSession` instead of rebuilding it. Remote device incarnations
+// are part of `cluster_device_attributes`, so a restarted remote task always
+// produces a different fingerprint.
+uint64 ClusterConfigFingerprint(
+    const ServerDef& server_def,
+    const protobuf::RepeatedPtrField<DeviceAttributes>&
+        cluster_device_attributes) {
+  uint64 fingerprint = DeterministicProtoHash64(server_def);
+  for (const DeviceAttributes& device_attributes : cluster_device_attributes) {
+    fingerprint = FingerprintCat64(fingerprint,
+                                   DeterministicProtoHash64(device_attributes));
+  }
+  return fingerprint;
+}
+
 // Check if current task is the leader as specified by coordination service.
 bool IsMultiClientLeader(const ServerDef& server_def,
                          const CoordinationServiceConfig& config) {
@@ -161,6 +186,7 @@ absl::Status SessionMgr::CreateSession(
       while (it != it_range.second) {
         auto session_it = sessions_.find(it->second.session_handle);
         if (session_it != sessions_.end()) {
+          RetireSessionLocked(session_it);
           sessions_.erase(session_it);
         }
         it = master_to_associated_sessions_.erase(it);
@@ -168,6 +194,47 @@ absl::Status SessionMgr::CreateSession(
     }
   }
 
+  // Reuse the state of a retired `WorkerSession` if one was created with an
+  // identical cluster configuration, so that a master that reconnects after a
+  // restart (e.g. a rolling controller update) does not pay for rebuilding the
+  // device manager views, worker cache and remote device registrations.
+  // Reuse is restricted to isolated session state, where no resources are
+  // shared with other sessions, and to sessions that do not need to bring up
+  // the coordination service below.
+  const CoordinationServiceConfig& configured_coordination_config =
+      server_def.default_session_config().experimental().coordination_config();
+  const bool needs_coordination_service =
+      !configured_coordination_config.service_type().empty() &&
+      !configured_coordination_config.force_disable() &&
+      coordination_service_agent_ == nullptr;
+  uint64 config_fingerprint = 0;
+  const bool session_reuse_eligible = isolate_session_state &&
+                                      !server_def.cluster().job().empty() &&
+                                      !needs_coordination_service;
+  if (session_reuse_eligible) {
+    config_fingerprint =
+        ClusterConfigFingerprint(server_def, cluster_device_attributes);
+    auto retired_it = retired_sessions_.find(config_fingerprint);
+    if (retired_it != retired_sessions_.end()) {
+      std::shared_ptr<WorkerSession> reused_session =
+          std::move(retired_it->second);
+      retired_sessions_.erase(retired_it);
+      reused_session->SetSessionName(session);
+      if (default_worker_cache_ != nullptr) {
+        reused_session->worker_cache()->SetLogging(this->is_logging_active_);
+      }
+      LOG(INFO) << "Reusing retired WorkerSession with identical cluster "
+                << "configuration for session " << session;
+      sessions_.insert(std::make_pair(session, std::move(reused_session)));
+      session_fingerprints_[session] = config_fingerprint;
+      if (!master_task.empty()) {
+        MasterAssociatedSession s{master_incarnation, session};
+        master_to_associated_sessions_.emplace(master_task, s);
+      }
+      return absl::OkStatus();
+    }
+  }
+
   WorkerCacheInterface* worker_cache = nullptr;
   std::string worker_name;
   if (server_def.cluster().job().empty()) {
@@ -261,6 +328,9 @@ absl::Status SessionMgr::CreateSession(
   }
 
   sessions_.insert(std::make_pair(session, std::move(worker_session)));
+  if (session_reuse_eligible) {
+    session_fingerprints_[session] = config_fingerprint;
+  }
   if (!master_task.empty()) {
     MasterAssociatedSession s{master_incarnation, session};
     master_to_associated_sessions_.emplace(master_task, s);
@@ -376,13 +446,55 @@ absl::Status SessionMgr::UpdateSession(
   TF_RETURN_IF_ERROR(worker_session->UpdateWorkerCacheAndDevices(
       std::unique_ptr<WorkerCacheInterface>(worker_cache),
       std::move(added_remote_devices), removed_remote_devices));
+  // The session's devices no longer match the configuration it was created
+  // with, so it must not be reused after retirement.
+  session_fingerprints_.erase(session);
   return absl::OkStatus();
 }
 
+void SessionMgr::RetireSessionLocked(
+    const std::map<std::string, std::shared_ptr<WorkerSession>>::iterator&
+        session_it) {
+  auto fingerprint_it = session_fingerprints_.find(session_it->first);
+  if (fingerprint_it == session_fingerprints_.end()) {
+    return;
+  }
+  const uint64 config_fingerprint = fingerprint_it->second;
+  session_fingerprints_.erase(fingerprint_it);
+
+  // Drop the graphs registered by the previous master session. The device
+  // manager views, worker cache and remote device registrations are what make
+  // session creation expensive, and those are preserved for reuse.
+  std::shared_ptr<WorkerSession> worker_session = session_it->second;
+  absl::Status s = worker_session->graph_mgr()->DeregisterAll();
+  if (!s.ok()) {
+    LOG(WARNING) << "Not retiring worker session " << session_it->first
+                 << " for reuse due to error during graph deregistration: "
+                 << s;
+    return;
+  }
+  // Drop the resources (variables, iterators, ...) created by the previous
+  // master session. Fingerprinted sessions always have isolated session
+  // state, so each device's resource manager is private to this session; a
+  // reusing session must start from an empty one, and a session that is never
+  // reused must not pin device memory while parked in `retired_sessions_`.
+  for (Device* device : worker_session->device_mgr()->ListDevices()) {
+    device->resource_manager()->Clear();
+  }
+  if (retired_sessions_.size() >= kMaxRetiredSessions &&
+      retired_sessions_.find(config_fingerprint) == retired_sessions_.end()) {
+    retired_sessions_.erase(retired_sessions_.begin());
+  }
+  retired_sessions_[config_fingerprint] = std::move(worker_session);
+  VLOG(1) << "Retired WorkerSession " << session_it->first
+          << " for possible reuse.";
+}
+
 absl::Status SessionMgr::DeleteSession(const std::string& session) {
   mutex_lock l(mu_);
   auto it = sessions_.find(session);
   if (it != sessions_.end()) {
+    RetireSessionLocked(it);
     sessions_.erase(it);
   }
   return absl::OkStatus();
@@ -393,6 +505,8 @@ absl::Status SessionMgr::DeleteAllSessions() {
   {
     mutex_lock l(mu_);
     swap(sessions_, tmp_sessions);
+    session_fingerprints_.clear();
+    retired_sessions_.clear();
   }
   for (auto& session : tmp_sessions) {
     session.second.reset();
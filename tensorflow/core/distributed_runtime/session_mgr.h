@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/thread_annotations.h"
+#include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/protobuf/tensorflow_server.pb.h"
 #include "tensorflow/core/protobuf/worker.pb.h"
 
@@ -70,6 +71,10 @@ class SessionMgr {
   // master has restarted before deleting the sessions on worker. When it
   // happens, old sessions associated with the master will be automatically
   // removed before the new session is created.
+  //
+  // If a previously deleted (or garbage collected) session was created with
+  // an identical cluster configuration and isolated session state, its
+  // worker-side state is reused for the new session instead of being rebuilt.
   absl::Status CreateSession(
       const std::string& session, const ServerDef& server_def,
       const protobuf::RepeatedPtrField<DeviceAttributes>& device_attributes,
@@ -154,6 +159,26 @@ class SessionMgr {
   std::map<std::string, std::shared_ptr<WorkerSession>> sessions_
       TF_GUARDED_BY(mu_);
 
+  // Retires the worker session pointed to by `session_it` so that a later
+  // `CreateSession` with an identical cluster configuration can reuse its
+  // state instead of rebuilding it. Only sessions whose configuration was
+  // fingerprinted at creation time are retired; others are simply destroyed
+  // when erased from `sessions_`. Does not erase `session_it`.
+  void RetireSessionLocked(
+      const std::map<std::string, std::shared_ptr<WorkerSession>>::iterator&
+          session_it) TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Fingerprint of the cluster configuration each reuse-eligible session was
+  // created with.
+  std::map<std::string, uint64> session_fingerprints_ TF_GUARDED_BY(mu_);
+
+  // Worker sessions retired by `DeleteSession` or by garbage collection of
+  // sessions from a restarted master, kept for reuse by a later master
+  // session with an identical cluster configuration. Keyed by configuration
+  // fingerprint; at most one retired session is kept per fingerprint.
+  std::map<uint64, std::shared_ptr<WorkerSession>> retired_sessions_
+      TF_GUARDED_BY(mu_);
+
   // Incarnation and WorkerSession handle associated with a master task.
   struct MasterAssociatedSession {
     const int64_t master_incarnation;
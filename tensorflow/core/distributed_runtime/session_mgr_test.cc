@@ -21,6 +21,7 @@ limitations under the License.
 #include "tensorflow/core/distributed_runtime/error_payloads.h"
 #include "tensorflow/core/distributed_runtime/rpc/rpc_rendezvous_mgr.h"
 #include "tensorflow/core/distributed_runtime/worker_env.h"
+#include "tensorflow/core/framework/resource_mgr.h"
 #include "tensorflow/core/lib/core/status_test_util.h"
 #include "tensorflow/core/platform/test.h"
 #include "tensorflow/core/protobuf/cluster.pb.h"
@@ -47,6 +48,11 @@ class FakeDevice : public Device {
   }
 };
 
+class StaleResource : public ResourceBase {
+ public:
+  std::string DebugString() const override { return "StaleResource"; }
+};
+
 class SessionMgrTest : public ::testing::Test {
  protected:
   SessionMgrTest()
@@ -158,6 +164,59 @@ TEST_F(SessionMgrTest, CreateSessionIsolateSessionState) {
   EXPECT_NE(devices_3[0]->resource_manager(), devices_4[0]->resource_manager());
 }
 
+TEST_F(SessionMgrTest, ReuseRetiredSessionWithIdenticalClusterConfig) {
+  ServerDef server_def;
+  server_def.set_job_name("worker");
+  server_def.set_task_index(3);
+  auto job = server_def.mutable_cluster()->add_job();
+  job->set_name("worker");
+  job->mutable_tasks()->insert({3, "localhost:3333"});
+
+  protobuf::RepeatedPtrField<DeviceAttributes> cluster_device_attributes;
+
+  std::string sess_handle1 = "test_session_handle_1";
+  TF_EXPECT_OK(mgr_.CreateSession(sess_handle1, server_def,
+                                  cluster_device_attributes, true));
+  std::shared_ptr<WorkerSession> session_1;
+  TF_EXPECT_OK(mgr_.WorkerSessionForSession(sess_handle1, &session_1));
+  WorkerSession* session_1_ptr = session_1.get();
+  // Create a resource in the session's isolated resource manager; retirement
+  // must clear it so that a reusing session does not inherit stale state.
+  ResourceMgr* resource_mgr =
+      session_1->device_mgr()->ListDevices()[0]->resource_manager();
+  TF_EXPECT_OK(
+      resource_mgr->Create("test_container", "stale", new StaleResource));
+  session_1.reset();
+  TF_EXPECT_OK(mgr_.DeleteSession(sess_handle1));
+
+  // A new session with an identical cluster configuration reuses the retired
+  // WorkerSession's state under the new handle, with its resource managers
+  // emptied.
+  std::string sess_handle2 = "test_session_handle_2";
+  TF_EXPECT_OK(mgr_.CreateSession(sess_handle2, server_def,
+                                  cluster_device_attributes, true));
+  std::shared_ptr<WorkerSession> session_2;
+  TF_EXPECT_OK(mgr_.WorkerSessionForSession(sess_handle2, &session_2));
+  EXPECT_EQ(session_1_ptr, session_2.get());
+  EXPECT_EQ(sess_handle2, session_2->session_name());
+  StaleResource* stale = nullptr;
+  EXPECT_TRUE(absl::IsNotFound(
+      session_2->device_mgr()->ListDevices()[0]->resource_manager()->Lookup(
+          "test_container", "stale", &stale)));
+  TF_EXPECT_OK(mgr_.DeleteSession(sess_handle2));
+
+  // A session with a different cluster configuration must not be reused.
+  server_def.mutable_cluster()->mutable_job(0)->mutable_tasks()->insert(
+      {4, "localhost:4444"});
+  std::string sess_handle3 = "test_session_handle_3";
+  TF_EXPECT_OK(mgr_.CreateSession(sess_handle3, server_def,
+                                  cluster_device_attributes, true));
+  std::shared_ptr<WorkerSession> session_3;
+  TF_EXPECT_OK(mgr_.WorkerSessionForSession(sess_handle3, &session_3));
+  EXPECT_NE(session_1_ptr, session_3.get());
+  TF_EXPECT_OK(mgr_.DeleteSession(sess_handle3));
+}
+
 TEST_F(SessionMgrTest, CreateSessionWithMasterName) {
   ServerDef server_def;
   server_def.set_job_name("worker");
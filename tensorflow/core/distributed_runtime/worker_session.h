@@ -95,6 +95,14 @@ class WorkerSession {
       std::vector<std::unique_ptr<Device>> added_remote_devices,
       const std::vector<Device*>& removed_remote_devices);
 
+  // Rebinds this session to a new session handle, so that a retired session's
+  // state can be reused by a subsequent master session with an identical
+  // cluster configuration. Must be called before any graphs are registered
+  // under the new handle.
+  void SetSessionName(const string& session_name) {
+    session_name_ = session_name;
+  }
+
   ~WorkerSession();
 
  private:
@@ -105,8 +113,9 @@ class WorkerSession {
                 std::unique_ptr<DynamicDeviceMgr> remote_device_mgr,
                 DistributedFunctionLibraryRuntimeCreator cluster_flr_creator);
 
-  // The name of the session.
-  const string session_name_;
+  // The name of the session. Only mutated by `SetSessionName` when the
+  // session is reused for a new master session.
+  string session_name_;
 
   // The name of the worker. E.g., /job:mnist/replica:0/task:1.
   const string worker_name_;
@@ -15,8 +15,18 @@ limitations under the License.
 
 #include "tensorflow/core/framework/bfloat16.h"
 
+#include <cstring>
+
 #include "Eigen/Core"  // from @eigen_archive
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define USE_NEON
+#endif
+
 namespace tensorflow {
 
 void RoundFloatToBFloat16(const float* src, bfloat16* dst, int64_t size) {
@@ -25,24 +35,82 @@ void RoundFloatToBFloat16(const float* src, bfloat16* dst, int64_t size) {
   dst_eigen = src_eigen.cast<bfloat16>();
 }
 
+// The truncating and widening conversions below are pure bit shuffles: a
+// bfloat16 is the upper 16 bits of the corresponding float. Working on the
+// integer representation keeps them branch-free and lets the vector paths
+// use narrowing/widening shifts instead of floating-point conversion
+// instructions. Reading a whole uint32 and shifting is endian-independent;
+// the most significant 16 bits of the value are the bfloat16 bits on both
+// layouts.
+
 void FloatToBFloat16(const float* src, bfloat16* dst, int64_t size) {
-  for (; size != 0; src++, dst++, size--) {
-#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
-    memcpy(dst, src, sizeof(bfloat16));
-#else
-    memcpy(
-        dst,
-        reinterpret_cast<const char*>(src) + sizeof(float) - sizeof(bfloat16),
-        sizeof(bfloat16));
+  const uint32_t* src_bits = reinterpret_cast<const uint32_t*>(src);
+  uint16_t* dst_bits = reinterpret_cast<uint16_t*>(dst);
+  int64_t i = 0;
+#if defined(__AVX512BW__)
+  for (; i + 16 <= size; i += 16) {
+    const __m512i words =
+        _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src_bits + i));
+    const __m256i high = _mm512_cvtepi32_epi16(_mm512_srli_epi32(words, 16));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_bits + i), high);
+  }
+#elif defined(__AVX2__)
+  for (; i + 8 <= size; i += 8) {
+    const __m256i words =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_bits + i));
+    // Shift the bfloat16 bits into the low halves, pack the two 128-bit
+    // lanes down to 16-bit elements, and undo the lane interleave that
+    // _mm256_packus_epi32 introduces.
+    const __m256i packed = _mm256_permute4x64_epi64(
+        _mm256_packus_epi32(_mm256_srli_epi32(words, 16),
+                            _mm256_setzero_si256()),
+        0xd8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_bits + i),
+                     _mm256_castsi256_si128(packed));
+  }
+#elif defined(USE_NEON)
+  for (; i + 8 <= size; i += 8) {
+    const uint16x4_t lo = vshrn_n_u32(vld1q_u32(src_bits + i), 16);
+    const uint16x4_t hi = vshrn_n_u32(vld1q_u32(src_bits + i + 4), 16);
+    vst1q_u16(dst_bits + i, vcombine_u16(lo, hi));
+  }
 #endif
+  for (; i < size; ++i) {
+    uint32_t word;
+    memcpy(&word, src_bits + i, sizeof(word));
+    dst_bits[i] = static_cast<uint16_t>(word >> 16);
   }
 }
 
 void BFloat16ToFloat(const bfloat16* src, float* dst, int64_t size) {
-  Eigen::Map<const Eigen::Array<bfloat16, Eigen::Dynamic, 1>> src_eigen(src,
-                                                                        size);
-  Eigen::Map<Eigen::ArrayXf> dst_eigen(dst, size);
-  dst_eigen = src_eigen.cast<float>();
+  const uint16_t* src_bits = reinterpret_cast<const uint16_t*>(src);
+  uint32_t* dst_bits = reinterpret_cast<uint32_t*>(dst);
+  int64_t i = 0;
+#if defined(__AVX512BW__)
+  for (; i + 16 <= size; i += 16) {
+    const __m256i halves =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_bits + i));
+    const __m512i words = _mm512_slli_epi32(_mm512_cvtepu16_epi32(halves), 16);
+    _mm512_storeu_si512(reinterpret_cast<__m512i*>(dst_bits + i), words);
+  }
+#elif defined(__AVX2__)
+  for (; i + 8 <= size; i += 8) {
+    const __m128i halves =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_bits + i));
+    const __m256i words = _mm256_slli_epi32(_mm256_cvtepu16_epi32(halves), 16);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_bits + i), words);
+  }
+#elif defined(USE_NEON)
+  for (; i + 8 <= size; i += 8) {
+    const uint16x8_t halves = vld1q_u16(src_bits + i);
+    vst1q_u32(dst_bits + i, vshll_n_u16(vget_low_u16(halves), 16));
+    vst1q_u32(dst_bits + i + 4, vshll_n_u16(vget_high_u16(halves), 16));
+  }
+#endif
+  for (; i < size; ++i) {
+    const uint32_t word = static_cast<uint32_t>(src_bits[i]) << 16;
+    memcpy(dst_bits + i, &word, sizeof(word));
+  }
 }
 
 }  // end namespace tensorflow
@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "tensorflow/core/framework/bfloat16.h"
 
+#include <cstdint>
+#include <vector>
+
 #include "absl/base/casts.h"
 #include "tensorflow/core/framework/numeric_types.h"
 #include "tensorflow/core/platform/test.h"
@@ -39,6 +42,25 @@ TEST(Bfloat16Test, Conversion) {
   }
 }
 
+TEST(Bfloat16Test, ConversionBitsExact) {
+  // Cover the vector bodies and every possible scalar tail length.
+  for (int size = 1; size <= 33; ++size) {
+    std::vector<float> a(size);
+    for (int i = 0; i < size; ++i) {
+      a[i] = (i % 2 == 0 ? 1.0f : -1.0f) * (i + 0.3359375f);
+    }
+    std::vector<bfloat16> b(size);
+    std::vector<float> c(size);
+    FloatToBFloat16(a.data(), b.data(), size);
+    BFloat16ToFloat(b.data(), c.data(), size);
+    for (int i = 0; i < size; ++i) {
+      const uint32_t in_bits = absl::bit_cast<uint32_t>(a[i]);
+      EXPECT_EQ(absl::bit_cast<uint16_t>(b[i]), in_bits >> 16);
+      EXPECT_EQ(absl::bit_cast<uint32_t>(c[i]), in_bits & 0xffff0000u);
+    }
+  }
+}
+
 void BM_FloatToBFloat16(::testing::benchmark::State& state) {
   static const int N = 32 << 20;
 
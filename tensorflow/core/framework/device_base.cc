@@ -22,6 +22,8 @@ limitations under the License.
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/synchronization/notification.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/util/work_sharder.h"
 
@@ -61,6 +63,49 @@ absl::Status DeviceContext::CopyCPUTensorToDeviceSync(
   return status;
 }
 
+void DeviceContext::CopyCPUTensorsToDevice(
+    absl::Span<const Tensor* const> cpu_tensors, Device* device,
+    absl::Span<Tensor* const> device_tensors, StatusCallback done,
+    bool sync_dst_compute) const {
+  DCHECK_EQ(cpu_tensors.size(), device_tensors.size());
+  if (cpu_tensors.empty()) {
+    done(absl::OkStatus());
+    return;
+  }
+
+  // Aggregates the per-copy callbacks: `done` fires once after the last copy
+  // completes, with the first non-OK status observed.
+  struct BatchState {
+    explicit BatchState(size_t n, StatusCallback done)
+        : pending(n), done(std::move(done)) {}
+    std::atomic<int64_t> pending;
+    mutex mu;
+    absl::Status status TF_GUARDED_BY(mu);
+    StatusCallback done;
+  };
+  auto* state = new BatchState(cpu_tensors.size(), std::move(done));
+  for (size_t i = 0; i < cpu_tensors.size(); ++i) {
+    CopyCPUTensorToDevice(
+        cpu_tensors[i], device, device_tensors[i],
+        [state](const absl::Status& s) {
+          if (!s.ok()) {
+            mutex_lock l(state->mu);
+            state->status.Update(s);
+          }
+          if (state->pending.fetch_sub(1) == 1) {
+            absl::Status status;
+            {
+              mutex_lock l(state->mu);
+              status = state->status;
+            }
+            state->done(status);
+            delete state;
+          }
+        },
+        sync_dst_compute);
+  }
+}
+
 const DeviceAttributes& DeviceBase::attributes() const {
   LOG(FATAL) << "DeviceBase does not implement attributes()";  // Crash OK
   std::abort();
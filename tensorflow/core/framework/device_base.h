@@ -22,6 +22,7 @@ limitations under the License.
 
 #include "absl/base/macros.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "tensorflow/core/framework/device_attributes.pb.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/types.h"
@@ -90,6 +91,18 @@ class DeviceContext : public core::RefCounted {
                                          Device* device,
                                          Tensor* device_tensor) const;
 
+  // Copies a batch of CPU tensors to "device" in one call, invoking "done"
+  // exactly once after every copy has completed (with the first error
+  // observed, if any). The default implementation issues one
+  // `CopyCPUTensorToDevice` per tensor; device contexts with staging support
+  // can override it to coalesce the batch into a single transfer.
+  //
+  // REQUIRES: `cpu_tensors.size() == device_tensors.size()`.
+  virtual void CopyCPUTensorsToDevice(
+      absl::Span<const Tensor* const> cpu_tensors, Device* device,
+      absl::Span<Tensor* const> device_tensors, StatusCallback done,
+      bool sync_dst_compute = true) const;
+
   // Copies a tensor in this device.
   virtual void CopyTensorInSameDevice(const Tensor* input_tensor,
                                       Device* device, Tensor* output_tensor,
@@ -1043,6 +1043,32 @@ class AttrKeyAndValue {
   ValueRepresentationOp value_op_;
   string value_;
 };
+
+void RelaxShapeProtoLeadingDim(TensorShapeProto* shape) {
+  if (!shape->unknown_rank() && shape->dim_size() > 0) {
+    shape->mutable_dim(0)->set_size(-1);
+  }
+}
+
+// Returns true iff `attr_value` carries at least one shape, in which case
+// `relaxed` is filled with a copy whose shapes have their leading dimension
+// relaxed to unknown. Used to compute shape-polymorphic instantiation keys.
+bool RelaxAttrValueLeadingDim(const AttrValue& attr_value, AttrValue* relaxed) {
+  if (attr_value.value_case() == AttrValue::kShape) {
+    *relaxed = attr_value;
+    RelaxShapeProtoLeadingDim(relaxed->mutable_shape());
+    return true;
+  }
+  if (attr_value.value_case() == AttrValue::kList &&
+      attr_value.list().shape_size() > 0) {
+    *relaxed = attr_value;
+    for (TensorShapeProto& shape : *relaxed->mutable_list()->mutable_shape()) {
+      RelaxShapeProtoLeadingDim(&shape);
+    }
+    return true;
+  }
+  return false;
+}
 }  // namespace
 
 string GetFunctionResourceInputDevice(
@@ -1077,8 +1103,14 @@ string Canonicalize(const string& funcname, AttrSlice attrs,
                   options.input_devices.size());
   for (const auto& p : attrs) {
     if (p.first != kExecutorAttr) {
-      entries.push_back(AttrKeyAndValue(
-          p.first, -1, Print(p.second, /*hash_string_attrs=*/true)));
+      AttrValue relaxed;
+      const AttrValue& value = options.shape_polymorphic_instantiation &&
+                                       RelaxAttrValueLeadingDim(p.second,
+                                                                &relaxed)
+                                   ? relaxed
+                                   : p.second;
+      entries.push_back(
+          AttrKeyAndValue(p.first, -1, Print(value, /*hash_string_attrs=*/true)));
     }
   }
   if (!options.target.empty()) {
@@ -1097,8 +1129,12 @@ string Canonicalize(const string& funcname, AttrSlice attrs,
   for (const auto& iter : options.input_resource_dtypes_and_shapes) {
     entries.push_back(AttrKeyAndValue("_input_resource_dtype", iter.first,
                                       DataTypeString(iter.second.dtype)));
+    PartialTensorShape resource_shape = iter.second.shape;
+    if (options.shape_polymorphic_instantiation && resource_shape.dims() > 0) {
+      resource_shape.set_dim(0, -1);
+    }
     entries.push_back(AttrKeyAndValue("_input_resource_shape", iter.first,
-                                      iter.second.shape.DebugString(),
+                                      resource_shape.DebugString(),
                                       AttrKeyAndValue::kCEscape));
   }
   if (options.lib_def) {
@@ -1291,6 +1327,13 @@ FunctionLibraryDefinition::FunctionLibraryDefinition(
   Initialize(lib_def, library_traces);
 }
 
+FunctionLibraryDefinition::FunctionLibraryDefinition(
+    const OpRegistryInterface* default_registry, FunctionDefLibrary&& lib_def,
+    const FunctionDefLibraryStackTraces& library_traces)
+    : default_registry_(default_registry), records_(lib_def.function_size()) {
+  Initialize(std::move(lib_def), library_traces);
+}
+
 FunctionLibraryDefinition::FunctionLibraryDefinition(
     const OpRegistryInterface* default_registry, const GraphDef& graph_def)
     : default_registry_(default_registry) {
@@ -1365,6 +1408,30 @@ void FunctionLibraryDefinition::Initialize(
   }
 }
 
+void FunctionLibraryDefinition::Initialize(
+    FunctionDefLibrary&& library,
+    const FunctionDefLibraryStackTraces& library_traces) {
+  tf_shared_lock lock(mu_);
+  for (FunctionDef& fdef : *library.mutable_function()) {
+    const std::string name = fdef.signature().name();
+    // The latter function definition wins.
+    auto iter = records_.find(name);
+    if (iter != records_.end()) {
+      iter->second->Unref();
+      records_.erase(iter);
+    }
+    const auto& it = library_traces.find(name);
+    records_.insert({name, new FunctionRecord(std::move(fdef),
+                                              it != library_traces.end()
+                                                  ? StackTracesMap(it->second)
+                                                  : StackTracesMap(),
+                                              true)});
+  }
+  for (const auto& grad : library.gradient()) {
+    func_grad_[grad.function_name()] = grad.gradient_func();
+  }
+}
+
 bool FunctionLibraryDefinition::Contains(const string& func) const {
   tf_shared_lock l(mu_);
   return records_.find(func) != records_.end();
@@ -418,6 +418,12 @@ class FunctionLibraryDefinition : public OpRegistryInterface {
       const OpRegistryInterface* default_registry,
       const FunctionDefLibrary& lib_def = {},
       const FunctionDefLibraryStackTraces& library_traces = {});
+  // As above, but moves each FunctionDef out of `lib_def` instead of deep
+  // copying it.  Preferred when the caller owns the library: for large
+  // libraries the per-function copies dominate construction time.
+  explicit FunctionLibraryDefinition(
+      const OpRegistryInterface* default_registry, FunctionDefLibrary&& lib_def,
+      const FunctionDefLibraryStackTraces& library_traces = {});
   FunctionLibraryDefinition(const OpRegistryInterface* default_registry,
                             const GraphDef& graph_def);
   ~FunctionLibraryDefinition() override;
@@ -643,6 +649,8 @@ class FunctionLibraryDefinition : public OpRegistryInterface {
  private:
   void Initialize(const FunctionDefLibrary& library,
                   const FunctionDefLibraryStackTraces& library_traces);
+  void Initialize(FunctionDefLibrary&& library,
+                  const FunctionDefLibraryStackTraces& library_traces);
 
   core::RefCountPtr<FunctionRecord> FindHelper(const string& func) const
       TF_SHARED_LOCKS_REQUIRED(mu_);
@@ -844,6 +852,18 @@ class FunctionLibraryRuntime : public core::WeakRefCounted {
     // If true, the function library runtime cache the function instantiation.
     bool use_function_cache = false;
 
+    // This interface is EXPERIMENTAL and subject to change.
+    //
+    // If true, the leading dimension of any shape carried by the function's
+    // attrs (and of `input_resource_dtypes_and_shapes`) is relaxed to unknown
+    // when computing the canonical instantiation key. Instantiations that
+    // differ only in that dimension (typically the batch size) then share a
+    // single cached executor, and concrete sizes are bound at call time from
+    // the actual arguments. Callers must only set this for functions whose
+    // bodies do not specialize on the concrete leading dimension (e.g. via
+    // XLA compilation).
+    bool shape_polymorphic_instantiation = false;
+
     // This interface is EXPERIMENTAL and subject to change.
     //
     // If True, allow optimizations which should be targeted at a limited
@@ -1052,6 +1052,27 @@ TEST(Canonicalize, Basic) {
             "CheckNumericsV2[T=half,message=811750450553548470]");
 }
 
+TEST(Canonicalize, ShapePolymorphic) {
+  FunctionLibraryRuntime::InstantiateOptions options;
+  options.shape_polymorphic_instantiation = true;
+
+  Attrs batch32({{"T", DT_FLOAT}, {"shape", TensorShape({32, 4})}});
+  Attrs batch64({{"T", DT_FLOAT}, {"shape", TensorShape({64, 4})}});
+  Attrs other({{"T", DT_FLOAT}, {"shape", TensorShape({64, 8})}});
+
+  // Without the option, each batch size produces a distinct key.
+  EXPECT_NE(Canonicalize("Forward", batch32,
+                         FunctionLibraryRuntime::InstantiateOptions()),
+            Canonicalize("Forward", batch64,
+                         FunctionLibraryRuntime::InstantiateOptions()));
+  // With it, keys that differ only in the leading dimension collapse.
+  EXPECT_EQ(Canonicalize("Forward", batch32, options),
+            Canonicalize("Forward", batch64, options));
+  // Non-leading dimensions still distinguish instantiations.
+  EXPECT_NE(Canonicalize("Forward", batch64, options),
+            Canonicalize("Forward", other, options));
+}
+
 TEST(FunctionLibraryDefinitionTest, Contains) {
   FunctionLibraryDefinition lib_def(OpRegistry::Global(), FunctionDefLibrary());
   TF_CHECK_OK(lib_def.AddFunctionDef(test::function::XTimesTwo()));
@@ -1135,6 +1156,20 @@ TEST(FunctionLibraryDefinitionTest, AddFunctionDefMove) {
             test::function::XTimesTwo().signature().DebugString());
 }
 
+TEST(FunctionLibraryDefinitionTest, ConstructFromLibraryMove) {
+  FunctionDefLibrary library;
+  *library.add_function() = test::function::XTimesTwo();
+  *library.add_function() = test::function::XTimesFour();
+  FunctionLibraryDefinition lib_def(OpRegistry::Global(), std::move(library));
+  // The protobuf move constructor will empty the moved-from library.
+  EXPECT_EQ(library.function_size(), 0);  // NOLINT
+
+  auto found = lib_def.Find("XTimesTwo");
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(test::function::XTimesTwo().DebugString(), found->DebugString());
+  EXPECT_TRUE(lib_def.Contains("XTimesFour"));
+}
+
 TEST(FunctionLibraryDefinitionTest, AddGradientDef) {
   // AddGradientDef() doesn't check that functions referenced exist (yet?)
   FunctionLibraryDefinition lib_def(OpRegistry::Global(), FunctionDefLibrary());
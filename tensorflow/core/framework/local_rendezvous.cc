@@ -401,6 +401,9 @@ void LocalRendezvous::DoAbort(const absl::Status& status) {
   {
     mutex_lock l(mu_);
     status_.Update(status);
+    // Publish the abort after `status_` is set, so readers that observe the
+    // flag and then acquire `mu_` see the final status.
+    is_aborted_.store(true, std::memory_order_release);
   }
   LOG_EVERY_POW_2(INFO) << "Local rendezvous is aborting with status: "
                         << status;
@@ -437,6 +440,9 @@ void LocalRendezvous::DoAbort(const absl::Status& status) {
 }
 
 absl::Status LocalRendezvous::status() {
+  if (!is_aborted_.load(std::memory_order_acquire)) {
+    return absl::OkStatus();
+  }
   tf_shared_lock ml(mu_);
   return status_;
 }
@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_LOCAL_RENDEZVOUS_H_
 #define TENSORFLOW_CORE_FRAMEWORK_LOCAL_RENDEZVOUS_H_
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -102,6 +103,10 @@ class LocalRendezvous {
   const std::unique_ptr<TableBucket[]> table_buckets_;
   mutex mu_;
   absl::Status status_ TF_GUARDED_BY(mu_);
+  // Fast-path flag mirroring `!status_.ok()`. Send/RecvAsync check this
+  // atomically instead of acquiring `mu_`, so concurrent callers on distinct
+  // keys only ever touch their bucket's lock.
+  std::atomic<bool> is_aborted_{false};
 
   // We deliberately leak one reference of the aborted rendezvous here, so that
   // they won't be destructed, and lose the status_.
@@ -22,6 +22,7 @@ limitations under the License.
 #include <memory>
 #include <optional>
 #include <queue>
+#include <vector>
 
 #include "absl/time/clock.h"
 #include "tensorflow/core/framework/cancellation.h"
@@ -3046,39 +3047,92 @@ bool Model::UpsizeBuffers(std::shared_ptr<Node> snapshot, int64_t ram_budget) {
   absl::flat_hash_map<Node*, Parameter*> node_parameters =
       CollectBufferParametersToUpsize(snapshot);
 
-  // Compute available memory.
+  // Compute available memory. The RAM budget is a hard constraint: buffers
+  // are only grown into memory that is still unclaimed under the budget.
   double available_ram_bytes =
       static_cast<double>(ram_budget) - TotalMaximumBufferedBytes(snapshot);
 
-  // Compute the max memory used by all buffers that should be upsized.
-  double max_buffered_bytes = 0;
+  // All collected buffers were fully drained at least once since the last
+  // optimization, so each is a bottleneck candidate. Allocate the available
+  // memory one buffer slot at a time to the candidate with the largest
+  // estimated marginal throughput gain per byte: the gain of one more slot
+  // diminishes with the current buffer size and its cost is the average
+  // element size, so the score of growing a buffer from `v` to `v + 1`
+  // elements is `1 / ((v + 1) * element_bytes)`. Growth per optimization
+  // round is still capped at `kBufferUpsizeMultiplier` so buffer sizes ramp
+  // up geometrically rather than jumping straight to the budget. Buffers with
+  // no element size estimate yet are grown by the full multiplier since their
+  // memory cost cannot be attributed.
+  struct Candidate {
+    Node* node;
+    Parameter* parameter;
+    double value;
+    double target;
+    double element_bytes;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(node_parameters.size());
   for (auto& [node, parameter] : node_parameters) {
+    Candidate candidate;
+    candidate.node = node;
+    candidate.parameter = parameter;
+    candidate.value = parameter->value;
+    // Scale the target buffer_size value, capped at its max value. Use 1 if
+    // it is less than 1.
+    candidate.target = std::min(
+        parameter->max,
+        std::max(1.0, static_cast<double>(static_cast<int64_t>(
+                          parameter->value * kBufferUpsizeMultiplier))));
     if (node->buffered_elements() == 0) {
-      continue;
+      candidate.element_bytes = 0.0;
+      candidate.value = candidate.target;
+    } else {
+      candidate.element_bytes = static_cast<double>(node->buffered_bytes()) /
+                                static_cast<double>(node->buffered_elements());
     }
-    max_buffered_bytes += static_cast<double>(node->buffered_bytes()) /
-                          static_cast<double>(node->buffered_elements()) *
-                          parameter->value;
+    candidates.push_back(candidate);
   }
-
-  // Compute a uniform scaling factor for all buffers. Cap the factor at 2.
-  double scaling_factor = kBufferUpsizeMultiplier;
-  if (max_buffered_bytes > 0) {
-    scaling_factor =
-        1.0 + std::min(1.0, available_ram_bytes / max_buffered_bytes);
+  auto marginal_gain_per_byte = [](const Candidate& candidate) {
+    return 1.0 / ((candidate.value + 1.0) * candidate.element_bytes);
+  };
+  // Ties are broken by node id to keep the allocation deterministic.
+  auto has_lower_priority = [&marginal_gain_per_byte](Candidate* lhs,
+                                                      Candidate* rhs) {
+    const double lhs_gain = marginal_gain_per_byte(*lhs);
+    const double rhs_gain = marginal_gain_per_byte(*rhs);
+    if (lhs_gain != rhs_gain) {
+      return lhs_gain < rhs_gain;
+    }
+    return lhs->node->id() > rhs->node->id();
+  };
+  std::priority_queue<Candidate*, std::vector<Candidate*>,
+                      decltype(has_lower_priority)>
+      queue(has_lower_priority);
+  for (auto& candidate : candidates) {
+    if (candidate.element_bytes > 0 && candidate.value < candidate.target) {
+      queue.push(&candidate);
+    }
+  }
+  while (!queue.empty()) {
+    Candidate* candidate = queue.top();
+    queue.pop();
+    if (candidate->element_bytes > available_ram_bytes) {
+      continue;
+    }
+    available_ram_bytes -= candidate->element_bytes;
+    candidate->value += 1.0;
+    if (candidate->value < candidate->target) {
+      queue.push(candidate);
+    }
   }
 
   bool upsized = false;
-  // Up-size all buffers by the scaling factor.
-  for (auto& [node, parameter] : node_parameters) {
-    double old_value = parameter->value;
-    // Scale the new buffer_size value. Use 1 if it is less than 1.
-    double new_value = std::max(1.0, static_cast<double>(static_cast<int64_t>(
-                                         parameter->value * scaling_factor)));
-    // Cap the new buffer_size value at its max value.
-    parameter->value = std::min(parameter->max, new_value);
-    VLOG(2) << "Upsize buffer " << node->long_name() << "::" << parameter->name
-            << " from " << old_value << " to " << parameter->value;
+  for (auto& candidate : candidates) {
+    Parameter* parameter = candidate.parameter;
+    VLOG(2) << "Upsize buffer " << candidate.node->long_name()
+            << "::" << parameter->name << " from " << parameter->value << " to "
+            << candidate.value;
+    parameter->value = candidate.value;
     {
       mutex_lock l(*parameter->state->mu);
       if (parameter->value != parameter->state->value) {
@@ -64,6 +64,30 @@ AttrSlice::AttrSlice(const NodeDef& node_def)
 
 AttrSlice::AttrSlice(const AttrValueMap* a) : ndef_(nullptr), attrs_(a) {}
 
+AttrSlice::AttrSlice(const FlatAttrs& flat)
+    : ndef_(flat.ndef_), attrs_(nullptr), flat_(&flat) {}
+
+FlatAttrs::FlatAttrs(const NodeDef& node_def) : ndef_(&node_def) {
+  attrs_.reserve(node_def.attr().size());
+  for (const auto& attr : node_def.attr()) {
+    attrs_.emplace_back(StringPiece(attr.first), &attr.second);
+  }
+  std::sort(attrs_.begin(), attrs_.end(),
+            [](const std::pair<StringPiece, const AttrValue*>& a,
+               const std::pair<StringPiece, const AttrValue*>& b) {
+              return a.first < b.first;
+            });
+}
+
+const AttrValue* FlatAttrs::Find(StringPiece attr_name) const {
+  auto it = std::lower_bound(
+      attrs_.begin(), attrs_.end(), attr_name,
+      [](const std::pair<StringPiece, const AttrValue*>& entry,
+         StringPiece name) { return entry.first < name; });
+  if (it == attrs_.end() || it->first != attr_name) return nullptr;
+  return it->second;
+}
+
 string SummarizeAttrsHelper(AttrSlice attrs, StringPiece device) {
   string ret;
 
@@ -152,6 +176,9 @@ string FormatNodeDefForError(const NodeDef& node_def) {
 }
 
 const AttrValue* AttrSlice::Find(StringPiece attr_name) const {
+  if (flat_ != nullptr) {
+    return flat_->Find(attr_name);
+  }
   // Currently, the collection used for NodeDef::attr() (google::protobuf::Map)
   // requires that the keys used for lookups have type 'const string&'. Because
   // this method takes a StringPiece, it is necessary to allocate a temporary
@@ -174,6 +201,9 @@ const AttrValue* AttrSlice::Find(StringPiece attr_name) const {
 }
 
 const AttrValue* AttrSlice::FindByString(const string& attr_name) const {
+  if (flat_ != nullptr) {
+    return flat_->Find(attr_name);
+  }
   auto iter = attrs()->find(attr_name);
   if (iter != attrs()->end()) {
     return &iter->second;
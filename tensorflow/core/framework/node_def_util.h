@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "tensorflow/core/framework/attr_value_util.h"
@@ -30,6 +31,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/stringpiece.h"
 #include "tensorflow/core/lib/gtl/array_slice.h"
 #include "tensorflow/core/lib/gtl/flatmap.h"
+#include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/platform/hash.h"
 #include "tensorflow/core/platform/protobuf.h"
@@ -142,6 +144,29 @@ void AddNodeAttr(StringPiece name, std::initializer_list<T> value,
 void AddAttr(StringPiece name, const AttrValue& value, AttrValueMap* map);
 void AddAttr(StringPiece name, bool value, AttrValueMap* map);
 
+// An immutable, flat, sorted index over the attributes of a NodeDef.
+//
+// Resolving an attribute through a NodeDef costs either a protobuf map probe
+// with a temporary string key or a linear scan over the map (see
+// AttrSlice::Find). Code that looks up many attributes of the same node --
+// kernel construction in particular -- can build a FlatAttrs once and resolve
+// each name with a binary search over a small contiguous array instead. The
+// names and values reference the NodeDef's own storage, so the NodeDef must
+// outlive the index and must not be mutated while the index is in use.
+class FlatAttrs {
+ public:
+  explicit FlatAttrs(const NodeDef& node_def);
+
+  // Returns the attr with attr_name if found.  Otherwise, returns nullptr.
+  const AttrValue* Find(StringPiece attr_name) const;
+
+ private:
+  friend class AttrSlice;
+
+  const NodeDef* ndef_;
+  gtl::InlinedVector<std::pair<StringPiece, const AttrValue*>, 8> attrs_;
+};
+
 class AttrSlice {
  public:
   AttrSlice(const NodeDef& node_def);  // NOLINT(runtime/explicit)
@@ -149,6 +174,10 @@ class AttrSlice {
   AttrSlice();  // Empty
   explicit AttrSlice(const AttrValueMap* a);
 
+  // A slice backed by a prebuilt flat index; lookups bypass the proto map.
+  // `flat` must outlive this slice.
+  explicit AttrSlice(const FlatAttrs& flat);
+
   int size() const { return attrs()->size(); }
 
   // Returns the attr with attr_name if found.  Otherwise, returns
@@ -201,6 +230,7 @@ class AttrSlice {
 
   const NodeDef* ndef_;
   const AttrValueMap* attrs_;
+  const FlatAttrs* flat_ = nullptr;
 };
 
 // Return true if the attr with the name attr_name is defined in node_def.
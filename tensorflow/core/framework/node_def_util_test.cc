@@ -194,6 +194,35 @@ TEST(NodeDefUtilTest, Enum) {
                 "values: \"apple\", \"orange\"");
 }
 
+TEST(NodeDefUtilTest, FlatAttrs) {
+  NodeDef node_def;
+  node_def.set_name("n");
+  node_def.set_op("AnyOp");
+  AddNodeAttr("T", DT_FLOAT, &node_def);
+  AddNodeAttr("value", 12, &node_def);
+  AddNodeAttr("_class", "loc:@a", &node_def);
+
+  const FlatAttrs flat(node_def);
+  const AttrSlice attrs(flat);
+  EXPECT_EQ(attrs.size(), 3);
+
+  // Lookups through the flat index agree with lookups through the proto map.
+  for (const string& name : {"T", "value", "_class"}) {
+    EXPECT_EQ(flat.Find(name), AttrSlice(node_def).FindByString(name));
+    EXPECT_EQ(attrs.Find(name), AttrSlice(node_def).FindByString(name));
+  }
+  EXPECT_EQ(flat.Find("missing"), nullptr);
+  EXPECT_EQ(attrs.Find("missing"), nullptr);
+
+  DataType dt;
+  TF_EXPECT_OK(GetNodeAttr(attrs, "T", &dt));
+  EXPECT_EQ(dt, DT_FLOAT);
+  int32_t value;
+  TF_EXPECT_OK(GetNodeAttr(attrs, "value", &value));
+  EXPECT_EQ(value, 12);
+  EXPECT_FALSE(GetNodeAttr(attrs, "missing", &value).ok());
+}
+
 TEST(NodeDefUtilTest, SameIn) {
   const OpDef op = ToOpDef(OpDefBuilder("SameIn")
                                .Input("i: N * T")
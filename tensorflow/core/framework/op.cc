@@ -48,8 +48,27 @@ absl::Status OpRegistryInterface::LookUpOpDef(const string& op_type_name,
   return absl::OkStatus();
 }
 
+// A frozen, sorted view of the registry. The names are copied (small-string
+// keys in registry_ can relocate on rehash) but the OpRegistrationData
+// objects are owned by registry_ and never removed, so pointers to them stay
+// valid for the process lifetime.
+struct OpRegistry::FrozenRegistry {
+  std::vector<std::pair<string, const OpRegistrationData*>> entries;
+
+  const OpRegistrationData* Find(const string& op_type_name) const {
+    auto it = std::lower_bound(
+        entries.begin(), entries.end(), op_type_name,
+        [](const std::pair<string, const OpRegistrationData*>& entry,
+           const string& name) { return entry.first < name; });
+    if (it == entries.end() || it->first != op_type_name) return nullptr;
+    return it->second;
+  }
+};
+
 OpRegistry::OpRegistry()
-    : initialized_(false), op_registry_validator_(DefaultValidator) {}
+    : initialized_(false),
+      frozen_stale_(true),
+      op_registry_validator_(DefaultValidator) {}
 
 void OpRegistry::Register(const OpRegistrationDataFactory& op_data_factory) {
   mutex_lock lock(mu_);
@@ -83,6 +102,14 @@ absl::Status OpRegistry::LookUp(const string& op_type_name,
 }
 
 const OpRegistrationData* OpRegistry::LookUp(const string& op_type_name) const {
+  // Hits against the frozen snapshot need no lock. The snapshot may lag
+  // behind late registrations, but entries are never removed or mutated, so
+  // a hit is always valid; misses take the locked path below.
+  if (const FrozenRegistry* frozen = frozen_.load(std::memory_order_acquire)) {
+    if (const OpRegistrationData* res = frozen->Find(op_type_name)) {
+      return res;
+    }
+  }
   {
     tf_shared_lock l(mu_);
     if (initialized_) {
@@ -104,6 +131,9 @@ const OpRegistrationData* OpRegistry::LookUpSlow(
   {  // Scope for lock.
     mutex_lock lock(mu_);
     first_call = MustCallDeferred();
+    if (frozen_stale_) {
+      RebuildFrozenRegistry();
+    }
     res = gtl::FindWithDefault(registry_, op_type_name, nullptr).get();
 
     static bool unregistered_before = false;
@@ -205,6 +235,24 @@ string OpRegistry::DebugString(bool include_internal) const {
   return ret;
 }
 
+void OpRegistry::RebuildFrozenRegistry() const {
+  auto frozen = std::make_unique<FrozenRegistry>();
+  frozen->entries.reserve(registry_.size());
+  for (const auto& entry : registry_) {
+    frozen->entries.emplace_back(entry.first, entry.second.get());
+  }
+  std::sort(frozen->entries.begin(), frozen->entries.end(),
+            [](const std::pair<string, const OpRegistrationData*>& a,
+               const std::pair<string, const OpRegistrationData*>& b) {
+              return a.first < b.first;
+            });
+  frozen_.store(frozen.get(), std::memory_order_release);
+  // retired_frozen_ owns the published snapshot and all of its predecessors;
+  // readers may still hold pointers into retired ones.
+  retired_frozen_.push_back(std::move(frozen));
+  frozen_stale_ = false;
+}
+
 bool OpRegistry::MustCallDeferred() const {
   if (initialized_) return false;
   initialized_ = true;
@@ -243,6 +291,9 @@ absl::Status OpRegistry::RegisterAlreadyLocked(
            .second) {
     s = errors::AlreadyExists("Op with name ", op_reg_data->op_def.name());
   }
+  if (s.ok()) {
+    frozen_stale_ = true;
+  }
   absl::Status watcher_status = s;
   if (watcher_) {
     watcher_status = watcher_(s, op_reg_data_raw->op_def);
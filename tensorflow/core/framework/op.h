@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_OP_H_
 #define TENSORFLOW_CORE_FRAMEWORK_OP_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -161,6 +162,14 @@ class OpRegistry : public OpRegistryInterface {
 
   const OpRegistrationData* LookUpSlow(const std::string& op_type_name) const;
 
+  // An immutable snapshot of registry_ that lock-free readers search; see
+  // the comment on frozen_ below.
+  struct FrozenRegistry;
+
+  // Rebuilds the frozen snapshot from registry_ and publishes it, retiring
+  // the previous snapshot.
+  void RebuildFrozenRegistry() const TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   mutable mutex mu_;
   // Functions in deferred_ may only be called with mu_ held.
   mutable std::vector<OpRegistrationDataFactory> deferred_ TF_GUARDED_BY(mu_);
@@ -169,6 +178,18 @@ class OpRegistry : public OpRegistryInterface {
       registry_ TF_GUARDED_BY(mu_);
   mutable bool initialized_ TF_GUARDED_BY(mu_);
 
+  // Lock-free lookup snapshot. Once the deferred registrations have been
+  // processed, LookUp serves hits from this frozen sorted array without
+  // taking mu_. Registrations that arrive afterwards mark the snapshot stale;
+  // hits against a stale snapshot are still valid since registrations are
+  // never removed or mutated, and misses fall back to the locked path, which
+  // rebuilds the snapshot. Retired snapshots are kept alive because readers
+  // may still hold pointers into them.
+  mutable std::atomic<const FrozenRegistry*> frozen_{nullptr};
+  mutable bool frozen_stale_ TF_GUARDED_BY(mu_);
+  mutable std::vector<std::unique_ptr<const FrozenRegistry>> retired_frozen_
+      TF_GUARDED_BY(mu_);
+
   // Registry watcher.
   mutable Watcher watcher_ TF_GUARDED_BY(mu_);
 
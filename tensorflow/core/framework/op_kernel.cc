@@ -268,13 +268,14 @@ OpKernelConstruction::OpKernelConstruction(
       flib_(flib),
       resource_mgr_(resource_mgr),
       props_(props),
+      flat_attrs_(props_->node_def),
       input_memory_types_(input_memory_types),
       output_memory_types_(output_memory_types),
       graph_def_version_(graph_def_version),
       status_(status) {}
 
 bool OpKernelConstruction::HasAttr(StringPiece attr_name) const {
-  return HasNodeAttr(def(), attr_name);
+  return attrs().Find(attr_name) != nullptr;
 }
 
 void OpKernelConstruction::SetStatus(const absl::Status& status) {
@@ -358,8 +359,9 @@ OpKernelContext::OpKernelContext(Params* params, int num_outputs)
 }
 
 OpKernelContext::~OpKernelContext() {
-  for (TensorValue& value : outputs_) {
-    if (!value.is_ref()) {
+  for (int i = 0; i < static_cast<int>(outputs_.size()); ++i) {
+    TensorValue& value = outputs_[i];
+    if (!value.is_ref() && !output_is_inline(i)) {
       delete value.tensor;
     }
   }
@@ -824,10 +826,24 @@ absl::Status OpKernelContext::allocate_output(int index,
   tsl::profiler::ScopedMemoryDebugAnnotation op_annotation(
       op_kernel().name_view().data(), step_id(), "output", type,
       [&shape]() { return shape.DebugString(); });
-  auto output_tensor = std::make_unique<Tensor>();
-  absl::Status s = allocate_tensor(type, shape, output_tensor.get(), attr);
+  const bool use_inline =
+      params_->inline_output_storage && index < kNumInlineOutputs;
+  std::unique_ptr<Tensor> heap_tensor;
+  Tensor* output_tensor;
+  if (use_inline) {
+    output_tensor = &inline_outputs_[index];
+  } else {
+    heap_tensor = std::make_unique<Tensor>();
+    output_tensor = heap_tensor.get();
+  }
+  absl::Status s = allocate_tensor(type, shape, output_tensor, attr);
   if (s.ok()) {
-    outputs_[index] = TensorValue(output_tensor.release());
+    if (use_inline) {
+      inline_outputs_used_ |= (1u << index);
+    } else {
+      heap_tensor.release();
+    }
+    outputs_[index] = TensorValue(output_tensor);
     *output = outputs_[index].tensor;
   }
   return s;
@@ -962,19 +978,25 @@ bool OpKernelContext::maybe_set_output_by_allocate_and_copy(
     tsl::profiler::ScopedMemoryDebugAnnotation op_annotation(
         op_kernel().name_view().data(), step_id(), "output", tensor.dtype(),
         [&tensor]() { return tensor.shape().DebugString(); });
-    auto new_tensor = std::make_unique<Tensor>();
-    absl::Status s =
-        allocate_tensor(tensor.dtype(), tensor.shape(), new_tensor.get(),
-                        output_alloc_attr(index));
+    Tensor* new_tensor = output_tensor_storage(index);
+    absl::Status s = allocate_tensor(tensor.dtype(), tensor.shape(), new_tensor,
+                                     output_alloc_attr(index));
     TF_CHECK_OK(s);
-    device()->CopyTensorInSameDevice(&tensor, new_tensor.get(),
-                                     op_device_context(),
+    device()->CopyTensorInSameDevice(&tensor, new_tensor, op_device_context(),
                                      [](const absl::Status&) {});
-    outputs_[index] = TensorValue(new_tensor.release());
+    outputs_[index] = TensorValue(new_tensor);
   }
   return allocate_and_copy;
 }
 
+Tensor* OpKernelContext::output_tensor_storage(int index) {
+  if (params_->inline_output_storage && index < kNumInlineOutputs) {
+    inline_outputs_used_ |= (1u << index);
+    return &inline_outputs_[index];
+  }
+  return new Tensor;
+}
+
 void OpKernelContext::maybe_track_allocations_for_set_output(
     const Tensor& tensor) {
   if (TF_PREDICT_FALSE(track_allocations()) && tensor.TotalBytes() > 0) {
@@ -1003,7 +1025,9 @@ void OpKernelContext::set_output(int index, const Tensor& tensor) {
   if (TF_PREDICT_TRUE(!maybe_set_output_by_allocate_and_copy(index, tensor))) {
     // Input can be forwarded to output; incref on `tensor` and set output at
     // `index` to this tensor.
-    outputs_[index] = TensorValue(new Tensor(tensor));
+    Tensor* out_tensor = output_tensor_storage(index);
+    *out_tensor = tensor;
+    outputs_[index] = TensorValue(out_tensor);
     maybe_track_allocations_for_set_output(*outputs_[index].tensor);
   }
 }
@@ -1016,7 +1040,9 @@ void OpKernelContext::set_output(int index, Tensor&& tensor) {
   CHECK_EQ(outputs_[index].tensor, nullptr);
   if (TF_PREDICT_TRUE(!maybe_set_output_by_allocate_and_copy(index, tensor))) {
     // Input can be forwarded to output; set output at `index` to this tensor.
-    outputs_[index] = TensorValue(new Tensor(std::move(tensor)));
+    Tensor* out_tensor = output_tensor_storage(index);
+    *out_tensor = std::move(tensor);
+    outputs_[index] = TensorValue(out_tensor);
     maybe_track_allocations_for_set_output(*outputs_[index].tensor);
   }
 }
@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_OP_KERNEL_H_
 #define TENSORFLOW_CORE_FRAMEWORK_OP_KERNEL_H_
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -23,6 +24,7 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/span.h"
@@ -286,6 +288,10 @@ class OpKernelConstruction {
   // User-supplied configuration of this operation.
   const NodeDef& def() const { return props_->node_def; }
 
+  // Attribute view over def(), backed by a flat index built once at kernel
+  // construction time.
+  AttrSlice attrs() const { return AttrSlice(flat_attrs_); }
+
   // For inspecting the inputs to this operation.
   int num_inputs() const { return props_->input_types.size(); }
   DataType input_type(int i) const { return props_->input_types[i]; }
@@ -363,6 +369,10 @@ class OpKernelConstruction {
   FunctionLibraryRuntime* flib_;
   ResourceMgr* const resource_mgr_;
   std::shared_ptr<const NodeProperties> props_;
+  // Flat sorted index over def().attr(); kernel constructors typically look
+  // up many attrs of the same node, so resolve them here instead of probing
+  // the proto map each time.
+  const FlatAttrs flat_attrs_;
   MemoryTypeSlice input_memory_types_;
   MemoryTypeSlice output_memory_types_;
   const int graph_def_version_;
@@ -701,6 +711,14 @@ class OpKernelContext {
     // outputs are required.
     bool* outputs_required_array = nullptr;
 
+    // If true, Tensor objects for the first kNumInlineOutputs outputs are
+    // placed in storage inside the OpKernelContext instead of being
+    // heap-allocated per call to allocate_output()/set_output().  Only set
+    // this when the consumer of release_output() checks output_is_inline()
+    // and refrains from deleting inline tensors; they are owned by the
+    // context and remain valid until it is destroyed.
+    bool inline_output_storage = false;
+
     // For access to distributed coordination service.
     tsl::CoordinationServiceAgent* coordination_service_agent = nullptr;
   };
@@ -722,6 +740,15 @@ class OpKernelContext {
   // RunOptions.
   std::optional<absl::Time> deadline() const { return params_->deadline; }
 
+  // Returns true iff a session deadline was set and has already passed.
+  // Expensive kernels may poll this between units of work so that they stop
+  // computing on behalf of callers that have already timed out; a kernel that
+  // skips work because of an expired deadline must fail with DeadlineExceeded
+  // rather than return a partial result.
+  bool IsDeadlineExceeded() const {
+    return params_->deadline.has_value() && absl::Now() >= *params_->deadline;
+  }
+
   const OpKernel& op_kernel() const { return *params_->op_kernel; }
 
   // Stack trace of where the op was defined (if defined in eager mode).
@@ -1205,6 +1232,19 @@ class OpKernelContext {
   void set_output_ref(int index, mutex* mu, Tensor* tensor_for_ref);
   TensorValue release_output(int index);
 
+  // Number of output Tensor objects that can be stored inline in the context
+  // when Params::inline_output_storage is set.
+  static constexpr int kNumInlineOutputs = 4;
+
+  // Returns true iff output `index` was placed in this context's inline
+  // output storage (see Params::inline_output_storage).  Such tensors are
+  // owned by the context: a consumer of release_output() must not delete
+  // them.
+  bool output_is_inline(int index) const {
+    return index < kNumInlineOutputs &&
+           (inline_outputs_used_ & (1u << index)) != 0;
+  }
+
   bool track_allocations() const { return params_->track_allocations; }
 
   // Records temp memory allocation. Tensor object is recorded to identify the
@@ -1291,6 +1331,11 @@ class OpKernelContext {
 
   // Helpers for `set_output()`.
 
+  // Returns storage for the Tensor object of output `index`: a slot in the
+  // inline output array when Params::inline_output_storage permits, a
+  // heap-allocated Tensor otherwise.
+  Tensor* output_tensor_storage(int index);
+
   // Returns `true` if the tensor was copied into an allocated output.
   bool maybe_set_output_by_allocate_and_copy(int index, const Tensor& tensor);
 
@@ -1308,6 +1353,11 @@ class OpKernelContext {
   Params* params_;                  // not owned
   absl::InlinedVector<TensorValue, 4UL> outputs_;
 
+  // Inline storage for output Tensor objects, used when
+  // params_->inline_output_storage is set; see output_is_inline().
+  std::array<Tensor, kNumInlineOutputs> inline_outputs_;
+  uint32 inline_outputs_used_ = 0;
+
   // Keep track of calls to ScopedAllocator.
   // TODO(ayushd): change to absl::flat_hash_set.
   std::unique_ptr<std::unordered_set<int32>> allocated_scope_ids_;
@@ -1591,7 +1641,7 @@ class OpKernelRegistrar {
 template <class T>
 absl::Status OpKernelConstruction::GetAttr(StringPiece attr_name,
                                            T* value) const {
-  return GetNodeAttr(def(), attr_name, value);
+  return GetNodeAttr(attrs(), attr_name, value);
 }
 
 inline DataType OpKernelContext::input_dtype(int index) const {
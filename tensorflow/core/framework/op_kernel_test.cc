@@ -627,6 +627,74 @@ TEST_F(OpKernelTest, ScopedAllocationTest) {
   EXPECT_EQ(sa_device->num_allocations(true), 1);
 }
 
+TEST_F(OpKernelTest, IsDeadlineExceeded) {
+  Env* env = Env::Default();
+  OpKernelContext::Params params;
+  DummyDevice device(env);
+  params.device = &device;
+
+  absl::Status status;
+  std::unique_ptr<OpKernel> op(CreateOpKernel(
+      DEVICE_CPU, params.device, cpu_allocator(),
+      CreateNodeDef("Test1", {DT_FLOAT, DT_INT32}), TF_GRAPH_DEF_VERSION,
+      &status));
+  TF_CHECK_OK(status);
+  params.op_kernel = op.get();
+
+  {
+    // No deadline set.
+    OpKernelContext ctx(&params);
+    EXPECT_FALSE(ctx.IsDeadlineExceeded());
+  }
+  {
+    params.deadline = absl::Now() + absl::Hours(1);
+    OpKernelContext ctx(&params);
+    EXPECT_FALSE(ctx.IsDeadlineExceeded());
+  }
+  {
+    params.deadline = absl::Now() - absl::Seconds(1);
+    OpKernelContext ctx(&params);
+    EXPECT_TRUE(ctx.IsDeadlineExceeded());
+  }
+}
+
+TEST_F(OpKernelTest, InlineOutputStorage) {
+  Env* env = Env::Default();
+  OpKernelContext::Params params;
+  DummyDevice device(env);
+  params.device = &device;
+
+  absl::Status status;
+  std::unique_ptr<OpKernel> op(CreateOpKernel(
+      DEVICE_CPU, params.device, cpu_allocator(),
+      CreateNodeDef("Test4", {DT_FLOAT}), TF_GRAPH_DEF_VERSION, &status));
+  TF_CHECK_OK(status);
+  params.op_kernel = op.get();
+  std::vector<AllocatorAttributes> output_alloc_attrs(1);
+  params.output_attr_array = output_alloc_attrs.data();
+
+  {
+    // By default, output Tensor objects are heap-allocated and ownership
+    // passes to the caller of release_output().
+    OpKernelContext ctx(&params);
+    Tensor* out = nullptr;
+    TF_EXPECT_OK(ctx.allocate_output(0, TensorShape({4}), &out));
+    EXPECT_FALSE(ctx.output_is_inline(0));
+    delete ctx.release_output(0).tensor;
+  }
+  {
+    // With inline_output_storage set, the Tensor object lives in the context
+    // and must not be deleted by the consumer.
+    params.inline_output_storage = true;
+    OpKernelContext ctx(&params);
+    Tensor* out = nullptr;
+    TF_EXPECT_OK(ctx.allocate_output(0, TensorShape({4}), &out));
+    EXPECT_TRUE(ctx.output_is_inline(0));
+    TensorValue val = ctx.release_output(0);
+    EXPECT_EQ(val.tensor, out);
+  }
+}
+
 TEST_F(OpKernelTest, TraceString) {
   Env* env = Env::Default();
   OpKernelContext::Params params;
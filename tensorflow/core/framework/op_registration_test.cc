@@ -43,6 +43,23 @@ TEST(OpRegistrationTest, TestBasic) {
   EXPECT_EQ(op_list.op(0).name(), "Foo");
 }
 
+TEST(OpRegistrationTest, TestLookUpAfterFreezeAndLateRegistration) {
+  std::unique_ptr<OpRegistry> registry(new OpRegistry);
+  Register("Foo", registry.get());
+
+  // The first lookup processes deferred registrations and freezes the
+  // registry; subsequent hits are served from the frozen snapshot.
+  const OpRegistrationData* foo = registry->LookUp("Foo");
+  ASSERT_NE(foo, nullptr);
+  EXPECT_EQ(registry->LookUp("Foo"), foo);
+  EXPECT_EQ(registry->LookUp("Bar"), nullptr);
+
+  // Late registrations must still be visible, and earlier results stable.
+  Register("Bar", registry.get());
+  EXPECT_NE(registry->LookUp("Bar"), nullptr);
+  EXPECT_EQ(registry->LookUp("Foo"), foo);
+}
+
 TEST(OpRegistrationTest, TestDuplicate) {
   std::unique_ptr<OpRegistry> registry(new OpRegistry);
   Register("Foo", registry.get());
@@ -81,6 +81,7 @@ absl::Status ValidateDevice(OpKernelContext* ctx, const ResourceHandle& p) {
 
 absl::Status ResourceMgr::InsertDebugTypeName(uint64 hash_code,
                                               const string& type_name) {
+  mutex_lock l(debug_mu_);
   auto iter = debug_type_names_.emplace(hash_code, type_name);
   if (iter.first->second != type_name) {
     return errors::AlreadyExists("Duplicate hash code found for type ",
@@ -90,6 +91,7 @@ absl::Status ResourceMgr::InsertDebugTypeName(uint64 hash_code,
 }
 
 const char* ResourceMgr::DebugTypeName(uint64 hash_code) const {
+  mutex_lock l(debug_mu_);
   auto type_name_iter = debug_type_names_.find(hash_code);
   if (type_name_iter == debug_type_names_.end()) {
     return "<unknown>";
@@ -140,55 +142,48 @@ ResourceMgr::ResourceMgr(const string& default_container)
 ResourceMgr::~ResourceMgr() { Clear(); }
 
 void ResourceMgr::Clear() {
-  // We do the deallocation outside of the lock to avoid a potential deadlock
+  // We do the deallocation outside of the locks to avoid a potential deadlock
   // in case any of the destructors access the resource manager.
-  absl::flat_hash_map<string, Container*> tmp_containers;
-  {
-    mutex_lock l(mu_);
-    tmp_containers = std::move(containers_);
-    containers_.clear();  // reinitialize after move.
+  std::vector<Container*> tmp_containers;
+  for (ContainerShard& s : shards_) {
+    mutex_lock l(s.mu);
+    for (const auto& p : s.containers) {
+      tmp_containers.push_back(p.second);
+    }
+    s.containers.clear();
   }
-  for (const auto& p : tmp_containers) {
-    delete p.second;
+  for (Container* c : tmp_containers) {
+    delete c;
   }
 }
 
 string ResourceMgr::DebugString() const {
-  mutex_lock l(mu_);
-  struct Line {
-    const string* container;
-    const string type;
-    const string* resource;
-    const string detail;
-  };
-  std::vector<Line> lines;
-  for (const auto& p : containers_) {
-    const string& container = p.first;
-    for (const auto& q : *p.second) {
-      const Key& key = q.first;
-      const char* type = DebugTypeName(key.first);
-      const core::RefCountPtr<ResourceBase> resource = q.second.GetResource();
-      Line l{&container, port::Demangle(type), q.second.name.get(),
-             resource ? resource->DebugString() : "<nullptr>"};
-      lines.push_back(l);
-    }
-  }
   std::vector<string> text;
-  text.reserve(lines.size());
-  for (const Line& line : lines) {
-    text.push_back(strings::Printf(
-        "%-20s | %-40s | %-40s | %-s", line.container->c_str(),
-        line.type.c_str(), line.resource->c_str(), line.detail.c_str()));
+  for (const ContainerShard& s : shards_) {
+    mutex_lock l(s.mu);
+    for (const auto& p : s.containers) {
+      const string& container = p.first;
+      for (const auto& q : *p.second) {
+        const Key& key = q.first;
+        const char* type = DebugTypeName(key.first);
+        const core::RefCountPtr<ResourceBase> resource = q.second.GetResource();
+        text.push_back(strings::Printf(
+            "%-20s | %-40s | %-40s | %-s", container.c_str(),
+            port::Demangle(type).c_str(), q.second.name->c_str(),
+            resource ? resource->DebugString().c_str() : "<nullptr>"));
+      }
+    }
   }
   std::sort(text.begin(), text.end());
   return absl::StrJoin(text, "\n");
 }
 
-absl::Status ResourceMgr::DoCreate(const string& container_name, TypeIndex type,
+absl::Status ResourceMgr::DoCreate(ContainerShard& shard,
+                                   const string& container_name, TypeIndex type,
                                    const string& name, ResourceBase* resource,
                                    bool owns_resource) {
-  Container* container = [&]() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    Container** ptr = &containers_[container_name];
+  Container* container = [&]() TF_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    Container** ptr = &shard.containers[container_name];
     if (*ptr == nullptr) {
       *ptr = new Container;
     }
@@ -204,8 +199,9 @@ absl::Status ResourceMgr::DoCreate(const string& container_name, TypeIndex type,
   if (owns_resource) {
     resource_and_name.resource = core::RefCountPtr<ResourceBase>(resource);
   } else {
-    auto cleanup_fn = [this, container, type, borrowed_name]() {
-      mutex_lock l(mu_);
+    ContainerShard* shard_ptr = &shard;
+    auto cleanup_fn = [shard_ptr, container, type, borrowed_name]() {
+      mutex_lock l(shard_ptr->mu);
       auto iter = container->find({type.hash_code(), borrowed_name});
       if (iter != container->end()) {
         container->erase(iter);
@@ -229,23 +225,27 @@ absl::Status ResourceMgr::DoCreate(const string& container_name, TypeIndex type,
 
 absl::Status ResourceMgr::Lookup(const ResourceHandle& handle,
                                  ResourceBase** resource) const {
-  tf_shared_lock l(mu_);
-  return DoLookup(handle.container(), handle.hash_code(),
+  const ContainerShard& s = shard(handle.container());
+  tf_shared_lock l(s.mu);
+  return DoLookup(s, handle.container(), handle.hash_code(),
                   /*type_name=*/"ResourceBase", handle.name(), resource);
 }
 
-absl::Status ResourceMgr::DoLookup(const string& container, TypeIndex type,
+absl::Status ResourceMgr::DoLookup(const ContainerShard& shard,
+                                   const string& container, TypeIndex type,
                                    const string& name,
                                    ResourceBase** resource) const {
-  return DoLookup(container, type.hash_code(), type.name(), name, resource);
+  return DoLookup(shard, container, type.hash_code(), type.name(), name,
+                  resource);
 }
 
-absl::Status ResourceMgr::DoLookup(const string& container,
+absl::Status ResourceMgr::DoLookup(const ContainerShard& shard,
+                                   const string& container,
                                    uint64 type_hash_code,
                                    const string& type_name,
                                    const string& resource_name,
                                    ResourceBase** resource) const {
-  const Container* b = gtl::FindPtrOrNull(containers_, container);
+  const Container* b = gtl::FindPtrOrNull(shard.containers, container);
   if (b == nullptr) {
     return errors::NotFound("Container ", container,
                             " does not exist. (Could not find resource: ",
@@ -268,8 +268,9 @@ absl::Status ResourceMgr::DoLookup(const string& container,
 absl::Status ResourceMgr::PopResourceAndName(
     const string& container, uint64 type_hash_code, const string& resource_name,
     const string& type_name, ResourceAndName& resource_and_name) {
-  mutex_lock l(mu_);
-  Container* b = gtl::FindPtrOrNull(containers_, container);
+  ContainerShard& s = shard(container);
+  mutex_lock l(s.mu);
+  Container* b = gtl::FindPtrOrNull(s.containers, container);
   if (b == nullptr) {
     return errors::NotFound("Container ", container, " does not exist.");
   }
@@ -313,23 +314,24 @@ absl::Status ResourceMgr::Delete(const ResourceHandle& handle) {
 }
 
 absl::Status ResourceMgr::Cleanup(const string& container) {
+  ContainerShard& s = shard(container);
   {
-    tf_shared_lock l(mu_);
-    if (!gtl::FindOrNull(containers_, container)) {
+    tf_shared_lock l(s.mu);
+    if (!gtl::FindOrNull(s.containers, container)) {
       // Nothing to cleanup.
       return absl::OkStatus();
     }
   }
   Container* b = nullptr;
   {
-    mutex_lock l(mu_);
-    auto iter = containers_.find(container);
-    if (iter == containers_.end()) {
+    mutex_lock l(s.mu);
+    auto iter = s.containers.find(container);
+    if (iter == s.containers.end()) {
       // Nothing to cleanup, it's OK (concurrent cleanup).
       return absl::OkStatus();
     }
     b = iter->second;
-    containers_.erase(iter);
+    s.containers.erase(iter);
   }
   CHECK(b != nullptr);
   delete b;
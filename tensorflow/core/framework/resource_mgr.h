@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_RESOURCE_MGR_H_
 #define TENSORFLOW_CORE_FRAMEWORK_RESOURCE_MGR_H_
 
+#include <array>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -198,9 +199,10 @@ class ResourceMgr {
   absl::Status Lookup(const ResourceHandle& handle,
                       ResourceBase** resource) const TF_MUST_USE_RESULT;
 
-  // Similar to Lookup, but looks up multiple resources at once, with only a
-  // single lock acquisition.  If containers_and_names[i] is uninitialized
-  // then this function does not modify resources[i].
+  // Similar to Lookup, but looks up multiple resources at once, acquiring
+  // each container shard's lock at most once per entry.  If
+  // containers_and_names[i] is uninitialized then this function does not
+  // modify resources[i].
   template <typename T, bool use_dynamic_cast = false>
   absl::Status LookupMany(
       absl::Span<std::pair<const string*, const string*> const>
@@ -276,32 +278,46 @@ class ResourceMgr {
   typedef absl::flat_hash_map<Key, ResourceAndName, KeyHash, KeyEqual>
       Container;
 
+  // The container map is split into independently locked shards selected by
+  // the hash of the container name, so that lookups in unrelated containers
+  // never contend on a single manager-wide mutex.
+  static constexpr int kNumShards = 16;
+  struct ContainerShard {
+    mutable mutex mu;
+    absl::flat_hash_map<string, Container*> containers TF_GUARDED_BY(mu);
+  };
+
   const std::string default_container_;
-  mutable mutex mu_;
-  absl::flat_hash_map<string, Container*> containers_ TF_GUARDED_BY(mu_);
+  std::array<ContainerShard, kNumShards> shards_;
+
+  ContainerShard& shard(const std::string& container) {
+    return shards_[Hash64(container.data(), container.size()) % kNumShards];
+  }
+  const ContainerShard& shard(const std::string& container) const {
+    return shards_[Hash64(container.data(), container.size()) % kNumShards];
+  }
 
   template <typename T, bool use_dynamic_cast = false>
-  absl::Status LookupInternal(const std::string& container,
+  absl::Status LookupInternal(const ContainerShard& shard,
+                              const std::string& container,
                               const std::string& name, T** resource) const
-      TF_SHARED_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
-  absl::Status LookupInternal(const std::string& container,
-                              uint64 type_hash_code, const std::string& name,
-                              ResourceBase** resource) const
-      TF_SHARED_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
-
-  absl::Status DoCreate(const std::string& container, TypeIndex type,
-                        const std::string& name, ResourceBase* resource,
-                        bool owns_resource)
-      TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
-
-  absl::Status DoLookup(const std::string& container, TypeIndex type,
+      TF_SHARED_LOCKS_REQUIRED(shard.mu) TF_MUST_USE_RESULT;
+
+  absl::Status DoCreate(ContainerShard& shard, const std::string& container,
+                        TypeIndex type, const std::string& name,
+                        ResourceBase* resource, bool owns_resource)
+      TF_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) TF_MUST_USE_RESULT;
+
+  absl::Status DoLookup(const ContainerShard& shard,
+                        const std::string& container, TypeIndex type,
                         const std::string& name, ResourceBase** resource) const
-      TF_SHARED_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
-  absl::Status DoLookup(const std::string& container, uint64 type_hash_code,
+      TF_SHARED_LOCKS_REQUIRED(shard.mu) TF_MUST_USE_RESULT;
+  absl::Status DoLookup(const ContainerShard& shard,
+                        const std::string& container, uint64 type_hash_code,
                         const std::string& type_name,
                         const std::string& resource_name,
                         ResourceBase** resource) const
-      TF_SHARED_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
+      TF_SHARED_LOCKS_REQUIRED(shard.mu) TF_MUST_USE_RESULT;
 
   absl::Status DoDelete(const std::string& container, uint64 type_hash_code,
                         const std::string& resource_name,
@@ -318,16 +334,18 @@ class ResourceMgr {
   // Inserts the type name for 'hash_code' into the hash_code to type name map.
   absl::Status InsertDebugTypeName(uint64 hash_code,
                                    const std::string& type_name)
-      TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) TF_MUST_USE_RESULT;
+      TF_LOCKS_EXCLUDED(debug_mu_) TF_MUST_USE_RESULT;
 
   // Returns the type name for the 'hash_code'.
   // Returns "<unknown>" if a resource with such a type was never inserted into
   // the container.
   const char* DebugTypeName(uint64 hash_code) const
-      TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+      TF_LOCKS_EXCLUDED(debug_mu_);
 
-  // Map from type hash_code to type name.
-  std::unordered_map<uint64, string> debug_type_names_ TF_GUARDED_BY(mu_);
+  // Map from type hash_code to type name.  Guarded separately from the
+  // container shards since it is shared by all of them.
+  mutable mutex debug_mu_;
+  std::unordered_map<uint64, string> debug_type_names_ TF_GUARDED_BY(debug_mu_);
 
   ResourceMgr(const ResourceMgr&) = delete;
   void operator=(const ResourceMgr&) = delete;
@@ -654,8 +672,9 @@ absl::Status ResourceMgr::Create(const std::string& container,
                                  const std::string& name, T* resource) {
   CheckDeriveFromResourceBase<T>();
   CHECK(resource != nullptr);
-  mutex_lock l(mu_);
-  return DoCreate(container, TypeIndex::Make<T>(), name, resource,
+  ContainerShard& s = shard(container);
+  mutex_lock l(s.mu);
+  return DoCreate(s, container, TypeIndex::Make<T>(), name, resource,
                   /* owns_resource */ true);
 }
 
@@ -663,8 +682,9 @@ template <typename T>
 absl::Status ResourceMgr::CreateUnowned(const std::string& container,
                                         const std::string& name, T* resource) {
   CheckDeriveFromResourceBase<T>();
-  mutex_lock l(mu_);
-  return DoCreate(container, TypeIndex::Make<T>(), name, resource,
+  ContainerShard& s = shard(container);
+  mutex_lock l(s.mu);
+  return DoCreate(s, container, TypeIndex::Make<T>(), name, resource,
                   /* owns_resource */ false);
 }
 
@@ -672,8 +692,9 @@ template <typename T, bool use_dynamic_cast>
 absl::Status ResourceMgr::Lookup(const std::string& container,
                                  const std::string& name, T** resource) const {
   CheckDeriveFromResourceBase<T>();
-  tf_shared_lock l(mu_);
-  return LookupInternal<T, use_dynamic_cast>(container, name, resource);
+  const ContainerShard& s = shard(container);
+  tf_shared_lock l(s.mu);
+  return LookupInternal<T, use_dynamic_cast>(s, container, name, resource);
 }
 
 template <typename T, bool use_dynamic_cast>
@@ -682,14 +703,15 @@ absl::Status ResourceMgr::LookupMany(
         containers_and_names,
     std::vector<core::RefCountPtr<T>>* resources) const {
   CheckDeriveFromResourceBase<T>();
-  tf_shared_lock l(mu_);
   resources->resize(containers_and_names.size());
   for (size_t i = 0; i < containers_and_names.size(); ++i) {
     T* resource;
-    absl::Status s = LookupInternal<T, use_dynamic_cast>(
-        *containers_and_names[i].first, *containers_and_names[i].second,
+    const ContainerShard& s = shard(*containers_and_names[i].first);
+    tf_shared_lock l(s.mu);
+    absl::Status status = LookupInternal<T, use_dynamic_cast>(
+        s, *containers_and_names[i].first, *containers_and_names[i].second,
         &resource);
-    if (s.ok()) {
+    if (status.ok()) {
       (*resources)[i].reset(resource);
     }
   }
@@ -708,11 +730,13 @@ struct TypeCastFunctor<T, true> {
 };
 
 template <typename T, bool use_dynamic_cast>
-absl::Status ResourceMgr::LookupInternal(const std::string& container,
+absl::Status ResourceMgr::LookupInternal(const ContainerShard& shard,
+                                         const std::string& container,
                                          const std::string& name,
                                          T** resource) const {
   ResourceBase* found = nullptr;
-  absl::Status s = DoLookup(container, TypeIndex::Make<T>(), name, &found);
+  absl::Status s =
+      DoLookup(shard, container, TypeIndex::Make<T>(), name, &found);
   if (s.ok()) {
     // It's safe to down cast 'found' to T* since
     // typeid(T).hash_code() is part of the map key.
@@ -728,16 +752,17 @@ absl::Status ResourceMgr::LookupOrCreate(
   CheckDeriveFromResourceBase<T>();
   *resource = nullptr;
   absl::Status s;
+  ContainerShard& sh = shard(container);
   {
-    tf_shared_lock l(mu_);
-    s = LookupInternal<T, use_dynamic_cast>(container, name, resource);
+    tf_shared_lock l(sh.mu);
+    s = LookupInternal<T, use_dynamic_cast>(sh, container, name, resource);
     if (s.ok()) return s;
   }
-  mutex_lock l(mu_);
-  s = LookupInternal<T, use_dynamic_cast>(container, name, resource);
+  mutex_lock l(sh.mu);
+  s = LookupInternal<T, use_dynamic_cast>(sh, container, name, resource);
   if (s.ok()) return s;
   TF_RETURN_IF_ERROR(creator(resource));
-  s = DoCreate(container, TypeIndex::Make<T>(), name, *resource,
+  s = DoCreate(sh, container, TypeIndex::Make<T>(), name, *resource,
                /* owns_resource */ true);
   if (!s.ok()) {
     return errors::Internal("LookupOrCreate failed unexpectedly");
@@ -59,6 +59,18 @@ namespace tensorflow {
 // shared mutex prevents them from overlapping with dense writes, which is
 // necessary as dense writes can change the shape the of the tensor.
 //
+// A consequence of copy-on-write mode worth calling out for serving: assigning
+// a variable is an atomic snapshot publish. The assign aliases the new value's
+// buffer into the variable under the exclusive lock, while steps that already
+// read the variable keep their reference on the previous buffer and continue
+// computing against it until they finish; the old buffer is freed when the
+// last such alias drops. Weights can therefore be hot-swapped in a live
+// process by running the assign ops, with peak memory exceeding steady state
+// only by the buffers still pinned by in-flight steps. Note the swap is atomic
+// per variable: a step that starts while a multi-variable refresh is underway
+// may observe a mix of old and new values unless the assigns and the step are
+// ordered against each other.
+//
 // Transitioning a variable from copy-on-read mode to copy-on-write mode is
 // currently not supported. To upgrade a variable from copy-on-write to
 // copy-on-read use `EnsureSparseVariableAccess()`, and then grab the variable's
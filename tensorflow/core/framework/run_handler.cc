@@ -325,6 +325,8 @@ RunHandlerThreadPool::RunHandlerThreadPool(
       queue_waiters_(queue_waiters),
       use_sub_thread_pool_(ParamFromEnvBoolWithDefault(
           "TF_RUN_HANDLER_USE_SUB_THREAD_POOL", false)),
+      non_blocking_threads_steal_blocking_work_(ParamFromEnvBoolWithDefault(
+          "TF_RUN_HANDLER_NON_BLOCKING_THREADS_STEAL_BLOCKING_WORK", false)),
       num_threads_in_sub_thread_pool_(ParamFromEnvWithDefault(
           "TF_RUN_HANDLER_NUM_THREADS_IN_SUB_THREAD_POOL",
           std::vector<int>({num_blocking_threads / 2,
@@ -473,6 +475,16 @@ int RunHandlerThreadPool::NumNonBlockingThreads() const {
   return num_non_blocking_threads_;
 }
 
+bool RunHandlerThreadPool::NonBlockingThreadCanStealBlockingWork(
+    int thread_id) {
+  if (!non_blocking_threads_steal_blocking_work_) return false;
+  // Keep every other non-blocking thread, including the first, dedicated to
+  // intra-op work.  Blocking tasks may stall waiting for intra-op tasks to
+  // finish, so some threads must never pick them up or intra-op progress
+  // could not be guaranteed.
+  return (thread_id - num_blocking_threads_) % 2 == 1;
+}
+
 RunHandlerThreadPool::ThreadData::ThreadData()
     : new_version(0),
       current_index(0),
@@ -622,6 +634,16 @@ void RunHandlerThreadPool::WorkerLoop(int thread_id,
         }
       }
     }
+    if (!t.f && !may_steal_blocking_work &&
+        NonBlockingThreadCanStealBlockingWork(thread_id)) {
+      // This non-blocking thread found all intra-op queues empty.  Rather
+      // than sleeping while inter-op work is queued, take a blocking task.
+      t = FindTask(0, thread_work_sources->size(), thread_id,
+                   thread_data_[thread_id].sub_thread_pool_id,
+                   kMaxBlockingInflight,
+                   /*may_steal_blocking_work=*/true, *thread_work_sources,
+                   &task_from_blocking_queue, &tws);
+    }
     if (t.f) {
       tsl::profiler::TraceMe activity(
           [=] {
@@ -269,6 +269,11 @@ class RunHandlerThreadPool {
 
   void WaitForWorkInSubThreadPool(bool is_blocking, int sub_thread_pool_id);
 
+  // Returns true if the non-blocking thread 'thread_id' may execute blocking
+  // (inter-op) work when its intra-op queues are empty. Always false unless
+  // enabled via TF_RUN_HANDLER_NON_BLOCKING_THREADS_STEAL_BLOCKING_WORK.
+  bool NonBlockingThreadCanStealBlockingWork(int thread_id);
+
  private:
   struct ThreadData {
     ThreadData();
@@ -299,6 +304,9 @@ class RunHandlerThreadPool {
   Eigen::MaxSizeVector<Waiter>* queue_waiters_;
 
   bool use_sub_thread_pool_;
+  // Whether idle non-blocking threads may take blocking work; see
+  // NonBlockingThreadCanStealBlockingWork().
+  bool non_blocking_threads_steal_blocking_work_;
   std::vector<int> num_threads_in_sub_thread_pool_;
 
   // Threads in each sub thread pool will search tasks from the given
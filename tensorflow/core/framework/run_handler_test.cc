@@ -32,6 +32,7 @@ limitations under the License.
 #include "tensorflow/core/platform/blocking_counter.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/notification.h"
 #include "tensorflow/core/platform/test.h"
 #include "tensorflow/core/public/session.h"
 #include "tensorflow/core/public/session_options.h"
@@ -583,6 +584,42 @@ TEST(RunHandlerThreadPool, MultipleSubThreadPool) {
   delete run_handler_thread_pool;
 }
 
+TEST(RunHandlerThreadPool, NonBlockingThreadsStealBlockingWork) {
+  setenv("TF_RUN_HANDLER_USE_SUB_THREAD_POOL", "false", true);
+  setenv("TF_RUN_HANDLER_NON_BLOCKING_THREADS_STEAL_BLOCKING_WORK", "true",
+         true);
+
+  Eigen::MaxSizeVector<mutex> waiters_mu(1);
+  waiters_mu.resize(1);
+  Eigen::MaxSizeVector<internal::Waiter> waiters(1);
+  waiters.resize(1);
+  internal::RunHandlerThreadPool* run_handler_thread_pool =
+      new internal::RunHandlerThreadPool(
+          /*num_blocking_threads=*/0, /*num_non_blocking_threads=*/2,
+          Env::Default(), ThreadOptions(), "tf_run_handler_pool", &waiters_mu,
+          &waiters);
+  Eigen::MaxSizeVector<internal::ThreadWorkSource*> thread_work_sources(1);
+  thread_work_sources.resize(1);
+  internal::ThreadWorkSource tws;
+  tws.SetWaiter(1, &waiters[0], &waiters_mu[0]);
+  thread_work_sources[0] = &tws;
+
+  // With no blocking threads in the pool, this task can only run if one of
+  // the idle non-blocking threads picks it up.
+  Notification done;
+  run_handler_thread_pool->AddWorkToQueue(&tws, /*is_blocking=*/true,
+                                          [&done] { done.Notify(); });
+  run_handler_thread_pool->Start();
+  run_handler_thread_pool->SetThreadWorkSources(
+      /*tid=*/0, /*start_request_idx=*/0, /*version=*/1, thread_work_sources);
+  run_handler_thread_pool->SetThreadWorkSources(
+      /*tid=*/1, /*start_request_idx=*/0, /*version=*/1, thread_work_sources);
+  done.WaitForNotification();
+
+  delete run_handler_thread_pool;
+  unsetenv("TF_RUN_HANDLER_NON_BLOCKING_THREADS_STEAL_BLOCKING_WORK");
+}
+
 SessionOptions DefaultSessionOptions() {
   SessionOptions options;
   (*options.config.mutable_device_count())["CPU"] = 2;
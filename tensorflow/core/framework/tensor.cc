@@ -30,8 +30,10 @@ limitations under the License.
 #include "tensorflow/core/framework/tensor.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <new>
 #include <memory>
 #include <ostream>
 #include <type_traits>
@@ -66,6 +68,7 @@ limitations under the License.
 #include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/core/platform/tensor_coding.h"
 #include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 
@@ -91,12 +94,100 @@ bool TensorBuffer::GetAllocatedBytes(size_t* out_bytes) const {
 
 namespace {
 
+// A per-thread freelist for Buffer<T> control blocks.
+//
+// Every Tensor construction heap-allocates one small, fixed-size control
+// block in front of the payload allocation; on allocation-heavy workloads
+// these control blocks account for a noticeable fraction of malloc traffic.
+// All Buffer<T> instantiations share the same layout, so a block freed by
+// one element type can be reused by any other. Blocks are recycled through
+// a thread-local freelist (a block freed on one thread lands on that
+// thread's list), capped at kMaxPooledBlocks to bound idle memory. Set
+// TF_TENSOR_BUFFER_POOL=false to fall back to plain operator new/delete.
+
+// All pooled blocks are allocated at this size so that any Buffer<T> fits.
+constexpr size_t kPooledBlockBytes = 64;
+constexpr int kMaxPooledBlocks = 512;
+
+bool BufferPoolEnabled() {
+  static const bool enabled = [] {
+    bool value = true;
+    absl::Status status =
+        ReadBoolFromEnvVar("TF_TENSOR_BUFFER_POOL", true, &value);
+    if (!status.ok()) {
+      LOG(ERROR) << status.message();
+    }
+    return value;
+  }();
+  return enabled;
+}
+
+struct BufferBlockFreeList {
+  struct Node {
+    Node* next;
+  };
+
+  Node* head = nullptr;
+  int size = 0;
+
+  ~BufferBlockFreeList() {
+    while (head != nullptr) {
+      Node* node = head;
+      head = node->next;
+      ::operator delete(node);
+    }
+  }
+};
+
+BufferBlockFreeList& ThisThreadFreeList() {
+  static thread_local BufferBlockFreeList free_list;
+  return free_list;
+}
+
+void* AllocateBufferBlock(size_t size) {
+  if (size > kPooledBlockBytes || !BufferPoolEnabled()) {
+    return ::operator new(size);
+  }
+  BufferBlockFreeList& free_list = ThisThreadFreeList();
+  if (free_list.head != nullptr) {
+    BufferBlockFreeList::Node* node = free_list.head;
+    free_list.head = node->next;
+    --free_list.size;
+    return node;
+  }
+  return ::operator new(kPooledBlockBytes);
+}
+
+void DeallocateBufferBlock(void* ptr, size_t size) {
+  if (size > kPooledBlockBytes || !BufferPoolEnabled()) {
+    ::operator delete(ptr);
+    return;
+  }
+  BufferBlockFreeList& free_list = ThisThreadFreeList();
+  if (free_list.size >= kMaxPooledBlocks) {
+    ::operator delete(ptr);
+    return;
+  }
+  auto* node = static_cast<BufferBlockFreeList::Node*>(ptr);
+  node->next = free_list.head;
+  free_list.head = node;
+  ++free_list.size;
+}
+
 // An un-templated base class for Buffer.
 class BufferBase : public TensorBuffer {
  public:
   explicit BufferBase(Allocator* alloc, void* data_ptr)
       : TensorBuffer(data_ptr), alloc_(alloc) {}
 
+  // Control blocks are recycled through the per-thread freelist above. The
+  // sized delete receives the most-derived size, which matches the size
+  // passed to the corresponding operator new.
+  static void* operator new(size_t size) { return AllocateBufferBlock(size); }
+  static void operator delete(void* ptr, size_t size) {
+    DeallocateBufferBlock(ptr, size);
+  }
+
   TensorBuffer* root_buffer() override { return this; }
 
   bool GetAllocatedBytes(size_t* out_bytes) const override {
@@ -153,6 +244,10 @@ class Buffer : public BufferBase {
  private:
   int64_t elem_;
 
+  // Keeps every instantiation eligible for the control-block freelist.
+  static_assert(sizeof(BufferBase) + sizeof(int64_t) <= kPooledBlockBytes,
+                "Buffer<T> control blocks must fit in a pooled block");
+
   ~Buffer() override;
 
   Buffer(const Buffer&) = delete;
@@ -977,6 +1072,19 @@ Tensor::Tensor(Allocator* a, DataType type, const TensorShape& shape)
   }
 }
 
+Tensor::Tensor(Allocator* a, DataType type, TensorShape&& shape)
+    : shape_(std::move(shape)), buf_(nullptr) {
+  set_dtype(type);
+  CHECK_NOTNULL(a);
+  if (shape_.num_elements() > 0 || a->AllocatesOpaqueHandle()) {
+    CASES(type, buf_ = new Buffer<T>(a, shape_.num_elements()));
+  }
+  if (MemoryLoggingEnabled() && buf_ != nullptr && buf_->data() != nullptr) {
+    LogMemory::RecordTensorAllocation("Unknown", LogMemory::UNKNOWN_STEP_ID,
+                                      *this);
+  }
+}
+
 Tensor::Tensor(Allocator* a, DataType type, const TensorShape& shape,
                const AllocationAttributes& allocation_attr)
     : shape_(shape), buf_(nullptr) {
@@ -1019,6 +1127,9 @@ static Allocator* get_default_cpu_allocator() {
 Tensor::Tensor(DataType type, const TensorShape& shape)
     : Tensor(get_default_cpu_allocator(), type, shape) {}
 
+Tensor::Tensor(DataType type, TensorShape&& shape)
+    : Tensor(get_default_cpu_allocator(), type, std::move(shape)) {}
+
 bool Tensor::HostScalarTensorBufferBase::GetAllocatedBytes(
     size_t* out_bytes) const {
   // `this->FillAllocationDescription()` never sets allocated bytes information,
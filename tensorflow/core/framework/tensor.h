@@ -139,6 +139,11 @@ class Tensor {
   /// The underlying buffer is allocated using a `CPUAllocator`.
   Tensor(DataType type, const TensorShape& shape);
 
+  /// \brief Like `Tensor(type, shape)`, but takes ownership of `shape`
+  /// instead of copying it. Prefer this overload when the caller's shape is
+  /// an rvalue; it avoids a copy of any out-of-line dimension storage.
+  Tensor(DataType type, TensorShape&& shape);
+
   /// \brief Creates a tensor with the input `type` and `shape`, using
   /// the allocator `a` to allocate the underlying buffer. If
   /// LogMemory::IsEnabled() the allocation is logged as coming from
@@ -150,6 +155,12 @@ class Tensor {
   /// `a` must outlive the lifetime of this Tensor.
   Tensor(Allocator* a, DataType type, const TensorShape& shape);
 
+  /// \brief Like `Tensor(a, type, shape)`, but takes ownership of `shape`
+  /// instead of copying it.
+  ///
+  /// `a` must outlive the lifetime of this Tensor.
+  Tensor(Allocator* a, DataType type, TensorShape&& shape);
+
   /// \brief Creates a tensor with the input `type` and `shape`, using
   /// the allocator `a` and the specified "allocation_attr" to
   /// allocate the underlying buffer. If the kernel and step are known
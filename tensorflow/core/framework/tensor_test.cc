@@ -92,6 +92,20 @@ TEST(TensorTest, Default) {
   EXPECT_EQ(t.NumElements(), 0);
 }
 
+TEST(TensorTest, MoveShapeConstructor) {
+  TensorShape shape({2, 3});
+  Tensor t(DT_FLOAT, std::move(shape));
+  EXPECT_EQ(t.dtype(), DT_FLOAT);
+  EXPECT_EQ(t.dims(), 2);
+  EXPECT_EQ(t.NumElements(), 6);
+  EXPECT_TRUE(t.IsInitialized());
+
+  // Deep shapes keep their out-of-line dimension storage.
+  Tensor deep(DT_INT32, TensorShape({1, 1, 1, 1, 1, 1, 2}));
+  EXPECT_EQ(deep.dims(), 7);
+  EXPECT_EQ(deep.NumElements(), 2);
+}
+
 TEST(TensorTest, DataType_Traits) {
   EXPECT_TRUE(std::is_trivial<float>::value);
   EXPECT_TRUE(std::is_trivial<double>::value);
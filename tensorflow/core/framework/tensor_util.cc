@@ -18,10 +18,12 @@ limitations under the License.
 #include <cmath>
 #include <vector>
 
+#include "tensorflow/core/framework/allocation_description.pb.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor_shape.h"
 #include "tensorflow/core/framework/type_traits.h"
 #include "tensorflow/core/framework/variant.h"
+#include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
 #include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/core/platform/tensor_coding.h"
@@ -56,6 +58,53 @@ void DeepCopy(const Tensor& input, Tensor* output) {
   }
 }
 
+namespace {
+
+// A TensorBuffer that aliases caller-owned memory and never frees it.
+class BorrowedBuffer : public TensorBuffer {
+ public:
+  BorrowedBuffer(void* data, size_t size) : TensorBuffer(data), size_(size) {}
+
+  size_t size() const override { return size_; }
+  TensorBuffer* root_buffer() override { return this; }
+  bool OwnsMemory() const override { return false; }
+  void FillAllocationDescription(AllocationDescription* proto) const override {
+    proto->set_requested_bytes(size_);
+    proto->set_allocator_name("borrowed");
+  }
+
+ private:
+  ~BorrowedBuffer() override = default;
+
+  const size_t size_;
+};
+
+}  // namespace
+
+absl::Status MakeTensorFromBorrowedBuffer(DataType dtype,
+                                          const TensorShape& shape, void* data,
+                                          Tensor* out) {
+  if (!DataTypeCanUseMemcpy(dtype)) {
+    return errors::InvalidArgument("Cannot borrow a buffer for dtype ",
+                                   DataTypeString(dtype),
+                                   ": only memcpy-able types are supported");
+  }
+  if (data == nullptr && shape.num_elements() > 0) {
+    return errors::InvalidArgument(
+        "Cannot borrow a null buffer for a non-empty tensor");
+  }
+  if (EIGEN_MAX_ALIGN_BYTES > 0 &&
+      reinterpret_cast<uintptr_t>(data) % EIGEN_MAX_ALIGN_BYTES != 0) {
+    return errors::InvalidArgument("Borrowed buffer must be aligned to ",
+                                   EIGEN_MAX_ALIGN_BYTES, " bytes");
+  }
+  const size_t size = shape.num_elements() * DataTypeSize(dtype);
+  TensorBuffer* buf = new BorrowedBuffer(data, size);
+  *out = Tensor(dtype, shape, buf);
+  buf->Unref();
+  return absl::OkStatus();
+}
+
 absl::Status Concat(const absl::Span<const Tensor> tensors, Tensor* result) {
   if (tensors.empty()) {
     return errors::InvalidArgument("Cannot concatenate zero tensors");
@@ -42,6 +42,19 @@ Tensor DeepCopy(const Tensor& other);
 // that the memory for the output has already been allocated.
 void DeepCopy(const Tensor& input, Tensor* output);
 
+// Creates a tensor in '*out' that aliases the caller-owned buffer 'data'
+// instead of copying it, attaching a no-op deallocator. Intended for
+// zero-copy feeding of large inputs through Session::Run: the caller must
+// keep 'data' alive and unmodified until every step consuming the tensor has
+// completed.
+//
+// REQUIRES: 'dtype' must be a simple POD type (no string/variant/resource).
+// REQUIRES: 'data' must be aligned to EIGEN_MAX_ALIGN_BYTES and hold
+//           'shape.num_elements()' elements of type 'dtype'.
+absl::Status MakeTensorFromBorrowedBuffer(DataType dtype,
+                                          const TensorShape& shape, void* data,
+                                          Tensor* out) TF_MUST_USE_RESULT;
+
 // Concatenates 'tensors' into a single tensor, along their 0th dimension.
 //
 // REQUIRES: All members of 'tensors' must have the same data type parameter.
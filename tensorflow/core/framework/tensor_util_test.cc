@@ -74,6 +74,29 @@ TEST(TensorUtil, DeepCopyZeroElements) {
   EXPECT_EQ(0, y.NumElements());
 }
 
+TEST(TensorUtil, MakeTensorFromBorrowedBuffer) {
+  alignas(EIGEN_MAX_ALIGN_BYTES) float data[4] = {1.0, 2.0, 3.0, 4.0};
+  Tensor t;
+  TF_ASSERT_OK(tensor::MakeTensorFromBorrowedBuffer(
+      DT_FLOAT, TensorShape({2, 2}), data, &t));
+
+  // The tensor aliases the caller's buffer rather than copying it.
+  EXPECT_EQ(static_cast<void*>(data), t.data());
+  EXPECT_EQ(2.0, t.matrix<float>()(0, 1));
+
+  // Writes through the tensor are visible in the caller's buffer.
+  t.matrix<float>()(1, 1) = 42.0;
+  EXPECT_EQ(42.0, data[3]);
+}
+
+TEST(TensorUtil, MakeTensorFromBorrowedBufferRejectsStrings) {
+  alignas(EIGEN_MAX_ALIGN_BYTES) char data[64];
+  Tensor t;
+  EXPECT_FALSE(tensor::MakeTensorFromBorrowedBuffer(DT_STRING,
+                                                    TensorShape({1}), data, &t)
+                   .ok());
+}
+
 TEST(TensorUtil, DeepCopy) {
   Tensor x(DT_FLOAT, TensorShape({1}));
   x.flat<float>()(0) = 10.0;
@@ -502,6 +502,11 @@ void Graph::Clear() {
   }
 }
 
+void Graph::ReserveNodesAndEdges(int64_t num_nodes, int64_t num_edges) {
+  nodes_.reserve(nodes_.size() + num_nodes);
+  edges_.reserve(edges_.size() + num_edges);
+}
+
 const VersionDef& Graph::versions() const { return *versions_; }
 void Graph::set_versions(const VersionDef& versions) { *versions_ = versions; }
 
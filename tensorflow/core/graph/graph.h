@@ -582,6 +582,13 @@ class Graph {
   // No Node* references to the Graph are valid post.
   void Clear();
 
+  // Pre-sizes the internal node and edge tables for a graph that is about to
+  // grow by approximately `num_nodes` nodes and `num_edges` edges, e.g. from
+  // a bulk import of a large GraphDef, so the tables are not repeatedly
+  // reallocated while the graph is built up. The nodes and edges themselves
+  // remain arena-allocated as usual.
+  void ReserveNodesAndEdges(int64_t num_nodes, int64_t num_edges);
+
   // Adds an edge that connects the xth output of `source` to the yth input of
   // `dest` and returns it. Does not update dest's NodeDef.
   const Edge* AddEdge(Node* source, int x, Node* dest, int y);
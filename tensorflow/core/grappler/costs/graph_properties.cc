@@ -37,7 +37,11 @@ limitations under the License.
 #include "tensorflow/core/grappler/utils/topological_sort.h"
 #include "tensorflow/core/lib/gtl/cleanup.h"
 #include "tensorflow/core/lib/gtl/flatset.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
 #include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 namespace grappler {
@@ -59,6 +63,44 @@ const int64_t kUnknownDimFromConst = INT64_MAX;
 // is greater than this threshold.
 const int kThresholdToSkipConstTensorInstantiation = 128;
 
+// Process-wide cache of statically inferred properties, keyed by a fingerprint
+// of the graph, the feed names and the inference flags. Several optimizers
+// within one meta-optimizer invocation run full static shape inference over
+// the same graph; with the cache enabled the later passes reuse the earlier
+// result instead of re-inferring from scratch.
+struct InferredPropertiesCacheEntry {
+  absl::flat_hash_map<string, std::vector<OpInfo::TensorProperties>>
+      input_properties;
+  absl::flat_hash_map<string, std::vector<OpInfo::TensorProperties>>
+      output_properties;
+  std::unordered_set<string> incompatible_shape_nodes;
+  int64_t bytes = 0;
+};
+
+struct InferredPropertiesCache {
+  mutex mu;
+  absl::flat_hash_map<uint64, InferredPropertiesCacheEntry> entries
+      TF_GUARDED_BY(mu);
+  int64_t cache_bytes TF_GUARDED_BY(mu) = 0;
+};
+
+InferredPropertiesCache* GlobalInferredPropertiesCache() {
+  static InferredPropertiesCache* cache = new InferredPropertiesCache;
+  return cache;
+}
+
+// Upper bound in bytes on the inferred properties cache; 0 (the default)
+// disables caching.
+int64_t InferredPropertiesCacheBytes() {
+  static const int64_t cache_bytes = [] {
+    int64_t bytes;
+    TF_CHECK_OK(ReadInt64FromEnvVar("TF_GRAPPLER_GRAPH_PROPERTIES_CACHE_BYTES",
+                                    /*default_val=*/0, &bytes));
+    return bytes;
+  }();
+  return cache_bytes;
+}
+
 template <typename Handle>
 struct HashHandle {
   std::size_t operator()(const Handle& h) const {
@@ -2519,6 +2561,33 @@ absl::Status GraphProperties::UpdateEnqueue(
 absl::Status GraphProperties::InferStatically(
     bool assume_valid_feeds, bool aggressive_shape_inference,
     bool include_input_tensor_values, bool include_output_tensor_values) {
+  const int64_t properties_cache_bytes = InferredPropertiesCacheBytes();
+  uint64 properties_cache_key = 0;
+  if (properties_cache_bytes > 0) {
+    // Static inference reads the feed names (to mark fed ports) but never the
+    // feed values, so the key only needs to cover the names.
+    properties_cache_key = DeterministicProtoHash64(item_.graph);
+    for (const auto& feed : item_.feed) {
+      properties_cache_key =
+          FingerprintCat64(properties_cache_key, Fingerprint64(feed.first));
+    }
+    properties_cache_key = FingerprintCat64(
+        properties_cache_key,
+        (assume_valid_feeds ? 1 : 0) | (aggressive_shape_inference ? 2 : 0) |
+            (include_input_tensor_values ? 4 : 0) |
+            (include_output_tensor_values ? 8 : 0));
+    InferredPropertiesCache* cache = GlobalInferredPropertiesCache();
+    mutex_lock l(cache->mu);
+    auto it = cache->entries.find(properties_cache_key);
+    if (it != cache->entries.end()) {
+      VLOG(1) << "Reusing cached inferred properties for item: " << item_.id;
+      input_properties_ = it->second.input_properties;
+      output_properties_ = it->second.output_properties;
+      incompatible_shape_nodes_ = it->second.incompatible_shape_nodes;
+      return absl::OkStatus();
+    }
+  }
+
   FunctionLibraryDefinition function_library(OpRegistry::Global(),
                                              item_.graph.library());
   absl::flat_hash_map<string, absl::flat_hash_set<int>> fed_ports;
@@ -2758,6 +2827,29 @@ absl::Status GraphProperties::InferStatically(
   TF_RETURN_IF_ERROR(VerboseShapeInferenceLogging(item_.graph, refiner.get(),
                                                   shape_manager.get()));
 
+  if (properties_cache_bytes > 0) {
+    InferredPropertiesCacheEntry entry;
+    entry.input_properties = input_properties_;
+    entry.output_properties = output_properties_;
+    entry.incompatible_shape_nodes = incompatible_shape_nodes_;
+    for (const auto* properties :
+         {&entry.input_properties, &entry.output_properties}) {
+      for (const auto& node_properties : *properties) {
+        entry.bytes += node_properties.first.size();
+        for (const auto& tensor_properties : node_properties.second) {
+          entry.bytes += tensor_properties.ByteSizeLong();
+        }
+      }
+    }
+    const int64_t entry_bytes = entry.bytes;
+    InferredPropertiesCache* cache = GlobalInferredPropertiesCache();
+    mutex_lock l(cache->mu);
+    if (cache->cache_bytes + entry_bytes <= properties_cache_bytes &&
+        cache->entries.emplace(properties_cache_key, std::move(entry)).second) {
+      cache->cache_bytes += entry_bytes;
+    }
+  }
+
   return absl::OkStatus();
 }
 
@@ -19,6 +19,9 @@ limitations under the License.
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <optional>
 #include <string>
@@ -32,6 +35,7 @@ limitations under the License.
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
 #include "Eigen/Core"  // from @eigen_archive
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/framework/attr_value.pb.h"
@@ -45,6 +49,8 @@ limitations under the License.
 #include "tensorflow/core/grappler/costs/op_context.h"
 #include "tensorflow/core/grappler/costs/op_performance_data.pb.h"
 #include "tensorflow/core/grappler/costs/utils.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/protobuf/device_properties.pb.h"
@@ -339,6 +345,93 @@ bool IsEinsumCorrectlyFormed(const OpContext& einsum_context) {
   return true;
 }
 
+// Measured per-host CPU performance parameters, overriding the
+// specification-derived defaults in GetDeviceInfo. Negative fields mean "not
+// calibrated".
+struct HostCalibration {
+  double gflops = -1;
+  double gb_per_sec = -1;
+};
+
+// Streams a buffer large enough to defeat caches through memcpy and returns
+// the measured bandwidth in GB/s, counting both read and write traffic.
+double MeasureMemcpyGBPerSec() {
+  constexpr size_t kBytes = 64 << 20;
+  std::vector<char> src(kBytes, 1);
+  std::vector<char> dst(kBytes);
+  // Warm up page tables before timing.
+  memcpy(dst.data(), src.data(), kBytes);
+  constexpr int kIters = 4;
+  const uint64 start_nanos = Env::Default()->NowNanos();
+  for (int i = 0; i < kIters; ++i) {
+    memcpy(dst.data(), src.data(), kBytes);
+  }
+  const uint64 elapsed_nanos = Env::Default()->NowNanos() - start_nanos;
+  if (elapsed_nanos == 0 || dst[kBytes / 2] != 1) return -1;
+  // memcpy moves every byte twice (one read, one write); bytes per nanosecond
+  // equals GB/s.
+  return 2.0 * kIters * kBytes / elapsed_nanos;
+}
+
+// Times a multiply-add loop with independent accumulators and returns the
+// measured single-core GFLOP/s.
+double MeasureSingleCoreGflops() {
+  constexpr int kAccumulators = 8;
+  constexpr int kIters = 1 << 22;
+  double acc[kAccumulators];
+  for (int j = 0; j < kAccumulators; ++j) acc[j] = 1.0 + 1e-3 * j;
+  const double scale = 1.0000001;
+  const double bias = 1e-9;
+  const uint64 start_nanos = Env::Default()->NowNanos();
+  for (int i = 0; i < kIters; ++i) {
+    for (int j = 0; j < kAccumulators; ++j) {
+      acc[j] = acc[j] * scale + bias;
+    }
+  }
+  const uint64 elapsed_nanos = Env::Default()->NowNanos() - start_nanos;
+  double sum = 0;
+  for (int j = 0; j < kAccumulators; ++j) sum += acc[j];
+  if (elapsed_nanos == 0 || sum <= 0) return -1;
+  // Two flops (multiply and add) per accumulator per iteration; flops per
+  // nanosecond equals GFLOP/s.
+  return 2.0 * kAccumulators * static_cast<double>(kIters) / elapsed_nanos;
+}
+
+// Returns the per-host calibration, computed at most once per process.
+//
+// Calibration is opt-in through TF_OP_COST_CALIBRATION: "file:<path>" loads
+// parameters measured at install time (two whitespace-separated numbers,
+// GFLOP/s and GB/s), any other non-empty value runs the microbenchmarks above
+// at first use. Unset leaves the specification-derived defaults untouched.
+const HostCalibration& GetHostCalibration() {
+  static const HostCalibration* const calibration = []() -> HostCalibration* {
+    auto* result = new HostCalibration();
+    const char* setting = std::getenv("TF_OP_COST_CALIBRATION");
+    if (setting == nullptr || *setting == '\0') return result;
+    absl::string_view value(setting);
+    if (absl::ConsumePrefix(&value, "file:")) {
+      string contents;
+      const absl::Status s =
+          ReadFileToString(Env::Default(), string(value), &contents);
+      if (!s.ok() || sscanf(contents.c_str(), "%lf %lf", &result->gflops,
+                            &result->gb_per_sec) != 2) {
+        LOG(WARNING) << "Ignoring op cost calibration file '" << value
+                     << "': " << (s.ok() ? "unparseable contents" : s.message());
+        result->gflops = -1;
+        result->gb_per_sec = -1;
+      }
+      return result;
+    }
+    result->gb_per_sec = MeasureMemcpyGBPerSec();
+    result->gflops =
+        MeasureSingleCoreGflops() * port::NumSchedulableCPUs();
+    LOG(INFO) << "Measured op cost calibration: " << result->gflops
+              << " GFLOP/s, " << result->gb_per_sec << " GB/s";
+    return result;
+  }();
+  return *calibration;
+}
+
 }  // namespace
 
 // Return a minimum shape if the shape is unknown. If known, return the original
@@ -735,10 +828,18 @@ DeviceInfo OpLevelCostEstimator::GetDeviceInfo(
   double gb_per_sec = -1;
 
   if (device.type() == "CPU") {
-    // Check if vector instructions are available, and refine performance
-    // prediction based on this.
-    // Frequencies are stored in MHz in the DeviceProperties.
-    gflops = device.num_cores() * device.frequency() * 1e-3;
+    // Prefer measured per-host parameters when calibration is enabled; the
+    // specification-derived defaults below can mispredict considerably across
+    // heterogeneous fleets.
+    const HostCalibration& calibration = GetHostCalibration();
+    gflops = calibration.gflops;
+    gb_per_sec = calibration.gb_per_sec;
+    if (gflops <= 0) {
+      // Check if vector instructions are available, and refine performance
+      // prediction based on this.
+      // Frequencies are stored in MHz in the DeviceProperties.
+      gflops = device.num_cores() * device.frequency() * 1e-3;
+    }
     if (gflops <= 0) {
       LOG_EVERY_N(WARNING, 1000) << "Invalid device specifications for CPU: "
                                  << device.ShortDebugString();
@@ -0,0 +1,134 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/grappler/costs/what_if_simulator.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "tensorflow/core/framework/attr_value.pb.h"
+#include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/framework/tensor_shape.pb.h"
+#include "tensorflow/core/grappler/clusters/virtual_cluster.h"
+#include "tensorflow/core/grappler/costs/analytical_cost_estimator.h"
+#include "tensorflow/core/grappler/costs/virtual_scheduler.h"
+#include "tensorflow/core/grappler/grappler_item.h"
+#include "tensorflow/core/grappler/utils.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/protobuf/config.pb.h"
+
+namespace tensorflow {
+namespace grappler {
+namespace {
+
+// Returns the names of nodes without data consumers; these act as the step's
+// fetches when the caller does not name any.
+std::vector<std::string> TerminalNodes(const GraphDef& graph) {
+  absl::flat_hash_set<std::string> consumed;
+  for (const NodeDef& node : graph.node()) {
+    for (const std::string& input : node.input()) {
+      consumed.insert(NodeName(input));
+    }
+  }
+  std::vector<std::string> terminals;
+  for (const NodeDef& node : graph.node()) {
+    if (!consumed.contains(node.name())) {
+      terminals.push_back(node.name());
+    }
+  }
+  return terminals;
+}
+
+// Replaces unknown leading Placeholder dimensions with `batch_size`.
+void ApplyBatchSize(int batch_size, GraphDef* graph) {
+  for (NodeDef& node : *graph->mutable_node()) {
+    if (node.op() != "Placeholder" && node.op() != "PlaceholderV2") {
+      continue;
+    }
+    auto it = node.mutable_attr()->find("shape");
+    if (it == node.mutable_attr()->end()) {
+      continue;
+    }
+    TensorShapeProto* shape = it->second.mutable_shape();
+    if (shape->dim_size() > 0 && shape->dim(0).size() == -1) {
+      shape->mutable_dim(0)->set_size(batch_size);
+    }
+  }
+}
+
+}  // namespace
+
+absl::Status SimulateWhatIf(
+    const GraphDef& graph,
+    const std::unordered_map<std::string, DeviceProperties>& devices,
+    const WhatIfSimulationOptions& options, WhatIfReport* report) {
+  if (report == nullptr) {
+    return errors::InvalidArgument("report must not be null");
+  }
+  if (devices.empty()) {
+    return errors::InvalidArgument("At least one device is required");
+  }
+
+  GrapplerItem item;
+  item.id = "what_if_simulation";
+  item.graph = graph;
+  if (options.batch_size > 0) {
+    ApplyBatchSize(options.batch_size, &item.graph);
+  }
+  item.fetch =
+      options.fetch.empty() ? TerminalNodes(item.graph) : options.fetch;
+  if (item.fetch.empty()) {
+    return errors::InvalidArgument("Graph has no nodes to fetch");
+  }
+
+  VirtualCluster cluster(devices);
+  AnalyticalCostEstimator estimator(&cluster, options.use_static_shapes,
+                                    options.use_aggressive_shape_inference);
+  TF_RETURN_IF_ERROR(estimator.Initialize(item));
+
+  RunMetadata run_metadata;
+  Costs costs;
+  TF_RETURN_IF_ERROR(estimator.PredictCosts(item.graph, &run_metadata, &costs));
+
+  report->step_time = costs.execution_time;
+  report->per_device.clear();
+  const auto* device_states = estimator.GetScheduler()->GetDeviceStates();
+  report->per_device.reserve(device_states->size());
+  for (const auto& entry : *device_states) {
+    const DeviceState& state = entry.second;
+    WhatIfDeviceReport device_report;
+    device_report.device = entry.first;
+    device_report.busy_time = state.GetCurrTime();
+    device_report.utilization =
+        report->step_time.count() > 0
+            ? static_cast<double>(device_report.busy_time.count()) /
+                  report->step_time.count()
+            : 0.0;
+    device_report.peak_memory_bytes = state.max_memory_usage;
+    device_report.num_ops = state.device_costs.num_ops_total;
+    report->per_device.push_back(std::move(device_report));
+  }
+  std::sort(report->per_device.begin(), report->per_device.end(),
+            [](const WhatIfDeviceReport& a, const WhatIfDeviceReport& b) {
+              return a.device < b.device;
+            });
+  return absl::OkStatus();
+}
+
+}  // end namespace grappler
+}  // end namespace tensorflow
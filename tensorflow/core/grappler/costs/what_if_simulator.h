@@ -0,0 +1,88 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_GRAPPLER_COSTS_WHAT_IF_SIMULATOR_H_
+#define TENSORFLOW_CORE_GRAPPLER_COSTS_WHAT_IF_SIMULATOR_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/grappler/costs/cost_estimator.h"
+#include "tensorflow/core/protobuf/device_properties.pb.h"
+
+namespace tensorflow {
+namespace grappler {
+
+// Options for a what-if simulation.
+struct WhatIfSimulationOptions {
+  // If positive, replaces unknown (-1) leading dimensions of Placeholder
+  // shapes with this batch size before simulation.
+  int batch_size = 0;
+
+  // Nodes to treat as the step's fetches. If empty, every node without a data
+  // consumer is fetched.
+  std::vector<std::string> fetch;
+
+  // Shape inference settings, forwarded to AnalyticalCostEstimator.
+  bool use_static_shapes = true;
+  bool use_aggressive_shape_inference = true;
+};
+
+// Predicted behavior of one device during a simulated step.
+struct WhatIfDeviceReport {
+  std::string device;
+
+  // Time the device spends executing ops during the step.
+  Costs::Duration busy_time;
+
+  // busy_time divided by the predicted step time, in [0, 1].
+  double utilization = 0.0;
+
+  // Peak temporary memory usage on the device, in bytes.
+  int64_t peak_memory_bytes = 0;
+
+  // Number of op executions scheduled on the device.
+  int64_t num_ops = 0;
+};
+
+// Result of a what-if simulation.
+struct WhatIfReport {
+  // Predicted wall time of one step (critical path across all devices).
+  Costs::Duration step_time;
+
+  // Per-device predictions, sorted by device name.
+  std::vector<WhatIfDeviceReport> per_device;
+};
+
+// Simulates one step of `graph` on the given device set (device name ->
+// properties, as accepted by VirtualCluster) and fills in `report` with the
+// predicted step time, per-device utilization and peak memory.
+//
+// The simulation runs the virtual scheduler with the analytical cost model,
+// so per-host calibration of OpLevelCostEstimator (TF_OP_COST_CALIBRATION)
+// applies to the predictions. Intended for capacity-planning tools that size
+// deployments without running the model.
+absl::Status SimulateWhatIf(
+    const GraphDef& graph,
+    const std::unordered_map<std::string, DeviceProperties>& devices,
+    const WhatIfSimulationOptions& options, WhatIfReport* report);
+
+}  // end namespace grappler
+}  // end namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_GRAPPLER_COSTS_WHAT_IF_SIMULATOR_H_
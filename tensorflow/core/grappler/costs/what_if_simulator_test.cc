@@ -0,0 +1,102 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/grappler/costs/what_if_simulator.h"
+
+#include "tensorflow/cc/ops/standard_ops.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace grappler {
+namespace {
+
+class WhatIfSimulatorTest : public ::testing::Test {
+ protected:
+  std::unordered_map<string, DeviceProperties> CreateDevices() {
+    std::unordered_map<string, DeviceProperties> devices;
+    DeviceProperties cpu_device;
+    cpu_device.set_type("CPU");
+    cpu_device.set_num_cores(4);
+    cpu_device.set_frequency(2600);
+    cpu_device.set_bandwidth(24 * 1024 * 1024);
+    devices["/job:localhost/replica:0/task:0/cpu:0"] = cpu_device;
+    return devices;
+  }
+
+  GraphDef CreateMiniGraph(int batch) {
+    const int width = 28;
+    const int height = 28;
+    const int num_channels = 1;
+    const int num_labels = 10;
+
+    Scope s = Scope::NewRootScope();
+    auto images = ops::Placeholder(
+        s.WithOpName("image"), DT_FLOAT,
+        ops::Placeholder::Shape({batch, width * height * num_channels}));
+    auto w = ops::Variable(s.WithOpName("W"),
+                           {width * height * num_channels, num_labels},
+                           DT_FLOAT);
+    auto b = ops::Variable(s.WithOpName("B"), {num_labels}, DT_FLOAT);
+    auto matmul = ops::MatMul(s.WithOpName("matmul"), images, w);
+    auto logits = ops::Add(s.WithOpName("logits"), matmul, b);
+    auto softmax = ops::Softmax(s.WithOpName("softmax"), logits);
+
+    GraphDef graph;
+    TF_CHECK_OK(s.ToGraphDef(&graph));
+    return graph;
+  }
+};
+
+TEST_F(WhatIfSimulatorTest, SimpleGraph) {
+  GraphDef graph = CreateMiniGraph(/*batch=*/-1);
+
+  WhatIfSimulationOptions options;
+  options.batch_size = 32;
+  WhatIfReport report;
+  TF_ASSERT_OK(SimulateWhatIf(graph, CreateDevices(), options, &report));
+
+  EXPECT_GT(report.step_time, Costs::Duration::zero());
+  ASSERT_EQ(report.per_device.size(), 1);
+  const WhatIfDeviceReport& device_report = report.per_device[0];
+  EXPECT_EQ(device_report.device, "/job:localhost/replica:0/task:0/cpu:0");
+  EXPECT_GT(device_report.busy_time, Costs::Duration::zero());
+  EXPECT_GT(device_report.utilization, 0.0);
+  EXPECT_LE(device_report.utilization, 1.0);
+  EXPECT_GT(device_report.num_ops, 0);
+}
+
+TEST_F(WhatIfSimulatorTest, ExplicitFetch) {
+  GraphDef graph = CreateMiniGraph(/*batch=*/8);
+
+  WhatIfSimulationOptions options;
+  options.fetch = {"logits"};
+  WhatIfReport report;
+  TF_ASSERT_OK(SimulateWhatIf(graph, CreateDevices(), options, &report));
+
+  EXPECT_GT(report.step_time, Costs::Duration::zero());
+}
+
+TEST_F(WhatIfSimulatorTest, NoDevices) {
+  GraphDef graph = CreateMiniGraph(/*batch=*/8);
+
+  WhatIfReport report;
+  EXPECT_FALSE(
+      SimulateWhatIf(graph, {}, WhatIfSimulationOptions(), &report).ok());
+}
+
+}  // namespace
+}  // namespace grappler
+}  // namespace tensorflow
@@ -30,6 +30,19 @@ namespace tensorflow {
 namespace grappler {
 
 // Optimize TF computations by deduping equivalent subgraphs.
+//
+// This pass operates purely on graph structure: two subgraphs are merged only
+// when they compute the same ops over the same input *tensors*. It does not
+// memoize results across distinct tensors that happen to carry equal values at
+// runtime (e.g. repeated entities within a batch). A value-keyed result cache
+// in the executor was considered and rejected: hashing input buffers costs on
+// the order of the elementwise compute it would save, cached buffers can be
+// invalidated by in-place consumers (the same hazard the feeds_inplace_op
+// analysis in this pass guards against), and subgraphs touching resource or
+// stateful ops cannot be keyed by input values at all. Callers who need
+// value-level dedup should do it in the data: gather unique rows (e.g.
+// tf.unique + tf.gather), run the pure transform once per unique row, and
+// scatter the results back.
 class Cluster;
 struct GrapplerItem;
 
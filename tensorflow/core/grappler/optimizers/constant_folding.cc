@@ -17,7 +17,10 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/constant_folding.h"
 
+#include <algorithm>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
@@ -25,6 +28,7 @@ limitations under the License.
 #include "absl/strings/substitute.h"
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/attr_value.pb.h"
+#include "tensorflow/core/framework/attr_value_util.h"
 #include "tensorflow/core/framework/function.pb.h"
 #include "tensorflow/core/framework/node_def.pb.h"
 #include "tensorflow/core/framework/node_def_util.h"
@@ -52,6 +56,7 @@ limitations under the License.
 #include "tensorflow/core/platform/cpu_info.h"
 #include "tensorflow/core/platform/denormal.h"
 #include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/setround.h"
 #include "tensorflow/core/platform/tensor_coding.h"
 #include "tensorflow/core/public/version.h"
@@ -67,6 +72,9 @@ using TensorVector = absl::InlinedVector<TensorValue, 4UL>;
 const int64_t kMaxConstantSize = 100 * 1024;
 
 namespace {
+// Upper bound on the total size of memoized EvaluateOneFoldable results.
+constexpr int64_t kMaxFoldedNodeCacheBytes = 64 << 20;  // 64MB
+
 template <typename T>
 bool AllValuesAre(const TensorProto& proto, const T& value) {
   Tensor tensor;
@@ -1361,6 +1369,21 @@ absl::Status ConstantFolding::EvaluateOneFoldable(const NodeDef& node,
     }
   });
 
+  // Fingerprint of the computation: op, attrs and constant input values.
+  // Nodes reaching this point are free of side effects, so nodes with equal
+  // fingerprints fold to identical outputs and the result can be memoized.
+  uint64 eval_key = Fingerprint64(node.op());
+  std::vector<std::pair<absl::string_view, const AttrValue*>> attrs;
+  attrs.reserve(node.attr().size());
+  for (const auto& attr : node.attr()) {
+    attrs.emplace_back(attr.first, &attr.second);
+  }
+  std::sort(attrs.begin(), attrs.end());
+  for (const auto& attr : attrs) {
+    eval_key = FingerprintCat64(eval_key, Fingerprint64(attr.first));
+    eval_key = FingerprintCat64(eval_key, AttrValueHash(*attr.second));
+  }
+
   size_t total_inputs_size = 0;
   for (const auto& input : node.input()) {
     const TensorId input_tensor = ParseTensorName(input);
@@ -1397,6 +1420,28 @@ absl::Status ConstantFolding::EvaluateOneFoldable(const NodeDef& node,
     }
     inputs.emplace_back(value);
     total_inputs_size += value->TotalBytes();
+    eval_key = FingerprintCat64(eval_key,
+                                Fingerprint64(raw_val.SerializeAsString()));
+  }
+
+  auto cache_it = folded_node_cache_.find(eval_key);
+  if (cache_it != folded_node_cache_.end()) {
+    // An identical computation has already been folded; only the generated
+    // node names differ between uses.
+    const std::vector<NodeDef>& cached = cache_it->second;
+    outputs->resize(cached.size());
+    for (size_t i = 0; i < cached.size(); ++i) {
+      outputs->at(i) = cached[i];
+      // Empty NodeDefs identify dead outputs and carry no name.
+      if (!cached[i].op().empty()) {
+        string node_name = OptimizedNodeName(node, "-folded");
+        if (cached.size() > 1) {
+          node_name = strings::StrCat(node_name, "-", i);
+        }
+        outputs->at(i).set_name(std::move(node_name));
+      }
+    }
+    return absl::OkStatus();
   }
 
   TF_RETURN_IF_ERROR(EvaluateNode(node, inputs, &output_tensors));
@@ -1424,6 +1469,16 @@ absl::Status ConstantFolding::EvaluateOneFoldable(const NodeDef& node,
       outputs->at(i) = NodeDef();
     }
   }
+  // Memoize the folded outputs so later nodes computing the same value skip
+  // kernel instantiation and evaluation entirely.
+  int64_t entry_bytes = 0;
+  for (const NodeDef& folded : *outputs) {
+    entry_bytes += folded.ByteSizeLong();
+  }
+  if (folded_node_cache_bytes_ + entry_bytes <= kMaxFoldedNodeCacheBytes) {
+    folded_node_cache_bytes_ += entry_bytes;
+    folded_node_cache_.emplace(eval_key, *outputs);
+  }
   return absl::OkStatus();
 }
 
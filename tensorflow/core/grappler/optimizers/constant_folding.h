@@ -347,6 +347,12 @@ class ConstantFolding : public GraphOptimizer {
   absl::flat_hash_set<string> nodes_allowlist_;
   absl::flat_hash_set<string> feed_nodes_;
   absl::flat_hash_map<string, bool> maybe_foldable_nodes_;
+  // Memoized results of EvaluateOneFoldable keyed by a fingerprint of
+  // (op, attrs, constant input values), so that identical subexpressions are
+  // evaluated only once.  Entries are value-keyed and therefore stay valid
+  // across graph rewrites and optimization passes.
+  absl::flat_hash_map<uint64, std::vector<NodeDef>> folded_node_cache_;
+  int64_t folded_node_cache_bytes_ = 0;
   bool has_fetch_;
   bool graph_modified_;
   bool graph_contains_assign_or_inplace_op_;
@@ -317,6 +317,40 @@ TEST_F(ConstantFoldingTest, SimpleFolding) {
   test::ExpectTensorEqual<float>(tensors_expected[0], tensors[0]);
 }
 
+TEST_F(ConstantFoldingTest, IdenticalSubexpressionsMemoized) {
+  // Two nodes computing the same value: the second is served from the
+  // memoized fold cache and must still yield a correct constant.
+  tensorflow::Scope s = tensorflow::Scope::NewRootScope();
+
+  Output a = ops::Const(s.WithOpName("a"), 1.5f, {2});
+  Output b = ops::Const(s.WithOpName("b"), 2.0f, {2});
+  Output m1 = ops::Mul(s.WithOpName("m1"), a, b);
+  Output m2 = ops::Mul(s.WithOpName("m2"), a, b);
+
+  GrapplerItem item;
+  item.fetch = {"m1", "m2"};
+  TF_CHECK_OK(s.ToGraphDef(&item.graph));
+
+  ConstantFolding optimizer(/*cpu_device=*/nullptr);
+  GraphDef output;
+  absl::Status status = optimizer.Optimize(/*cluster=*/nullptr, item, &output);
+  TF_EXPECT_OK(status);
+
+  for (const NodeDef& node : output.node()) {
+    if (node.name() == "m1" || node.name() == "m2") {
+      EXPECT_EQ("Const", node.op());
+    }
+  }
+
+  auto tensors_expected = EvaluateNodes(item.graph, item.fetch);
+  auto tensors = EvaluateNodes(output, item.fetch);
+  ASSERT_EQ(2, tensors_expected.size());
+  ASSERT_EQ(2, tensors.size());
+  for (int i = 0; i < 2; ++i) {
+    test::ExpectTensorEqual<float>(tensors_expected[i], tensors[i]);
+  }
+}
+
 TEST_F(ConstantFoldingTest, AddTree) {
   tensorflow::Scope s = tensorflow::Scope::NewRootScope();
 
@@ -21,6 +21,7 @@ limitations under the License.
 #include <type_traits>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -62,8 +63,12 @@ limitations under the License.
 #include "tensorflow/core/grappler/verifiers/structure_verifier.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/gtl/map_util.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/util/dump_graph.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tensorflow/core/util/util.h"
 #include "tensorflow/core/util/xla_config_registry.h"
 
@@ -103,6 +108,35 @@ int NumIterations(const RewriterConfig& cfg) {
              : cfg.meta_optimizer_iterations();
 }
 
+// Process-wide cache of optimized function bodies, keyed by a fingerprint of
+// the function definition and the optimization configuration. Re-optimizing a
+// revised model typically leaves most library functions byte-identical, so
+// with the cache enabled only the functions covering the changed regions of
+// the program are sent through the optimization pipeline again.
+struct OptimizedFunctionCache {
+  mutex mu;
+  absl::flat_hash_map<uint64, FunctionDef> functions TF_GUARDED_BY(mu);
+  int64_t cache_bytes TF_GUARDED_BY(mu) = 0;
+};
+
+OptimizedFunctionCache* GlobalOptimizedFunctionCache() {
+  static OptimizedFunctionCache* cache = new OptimizedFunctionCache;
+  return cache;
+}
+
+// Upper bound in bytes on the optimized function cache; 0 (the default)
+// disables caching. Reuse is only valid when every process that populates the
+// cache runs with the same optimizer set, so this is opt-in.
+int64_t OptimizedFunctionCacheBytes() {
+  static const int64_t cache_bytes = [] {
+    int64_t bytes;
+    TF_CHECK_OK(ReadInt64FromEnvVar("TF_GRAPPLER_FUNCTION_CACHE_BYTES",
+                                    /*default_val=*/0, &bytes));
+    return bytes;
+  }();
+  return cache_bytes;
+}
+
 // Check if optimizer is allowed to run only once.
 bool IsRunOnceOptimizer(const string& name) {
   return name == "layout" || name == "memory_optimizer" ||
@@ -814,6 +848,13 @@ absl::Status MetaOptimizer::OptimizeGraph(
     CompressConstants(optimized_graph);
   }
 
+  // Hash of the graph at the start of the current iteration, used to detect
+  // when the optimizers have reached a fixed point. Hashing a large graph is
+  // much cheaper than sending it through a no-op sweep of the full pipeline.
+  uint64 graph_hash = NumIterations(cfg_) > 1
+                          ? DeterministicProtoHash64(*optimized_graph)
+                          : 0;
+
   for (int iteration = 0; iteration < NumIterations(cfg_); ++iteration) {
     // Don't bother optimizing further if the graph is already tiny.
     if (optimized_graph->node_size() < min_graph_nodes) {
@@ -872,6 +913,18 @@ absl::Status MetaOptimizer::OptimizeGraph(
     for (const auto& verifier : post_optimization_verifiers) {
       TF_RETURN_IF_ERROR(verifier->Verify(*optimized_graph));
     }
+
+    // If this iteration left the graph unchanged, every optimizer saw exactly
+    // this graph and declined to rewrite it, so further iterations are no-ops.
+    if (iteration + 1 < NumIterations(cfg_)) {
+      const uint64 hash_after = DeterministicProtoHash64(*optimized_graph);
+      if (hash_after == graph_hash) {
+        VLOG(1) << "Stopping after iteration " << iteration
+                << ", optimizers reached a fixed point.";
+        break;
+      }
+      graph_hash = hash_after;
+    }
   }
 #ifndef ENABLE_MKL
   // ScopedAllocatorOptimizer must run last.
@@ -1166,6 +1219,15 @@ absl::Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster,
   // True if this is a TPU graph using the old bridge.
   bool is_tpu_graph = IsLegacyTPUBridgeGraphDef(*optimized_graph);
 
+  // A function body may only be reused from the cache when it was optimized
+  // under an identical configuration and producer version.
+  const int64_t function_cache_bytes = OptimizedFunctionCacheBytes();
+  const uint64 function_cache_config_hash =
+      function_cache_bytes > 0
+          ? FingerprintCat64(DeterministicProtoHash64(config_proto_),
+                             static_cast<uint64>(producer))
+          : 0;
+
   // Optimize each function only once.
   absl::flat_hash_set<string> optimized_funcs;
   while (optimize_function_library) {
@@ -1194,6 +1256,28 @@ absl::Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster,
       // and in function instantiation.
       if (data::IsTFDataFunction(func)) continue;
 
+      const bool differentiable = differentiable_functions.contains(func_name);
+
+      // The TPU path below runs only the implementation selector, which is
+      // cheap enough that caching its output is not worthwhile.
+      const bool use_function_cache = function_cache_bytes > 0 && !is_tpu_graph;
+      uint64 function_cache_key = 0;
+      if (use_function_cache) {
+        function_cache_key = FingerprintCat64(
+            FingerprintCat64(function_cache_config_hash, FunctionDefHash(func)),
+            differentiable ? 1 : 0);
+        OptimizedFunctionCache* cache = GlobalOptimizedFunctionCache();
+        mutex_lock l(cache->mu);
+        auto it = cache->functions.find(function_cache_key);
+        if (it != cache->functions.end()) {
+          VLOG(3) << "Reusing cached optimization for function: " << func_name;
+          optimize_function_library = true;
+          optimized_funcs.insert(func_name);
+          TF_RETURN_IF_ERROR(flib.ReplaceFunction(func_name, it->second));
+          continue;
+        }
+      }
+
       VLOG(3) << "Optimize function: function=" << func_name << " ["
               << function_idx++ << " of "
               << optimized_graph->library().function_size() << "]";
@@ -1211,7 +1295,7 @@ absl::Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster,
       // If we need to compute the gradient of optimized function at runtime, we
       // can't perform non-differentiable rewrites.
       func_item.optimization_options().allow_non_differentiable_rewrites =
-          !differentiable_functions.contains(func_name);
+          !differentiable;
 
       // Device set available to the function is defined only by the runtime,
       // when we instantiate and execute the function. We can't use all devices
@@ -1261,10 +1345,12 @@ absl::Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster,
 
       // Function body optimization might have created new specialized
       // functions for each instantiation context. Add them to the library.
+      bool created_specialized_functions = false;
       for (const FunctionDef& func_def :
            optimized_func_graph.library().function()) {
         if (flib.Find(func_def.signature().name()) == nullptr) {
           TF_RETURN_IF_ERROR(flib.AddFunctionDef(func_def));
+          created_specialized_functions = true;
         }
       }
 
@@ -1275,6 +1361,20 @@ absl::Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster,
 
       // Replace optimized function with a new FunctionDef.
       TF_RETURN_IF_ERROR(flib.ReplaceFunction(func_name, optimized_func));
+
+      // A body whose optimization created specialized callees is not cached,
+      // because reusing it would also require re-creating those callees in
+      // the destination library.
+      if (use_function_cache && !created_specialized_functions) {
+        const int64_t entry_bytes = optimized_func.ByteSizeLong();
+        OptimizedFunctionCache* cache = GlobalOptimizedFunctionCache();
+        mutex_lock l(cache->mu);
+        if (cache->cache_bytes + entry_bytes <= function_cache_bytes &&
+            cache->functions.emplace(function_cache_key, optimized_func)
+                .second) {
+          cache->cache_bytes += entry_bytes;
+        }
+      }
     }
 
     // If optimized at least one function, update the graph library.
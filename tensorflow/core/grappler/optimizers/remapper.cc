@@ -25,6 +25,8 @@ limitations under the License.
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_split.h"
 #include "tensorflow/core/framework/tensor_shape.h"
 #include "tensorflow/core/framework/versions.pb.h"
 #include "tensorflow/core/grappler/costs/graph_properties.h"
@@ -446,6 +448,27 @@ bool IsCpuCompatibleDepthwiseConv2dNative(const NodeDef* dw_conv2d) {
   return NodeIsOnCpu(dw_conv2d) && IsCpuCompatibleDataType(dw_conv2d);
 }
 
+// Contraction fusions usually win, but on some microarchitectures specific
+// fused kernels are slower than the unfused ops they replace (e.g. some
+// Conv2D+BiasAdd+Relu fusions on machines without AVX-512). Operators can list
+// contraction op names (comma separated, e.g. "Conv2D,MatMul") in this
+// variable, typically derived from fleet cost-model profiles, to keep the
+// remapper from fusing those contractions on CPU.
+bool IsCpuFusionDisabledByEnv(const NodeDef& contraction) {
+  static const absl::flat_hash_set<string>* const disabled_ops = [] {
+    auto* ops = new absl::flat_hash_set<string>;
+    string disabled_list;
+    TF_CHECK_OK(ReadStringFromEnvVar("TF_GRAPPLER_DISABLED_CPU_FUSIONS",
+                                     /*default_val=*/"", &disabled_list));
+    for (absl::string_view op :
+         absl::StrSplit(disabled_list, ',', absl::SkipEmpty())) {
+      ops->insert(string(absl::StripAsciiWhitespace(op)));
+    }
+    return ops;
+  }();
+  return disabled_ops->contains(contraction.op());
+}
+
 // Checks if we can rewrite a pattern to the `_Fused{Conv2D,MatMul}` on CPU.
 template <typename Pattern>
 bool IsCpuCompatible(const RemapperContext& ctx, const Pattern& matched) {
@@ -453,6 +476,7 @@ bool IsCpuCompatible(const RemapperContext& ctx, const Pattern& matched) {
   if (ctx.xla_cpu_jit_disable_fusion) return false;
 
   const NodeDef& node = ctx.graph_view.graph()->node(matched.contraction);
+  if (IsCpuFusionDisabledByEnv(node)) return false;
   if (IsConv2D(node)) {
     return IsCpuCompatibleConv2D(ctx, &node);
   } else if (IsDepthwiseConv2dNative(node)) {
@@ -2145,7 +2169,14 @@ bool FindMklLayerNorm(RemapperContext* ctx, int node_index,
                       std::map<string, int>* matched_nodes_map,
                       std::set<int>* remove_node_indices,
                       std::vector<string>* input_node_names, float* epsilon) {
-  if (!IsMKLEnabled()) return false;
+  if (!IsMKLEnabled()) {
+    // Without oneDNN the pattern is lowered to the portable _FusedLayerNorm
+    // CPU kernel, which supports float and bfloat16.
+    const NodeDef* node_def = ctx->graph_view.GetNode(node_index)->node();
+    const DataType dtype = GetDataTypeFromAttr(*node_def, "T");
+    if (!NodeIsOnCpu(node_def) || (dtype != DT_FLOAT && dtype != DT_BFLOAT16))
+      return false;
+  }
 
   // The following pattern will be searched in the graph with additional
   // contraints. Here * means any type of op.
@@ -3897,7 +3928,7 @@ absl::Status AddMklLayerNorm(RemapperContext* ctx,
 
   NodeDef fused_node;
   fused_node.set_name(output_node->name());
-  fused_node.set_op("_MklLayerNorm");
+  fused_node.set_op(IsMKLEnabled() ? "_MklLayerNorm" : "_FusedLayerNorm");
   fused_node.set_device(output_node->device());
   for (const auto& name : input_node_names) fused_node.add_input(name);
   auto* attr = fused_node.mutable_attr();
@@ -5120,6 +5151,25 @@ absl::Status Remapper::Optimize(Cluster* cluster, const GrapplerItem& item,
       }
     }
 
+    // Remap decomposed layer-normalization into _FusedLayerNorm on CPU. When
+    // oneDNN is enabled the same pattern is matched above and lowered to
+    // _MklLayerNorm instead.
+    if (!IsMKLEnabled() && !ctx.xla_cpu_jit_disable_fusion) {
+      std::map<string, int> ln_matched_nodes_map;
+      std::set<int> ln_remove_node_indices;
+      std::vector<string> ln_input_node_names;
+      float epsilon = 0.001;
+      if (FindMklLayerNorm(&ctx, i, &ln_matched_nodes_map,
+                           &ln_remove_node_indices, &ln_input_node_names,
+                           &epsilon)) {
+        TF_RETURN_IF_ERROR(AddMklLayerNorm(
+            &ctx, ln_matched_nodes_map, ln_remove_node_indices,
+            ln_input_node_names, &invalidated_nodes, &nodes_to_delete,
+            epsilon));
+        continue;
+      }
+    }
+
     // Remap MatMul + BiasAdd + gelu-subgraph
     std::map<string, int> matched_nodes_map;
     std::set<int> remove_node_indices;
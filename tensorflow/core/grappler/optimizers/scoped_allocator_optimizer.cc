@@ -894,12 +894,252 @@ class UnaryElementwiseRewriter : public ScopedAllocatorOptimizer::Rewriter {
   }
 };
 
+// Rewrites a ConcatV2 over axis 0 into a _ScopedAllocatorConcat whose inputs
+// are sub-allocated from a single backing tensor.  The producers of the
+// concat inputs then write directly into the backing tensor and the concat
+// itself becomes a reshaped alias of it, eliminating the copy.  Unlike
+// UnaryElementwiseRewriter this rewriter transforms each op instance
+// independently, so it runs on groups of size 1.
+//
+// The rewrite is only a pure alias when the backing tensor is a dense
+// concatenation of its fields.  ScopedAllocatorMgr::PopulateFields rounds
+// every field up to Allocator::kAllocatorAlignment, so each input's byte size
+// must be a multiple of that alignment; concats that don't qualify are left
+// alone.
+class ConcatV2Rewriter : public UnaryElementwiseRewriter {
+ public:
+  ~ConcatV2Rewriter() override {}
+
+  size_t MinGroupSize() const override { return 1; }
+
+  // Returns OK and populates the outputs if `cn` is eligible for the rewrite,
+  // Aborted if it should be skipped, and any other error on inconsistent
+  // graph state.  Does not modify the graph.
+  absl::Status AnalyzeConcat(GraphDef* graph, NodeMap* node_map, NodeDef* cn,
+                             DataType* dtype, std::vector<InputDesc>* inputs,
+                             std::vector<TensorShape>* input_shapes,
+                             TensorShape* output_shape) {
+    CHECK(graph_properties_);
+    if (cn->device().empty()) {
+      return errors::Aborted("Concat node ", cn->name(),
+                             " has no assigned device");
+    }
+    if (HasNodeAttr(*cn, kScopedAllocatorAttrName)) {
+      return errors::Aborted("Concat node ", cn->name(),
+                             " output is already committed to a "
+                             "ScopedAllocator and cannot become an alias");
+    }
+    AttrSlice cn_attrs = AttrSlice(*cn);
+    int32_t num_inputs = 0;
+    LOG_WARNING_AND_RETURN_IF_ERROR(GetNodeAttr(cn_attrs, "N", &num_inputs));
+    LOG_WARNING_AND_RETURN_IF_ERROR(GetNodeAttr(cn_attrs, "T", dtype));
+    if (Allocator::kAllocatorAlignment % DataTypeSize(*dtype) != 0) {
+      return errors::Aborted("Data type ", DataTypeString(*dtype),
+                             " does not evenly divide kAllocatorAlignment");
+    }
+
+    // The axis is the last data input and must be a constant 0.
+    std::vector<InputDesc> data_inputs;
+    LOG_WARNING_AND_RETURN_IF_ERROR(
+        GetDataInputs(graph, node_map, cn, &data_inputs));
+    if (static_cast<int32_t>(data_inputs.size()) != num_inputs + 1) {
+      return errors::Internal("Concat node ", cn->name(), " expected ",
+                              num_inputs + 1, " data inputs but has ",
+                              data_inputs.size());
+    }
+    NodeDef* axis_node = data_inputs.back().from_node_def;
+    if (!IsConstant(*axis_node)) {
+      return errors::Aborted("Concat node ", cn->name(),
+                             " has a non-constant axis");
+    }
+    Tensor axis_tensor;
+    if (!axis_tensor.FromProto(axis_node->attr().at("value").tensor()) ||
+        axis_tensor.NumElements() != 1 ||
+        (axis_tensor.dtype() != DT_INT32 && axis_tensor.dtype() != DT_INT64)) {
+      return errors::Aborted("Could not read axis of concat node ",
+                             cn->name());
+    }
+    const int64_t axis = axis_tensor.dtype() == DT_INT64
+                             ? axis_tensor.scalar<int64_t>()()
+                             : axis_tensor.scalar<int32>()();
+    if (axis != 0) {
+      return errors::Aborted("Concat node ", cn->name(), " concatenates over ",
+                             "axis ", axis, " rather than axis 0");
+    }
+    data_inputs.pop_back();
+
+    // Each input producer must be able to allocate its output from the
+    // backing tensor: on the same device, not a constant or frame-crossing
+    // op, and each (producer, slot) contributing exactly once.
+    std::set<std::pair<string, int>> seen_edges;
+    for (const InputDesc& nd : data_inputs) {
+      NodeDef* producer = nd.from_node_def;
+      if (producer->device() != cn->device()) {
+        return errors::Aborted("Input ", producer->name(), " of concat node ",
+                               cn->name(), " is on a different device");
+      }
+      if (IsConstant(*producer) || IsArg(*producer) ||
+          ModifiesFrameInfo(*producer)) {
+        return errors::Aborted("Input ", producer->name(), " of concat node ",
+                               cn->name(),
+                               " cannot allocate from a ScopedAllocator");
+      }
+      if (!seen_edges.emplace(producer->name(), nd.output_slot).second) {
+        return errors::Aborted("Concat node ", cn->name(),
+                               " consumes the same output twice");
+      }
+      if (!graph_properties_->HasOutputProperties(producer->name())) {
+        return errors::Aborted("Input ", producer->name(), " of concat node ",
+                               cn->name(), " lacks output shape");
+      }
+      const std::vector<OpInfo::TensorProperties>& prop_list =
+          graph_properties_->GetOutputProperties(producer->name());
+      const int prop_list_size = prop_list.size();
+      if (nd.output_slot >= prop_list_size) {
+        return errors::Internal("Invalid output slot ", nd.output_slot,
+                                " on node ", producer->name());
+      }
+      const OpInfo::TensorProperties& props = prop_list[nd.output_slot];
+      if (props.dtype() != *dtype || !TensorShape::IsValid(props.shape()) ||
+          props.shape().unknown_rank() ||
+          !PartialTensorShape(props.shape()).IsFullyDefined()) {
+        return errors::Aborted("Complete shape not known for input ",
+                               producer->name(), " of concat node ",
+                               cn->name());
+      }
+      TensorShape shape(props.shape());
+      // PopulateFields pads every field up to kAllocatorAlignment; the
+      // backing tensor is only a dense concatenation, and therefore a valid
+      // alias for the concat output, if no padding is introduced.
+      if ((shape.num_elements() * DataTypeSize(*dtype)) %
+              Allocator::kAllocatorAlignment !=
+          0) {
+        return errors::Aborted("Input ", producer->name(), " of concat node ",
+                               cn->name(),
+                               " is not a multiple of kAllocatorAlignment");
+      }
+      input_shapes->push_back(shape);
+    }
+    LOG_WARNING_AND_RETURN_IF_ERROR(CheckExistingScopedAllocator(data_inputs));
+
+    if (!graph_properties_->HasOutputProperties(cn->name())) {
+      return errors::Aborted("Concat node ", cn->name(),
+                             " lacks output shape");
+    }
+    const OpInfo::TensorProperties& cn_props =
+        graph_properties_->GetOutputProperties(cn->name())[0];
+    if (!TensorShape::IsValid(cn_props.shape()) ||
+        cn_props.shape().unknown_rank() ||
+        !PartialTensorShape(cn_props.shape()).IsFullyDefined()) {
+      return errors::Aborted("Complete shape not known for concat node ",
+                             cn->name());
+    }
+    *output_shape = TensorShape(cn_props.shape());
+    *inputs = std::move(data_inputs);
+    return absl::OkStatus();
+  }
+
+  // Builds a _ScopedAllocator providing the backing tensor for the inputs of
+  // `cn`, then converts `cn` in place into a _ScopedAllocatorConcat that
+  // aliases it.  Keeping the node name means no downstream rewiring and no
+  // interaction with the preserved-node set; with reshape=true the output
+  // shape is unchanged.
+  absl::Status RewriteOneConcat(ScopedAllocatorOptimizer* sa_opti,
+                                int64_t invocation_count, GraphDef* graph,
+                                NodeDef* cn) {
+    NodeMap* node_map = sa_opti->node_map();
+    DataType dtype = DT_INVALID;
+    std::vector<InputDesc> inputs;
+    std::vector<TensorShape> input_shapes;
+    TensorShape output_shape;
+    TF_RETURN_IF_ERROR(AnalyzeConcat(graph, node_map, cn, &dtype, &inputs,
+                                     &input_shapes, &output_shape));
+
+    std::vector<ScopedAllocator::Field> sa_fields;
+    int64_t num_bytes = ScopedAllocatorMgr::PopulateFields(
+        0 /*scope_id*/, input_shapes, dtype, &sa_fields);
+    int64_t num_elts = num_bytes / DataTypeSize(dtype);
+    if (num_elts != output_shape.num_elements()) {
+      // Inconsistent inferred shapes; leave this concat alone.
+      return errors::Aborted("Backing tensor of concat node ", cn->name(),
+                             " has ", num_elts, " elements, expected ",
+                             output_shape.num_elements());
+    }
+    TensorShape sa_shape({num_elts});
+
+    std::vector<NodeDef*> producers;
+    producers.reserve(inputs.size());
+    for (const InputDesc& nd : inputs) {
+      producers.push_back(nd.from_node_def);
+    }
+    int sa_id = sa_opti->NewScopedAllocatorId(input_shapes.size());
+    string sa_name =
+        strings::StrCat("scoped_allocator_", sa_id, "_", invocation_count);
+    TF_RETURN_IF_ERROR(ConstructScopedAllocatorNode(
+        sa_opti, graph, node_map, producers, cn->device(), dtype, sa_id,
+        sa_name, input_shapes, inputs, sa_shape));
+
+    // Convert the ConcatV2 node in place: the backing tensor becomes input
+    // 0, the data inputs are kept, and the axis input is dropped.
+    std::vector<string> old_inputs(cn->input().begin(), cn->input().end());
+    cn->clear_input();
+    cn->add_input(sa_name);
+    node_map->AddOutput(sa_name, cn->name());
+    int data_input_index = 0;
+    for (const string& old_input : old_inputs) {
+      int position = 0;
+      string input_name = ParseNodeName(old_input, &position);
+      if (position >= 0 &&
+          data_input_index == static_cast<int>(inputs.size())) {
+        // The axis input.  Drop the edge; the axis node stays in the graph
+        // for any other consumers and is otherwise dead code.
+        node_map->RemoveOutput(input_name, cn->name());
+        ++data_input_index;
+        continue;
+      }
+      if (position >= 0) {
+        ++data_input_index;
+      }
+      cn->add_input(old_input);
+    }
+    cn->set_op("_ScopedAllocatorConcat");
+    cn->mutable_attr()->erase("Tidx");
+    AddNodeAttr("sa_name", sa_name, cn);
+    AddNodeAttr("id", sa_id, cn);
+    AddNodeAttr("shape", output_shape, cn);
+    AddNodeAttr("reshape", true, cn);
+    VLOG(1) << "Rewrote concat node " << cn->name() << " to alias "
+            << sa_name;
+    return absl::OkStatus();
+  }
+
+  absl::Status Rewrite(ScopedAllocatorOptimizer* sa_opti,
+                       int64_t invocation_count, GraphDef* graph,
+                       const string& op_name, const std::vector<NodeDef*>& ops,
+                       bool* applied) override {
+    for (NodeDef* cn : ops) {
+      absl::Status s = RewriteOneConcat(sa_opti, invocation_count, graph, cn);
+      if (absl::IsAborted(s)) {
+        // This concat is ineligible; leave it alone and keep going.
+        VLOG(1) << "Skipping concat node " << cn->name() << ": "
+                << s.message();
+        continue;
+      }
+      LOG_WARNING_AND_RETURN_IF_ERROR(s);
+      *applied = true;
+    }
+    return absl::OkStatus();
+  }
+};
+
 ScopedAllocatorOptimizer::ScopedAllocatorOptimizer(
     RewriterConfig::Toggle opt_level, const ScopedAllocatorOptions& opts)
     : opt_level_(opt_level) {
   VLOG(1) << "ScopedAllocatorOptimizer::ScopedAllocatorOptimizer";
   Rewriter* r = new UnaryElementwiseRewriter();
   to_delete_.push_back(r);
+  Rewriter* concat_rewriter = new ConcatV2Rewriter();
+  to_delete_.push_back(concat_rewriter);
   if (opts.enable_op_size() == 0) {
     // Opts handled by default:
     for (const auto& op_name : {"CollectiveReduce"}) {
@@ -909,7 +1149,7 @@ ScopedAllocatorOptimizer::ScopedAllocatorOptimizer(
   } else {
     for (const auto& op_name : opts.enable_op()) {
       op_name_set_.insert(op_name);
-      rewriters_[op_name] = r;
+      rewriters_[op_name] = op_name == "ConcatV2" ? concat_rewriter : r;
     }
   }
 }
@@ -1133,11 +1373,11 @@ absl::Status ScopedAllocatorOptimizer::ProcessGraphDef(
                                          &op_name, invocation_count](Tree* t) {
           VLOG(2) << "applied to tree node " << t->edge_ << " at depth "
                   << t->depth_ << " of size " << t->nodes_.size();
-          if (t->nodes_.size() > 1) {
+          if (t->nodes_.size() >= rewriter->MinGroupSize()) {
             std::vector<std::vector<NodeDef*>> loop_groups;
             PartitionByLoopStructure(frame_view, t->nodes_, &loop_groups);
             for (auto& lg : loop_groups) {
-              if (lg.size() > 1) {
+              if (lg.size() >= rewriter->MinGroupSize()) {
                 bool applied = false;
                 absl::Status s = OrderNodeSet(&lg);
                 TF_RETURN_IF_ERROR(s);
@@ -93,6 +93,12 @@ class ScopedAllocatorOptimizer : public GraphOptimizer {
                                  const std::vector<NodeDef*>& nodes,
                                  bool* applied) = 0;
 
+    // Minimum number of nodes that must share a (device, op, name scope,
+    // loop nesting) group before Rewrite is invoked on the group.  Rewriters
+    // that coalesce parallel op instances need at least 2; rewriters that
+    // restructure each instance independently may lower this to 1.
+    virtual size_t MinGroupSize() const { return 2; }
+
     void SetGraphProperties(const GraphProperties& graph_properties) {
       graph_properties_ = &graph_properties;
       CHECK(graph_properties_);
@@ -267,6 +267,33 @@ class ScopedAllocatorOptimizerTest : public ::testing::Test {
     TF_CHECK_OK(s.ToGraphDef(graph_def));
   }
 
+  // Constructs the following graph.
+  //
+  // s1 and s2 are Add ops producing {4, 4} float tensors, i.e. tensors whose
+  // byte size is a multiple of Allocator::kAllocatorAlignment, feeding a
+  // ConcatV2 over axis 0.  The intended optimization is to have s1 and s2
+  // allocate from a new ScopedAllocator and to turn the concat into an alias
+  // of the backing tensor.
+  /*
+        a    b    c
+         \  / \  /
+          s1   s2
+           \   /
+          concat
+  */
+  void BuildConcatGraph(GraphDef* graph_def) {
+    Scope s = Scope::NewRootScope();
+    s = s.WithDevice("/job:localhost/replica:0/task:0/device:CPU:0");
+
+    Output a = ops::Const<float>(s.WithOpName("a"), 1.0, {4, 4});
+    Output b = ops::Const<float>(s.WithOpName("b"), 2.0, {4, 4});
+    Output c = ops::Const<float>(s.WithOpName("c"), 3.0, {4, 4});
+    Output s1 = ops::Add(s.WithOpName("s1"), a, b);
+    Output s2 = ops::Add(s.WithOpName("s2"), b, c);
+    Output concat = ops::Concat(s.WithOpName("concat"), {s1, s2}, 0);
+    TF_CHECK_OK(s.ToGraphDef(graph_def));
+  }
+
   void SetShapes(GraphDef* graph_def) {
     TensorShapeProto shape_proto;
     shape_proto.add_dim()->set_size(2);
@@ -283,7 +310,8 @@ class ScopedAllocatorOptimizerTest : public ::testing::Test {
   // returns the outputs specified by `output_names` in `outputs`.
   void ExecuteGraph(const GraphDef& graph_def,
                     const std::vector<string>& output_names,
-                    std::vector<Tensor>* outputs) {
+                    std::vector<Tensor>* outputs,
+                    const string& enable_op = "Abs") {
     // Turn off all optimization except the ScopedAllocatorOptimizer
     // to avoid anything that would alter the expected graph input/output,
     // e.g. by constant folding away all calculations.
@@ -297,7 +325,7 @@ class ScopedAllocatorOptimizerTest : public ::testing::Test {
     RewriterConfig* rwcfg = gopt->mutable_rewrite_options();
     rwcfg->clear_optimizers();
     (*rwcfg->add_optimizers()) = "scoped_allocator";
-    rwcfg->mutable_scoped_allocator_opts()->add_enable_op("Abs");
+    rwcfg->mutable_scoped_allocator_opts()->add_enable_op(enable_op);
     std::unique_ptr<Session> session(CreateSession(graph_def, config));
 
     std::vector<std::pair<string, Tensor>> inputs;
@@ -596,6 +624,59 @@ TEST_F(ScopedAllocatorOptimizerTest, ConstInput) {
   }
   EXPECT_EQ(num_identity_ops, 2);
 }
+
+// Tests that a ConcatV2 over axis 0 whose inputs are sub-allocatable is
+// rewritten in place into a _ScopedAllocatorConcat aliasing a new backing
+// tensor.
+TEST_F(ScopedAllocatorOptimizerTest, ConcatRewrite) {
+  GrapplerItem item;
+  BuildConcatGraph(&item.graph);
+
+  ScopedAllocatorOptions opts;
+  opts.add_enable_op("ConcatV2");
+  ScopedAllocatorOptimizer sao(RewriterConfig::ON, opts);
+
+  GraphDef optimized_graph;
+  TF_ASSERT_OK(sao.Optimize(nullptr /*cluster*/, item, &optimized_graph));
+
+  // The concat node keeps its name but becomes a _ScopedAllocatorConcat with
+  // the backing tensor as input 0 and without the axis input.
+  NodeMap node_map(&optimized_graph);
+  NodeDef* concat_node = nullptr;
+  GetNode(&node_map, "concat", &concat_node);
+  EXPECT_EQ(concat_node->op(), "_ScopedAllocatorConcat");
+  ASSERT_EQ(concat_node->input_size(), 3);
+  EXPECT_EQ(concat_node->input(1), "s1");
+  EXPECT_EQ(concat_node->input(2), "s2");
+  NodeDef* backing_node = nullptr;
+  GetNode(&node_map, concat_node->input(0), &backing_node);
+  EXPECT_EQ(backing_node->op(), "_ScopedAllocator");
+  bool reshape = false;
+  TF_ASSERT_OK(GetNodeAttr(AttrSlice(*concat_node), "reshape", &reshape));
+  EXPECT_TRUE(reshape);
+
+  // The producers allocate from the ScopedAllocator and depend on it.
+  EXPECT_EQ(ValidateSAControlInput(&optimized_graph, &node_map, "s1"),
+            backing_node);
+  EXPECT_EQ(ValidateSAControlInput(&optimized_graph, &node_map, "s2"),
+            backing_node);
+}
+
+TEST_F(ScopedAllocatorOptimizerTest, ConcatExecute) {
+  // Builds the same graph as ConcatRewrite but also executes it and validates
+  // the output.
+  GraphDef graph_def;
+  BuildConcatGraph(&graph_def);
+  std::vector<Tensor> outputs;
+  ExecuteGraph(graph_def, /*output_names=*/{"concat:0"}, &outputs,
+               /*enable_op=*/"ConcatV2");
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0].shape(), TensorShape({8, 4}));
+  // a + b == 3, b + c == 5.
+  std::vector<float> expected(16, 3.0);
+  expected.resize(32, 5.0);
+  ValidateValues(outputs, /*expected=*/{expected});
+}
 #endif  // ENABLE_MKL
 
 }  // namespace
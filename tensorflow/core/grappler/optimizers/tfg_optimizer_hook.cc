@@ -15,6 +15,7 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/tfg_optimizer_hook.h"
 
+#include <cstdint>
 #include <string>
 #include <utility>
 
@@ -40,14 +41,31 @@ limitations under the License.
 #include "tensorflow/core/ir/importexport/graphdef_export.h"
 #include "tensorflow/core/ir/importexport/graphdef_import.h"
 #include "tensorflow/core/ir/tf_op_registry.h"
+#include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/fingerprint.h"
+#include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/status.h"
+#include "tensorflow/core/public/version.h"
 #include "tensorflow/core/util/dump_graph.h"
+#include "tensorflow/core/util/env_var.h"
 using tensorflow::Status;
 using tensorflow::errors::InvalidArgument;
 
 namespace mlir {
 namespace tfg {
+namespace {
+
+// If this environment variable is set to a directory, the exported result of
+// running the TFG pass pipeline is cached there, keyed by the fingerprint of
+// the input graph and the pass pipeline. Identical runs, eg. the other
+// processes on the same host importing the same model, load the cached result
+// instead of re-running the pipeline.
+constexpr char kCacheDirEnvVar[] = "TF_TFG_OPTIMIZER_CACHE_DIR";
+
+}  // namespace
 
 // The implementation of the TFG optimizer. It holds the MLIR context and the
 // pass manager.
@@ -119,6 +137,33 @@ Status TFGGrapplerOptimizer::Optimize(
   }
   VLOG(5) << "TFG Before Graph: \n" << item.graph.DebugString();
 
+  std::string cache_dir;
+  TF_RETURN_IF_ERROR(
+      tensorflow::ReadStringFromEnvVar(kCacheDirEnvVar, "", &cache_dir));
+  std::string cache_path;
+  if (!cache_dir.empty()) {
+    // The cache key covers everything that determines the result of the
+    // pipeline: the input graph, the textual pass pipeline (including pass
+    // options) and the TensorFlow version the passes were built at, so a stale
+    // entry is never loaded.
+    uint64_t fingerprint = tensorflow::DeterministicProtoHash64(item.graph);
+    fingerprint = tensorflow::FingerprintCat64(
+        fingerprint, tensorflow::Fingerprint64(impl_->GetPipelineString()));
+    fingerprint = tensorflow::FingerprintCat64(
+        fingerprint, tensorflow::Fingerprint64(TF_VERSION_STRING));
+    cache_path = tensorflow::io::JoinPath(
+        cache_dir, absl::StrCat(absl::Hex(fingerprint, absl::kZeroPad16),
+                                ".pb"));
+    tensorflow::GraphDef cached_graph;
+    if (tensorflow::ReadBinaryProto(tensorflow::Env::Default(), cache_path,
+                                    &cached_graph)
+            .ok()) {
+      VLOG(1) << name() << " reusing cached pass result from " << cache_path;
+      *optimized_graph = std::move(cached_graph);
+      return absl::OkStatus();
+    }
+  }
+
   // Import the GraphDef to TFG.
   tensorflow::GraphDebugInfo debug_info;
   tensorflow::metrics::ScopedCounter<2> metrics(
@@ -160,6 +205,29 @@ Status TFGGrapplerOptimizer::Optimize(
   metrics.ReportAndStop();
   *optimized_graph = std::move(graphdef);
 
+  if (!cache_path.empty()) {
+    // Fill the cache via a temporary file and an atomic rename, so that
+    // concurrent processes never observe a partially written entry. Cache
+    // write failures are not fatal since the result is already computed.
+    const std::string tmp_path =
+        absl::StrCat(cache_path, ".tmp-",
+                     absl::Hex(tensorflow::random::New64(), absl::kZeroPad16));
+    absl::Status cache_status =
+        tensorflow::Env::Default()->RecursivelyCreateDir(cache_dir);
+    if (cache_status.ok()) {
+      cache_status = tensorflow::WriteBinaryProto(tensorflow::Env::Default(),
+                                                  tmp_path, *optimized_graph);
+    }
+    if (cache_status.ok()) {
+      cache_status =
+          tensorflow::Env::Default()->RenameFile(tmp_path, cache_path);
+    }
+    if (!cache_status.ok()) {
+      LOG(WARNING) << "Failed to write TFG pass result cache entry "
+                   << cache_path << ": " << cache_status;
+    }
+  }
+
   if (VLOG_IS_ON(4)) {
     tensorflow::DumpGraphDefToFile(
         absl::StrCat("tfg_after_graph_", item.id, "_",
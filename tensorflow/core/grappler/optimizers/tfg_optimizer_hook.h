@@ -49,6 +49,12 @@ class TFGGrapplerOptimizer : public tensorflow::grappler::GraphOptimizer {
   // Runs the optimizer on the GraphDef. The optimizer converts the GraphDef to
   // TFG using the importer, runs the passes on the MLIR, and exports back to
   // GraphDef. The result is stored in `optimized_graph`.
+  //
+  // If the environment variable `TF_TFG_OPTIMIZER_CACHE_DIR` is set to a
+  // directory, the exported result is cached there, keyed by the fingerprint
+  // of the input graph and the pass pipeline. Identical runs, eg. in other
+  // processes on the same host importing the same model, load the cached
+  // result instead of re-running the pipeline.
   absl::Status Optimize(tensorflow::grappler::Cluster* cluster,
                         const tensorflow::grappler::GrapplerItem& item,
                         tensorflow::GraphDef* optimized_graph) override;
@@ -15,7 +15,10 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/tfg_optimizer_hook.h"
 
+#include <cstdlib>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "mlir/Pass/Pass.h"  // from @llvm-project
 #include "mlir/Pass/PassManager.h"  // from @llvm-project
@@ -30,7 +33,9 @@ limitations under the License.
 #include "tensorflow/core/ir/ops.h"
 #include "tensorflow/core/ir/tf_op_wrapper.h"
 #include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/status.h"
 #include "tensorflow/core/platform/test.h"
 
@@ -91,6 +96,38 @@ TEST(TFGOptimizerTest, TestCustomPipeline) {
   EXPECT_EQ("b_visited", output.node(1).name());
 }
 
+TEST(TFGOptimizerTest, TestPassResultCache) {
+  Scope s = Scope::NewRootScope();
+  Output a = ops::Const(s.WithOpName("a"), 0.0f, {10, 10});
+  GrapplerItem item;
+  TF_CHECK_OK(s.ToGraphDef(&item.graph));
+
+  const std::string cache_dir =
+      io::JoinPath(testing::TmpDir(), "tfg_pass_cache");
+  setenv("TF_TFG_OPTIMIZER_CACHE_DIR", cache_dir.c_str(), /*overwrite=*/1);
+
+  mlir::tfg::TFGGrapplerOptimizer optimizer([](mlir::PassManager &mgr) {
+    mgr.addNestedPass<mlir::tfg::GraphOp>(
+        std::make_unique<mlir::tfg::TestPass>());
+  });
+
+  // The first run misses the cache and fills it with one entry.
+  GraphDef output;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &output));
+  EXPECT_EQ("a_visited", output.node(0).name());
+
+  std::vector<std::string> children;
+  TF_ASSERT_OK(Env::Default()->GetChildren(cache_dir, &children));
+  EXPECT_EQ(children.size(), 1);
+
+  // A second run of the same graph and pipeline is served from the cache.
+  GraphDef cached_output;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &cached_output));
+  EXPECT_EQ("a_visited", cached_output.node(0).name());
+
+  unsetenv("TF_TFG_OPTIMIZER_CACHE_DIR");
+}
+
 TEST(TFGOptimizerTest, TestCustomPipelineName) {
   // Test printing the name of a custom pipeline.
   mlir::tfg::TFGGrapplerOptimizer optimizer([](mlir::PassManager &mgr) {
@@ -308,6 +308,19 @@ BatchFunctionKernel::BatchFunctionKernel(OpKernelConstruction* c)
   OP_REQUIRES_OK(c,
                  c->GetAttr("mixed_priority_policy", &mixed_priority_policy_));
   OP_REQUIRES_OK(c, c->GetAttr("batch_padding_policy", &batch_padding_policy_));
+  // Graphs serialized before this attribute existed may omit it.
+  if (c->HasAttr("bucket_boundaries")) {
+    OP_REQUIRES_OK(c, c->GetAttr("bucket_boundaries", &bucket_boundaries_));
+    for (size_t i = 0; i < bucket_boundaries_.size(); ++i) {
+      OP_REQUIRES(c,
+                  bucket_boundaries_[i] > 0 &&
+                      (i == 0 ||
+                       bucket_boundaries_[i] > bucket_boundaries_[i - 1]),
+                  errors::InvalidArgument(
+                      "bucket_boundaries entries must be positive and "
+                      "strictly increasing"));
+    }
+  }
 
   OP_REQUIRES_OK(c, c->GetAttr("f", &func_));
 
@@ -420,6 +433,7 @@ void BatchFunctionKernel::ComputeAsync(OpKernelContext* c, DoneCallback done) {
           adaptive_shared_batch_scheduler_options, max_batch_size_,
           batch_timeout_micros_, max_enqueued_batches_, allowed_batch_sizes_,
           &new_resource));
+      new_resource->SetBucketBoundaries(bucket_boundaries_);
       if (session_metadata) {
         new_resource->set_session_metadata(*session_metadata);
       }
@@ -442,6 +456,7 @@ void BatchFunctionKernel::ComputeAsync(OpKernelContext* c, DoneCallback done) {
           low_priority_max_enqueued_batches_, low_priority_allowed_batch_sizes_,
           mixed_priority_batching_policy, enable_large_batch_splitting_,
           batch_padding_policy_, &new_resource));
+      new_resource->SetBucketBoundaries(bucket_boundaries_);
       if (session_metadata) {
         new_resource->set_session_metadata(*session_metadata);
       }
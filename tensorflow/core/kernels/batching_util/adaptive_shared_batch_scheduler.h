@@ -172,6 +172,18 @@ class AdaptiveSharedBatchScheduler
 
     // If true, the padding will not be appended.
     bool disable_padding = false;
+
+    // If positive, enables closed-loop control of this queue's batching
+    // parameters against a tail latency target, in microseconds, measured
+    // from batch creation to completion of processing. The queue records the
+    // latency of every completed batch and periodically compares the observed
+    // p99 against the target: when over target it backs off
+    // `batch_timeout_micros` and the effective batch size multiplicatively;
+    // when comfortably under target it creeps them back up toward their
+    // configured values. This replaces hand-tuning the timeout per model
+    // revision. `batch_timeout_micros` and `max_batch_size` act as upper
+    // bounds for the controlled values.
+    int64_t target_tail_latency_micros = 0;
   };
 
   using BatchProcessor = std::function<void(std::unique_ptr<Batch<TaskType>>)>;
@@ -323,7 +335,27 @@ class ASBSQueue : public BatchScheduler<TaskType> {
 
   size_t max_task_size() const override { return options_.max_batch_size; }
 
+  // Records the end-to-end latency of a completed batch. Once enough samples
+  // accumulate, adjusts the effective batch timeout and batch size toward
+  // options_.target_tail_latency_micros. No-op unless that option is set.
+  void RecordBatchLatency(int64_t latency_micros);
+
+  // Current controlled values; equal to the configured options unless
+  // target_tail_latency_micros is set. Exposed for monitoring and tests.
+  int64_t adaptive_batch_timeout_micros() const {
+    mutex_lock l(mu_);
+    return adaptive_timeout_micros_;
+  }
+  int adaptive_max_batch_size() const {
+    mutex_lock l(mu_);
+    return adaptive_max_batch_size_;
+  }
+
  private:
+  // Number of batch latency samples to aggregate per control decision. Large
+  // enough to make the p99 estimate meaningful, small enough to track load
+  // shifts within a few hundred batches.
+  static constexpr int kLatencyControlSamples = 100;
   // Number of size 1 tasks which could currently be scheduled without failing.
   size_t SchedulingCapacityLocked() const TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
@@ -337,6 +369,10 @@ class ASBSQueue : public BatchScheduler<TaskType> {
   ASBSBatch<TaskType>* current_batch_ TF_GUARDED_BY(mu_) = nullptr;
   int64_t num_enqueued_batches_ TF_GUARDED_BY(mu_) = 0;
   int64_t num_enqueued_tasks_ TF_GUARDED_BY(mu_) = 0;
+  // Latency feedback control state; see target_tail_latency_micros.
+  int64_t adaptive_timeout_micros_ TF_GUARDED_BY(mu_);
+  int adaptive_max_batch_size_ TF_GUARDED_BY(mu_);
+  std::vector<int64_t> latency_samples_ TF_GUARDED_BY(mu_);
   mutable mutex mu_;
   ASBSQueue(const ASBSQueue&) = delete;
   void operator=(const ASBSQueue&) = delete;
@@ -643,10 +679,19 @@ void AdaptiveSharedBatchScheduler<TaskType>::CallbackWrapper(
       tsl::profiler::ContextType::kAdaptiveSharedBatchScheduler,
       batch->traceme_context_id());
   const int64_t start_time = batch->creation_time_micros();
+  // The callback owns and destroys the batch; remember its queue so the
+  // latency can be reported back afterwards.
+  internal::ASBSQueue<TaskType>* queue = batch->queue();
   callback(std::unique_ptr<Batch<TaskType>>(
       const_cast<internal::ASBSBatch<TaskType>*>(batch)));
   int64_t end_time = GetEnv()->NowMicros();
   mutex_lock l(mu_);
+  // The queue may have destroyed itself once its last batch was released;
+  // it is still alive iff it has not yet removed itself from the map (both
+  // happen under mu_).
+  if (queues_and_callbacks_.find(queue) != queues_and_callbacks_.end()) {
+    queue->RecordBatchLatency(end_time - start_time);
+  }
   if (is_express) {
     in_flight_express_batches_--;
     MaybeScheduleClosedBatchesLocked();
@@ -711,7 +756,10 @@ template <typename TaskType>
 ASBSQueue<TaskType>::ASBSQueue(
     std::shared_ptr<AdaptiveSharedBatchScheduler<TaskType>> scheduler,
     const QueueOptions& options)
-    : scheduler_(scheduler), options_(options) {}
+    : scheduler_(scheduler),
+      options_(options),
+      adaptive_timeout_micros_(options.batch_timeout_micros),
+      adaptive_max_batch_size_(options.max_batch_size) {}
 
 template <typename TaskType>
 ASBSQueue<TaskType>::~ASBSQueue() {
@@ -754,10 +802,13 @@ absl::Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
       return errors::Unavailable("The batch scheduling queue is full");
     }
 
-    int remaining_batch_size =
-        current_batch_ == nullptr
-            ? options_.max_batch_size
-            : options_.max_batch_size - current_batch_->size();
+    // The latency feedback control may have shrunk the batch size and timeout
+    // below their configured values; batches are formed against the current
+    // controlled values.
+    const int max_batch_size = adaptive_max_batch_size_;
+    int remaining_batch_size = current_batch_ == nullptr
+                                   ? max_batch_size
+                                   : max_batch_size - current_batch_->size();
     if (options_.split_input_task_func == nullptr ||
         size <= remaining_batch_size) {
       // Either we don't allow task splitting or task fits within the current
@@ -768,13 +819,12 @@ absl::Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
       // Beyond this point Schedule should not fail, as the caller has been
       // promised that all of the split tasks will be scheduled.
       TF_RETURN_IF_ERROR(options_.split_input_task_func(
-          task, remaining_batch_size, options_.max_batch_size,
-          &tasks_to_schedule));
+          task, remaining_batch_size, max_batch_size, &tasks_to_schedule));
     }
     for (auto& task : tasks_to_schedule) {
       // Can't fit within current batch, close it off and try to create another.
       if (current_batch_ &&
-          current_batch_->size() + task->size() > options_.max_batch_size) {
+          current_batch_->size() + task->size() > max_batch_size) {
         current_batch_->Close();
         closed_batch = true;
         current_batch_ = nullptr;
@@ -786,8 +836,8 @@ absl::Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
         // When multiple calls to "ASBS::Schedule" accumulate to one batch, they
         // are processed in the same batch and should share traceme_context_id.
         current_batch_ = new ASBSBatch<TaskType>(
-            this, scheduler_->GetEnv()->NowMicros(),
-            options_.batch_timeout_micros, NewTraceMeContextIdForBatch());
+            this, scheduler_->GetEnv()->NowMicros(), adaptive_timeout_micros_,
+            NewTraceMeContextIdForBatch());
         new_batches.push_back(current_batch_);
       }
 
@@ -807,8 +857,7 @@ absl::Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
       bool reached_max_tasks =
           (options_.max_tasks_per_batch.has_value() &&
            current_batch_->num_tasks() >= options_.max_tasks_per_batch.value());
-      if (current_batch_->size() == options_.max_batch_size ||
-          reached_max_tasks) {
+      if (current_batch_->size() >= max_batch_size || reached_max_tasks) {
         current_batch_->Close();
         closed_batch = true;
         current_batch_ = nullptr;
@@ -837,6 +886,38 @@ void ASBSQueue<TaskType>::ReleaseBatch(const ASBSBatch<TaskType>* batch) {
   }
 }
 
+template <typename TaskType>
+void ASBSQueue<TaskType>::RecordBatchLatency(int64_t latency_micros) {
+  if (options_.target_tail_latency_micros <= 0) return;
+  mutex_lock l(mu_);
+  latency_samples_.push_back(latency_micros);
+  if (latency_samples_.size() < kLatencyControlSamples) return;
+  std::sort(latency_samples_.begin(), latency_samples_.end());
+  const int64_t p99 = latency_samples_[latency_samples_.size() * 99 / 100 - 1];
+  latency_samples_.clear();
+  const int64_t target = options_.target_tail_latency_micros;
+  // Never let the controlled timeout exceed half the latency budget; waiting
+  // longer than that guarantees target misses regardless of processing time.
+  const int64_t timeout_ceiling =
+      std::min(options_.batch_timeout_micros, target / 2);
+  if (p99 > target) {
+    // Over target: back off multiplicatively. Smaller batches finish sooner
+    // and a shorter timeout stops requests from aging in the queue.
+    adaptive_timeout_micros_ = adaptive_timeout_micros_ * 3 / 4;
+    adaptive_max_batch_size_ = std::max(1, adaptive_max_batch_size_ * 7 / 8);
+  } else if (p99 < target * 7 / 10) {
+    // Comfortably under target: creep back up additively toward the
+    // configured values to regain batching efficiency.
+    adaptive_timeout_micros_ =
+        std::min(timeout_ceiling, adaptive_timeout_micros_ +
+                                      std::max<int64_t>(timeout_ceiling / 16, 1));
+    adaptive_max_batch_size_ =
+        std::min(options_.max_batch_size,
+                 adaptive_max_batch_size_ +
+                     std::max(options_.max_batch_size / 16, 1));
+  }
+}
+
 template <typename TaskType>
 size_t ASBSQueue<TaskType>::NumEnqueuedTasks() const {
   mutex_lock l(mu_);
@@ -201,6 +201,57 @@ TEST(AdaptiveSharedBatchSchedulerTest, InFlightBatchesLimitTuning) {
   stop_teardown.Notify();
 }
 
+TEST(AdaptiveSharedBatchSchedulerTest, TargetTailLatencyFeedback) {
+  test_util::FakeClockEnv env(Env::Default());
+  Notification start_teardown, stop_teardown;
+  std::unique_ptr<Thread> teardown_thread =
+      CreateFakeClockAdvancerThread(&env, &start_teardown, &stop_teardown);
+  {
+    AdaptiveSharedBatchScheduler<FakeTask>::Options options;
+    options.env = &env;
+    std::shared_ptr<AdaptiveSharedBatchScheduler<FakeTask>> scheduler;
+    TF_ASSERT_OK(
+        AdaptiveSharedBatchScheduler<FakeTask>::Create(options, &scheduler));
+    AdaptiveSharedBatchScheduler<FakeTask>::QueueOptions queue_options;
+    queue_options.max_batch_size = 10;
+    queue_options.batch_timeout_micros = 1000;
+    queue_options.target_tail_latency_micros = 500;
+    mutex mu;
+    int processed_batches = 0;
+    auto queue_callback = [&mu, &processed_batches,
+                           &env](std::unique_ptr<Batch<FakeTask>> batch) {
+      ASSERT_TRUE(batch->IsClosed());
+      // Make every batch overshoot the 500us target.
+      env.AdvanceByMicroseconds(1000);
+      mutex_lock l(mu);
+      processed_batches++;
+    };
+    std::unique_ptr<BatchScheduler<FakeTask>> queue;
+    TF_ASSERT_OK(scheduler->AddQueue(queue_options, queue_callback, &queue));
+    auto* asbs_queue = static_cast<internal::ASBSQueue<FakeTask>*>(queue.get());
+    EXPECT_EQ(asbs_queue->adaptive_batch_timeout_micros(), 1000);
+    EXPECT_EQ(asbs_queue->adaptive_max_batch_size(), 10);
+
+    // Process enough over-target full batches to trigger a control decision.
+    for (int i = 0; i < 100; ++i) {
+      TF_ASSERT_OK(ScheduleTask(10, queue.get()));
+      for (;;) {
+        mutex_lock l(mu);
+        if (processed_batches == i + 1) break;
+      }
+    }
+    // The latency is recorded after the processing callback returns, so wait
+    // for the adjustment to land.
+    while (asbs_queue->adaptive_batch_timeout_micros() == 1000) {
+    }
+    // Over target: multiplicative backoff of both controlled values.
+    EXPECT_EQ(asbs_queue->adaptive_batch_timeout_micros(), 750);
+    EXPECT_EQ(asbs_queue->adaptive_max_batch_size(), 8);
+    start_teardown.Notify();
+  }
+  stop_teardown.Notify();
+}
+
 TEST(AdaptiveSharedBatchSchedulerTest, FullBatchSchedulingBoostMicros) {
   test_util::FakeClockEnv env(Env::Default());
   Notification start_teardown, stop_teardown;
@@ -495,9 +495,13 @@ absl::Status BatchResourceBase::RegisterInput(
     batch_components->request_cost = request_cost_accessor->GetRequestCost();
   }
 
+  string bucketed_queue_name = batcher_queue_name;
+  TF_RETURN_IF_ERROR(BucketAndPadInputs(context, &batch_components->inputs,
+                                        &bucketed_queue_name));
+
   BatcherQueueT* batcher_queue;
   TF_RETURN_IF_ERROR(LookupOrCreateBatcherQueue(
-      /* queue_name= */ batcher_queue_name,
+      /* queue_name= */ bucketed_queue_name,
       /* model_name= */ GetModelName(context),
       /* op_name= */ context->op_kernel().name(), /* queue= */ &batcher_queue));
 
@@ -517,6 +521,58 @@ absl::Status BatchResourceBase::RegisterInput(
   return batcher_queue->Schedule(&batch_components);
 }
 
+absl::Status BatchResourceBase::BucketAndPadInputs(OpKernelContext* context,
+                                                   std::vector<Tensor>* inputs,
+                                                   string* queue_name) {
+  if (bucket_boundaries_.empty()) return absl::OkStatus();
+  for (Tensor& input : *inputs) {
+    if (input.dims() < 2) {
+      // Inputs without a sequence dimension are batchable as-is and don't
+      // contribute to the bucket key.
+      continue;
+    }
+    const int64_t length = input.dim_size(1);
+    // The smallest boundary that fits this input; inputs longer than the
+    // largest boundary keep their exact length.
+    int64_t padded_length = length;
+    for (const int32 boundary : bucket_boundaries_) {
+      if (boundary >= length) {
+        padded_length = boundary;
+        break;
+      }
+    }
+    if (padded_length != length && DataTypeCanUseMemcpy(input.dtype())) {
+      TensorShape padded_shape = input.shape();
+      padded_shape.set_dim(1, padded_length);
+      Tensor padded;
+      AllocatorAttributes cpu_alloc;
+      cpu_alloc.set_on_host(true);
+      TF_RETURN_IF_ERROR(context->allocate_temp(input.dtype(), padded_shape,
+                                                &padded, cpu_alloc));
+      const size_t elem_size = DataTypeSize(input.dtype());
+      const int64_t inner_size = input.NumElements() == 0
+                                     ? 0
+                                     : input.NumElements() /
+                                           (input.dim_size(0) * length);
+      char* dst = const_cast<char*>(padded.tensor_data().data());
+      const char* src = input.tensor_data().data();
+      memset(dst, 0, padded.tensor_data().size());
+      const size_t src_row_bytes = length * inner_size * elem_size;
+      const size_t dst_row_bytes = padded_length * inner_size * elem_size;
+      for (int64_t i = 0; i < input.dim_size(0); ++i) {
+        memcpy(dst + i * dst_row_bytes, src + i * src_row_bytes, src_row_bytes);
+      }
+      input = padded;
+    }
+    // Non-memcpy dtypes (e.g. strings) still contribute their exact length to
+    // the key so they only batch with identically shaped peers.
+    absl::StrAppend(queue_name, "/len_",
+                    DataTypeCanUseMemcpy(input.dtype()) ? padded_length
+                                                        : length);
+  }
+  return absl::OkStatus();
+}
+
 /*static*/ BatchResourceBase::BatcherT::QueueOptions
 BatchResourceBase::GetBatcherQueueOptions(
     int32_t num_batch_threads, int32_t max_batch_size,
@@ -186,6 +186,18 @@ class BatchResourceBase : public ResourceBase {
 
   const SessionMetadata& session_metadata() const { return session_metadata_; }
 
+  // Enables bucketed batching by sequence length. When non-empty, each
+  // registered input tensor of rank >= 2 is zero-padded along dimension 1 up
+  // to the smallest boundary that fits it, and the request is routed to a
+  // batcher queue specific to the resulting lengths, so batches are always
+  // shape-homogeneous and padding overhead is bounded by the bucket widths.
+  // Inputs longer than the largest boundary are left unpadded and only batch
+  // with inputs of identical length. Must be called before the first
+  // RegisterInput; boundaries must be positive and strictly increasing.
+  void SetBucketBoundaries(std::vector<int32> bucket_boundaries) {
+    bucket_boundaries_ = std::move(bucket_boundaries);
+  }
+
   using CreateBatchTaskFn =
       std::function<StatusOr<std::unique_ptr<BatchTask>>()>;
 
@@ -346,6 +358,14 @@ class BatchResourceBase : public ResourceBase {
                                     const string& op_name,
                                     BatcherQueueT** queue);
 
+  // Implements bucketed batching (see SetBucketBoundaries): pads the rank >= 2
+  // tensors in 'inputs' along dimension 1 up to their bucket boundaries and
+  // appends the resulting lengths to '*queue_name' so that each combination of
+  // padded lengths batches in its own queue. No-op when bucket_boundaries_ is
+  // empty.
+  Status BucketAndPadInputs(OpKernelContext* context,
+                            std::vector<Tensor>* inputs, string* queue_name);
+
   SessionMetadata session_metadata_;
 
   absl::Mutex outstanding_batch_mu_;
@@ -372,6 +392,10 @@ class BatchResourceBase : public ResourceBase {
   // A concatenated string of <allowed_batch_sizes_>, separated by ",". This is
   // used to record batching parameter.
   string allowed_batch_sizes_str_;
+
+  // Sorted sequence-length bucket boundaries; empty means bucketed batching
+  // is disabled. See SetBucketBoundaries.
+  std::vector<int32> bucket_boundaries_;
 };
 
 }  // namespace serving
@@ -69,6 +69,23 @@ absl::Status Concat(OpKernelContext* context,
     output_dim0 += input.dim_size(0);
   }
 
+  // Zero-copy case: if a single input holds every row of the batch (a batch
+  // made of one request, possibly alongside zero-row entries), alias its
+  // buffer instead of copying. Large per-request tensors otherwise pay a full
+  // extra pass of memory traffic just to re-materialize themselves.
+  int64_t sole_nonempty = -1;
+  int num_nonempty = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (inputs[i].dim_size(0) > 0) {
+      sole_nonempty = i;
+      ++num_nonempty;
+    }
+  }
+  if (num_nonempty <= 1) {
+    *output = inputs[num_nonempty == 1 ? sole_nonempty : 0];
+    return absl::OkStatus();
+  }
+
   TensorShape output_shape(input_shape);
   output_shape.set_dim(0, output_dim0);
   AllocatorAttributes attr;
@@ -28,6 +28,15 @@ namespace tensorflow {
 // ElementCopier must be a struct with a single Copy function, which is passed
 // the output pointer, input pointer, input index, and number of elements to
 // copy from input to output.
+//
+// Above the single-threaded cutoff below, the flattened output is sharded
+// across the intra-op pool and each shard memcpy's a contiguous destination
+// range, so large concats already run as parallel copies. Finer placement
+// control — pinning a shard to the NUMA node that owns its destination range,
+// or using non-temporal stores for streaming copies — is deliberately not
+// attempted: shards run on whichever intra-op pool threads pick them up, and
+// the pool is shared by every kernel in the process, so per-shard thread
+// affinity would degrade unrelated ops scheduled on the same threads.
 template <typename T, typename ElementCopier>
 void ConcatCPUImpl(
     DeviceBase* d,
@@ -24,6 +24,9 @@ limitations under the License.
 
 #include "tensorflow/core/kernels/constant_op.h"
 
+#include <map>
+#include <tuple>
+
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/bounds_check.h"
@@ -37,9 +40,12 @@ limitations under the License.
 #include "tensorflow/core/framework/variant_op_registry.h"
 #include "tensorflow/core/graph/graph_node_util.h"
 #include "tensorflow/core/kernels/fill_functor.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/profiler/lib/scoped_memory_debug_annotation.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 
@@ -71,6 +77,77 @@ NodeDef StripTensorDataFromNodeDef(OpKernelConstruction* ctx) {
   return ret;
 }
 
+// Interns the tensors materialized by Const kernels so that kernels with
+// byte-identical `value` attrs on the same device share one tensor buffer
+// instead of each holding a private copy. Graphs commonly contain many Const
+// nodes with duplicated contents (e.g. replicated weights), so sharing can
+// reclaim a large amount of host and device memory. Entries are keyed by the
+// device instance and a fingerprint of the serialized proto, and are erased
+// once the last kernel holding them is destroyed. Sharing the buffer is safe
+// because the extra reference keeps consumers from forwarding or mutating it
+// in place. Opt-in via TF_ENABLE_CONST_TENSOR_INTERNING=true.
+class ConstTensorRegistry {
+ public:
+  static ConstTensorRegistry* Global() {
+    static ConstTensorRegistry* registry = new ConstTensorRegistry;
+    return registry;
+  }
+
+  static bool Enabled() {
+    static bool enabled = [] {
+      bool value = false;
+      TF_CHECK_OK(ReadBoolFromEnvVar("TF_ENABLE_CONST_TENSOR_INTERNING",
+                                     /*default_val=*/false, &value));
+      return value;
+    }();
+    return enabled;
+  }
+
+  // Returns the interned tensor for (device, fp) if present, acquiring a use
+  // that must be balanced by a Release.
+  bool Lookup(const DeviceBase* device, const Fprint128& fp, Tensor* out) {
+    mutex_lock l(mu_);
+    auto it = entries_.find(MakeKey(device, fp));
+    if (it == entries_.end()) return false;
+    ++it->second.uses;
+    *out = it->second.tensor;
+    return true;
+  }
+
+  // Interns `tensor` under (device, fp) and returns the canonical tensor:
+  // `tensor` itself, or a previously interned copy if another kernel raced us
+  // here first. Acquires a use that must be balanced by a Release.
+  Tensor Intern(const DeviceBase* device, const Fprint128& fp,
+                const Tensor& tensor) {
+    mutex_lock l(mu_);
+    Entry& entry = entries_[MakeKey(device, fp)];
+    if (entry.uses == 0) entry.tensor = tensor;
+    ++entry.uses;
+    return entry.tensor;
+  }
+
+  void Release(const DeviceBase* device, const Fprint128& fp) {
+    mutex_lock l(mu_);
+    auto it = entries_.find(MakeKey(device, fp));
+    if (it != entries_.end() && --it->second.uses == 0) entries_.erase(it);
+  }
+
+ private:
+  using Key = std::tuple<const DeviceBase*, uint64, uint64>;
+
+  static Key MakeKey(const DeviceBase* device, const Fprint128& fp) {
+    return Key(device, fp.low64, fp.high64);
+  }
+
+  struct Entry {
+    Tensor tensor;
+    int64_t uses = 0;
+  };
+
+  mutex mu_;
+  std::map<Key, Entry> entries_ TF_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 ConstantOp::ConstantOp(OpKernelConstruction* ctx)
@@ -79,8 +156,21 @@ ConstantOp::ConstantOp(OpKernelConstruction* ctx)
   const TensorProto* proto = nullptr;
   tsl::profiler::ScopedMemoryDebugAnnotation op_annotation(name_view().data());
   OP_REQUIRES_OK(ctx, ctx->GetAttr("value", &proto));
-  OP_REQUIRES_OK(ctx, ctx->device()->MakeTensorFromProto(
-                          *proto, AllocatorAttributes(), &tensor_));
+  if (ConstTensorRegistry::Enabled()) {
+    content_fingerprint_ = Fingerprint128(proto->SerializeAsString());
+    interned_device_ = ctx->device();
+    interned_ = ConstTensorRegistry::Global()->Lookup(
+        interned_device_, content_fingerprint_, &tensor_);
+  }
+  if (!interned_) {
+    OP_REQUIRES_OK(ctx, ctx->device()->MakeTensorFromProto(
+                            *proto, AllocatorAttributes(), &tensor_));
+    if (ConstTensorRegistry::Enabled()) {
+      tensor_ = ConstTensorRegistry::Global()->Intern(
+          interned_device_, content_fingerprint_, tensor_);
+      interned_ = true;
+    }
+  }
   OP_REQUIRES(
       ctx, ctx->output_type(0) == tensor_.dtype(),
       errors::InvalidArgument("Type mismatch between value (",
@@ -95,7 +185,12 @@ void ConstantOp::Compute(OpKernelContext* ctx) {
   }
 }
 
-ConstantOp::~ConstantOp() {}
+ConstantOp::~ConstantOp() {
+  if (interned_) {
+    ConstTensorRegistry::Global()->Release(interned_device_,
+                                           content_fingerprint_);
+  }
+}
 
 REGISTER_KERNEL_BUILDER(Name("Const").Device(DEVICE_CPU), ConstantOp);
 REGISTER_KERNEL_BUILDER(Name("Const").Device(DEVICE_TPU_SYSTEM), ConstantOp);
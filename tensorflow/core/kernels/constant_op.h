@@ -19,6 +19,7 @@ limitations under the License.
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/framework/tensor_types.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/macros.h"
 
 namespace tensorflow {
@@ -34,6 +35,12 @@ class ConstantOp : public OpKernel {
 
  private:
   Tensor tensor_;
+  // Set when `tensor_` was interned in the per-device constant registry (see
+  // TF_ENABLE_CONST_TENSOR_INTERNING); the registry entry is released in the
+  // destructor.
+  bool interned_ = false;
+  const DeviceBase* interned_device_ = nullptr;
+  Fprint128 content_fingerprint_ = {0, 0};
   ConstantOp(const ConstantOp&) = delete;
   void operator=(const ConstantOp&) = delete;
 };
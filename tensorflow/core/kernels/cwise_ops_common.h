@@ -102,8 +102,8 @@ class BinaryOp : public BinaryOpShared {
     bool error = false;
     bool* const error_ptr = Functor::has_errors ? &error : nullptr;
 
-    // NOTE: Handle three simple cases before building the BinaryOpState, which
-    // is relatively expensive for small operations.
+    // NOTE: Handle the common simple cases before building the BinaryOpState,
+    // which is relatively expensive for small operations.
     if (input_0.shape() == input_1.shape()) {
       // tensor op tensor with no broadcasting.
       Tensor* out;
@@ -144,6 +144,47 @@ class BinaryOp : public BinaryOpShared {
         SetComputeError(ctx);
       }
       return;
+    } else if (input_1.dims() == 1 && input_0.dims() > 1 &&
+               input_1.NumElements() == input_0.dim_size(input_0.dims() - 1) &&
+               input_1.NumElements() > 0) {
+      // tensor op vector, broadcasting along the inner dimension, e.g. a
+      // bias-style [..., C] op [C].  Dispatching directly to the rank-2
+      // broadcast functor skips the general BCast shape analysis, which for
+      // small tensors costs more than the math.
+      Tensor* out;
+      OP_REQUIRES_OK(ctx, ctx->forward_input_or_allocate_output(
+                              {0}, 0, input_0.shape(), &out));
+      const Eigen::DenseIndex cols = input_1.NumElements();
+      const Eigen::DenseIndex rows = input_0.NumElements() / cols;
+      const Eigen::array<Eigen::DenseIndex, 2> no_bcast = {1, 1};
+      const Eigen::array<Eigen::DenseIndex, 2> row_bcast = {rows, 1};
+      functor::BinaryFunctor<Device, Functor, 2>().BCast(
+          eigen_device, out->template shaped<Tout, 2>({rows, cols}),
+          input_0.template shaped<Tin, 2>({rows, cols}), no_bcast,
+          input_1.template shaped<Tin, 2>({1, cols}), row_bcast, error_ptr);
+      if (Functor::has_errors && error) {
+        SetComputeError(ctx);
+      }
+      return;
+    } else if (input_0.dims() == 1 && input_1.dims() > 1 &&
+               input_0.NumElements() == input_1.dim_size(input_1.dims() - 1) &&
+               input_0.NumElements() > 0) {
+      // vector op tensor, the mirror of the case above.
+      Tensor* out;
+      OP_REQUIRES_OK(ctx, ctx->forward_input_or_allocate_output(
+                              {1}, 0, input_1.shape(), &out));
+      const Eigen::DenseIndex cols = input_0.NumElements();
+      const Eigen::DenseIndex rows = input_1.NumElements() / cols;
+      const Eigen::array<Eigen::DenseIndex, 2> no_bcast = {1, 1};
+      const Eigen::array<Eigen::DenseIndex, 2> row_bcast = {rows, 1};
+      functor::BinaryFunctor<Device, Functor, 2>().BCast(
+          eigen_device, out->template shaped<Tout, 2>({rows, cols}),
+          input_0.template shaped<Tin, 2>({1, cols}), row_bcast,
+          input_1.template shaped<Tin, 2>({rows, cols}), no_bcast, error_ptr);
+      if (Functor::has_errors && error) {
+        SetComputeError(ctx);
+      }
+      return;
     }
 
     // 'state': Shared helper not dependent on T to reduce code size
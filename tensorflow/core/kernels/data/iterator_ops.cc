@@ -934,6 +934,12 @@ absl::Status IteratorGetNextOp::DoCompute(OpKernelContext* ctx) {
   tensorflow::ResourceTagger tag(kTFDataResourceTag,
                                  ctx->op_kernel().type_string());
   metrics::RecordTFDataFetchOp("IteratorGetNextOp");
+  if (ctx->IsDeadlineExceeded()) {
+    // The caller has already timed out; don't start producing an element it
+    // will never consume.
+    return errors::DeadlineExceeded(
+        "Session deadline exceeded before fetching the next element");
+  }
   IteratorResource* iterator;
   TF_RETURN_IF_ERROR(LookupResource(ctx, HandleFromInput(ctx, 0), &iterator));
   core::ScopedUnref unref_iterator(iterator);
@@ -989,6 +995,12 @@ absl::Status IteratorGetNextAsOptionalOp::DoCompute(OpKernelContext* ctx) {
   tensorflow::ResourceTagger tag(kTFDataResourceTag,
                                  ctx->op_kernel().type_string());
   metrics::RecordTFDataFetchOp("IteratorGetNextAsOptionalOp");
+  if (ctx->IsDeadlineExceeded()) {
+    // The caller has already timed out; don't start producing an element it
+    // will never consume.
+    return errors::DeadlineExceeded(
+        "Session deadline exceeded before fetching the next element");
+  }
   IteratorResource* iterator;
   TF_RETURN_IF_ERROR(LookupResource(ctx, HandleFromInput(ctx, 0), &iterator));
   core::ScopedUnref unref_iterator(iterator);
@@ -956,6 +956,7 @@ class ParallelInterleaveDatasetOp::Dataset : public DatasetBase {
       while (true) {
         int element_index;
         element.reset();
+        std::shared_ptr<Element> stolen_element;
         // Find an element to process.
         {
           mutex_lock l(*mu_);
@@ -980,6 +981,25 @@ class ParallelInterleaveDatasetOp::Dataset : public DatasetBase {
             if (element) {
               break;
             }
+            // No current element needs this worker. Rather than idling while
+            // a slow element gates the cycle, steal the future workers' job
+            // and pre-fill an element beyond the cycle, so that stragglers
+            // do not leave the rest of the pool idle. The existing
+            // `prefetch_input_elements_` limit bounds the lookahead, and
+            // output determinism is unaffected since consumption order is
+            // decided by the cycle, not by who produced the results.
+            if (!wait_for_checkpoint_ &&
+                future_elements_.size() <
+                    dataset()->prefetch_input_elements_) {
+              stolen_element = MakeElement(ctx.get());
+              if (stolen_element) {
+                VLOG(3) << "Current worker stole ahead to process "
+                        << stolen_element->id;
+                stolen_element->active = true;
+                future_elements_.push_back(stolen_element);
+                break;
+              }
+            }
             DecrementCurrentActiveWorkers();
             WaitWorkerThread(ctx.get(), &current_workers_cond_var_, &l);
             IncrementCurrentActiveWorkers();
@@ -988,8 +1008,26 @@ class ParallelInterleaveDatasetOp::Dataset : public DatasetBase {
             done();
             return;
           }
-          VLOG(3) << "Current worker woke up to process " << element->id;
-          element->active = true;
+          if (element) {
+            VLOG(3) << "Current worker woke up to process " << element->id;
+            element->active = true;
+          }
+        }
+        if (stolen_element) {
+          // Mirrors the future worker's handling of an element: process it
+          // outside the lock, then release it (and hand it to a current
+          // worker if it was promoted into the cycle in the meantime).
+          ProcessElement(ctx.get(), stolen_element);
+          {
+            mutex_lock l(*mu_);
+            stolen_element->active = false;
+            if (stolen_element->cycle_index != -1) {
+              stolen_element->cond_var.notify_one();
+              elements_to_process_.push_back(stolen_element->cycle_index);
+              current_workers_cond_var_.notify_one();
+            }
+          }
+          continue;
         }
         // Loop on the element until we fill its results buffer or reach end of
         // input for the element.
@@ -25,6 +25,7 @@ limitations under the License.
 #include <vector>
 
 #include "absl/base/call_once.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "tensorflow/core/common_runtime/function.h"
@@ -33,6 +34,7 @@ limitations under the License.
 #include "tensorflow/core/data/name_utils.h"
 #include "tensorflow/core/data/stats_utils.h"
 #include "tensorflow/core/data/unbounded_thread_pool.h"
+#include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/dataset.h"
 #include "tensorflow/core/framework/metrics.h"
 #include "tensorflow/core/framework/model.h"
@@ -47,6 +49,7 @@ limitations under the License.
 #include "tensorflow/core/profiler/lib/traceme.h"
 #include "tensorflow/core/profiler/lib/traceme_encode.h"
 #include "tensorflow/core/protobuf/error_codes.pb.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tsl/platform/logging.h"
 
 namespace tensorflow {
@@ -92,6 +95,121 @@ constexpr int kStatsReportingPeriodMillis = 1000;
 // large values for the parallelism, e.g. creating 300k threads.
 constexpr int kUnboundedThreadpoolAutotuningFactor = 10;
 
+// Determines whether parallel map invocations allocate small short-lived
+// tensors from a recycled scratch pool instead of the global allocator.
+bool ScratchPoolEnabled() {
+  static bool result = [] {
+    bool enabled = false;
+    TF_CHECK_OK(ReadBoolFromEnvVar("TF_DATA_PARALLEL_MAP_SCRATCH_ARENA",
+                                   /*default_val=*/false, &enabled));
+    return enabled;
+  }();
+  return result;
+}
+
+// An allocator that recycles small allocations through per-size-class free
+// lists, backed by `base` for cache misses and anything too large or too
+// aligned to pool. Chunks are returned to the free lists on deallocation
+// rather than en masse, so tensors allocated from the pool may safely outlive
+// the function invocation that produced them.
+class ScratchPoolAllocator : public Allocator {
+ public:
+  explicit ScratchPoolAllocator(Allocator* base)
+      : base_(base), free_lists_(kNumSizeClasses) {}
+
+  std::string Name() override { return "tf_data_parallel_map_scratch"; }
+
+  void* AllocateRaw(size_t alignment, size_t num_bytes) override {
+    if (alignment > kAllocatorAlignment || num_bytes > kMaxPooledBytes) {
+      return base_->AllocateRaw(alignment, num_bytes);
+    }
+    const int size_class = SizeClass(num_bytes);
+    {
+      mutex_lock l(mu_);
+      if (!free_lists_[size_class].empty()) {
+        void* chunk = free_lists_[size_class].back();
+        free_lists_[size_class].pop_back();
+        return chunk;
+      }
+    }
+    void* chunk =
+        base_->AllocateRaw(kAllocatorAlignment, ClassBytes(size_class));
+    if (chunk != nullptr) {
+      mutex_lock l(mu_);
+      pooled_chunks_[chunk] = size_class;
+    }
+    return chunk;
+  }
+
+  void DeallocateRaw(void* ptr) override {
+    {
+      mutex_lock l(mu_);
+      auto it = pooled_chunks_.find(ptr);
+      if (it != pooled_chunks_.end()) {
+        if (free_lists_[it->second].size() < kMaxChunksPerClass) {
+          free_lists_[it->second].push_back(ptr);
+          return;
+        }
+        pooled_chunks_.erase(it);
+      }
+    }
+    // Either `ptr` came straight from `base_` or its size class is full.
+    base_->DeallocateRaw(ptr);
+  }
+
+ private:
+  // Pooled chunk sizes are powers of two between 2^kMinSizeClassLog2 (64
+  // bytes, one cache line) and 2^kMaxSizeClassLog2 (64 KiB).
+  static constexpr int kMinSizeClassLog2 = 6;
+  static constexpr int kMaxSizeClassLog2 = 16;
+  static constexpr int kNumSizeClasses =
+      kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+  static constexpr size_t kMaxPooledBytes = size_t{1} << kMaxSizeClassLog2;
+  // Bounds the memory retained per size class (at most ~16 MiB in total).
+  static constexpr size_t kMaxChunksPerClass = 256;
+
+  static int SizeClass(size_t num_bytes) {
+    int size_class = 0;
+    while (ClassBytes(size_class) < num_bytes) {
+      ++size_class;
+    }
+    return size_class;
+  }
+
+  static constexpr size_t ClassBytes(int size_class) {
+    return size_t{1} << (kMinSizeClassLog2 + size_class);
+  }
+
+  Allocator* const base_;
+  mutex mu_;
+  std::vector<std::vector<void*>> free_lists_ TF_GUARDED_BY(mu_);
+  absl::flat_hash_map<void*, int> pooled_chunks_ TF_GUARDED_BY(mu_);
+};
+
+// Returns the process-wide scratch pool. The pool is never destroyed because
+// tensors allocated from it may outlive any individual iterator.
+Allocator* ScratchPool() {
+  static ScratchPoolAllocator* pool =
+      new ScratchPoolAllocator(cpu_allocator());
+  return pool;
+}
+
+// Returns a copy of `ctx` whose default-attribute allocator is the scratch
+// pool, so that small tensors materialized while producing map inputs and
+// outputs are recycled instead of hitting the global allocator.
+IteratorContext WithScratchPool(IteratorContext* ctx) {
+  IteratorContext::Params params(ctx);
+  auto base_getter = params.allocator_getter;
+  params.allocator_getter =
+      [base_getter](AllocatorAttributes attrs) -> Allocator* {
+    if (attrs.value != 0) {
+      return base_getter ? base_getter(attrs) : cpu_allocator();
+    }
+    return ScratchPool();
+  };
+  return IteratorContext(std::move(params));
+}
+
 }  // namespace
 
 class ParallelMapDatasetOp::Dataset : public DatasetBase {
@@ -521,7 +639,10 @@ class ParallelMapDatasetOp::Dataset : public DatasetBase {
     void EnsureThreadsStarted(IteratorContext* ctx)
         TF_EXCLUSIVE_LOCKS_REQUIRED(*mu_) {
       if (!runner_thread_) {
-        auto ctx_copy = std::make_shared<IteratorContext>(*ctx);
+        auto ctx_copy = ScratchPoolEnabled()
+                            ? std::make_shared<IteratorContext>(
+                                  WithScratchPool(ctx))
+                            : std::make_shared<IteratorContext>(*ctx);
         runner_thread_ = ctx->StartThread(
             "tf_data_parallel_map",
             std::bind(&Iterator::RunnerThread, this, ctx_copy));
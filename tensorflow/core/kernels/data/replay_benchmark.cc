@@ -0,0 +1,213 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Replays GetNext against a tf.data replay artifact captured with
+// tensorflow/core/data/replay_utils.h and reports throughput, latency
+// percentiles, and (optionally) the final autotune model, so a slow
+// production input pipeline can be analyzed offline without the full job.
+//
+// By default the captured dataset graph is executed. If the graph cannot run
+// (e.g. its input files are not accessible offline), pass --replay_elements
+// to measure reading the captured element window from the artifact instead.
+//
+// Usage:
+//   replay_benchmark --artifact_dir=/path/to/artifact \
+//       [--num_elements=-1] [--replay_elements] [--model_output=/tmp/m.pbtxt]
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/core/data/replay_utils.h"
+#include "tensorflow/core/data/standalone.h"
+#include "tensorflow/core/framework/graph.pb.h"
+#include "tensorflow/core/framework/model.h"
+#include "tensorflow/core/framework/model.pb.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/env_time.h"
+#include "tensorflow/core/platform/init_main.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/util/command_line_flags.h"
+
+namespace tensorflow {
+namespace data {
+namespace {
+
+struct ReplayStats {
+  int64_t num_elements = 0;
+  int64_t total_bytes = 0;
+  uint64 elapsed_micros = 0;
+  std::vector<uint64> latencies_micros;
+};
+
+uint64 Percentile(std::vector<uint64>* latencies, double percentile) {
+  if (latencies->empty()) return 0;
+  std::sort(latencies->begin(), latencies->end());
+  size_t index = static_cast<size_t>(percentile * (latencies->size() - 1));
+  return (*latencies)[index];
+}
+
+void ReportStats(const ReplayStats& stats) {
+  const double seconds = stats.elapsed_micros / 1e6;
+  LOG(INFO) << "Replayed " << stats.num_elements << " elements ("
+            << stats.total_bytes << " bytes) in " << seconds << "s";
+  if (seconds > 0) {
+    LOG(INFO) << "Throughput: " << stats.num_elements / seconds
+              << " elements/s, " << stats.total_bytes / seconds / 1e6
+              << " MB/s";
+  }
+  std::vector<uint64> latencies = stats.latencies_micros;
+  LOG(INFO) << "GetNext latency (us): p50=" << Percentile(&latencies, 0.5)
+            << " p90=" << Percentile(&latencies, 0.9)
+            << " p99=" << Percentile(&latencies, 0.99);
+}
+
+int64_t ElementBytes(const std::vector<Tensor>& element) {
+  int64_t bytes = 0;
+  for (const Tensor& component : element) {
+    bytes += component.TotalBytes();
+  }
+  return bytes;
+}
+
+int ReplayGraph(Env* env, const std::string& artifact_dir,
+                int64_t num_elements, const std::string& model_output) {
+  GraphDef dataset_graph;
+  absl::Status s =
+      ReadReplayArtifactGraph(env, artifact_dir, &dataset_graph);
+  if (!s.ok()) {
+    LOG(ERROR) << "Failed to read dataset graph: " << s;
+    return 1;
+  }
+
+  standalone::Dataset::Params params;
+  std::unique_ptr<standalone::Dataset> dataset;
+  s = standalone::Dataset::FromGraph(params, dataset_graph, &dataset);
+  if (!s.ok()) {
+    LOG(ERROR) << "Failed to instantiate dataset (if its inputs are not "
+                  "accessible offline, rerun with --replay_elements): "
+               << s;
+    return 1;
+  }
+  std::unique_ptr<standalone::Iterator> iterator;
+  s = dataset->MakeIterator(&iterator);
+  if (!s.ok()) {
+    LOG(ERROR) << "Failed to create iterator: " << s;
+    return 1;
+  }
+
+  ReplayStats stats;
+  const uint64 start_micros = EnvTime::NowMicros();
+  while (num_elements < 0 || stats.num_elements < num_elements) {
+    std::vector<Tensor> element;
+    bool end_of_input = false;
+    const uint64 get_next_start_micros = EnvTime::NowMicros();
+    s = iterator->GetNext(&element, &end_of_input);
+    if (!s.ok()) {
+      LOG(ERROR) << "GetNext failed: " << s;
+      return 1;
+    }
+    if (end_of_input) break;
+    stats.latencies_micros.push_back(EnvTime::NowMicros() -
+                                     get_next_start_micros);
+    stats.num_elements++;
+    stats.total_bytes += ElementBytes(element);
+  }
+  stats.elapsed_micros = EnvTime::NowMicros() - start_micros;
+  ReportStats(stats);
+
+  if (std::shared_ptr<model::Model> model = iterator->model()) {
+    model::ModelProto model_proto;
+    s = model->ToProto(&model_proto);
+    if (!s.ok()) {
+      LOG(ERROR) << "Failed to serialize autotune model: " << s;
+      return 1;
+    }
+    if (!model_output.empty()) {
+      s = WriteTextProto(env, model_output, model_proto);
+      if (!s.ok()) {
+        LOG(ERROR) << "Failed to write autotune model: " << s;
+        return 1;
+      }
+      LOG(INFO) << "Wrote autotune model to " << model_output;
+    } else {
+      LOG(INFO) << "Autotune model tracks " << model_proto.nodes_size()
+                << " nodes (pass --model_output to dump it)";
+    }
+  } else {
+    LOG(INFO) << "No autotune model available (autotuning disabled).";
+  }
+  return 0;
+}
+
+int ReplayElements(Env* env, const std::string& artifact_dir,
+                   int64_t num_elements) {
+  ReplayStats stats;
+  const uint64 start_micros = EnvTime::NowMicros();
+  std::vector<std::vector<Tensor>> elements;
+  absl::Status s = ReadReplayArtifactElements(env, artifact_dir, &elements);
+  if (!s.ok()) {
+    LOG(ERROR) << "Failed to read captured elements: " << s;
+    return 1;
+  }
+  for (const std::vector<Tensor>& element : elements) {
+    if (num_elements >= 0 && stats.num_elements >= num_elements) break;
+    stats.num_elements++;
+    stats.total_bytes += ElementBytes(element);
+  }
+  stats.elapsed_micros = EnvTime::NowMicros() - start_micros;
+  ReportStats(stats);
+  return 0;
+}
+
+}  // namespace
+}  // namespace data
+}  // namespace tensorflow
+
+int main(int argc, char** argv) {
+  std::string artifact_dir;
+  tensorflow::int64 num_elements = -1;
+  bool replay_elements = false;
+  std::string model_output;
+  std::vector<tensorflow::Flag> flag_list = {
+      tensorflow::Flag("artifact_dir", &artifact_dir,
+                       "Directory holding the replay artifact."),
+      tensorflow::Flag("num_elements", &num_elements,
+                       "Number of elements to replay; -1 replays until end "
+                       "of input."),
+      tensorflow::Flag("replay_elements", &replay_elements,
+                       "Replay the captured element window instead of "
+                       "executing the dataset graph."),
+      tensorflow::Flag("model_output", &model_output,
+                       "If set, the final autotune model is written to this "
+                       "file as a text proto."),
+  };
+  const std::string usage = tensorflow::Flags::Usage(argv[0], flag_list);
+  if (!tensorflow::Flags::Parse(&argc, argv, flag_list) ||
+      artifact_dir.empty()) {
+    LOG(QFATAL) << usage;
+  }
+  tensorflow::port::InitMain(argv[0], &argc, &argv);
+
+  tensorflow::Env* env = tensorflow::Env::Default();
+  if (replay_elements) {
+    return tensorflow::data::ReplayElements(env, artifact_dir, num_elements);
+  }
+  return tensorflow::data::ReplayGraph(env, artifact_dir, num_elements,
+                                       model_output);
+}
@@ -39,6 +39,7 @@ limitations under the License.
 #include "tensorflow/core/lib/random/random_distributions.h"
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/platform/stringprintf.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 namespace data {
@@ -65,6 +66,10 @@ const int64_t kLogIntervalMicros = 10 * 1000000;  // 10 seconds.
 const int64_t kMaxEpochsInBuffer = 3;
 
 constexpr char kNumRandomSamples[] = "num_random_samples";
+constexpr char kReservoirCheckpoint[] = "reservoir_checkpoint";
+constexpr char kInitialEpochNumRandomSamples[] =
+    "initial_epoch_num_random_samples";
+constexpr char kNumProduced[] = "num_produced";
 constexpr char kDataProduced[] = "data_produced";
 constexpr char kEndOfInputSequence[] = "end_of_input_sequence";
 constexpr char kEpoch[] = "epoch";
@@ -81,6 +86,20 @@ constexpr char kShuffleDatasetV3[] = "ShuffleDatasetV3";
 constexpr char kShuffleAndRepeatDatasetV1[] = "ShuffleAndRepeatDataset";
 constexpr char kShuffleAndRepeatDatasetV2[] = "ShuffleAndRepeatDatasetV2";
 
+// Determines whether shuffle checkpoints contain only the RNG state and
+// element cursors instead of the full buffer contents. The buffer is then
+// reconstructed on restore by replaying the input, which requires the input
+// to produce elements deterministically.
+bool ReservoirCheckpointEnabled() {
+  static bool result = [] {
+    bool enabled = false;
+    TF_CHECK_OK(ReadBoolFromEnvVar("TF_DATA_SHUFFLE_RESERVOIR_CHECKPOINT",
+                                   /*default_val=*/false, &enabled));
+    return enabled;
+  }();
+  return result;
+}
+
 ShuffleDatasetOpBase::ShuffleDatasetOpBase(OpKernelConstruction* ctx)
     : UnaryDatasetOpKernel(ctx) {}
 
@@ -204,6 +223,9 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
 
     absl::Status Initialize(IteratorContext* ctx) override {
       mutex_lock l(mu_);
+      // Remember where this iterator started consuming the seed generator so
+      // that a reservoir restore can rewind it and replay the iteration.
+      initial_epoch_num_random_samples_ = seed_generator_->num_random_samples();
       seed_generator_->GenerateSeeds(&seed_, &seed2_);
       ResetRngs();
       // Initialize checkpoint_indices_ to the entire buffer.
@@ -219,6 +241,13 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
                                  std::vector<Tensor>* out_tensors,
                                  bool* end_of_sequence) override {
       mutex_lock l(mu_);
+      return GetNextLocked(ctx, out_tensors, end_of_sequence);
+    }
+
+    absl::Status GetNextLocked(IteratorContext* ctx,
+                               std::vector<Tensor>* out_tensors,
+                               bool* end_of_sequence)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
       TF_RETURN_IF_ERROR(FillBuffer(ctx));
       if (num_elements_ == 0) {
         DCHECK(input_impl_ == nullptr);
@@ -242,6 +271,7 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
       checkpoint_indices_.insert(slices_.front()->start % buffer_->size());
       slices_.front()->start++;
       num_elements_--;
+      num_produced_++;
       return absl::OkStatus();
     }
 
@@ -272,6 +302,21 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
       TF_RETURN_IF_ERROR(writer->WriteScalar(prefix(), kSeed, seed_));
       TF_RETURN_IF_ERROR(writer->WriteScalar(prefix(), kSeed2, seed2_));
 
+      if (ReservoirCheckpointEnabled() && !ctx->symbolic_checkpoint()) {
+        // Reservoir mode: checkpoint only the RNG state and element cursors.
+        // The buffer (and the input iterator position) is reconstructed on
+        // restore by rewinding the seed generator and replaying the input
+        // from the start of the iteration.
+        TF_RETURN_IF_ERROR(
+            writer->WriteScalar(prefix(), kReservoirCheckpoint, ""));
+        TF_RETURN_IF_ERROR(
+            writer->WriteScalar(prefix(), kInitialEpochNumRandomSamples,
+                                initial_epoch_num_random_samples_));
+        TF_RETURN_IF_ERROR(
+            writer->WriteScalar(prefix(), kNumProduced, num_produced_));
+        return absl::OkStatus();
+      }
+
       // Save input iterator if it hasn't been exhausted else write
       // "end_of_input_sequence".
       TF_RETURN_IF_ERROR(writer->WriteScalar(
@@ -323,6 +368,9 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
     absl::Status RestoreInternal(IteratorContext* ctx,
                                  IteratorStateReader* reader) override {
       mutex_lock l(mu_);
+      if (reader->Contains(prefix(), kReservoirCheckpoint)) {
+        return RestoreFromReservoirCheckpoint(ctx, reader);
+      }
       // Restore the random number generators.
       int64_t num_random_samples;
       TF_RETURN_IF_ERROR(reader->ReadScalar(prefix(), kEpochNumRandomSamples,
@@ -397,6 +445,70 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
       return absl::OkStatus();
     }
 
+    // Rebuilds the buffer from a reservoir checkpoint by rewinding the seed
+    // generator to where this iterator started and re-running the iteration,
+    // discarding the first `num_produced` elements. The random choices and
+    // buffer insertions are re-applied in their original order, so this
+    // converges to exactly the saved state as long as the input produces
+    // elements deterministically.
+    absl::Status RestoreFromReservoirCheckpoint(IteratorContext* ctx,
+                                                IteratorStateReader* reader)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      int64_t epoch_num_random_samples;
+      TF_RETURN_IF_ERROR(reader->ReadScalar(prefix(), kEpochNumRandomSamples,
+                                            &epoch_num_random_samples));
+      TF_RETURN_IF_ERROR(
+          reader->ReadScalar(prefix(), kInitialEpochNumRandomSamples,
+                             &initial_epoch_num_random_samples_));
+      int64_t num_produced;
+      TF_RETURN_IF_ERROR(
+          reader->ReadScalar(prefix(), kNumProduced, &num_produced));
+
+      // Reset to the state this iterator was in right after `Initialize()`.
+      if (IsShuffleAll()) {
+        buffer_ = std::make_unique<std::vector<std::vector<Tensor>>>();
+      } else {
+        buffer_ = std::make_unique<std::vector<std::vector<Tensor>>>(
+            dataset()->buffer_size_);
+      }
+      slices_.clear();
+      checkpoint_indices_.clear();
+      input_impl_.reset();
+      epoch_ = 0;
+      num_elements_ = 0;
+      num_produced_ = 0;
+      num_random_samples_ = 0;
+      data_produced_ = false;
+      seed_generator_->set_num_random_samples(
+          initial_epoch_num_random_samples_);
+      seed_generator_->Reset();
+      seed_generator_->GenerateSeeds(&seed_, &seed2_);
+      ResetRngs();
+
+      while (num_produced_ < num_produced) {
+        std::vector<Tensor> discarded;
+        bool end_of_sequence = false;
+        TF_RETURN_IF_ERROR(GetNextLocked(ctx, &discarded, &end_of_sequence));
+        if (end_of_sequence) {
+          return errors::DataLoss(
+              "The input ended after ", num_produced_, " of ", num_produced,
+              " elements while replaying a reservoir shuffle checkpoint. "
+              "Reservoir checkpointing requires the input to produce "
+              "elements deterministically.");
+        }
+      }
+      if (seed_generator_->num_random_samples() != epoch_num_random_samples) {
+        return errors::DataLoss(
+            "Replaying a reservoir shuffle checkpoint diverged from the "
+            "saved iteration: the seed generator consumed ",
+            seed_generator_->num_random_samples(),
+            " samples instead of ", epoch_num_random_samples,
+            ". Reservoir checkpointing requires the input to produce "
+            "elements deterministically.");
+      }
+      return absl::OkStatus();
+    }
+
     TraceMeMetadata GetTraceMeMetadata() const override {
       return this->dataset()->traceme_metadata_;
     }
@@ -580,6 +692,12 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
     random::SingleSampleAdapter<random::PhiloxRandom> generator_
         TF_GUARDED_BY(mu_);
     int64_t num_random_samples_ TF_GUARDED_BY(mu_) = 0;
+    // Number of samples the seed generator had produced when this iterator
+    // was initialized, and the number of elements this iterator has produced.
+    // Together with the RNG state, these are sufficient to reconstruct the
+    // buffer from a reservoir checkpoint by replaying the input.
+    int64_t initial_epoch_num_random_samples_ TF_GUARDED_BY(mu_) = 0;
+    int64_t num_produced_ TF_GUARDED_BY(mu_) = 0;
     bool data_produced_ TF_GUARDED_BY(mu_) = false;
   };
 
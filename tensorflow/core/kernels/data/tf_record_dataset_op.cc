@@ -15,12 +15,16 @@ limitations under the License.
 #include "tensorflow/core/kernels/data/tf_record_dataset_op.h"
 
 #include <cstdint>
+#include <cstring>
 
 #include "tensorflow/core/data/name_utils.h"
 #include "tensorflow/core/data/utils.h"
+#include "tensorflow/core/framework/allocation_description.pb.h"
 #include "tensorflow/core/framework/metrics.h"
 #include "tensorflow/core/framework/partial_tensor_shape.h"
 #include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/coding.h"
+#include "tensorflow/core/lib/hash/crc32c.h"
 #include "tensorflow/core/lib/io/buffered_inputstream.h"
 #include "tensorflow/core/lib/io/inputbuffer.h"
 #include "tensorflow/core/lib/io/random_inputstream.h"
@@ -28,6 +32,8 @@ limitations under the License.
 #include "tensorflow/core/lib/io/zlib_compression_options.h"
 #include "tensorflow/core/lib/io/zlib_inputstream.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/refcount.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tsl/profiler/lib/traceme.h"
 
 namespace tensorflow {
@@ -52,6 +58,10 @@ constexpr int64_t kDefaultBufferSize = 256LL << 10;  // 256KB
 constexpr int64_t kCloudTpuBlockSize = 127LL << 20;  // 127MB.
 constexpr int64_t kS3BlockSize = kCloudTpuBlockSize;
 
+// Size of the file chunks slurped in zero-copy block-read mode; large enough
+// to amortize one allocation and one filesystem read over many records.
+constexpr uint64_t kZeroCopyBlockSize = 4LL << 20;  // 4MB
+
 bool is_cloud_tpu_gcs_fs() {
 #if (defined(PLATFORM_CLOUD_TPU) && defined(TPU_GCS_FS)) || \
     defined(LIBTPU_ON_GCE)
@@ -60,6 +70,66 @@ bool is_cloud_tpu_gcs_fs() {
   return false;
 }
 
+namespace {
+
+// Returns true if TFRecord files should be read in multi-MB blocks with
+// record tensors aliasing the block instead of owning a copy. Off by default:
+// a block stays resident until every record viewing it has been destroyed, so
+// pipelines that retain individual records for a long time trade memory for
+// the saved per-record allocations.
+bool ZeroCopyReadsEnabled() {
+  static const bool enabled = [] {
+    bool b = false;
+    TF_CHECK_OK(ReadBoolFromEnvVar("TF_DATA_TFRECORD_ZERO_COPY_READS",
+                                   /*default_val=*/false, &b));
+    return b;
+  }();
+  return enabled;
+}
+
+// A refcounted chunk of raw file bytes shared by all record tensors that view
+// into it.
+class RecordBlock : public core::RefCounted {
+ public:
+  explicit RecordBlock(size_t size) : data_(new char[size]) {}
+  ~RecordBlock() override { delete[] data_; }
+
+  char* data() const { return data_; }
+
+ private:
+  char* const data_;
+};
+
+// Backing buffer for a scalar DT_STRING tensor whose tstring is a view into a
+// shared RecordBlock: producing the record costs no string copy or
+// variable-size allocation, and the block is released once the last tensor
+// viewing it goes away.
+class RecordViewTensorBuffer : public TensorBuffer {
+ public:
+  RecordViewTensorBuffer(RecordBlock* block, const char* data, size_t size)
+      : TensorBuffer(&str_), block_(block) {
+    block_->Ref();
+    str_.assign_as_view(data, size);
+  }
+
+  ~RecordViewTensorBuffer() override { block_->Unref(); }
+
+  size_t size() const override { return sizeof(tstring); }
+
+  TensorBuffer* root_buffer() override { return this; }
+
+  void FillAllocationDescription(AllocationDescription* proto) const override {
+    proto->set_requested_bytes(sizeof(tstring));
+    proto->set_allocated_bytes(sizeof(tstring));
+  }
+
+ private:
+  tstring str_;
+  RecordBlock* const block_;
+};
+
+}  // namespace
+
 class TFRecordDatasetOp::Dataset : public DatasetBase {
  public:
   explicit Dataset(OpKernelContext* ctx, std::vector<string> filenames,
@@ -132,6 +202,10 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
     explicit Iterator(const Params& params)
         : DatasetIterator<Dataset>(params) {}
 
+    ~Iterator() override {
+      if (block_ != nullptr) block_->Unref();
+    }
+
     bool SymbolicCheckpointCompatible() const override { return true; }
 
     absl::Status GetNextInternal(IteratorContext* ctx,
@@ -141,20 +215,33 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
       mutex_lock l(mu_);
       do {
         // We are currently processing a file, so try to read the next record.
-        if (reader_) {
-          out_tensors->emplace_back(ctx->allocator({}), DT_STRING,
-                                    TensorShape({}));
-          absl::Status s =
-              reader_->ReadRecord(&out_tensors->back().scalar<tstring>()());
-          if (s.ok()) {
-            static monitoring::CounterCell* bytes_counter =
-                metrics::GetTFDataBytesReadCounter(kDatasetType);
-            bytes_counter->IncrementBy(
-                out_tensors->back().scalar<tstring>()().size());
-            *end_of_sequence = false;
-            return absl::OkStatus();
+        if (reader_ || zero_copy_) {
+          absl::Status s;
+          if (zero_copy_) {
+            Tensor record;
+            s = ReadRecordFromBlockLocked(&record);
+            if (s.ok()) {
+              static monitoring::CounterCell* bytes_counter =
+                  metrics::GetTFDataBytesReadCounter(kDatasetType);
+              bytes_counter->IncrementBy(record.scalar<tstring>()().size());
+              out_tensors->push_back(std::move(record));
+              *end_of_sequence = false;
+              return absl::OkStatus();
+            }
+          } else {
+            out_tensors->emplace_back(ctx->allocator({}), DT_STRING,
+                                      TensorShape({}));
+            s = reader_->ReadRecord(&out_tensors->back().scalar<tstring>()());
+            if (s.ok()) {
+              static monitoring::CounterCell* bytes_counter =
+                  metrics::GetTFDataBytesReadCounter(kDatasetType);
+              bytes_counter->IncrementBy(
+                  out_tensors->back().scalar<tstring>()().size());
+              *end_of_sequence = false;
+              return absl::OkStatus();
+            }
+            out_tensors->pop_back();
           }
-          out_tensors->pop_back();
           if (!errors::IsOutOfRange(s)) {
             // In case of other errors e.g., DataLoss, we still move forward
             // the file index so that it works with ignore_errors.
@@ -188,10 +275,16 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
       do {
         // We are currently processing a file, so try to skip reading
         // the next (num_to_skip - *num_skipped) record.
-        if (reader_) {
+        if (reader_ || zero_copy_) {
           int last_num_skipped;
-          absl::Status s = reader_->SkipRecords(num_to_skip - *num_skipped,
-                                                &last_num_skipped);
+          absl::Status s;
+          if (zero_copy_) {
+            s = SkipRecordsFromBlockLocked(num_to_skip - *num_skipped,
+                                           &last_num_skipped);
+          } else {
+            s = reader_->SkipRecords(num_to_skip - *num_skipped,
+                                     &last_num_skipped);
+          }
           *num_skipped += last_num_skipped;
           if (s.ok()) {
             *end_of_sequence = false;
@@ -237,6 +330,9 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
       if (reader_) {
         TF_RETURN_IF_ERROR(
             writer->WriteScalar(prefix(), kOffset, reader_->TellOffset()));
+      } else if (zero_copy_) {
+        TF_RETURN_IF_ERROR(writer->WriteScalar(prefix(), kOffset,
+                                               block_offset_ + block_pos_));
       }
       return absl::OkStatus();
     }
@@ -253,7 +349,13 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
         int64_t offset;
         TF_RETURN_IF_ERROR(reader->ReadScalar(prefix(), kOffset, &offset));
         TF_RETURN_IF_ERROR(SetupStreamsLocked(ctx->env()));
-        TF_RETURN_IF_ERROR(reader_->SeekOffset(offset));
+        if (reader_) {
+          TF_RETURN_IF_ERROR(reader_->SeekOffset(offset));
+        } else {
+          block_offset_ = offset;
+          block_pos_ = 0;
+          block_limit_ = 0;
+        }
       }
       return absl::OkStatus();
     }
@@ -279,6 +381,18 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
       TF_RETURN_IF_ERROR(env->NewRandomAccessFile(
           TranslateFileName(dataset()->filenames_[current_file_index_]),
           &file_));
+      if (ZeroCopyReadsEnabled() && dataset()->compression_type_.empty()) {
+        // Block-read mode: records are parsed straight out of multi-MB
+        // chunks, so no SequentialRecordReader is needed. Compressed files
+        // keep the streaming reader since they must be decoded byte-by-byte.
+        zero_copy_ = true;
+        block_offset_ = dataset()->byte_offsets_.empty()
+                            ? 0
+                            : dataset()->byte_offsets_[current_file_index_];
+        block_pos_ = 0;
+        block_limit_ = 0;
+        return absl::OkStatus();
+      }
       reader_ = std::make_unique<io::SequentialRecordReader>(
           file_.get(), dataset()->options_);
       if (!dataset()->byte_offsets_.empty()) {
@@ -292,8 +406,127 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
     void ResetStreamsLocked() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
       reader_.reset();
       file_.reset();
+      if (block_ != nullptr) {
+        block_->Unref();
+        block_ = nullptr;
+      }
+      zero_copy_ = false;
+      block_offset_ = 0;
+      block_pos_ = 0;
+      block_limit_ = 0;
+    }
+
+    // Reads the next chunk of the current file into a fresh block, starting
+    // at the first unparsed byte. `min_bytes` is the number of bytes the
+    // caller needs contiguously (a record header, or a whole record when it
+    // straddles the previous block). Returns OutOfRange on a clean
+    // end-of-file and DataLoss when the file ends inside a record.
+    absl::Status FillBlockLocked(uint64_t min_bytes)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      const uint64_t read_offset = block_offset_ + block_pos_;
+      const uint64_t block_bytes = std::max(min_bytes, kZeroCopyBlockSize);
+      RecordBlock* block = new RecordBlock(block_bytes);
+      absl::string_view result;
+      absl::Status s =
+          file_->Read(read_offset, block_bytes, &result, block->data());
+      if (!s.ok() && !errors::IsOutOfRange(s)) {
+        block->Unref();
+        return s;
+      }
+      // Some filesystems return a pointer into their own buffers instead of
+      // filling the scratch space.
+      if (!result.empty() && result.data() != block->data()) {
+        memcpy(block->data(), result.data(), result.size());
+      }
+      if (block_ != nullptr) block_->Unref();
+      block_ = block;
+      block_offset_ = read_offset;
+      block_pos_ = 0;
+      block_limit_ = result.size();
+      if (block_limit_ < min_bytes) {
+        if (block_limit_ == 0) {
+          return errors::OutOfRange("eof");
+        }
+        return errors::DataLoss("truncated record at ", read_offset);
+      }
+      return absl::OkStatus();
+    }
+
+    // Parses the next record out of the current block (refilling it if
+    // needed), verifying both checksums, and emits a scalar DT_STRING tensor
+    // whose tstring views the block instead of owning a copy.
+    absl::Status ReadRecordFromBlockLocked(Tensor* record)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      uint64_t length;
+      TF_RETURN_IF_ERROR(ParseRecordHeaderLocked(&length));
+      const uint64_t record_bytes = kRecordHeaderBytes + length +
+                                    kRecordFooterBytes;
+      if (block_limit_ - block_pos_ < record_bytes) {
+        TF_RETURN_IF_ERROR(FillBlockLocked(record_bytes));
+      }
+      const char* data = block_->data() + block_pos_ + kRecordHeaderBytes;
+      const uint32_t masked_crc =
+          core::DecodeFixed32(data + length);
+      if (crc32c::Unmask(masked_crc) != crc32c::Value(data, length)) {
+        return errors::DataLoss("corrupted record at ",
+                                block_offset_ + block_pos_);
+      }
+      auto* buffer = new RecordViewTensorBuffer(block_, data, length);
+      *record = Tensor(DT_STRING, TensorShape({}), buffer);
+      buffer->Unref();
+      block_pos_ += record_bytes;
+      return absl::OkStatus();
+    }
+
+    // Skips up to `num_to_skip` records without materializing them. Records
+    // extending beyond the current block are skipped by seeking the next
+    // block read past them.
+    absl::Status SkipRecordsFromBlockLocked(int num_to_skip, int* num_skipped)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      *num_skipped = 0;
+      while (*num_skipped < num_to_skip) {
+        uint64_t length;
+        TF_RETURN_IF_ERROR(ParseRecordHeaderLocked(&length));
+        const uint64_t record_bytes = kRecordHeaderBytes + length +
+                                      kRecordFooterBytes;
+        if (block_limit_ - block_pos_ < record_bytes) {
+          block_offset_ += block_pos_ + record_bytes;
+          block_pos_ = 0;
+          block_limit_ = 0;
+        } else {
+          block_pos_ += record_bytes;
+        }
+        ++(*num_skipped);
+      }
+      return absl::OkStatus();
     }
 
+    // Makes sure a full record header is available in the block, validates
+    // its checksum and emits the record's data length.
+    absl::Status ParseRecordHeaderLocked(uint64_t* length)
+        TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (block_ == nullptr ||
+          block_limit_ - block_pos_ < kRecordHeaderBytes) {
+        TF_RETURN_IF_ERROR(FillBlockLocked(kRecordHeaderBytes));
+      }
+      const char* header = block_->data() + block_pos_;
+      const uint32_t masked_crc =
+          core::DecodeFixed32(header + sizeof(uint64_t));
+      if (crc32c::Unmask(masked_crc) !=
+          crc32c::Value(header, sizeof(uint64_t))) {
+        return errors::DataLoss("corrupted record at ",
+                                block_offset_ + block_pos_);
+      }
+      *length = core::DecodeFixed64(header);
+      return absl::OkStatus();
+    }
+
+    // TFRecord framing: length (8B) + masked length crc (4B) + data +
+    // masked data crc (4B).
+    static constexpr uint64_t kRecordHeaderBytes =
+        sizeof(uint64_t) + sizeof(uint32_t);
+    static constexpr uint64_t kRecordFooterBytes = sizeof(uint32_t);
+
     mutex mu_;
     size_t current_file_index_ TF_GUARDED_BY(mu_) = 0;
 
@@ -301,6 +534,14 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
     // we must destroy `reader_` before `file_`.
     std::unique_ptr<RandomAccessFile> file_ TF_GUARDED_BY(mu_);
     std::unique_ptr<io::SequentialRecordReader> reader_ TF_GUARDED_BY(mu_);
+
+    // Zero-copy block-read state (see ZeroCopyReadsEnabled). The next
+    // unparsed record starts at file offset `block_offset_ + block_pos_`.
+    bool zero_copy_ TF_GUARDED_BY(mu_) = false;
+    RecordBlock* block_ TF_GUARDED_BY(mu_) = nullptr;
+    uint64_t block_offset_ TF_GUARDED_BY(mu_) = 0;
+    uint64_t block_pos_ TF_GUARDED_BY(mu_) = 0;
+    uint64_t block_limit_ TF_GUARDED_BY(mu_) = 0;
   };
 
   const std::vector<string> filenames_;
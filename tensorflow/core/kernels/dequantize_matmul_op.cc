@@ -0,0 +1,120 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Implements MatMul of float activations against int8 weights, with the
+// weights dequantized on the fly inside the GEMM.
+
+#define EIGEN_USE_THREADS
+
+#include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/op_requires.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/errors.h"
+
+namespace tensorflow {
+
+typedef Eigen::ThreadPoolDevice CPUDevice;
+
+// Computes product = a * dequantize(b), where `a` is float, `b` is int8 and
+// `b_scale` holds the symmetric quantization scale(s) of `b`: a scalar for
+// per-tensor quantization, or a vector with one entry per output column for
+// per-channel quantization.
+//
+// The int8->float cast is applied while the contraction packs the weight
+// panels, so the weights are dequantized inside the GEMM inner loop and no
+// float copy of the weight matrix is ever materialized. The per-column scale
+// is folded into the contraction output expression.
+class DequantizeMatMulOp : public OpKernel {
+ public:
+  explicit DequantizeMatMulOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("transpose_a", &transpose_a_));
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("transpose_b", &transpose_b_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& a = ctx->input(0);
+    const Tensor& b = ctx->input(1);
+    const Tensor& b_scale = ctx->input(2);
+
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(a.shape()),
+                errors::InvalidArgument("a must be a matrix, got shape: ",
+                                        a.shape().DebugString()));
+    OP_REQUIRES(ctx, TensorShapeUtils::IsMatrix(b.shape()),
+                errors::InvalidArgument("b must be a matrix, got shape: ",
+                                        b.shape().DebugString()));
+
+    const int a_k_dim = transpose_a_ ? 0 : 1;
+    const int b_k_dim = transpose_b_ ? 1 : 0;
+    OP_REQUIRES(ctx, a.dim_size(a_k_dim) == b.dim_size(b_k_dim),
+                errors::InvalidArgument(
+                    "Matrix size-incompatible: In[0]: ",
+                    a.shape().DebugString(),
+                    ", In[1]: ", b.shape().DebugString()));
+    const int64_t m = a.dim_size(1 - a_k_dim);
+    const int64_t k = a.dim_size(a_k_dim);
+    const int64_t n = b.dim_size(1 - b_k_dim);
+
+    OP_REQUIRES(
+        ctx,
+        b_scale.NumElements() == 1 ||
+            (TensorShapeUtils::IsVector(b_scale.shape()) &&
+             b_scale.NumElements() == n),
+        errors::InvalidArgument("b_scale must be a scalar or a vector with ",
+                                n, " elements, got shape: ",
+                                b_scale.shape().DebugString()));
+
+    Tensor* out = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({m, n}), &out));
+    if (out->NumElements() == 0) {
+      return;
+    }
+    auto out_m = out->matrix<float>();
+    const CPUDevice& device = ctx->eigen_device<CPUDevice>();
+    if (k == 0) {
+      out_m.device(device) = out_m.constant(0.0f);
+      return;
+    }
+
+    Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair;
+    dim_pair[0].first = a_k_dim;
+    dim_pair[0].second = b_k_dim;
+    auto a_m = a.matrix<float>();
+    auto b_m = b.matrix<int8>();
+
+    if (b_scale.NumElements() == 1) {
+      const float scale = b_scale.flat<float>()(0);
+      out_m.device(device) =
+          a_m.contract(b_m.cast<float>(), dim_pair) * scale;
+    } else {
+      const Eigen::array<Eigen::DenseIndex, 2> scale_shape{1, n};
+      const Eigen::array<Eigen::DenseIndex, 2> scale_bcast{m, 1};
+      out_m.device(device) =
+          a_m.contract(b_m.cast<float>(), dim_pair) *
+          b_scale.flat<float>().reshape(scale_shape).broadcast(scale_bcast);
+    }
+  }
+
+ private:
+  bool transpose_a_;
+  bool transpose_b_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("DequantizeMatMul").Device(DEVICE_CPU),
+                        DequantizeMatMulOp);
+
+}  // namespace tensorflow
@@ -0,0 +1,85 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/framework/fake_input.h"
+#include "tensorflow/core/framework/node_def_builder.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/kernels/ops_testutil.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+
+class DequantizeMatMulTest : public OpsTestBase {
+ protected:
+  void MakeOp(bool transpose_a, bool transpose_b) {
+    TF_ASSERT_OK(NodeDefBuilder("dequantize_matmul", "DequantizeMatMul")
+                     .Input(FakeInput(DT_FLOAT))
+                     .Input(FakeInput(DT_INT8))
+                     .Input(FakeInput(DT_FLOAT))
+                     .Attr("transpose_a", transpose_a)
+                     .Attr("transpose_b", transpose_b)
+                     .Finalize(node_def()));
+    TF_ASSERT_OK(InitOp());
+  }
+};
+
+TEST_F(DequantizeMatMulTest, PerTensorScale) {
+  MakeOp(false, false);
+  AddInputFromArray<float>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<int8>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<float>(TensorShape({}), {0.5f});
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 2}));
+  test::FillValues<float>(&expected, {3.5f, 5.0f, 7.5f, 11.0f});
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(DequantizeMatMulTest, PerChannelScale) {
+  MakeOp(false, false);
+  AddInputFromArray<float>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<int8>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<float>(TensorShape({2}), {0.5f, 2.0f});
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 2}));
+  test::FillValues<float>(&expected, {3.5f, 20.0f, 7.5f, 44.0f});
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(DequantizeMatMulTest, TransposedWeights) {
+  MakeOp(false, true);
+  AddInputFromArray<float>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<int8>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<float>(TensorShape({}), {1.0f});
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 2}));
+  test::FillValues<float>(&expected, {5.0f, 11.0f, 11.0f, 25.0f});
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(DequantizeMatMulTest, InvalidScaleShape) {
+  MakeOp(false, false);
+  AddInputFromArray<float>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<int8>(TensorShape({2, 2}), {1, 2, 3, 4});
+  AddInputFromArray<float>(TensorShape({3}), {1.0f, 1.0f, 1.0f});
+  EXPECT_FALSE(RunOpKernel().ok());
+}
+
+}  // namespace tensorflow
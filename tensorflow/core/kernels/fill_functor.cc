@@ -17,6 +17,14 @@ limitations under the License.
 
 #define EIGEN_USE_THREADS
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/framework/register_types.h"
 #include "tensorflow/core/framework/tensor_types.h"
@@ -27,9 +35,72 @@ limitations under the License.
 namespace tensorflow {
 namespace functor {
 
+namespace {
+
+// Bulk fills overwrite every destination byte; pulling those lines into the
+// cache first only evicts co-resident working sets. Past this threshold the
+// destination cannot stay cache-resident anyway, so write it with
+// non-temporal stores and leave the cache hierarchy to the threads that can
+// use it.
+constexpr int64_t kStreamingFillThresholdBytes = 32 * 1024 * 1024;
+
+#if defined(__SSE2__)
+
+template <typename T>
+void StreamingFillRange(T* p, T* end, const T& value) {
+  constexpr int kLanes = sizeof(__m128i) / sizeof(T);
+  // Scalar head until the destination is vector-aligned.
+  while (p != end && reinterpret_cast<uintptr_t>(p) % sizeof(__m128i) != 0) {
+    *p++ = value;
+  }
+  T lanes[kLanes];
+  for (int i = 0; i < kLanes; ++i) lanes[i] = value;
+  __m128i pattern;
+  memcpy(&pattern, lanes, sizeof(pattern));
+  for (; end - p >= kLanes; p += kLanes) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(p), pattern);
+  }
+  // Order the non-temporal stores with subsequent loads and stores.
+  _mm_sfence();
+  for (; p != end; ++p) {
+    *p = value;
+  }
+}
+
+template <typename T>
+bool FillWithStreamingStores(const Eigen::ThreadPoolDevice& d,
+                             typename TTypes<T>::Flat out, const T& value) {
+  if constexpr (std::is_trivially_copyable<T>::value &&
+                sizeof(__m128i) % sizeof(T) == 0) {
+    const int64_t bytes = out.size() * static_cast<int64_t>(sizeof(T));
+    if (bytes < kStreamingFillThresholdBytes) return false;
+    T* data = out.data();
+    d.parallelFor(out.size(), Eigen::TensorOpCost(0, sizeof(T), 0),
+                  [data, &value](Eigen::Index first, Eigen::Index last) {
+                    StreamingFillRange(data + first, data + last, value);
+                  });
+    return true;
+  } else {
+    return false;
+  }
+}
+
+#else
+
+template <typename T>
+bool FillWithStreamingStores(const Eigen::ThreadPoolDevice& d,
+                             typename TTypes<T>::Flat out, const T& value) {
+  return false;
+}
+
+#endif  // __SSE2__
+
+}  // namespace
+
 template <typename T>
 void SetZeroFunctor<Eigen::ThreadPoolDevice, T>::operator()(
     const Eigen::ThreadPoolDevice& d, typename TTypes<T>::Flat out) {
+  if (FillWithStreamingStores<T>(d, out, T(0))) return;
   out.device(d) = out.constant(T(0));
 }
 
@@ -116,6 +187,7 @@ struct FillFunctor<Eigen::ThreadPoolDevice, T> {
   void operator()(const Eigen::ThreadPoolDevice& d,
                   typename TTypes<T>::Flat out,
                   typename TTypes<T>::ConstScalar in) {
+    if (FillWithStreamingStores<T>(d, out, in())) return;
     out.device(d) = out.constant(in());
   }
 };
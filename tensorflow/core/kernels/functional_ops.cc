@@ -13,6 +13,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 #include <unordered_map>
+#include <atomic>
 #include <utility>
 
 #include "tensorflow/core/framework/types.h"
@@ -21,6 +22,7 @@ limitations under the License.
 
 #include "unsupported/Eigen/CXX11/Tensor"  // from @eigen_archive
 #include "tensorflow/core/common_runtime/device.h"
+#include "tensorflow/core/framework/cancellation.h"
 #include "tensorflow/core/framework/device_base.h"
 #include "tensorflow/core/framework/function.h"
 #include "tensorflow/core/framework/op_kernel.h"
@@ -32,6 +34,7 @@ limitations under the License.
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/platform/macros.h"
 #include "tensorflow/core/profiler/lib/traceme.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 typedef Eigen::GpuDevice GPUDevice;
@@ -155,13 +158,33 @@ class IfOp : public AsyncOpKernel {
   }
 
   void ComputeAsync(OpKernelContext* ctx, DoneCallback done) override {
-    FHandle then_handle;
-    FHandle else_handle;
-    OP_REQUIRES_OK_ASYNC(ctx, GetHandles(ctx, &then_handle, &else_handle),
-                         done);
-    bool cond;
-    OP_REQUIRES_OK(ctx, ToBool({ctx->input(0)}, &cond));
-    (new State(this, ctx, cond, then_handle, else_handle, done))->Start();
+    if (ctx->run_all_kernels_inline()) {
+      // Use the non-callback-based implementation when kernels (and function
+      // callbacks) execute inline to avoid stack overflow.
+      OP_REQUIRES_OK_ASYNC(ctx, DoComputeSync(ctx), done);
+      done();
+    } else {
+      FHandle then_handle;
+      FHandle else_handle;
+      OP_REQUIRES_OK_ASYNC(ctx, GetHandles(ctx, &then_handle, &else_handle),
+                           done);
+      bool cond;
+      OP_REQUIRES_OK(ctx, ToBool({ctx->input(0)}, &cond));
+      (new State(this, ctx, cond, then_handle, else_handle, done))->Start();
+    }
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    // Use the non-callback-based implementation when the synchronous Compute()
+    // method is invoked, because the caller is explicitly donating a thread.
+    absl::Status s = DoComputeSync(ctx);
+    // NOTE: Unfortunately, we cannot use OP_REQUIRES_OK here, because this is
+    // still an AsyncOpKernel, and there is a run-time check to avoid calling
+    // OP_REQUIRES_OK in AsyncOpKernel::ComputeAsync() (which would deadlock in
+    // the event of an error).
+    if (TF_PREDICT_FALSE(!s.ok())) {
+      ctx->SetStatus(s);
+    }
   }
 
  private:
@@ -229,6 +252,33 @@ class IfOp : public AsyncOpKernel {
     TensorVec rets_;
   };
 
+  absl::Status DoComputeSync(OpKernelContext* ctx) {
+    FHandle then_handle;
+    FHandle else_handle;
+    TF_RETURN_IF_ERROR(GetHandles(ctx, &then_handle, &else_handle));
+    bool cond;
+    TF_RETURN_IF_ERROR(ToBool({ctx->input(0)}, &cond));
+
+    auto lib = ctx->function_library();
+    FunctionLibraryRuntime::Options opts(ctx->step_id());
+    SetRunOptions(ctx, &opts, true /* always_collect_stats */);
+
+    std::vector<Tensor> args;
+    args.reserve(ctx->num_inputs() - 1);
+    for (int i = 1; i < ctx->num_inputs(); ++i) {
+      args.push_back(ctx->input(i));
+    }
+    std::vector<Tensor> rets;
+    rets.reserve(ctx->num_outputs());
+
+    // Evaluate one of the branch functions synchronously, without allocating
+    // a callback-based execution state on the heap.
+    FHandle handle = cond ? then_handle : else_handle;
+    tsl::profiler::TraceMe trace_me("IfOp");
+    TF_RETURN_IF_ERROR(lib->RunSync(opts, handle, args, &rets));
+    return SetOutputs(this, ctx, rets);
+  }
+
   absl::Status GetHandles(OpKernelContext* ctx, FHandle* then_handle,
                           FHandle* else_handle) {
     // TODO(b/37549631): Because this op has `SetIsStateful()` in its
@@ -497,6 +547,54 @@ class WhileOp : public AsyncOpKernel {
                                tsl::core::WeakPtr<FunctionLibraryRuntime>>>
       handles_ ABSL_GUARDED_BY(mu_);
 
+  // Speculation only starts once enough evaluations of this kernel's cond
+  // have been observed, and only if the loop almost always continued.  Every
+  // invocation contributes exactly one false evaluation, so the continue
+  // rate of a loop that typically runs k iterations is k / (k + 1); the 87%
+  // threshold admits loops of roughly 8 or more iterations.
+  static constexpr int64_t kSpeculationMinCondEvals = 16;
+  static constexpr int64_t kSpeculationMinContinuePercent = 87;
+
+  // Running cond-outcome statistics for this kernel, consulted by
+  // ShouldSpeculate() below.
+  std::atomic<int64_t> cond_evals_{0};
+  std::atomic<int64_t> cond_continues_{0};
+
+  // Whether speculative body execution was requested for this process.
+  // Off by default: on a mispredicted final iteration the body runs once
+  // more than the loop semantics call for, and although that run is
+  // cancelled and its results discarded, any side effects it got to perform
+  // are not undone.  Only set this for loops whose bodies tolerate a
+  // cancelled extra iteration (e.g. pure compute).
+  static bool SpeculationEnabled() {
+    static const bool enabled = [] {
+      bool enable = false;
+      TF_CHECK_OK(ReadBoolFromEnvVar("TF_ENABLE_SPECULATIVE_LOOP_BODY",
+                                     /*default_val=*/false, &enable));
+      return enable;
+    }();
+    return enabled;
+  }
+
+  void RecordCondResult(bool continued) {
+    cond_evals_.fetch_add(1, std::memory_order_relaxed);
+    if (continued) {
+      cond_continues_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  bool ShouldSpeculate() {
+    if (!SpeculationEnabled()) {
+      return false;
+    }
+    const int64_t evals = cond_evals_.load(std::memory_order_relaxed);
+    if (evals < kSpeculationMinCondEvals) {
+      return false;
+    }
+    return cond_continues_.load(std::memory_order_relaxed) * 100 >=
+           evals * kSpeculationMinContinuePercent;
+  }
+
   static absl::Status CondResultToBool(
       OpKernelContext* ctx, const FunctionLibraryRuntime::Options& opts,
       const Tensor& cond_t, bool* out_result) {
@@ -609,8 +707,10 @@ class WhileOp : public AsyncOpKernel {
           body_handle_(body_handle),
           done_(std::move(done)),
           lib_(CHECK_NOTNULL(ctx_->function_library())),
-          opts_(ctx->step_id()) {
+          opts_(ctx->step_id()),
+          body_opts_(ctx->step_id()) {
       SetRunOptions(ctx_, &opts_, false /* always_collect_stats */);
+      SetRunOptions(ctx_, &body_opts_, false /* always_collect_stats */);
       GetArgsFromContext(ctx, &args_, &loop_var_types_);
       body_frame_ =
           std::make_unique<BodyFuncCallFrame>(&args_, &rets_, loop_var_types_);
@@ -618,7 +718,13 @@ class WhileOp : public AsyncOpKernel {
 
     ~State() = default;
 
-    void Start() { EvalCond(); }
+    void Start() {
+      if (kernel_->ShouldSpeculate()) {
+        EvalCondAndSpeculateBody();
+      } else {
+        EvalCond();
+      }
+    }
 
    private:
     WhileOp* const kernel_;
@@ -628,11 +734,26 @@ class WhileOp : public AsyncOpKernel {
     const DoneCallback done_;
     FunctionLibraryRuntime* const lib_;
     FunctionLibraryRuntime::Options opts_;
+    // Options for speculative body runs; same as opts_ except that the
+    // cancellation manager is replaced per iteration by a child manager so
+    // that a mispredicted body run can be cancelled on its own.
+    FunctionLibraryRuntime::Options body_opts_;
     TensorVec args_;
     TensorVec rets_;
     DataTypeVector loop_var_types_;
     std::unique_ptr<BodyFuncCallFrame> body_frame_;
 
+    // State for speculative iterations (see EvalCondAndSpeculateBody).
+    TensorVec cond_rets_;
+    TensorVec spec_args_;
+    std::unique_ptr<BodyFuncCallFrame> spec_frame_;
+    std::unique_ptr<CancellationManager> body_cm_;
+    mutex mu_;
+    int pending_ TF_GUARDED_BY(mu_) = 0;
+    absl::Status cond_status_;
+    absl::Status body_status_;
+    bool cond_result_ = false;
+
     void EvalCond() {
       tsl::profiler::TraceMe trace_me("WhileOp-EvalCond");
       lib_->Run(
@@ -664,6 +785,7 @@ class WhileOp : public AsyncOpKernel {
       if (!s.ok()) {
         return Finish(s);
       }
+      kernel_->RecordCondResult(cond);
 
       if (!cond) {
         return Finish(absl::OkStatus());
@@ -687,10 +809,115 @@ class WhileOp : public AsyncOpKernel {
             args_.clear();
             using std::swap;
             swap(args_, rets_);
-            EvalCond();
+            Start();
           });
     }
 
+    // Speculative iteration: starts the body on the current loop variables
+    // concurrently with the condition, betting that the condition will come
+    // back true (it almost always does once ShouldSpeculate() approves), so
+    // the condition's latency is hidden behind the body instead of serializing
+    // with it.  On the mispredicted final iteration the in-flight body run is
+    // cancelled through a child CancellationManager and its results are
+    // discarded.  The body consumes its arguments out of `spec_args_`, a
+    // borrowed copy of the loop variables, so the condition keeps an intact
+    // view of `args_`.
+    void EvalCondAndSpeculateBody() {
+      cond_rets_.clear();
+      spec_args_ = args_;
+      rets_.clear();
+      rets_.resize(args_.size());
+      spec_frame_ = std::make_unique<BodyFuncCallFrame>(&spec_args_, &rets_,
+                                                        loop_var_types_);
+      body_cm_ = opts_.cancellation_manager != nullptr
+                     ? std::make_unique<CancellationManager>(
+                           opts_.cancellation_manager)
+                     : std::make_unique<CancellationManager>();
+      body_opts_.cancellation_manager = body_cm_.get();
+      {
+        mutex_lock l(mu_);
+        pending_ = 2;
+      }
+      tsl::profiler::TraceMe trace_me("WhileOp-SpeculativeIteration");
+      lib_->Run(
+          // Evaluate the condition.
+          opts_, cond_handle_, args_, &cond_rets_,
+          // Done cb.
+          [this](const absl::Status& s) { SpeculativeCondDone(s); });
+      lib_->Run(
+          // Evaluate the body, speculatively.
+          body_opts_, body_handle_, spec_frame_.get(),
+          // Done callback
+          [this](const absl::Status& s) { SpeculativeBodyDone(s); });
+    }
+
+    void SpeculativeCondDone(const absl::Status& s) {
+      absl::Status status = s;
+      bool cond = false;
+      if (status.ok() && cond_rets_.size() != 1) {
+        status = errors::InvalidArgument(
+            "Expected a single scalar return value from WhileOp cond, got ",
+            cond_rets_.size(), " tensors.");
+      }
+      if (status.ok()) {
+        status = CondResultToBool(ctx_, opts_, cond_rets_[0], &cond);
+      }
+      if (status.ok()) {
+        kernel_->RecordCondResult(cond);
+      }
+      if (!status.ok() || !cond) {
+        // Error or misprediction: the in-flight body run is wasted work.
+        // Cancelled before the barrier below so that `this` is still alive.
+        body_cm_->StartCancel();
+      }
+      bool both_done;
+      {
+        mutex_lock l(mu_);
+        cond_status_ = status;
+        cond_result_ = cond;
+        both_done = --pending_ == 0;
+      }
+      if (both_done) {
+        FinishSpeculativeIteration();
+      }
+    }
+
+    void SpeculativeBodyDone(const absl::Status& s) {
+      bool both_done;
+      {
+        mutex_lock l(mu_);
+        body_status_ = s;
+        both_done = --pending_ == 0;
+      }
+      if (both_done) {
+        FinishSpeculativeIteration();
+      }
+    }
+
+    void FinishSpeculativeIteration() {
+      if (!cond_status_.ok()) {
+        return Finish(cond_status_);
+      }
+      if (!cond_result_) {
+        // Mispredicted final iteration: the speculative body run (cancelled
+        // above) is discarded, including its cancellation status.  The loop
+        // outputs are the variables the condition evaluated.
+        return Finish(absl::OkStatus());
+      }
+      if (!body_status_.ok()) {
+        return Finish(body_status_);
+      }
+      if (args_.size() != rets_.size()) {
+        return Finish(errors::InvalidArgument(
+            "While loop body returned ", rets_.size(),
+            " arguments. Expected: ", args_.size()));
+      }
+      args_.clear();
+      using std::swap;
+      swap(args_, rets_);
+      Start();
+    }
+
     void Finish(absl::Status s) {
       if (s.ok()) {
         s = SetOutputs(kernel_, ctx_, args_);
@@ -739,6 +966,7 @@ class WhileOp : public AsyncOpKernel {
       bool cond_result;
       TF_RETURN_IF_ERROR(
           CondResultToBool(ctx, opts, cond_rets[0], &cond_result));
+      RecordCondResult(cond_result);
       if (!cond_result) {
         return SetOutputs(this, ctx, args);
       }
@@ -0,0 +1,163 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// GatherSegmentReduce fuses Gather followed by a sorted-segment reduction
+// (the common embedding lookup + pooling pattern). Instead of materializing
+// the gathered rows as an intermediate [num_indices, cols] tensor, each
+// params row is streamed directly into its segment's accumulator row, with
+// upcoming rows prefetched while the current one is being reduced.
+
+#define EIGEN_USE_THREADS
+
+#include <cstdint>
+
+#include "absl/base/prefetch.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/op_requires.h"
+#include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/kernels/bounds_check.h"
+#include "tensorflow/core/platform/errors.h"
+
+namespace tensorflow {
+
+namespace {
+
+// How far ahead of the row currently being accumulated to issue prefetches.
+// Embedding rows are typically a few hundred bytes, so a handful of rows in
+// flight is enough to cover DRAM latency without thrashing the L1.
+constexpr int64_t kPrefetchDistance = 4;
+
+}  // namespace
+
+template <typename T, typename Index, typename SegmentId>
+class GatherSegmentReduceOp : public OpKernel {
+ public:
+  explicit GatherSegmentReduceOp(OpKernelConstruction* context)
+      : OpKernel(context) {
+    string combiner;
+    OP_REQUIRES_OK(context, context->GetAttr("combiner", &combiner));
+    is_mean_ = (combiner == "mean");
+  }
+
+  void Compute(OpKernelContext* context) override {
+    const Tensor& params = context->input(0);
+    const Tensor& indices = context->input(1);
+    const Tensor& segment_ids = context->input(2);
+
+    OP_REQUIRES(context, TensorShapeUtils::IsVectorOrHigher(params.shape()),
+                errors::InvalidArgument("params must be at least rank 1"));
+    OP_REQUIRES(context, TensorShapeUtils::IsVector(indices.shape()),
+                errors::InvalidArgument("indices should be a vector."));
+    OP_REQUIRES(context, TensorShapeUtils::IsVector(segment_ids.shape()),
+                errors::InvalidArgument("segment_ids should be a vector."));
+    OP_REQUIRES(context,
+                indices.NumElements() == segment_ids.NumElements(),
+                errors::InvalidArgument(
+                    "segment_ids and indices should have same size."));
+
+    const int64_t num_indices = indices.NumElements();
+    const auto params_flat = params.flat_outer_dims<T>();
+    const Index num_rows = static_cast<Index>(params_flat.dimension(0));
+    const auto indices_vec = indices.vec<Index>();
+    const auto segment_vec = segment_ids.vec<SegmentId>();
+
+    // segment_ids are required to be sorted, so the last one determines the
+    // number of output rows, exactly as in the SparseSegment* ops.
+    const SegmentId num_segments =
+        num_indices > 0
+            ? internal::SubtleMustCopy(segment_vec(num_indices - 1)) + 1
+            : 0;
+    OP_REQUIRES(context, num_segments >= 0,
+                errors::InvalidArgument("segment ids must be >= 0"));
+
+    TensorShape output_shape = params.shape();
+    OP_REQUIRES_OK(context,
+                   output_shape.SetDimWithStatus(/*d=*/0, num_segments));
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(0, output_shape, &output));
+    if (num_segments == 0) return;
+    auto output_flat = output->flat_outer_dims<T>();
+    output_flat.setZero();
+
+    SegmentId prev_segment = -1;
+    int64_t segment_count = 0;
+    for (int64_t i = 0; i < num_indices; ++i) {
+      if (i + kPrefetchDistance < num_indices) {
+        const Index next = indices_vec(i + kPrefetchDistance);
+        if (FastBoundsCheck(next, num_rows)) {
+          absl::PrefetchToLocalCache(&params_flat(next, 0));
+        }
+      }
+      const Index row = internal::SubtleMustCopy(indices_vec(i));
+      OP_REQUIRES(context, FastBoundsCheck(row, num_rows),
+                  errors::InvalidArgument("indices[", i, "] == ", row,
+                                          " out of range [0, ", num_rows, ")"));
+      const SegmentId segment = internal::SubtleMustCopy(segment_vec(i));
+      OP_REQUIRES(
+          context, segment >= prev_segment,
+          errors::InvalidArgument("segment ids are not increasing"));
+      if (segment != prev_segment) {
+        if (is_mean_ && segment_count > 1) {
+          output_flat.template chip<0>(prev_segment) =
+              output_flat.template chip<0>(prev_segment) /
+              output_flat.template chip<0>(prev_segment).constant(
+                  static_cast<T>(segment_count));
+        }
+        prev_segment = segment;
+        segment_count = 0;
+      }
+      // Rows between segments with no entries stay zero, matching
+      // SparseSegmentSum's treatment of empty segments.
+      output_flat.template chip<0>(segment) +=
+          params_flat.template chip<0>(row);
+      ++segment_count;
+    }
+    if (is_mean_ && segment_count > 1) {
+      output_flat.template chip<0>(prev_segment) =
+          output_flat.template chip<0>(prev_segment) /
+          output_flat.template chip<0>(prev_segment).constant(
+              static_cast<T>(segment_count));
+    }
+  }
+
+ private:
+  bool is_mean_;
+};
+
+#define REGISTER_CPU_KERNEL(type, index_type, segment_ids_type)    \
+  REGISTER_KERNEL_BUILDER(                                         \
+      Name("GatherSegmentReduce")                                  \
+          .Device(DEVICE_CPU)                                      \
+          .TypeConstraint<type>("T")                               \
+          .TypeConstraint<index_type>("Tidx")                      \
+          .TypeConstraint<segment_ids_type>("Tsegmentids"),        \
+      GatherSegmentReduceOp<type, index_type, segment_ids_type>);
+
+#define REGISTER_CPU_KERNEL_ALL_INDEX(type)        \
+  REGISTER_CPU_KERNEL(type, int32, int32)          \
+  REGISTER_CPU_KERNEL(type, int32, int64_t)        \
+  REGISTER_CPU_KERNEL(type, int64_t, int32)        \
+  REGISTER_CPU_KERNEL(type, int64_t, int64_t)
+
+TF_CALL_float(REGISTER_CPU_KERNEL_ALL_INDEX);
+TF_CALL_double(REGISTER_CPU_KERNEL_ALL_INDEX);
+
+#undef REGISTER_CPU_KERNEL_ALL_INDEX
+#undef REGISTER_CPU_KERNEL
+
+}  // namespace tensorflow
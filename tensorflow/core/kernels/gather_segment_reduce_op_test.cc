@@ -0,0 +1,87 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <string>
+
+#include "tensorflow/core/framework/fake_input.h"
+#include "tensorflow/core/framework/node_def_builder.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/framework/types.pb.h"
+#include "tensorflow/core/kernels/ops_testutil.h"
+#include "tensorflow/core/kernels/ops_util.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+class GatherSegmentReduceOpTest : public OpsTestBase {
+ protected:
+  void MakeOp(DataType data_type, DataType index_type,
+              const std::string& combiner) {
+    TF_ASSERT_OK(NodeDefBuilder("myop", "GatherSegmentReduce")
+                     .Input(FakeInput(data_type))
+                     .Input(FakeInput(index_type))
+                     .Input(FakeInput(index_type))
+                     .Attr("combiner", combiner)
+                     .Finalize(node_def()));
+    TF_ASSERT_OK(InitOp());
+  }
+};
+
+TEST_F(GatherSegmentReduceOpTest, Sum) {
+  MakeOp(DT_FLOAT, DT_INT32, "sum");
+
+  AddInputFromArray<float>(TensorShape({4, 2}),
+                           {1, 2, 3, 4, 5, 6, 7, 8});
+  AddInputFromArray<int32>(TensorShape({4}), {0, 2, 3, 1});
+  AddInputFromArray<int32>(TensorShape({4}), {0, 0, 1, 2});
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({3, 2}));
+  test::FillValues<float>(&expected, {6, 8, 7, 8, 3, 4});
+  test::ExpectTensorEqual<float>(expected, *GetOutput(0));
+}
+
+TEST_F(GatherSegmentReduceOpTest, MeanWithEmptySegment) {
+  MakeOp(DT_FLOAT, DT_INT32, "mean");
+
+  AddInputFromArray<float>(TensorShape({4, 2}),
+                           {1, 2, 3, 4, 5, 6, 7, 8});
+  AddInputFromArray<int32>(TensorShape({3}), {0, 2, 1});
+  AddInputFromArray<int32>(TensorShape({3}), {0, 0, 2});
+  TF_ASSERT_OK(RunOpKernel());
+
+  // Segment 1 has no entries and stays zero, matching SparseSegmentMean.
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({3, 2}));
+  test::FillValues<float>(&expected, {3, 4, 0, 0, 3, 4});
+  test::ExpectTensorEqual<float>(expected, *GetOutput(0));
+}
+
+TEST_F(GatherSegmentReduceOpTest, IndexOutOfRange) {
+  MakeOp(DT_FLOAT, DT_INT32, "sum");
+
+  AddInputFromArray<float>(TensorShape({4, 2}),
+                           {1, 2, 3, 4, 5, 6, 7, 8});
+  AddInputFromArray<int32>(TensorShape({2}), {0, 4});
+  AddInputFromArray<int32>(TensorShape({2}), {0, 0});
+  absl::Status s = RunOpKernel();
+  EXPECT_TRUE(absl::StrContains(s.message(), "out of range"));
+}
+
+}  // namespace
+}  // namespace tensorflow
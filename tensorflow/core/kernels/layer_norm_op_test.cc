@@ -0,0 +1,115 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cmath>
+#include <vector>
+
+#include "tensorflow/core/framework/fake_input.h"
+#include "tensorflow/core/framework/node_def_builder.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/framework/types.h"
+#include "tensorflow/core/kernels/ops_testutil.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+class FusedLayerNormOpTest : public OpsTestBase {
+ protected:
+  void MakeOp(float epsilon) {
+    TF_ASSERT_OK(NodeDefBuilder("fused_layer_norm", "_FusedLayerNorm")
+                     .Input(FakeInput(DT_FLOAT))
+                     .Input(FakeInput(DT_FLOAT))
+                     .Input(FakeInput(DT_FLOAT))
+                     .Attr("epsilon", epsilon)
+                     .Finalize(node_def()));
+    TF_ASSERT_OK(InitOp());
+  }
+
+  // Reference implementation of y = (x - mean) * rsqrt(var + epsilon) * scale
+  // + offset with per-row statistics over the last dimension.
+  static std::vector<float> Reference(const std::vector<float>& x,
+                                      const std::vector<float>& scale,
+                                      const std::vector<float>& offset,
+                                      int depth, float epsilon) {
+    std::vector<float> y(x.size());
+    const int rows = x.size() / depth;
+    for (int row = 0; row < rows; ++row) {
+      const float* x_row = x.data() + row * depth;
+      double sum = 0.0;
+      for (int i = 0; i < depth; ++i) sum += x_row[i];
+      const double mean = sum / depth;
+      double var = 0.0;
+      for (int i = 0; i < depth; ++i) {
+        var += (x_row[i] - mean) * (x_row[i] - mean);
+      }
+      var /= depth;
+      const double inv_stddev = 1.0 / std::sqrt(var + epsilon);
+      for (int i = 0; i < depth; ++i) {
+        y[row * depth + i] =
+            (x_row[i] - mean) * inv_stddev * scale[i] + offset[i];
+      }
+    }
+    return y;
+  }
+};
+
+TEST_F(FusedLayerNormOpTest, Simple) {
+  MakeOp(0.001f);
+  const std::vector<float> x = {1.0, 2.0, 3.0, 4.0, -1.0, 0.5, 2.5, 7.0};
+  const std::vector<float> scale = {1.0, 2.0, 0.5, 1.5};
+  const std::vector<float> offset = {0.0, -1.0, 0.25, 2.0};
+  AddInputFromArray<float>(TensorShape({2, 4}), x);
+  AddInputFromArray<float>(TensorShape({4}), scale);
+  AddInputFromArray<float>(TensorShape({4}), offset);
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 4}));
+  test::FillValues<float>(&expected,
+                          Reference(x, scale, offset, /*depth=*/4, 0.001f));
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(FusedLayerNormOpTest, HigherRank) {
+  MakeOp(0.01f);
+  std::vector<float> x(24);
+  for (int i = 0; i < 24; ++i) x[i] = 0.1f * i * (i % 3 == 0 ? -1 : 1);
+  const std::vector<float> scale = {0.5, 1.0, 1.5};
+  const std::vector<float> offset = {1.0, 0.0, -1.0};
+  AddInputFromArray<float>(TensorShape({2, 4, 3}), x);
+  AddInputFromArray<float>(TensorShape({3}), scale);
+  AddInputFromArray<float>(TensorShape({3}), offset);
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 4, 3}));
+  test::FillValues<float>(&expected,
+                          Reference(x, scale, offset, /*depth=*/3, 0.01f));
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(FusedLayerNormOpTest, ScaleShapeMismatch) {
+  MakeOp(0.001f);
+  AddInputFromArray<float>(TensorShape({2, 4}),
+                           {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0});
+  AddInputFromArray<float>(TensorShape({3}), {1.0, 1.0, 1.0});
+  AddInputFromArray<float>(TensorShape({4}), {0.0, 0.0, 0.0, 0.0});
+  absl::Status s = RunOpKernel();
+  EXPECT_TRUE(absl::IsInvalidArgument(s)) << s;
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -27,6 +27,7 @@ limitations under the License.
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/platform/random.h"
+#include "tensorflow/core/util/work_sharder.h"
 
 namespace tensorflow {
 namespace lookup {
@@ -36,6 +37,12 @@ std::string UniqueNodeName(const std::string& base) {
   return strings::StrCat(base, "/", counter.fetch_add(1), "/", random::New64());
 }
 
+// Rough cost in nanoseconds of one hash-table lookup, used to shard batch
+// lookups across the intra-op pool. Batch lookups only read the table and run
+// under a shared lock held for the duration of the Shard() call, so the shards
+// need no locking of their own.
+constexpr int64_t kCostPerLookup = 50;
+
 // Lookup table that wraps an unordered_map, where the key and value data type
 // is specified. Each individual value must be a scalar. If vector values are
 // required, use MutableHashTableOfTensors.
@@ -71,17 +78,23 @@ class MutableHashTableOfScalars final : public LookupInterface {
     bool is_full_size_default = (total == default_total);
 
     tf_shared_lock l(mu_);
-    for (int64_t i = 0; i < key_values.size(); ++i) {
-      // is_full_size_default is true:
-      //   Each key has an independent default value, key_values(i)
-      //   corresponding uses default_flat(i) as its default value.
-      //
-      // is_full_size_default is false:
-      //   All keys will share the default_flat(0) as default value.
-      value_values(i) = gtl::FindWithDefault(
-          table_, SubtleMustCopyIfIntegral(key_values(i)),
-          is_full_size_default ? default_flat(i) : default_flat(0));
-    }
+    const auto& table = table_;
+    auto shard = [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        // is_full_size_default is true:
+        //   Each key has an independent default value, key_values(i)
+        //   corresponding uses default_flat(i) as its default value.
+        //
+        // is_full_size_default is false:
+        //   All keys will share the default_flat(0) as default value.
+        value_values(i) = gtl::FindWithDefault(
+            table, SubtleMustCopyIfIntegral(key_values(i)),
+            is_full_size_default ? default_flat(i) : default_flat(0));
+      }
+    };
+    auto worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads->num_threads, worker_threads->workers,
+          key_values.size(), kCostPerLookup, shard);
 
     return absl::OkStatus();
   }
@@ -243,26 +256,32 @@ class MutableHashTableOfTensors final : public LookupInterface {
     bool is_full_size_default = (total == default_total);
 
     tf_shared_lock l(mu_);
-    for (int64_t i = 0; i < key_values.size(); ++i) {
-      ValueArray* value_vec =
-          gtl::FindOrNull(table_, SubtleMustCopyIfIntegral(key_values(i)));
-      if (value_vec != nullptr) {
-        for (int64_t j = 0; j < value_dim; j++) {
-          value_values(i, j) = value_vec->at(j);
-        }
-      } else {
-        // is_full_size_default is true:
-        //   Each key has an independent default value, key_values(i)
-        //   corresponding uses default_flat(i) as its default value.
-        //
-        // is_full_size_default is false:
-        //   All keys will share the default_flat(0) as default value.
-        for (int64_t j = 0; j < value_dim; j++) {
-          value_values(i, j) =
-              is_full_size_default ? default_flat(i, j) : default_flat(0, j);
+    const auto& table = table_;
+    auto shard = [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        const ValueArray* value_vec =
+            gtl::FindOrNull(table, SubtleMustCopyIfIntegral(key_values(i)));
+        if (value_vec != nullptr) {
+          for (int64_t j = 0; j < value_dim; j++) {
+            value_values(i, j) = value_vec->at(j);
+          }
+        } else {
+          // is_full_size_default is true:
+          //   Each key has an independent default value, key_values(i)
+          //   corresponding uses default_flat(i) as its default value.
+          //
+          // is_full_size_default is false:
+          //   All keys will share the default_flat(0) as default value.
+          for (int64_t j = 0; j < value_dim; j++) {
+            value_values(i, j) =
+                is_full_size_default ? default_flat(i, j) : default_flat(0, j);
+          }
         }
       }
-    }
+    };
+    auto worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads->num_threads, worker_threads->workers,
+          key_values.size(), kCostPerLookup + value_dim, shard);
 
     return absl::OkStatus();
   }
@@ -521,47 +540,63 @@ class MutableDenseHashTable final : public LookupInterface {
     const auto deleted_key_matrix =
         deleted_key_.template shaped<K, 2>({1, key_size});
     const int64_t bit_mask = num_buckets_ - 1;
-    // TODO(andreasst): parallelize using work_sharder
-    for (int64_t i = 0; i < num_elements; ++i) {
-      const uint64 key_hash = HashKey(key_matrix, i);
-      if (empty_key_hash_ == key_hash &&
-          IsEqualKey(empty_key_matrix, 0, key_matrix, i)) {
-        return errors::InvalidArgument(
-            "Using the empty_key as a table key is not allowed");
-      }
-      if (deleted_key_hash_ == key_hash &&
-          IsEqualKey(deleted_key_matrix, 0, key_matrix, i)) {
-        return errors::InvalidArgument(
-            "Using the deleted_key as a table key is not allowed");
-      }
-      int64_t bucket_index = key_hash & bit_mask;
-      int64_t num_probes = 0;
-      while (true) {
-        if (IsEqualKey(key_buckets_matrix, bucket_index, key_matrix, i)) {
-          for (int64_t j = 0; j < value_size; ++j) {
-            // TODO(andreasst): check if we can get rid of SubtleMustCopy
-            // here and elsewhere in this file.
-            value_matrix(i, j) =
-                SubtleMustCopyIfIntegral(value_buckets_matrix(bucket_index, j));
-          }
-          break;
+    const int64_t num_buckets = num_buckets_;
+    const uint64 empty_key_hash = empty_key_hash_;
+    const uint64 deleted_key_hash = deleted_key_hash_;
+    mutex status_mu;
+    absl::Status find_status;
+    auto shard = [&](int64_t begin, int64_t end) {
+      for (int64_t i = begin; i < end; ++i) {
+        const uint64 key_hash = HashKey(key_matrix, i);
+        if (empty_key_hash == key_hash &&
+            IsEqualKey(empty_key_matrix, 0, key_matrix, i)) {
+          mutex_lock status_lock(status_mu);
+          find_status.Update(errors::InvalidArgument(
+              "Using the empty_key as a table key is not allowed"));
+          return;
         }
-        if (IsEqualKey(key_buckets_matrix, bucket_index, empty_key_matrix, 0)) {
-          for (int64_t j = 0; j < value_size; ++j) {
-            value_matrix(i, j) = SubtleMustCopyIfIntegral(default_flat(j));
-          }
-          break;
+        if (deleted_key_hash == key_hash &&
+            IsEqualKey(deleted_key_matrix, 0, key_matrix, i)) {
+          mutex_lock status_lock(status_mu);
+          find_status.Update(errors::InvalidArgument(
+              "Using the deleted_key as a table key is not allowed"));
+          return;
         }
-        ++num_probes;
-        bucket_index =
-            (bucket_index + num_probes) & bit_mask;  // quadratic probing
-        if (num_probes >= num_buckets_) {
-          return errors::Internal(
-              "Internal error in MutableDenseHashTable lookup");
+        int64_t bucket_index = key_hash & bit_mask;
+        int64_t num_probes = 0;
+        while (true) {
+          if (IsEqualKey(key_buckets_matrix, bucket_index, key_matrix, i)) {
+            for (int64_t j = 0; j < value_size; ++j) {
+              // TODO(andreasst): check if we can get rid of SubtleMustCopy
+              // here and elsewhere in this file.
+              value_matrix(i, j) = SubtleMustCopyIfIntegral(
+                  value_buckets_matrix(bucket_index, j));
+            }
+            break;
+          }
+          if (IsEqualKey(key_buckets_matrix, bucket_index, empty_key_matrix,
+                         0)) {
+            for (int64_t j = 0; j < value_size; ++j) {
+              value_matrix(i, j) = SubtleMustCopyIfIntegral(default_flat(j));
+            }
+            break;
+          }
+          ++num_probes;
+          bucket_index =
+              (bucket_index + num_probes) & bit_mask;  // quadratic probing
+          if (num_probes >= num_buckets) {
+            mutex_lock status_lock(status_mu);
+            find_status.Update(errors::Internal(
+                "Internal error in MutableDenseHashTable lookup"));
+            return;
+          }
         }
       }
-    }
-    return absl::OkStatus();
+    };
+    auto worker_threads = ctx->device()->tensorflow_cpu_worker_threads();
+    Shard(worker_threads->num_threads, worker_threads->workers, num_elements,
+          kCostPerLookup + key_size + value_size, shard);
+    return find_status;
   }
 
   absl::Status Insert(OpKernelContext* ctx, const Tensor& key,
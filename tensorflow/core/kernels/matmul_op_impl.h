@@ -23,6 +23,7 @@ limitations under the License.
 #include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -41,6 +42,7 @@ limitations under the License.
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/platform/bfloat16.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/matmul_autotune.h"
 #include "tensorflow/core/util/matmul_bcast.h"
@@ -445,8 +447,12 @@ struct LaunchBatchMatMul<CPUDevice, Scalar> {
       // is counter-productive to parallelize the inner matrix multiplies.
       Shard(worker_threads.num_threads, worker_threads.workers, batch_size,
             cost_per_unit,
-            [&in_x, &in_y, adj_x, adj_y, trans_x, trans_y, &bcast, out](
-                int start, int limit) {
+            [context, &in_x, &in_y, adj_x, adj_y, trans_x, trans_y, &bcast,
+             out](int start, int limit) {
+              // Cooperatively skip remaining batch members once the session
+              // deadline has passed; Compute() fails the step afterwards so
+              // the partial output is never observed.
+              if (context->IsDeadlineExceeded()) return;
               SequentialMatMulKernel<Scalar>::Run(in_x, in_y, adj_x, adj_y,
                                                   trans_x, trans_y, bcast, out,
                                                   start, limit);
@@ -922,7 +928,25 @@ class BaseBatchMatMulOp : public OpKernel {
       return;
     }
 
-    MatMulBCast bcast(in0.shape().dim_sizes(), in1.shape().dim_sizes());
+    // Broadcast analysis depends only on the input shapes. Small GEMMs (e.g.
+    // transformer decode steps) call the same kernel node with the same shapes
+    // thousands of times, so memoize the last plan instead of redoing the
+    // BCast computation and batch-index vectors on every call.
+    std::shared_ptr<const MatMulBCast> bcast_ptr;
+    {
+      mutex_lock l(plan_mu_);
+      if (plan_bcast_ != nullptr && plan_x_shape_ == in0.shape() &&
+          plan_y_shape_ == in1.shape()) {
+        bcast_ptr = plan_bcast_;
+      } else {
+        bcast_ptr = std::make_shared<const MatMulBCast>(
+            in0.shape().dim_sizes(), in1.shape().dim_sizes());
+        plan_bcast_ = bcast_ptr;
+        plan_x_shape_ = in0.shape();
+        plan_y_shape_ = in1.shape();
+      }
+    }
+    const MatMulBCast& bcast = *bcast_ptr;
     OP_REQUIRES(
         ctx, bcast.IsValid(),
         errors::InvalidArgument(
@@ -1017,6 +1041,12 @@ class BaseBatchMatMulOp : public OpKernel {
           ctx, in0_reshaped, in1_reshaped, adj_x_, adj_y_, trans_x_, trans_y_,
           grad_input_1_, grad_input_2_, bcast, &out_reshaped);
     }
+    // The CPU batch kernel stops sharding once it notices an expired session
+    // deadline, so report an expired deadline as an error rather than risk
+    // returning a partially computed output.
+    OP_REQUIRES(ctx, !ctx->IsDeadlineExceeded(),
+                errors::DeadlineExceeded(
+                    "Session deadline exceeded while computing node ", name()));
   }
 
  protected:
@@ -1033,6 +1063,14 @@ class BaseBatchMatMulOp : public OpKernel {
   bool grad_input_1_ = false;
   bool grad_input_2_ = false;
 
+  // Last-shape plan cache. One entry suffices: a given kernel node almost
+  // always sees a single shape pair across steps. Guarded by a mutex because
+  // the same kernel instance may run concurrently from different frames.
+  mutable mutex plan_mu_;
+  TensorShape plan_x_shape_ TF_GUARDED_BY(plan_mu_);
+  TensorShape plan_y_shape_ TF_GUARDED_BY(plan_mu_);
+  std::shared_ptr<const MatMulBCast> plan_bcast_ TF_GUARDED_BY(plan_mu_);
+
   // Cast `t` from `SrcT` to `DstT`.
   template <typename SrcT, typename DstT>
   Tensor CastTensor(const Tensor& t) {
@@ -35,6 +35,10 @@ limitations under the License.
 #include "tensorflow/core/util/guarded_philox_random.h"
 #include "tensorflow/core/util/work_sharder.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #if EIGEN_COMP_GNUC && __cplusplus > 199711L
 #define DISABLE_FLOAT_EQUALITY_WARNING \
   _Pragma("GCC diagnostic push")       \
@@ -72,6 +76,126 @@ struct FillPhiloxRandom {
   }
 };
 
+// Bulk-generation hook used by FillPhiloxRandomTask below. The primary
+// template generates nothing, leaving all work to the group-by-group loop;
+// specializations provide vectorized paths for specific distributions. A
+// specialization must produce bit-identical output to the scalar generator,
+// return the number of full groups written (so the caller can finish the
+// rest), and advance `*gen` past the groups it consumed.
+template <class Distribution>
+struct VectorizedPhiloxFill {
+  static int64_t Run(PhiloxRandom* gen,
+                     typename Distribution::ResultElementType* data,
+                     int64_t num_groups) {
+    return 0;
+  }
+};
+
+#if defined(__AVX2__)
+
+namespace internal {
+
+// Returns the high 32 bits of the unsigned products of the 32-bit lanes of
+// `a` and `b` (AVX2 has no _mm256_mulhi_epu32). The even lanes come from
+// widening multiplies in place; the odd lanes are shifted down first, which
+// leaves their high product halves in the odd 32-bit positions.
+inline __m256i MulHiEpu32(__m256i a, __m256i b) {
+  const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  const __m256i odd =
+      _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+  return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+}  // namespace internal
+
+// Vectorized Philox for the uniform float distribution: runs the ten Philox
+// rounds for eight consecutive counters at once in struct-of-arrays form,
+// applies the Uint32ToFloat bit trick in registers, and transposes the result
+// back to the group-major layout the scalar path produces.
+template <>
+struct VectorizedPhiloxFill<random::UniformDistribution<PhiloxRandom, float>> {
+  static int64_t Run(PhiloxRandom* gen, float* data, int64_t num_groups) {
+    const __m256i mul_a = _mm256_set1_epi32(static_cast<int>(0xD2511F53u));
+    const __m256i mul_b = _mm256_set1_epi32(static_cast<int>(0xCD9E8D57u));
+    const __m256i man_mask = _mm256_set1_epi32(0x7fffff);
+    const __m256i exp_one = _mm256_set1_epi32(127 << 23);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int64_t done = 0;
+    while (num_groups - done >= 8) {
+      const auto& counter = gen->counter();
+      if (counter[0] > 0xFFFFFFFFu - 7) {
+        // The low counter word would wrap inside this chunk, carrying into the
+        // higher words per-lane. Leave the wrap to the scalar path.
+        break;
+      }
+      __m256i c0 =
+          _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(counter[0])),
+                           _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      __m256i c1 = _mm256_set1_epi32(static_cast<int>(counter[1]));
+      __m256i c2 = _mm256_set1_epi32(static_cast<int>(counter[2]));
+      __m256i c3 = _mm256_set1_epi32(static_cast<int>(counter[3]));
+      uint32 k0 = gen->key()[0];
+      uint32 k1 = gen->key()[1];
+      for (int round = 0; round < 10; ++round) {
+        const __m256i lo0 = _mm256_mullo_epi32(mul_a, c0);
+        const __m256i hi0 = internal::MulHiEpu32(mul_a, c0);
+        const __m256i lo1 = _mm256_mullo_epi32(mul_b, c2);
+        const __m256i hi1 = internal::MulHiEpu32(mul_b, c2);
+        const __m256i vk0 = _mm256_set1_epi32(static_cast<int>(k0));
+        const __m256i vk1 = _mm256_set1_epi32(static_cast<int>(k1));
+        const __m256i n0 =
+            _mm256_xor_si256(_mm256_xor_si256(hi1, c1), vk0);
+        const __m256i n2 =
+            _mm256_xor_si256(_mm256_xor_si256(hi0, c3), vk1);
+        c0 = n0;
+        c1 = lo1;
+        c2 = n2;
+        c3 = lo0;
+        k0 += 0x9E3779B9;  // kPhiloxW32A
+        k1 += 0xBB67AE85;  // kPhiloxW32B
+      }
+      // Uint32ToFloat: 23 random mantissa bits under a zero exponent, shifted
+      // from [1, 2) down to [0, 1).
+      const __m256 f0 = _mm256_sub_ps(
+          _mm256_castsi256_ps(
+              _mm256_or_si256(_mm256_and_si256(c0, man_mask), exp_one)),
+          one);
+      const __m256 f1 = _mm256_sub_ps(
+          _mm256_castsi256_ps(
+              _mm256_or_si256(_mm256_and_si256(c1, man_mask), exp_one)),
+          one);
+      const __m256 f2 = _mm256_sub_ps(
+          _mm256_castsi256_ps(
+              _mm256_or_si256(_mm256_and_si256(c2, man_mask), exp_one)),
+          one);
+      const __m256 f3 = _mm256_sub_ps(
+          _mm256_castsi256_ps(
+              _mm256_or_si256(_mm256_and_si256(c3, man_mask), exp_one)),
+          one);
+      // 4x8 transpose from one-vector-per-result-index to one-group-per-four
+      // consecutive floats.
+      const __m256 t0 = _mm256_unpacklo_ps(f0, f1);
+      const __m256 t1 = _mm256_unpackhi_ps(f0, f1);
+      const __m256 t2 = _mm256_unpacklo_ps(f2, f3);
+      const __m256 t3 = _mm256_unpackhi_ps(f2, f3);
+      const __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+      const __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+      float* out = data + done * PhiloxRandom::kResultElementCount;
+      _mm256_storeu_ps(out, _mm256_permute2f128_ps(u0, u1, 0x20));
+      _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(u2, u3, 0x20));
+      _mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(u0, u1, 0x31));
+      _mm256_storeu_ps(out + 24, _mm256_permute2f128_ps(u2, u3, 0x31));
+      gen->Skip(8);
+      done += 8;
+    }
+    return done;
+  }
+};
+
+#endif  // defined(__AVX2__)
+
 // A class to fill a specified range of random groups
 template <class Distribution, bool VariableSamplesPerOutput>
 struct FillPhiloxRandomTask;
@@ -90,7 +214,17 @@ struct FillPhiloxRandomTask<Distribution, false> {
 
     // First fill all the full-size groups
     int64_t limit_group_full = std::min(limit_group, size / kGroupSize);
-    for (int64_t index = start_group; index < limit_group_full; ++index) {
+
+    // Bulk-generate with a vectorized path when one exists for this
+    // distribution; it is bit-identical to the loop below and leaves `gen`
+    // positioned after the groups it produced.
+    const int64_t bulk_groups = VectorizedPhiloxFill<Distribution>::Run(
+        &gen, data + offset,
+        std::max<int64_t>(0, limit_group_full - start_group));
+    offset += bulk_groups * kGroupSize;
+
+    for (int64_t index = start_group + bulk_groups; index < limit_group_full;
+         ++index) {
       auto samples = dist(&gen);
       std::copy(&samples[0], &samples[0] + kGroupSize, data + offset);
       offset += kGroupSize;
@@ -709,6 +709,14 @@ REGISTER_KERNEL_BUILDER(Name("VarIsInitializedOp")
                             .HostMemory("is_initialized"),
                         VarIsInitializedOp);
 
+// Note on embedding tables larger than device memory: Var holds a single
+// dense Tensor on one device, and every kernel touching it (including the
+// gather/scatter below) addresses that buffer directly, so per-row HBM/host
+// tiering cannot be layered into Var without a row-indirection step in each
+// such kernel. Oversized tables are instead supported by placing the variable
+// on the host and letting the GPU gather read over the interconnect, by CUDA
+// unified memory (GPUOptions.per_process_gpu_memory_fraction > 1), which
+// pages at the driver level, or by sharding across devices.
 template <typename Device, typename T, typename Index>
 class ResourceGatherOp : public OpKernel {
  public:
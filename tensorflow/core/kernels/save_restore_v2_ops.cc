@@ -24,15 +24,19 @@ limitations under the License.
 #include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/framework/resource_mgr.h"
 #include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_util.h"
 #include "tensorflow/core/framework/types.h"
 #include "tensorflow/core/framework/types.pb.h"
 #include "tensorflow/core/kernels/checkpoint_callback_manager.h"
 #include "tensorflow/core/kernels/save_restore_tensor.h"
 #include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/io/path.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/logging.h"  // IWYU pragma: keep
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/util/env_var.h"
 #include "tensorflow/core/util/saved_tensor_slice_util.h"
 #include "tensorflow/core/util/tensor_bundle/naming.h"
 #include "tensorflow/core/util/tensor_bundle/tensor_bundle.h"
@@ -90,6 +94,111 @@ void ValidateInputs(bool is_save_op, OpKernelContext* context,
   }
 }
 
+// Whether SaveV2 runs in async mode: inputs are snapshotted into host
+// buffers (one copy per tensor) and the bundle is written from a background
+// thread, so the step loop is not stalled on checkpoint I/O.  A failed
+// background write is reported on the next SaveV2 call.
+bool AsyncSaveEnabled() {
+  static bool result = [] {
+    bool value = false;
+    TF_CHECK_OK(ReadBoolFromEnvVar("TF_SAVEV2_ASYNC",
+                                   /*default_val=*/false, &value));
+    return value;
+  }();
+  return result;
+}
+
+// Writes the given snapshotted tensors as a bundle under "prefix".  Shared by
+// the background write path; mirrors the in-place write loop in
+// SaveV2::Compute().
+absl::Status WriteSnapshotToBundle(const string& prefix,
+                                   const std::vector<string>& tensor_names,
+                                   const std::vector<string>& shape_specs,
+                                   const std::vector<Tensor>& tensors) {
+  BundleWriter writer(Env::Default(), prefix);
+  TF_RETURN_IF_ERROR(writer.status());
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    if (!shape_specs[i].empty()) {
+      TensorShape shape;
+      TensorSlice slice(tensors[i].dims());
+      TensorShape slice_shape;
+      TF_RETURN_IF_ERROR(checkpoint::ParseShapeAndSlice(shape_specs[i], &shape,
+                                                        &slice, &slice_shape));
+      if (!slice_shape.IsSameSize(tensors[i].shape())) {
+        return errors::InvalidArgument(
+            "Slice in shape_and_slice specification does not match the shape "
+            "of the tensor to save: ",
+            shape_specs[i], ", tensor: ", tensors[i].shape().DebugString());
+      }
+      TF_RETURN_IF_ERROR(
+          writer.AddSlice(tensor_names[i], shape, slice, tensors[i]));
+    } else {
+      TF_RETURN_IF_ERROR(writer.Add(tensor_names[i], tensors[i]));
+    }
+  }
+  return writer.Finish();
+}
+
+// Runs background bundle writes on a single thread, so concurrent SaveV2
+// executions are serialized in submission order, and carries the status of
+// failed writes forward to the next SaveV2 call.  Never destroyed: writes
+// scheduled near process exit race against teardown otherwise; callers are
+// expected to end training with a synchronous (or harvested) save.
+class AsyncSaveCoordinator {
+ public:
+  static AsyncSaveCoordinator* Get() {
+    static AsyncSaveCoordinator* coordinator = new AsyncSaveCoordinator();
+    return coordinator;
+  }
+
+  void Schedule(std::function<absl::Status()> write) {
+    {
+      mutex_lock l(mu_);
+      ++pending_;
+    }
+    pool_.Schedule([this, write = std::move(write)]() {
+      absl::Status s = write();
+      if (!s.ok()) {
+        LOG(ERROR) << "Async SaveV2 write failed: " << s;
+      }
+      mutex_lock l(mu_);
+      last_status_.Update(s);
+      if (--pending_ == 0) all_writes_done_.notify_all();
+    });
+  }
+
+  // Returns (and clears) the status of the first failed write since the last
+  // harvest.
+  absl::Status HarvestStatus() {
+    mutex_lock l(mu_);
+    absl::Status s = last_status_;
+    last_status_ = absl::OkStatus();
+    return s;
+  }
+
+  // Blocks until every scheduled write has completed, then returns (and
+  // clears) the status of the first failed write since the last harvest.
+  // Used by consumers of freshly written bundles (e.g. MergeV2Checkpoints),
+  // which must not observe a bundle whose write is still in flight.
+  absl::Status Flush() {
+    mutex_lock l(mu_);
+    while (pending_ > 0) all_writes_done_.wait(l);
+    absl::Status s = last_status_;
+    last_status_ = absl::OkStatus();
+    return s;
+  }
+
+ private:
+  AsyncSaveCoordinator()
+      : pool_(Env::Default(), "async_save_v2", /*num_threads=*/1) {}
+
+  mutex mu_;
+  condition_variable all_writes_done_;
+  int pending_ TF_GUARDED_BY(mu_) = 0;
+  absl::Status last_status_ TF_GUARDED_BY(mu_);
+  thread::ThreadPool pool_;
+};
+
 }  // namespace
 
 // Saves a list of named tensors using the tensor bundle library.
@@ -111,6 +220,12 @@ class SaveV2 : public OpKernel {
     const auto& tensor_names_flat = tensor_names.flat<tstring>();
     const auto& shape_and_slices_flat = shape_and_slices.flat<tstring>();
 
+    if (AsyncSaveEnabled()) {
+      AsyncSave(context, prefix_string, tensor_names_flat,
+                shape_and_slices_flat, num_tensors);
+      return;
+    }
+
     BundleWriter writer(Env::Default(), prefix_string);
     OP_REQUIRES_OK(context, writer.status());
     VLOG(1) << "BundleWriter, prefix_string: " << prefix_string;
@@ -182,6 +297,67 @@ class SaveV2 : public OpKernel {
       checkpoint_callback_manager->Unref();
     }
   }
+
+ private:
+  // Async save path: snapshots the input tensors into host buffers and hands
+  // the bundle write to the AsyncSaveCoordinator, returning control to the
+  // step loop after one copy per tensor.  A failure of a previous background
+  // write is surfaced here, before the new save is scheduled.
+  void AsyncSave(OpKernelContext* context, const string& prefix_string,
+                 const TTypes<tstring>::ConstFlat& tensor_names_flat,
+                 const TTypes<tstring>::ConstFlat& shape_and_slices_flat,
+                 int num_tensors) {
+    const int kFixedInputs = 3;  // Prefix, tensor names, shape_and_slices.
+    AsyncSaveCoordinator* coordinator = AsyncSaveCoordinator::Get();
+    OP_REQUIRES_OK(context, coordinator->HarvestStatus());
+
+    std::vector<string> names(num_tensors);
+    std::vector<string> shape_specs(num_tensors);
+    std::vector<Tensor> snapshots;
+    snapshots.reserve(num_tensors);
+    for (int i = 0; i < num_tensors; ++i) {
+      names[i] = tensor_names_flat(i);
+      shape_specs[i] = shape_and_slices_flat(i);
+      snapshots.push_back(tensor::DeepCopy(context->input(i + kFixedInputs)));
+    }
+
+    // Retains a reference to the callback manager for the background thread;
+    // callbacks fire only once the bundle is on disk.
+    checkpoint::CheckpointCallbackManager* checkpoint_callback_manager =
+        nullptr;
+    ResourceMgr* resource_manager = context->resource_manager();
+    if (resource_manager != nullptr) {
+      OP_REQUIRES_OK(
+          context,
+          resource_manager
+              ->LookupOrCreate<checkpoint::CheckpointCallbackManager>(
+                  resource_manager->default_container(),
+                  std::string(
+                      checkpoint::kCheckpointCallbackManagerResourceName),
+                  &checkpoint_callback_manager,
+                  [](checkpoint::CheckpointCallbackManager** out) {
+                    *out = new checkpoint::CheckpointCallbackManager();
+                    return absl::OkStatus();
+                  }));
+    }
+
+    coordinator->Schedule([prefix_string, names = std::move(names),
+                           shape_specs = std::move(shape_specs),
+                           snapshots = std::move(snapshots),
+                           checkpoint_callback_manager]() -> absl::Status {
+      VLOG(1) << "Async BundleWriter, prefix_string: " << prefix_string;
+      absl::Status s =
+          WriteSnapshotToBundle(prefix_string, names, shape_specs, snapshots);
+      if (checkpoint_callback_manager != nullptr) {
+        if (s.ok()) {
+          checkpoint_callback_manager->Save(prefix_string);
+        }
+        checkpoint_callback_manager->Unref();
+      }
+      VLOG(1) << "Done async BundleWriter, prefix_string: " << prefix_string;
+      return s;
+    });
+  }
 };
 REGISTER_KERNEL_BUILDER(Name("SaveV2").Device(DEVICE_CPU), SaveV2);
 
@@ -287,6 +463,15 @@ class MergeV2Checkpoints : public OpKernel {
         absl::Span<const tstring>(checkpoint_prefixes.flat<tstring>());
     Env* env = Env::Default();
     const string& merged_prefix = destination_prefix.scalar<tstring>()();
+
+    // With async SaveV2, the shard bundles named by `checkpoint_prefixes` may
+    // still be queued on the coordinator.  Drain it so the merge reads fully
+    // written bundles, and surface any failed background write here rather
+    // than as a NotFound on the missing shard (or, with allow_missing_files,
+    // a silently incomplete merged checkpoint).
+    if (AsyncSaveEnabled()) {
+      OP_REQUIRES_OK(context, AsyncSaveCoordinator::Get()->Flush());
+    }
     OP_REQUIRES_OK(context,
                    tensorflow::MergeBundles(env, input_prefixes, merged_prefix,
                                             allow_missing_files_));
@@ -16,6 +16,8 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_KERNELS_SCATTER_FUNCTOR_H_
 #define TENSORFLOW_CORE_KERNELS_SCATTER_FUNCTOR_H_
 
+#include <algorithm>
+#include <atomic>
 #include <type_traits>
 
 #include "Eigen/Core"  // from @eigen_archive
@@ -144,39 +146,48 @@ struct ScatterFunctorBase {
                         typename TTypes<Index>::ConstFlat indices) {
     const Index N = static_cast<Index>(indices.size());
     const Index limit = static_cast<Index>(params.dimension(0));
-    const Index kMaxLocks = 1024;
-    const Index entries_per_lock = (limit + kMaxLocks - 1) / kMaxLocks;
-    // To reduce the number of locks and the memory usage, we divide the whole
-    // index space into kMaxLocks regions with each lock serializing access to
-    // a region.
-    mutex accessed[kMaxLocks];
+    const DeviceBase::CpuWorkerThreads& worker_threads =
+        *(c->device()->tensorflow_cpu_worker_threads());
+    // Partition the row space so that each shard owns a disjoint range of
+    // rows: a shard scans all indices but applies only the updates whose
+    // destination row it owns. Updates are conflict-free without locking, and
+    // duplicate updates to one row stay in their original order on a single
+    // thread, so a heavily repeated ("hot") row costs its owner a tight local
+    // loop instead of serializing every shard behind a region lock.
+    const Index num_shards = std::max<Index>(
+        1, std::min(static_cast<Index>(worker_threads.num_threads), limit));
+    const Index rows_per_shard = (limit + num_shards - 1) / num_shards;
     std::atomic<Index> bad_index(-1);
-    auto ParallelScatter = [&](Index start, Index end) {
-      for (Index i = start; i < end; ++i) {
-        // Grab the index and check its validity.  Do this carefully,
-        // to avoid checking the value and grabbing it again from
-        // memory a second time (a security risk since it may change in
-        // between).
-        const Index index = ::tensorflow::internal::SubtleMustCopy(indices(i));
-        if (!FastBoundsCheck(index, limit)) {
-          bad_index = i;
-          return;
-        }
-        const Index lock_id = index / entries_per_lock;
-        // Copy last Ndim-1 dimensions of updates[i] to params[index]
-        {
-          mutex_lock l(accessed[lock_id]);
+    auto ParallelScatter = [&](Index first_shard, Index last_shard) {
+      for (Index shard = first_shard; shard < last_shard; ++shard) {
+        const Index row_begin = shard * rows_per_shard;
+        const Index row_end = std::min(row_begin + rows_per_shard, limit);
+        for (Index i = 0; i < N; ++i) {
+          // Grab the index and check its validity.  Do this carefully,
+          // to avoid checking the value and grabbing it again from
+          // memory a second time (a security risk since it may change in
+          // between).
+          const Index index =
+              ::tensorflow::internal::SubtleMustCopy(indices(i));
+          if (!FastBoundsCheck(index, limit)) {
+            bad_index = i;
+            return;
+          }
+          if (index < row_begin || index >= row_end) continue;
+          // Copy last Ndim-1 dimensions of updates[i] to params[index]
           scatter_op::internal::Assign<op>::Run(params.template chip<0>(index),
                                                 updates.template chip<0>(i));
         }
       }
     };
+    // Per-shard cost: one pass over the indices plus this shard's share of
+    // the row moves.
     const float kMovingCost = 2.5f;
-    float shard_cost = kMovingCost * params.dimension(1);
-    const DeviceBase::CpuWorkerThreads& worker_threads =
-        *(c->device()->tensorflow_cpu_worker_threads());
-    Shard(worker_threads.num_threads, worker_threads.workers, N, shard_cost,
-          ParallelScatter);  // TODO: Come up with a good cost estimate.
+    const float shard_cost =
+        static_cast<float>(N) + kMovingCost * params.dimension(1) *
+                                    (static_cast<float>(N) / num_shards);
+    Shard(worker_threads.num_threads, worker_threads.workers, num_shards,
+          shard_cost, ParallelScatter);
     return bad_index;
   }
   Index SerialExecute(OpKernelContext* c, const Device& d,
@@ -25,6 +25,8 @@ limitations under the License.
 #include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/kernels/fill_functor.h"
 #include "tensorflow/core/platform/bfloat16.h"
+#include "tensorflow/core/platform/prefetch.h"
+#include "tensorflow/core/util/work_sharder.h"
 
 namespace tensorflow {
 
@@ -251,13 +253,80 @@ absl::Status MOutOfBoundsError(int64_t m, std::size_t i, int lhs_index_a,
                                  "] out of bounds (>=", out_dim0, ")");
 }
 
+// Returns true iff the first index column of `a_indices` is non-decreasing
+// and every index is within bounds.  Canonically ordered sparse tensors (the
+// output of tf.sparse.reorder and of most input pipelines) satisfy this, which
+// means the COO triplets are already grouped into CSR-style row runs and no
+// per-call re-sorting is needed.
+template <typename Tindices>
+bool IndicesRowSortedAndInBounds(
+    typename TTypes<Tindices>::ConstMatrix a_indices, int64_t out_dim0,
+    std::size_t lhs_right) {
+  const std::size_t nnz = a_indices.dimension(0);
+  Tindices prev_m = 0;
+  for (std::size_t i = 0; i < nnz; ++i) {
+    const Tindices m = internal::SubtleMustCopy(a_indices(i, 0));
+    const Tindices k = internal::SubtleMustCopy(a_indices(i, 1));
+    if (m < prev_m || !FastBoundsCheck(m, out_dim0) ||
+        !FastBoundsCheck(k, lhs_right)) {
+      return false;
+    }
+    prev_m = m;
+  }
+  return true;
+}
+
+// Multiplies row-sorted COO triplets against a row-major dense matrix,
+// parallelized over disjoint ranges of output rows.  Shard boundaries are
+// advanced to the next row run so that each output row is written by exactly
+// one thread; no locking or atomics are required.  All indices must have been
+// bounds-checked by the caller.
+template <typename T, typename Tsum, typename Tindices>
+void SparseTensorDenseMatMulRowBlocked(
+    OpKernelContext* ctx, typename TTypes<Tsum>::Matrix out,
+    typename TTypes<Tindices>::ConstMatrix a_indices,
+    typename TTypes<T>::ConstVec a_values, typename TTypes<T>::ConstMatrix b) {
+  const int64_t nnz = a_values.size();
+  const int64_t rhs_right = b.dimension(1);
+  auto worker_threads = *(ctx->device()->tensorflow_cpu_worker_threads());
+  auto work = [&a_indices, &a_values, &b, &out, nnz, rhs_right](int64_t start,
+                                                                int64_t limit) {
+    // Own a row only if its run begins inside [start, limit).
+    while (start > 0 && start < nnz &&
+           a_indices(start, 0) == a_indices(start - 1, 0)) {
+      ++start;
+    }
+    while (limit < nnz && a_indices(limit, 0) == a_indices(limit - 1, 0)) {
+      ++limit;
+    }
+    for (int64_t i = start; i < limit; ++i) {
+      if (i + 1 < limit) {
+        // The dense rows are visited in data-dependent order; prefetching the
+        // next one hides most of the memory latency at low densities.
+        port::prefetch<port::PREFETCH_HINT_T0>(
+            b.data() + a_indices(i + 1, 1) * rhs_right);
+      }
+      const Tindices m = a_indices(i, 0);
+      const Tindices k = a_indices(i, 1);
+      out.template chip<0>(m) +=
+          b.template chip<0>(k).template cast<Tsum>() *
+          static_cast<Tsum>(a_values(i));
+    }
+  };
+  Shard(worker_threads.num_threads, worker_threads.workers, nnz,
+        /*cost_per_unit=*/5 * rhs_right, work);
+}
+
 template <typename T, typename Tsum, typename Tindices, bool ADJ_A, bool ADJ_B>
 absl::Status SparseTensorDenseMatMulImpl(
-    typename TTypes<Tsum>::Matrix out,
+    OpKernelContext* ctx, typename TTypes<Tsum>::Matrix out,
     typename TTypes<Tindices>::ConstMatrix a_indices,
     typename TTypes<T>::ConstVec a_values, typename TTypes<T>::ConstMatrix b) {
   // Vectorize certain operations above this size.
   static constexpr std::size_t kNumVectorize = 32;
+  // Only attempt the parallel row-blocked path when there is enough work to
+  // amortize the validation scan and sharding overhead.
+  static constexpr std::size_t kMinNnzRowBlocked = 512;
 
   const std::size_t nnz = a_values.size();
   const std::size_t rhs_right = (ADJ_B ? b.dimension(0) : b.dimension(1));
@@ -268,6 +337,21 @@ absl::Status SparseTensorDenseMatMulImpl(
   // TODO(ebrevdo): After many failed experiments, can't find a multi-threaded
   // approach that achieves the performance of the single threaded
   // one.  Perhaps Eigen threadpool implementation is just too slow?
+  //
+  // Scattering arbitrary COO triplets from multiple threads indeed does not
+  // pay off, but when the indices are already row-sorted the output rows can
+  // be partitioned into disjoint contiguous runs and processed in parallel
+  // with no synchronization.  A single O(nnz) scan detects this case (and
+  // doubles as the bounds check), so unsorted inputs fall through to the
+  // single-threaded code below at negligible cost.
+  if (!ADJ_A && !ADJ_B && rhs_right >= kNumVectorize &&
+      nnz >= kMinNnzRowBlocked &&
+      IndicesRowSortedAndInBounds<Tindices>(a_indices, out.dimension(0),
+                                            lhs_right)) {
+    SparseTensorDenseMatMulRowBlocked<T, Tsum, Tindices>(ctx, out, a_indices,
+                                                         a_values, b);
+    return absl::OkStatus();
+  }
 
   if (rhs_right < kNumVectorize) {
     // Disable vectorization if the RHS of output is too small
@@ -341,7 +425,7 @@ struct SparseTensorDenseMatMulFunctor<CPUDevice, T, Tindices, ADJ_A, ADJ_B> {
       temp_out.setZero();
       TF_RETURN_IF_ERROR(
           SparseTensorDenseMatMulImpl<T, Tsum, Tindices, ADJ_A, ADJ_B>(
-              temp_out, a_indices, a_values, b));
+              ctx, temp_out, a_indices, a_values, b));
       out = temp_out.template cast<T>();
     } else {
       out.setZero();
@@ -351,7 +435,7 @@ struct SparseTensorDenseMatMulFunctor<CPUDevice, T, Tindices, ADJ_A, ADJ_B> {
           *reinterpret_cast<typename TTypes<Tsum>::Matrix*>(&out);
       TF_RETURN_IF_ERROR(
           SparseTensorDenseMatMulImpl<T, Tsum, Tindices, ADJ_A, ADJ_B>(
-              out_workaround, a_indices, a_values, b));
+              ctx, out_workaround, a_indices, a_values, b));
     }
     return absl::OkStatus();
   }
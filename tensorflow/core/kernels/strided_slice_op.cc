@@ -143,6 +143,49 @@ class StridedSliceOp : public OpKernel {
       return;
     }
 
+    // Optimization #2b, as #2 but with leading size-1 dimensions collapsed
+    // away: a unit-stride slice of the first non-degenerate dimension that
+    // takes all later dimensions in full is still memory contiguous, so the
+    // output can alias the input buffer. This covers e.g. truncating the time
+    // dimension of a [1, time, channels] tensor.
+    if (input.dims() >= 2) {
+      int sliced_dim = 0;
+      while (sliced_dim < input.dims() && input.dim_size(sliced_dim) == 1) {
+        ++sliced_dim;
+      }
+      bool contiguous = sliced_dim > 0 && sliced_dim < input.dims() &&
+                        strides[sliced_dim] == 1;
+      // The leading size-1 dimensions must be taken in full.
+      for (int i = 0; contiguous && i < sliced_dim; ++i) {
+        contiguous = begin[i] == 0 && end[i] == 1;
+      }
+      // All dimensions after the sliced one must be taken in full.
+      for (int i = sliced_dim + 1; contiguous && i < input.dims(); ++i) {
+        contiguous =
+            strides[i] == 1 && begin[i] == 0 && end[i] == input.dim_size(i);
+      }
+      if (contiguous) {
+        TensorShape collapsed_shape = input.shape();
+        collapsed_shape.RemoveDimRange(0, sliced_dim);
+        if (IsDim0SliceAligned<T>(collapsed_shape, begin[sliced_dim],
+                                  end[sliced_dim])) {
+          VLOG(1) << "Strided slice dim " << sliced_dim << ": "
+                  << input.shape().DebugString();
+          Tensor collapsed;
+          OP_REQUIRES(context, collapsed.CopyFrom(input, collapsed_shape),
+                      errors::Internal("Copy failed"));
+          // To tolerate begin > end (a 0-output slice), we min(begin, end).
+          Tensor slice = collapsed.Slice(
+              std::min(begin[sliced_dim], end[sliced_dim]), end[sliced_dim]);
+          Tensor tmp;
+          OP_REQUIRES(context, tmp.CopyFrom(slice, final_shape),
+                      errors::Internal("Copy failed"));
+          context->set_output(0, tmp);
+          return;
+        }
+      }
+    }
+
     Tensor* result = nullptr;
     OP_REQUIRES_OK(context, context->allocate_output(0, final_shape, &result));
     const int input_dims = input.dims();
@@ -20,6 +20,7 @@ limitations under the License.
 #include "tensorflow/core/framework/kernel_def_builder.h"
 #include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/kernels/string_util.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
@@ -124,16 +125,17 @@ std::vector<StringPiece> SplitV2(const tstring& str, StringPiece sep,
   }
 
   if (sep.empty()) {
-    StringPiece token;
-    // Remove leading whitespaces.
-    str_util::RemoveLeadingWhitespace(&text);
+    // Scan for whitespace/non-whitespace boundaries with the SIMD-accelerated
+    // helpers; runs of consecutive whitespace act as a single separator.
+    size_t token_start = FindNonAsciiWhitespace(text, 0);
     int split = 0;
-    while (str_util::ConsumeNonWhitespace(&text, &token)) {
-      result.push_back(token);
-      str_util::RemoveLeadingWhitespace(&text);
+    while (token_start < text.size()) {
+      const size_t token_end = FindAsciiWhitespace(text, token_start);
+      result.push_back(text.substr(token_start, token_end - token_start));
+      token_start = FindNonAsciiWhitespace(text, token_end);
       ++split;
       if (maxsplit > 0 && split == maxsplit) {
-        result.push_back(text);
+        result.push_back(text.substr(token_start));
         return result;
       }
     }
@@ -14,8 +14,15 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/kernels/string_util.h"
 
+#include "absl/strings/ascii.h"
 #include "tensorflow/core/lib/core/errors.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace tensorflow {
 
 // Sets unit value based on str.
@@ -62,4 +69,112 @@ int32 UTF8StrLen(const string& str) {
   return result;
 }
 
+namespace {
+
+#if defined(__AVX2__)
+// Returns a bitmask with bit i set iff byte i of `block` is ASCII whitespace.
+// The whitespace set matches absl::ascii_isspace: ' ' plus the control range
+// '\t' (9) through '\r' (13). The signed compares are safe because bytes >=
+// 0x80 are negative and fail the lower-bound test.
+inline uint32 AsciiWhitespaceMask(__m256i block) {
+  const __m256i ws =
+      _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')),
+                      _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8('\t' - 1)),
+                                       _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), block)));
+  return static_cast<uint32>(_mm256_movemask_epi8(ws));
+}
+#elif defined(__SSE2__)
+// See the AVX2 variant above for the classification scheme.
+inline uint32 AsciiWhitespaceMask(__m128i block) {
+  const __m128i ws =
+      _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+                   _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('\t' - 1)),
+                                 _mm_cmpgt_epi8(_mm_set1_epi8('\r' + 1), block)));
+  return static_cast<uint32>(_mm_movemask_epi8(ws));
+}
+#endif
+
+// Index of the lowest set bit. Only called with nonzero masks.
+inline size_t LowestSetBit(uint32 mask) {
+  return static_cast<size_t>(__builtin_ctz(mask));
+}
+
+}  // namespace
+
+size_t AsciiPrefixLength(StringPiece str) {
+  const char* data = str.data();
+  const size_t size = str.size();
+  size_t i = 0;
+#if defined(__AVX2__)
+  for (; i + 32 <= size; i += 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    // The sign bit of each byte is set iff the byte is non-ASCII.
+    const uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(block));
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#elif defined(__SSE2__)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(block));
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (static_cast<unsigned char>(data[i]) >= 0x80) return i;
+  }
+  return size;
+}
+
+size_t FindAsciiWhitespace(StringPiece str, size_t pos) {
+  const char* data = str.data();
+  const size_t size = str.size();
+  size_t i = pos;
+#if defined(__AVX2__)
+  for (; i + 32 <= size; i += 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const uint32 mask = AsciiWhitespaceMask(block);
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#elif defined(__SSE2__)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const uint32 mask = AsciiWhitespaceMask(block);
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (absl::ascii_isspace(data[i])) return i;
+  }
+  return size;
+}
+
+size_t FindNonAsciiWhitespace(StringPiece str, size_t pos) {
+  const char* data = str.data();
+  const size_t size = str.size();
+  size_t i = pos;
+#if defined(__AVX2__)
+  for (; i + 32 <= size; i += 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const uint32 mask = ~AsciiWhitespaceMask(block);
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#elif defined(__SSE2__)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const uint32 mask = ~AsciiWhitespaceMask(block) & 0xFFFF;
+    if (mask != 0) return i + LowestSetBit(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (!absl::ascii_isspace(data[i])) return i;
+  }
+  return size;
+}
+
 }  // namespace tensorflow
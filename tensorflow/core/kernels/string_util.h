@@ -42,6 +42,20 @@ absl::Status ParseCharUnit(const string& str, CharUnit* unit);
 // Result may be incorrect if the input string is not valid UTF-8.
 int32 UTF8StrLen(const string& str);
 
+// Returns the length of the leading run of ASCII (< 0x80) bytes in `str`.
+// Equal to str.size() iff the string is pure ASCII (and therefore trivially
+// valid UTF-8). Uses SSE2/AVX2 when available to scan 16/32 bytes at a time.
+size_t AsciiPrefixLength(StringPiece str);
+
+// Returns the index of the first ASCII whitespace byte (as defined by
+// absl::ascii_isspace: space, \t, \n, \v, \f, \r) at or after `pos`, or
+// str.size() if there is none. Uses SSE2/AVX2 when available.
+size_t FindAsciiWhitespace(StringPiece str, size_t pos);
+
+// Returns the index of the first byte at or after `pos` that is not ASCII
+// whitespace, or str.size() if there is none. Uses SSE2/AVX2 when available.
+size_t FindNonAsciiWhitespace(StringPiece str, size_t pos);
+
 // Get the next UTF8 character position starting at the given position and
 // skipping the given number of characters. Position is a byte offset, and
 // should never be `null`. The function return true if successful. However, if
@@ -127,6 +127,66 @@ class TopK : public OpKernel {
   bool sorted_;
 };
 
+namespace {
+
+// Partial selection below kicks in when k is at most num_cols /
+// kPartialSelectionRatio and the row is at least kPartialSelectionMinCols
+// wide; for smaller rows or larger k the heap is already competitive.
+constexpr int64_t kPartialSelectionRatio = 16;
+constexpr int64_t kPartialSelectionMinCols = 4096;
+
+// Collects into `candidates` the column indices whose values are candidates
+// for the top k of the row, using a sampled threshold: the k-th largest value
+// is estimated from a strided sample (undershooting on purpose), and a filter
+// pass keeps every element not below the estimate. When the filter keeps at
+// least k elements, the true top k are all among them, since the k-th largest
+// overall can then not be below the threshold. Returns false when the filter
+// kept fewer than k candidates or pathologically many (near-constant rows),
+// in which case the caller should fall back to the heap.
+template <typename T, typename Tidx>
+bool SelectTopKViaSampledThreshold(const T* input_data, int64_t num_cols,
+                                   int64_t k, std::vector<Tidx>* candidates) {
+  const int64_t sample_size = std::min<int64_t>(num_cols, 2048);
+  const int64_t stride = num_cols / sample_size;
+  std::vector<T> sample;
+  sample.reserve(sample_size);
+  for (int64_t i = 0; i < sample_size; ++i) {
+    sample.push_back(input_data[i * stride]);
+  }
+  // A sample element of descending rank r estimates overall rank
+  // r * num_cols / sample_size, so aim below rank k by a 1.5x margin to make
+  // the filter pass keep somewhat more than k elements.
+  const int64_t rank = std::max<int64_t>(
+      1, 3 * k * sample_size / (2 * num_cols));
+  std::nth_element(sample.begin(), sample.begin() + (rank - 1), sample.end(),
+                   [](const T& a, const T& b) { return b < a; });
+  const T threshold = sample[rank - 1];
+
+  const int64_t cap = std::max<int64_t>(8 * k, 16384);
+  constexpr int64_t kBlockSize = 64;
+  candidates->reserve(std::min(cap, num_cols));
+  for (int64_t base = 0; base < num_cols; base += kBlockSize) {
+    const int64_t end = std::min(num_cols, base + kBlockSize);
+    // First scan the block with a branch-free reduction the compiler can
+    // vectorize; with a well-chosen threshold nearly every block has no
+    // candidate and is skipped without taking the push-back loop.
+    bool block_has_candidate = false;
+    for (int64_t c = base; c < end; ++c) {
+      block_has_candidate |= !(input_data[c] < threshold);
+    }
+    if (!block_has_candidate) continue;
+    for (int64_t c = base; c < end; ++c) {
+      if (!(input_data[c] < threshold)) {
+        candidates->push_back(static_cast<Tidx>(c));
+      }
+    }
+    if (static_cast<int64_t>(candidates->size()) > cap) return false;
+  }
+  return static_cast<int64_t>(candidates->size()) >= k;
+}
+
+}  // namespace
+
 namespace functor {
 
 template <typename T, typename Tidx>
@@ -205,24 +265,40 @@ struct TopKFunctor<CPUDevice, T, Tidx> {
             run_begin = run_end;
           }
         } else {
-          // Use the TopN heap object to sort.
-          gtl::TopN<Tidx, decltype(stable_comp)> filter(k, stable_comp);
-          filter.reserve(num_cols);
-          for (Tidx c = 0; c < num_cols; ++c) {
-            filter.push(c);
-          }
-
-          int32_t i = 0;
-          if (sorted) {
-            std::unique_ptr<std::vector<Tidx>> top_k(filter.Extract());
-            for (auto top_k_it = top_k->begin(); top_k_it != top_k->end();
-                 ++top_k_it, ++i) {
-              indices(b, i) = *top_k_it;
-            }
+          // For k much smaller than num_cols, a sampled-threshold partial
+          // selection touches every element once instead of pushing it
+          // through a k-heap; fall through to the heap when the filter pass
+          // fails to isolate the top k (see SelectTopKViaSampledThreshold).
+          std::vector<Tidx> candidates;
+          if (num_cols >= kPartialSelectionMinCols &&
+              k * kPartialSelectionRatio <= num_cols &&
+              SelectTopKViaSampledThreshold(input_data, num_cols,
+                                            static_cast<int64_t>(k),
+                                            &candidates)) {
+            std::partial_sort(candidates.begin(), candidates.begin() + k,
+                              candidates.end(), stable_comp);
+            std::copy(candidates.begin(), candidates.begin() + k,
+                      &indices(b, 0));
           } else {
-            for (auto top_k_it = filter.unsorted_begin();
-                 top_k_it != filter.unsorted_end(); ++top_k_it, ++i) {
-              indices(b, i) = *top_k_it;
+            // Use the TopN heap object to sort.
+            gtl::TopN<Tidx, decltype(stable_comp)> filter(k, stable_comp);
+            filter.reserve(num_cols);
+            for (Tidx c = 0; c < num_cols; ++c) {
+              filter.push(c);
+            }
+
+            int32_t i = 0;
+            if (sorted) {
+              std::unique_ptr<std::vector<Tidx>> top_k(filter.Extract());
+              for (auto top_k_it = top_k->begin(); top_k_it != top_k->end();
+                   ++top_k_it, ++i) {
+                indices(b, i) = *top_k_it;
+              }
+            } else {
+              for (auto top_k_it = filter.unsorted_begin();
+                   top_k_it != filter.unsorted_end(); ++top_k_it, ++i) {
+                indices(b, i) = *top_k_it;
+              }
             }
           }
         }
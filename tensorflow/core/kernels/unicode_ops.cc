@@ -300,8 +300,21 @@ class UnicodeTranscodeOp : public OpKernel {
     }
 
     auto output_flat = output_tensor->flat<tstring>();
+    // ASCII bytes encode identically in UTF-8 input and output, so when both
+    // sides are UTF-8 and no control-character replacement is requested, a
+    // pure-ASCII string is already in its final form and the ICU round trip
+    // can be skipped. AsciiPrefixLength vets the whole string with a SIMD
+    // scan, which is the common case for ASCII-dominant text workloads.
+    const bool ascii_passthrough =
+        ucnv_getType(input_encoder->converter_) == UCNV_UTF8 &&
+        output_encoding_ == UnicodeEncoding::UTF8 &&
+        !error_options_.replace_control_chars;
     bool found_any_format_error = false;
     for (size_t i = 0; i < output_flat.size(); ++i) {
+      if (ascii_passthrough &&
+          AsciiPrefixLength(output_flat(i)) == output_flat(i).size()) {
+        continue;
+      }
       Transcode(&(output_flat(i)), input_encoder->converter_,
                 &found_any_format_error);
     }
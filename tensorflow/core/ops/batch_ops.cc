@@ -93,6 +93,14 @@ REGISTER_OP("BatchFunction")
     .Attr(
         "batch_padding_policy: "
         "{'PAD_UP', 'BATCH_DOWN', 'MINIMIZE_TPU_COST_PER_REQUEST'} = 'PAD_UP'")
+    // If non-empty, enables bucketed batching by sequence length for
+    // variable-length inputs. Each rank >= 2 input tensor is zero-padded along
+    // dimension 1 up to the smallest boundary that fits it, and requests are
+    // routed to a per-shape batcher queue, so a batch only ever contains
+    // requests padded to the same length. Entries must be positive and
+    // strictly increasing. Inputs longer than the largest boundary are not
+    // padded and only batch with inputs of identical length.
+    .Attr("bucket_boundaries: list(int) = []")
     .Attr("Tin: list(type)")
     .Attr("Tcaptured: list(type) >= 0")
     .Attr("Tout: list(type)")
@@ -1473,6 +1473,20 @@ REGISTER_OP("SparseSegmentSqrtNGradV2")
     .Attr("Tsegmentids: {int32, int64} = DT_INT32")
     .SetShapeFn(SparseSegmentReductionGradV2ShapeFn);
 
+// Fused Gather + sorted-segment reduction (embedding lookup + pooling).
+// Equivalent to SparseSegmentSum/SparseSegmentMean over params[indices] but
+// implemented without materializing the gathered intermediate.
+REGISTER_OP("GatherSegmentReduce")
+    .Input("params: T")
+    .Input("indices: Tidx")
+    .Input("segment_ids: Tsegmentids")
+    .Output("output: T")
+    .Attr("T: {float, double}")
+    .Attr("Tidx: {int32, int64} = DT_INT32")
+    .Attr("Tsegmentids: {int32, int64} = DT_INT32")
+    .Attr("combiner: {'sum', 'mean'} = 'sum'")
+    .SetShapeFn(SparseSegmentReductionShapeFn);
+
 REGISTER_OP("All")
     .Input("input: bool")
     .Input("reduction_indices: Tidx")
@@ -1945,6 +1959,26 @@ REGISTER_OP("QuantizedMatMul")
       return absl::OkStatus();
     });
 
+// MatMul of float activations against int8 weights, with the weights
+// dequantized on the fly inside the GEMM. `b_scale` is the symmetric
+// quantization scale of the weights: either a scalar (per-tensor) or a vector
+// with one entry per output column (per-channel). Intended as a drop-in
+// substitute for MatMul when the weight operand carries quantization
+// metadata; the activations stay in float throughout.
+REGISTER_OP("DequantizeMatMul")
+    .Input("a: float")
+    .Input("b: int8")
+    .Input("b_scale: float")
+    .Output("product: float")
+    .Attr("transpose_a: bool = false")
+    .Attr("transpose_b: bool = false")
+    .SetShapeFn([](InferenceContext* c) {
+      TF_RETURN_IF_ERROR(shape_inference::MatMulShape(c));
+      ShapeHandle unused;
+      TF_RETURN_IF_ERROR(c->WithRankAtMost(c->input(2), 1, &unused));
+      return absl::OkStatus();
+    });
+
 // Note: This op is not commutative w.r.t. to all its inputs.
 REGISTER_OP("QuantizedMul")
     .Input("x: T1")
@@ -1291,6 +1291,24 @@ REGISTER_OP("Softmax")
 
 // --------------------------------------------------------------------------
 
+REGISTER_OP("_FusedLayerNorm")
+    .Input("x: T")
+    .Input("scale: T")
+    .Input("offset: T")
+    .Output("y: T")
+    .Attr("T: {float, bfloat16}")
+    .Attr("epsilon: float = 0.001")
+    .SetShapeFn(shape_inference::UnchangedShape)
+    .Doc(R"doc(
+Normalizes `x` over its last dimension, then scales and shifts the result.
+
+*NOTE*: Do not invoke this operator directly in Python. The grappler remapper
+pass is expected to create it by fusing the decomposed layer-normalization
+subgraph emitted by the Python layer-normalization APIs.
+)doc");
+
+// --------------------------------------------------------------------------
+
 REGISTER_OP("LogSoftmax")
     .Input("logits: T")
     .Output("logsoftmax: T")
@@ -831,6 +831,44 @@ REGISTER_OP("ResourceApplyAdam")
     .Attr("use_nesterov: bool = false")
     .SetShapeFn(ApplyAdamShapeFn</*is_resource=*/true>);
 
+static absl::Status ResourceMultiApplyAdamShapeFn(InferenceContext* c) {
+  int32_t n;
+  TF_RETURN_IF_ERROR(c->GetAttr("N", &n));
+  ShapeHandle unused;
+  for (int i = 0; i < n; ++i) {
+    ShapeHandle s = ShapeOrHandleShape<true>(c, i);  // var
+    TF_RETURN_IF_ERROR(
+        c->Merge(s, ShapeOrHandleShape<true>(c, n + i), &s));  // m
+    TF_RETURN_IF_ERROR(
+        c->Merge(s, ShapeOrHandleShape<true>(c, 2 * n + i), &s));  // v
+    TF_RETURN_IF_ERROR(c->Merge(s, c->input(3 * n + 6 + i), &s));  // grad
+  }
+  for (int i = 3 * n; i < 3 * n + 6; ++i) {  // the six shared scalars
+    TF_RETURN_IF_ERROR(c->WithRank(c->input(i), 0, &unused));
+  }
+  return absl::OkStatus();
+}
+
+// Multi-tensor variant of ResourceApplyAdam: updates N variables in one op
+// so that a large optimizer step pays per-op dispatch overhead once instead
+// of once per variable.
+REGISTER_OP("ResourceMultiApplyAdam")
+    .Input("var: N * resource")
+    .Input("m: N * resource")
+    .Input("v: N * resource")
+    .Input("beta1_power: T")
+    .Input("beta2_power: T")
+    .Input("lr: T")
+    .Input("beta1: T")
+    .Input("beta2: T")
+    .Input("epsilon: T")
+    .Input("grad: N * T")
+    .Attr("N: int >= 1")
+    .Attr("T: numbertype")
+    .Attr("use_locking: bool = false")
+    .Attr("use_nesterov: bool = false")
+    .SetShapeFn(ResourceMultiApplyAdamShapeFn);
+
 template <bool is_resource>
 static absl::Status ApplyAdamWithAmsgradShapeFn(InferenceContext* c) {
   ShapeHandle unused;
@@ -0,0 +1,292 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/platform/readahead_file_system.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/platform/blocking_counter.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/file_statistics.h"
+#include "tensorflow/core/platform/stringpiece.h"
+
+namespace tensorflow {
+
+// A random access file whose reads go through the filesystem's shared block
+// cache, fetching uncached blocks in parallel and prefetching the blocks
+// that follow each read.
+class ReadaheadRandomAccessFile : public RandomAccessFile {
+ public:
+  ReadaheadRandomAccessFile(ReadaheadFileSystem* fs, const string& fname,
+                            std::shared_ptr<RandomAccessFile> base_reader)
+      : fs_(fs), fname_(fname), base_reader_(std::move(base_reader)) {}
+
+  absl::Status Name(absl::string_view* result) const override {
+    *result = fname_;
+    return absl::OkStatus();
+  }
+
+  absl::Status Read(uint64 offset, size_t n, absl::string_view* result,
+                    char* scratch) const override;
+
+ private:
+  ReadaheadFileSystem* const fs_;
+  const string fname_;
+  // Keeps the shared base reader alive so block fetches for this file reuse
+  // it instead of reopening the file (see `ReadaheadFileSystem::
+  // GetBaseReader`).
+  const std::shared_ptr<RandomAccessFile> base_reader_;
+  // End of the range covered by previously scheduled prefetches; avoids
+  // rescheduling the same blocks on every read of a sequential scan.
+  mutable std::atomic<uint64> prefetched_until_{0};
+};
+
+absl::Status ReadaheadRandomAccessFile::Read(uint64 offset, size_t n,
+                                             absl::string_view* result,
+                                             char* scratch) const {
+  const ReadaheadFileSystem::Options& options = fs_->options();
+  RamFileBlockCache* cache = fs_->cache_.get();
+  *result = absl::string_view(scratch, 0);
+  if (n == 0) return absl::OkStatus();
+
+  // Split the request on block boundaries into at most max_parallel_fetches
+  // contiguous subranges, so uncached blocks are fetched concurrently.
+  const uint64 block_size = options.block_size;
+  const uint64 end = offset + n;
+  const uint64 first_block = offset / block_size;
+  const uint64 last_block = (end - 1) / block_size;
+  const uint64 num_blocks = last_block - first_block + 1;
+  const int num_fetches = static_cast<int>(std::min<uint64>(
+      std::max(1, options.max_parallel_fetches), num_blocks));
+
+  struct Subrange {
+    uint64 offset;
+    size_t n;
+    size_t scratch_offset;
+    absl::Status status;
+    size_t transferred = 0;
+  };
+  std::vector<Subrange> subranges(num_fetches);
+  uint64 cursor = offset;
+  uint64 blocks_assigned = 0;
+  for (int i = 0; i < num_fetches; ++i) {
+    blocks_assigned += num_blocks / num_fetches +
+                       (i < static_cast<int>(num_blocks % num_fetches) ? 1 : 0);
+    uint64 sub_end =
+        std::min(end, (first_block + blocks_assigned) * block_size);
+    subranges[i].offset = cursor;
+    subranges[i].n = sub_end - cursor;
+    subranges[i].scratch_offset = cursor - offset;
+    cursor = sub_end;
+  }
+
+  auto read_subrange = [&](Subrange* subrange) {
+    subrange->status =
+        cache->Read(fname_, subrange->offset, subrange->n,
+                    scratch + subrange->scratch_offset, &subrange->transferred);
+  };
+  if (num_fetches == 1) {
+    read_subrange(&subranges[0]);
+  } else {
+    BlockingCounter counter(num_fetches - 1);
+    for (int i = 1; i < num_fetches; ++i) {
+      fs_->fetch_pool_->Schedule([&, i] {
+        read_subrange(&subranges[i]);
+        counter.DecrementCount();
+      });
+    }
+    // The first subrange is read on the calling thread while the rest are in
+    // flight.
+    read_subrange(&subranges[0]);
+    counter.Wait();
+  }
+
+  // The result is the contiguous prefix of successfully read bytes; blocks
+  // read beyond a short subrange stay cached for later reads.
+  absl::Status status;
+  size_t total = 0;
+  for (const Subrange& subrange : subranges) {
+    if (!subrange.status.ok()) {
+      status = subrange.status;
+      break;
+    }
+    total += subrange.transferred;
+    if (subrange.transferred < subrange.n) break;
+  }
+  *result = absl::string_view(scratch, total);
+  if (status.ok() && total < n) {
+    status = errors::OutOfRange("EOF reached, requested ", n,
+                                " bytes at offset ", offset, ", read ", total);
+  }
+
+  // Fire-and-forget readahead of the blocks following this read. The marker
+  // update is best effort; at worst a block is prefetched twice, which the
+  // cache absorbs.
+  if (options.readahead_blocks > 0 && status.ok()) {
+    const uint64 readahead_end =
+        (last_block + 1 + options.readahead_blocks) * block_size;
+    uint64 start = std::max((last_block + 1) * block_size,
+                            prefetched_until_.exchange(readahead_end));
+    for (uint64 block_offset = start; block_offset < readahead_end;
+         block_offset += block_size) {
+      fs_->fetch_pool_->Schedule([cache, fname = fname_, block_offset] {
+        // Reading one byte pulls the whole enclosing block into the cache.
+        char byte;
+        size_t bytes_transferred;
+        cache->Read(fname, block_offset, 1, &byte, &bytes_transferred)
+            .IgnoreError();
+      });
+    }
+  }
+
+  return status;
+}
+
+ReadaheadFileSystem::ReadaheadFileSystem(std::unique_ptr<FileSystem> base,
+                                         const Options& options, Env* env)
+    : base_(std::move(base)), options_(options), env_(env) {
+  cache_ = std::make_unique<RamFileBlockCache>(
+      options_.block_size, options_.max_bytes, options_.max_staleness_secs,
+      [this](const string& fname, size_t offset, size_t buffer_size,
+             char* buffer, size_t* bytes_transferred) {
+        return FetchBlock(fname, offset, buffer_size, buffer,
+                          bytes_transferred);
+      },
+      env_);
+  fetch_pool_ = std::make_unique<thread::ThreadPool>(
+      env_, "readahead_fetch",
+      std::max(1, options_.max_parallel_fetches) +
+          std::max(0, options_.readahead_blocks));
+}
+
+absl::Status ReadaheadFileSystem::FetchBlock(const string& fname, size_t offset,
+                                             size_t buffer_size, char* buffer,
+                                             size_t* bytes_transferred) {
+  std::shared_ptr<RandomAccessFile> reader;
+  TF_RETURN_IF_ERROR(GetBaseReader(fname, &reader));
+  absl::string_view result;
+  absl::Status status = reader->Read(offset, buffer_size, &result, buffer);
+  if (result.data() != buffer) memcpy(buffer, result.data(), result.size());
+  *bytes_transferred = result.size();
+  // A short read at the end of the file is a success for the cache; it just
+  // marks the block partial.
+  if (errors::IsOutOfRange(status)) return absl::OkStatus();
+  return status;
+}
+
+absl::Status ReadaheadFileSystem::GetBaseReader(
+    const string& fname, std::shared_ptr<RandomAccessFile>* reader) {
+  {
+    mutex_lock l(readers_mu_);
+    auto it = base_readers_.find(fname);
+    if (it != base_readers_.end()) {
+      *reader = it->second.lock();
+      if (*reader != nullptr) return absl::OkStatus();
+      base_readers_.erase(it);
+    }
+  }
+  std::unique_ptr<RandomAccessFile> base_reader;
+  TF_RETURN_IF_ERROR(base_->NewRandomAccessFile(fname, nullptr, &base_reader));
+  *reader = std::move(base_reader);
+  mutex_lock l(readers_mu_);
+  base_readers_[fname] = *reader;
+  return absl::OkStatus();
+}
+
+absl::Status ReadaheadFileSystem::NewRandomAccessFile(
+    const string& fname, TransactionToken* token,
+    std::unique_ptr<RandomAccessFile>* result) {
+  std::shared_ptr<RandomAccessFile> reader;
+  TF_RETURN_IF_ERROR(GetBaseReader(fname, &reader));
+  // Drop cached blocks if the file changed since they were cached. Skipped
+  // when the wrapped filesystem cannot stat the file.
+  FileStatistics stat;
+  if (base_->Stat(fname, token, &stat).ok()) {
+    cache_->ValidateAndUpdateFileSignature(fname,
+                                           stat.mtime_nsec ^ stat.length);
+  }
+  *result =
+      std::make_unique<ReadaheadRandomAccessFile>(this, fname,
+                                                  std::move(reader));
+  return absl::OkStatus();
+}
+
+absl::Status ReadaheadFileSystem::NewWritableFile(
+    const string& fname, TransactionToken* token,
+    std::unique_ptr<WritableFile>* result) {
+  cache_->RemoveFile(fname);
+  {
+    mutex_lock l(readers_mu_);
+    base_readers_.erase(fname);
+  }
+  return base_->NewWritableFile(fname, token, result);
+}
+
+absl::Status ReadaheadFileSystem::NewAppendableFile(
+    const string& fname, TransactionToken* token,
+    std::unique_ptr<WritableFile>* result) {
+  cache_->RemoveFile(fname);
+  {
+    mutex_lock l(readers_mu_);
+    base_readers_.erase(fname);
+  }
+  return base_->NewAppendableFile(fname, token, result);
+}
+
+absl::Status ReadaheadFileSystem::DeleteFile(const string& fname,
+                                             TransactionToken* token) {
+  cache_->RemoveFile(fname);
+  {
+    mutex_lock l(readers_mu_);
+    base_readers_.erase(fname);
+  }
+  return base_->DeleteFile(fname, token);
+}
+
+absl::Status ReadaheadFileSystem::DeleteRecursively(const string& dirname,
+                                                    TransactionToken* token,
+                                                    int64_t* undeleted_files,
+                                                    int64_t* undeleted_dirs) {
+  // The affected files are not enumerable up front, so drop the whole cache.
+  cache_->Flush();
+  return base_->DeleteRecursively(dirname, token, undeleted_files,
+                                  undeleted_dirs);
+}
+
+absl::Status ReadaheadFileSystem::RenameFile(const string& src,
+                                             const string& target,
+                                             TransactionToken* token) {
+  cache_->RemoveFile(src);
+  cache_->RemoveFile(target);
+  {
+    mutex_lock l(readers_mu_);
+    base_readers_.erase(src);
+    base_readers_.erase(target);
+  }
+  return base_->RenameFile(src, target, token);
+}
+
+void ReadaheadFileSystem::FlushCaches(TransactionToken* token) {
+  cache_->Flush();
+  base_->FlushCaches(token);
+}
+
+}  // namespace tensorflow
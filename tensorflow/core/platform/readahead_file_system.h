@@ -0,0 +1,192 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_PLATFORM_READAHEAD_FILE_SYSTEM_H_
+#define TENSORFLOW_CORE_PLATFORM_READAHEAD_FILE_SYSTEM_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tensorflow/core/platform/cloud/ram_file_block_cache.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/file_system.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/threadpool.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+
+// A caching readahead layer that can be inserted over any `FileSystem`.
+//
+// Random access reads are served from a block cache shared by all readers,
+// backed by an LRU of fixed-size blocks (`RamFileBlockCache`, the same cache
+// the GCS filesystem uses). Reads spanning several uncached blocks fetch them
+// from the wrapped filesystem in parallel, and each read schedules
+// fire-and-forget prefetches of the blocks that follow it, so sequential
+// scans (e.g. remote TFRecord files) keep the link busy without every remote
+// filesystem plugin reimplementing readahead. Writes, deletes and renames
+// invalidate the affected file's cached blocks.
+//
+// The wrapper is insertable under its own scheme, e.g.:
+//
+//   env->RegisterFileSystem("readahead-s3", []() -> FileSystem* {
+//     FileSystem* base = ...;  // the filesystem to accelerate
+//     return new ReadaheadFileSystem(absl::WrapUnique(base), {});
+//   });
+//
+// The filesystem must outlive every file handed out by it, matching the
+// lifetime contract of the filesystems registered in `Env`.
+class ReadaheadFileSystem : public FileSystem {
+ public:
+  struct Options {
+    // Cache block size; also the unit of parallel fetch and readahead.
+    size_t block_size = 8 * 1024 * 1024;
+    // Total bytes of cached blocks, shared by all files and readers.
+    size_t max_bytes = 256 * 1024 * 1024;
+    // Maximum age of a cached block in seconds; 0 keeps blocks until evicted
+    // or invalidated.
+    uint64 max_staleness_secs = 0;
+    // Maximum number of concurrent range requests one read issues.
+    int max_parallel_fetches = 4;
+    // Number of blocks past the end of each read to prefetch.
+    int readahead_blocks = 4;
+  };
+
+  ReadaheadFileSystem(std::unique_ptr<FileSystem> base, const Options& options,
+                      Env* env = Env::Default());
+
+  TF_USE_FILESYSTEM_METHODS_WITH_NO_TRANSACTION_SUPPORT;
+
+  absl::Status NewRandomAccessFile(
+      const string& fname, TransactionToken* token,
+      std::unique_ptr<RandomAccessFile>* result) override;
+
+  absl::Status NewWritableFile(const string& fname, TransactionToken* token,
+                               std::unique_ptr<WritableFile>* result) override;
+
+  absl::Status NewAppendableFile(
+      const string& fname, TransactionToken* token,
+      std::unique_ptr<WritableFile>* result) override;
+
+  absl::Status NewReadOnlyMemoryRegionFromFile(
+      const string& fname, TransactionToken* token,
+      std::unique_ptr<ReadOnlyMemoryRegion>* result) override {
+    return base_->NewReadOnlyMemoryRegionFromFile(fname, token, result);
+  }
+
+  absl::Status FileExists(const string& fname,
+                          TransactionToken* token) override {
+    return base_->FileExists(fname, token);
+  }
+
+  absl::Status GetChildren(const string& dir, TransactionToken* token,
+                           std::vector<string>* result) override {
+    return base_->GetChildren(dir, token, result);
+  }
+
+  absl::Status GetMatchingPaths(const string& pattern, TransactionToken* token,
+                                std::vector<string>* result) override {
+    return base_->GetMatchingPaths(pattern, token, result);
+  }
+
+  absl::Status Stat(const string& fname, TransactionToken* token,
+                    FileStatistics* stat) override {
+    return base_->Stat(fname, token, stat);
+  }
+
+  absl::Status DeleteFile(const string& fname,
+                          TransactionToken* token) override;
+
+  absl::Status CreateDir(const string& dirname,
+                         TransactionToken* token) override {
+    return base_->CreateDir(dirname, token);
+  }
+
+  absl::Status DeleteDir(const string& dirname,
+                         TransactionToken* token) override {
+    return base_->DeleteDir(dirname, token);
+  }
+
+  absl::Status DeleteRecursively(const string& dirname, TransactionToken* token,
+                                 int64_t* undeleted_files,
+                                 int64_t* undeleted_dirs) override;
+
+  absl::Status GetFileSize(const string& fname, TransactionToken* token,
+                           uint64* file_size) override {
+    return base_->GetFileSize(fname, token, file_size);
+  }
+
+  absl::Status RenameFile(const string& src, const string& target,
+                          TransactionToken* token) override;
+
+  absl::Status IsDirectory(const string& dirname,
+                           TransactionToken* token) override {
+    return base_->IsDirectory(dirname, token);
+  }
+
+  absl::Status HasAtomicMove(const string& path,
+                             bool* has_atomic_move) override {
+    return base_->HasAtomicMove(path, has_atomic_move);
+  }
+
+  absl::Status CanCreateTempFile(const std::string& fname,
+                                 bool* can_create_temp_file) override {
+    return base_->CanCreateTempFile(fname, can_create_temp_file);
+  }
+
+  void FlushCaches(TransactionToken* token) override;
+
+  FileSystem* base() const { return base_.get(); }
+  const Options& options() const { return options_; }
+
+ private:
+  friend class ReadaheadRandomAccessFile;
+
+  // Fetches one cache block from the wrapped filesystem; installed as the
+  // cache's block fetcher.
+  absl::Status FetchBlock(const string& fname, size_t offset,
+                          size_t buffer_size, char* buffer,
+                          size_t* bytes_transferred);
+
+  // Returns a reader for `fname`, reusing the one shared by currently open
+  // readahead files when possible.
+  absl::Status GetBaseReader(const string& fname,
+                             std::shared_ptr<RandomAccessFile>* reader);
+
+  std::unique_ptr<FileSystem> base_;
+  const Options options_;
+  Env* const env_;
+
+  mutex readers_mu_;
+  // Base readers shared by open readahead files, so block fetches for one
+  // file reuse one underlying connection. Entries expire when the last open
+  // file referencing them is closed.
+  std::map<string, std::weak_ptr<RandomAccessFile>> base_readers_
+      TF_GUARDED_BY(readers_mu_);
+
+  std::unique_ptr<RamFileBlockCache> cache_;
+  // Runs parallel range fetches and readahead; declared after `cache_` so its
+  // destructor drains in-flight fetches before the cache is destroyed.
+  std::unique_ptr<thread::ThreadPool> fetch_pool_;
+
+  ReadaheadFileSystem(const ReadaheadFileSystem&) = delete;
+  void operator=(const ReadaheadFileSystem&) = delete;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_PLATFORM_READAHEAD_FILE_SYSTEM_H_
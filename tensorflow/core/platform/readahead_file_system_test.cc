@@ -0,0 +1,170 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/platform/readahead_file_system.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/null_file_system.h"
+#include "tensorflow/core/platform/stringpiece.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+// Serves one in-memory file and counts the range requests reaching it.
+class CountingFileSystem : public NullFileSystem {
+ public:
+  explicit CountingFileSystem(const string& contents)
+      : contents_(contents) {}
+
+  absl::Status NewRandomAccessFile(
+      const string& fname, TransactionToken* token,
+      std::unique_ptr<RandomAccessFile>* result) override {
+    class File : public RandomAccessFile {
+     public:
+      explicit File(CountingFileSystem* fs) : fs_(fs) {}
+      absl::Status Read(uint64 offset, size_t n, absl::string_view* result,
+                        char* scratch) const override {
+        fs_->reads_.fetch_add(1);
+        if (offset >= fs_->contents_.size()) {
+          *result = absl::string_view(scratch, 0);
+          return errors::OutOfRange("eof");
+        }
+        size_t available =
+            std::min(n, fs_->contents_.size() - static_cast<size_t>(offset));
+        memcpy(scratch, fs_->contents_.data() + offset, available);
+        *result = absl::string_view(scratch, available);
+        if (available < n) return errors::OutOfRange("eof");
+        return absl::OkStatus();
+      }
+
+     private:
+      CountingFileSystem* const fs_;
+    };
+    *result = std::make_unique<File>(this);
+    return absl::OkStatus();
+  }
+
+  absl::Status Stat(const string& fname, TransactionToken* token,
+                    FileStatistics* stat) override {
+    stat->length = contents_.size();
+    stat->mtime_nsec = 123;
+    stat->is_directory = false;
+    return absl::OkStatus();
+  }
+
+  int reads() const { return reads_.load(); }
+
+ private:
+  const string contents_;
+  std::atomic<int> reads_{0};
+};
+
+string TestContents() {
+  string contents;
+  for (int i = 0; i < 1000; ++i) contents.push_back('a' + i % 26);
+  return contents;
+}
+
+// Readahead is disabled in the counting tests so the number of base reads is
+// deterministic.
+ReadaheadFileSystem::Options CountingOptions() {
+  ReadaheadFileSystem::Options options;
+  options.block_size = 64;
+  options.max_bytes = 1 << 20;
+  options.max_parallel_fetches = 3;
+  options.readahead_blocks = 0;
+  return options;
+}
+
+TEST(ReadaheadFileSystemTest, ReadsMatchBaseAndHitCache) {
+  const string contents = TestContents();
+  auto counting = std::make_unique<CountingFileSystem>(contents);
+  CountingFileSystem* base = counting.get();
+  ReadaheadFileSystem fs(std::move(counting), CountingOptions());
+
+  std::unique_ptr<RandomAccessFile> file;
+  TF_ASSERT_OK(fs.NewRandomAccessFile("f", nullptr, &file));
+
+  // A read spanning several blocks is fetched in parallel and assembled in
+  // order.
+  char scratch[1000];
+  absl::string_view result;
+  TF_ASSERT_OK(file->Read(10, 500, &result, scratch));
+  EXPECT_EQ(result, absl::string_view(contents).substr(10, 500));
+  int reads_after_first = base->reads();
+  EXPECT_GT(reads_after_first, 0);
+
+  // A second read of the same range is served from the cache.
+  TF_ASSERT_OK(file->Read(10, 500, &result, scratch));
+  EXPECT_EQ(result, absl::string_view(contents).substr(10, 500));
+  EXPECT_EQ(base->reads(), reads_after_first);
+
+  // The cache is shared across readers of the same file.
+  std::unique_ptr<RandomAccessFile> other;
+  TF_ASSERT_OK(fs.NewRandomAccessFile("f", nullptr, &other));
+  TF_ASSERT_OK(other->Read(10, 500, &result, scratch));
+  EXPECT_EQ(base->reads(), reads_after_first);
+}
+
+TEST(ReadaheadFileSystemTest, ShortReadAtEndOfFile) {
+  const string contents = TestContents();
+  ReadaheadFileSystem fs(std::make_unique<CountingFileSystem>(contents),
+                         CountingOptions());
+
+  std::unique_ptr<RandomAccessFile> file;
+  TF_ASSERT_OK(fs.NewRandomAccessFile("f", nullptr, &file));
+
+  char scratch[200];
+  absl::string_view result;
+  absl::Status status = file->Read(contents.size() - 100, 200, &result,
+                                   scratch);
+  EXPECT_TRUE(errors::IsOutOfRange(status));
+  EXPECT_EQ(result, absl::string_view(contents).substr(contents.size() - 100));
+}
+
+TEST(ReadaheadFileSystemTest, WriteInvalidatesCachedBlocks) {
+  const string contents = TestContents();
+  auto counting = std::make_unique<CountingFileSystem>(contents);
+  CountingFileSystem* base = counting.get();
+  ReadaheadFileSystem fs(std::move(counting), CountingOptions());
+
+  std::unique_ptr<RandomAccessFile> file;
+  TF_ASSERT_OK(fs.NewRandomAccessFile("f", nullptr, &file));
+
+  char scratch[100];
+  absl::string_view result;
+  TF_ASSERT_OK(file->Read(0, 100, &result, scratch));
+  int reads_after_first = base->reads();
+
+  // Opening the file for writing drops its cached blocks, so the next read
+  // goes back to the base filesystem (the fake's writable file open fails,
+  // which does not matter for the invalidation).
+  std::unique_ptr<WritableFile> writable;
+  fs.NewWritableFile("f", nullptr, &writable).IgnoreError();
+  TF_ASSERT_OK(file->Read(0, 100, &result, scratch));
+  EXPECT_EQ(result, absl::string_view(contents).substr(0, 100));
+  EXPECT_GT(base->reads(), reads_after_first);
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -19,6 +19,7 @@ limitations under the License.
 #include "xla/tsl/profiler/utils/group_events.h"
 #include "xla/tsl/profiler/utils/preprocess_xplane.h"
 #include "xla/tsl/profiler/utils/xplane_utils.h"
+#include "tensorflow/core/profiler/utils/cost_utils.h"
 #include "tensorflow/core/profiler/utils/derived_timeline.h"
 #include "tensorflow/core/profiler/utils/xplane_schema.h"
 
@@ -39,6 +40,10 @@ void PreprocessSingleHostXSpace(
       // Preprocess XPlane to convert stats to Traceme2 semantics
       tsl::profiler::PreprocessXPlane(&plane);
 
+      // Attach roofline (flop and bytes-accessed) estimates to op events
+      // whose tensor shapes were traced.
+      AddRoofLineStatsToXPlane(&plane);
+
       if (!isTpu && absl::StartsWith(plane.name(), kTpuPlanePrefix)) {
         isTpu = true;
       }
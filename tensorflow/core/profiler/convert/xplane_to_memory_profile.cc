@@ -128,6 +128,9 @@ MemoryProfile GenerateMemoryProfile(const XPlane* host_trace) {
           case StatType::kFragmentation:
             stats.set_fragmentation(stat.DoubleValue());
             break;
+          case StatType::kLargestFreeBlockBytes:
+            stats.set_largest_free_block_bytes(stat.IntValue());
+            break;
           case StatType::kPeakBytesInUse:
             stats.set_peak_bytes_in_use(stat.IntValue());
             break;
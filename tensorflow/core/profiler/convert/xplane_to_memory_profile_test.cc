@@ -74,6 +74,7 @@ TEST(ConvertXPlaneToMemoryProfile, OneAllocatorMultiActivitiesTest) {
                {{StatType::kBytesReserved, int64_t{2000}},
                 {StatType::kBytesAllocated, int64_t{5000}},
                 {StatType::kBytesAvailable, int64_t{3000}},
+                {StatType::kLargestFreeBlockBytes, int64_t{1024}},
                 {StatType::kPeakBytesInUse, int64_t{9500}},
                 {StatType::kRequestedBytes, int64_t{300}},
                 {StatType::kAllocationBytes, int64_t{300}},
@@ -102,6 +103,10 @@ TEST(ConvertXPlaneToMemoryProfile, OneAllocatorMultiActivitiesTest) {
                 .peak_stats()
                 .peak_bytes_in_use(),
             7000);
+  EXPECT_EQ(allocator_memory_profile.profile_summary()
+                .peak_stats()
+                .largest_free_block_bytes(),
+            1024);
   EXPECT_EQ(allocator_memory_profile.profile_summary().peak_stats_time_ps(),
             70000);
   EXPECT_EQ(allocator_memory_profile.sampled_timeline_snapshots_size(), 3);
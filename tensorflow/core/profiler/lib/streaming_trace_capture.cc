@@ -0,0 +1,96 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/profiler/lib/streaming_trace_capture.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorflow/core/lib/io/record_reader.h"
+#include "tensorflow/core/lib/io/record_writer.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/tstring.h"
+#include "tensorflow/core/profiler/lib/profiler_session.h"
+
+namespace tensorflow {
+namespace profiler {
+
+absl::Status CaptureStreamingTrace(const std::string& path,
+                                   int64_t duration_ms,
+                                   const StreamingTraceOptions& options) {
+  if (duration_ms <= 0) {
+    return errors::InvalidArgument("duration_ms must be positive, got ",
+                                   duration_ms);
+  }
+  if (options.chunk_duration_ms <= 0) {
+    return errors::InvalidArgument("chunk_duration_ms must be positive, got ",
+                                   options.chunk_duration_ms);
+  }
+
+  Env* env = Env::Default();
+  std::unique_ptr<WritableFile> file;
+  TF_RETURN_IF_ERROR(env->NewWritableFile(path, &file));
+  io::RecordWriter writer(file.get());
+
+  int64_t remaining_ms = duration_ms;
+  while (remaining_ms > 0) {
+    const int64_t chunk_ms = std::min(remaining_ms, options.chunk_duration_ms);
+    remaining_ms -= chunk_ms;
+
+    auto session = tsl::ProfilerSession::Create(options.profile_options);
+    TF_RETURN_IF_ERROR(session->Status());
+    env->SleepForMicroseconds(chunk_ms * 1000);
+
+    // Stops the session's profilers and drains their buffered trace data.
+    // Only one chunk's XSpace is ever resident: it is serialized and appended
+    // to the record file before the next chunk session starts.
+    XSpace space;
+    TF_RETURN_IF_ERROR(session->CollectData(&space));
+    session.reset();
+    TF_RETURN_IF_ERROR(writer.WriteRecord(space.SerializeAsString()));
+    TF_RETURN_IF_ERROR(writer.Flush());
+  }
+
+  TF_RETURN_IF_ERROR(writer.Close());
+  return file->Close();
+}
+
+absl::Status ReadStreamingTrace(const std::string& path,
+                                std::vector<XSpace>* chunks) {
+  std::unique_ptr<RandomAccessFile> file;
+  TF_RETURN_IF_ERROR(Env::Default()->NewRandomAccessFile(path, &file));
+  io::SequentialRecordReader reader(file.get());
+
+  chunks->clear();
+  tstring record;
+  while (true) {
+    absl::Status s = reader.ReadRecord(&record);
+    if (absl::IsOutOfRange(s)) break;  // End of file.
+    TF_RETURN_IF_ERROR(s);
+    XSpace space;
+    if (!space.ParseFromArray(record.data(), record.size())) {
+      return errors::DataLoss("Failed to parse XSpace chunk from ", path);
+    }
+    chunks->push_back(std::move(space));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace profiler
+}  // namespace tensorflow
@@ -0,0 +1,59 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_CORE_PROFILER_LIB_STREAMING_TRACE_CAPTURE_H_
+#define TENSORFLOW_CORE_PROFILER_LIB_STREAMING_TRACE_CAPTURE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "tensorflow/core/profiler/lib/profiler_session.h"
+#include "tensorflow/core/profiler/protobuf/xplane.pb.h"
+
+namespace tensorflow {
+namespace profiler {
+
+// Options for CaptureStreamingTrace.
+struct StreamingTraceOptions {
+  // Profiler options for each chunk session.
+  ProfileOptions profile_options = tsl::ProfilerSession::DefaultOptions();
+
+  // Length of each chunk. Peak memory is bounded by the trace data of one
+  // chunk, independent of the total capture duration.
+  int64_t chunk_duration_ms = 2000;
+};
+
+// Captures a profile for `duration_ms`, split into chunks of
+// `options.chunk_duration_ms`. Each chunk runs its own profiler session and
+// its XSpace is serialized to `path` (TFRecord of serialized XSpace protos)
+// as soon as it is collected, so arbitrarily long captures run in memory
+// bounded by a single chunk instead of buffering the whole trace.
+//
+// Note that there is a short blind spot between chunks while one session
+// stops and the next starts; chunk boundaries are visible in the resulting
+// trace.
+absl::Status CaptureStreamingTrace(const std::string& path,
+                                   int64_t duration_ms,
+                                   const StreamingTraceOptions& options);
+
+// Reads back the XSpace chunks written by CaptureStreamingTrace.
+absl::Status ReadStreamingTrace(const std::string& path,
+                                std::vector<XSpace>* chunks);
+
+}  // namespace profiler
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_PROFILER_LIB_STREAMING_TRACE_CAPTURE_H_
@@ -26,6 +26,7 @@ limitations under the License.
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
 #include "xla/tsl/profiler/utils/tf_op_utils.h"
+#include "xla/tsl/profiler/utils/tf_xplane_visitor.h"
 #include "tensorflow/core/framework/tensor_shape.pb.h"
 #include "tensorflow/core/framework/types.h"
 #include "tensorflow/core/framework/types.pb.h"
@@ -34,6 +35,8 @@ limitations under the License.
 #include "tensorflow/core/grappler/costs/op_performance_data.pb.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/profiler/protobuf/xplane.pb.h"
+#include "tensorflow/core/profiler/utils/xplane_builder.h"
 #include "tensorflow/core/profiler/utils/xplane_schema.h"
 #include "tensorflow/core/profiler/utils/xplane_visitor.h"
 
@@ -127,5 +130,27 @@ TfOpRoofLineCostEstimator::OpRoofLineStats TfOpRoofLineCostEstimator::Predict(
           /*inaccurate=*/costs.inaccurate};
 }
 
+void AddRoofLineStatsToXPlane(XPlane* plane) {
+  TfOpRoofLineCostEstimator estimator;
+  XPlaneVisitor visitor = tsl::profiler::CreateTfXPlaneVisitor(plane);
+  XPlaneBuilder builder(plane);
+  const XStatMetadata* flops_stat_metadata =
+      builder.GetOrCreateStatMetadata(GetStatTypeStr(StatType::kFlops));
+  const XStatMetadata* bytes_stat_metadata =
+      builder.GetOrCreateStatMetadata(GetStatTypeStr(StatType::kBytesAccessed));
+  for (XLine& line : *plane->mutable_lines()) {
+    for (XEvent& event : *line.mutable_events()) {
+      XEventVisitor event_visitor(&visitor, &line, &event);
+      TfOpRoofLineCostEstimator::OpRoofLineStats costs =
+          estimator.Predict(event_visitor);
+      if (costs.flops == 0 && costs.bytes_accessed == 0) continue;
+      XEventBuilder event_builder(&line, &builder, &event);
+      event_builder.SetOrAddStatValue(*flops_stat_metadata, costs.flops);
+      event_builder.SetOrAddStatValue(*bytes_stat_metadata,
+                                      costs.bytes_accessed);
+    }
+  }
+}
+
 }  // namespace profiler
 }  // namespace tensorflow
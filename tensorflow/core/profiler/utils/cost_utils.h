@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/core/grappler/costs/op_level_cost_estimator.h"
 #include "tensorflow/core/platform/macros.h"
 #include "tensorflow/core/platform/types.h"
+#include "tensorflow/core/profiler/protobuf/xplane.pb.h"
 #include "tensorflow/core/profiler/utils/xplane_visitor.h"
 
 namespace tensorflow {
@@ -54,6 +55,13 @@ class TfOpRoofLineCostEstimator
   void operator=(const TfOpRoofLineCostEstimator&) = delete;
 };
 
+// Runs the roof line cost estimator over every event in the given plane and
+// attaches the resulting estimates to the event as "flops" and
+// "bytes_accessed" stats, so roofline analysis over an exported trace does
+// not require the original graph. Events without a traced op type and tensor
+// shapes are left unchanged.
+void AddRoofLineStatsToXPlane(XPlane* plane);
+
 }  // namespace profiler
 }  // namespace tensorflow
 
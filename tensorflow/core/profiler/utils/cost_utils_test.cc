@@ -0,0 +1,74 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/core/profiler/utils/cost_utils.h"
+
+#include "xla/tsl/profiler/utils/tf_xplane_visitor.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/profiler/protobuf/xplane.pb.h"
+#include "tensorflow/core/profiler/utils/xplane_builder.h"
+#include "tensorflow/core/profiler/utils/xplane_schema.h"
+#include "tensorflow/core/profiler/utils/xplane_test_utils.h"
+#include "tensorflow/core/profiler/utils/xplane_visitor.h"
+
+namespace tensorflow {
+namespace profiler {
+namespace {
+
+TEST(CostUtilsTest, AddRoofLineStatsToXPlane) {
+  XSpace space;
+  XPlane* plane = GetOrCreateHostXPlane(&space);
+  XPlaneBuilder plane_builder(plane);
+  auto line_builder = plane_builder.GetOrCreateLine(0);
+  // An op event with traced tensor shapes: gets roofline stats.
+  CreateXEvent(&plane_builder, &line_builder, "MatMul", 10, 100,
+               {{StatType::kTfOp, "model/matmul:MatMul"},
+                {StatType::kTensorShapes, "(float[64,32];float[32,16])"}});
+  // An op event without tensor shapes: left unchanged.
+  CreateXEvent(&plane_builder, &line_builder, "Relu", 200, 50,
+               {{StatType::kTfOp, "model/relu:Relu"}});
+
+  AddRoofLineStatsToXPlane(plane);
+
+  XPlaneVisitor visitor = tsl::profiler::CreateTfXPlaneVisitor(plane);
+  int num_events_with_roofline_stats = 0;
+  visitor.ForEachLine([&](const XLineVisitor& line) {
+    line.ForEachEvent([&](const XEventVisitor& event) {
+      bool has_flops = false;
+      bool has_bytes_accessed = false;
+      event.ForEachStat([&](const XStatVisitor& stat) {
+        if (stat.Type() == StatType::kFlops) {
+          has_flops = true;
+          EXPECT_GT(stat.IntOrUintValue(), 0);
+        } else if (stat.Type() == StatType::kBytesAccessed) {
+          has_bytes_accessed = true;
+          EXPECT_GT(stat.IntOrUintValue(), 0);
+        }
+      });
+      if (event.Name() == "MatMul") {
+        EXPECT_TRUE(has_flops);
+        EXPECT_TRUE(has_bytes_accessed);
+        num_events_with_roofline_stats++;
+      } else {
+        EXPECT_FALSE(has_flops);
+        EXPECT_FALSE(has_bytes_accessed);
+      }
+    });
+  });
+  EXPECT_EQ(num_events_with_roofline_stats, 1);
+}
+
+}  // namespace
+}  // namespace profiler
+}  // namespace tensorflow
@@ -467,21 +467,23 @@ absl::Status CallEagerExecute(
         result_tensor_handles) {
   assert(eager_ctx != nullptr && "EagerContext is NULL");
 
-  // Create TF EagerOperation.
-  OwnedEagerOperation eager_op{new EagerOperation(eager_ctx)};
-  TF_RETURN_IF_ERROR(eager_op->Reset(op_name, device_name));
+  // Create TF EagerOperation. The operation state only lives for this one
+  // dispatch, so construct it in place instead of paying a heap round trip
+  // for every fallback op.
+  EagerOperation eager_op(eager_ctx);
+  TF_RETURN_IF_ERROR(eager_op.Reset(op_name, device_name));
 
   // Handle inputs.
   for (TensorHandle* input_tensor : input_tensor_handles) {
-    TF_RETURN_IF_ERROR(eager_op->AddInput(input_tensor));
+    TF_RETURN_IF_ERROR(eager_op.AddInput(input_tensor));
   }
 
   // Handle attributes.
   auto* host = exec_ctx.host();
-  TF_RETURN_IF_ERROR(PrepareAttributes(eager_op.get(), attrs, host, eager_ctx));
+  TF_RETURN_IF_ERROR(PrepareAttributes(&eager_op, attrs, host, eager_ctx));
 
   int num_retvals = result_tensor_handles.size();
-  TF_RETURN_IF_ERROR(eager_op->Execute(
+  TF_RETURN_IF_ERROR(eager_op.Execute(
       absl::MakeSpan(result_tensor_handles.data(), num_retvals), &num_retvals));
 
   return absl::OkStatus();
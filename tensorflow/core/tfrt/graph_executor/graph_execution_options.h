@@ -104,6 +104,14 @@ struct GraphExecutionOptions {
   // This option is experimental.
   bool enable_mlrt = false;
 
+  // If non-empty, the directory used to persist compiled MLRT bytecode across
+  // process restarts. Artifacts are keyed by the fingerprint of the graph, the
+  // client graph signature, the compile options and the TensorFlow version, so
+  // a stale entry is never loaded; unrelated entries accumulate and should be
+  // cleaned up with the model artifacts they belong to. Only used when
+  // `enable_mlrt` is true and cost analysis is disabled.
+  std::string compiled_bytecode_cache_dir;
+
   // If true, the IFRT will be used instead of the TPU Runner.
   // This option is experimental.
   bool use_ifrt = false;
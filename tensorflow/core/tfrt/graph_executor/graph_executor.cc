@@ -21,6 +21,7 @@ limitations under the License.
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -65,8 +66,13 @@ limitations under the License.
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/lib/gtl/cleanup.h"
 #include "tensorflow/core/lib/monitoring/gauge.h"
+#include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/status.h"
 #include "tensorflow/core/platform/tstring.h"
 #include "tensorflow/core/profiler/lib/traceme_encode.h"
@@ -94,6 +100,7 @@ limitations under the License.
 #include "tensorflow/core/tfrt/runtime/step_id.h"
 #include "tensorflow/core/tfrt/runtime/stream.h"
 #include "tensorflow/core/tfrt/runtime/work_queue_interface.h"
+#include "tensorflow/core/tfrt/saved_model/utils/serialize_utils.h"
 #include "tensorflow/core/tfrt/stubs/tfrt_native_lowering_stub.h"
 #include "tensorflow/core/tfrt/utils/fallback_tensor.h"
 #include "tensorflow/core/tfrt/utils/tfrt_graph_execution_state.h"
@@ -684,6 +691,51 @@ absl::Status GraphExecutor::Extend(const GraphDef& graph) {
   return graph_execution_state_->Extend(graph);
 }
 
+std::string GraphExecutor::GetBytecodeCachePath(
+    const ClientGraph& client_graph) const {
+  if (options_.compiled_bytecode_cache_dir.empty() || !options_.enable_mlrt) {
+    return "";
+  }
+  // Cost recording needs the intermediate module with op keys, which is only
+  // produced when the bytecode is compiled in-process.
+  if (options_.cost_analysis_options.version !=
+      Options::CostAnalysisOptions::kDisabled) {
+    return "";
+  }
+  const GraphDef* graph_def = graph_execution_state_->original_graph_def();
+  if (graph_def == nullptr) {
+    return "";
+  }
+
+  // The key must change whenever anything that affects lowering changes, so a
+  // stale artifact is never loaded: the graph, the client graph signature, the
+  // compile options and the TensorFlow version all feed the fingerprint.
+  uint64_t fingerprint = DeterministicProtoHash64(*graph_def);
+  fingerprint = FingerprintCat64(fingerprint, Fingerprint64(TF_VERSION_STRING));
+  fingerprint = FingerprintCat64(fingerprint, Fingerprint64(client_graph.name));
+  for (const auto& [name, array_info] : client_graph.input_nodes) {
+    fingerprint = FingerprintCat64(fingerprint, Fingerprint64(name));
+    fingerprint = FingerprintCat64(
+        fingerprint, static_cast<uint64_t>(array_info.imported_dtype));
+    fingerprint = FingerprintCat64(fingerprint,
+                                   DeterministicProtoHash64(array_info.shape));
+  }
+  for (const auto& name : client_graph.output_nodes) {
+    fingerprint = FingerprintCat64(fingerprint, Fingerprint64(name));
+  }
+  for (const auto& name : client_graph.target_nodes) {
+    fingerprint = FingerprintCat64(fingerprint, Fingerprint64(name));
+  }
+  std::ostringstream compile_options_str;
+  compile_options_str << options_.compile_options;
+  fingerprint =
+      FingerprintCat64(fingerprint, Fingerprint64(compile_options_str.str()));
+
+  return io::JoinPath(options_.compiled_bytecode_cache_dir,
+                      absl::StrCat(absl::Hex(fingerprint, absl::kZeroPad16),
+                                   ".mlrt"));
+}
+
 absl::StatusOr<std::unique_ptr<GraphExecutor::LoadedClientGraph>>
 GraphExecutor::ImportAndCompileClientGraph(
     const GraphExecutor::ClientGraph& client_graph,
@@ -767,11 +819,44 @@ GraphExecutor::ImportAndCompileClientGraph(
       return tensorflow::errors::Internal("Missing kernel registry in MLRT.");
     }
 
-    ASSIGN_OR_RETURN_IN_COMPILE(
-        auto bytecode_buffer,
-        tensorflow::mlrt_compiler::ConvertTfMlirToBytecode(
-            options_.compile_options, fallback_state(), module.get(),
-            model_context, &module_with_op_keys));
+    const std::string bytecode_cache_path = GetBytecodeCachePath(client_graph);
+    mlrt::bc::Buffer bytecode_buffer;
+    if (!bytecode_cache_path.empty()) {
+      if (auto cached = DeserializeMlrtBytecodeBuffer(bytecode_cache_path);
+          cached.ok() && !cached->empty()) {
+        bytecode_buffer = *std::move(cached);
+        LOG(INFO) << "TFRT loaded compiled MLRT bytecode from "
+                  << bytecode_cache_path
+                  << ". Client graph name: " << client_graph.name;
+      }
+    }
+    if (bytecode_buffer.empty()) {
+      ASSIGN_OR_RETURN_IN_COMPILE(
+          bytecode_buffer,
+          tensorflow::mlrt_compiler::ConvertTfMlirToBytecode(
+              options_.compile_options, fallback_state(), module.get(),
+              model_context, &module_with_op_keys));
+      if (!bytecode_cache_path.empty()) {
+        // Best-effort cache fill. Write to a temporary file and rename it so
+        // that concurrent loaders never observe a partially written artifact.
+        const std::string tmp_path =
+            absl::StrCat(bytecode_cache_path, ".tmp-",
+                         absl::Hex(random::New64(), absl::kZeroPad16));
+        absl::Status cache_status = Env::Default()->RecursivelyCreateDir(
+            options_.compiled_bytecode_cache_dir);
+        if (cache_status.ok()) {
+          cache_status = SerializeMLRTBytecode(bytecode_buffer, tmp_path);
+        }
+        if (cache_status.ok()) {
+          cache_status =
+              Env::Default()->RenameFile(tmp_path, bytecode_cache_path);
+        }
+        if (!cache_status.ok()) {
+          LOG(WARNING) << "TFRT failed to persist compiled MLRT bytecode to "
+                       << bytecode_cache_path << ": " << cache_status;
+        }
+      }
+    }
     mlrt::bc::Executable executable(bytecode_buffer.data());
     auto bytecode_executable =
         std::make_unique<mlrt::LoadedExecutable>(executable, *kernel_registry_);
@@ -344,6 +344,12 @@ class GraphExecutor {
 
   absl::Status InitBytecode(LoadedClientGraph* loaded_graph);
 
+  // Returns the file path for persisting the compiled MLRT bytecode of
+  // `client_graph`, keyed by the fingerprint of the graph, the client graph
+  // signature, the compile options and the TensorFlow version. Returns an
+  // empty string if persisting is disabled or not applicable.
+  std::string GetBytecodeCachePath(const ClientGraph& client_graph) const;
+
   // Returns a `LoadedClientGraph` given input/output tensor info. If there is
   // no existing one yet, creates one first.
   absl::StatusOr<std::reference_wrapper<GraphExecutor::LoadedClientGraph>>
@@ -42,8 +42,11 @@ limitations under the License.
 #include "tensorflow/core/framework/types.pb.h"
 #include "tensorflow/core/graph/graph.h"
 #include "tensorflow/core/graph/graph_def_builder.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/status.h"
+#include "tensorflow/core/platform/test.h"
 #include "tensorflow/core/protobuf/rewriter_config.pb.h"
 #include "tensorflow/core/tfrt/fallback/fallback_state.h"
 #include "tensorflow/core/tfrt/graph_executor/config.h"
@@ -130,6 +133,53 @@ TEST_P(GraphExecutorTest, Vanilla) {
               ::testing::ElementsAreArray({2}));
 }
 
+TEST_F(GraphExecutorTest, BytecodeCache) {
+  const std::string cache_dir =
+      io::JoinPath(testing::TmpDir(), "bytecode_cache");
+
+  auto runtime = DefaultTfrtRuntime(/*num_threads=*/1);
+
+  // Load the same graph twice, with the persisted bytecode cache enabled. The
+  // first load compiles and fills the cache; the second load reuses the
+  // artifact and must produce the same results.
+  for (int i = 0; i < 2; ++i) {
+    GraphDef graph_def;
+    TF_ASSERT_OK(GetSimpleGraphDef(graph_def));
+
+    GraphExecutor::Options options(runtime.get());
+    options.enable_mlrt = true;
+    options.compiled_bytecode_cache_dir = cache_dir;
+
+    TF_ASSERT_OK_AND_ASSIGN(
+        auto fallback_state,
+        tensorflow::tfrt_stub::FallbackState::Create(
+            CreateDefaultSessionOptions(options), graph_def.library()));
+    auto resource_context = std::make_unique<tfrt::ResourceContext>();
+    TF_ASSERT_OK_AND_ASSIGN(
+        auto graph_executor,
+        GraphExecutor::Create(std::move(options), std::move(fallback_state),
+                              std::move(resource_context), graph_def,
+                              GetKernelRegistry()));
+
+    std::vector<std::pair<std::string, tensorflow::Tensor>> inputs;
+    inputs.push_back({"input", CreateTfTensor<int32_t>(
+                                   /*shape=*/{1, 3}, /*data=*/{1, 1, 1})});
+
+    std::vector<tensorflow::Tensor> outputs;
+    TF_ASSERT_OK(graph_executor->Run(/*run_options=*/{}, inputs,
+                                     /*output_tensor_names=*/{"rank"},
+                                     /*target_tensor_names=*/{}, &outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    EXPECT_THAT(GetTfTensorData<int32_t>(outputs[0]),
+                ::testing::ElementsAreArray({2}));
+
+    // Both loads map to the same cache entry.
+    std::vector<std::string> children;
+    TF_ASSERT_OK(Env::Default()->GetChildren(cache_dir, &children));
+    EXPECT_EQ(children.size(), 1);
+  }
+}
+
 TEST_P(GraphExecutorTest, OnlineCostAnalysisOptionsOverrideToOnce) {
   GraphDef graph_def;
   TF_ASSERT_OK(GetSimpleGraphDef(graph_def));
@@ -14,6 +14,10 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/tfrt/mlrt/interpreter/context.h"
 
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 #include "absl/log/check.h"
 #include "absl/strings/string_view.h"
 #include "tensorflow/core/tfrt/mlrt/bytecode/executable.h"
@@ -25,6 +29,56 @@ UserContextBase::~UserContextBase() = default;
 
 }
 
+namespace register_internal {
+
+RegisterFileFreeList& RegisterFileFreeList::Get() {
+  static thread_local RegisterFileFreeList free_list;
+  return free_list;
+}
+
+int RegisterFileFreeList::SizeClass(size_t num_regs) {
+  size_t capacity = kMinRegs;
+  for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+    if (num_regs <= capacity) return size_class;
+    capacity *= 2;
+  }
+  return -1;
+}
+
+std::vector<Value> RegisterFileFreeList::Acquire(size_t num_regs) {
+  std::vector<Value> regs;
+  const int size_class = SizeClass(num_regs);
+  if (size_class >= 0) {
+    auto& free_list = free_lists_[size_class];
+    if (!free_list.empty()) {
+      regs = std::move(free_list.back());
+      free_list.pop_back();
+    } else {
+      // Reserve the full size class capacity so the allocation can be reused
+      // by any function in the same class.
+      regs.reserve(kMinRegs << size_class);
+    }
+  }
+  regs.resize(num_regs);
+  return regs;
+}
+
+void RegisterFileFreeList::Release(std::vector<Value> regs) {
+  const size_t capacity = regs.capacity();
+  if (capacity < kMinRegs || capacity > kMaxRegs ||
+      (capacity & (capacity - 1)) != 0) {
+    return;
+  }
+  auto& free_list = free_lists_[SizeClass(capacity)];
+  if (free_list.size() >= kMaxFilesPerClass) {
+    return;
+  }
+  regs.clear();
+  free_list.push_back(std::move(regs));
+}
+
+}  // namespace register_internal
+
 void KernelRegistry::Register(absl::string_view name,
                               KernelImplementation kernel) {
   map_.emplace(name, kernel);
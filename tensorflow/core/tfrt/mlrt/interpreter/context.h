@@ -16,6 +16,7 @@ limitations under the License.
 #define TENSORFLOW_CORE_TFRT_MLRT_INTERPRETER_CONTEXT_H_
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <functional>
 #include <list>
@@ -116,16 +117,61 @@ void UnwindOnError(ExecutionContext& context, int64_t pc);
 
 }
 
+namespace register_internal {
+
+// A thread-local, size-classed free list of register files. A register file is
+// acquired for every function invocation, so reusing the underlying
+// allocations keeps the interpreter's call path free of heap allocations in
+// steady state. Register files are bucketed by power-of-two capacity; at most
+// kMaxFilesPerClass files are retained per size class per thread, and files
+// larger than the largest size class are not pooled.
+//
+// A file released on a different thread than it was acquired on simply
+// migrates to the releasing thread's free list; no synchronization is needed.
+class RegisterFileFreeList {
+ public:
+  static RegisterFileFreeList& Get();
+
+  // Returns a register file with exactly `num_regs` default-constructed
+  // values.
+  std::vector<Value> Acquire(size_t num_regs);
+
+  // Returns `regs` to the free list, destroying its values. The vector's
+  // allocation is dropped if its size class is full or it is not pooled.
+  void Release(std::vector<Value> regs);
+
+ private:
+  static constexpr size_t kMinRegs = 8;
+  static constexpr size_t kMaxRegs = 1024;
+  static constexpr int kNumSizeClasses = 8;  // 8, 16, ..., 1024.
+  static constexpr int kMaxFilesPerClass = 8;
+
+  // Returns the index of the smallest size class with capacity >= num_regs,
+  // or -1 if num_regs exceeds the largest size class.
+  static int SizeClass(size_t num_regs);
+
+  std::array<std::vector<std::vector<Value>>, kNumSizeClasses> free_lists_;
+};
+
+}  // namespace register_internal
+
 class FunctionContext {
  public:
   FunctionContext(bc::Function function, ExecutionContext* execution_context)
       : pc_(0),
-        registers_(function.num_regs()),
+        registers_(
+            register_internal::RegisterFileFreeList::Get().Acquire(
+                function.num_regs())),
         function_object_(function),
         execution_context_(execution_context) {
     DCHECK(execution_context);
   }
 
+  ~FunctionContext() {
+    register_internal::RegisterFileFreeList::Get().Release(
+        std::move(registers_));
+  }
+
   FunctionContext(const FunctionContext&) = delete;
   FunctionContext& operator=(const FunctionContext&) = delete;
   FunctionContext(FunctionContext&&) = default;
@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include "absl/log/log.h"
@@ -42,6 +43,29 @@ struct C : KernelFrame {
   void Invoke() {}
 };
 
+TEST(ContextTest, RegisterFileFreeListReusesAllocation) {
+  auto& free_list = register_internal::RegisterFileFreeList::Get();
+
+  std::vector<Value> regs = free_list.Acquire(10);
+  EXPECT_EQ(regs.size(), 10);
+  // The file is rounded up to its size class capacity.
+  EXPECT_EQ(regs.capacity(), 16);
+
+  const Value* data = regs.data();
+  free_list.Release(std::move(regs));
+
+  // An acquire in the same size class reuses the released allocation.
+  std::vector<Value> reused = free_list.Acquire(16);
+  EXPECT_EQ(reused.size(), 16);
+  EXPECT_EQ(reused.data(), data);
+  free_list.Release(std::move(reused));
+
+  // Oversized files are not pooled.
+  std::vector<Value> large = free_list.Acquire(2000);
+  EXPECT_EQ(large.size(), 2000);
+  free_list.Release(std::move(large));
+}
+
 TEST(ContextTest, MergeKernelRegistry) {
   KernelRegistry reg_a;
   reg_a.Register<A>();
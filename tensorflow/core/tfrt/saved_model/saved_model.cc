@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -29,8 +30,10 @@ limitations under the License.
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
@@ -51,8 +54,11 @@ limitations under the License.
 #include "tensorflow/core/framework/metrics.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/framework/types.h"
 #include "tensorflow/core/lib/monitoring/counter.h"
 #include "tensorflow/core/lib/monitoring/gauge.h"
+#include "tensorflow/core/lib/random/random.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/platform/logging.h"
@@ -409,6 +415,119 @@ std::string GetInferredModelType(const MetaGraphDef& meta_graph_def) {
                                               : kUnknownModelLabel);
 }
 
+// The warmup signatures file is a text file with one entry per line. Each line
+// records one signature/shape combination observed while serving:
+//
+//   <signature_name>\t<dtype>:<dim0>,<dim1>,...\t<dtype>:...
+//
+// Scalar inputs have an empty dimension list. The format is intentionally
+// simple so that recorded files can be inspected and edited by hand.
+constexpr absl::string_view kWarmupFieldDelimiter = "\t";
+
+std::string EncodeWarmupSignature(
+    absl::string_view signature_name,
+    absl::Span<const tensorflow::Tensor> inputs) {
+  std::string result(signature_name);
+  for (const auto& tensor : inputs) {
+    absl::StrAppend(&result, kWarmupFieldDelimiter,
+                    DataTypeString(tensor.dtype()), ":",
+                    absl::StrJoin(tensor.shape().dim_sizes(), ","));
+  }
+  return result;
+}
+
+// Creates a zero-valued tensor for replaying one recorded input. Synthetic
+// zeros are sufficient for warmup because kernel instantiation, XLA
+// compilation and autotuning only depend on dtypes and shapes.
+absl::StatusOr<tensorflow::Tensor> CreateWarmupTensor(
+    DataType dtype, const TensorShape& shape) {
+  tensorflow::Tensor tensor(dtype, shape);
+  if (DataTypeCanUseMemcpy(dtype)) {
+    std::memset(tensor.data(), 0, tensor.TotalBytes());
+  } else if (dtype != DT_STRING) {
+    // String tensors are default-initialized to empty strings; other
+    // non-POD dtypes (eg. variants, resources) cannot be synthesized.
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Unsupported dtype in warmup signature: ", DataTypeString(dtype)));
+  }
+  return tensor;
+}
+
+absl::Status ParseWarmupSignature(absl::string_view line,
+                                  std::string* signature_name,
+                                  std::vector<tensorflow::Tensor>* inputs) {
+  const std::vector<absl::string_view> fields =
+      absl::StrSplit(line, kWarmupFieldDelimiter);
+  if (fields.empty() || fields[0].empty()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Missing signature name in warmup signature: ", line));
+  }
+  *signature_name = std::string(fields[0]);
+  inputs->reserve(fields.size() - 1);
+  for (size_t i = 1; i < fields.size(); ++i) {
+    const std::pair<absl::string_view, absl::string_view> dtype_and_dims =
+        absl::StrSplit(fields[i], absl::MaxSplits(':', 1));
+    DataType dtype;
+    if (!DataTypeFromString(dtype_and_dims.first, &dtype)) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Invalid dtype in warmup signature: ", dtype_and_dims.first));
+    }
+    TensorShape shape;
+    for (absl::string_view dim_str :
+         absl::StrSplit(dtype_and_dims.second, ',', absl::SkipEmpty())) {
+      int64_t dim = 0;
+      if (!absl::SimpleAtoi(dim_str, &dim) || dim < 0) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Invalid dimension in warmup signature: ", dim_str));
+      }
+      TF_RETURN_IF_ERROR(shape.AddDimWithStatus(dim));
+    }
+    TF_ASSIGN_OR_RETURN(auto tensor, CreateWarmupTensor(dtype, shape));
+    inputs->push_back(std::move(tensor));
+  }
+  return absl::OkStatus();
+}
+
+// Replays the signature/shape combinations recorded in the warmup signatures
+// file at `path` through `saved_model` with zero-valued inputs, populating
+// kernel caches, XLA executables and autotuning results before the model is
+// marked ready. Warmup is best-effort: an entry that fails to parse or run is
+// logged and skipped, since a recorded file may predate signature changes.
+void RunSavedModelWarmup(SavedModel& saved_model, const std::string& path) {
+  std::string data;
+  if (const auto status = ReadFileToString(Env::Default(), path, &data);
+      !status.ok()) {
+    LOG(WARNING) << "Failed to read warmup signatures file " << path << ": "
+                 << status;
+    return;
+  }
+
+  const auto warmup_start_time = absl::Now();
+  int num_replayed = 0;
+  for (absl::string_view line :
+       absl::StrSplit(data, '\n', absl::SkipEmpty())) {
+    std::string signature_name;
+    std::vector<tensorflow::Tensor> inputs;
+    auto status = ParseWarmupSignature(line, &signature_name, &inputs);
+    if (status.ok()) {
+      std::vector<tensorflow::Tensor> outputs;
+      status = saved_model.Run(/*run_options=*/{}, signature_name, inputs,
+                               &outputs);
+    }
+    if (!status.ok()) {
+      LOG(WARNING) << "Failed to replay warmup signature '" << line
+                   << "': " << status;
+      continue;
+    }
+    ++num_replayed;
+  }
+
+  LOG(INFO) << "TFRT finished warming up savedmodel with " << num_replayed
+            << " recorded signatures. Took "
+            << absl::ToInt64Milliseconds(absl::Now() - warmup_start_time)
+            << " ms.";
+}
+
 }  // namespace
 
 SavedModel::~SavedModel() = default;  // Out-of-line C++ key function.
@@ -810,13 +929,23 @@ absl::StatusOr<std::unique_ptr<SavedModel>> SavedModelImpl::LoadSavedModel(
   }
 
   // Finally, create the saved model.
-  return {std::make_unique<SavedModelImpl>(
+  const std::string warmup_signatures_path = options.warmup_signatures_path;
+  auto saved_model = std::make_unique<SavedModelImpl>(
       std::move(options), std::move(symbol_uids), std::move(meta_graph_def),
       std::move(bef), std::move(bef_file), std::move(bytecode),
       std::move(loaded_executable),
       std::move(initializers_and_signatures.signature_map),
       std::move(runner_table), std::move(resource_array),
-      std::move(graph_executor))};
+      std::move(graph_executor));
+
+  // Replay the recorded warmup signatures, if any, so that the caches they
+  // populate are warm before the model is marked ready.
+  if (!warmup_signatures_path.empty() &&
+      Env::Default()->FileExists(warmup_signatures_path).ok()) {
+    RunSavedModelWarmup(*saved_model, warmup_signatures_path);
+  }
+
+  return saved_model;
 }
 
 SavedModelImpl::SavedModelImpl(
@@ -878,6 +1007,10 @@ absl::Status SavedModelImpl::Run(const RunOptions& run_options,
   const tensorflow::SessionMetadata& model_metadata =
       options_.graph_execution_options.model_metadata;
 
+  if (!options_.warmup_signatures_path.empty()) {
+    RecordWarmupSignature(name, inputs);
+  }
+
   if (options_.enable_lazy_loading &&
       options_.lazy_loading_use_graph_executor) {
     lazy_loading_count
@@ -956,6 +1089,38 @@ absl::Status SavedModelImpl::Run(const RunOptions& run_options,
       &req_deadline_tracker_, /*stream_callback_id=*/std::nullopt);
 }
 
+void SavedModelImpl::RecordWarmupSignature(
+    absl::string_view name, absl::Span<const tensorflow::Tensor> inputs) {
+  std::string key = EncodeWarmupSignature(name, inputs);
+  tensorflow::mutex_lock l(warmup_signatures_mu_);
+  warmup_signatures_.insert(std::move(key));
+}
+
+absl::Status SavedModelImpl::ExportWarmupSignatures() {
+  const std::string& path = options_.warmup_signatures_path;
+  if (path.empty()) {
+    return absl::FailedPreconditionError(
+        "Warmup signature recording is not enabled; set "
+        "`SavedModel::Options::warmup_signatures_path` to enable it.");
+  }
+
+  std::vector<std::string> lines;
+  {
+    tensorflow::mutex_lock l(warmup_signatures_mu_);
+    lines.assign(warmup_signatures_.begin(), warmup_signatures_.end());
+  }
+  // Sort for a deterministic file layout.
+  std::sort(lines.begin(), lines.end());
+
+  // Write to a temporary file and rename it into place, so that a concurrent
+  // load never observes a partially written file.
+  const std::string tmp_path = absl::StrCat(
+      path, ".tmp-", absl::Hex(random::New64(), absl::kZeroPad16));
+  TF_RETURN_IF_ERROR(
+      WriteStringToFile(Env::Default(), tmp_path, absl::StrJoin(lines, "\n")));
+  return Env::Default()->RenameFile(tmp_path, path);
+}
+
 struct SavedModelImpl::JoinedSignature {
   // A unique name for the joined signature.
   std::string name;
@@ -26,6 +26,8 @@ limitations under the License.
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "tensorflow/core/framework/graph.pb.h"
@@ -115,6 +117,15 @@ class SavedModel {
     // MetaGraphDef.
     bool emit_model_type_metric = false;
 
+    // If non-empty, the path of the warmup signatures file for this model. If
+    // the file exists at loading time, each recorded signature/shape
+    // combination is replayed with synthetic zero-valued input tensors before
+    // `LoadSavedModel()` returns, so that kernel caches, XLA executables and
+    // autotuning results are populated before the model serves real traffic.
+    // While serving, the distinct input shape combinations passed to `Run()`
+    // are recorded and can be persisted with `ExportWarmupSignatures()`.
+    std::string warmup_signatures_path;
+
     GraphExecutionOptions graph_execution_options;
   };
 
@@ -188,6 +199,16 @@ class SavedModel {
       absl::Span<const std::string> target_node_names,
       std::vector<tensorflow::Tensor>* outputs) = 0;
 
+  // Persists the distinct input shape combinations observed by `Run()` to the
+  // warmup signatures file configured in `Options`, so that the next load of
+  // this model can replay them before serving. Returns an error if warmup
+  // signature recording is not enabled.
+  virtual absl::Status ExportWarmupSignatures() {
+    return absl::UnimplementedError(
+        "ExportWarmupSignatures is not supported by this SavedModel "
+        "implementation.");
+  }
+
  protected:
   const FallbackState& fallback_state() const {
     return graph_executor_->fallback_state();
@@ -261,6 +282,8 @@ class SavedModelImpl final : public SavedModel {
       absl::Span<const std::string> target_node_names,
       std::vector<tensorflow::Tensor>* outputs) override;
 
+  absl::Status ExportWarmupSignatures() override;
+
  private:
   // The result of loading signature(s).
   struct LoadingResult {
@@ -305,6 +328,12 @@ class SavedModelImpl final : public SavedModel {
                            absl::Span<const std::string> names)
       TF_LOCKS_EXCLUDED(loading_result_cache_mu_);
 
+  // Records the input shape combination of one `Run()` invocation for later
+  // export to the warmup signatures file.
+  void RecordWarmupSignature(absl::string_view name,
+                             absl::Span<const tensorflow::Tensor> inputs)
+      TF_LOCKS_EXCLUDED(warmup_signatures_mu_);
+
   SymbolUids symbol_uids_;
   // `meta_graph_def_` only contains metadata of the model. The graph_def field
   // is removed.
@@ -329,6 +358,12 @@ class SavedModelImpl final : public SavedModel {
   absl::flat_hash_map<std::string /*joined_name*/,
                       std::unique_ptr<LoadingResult>>
       loading_result_cache_ TF_GUARDED_BY(loading_result_cache_mu_);
+  tensorflow::mutex warmup_signatures_mu_;
+  // The distinct input shape combinations observed by `Run()`, in the
+  // serialized warmup signature format. Only populated when
+  // `options_.warmup_signatures_path` is non-empty.
+  absl::flat_hash_set<std::string> warmup_signatures_
+      TF_GUARDED_BY(warmup_signatures_mu_);
 };
 
 class SavedModelMiraImpl;
@@ -109,8 +109,12 @@ absl::Status CompileTfGraphToHlo(
 
   XlaPlatformInfo platform_info(DEVICE_GPU, se::cuda::kCudaPlatformId, nullptr,
                                 nullptr, nullptr);
-  *options = GenerateCompilerOptionsForPjRt(
-      flib_def, graph_def_version, device.get(), platform_info, nullptr);
+  // Pass has_ref_vars=true to keep passthrough-parameter aliasing disabled for
+  // AOT compilation; the executable may run on a runtime that does not track
+  // buffer donation.
+  *options = GenerateCompilerOptionsForPjRt(flib_def, graph_def_version,
+                                            device.get(), platform_info,
+                                            nullptr, /*has_ref_vars=*/true);
   // Set device type correctly so that compilation can find kernels.
   options->device_type = DeviceType("XLA_GPU_JIT");
 
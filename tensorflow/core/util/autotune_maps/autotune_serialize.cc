@@ -16,17 +16,23 @@ limitations under the License.
 // For Google-internal use only.
 #include "tensorflow/core/util/autotune_maps/autotune_serialize.h"
 
+#include <cstdlib>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "absl/base/call_once.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/str_cat.h"
 #include "xla/status_macros.h"
 #include "xla/stream_executor/dnn.h"
 #include "xla/stream_executor/gpu/gpu_init.h"
 #include "xla/stream_executor/platform_manager.h"
 #include "xla/tsl/lib/strings/proto_serialization.h"
 #include "xla/tsl/protobuf/dnn.pb.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/str_util.h"
 #include "tensorflow/core/util/activation_mode.h"
 #include "tensorflow/core/util/autotune_maps/autotune_map.pb.h"
@@ -211,4 +217,106 @@ void ResetAutotuneMaps() {
 #endif  // GOOGLE_CUDA || TENSORFLOW_USE_ROCM
 }
 
+#if GOOGLE_CUDA || TENSORFLOW_USE_ROCM
+namespace {
+
+// Adds entries from `src` that are missing from `dst`. Entries with a stale
+// version are dropped so they age out of the cache file.
+void MergeConvMapProtos(const ConvMapProto &src, ConvMapProto *dst) {
+  absl::flat_hash_set<std::string> present;
+  for (const ConvMapProto::Entry &kv : dst->kv_pairs()) {
+    std::string serialized_key;
+    if (tsl::SerializeToStringDeterministic(kv.key(), &serialized_key)) {
+      present.insert(std::move(serialized_key));
+    }
+  }
+  for (const ConvMapProto::Entry &kv : src.kv_pairs()) {
+    if (kv.key().version() != ConvParameters::kVersion) {
+      continue;
+    }
+    std::string serialized_key;
+    if (!tsl::SerializeToStringDeterministic(kv.key(), &serialized_key)) {
+      continue;
+    }
+    if (present.insert(std::move(serialized_key)).second) {
+      *dst->add_kv_pairs() = kv;
+    }
+  }
+}
+
+}  // namespace
+#endif  // GOOGLE_CUDA || TENSORFLOW_USE_ROCM
+
+absl::Status LoadAutotuneMapsFromFile(const std::string &file_path) {
+  std::string data;
+  const absl::Status read_status =
+      ReadFileToString(Env::Default(), file_path, &data);
+  if (absl::IsNotFound(read_status)) {
+    // No results cached yet; the first process on this host pays for
+    // autotuning and stores the results at exit.
+    return absl::OkStatus();
+  }
+  TF_RETURN_IF_ERROR(read_status);
+  return LoadSerializedAutotuneMaps(data);
+}
+
+absl::Status MergeAutotuneMapsToFile(const std::string &file_path) {
+  std::string serialized;
+  TF_RETURN_IF_ERROR(SerializeAutotuneMaps(&serialized));
+  AutotuneMapsProto merged;
+  if (!merged.ParseFromString(serialized)) {
+    return errors::Internal("Failed to reparse serialized autotune maps.");
+  }
+#if GOOGLE_CUDA || TENSORFLOW_USE_ROCM
+  // Retain entries already on disk (written by concurrent processes, or
+  // belonging to GPU models not present on this host) that this process does
+  // not have in memory.
+  std::string existing;
+  if (ReadFileToString(Env::Default(), file_path, &existing).ok()) {
+    AutotuneMapsProto on_disk;
+    if (on_disk.ParseFromString(existing)) {
+      MergeConvMapProtos(on_disk.conv_map(), merged.mutable_conv_map());
+      MergeConvMapProtos(on_disk.fused_conv_map(),
+                         merged.mutable_fused_conv_map());
+    } else {
+      LOG(WARNING) << "Discarding unparseable autotune cache file: "
+                   << file_path;
+    }
+  }
+#endif  // GOOGLE_CUDA || TENSORFLOW_USE_ROCM
+  std::string output;
+  TF_RET_CHECK(tsl::SerializeToStringDeterministic(merged, &output));
+  // Write through a temporary file and rename so that concurrent readers
+  // never observe a partially written file.
+  const std::string tmp_path =
+      absl::StrCat(file_path, ".tmp.", Env::Default()->NowNanos());
+  TF_RETURN_IF_ERROR(WriteStringToFile(Env::Default(), tmp_path, output));
+  return Env::Default()->RenameFile(tmp_path, file_path);
+}
+
+void MaybeInitializeAutotuneFileCache() {
+  static absl::once_flag once;
+  absl::call_once(once, []() {
+    const char *dir = std::getenv("TF_AUTOTUNE_CACHE_DIR");
+    if (dir == nullptr || *dir == '\0') {
+      return;
+    }
+    static const std::string *const file_path =
+        new std::string(io::JoinPath(dir, "conv_autotune_maps.pb"));
+    const absl::Status load_status = LoadAutotuneMapsFromFile(*file_path);
+    if (!load_status.ok()) {
+      LOG(WARNING) << "Could not load autotune cache file " << *file_path
+                   << ": " << load_status
+                   << "; autotuning will run from scratch.";
+    }
+    atexit(+[]() {
+      const absl::Status save_status = MergeAutotuneMapsToFile(*file_path);
+      if (!save_status.ok()) {
+        LOG(WARNING) << "Could not update autotune cache file " << *file_path
+                     << ": " << save_status;
+      }
+    });
+  });
+}
+
 }  // namespace tensorflow
@@ -45,6 +45,28 @@ absl::Status SerializeAutotuneMaps(std::string* output);
 // Resets all autotune maps. For test use only.
 void ResetAutotuneMaps();
 
+// File-backed autotune cache.
+//
+// When the TF_AUTOTUNE_CACHE_DIR environment variable is set, the first call
+// loads previously stored autotune results from
+// <TF_AUTOTUNE_CACHE_DIR>/conv_autotune_maps.pb and registers a process-exit
+// hook that merges the in-memory autotune maps back into that file. Loaded
+// entries are validated against the runtime's ConvParameters version and the
+// GPU models present on the host, so only the first process ever run on a new
+// GPU model pays for autotuning. Subsequent calls are no-ops; with the
+// variable unset the function does nothing.
+void MaybeInitializeAutotuneFileCache();
+
+// Loads autotune maps previously stored by MergeAutotuneMapsToFile. A missing
+// file is not an error; it simply means no results have been cached yet.
+absl::Status LoadAutotuneMapsFromFile(const std::string& file_path);
+
+// Merges the current autotune maps into `file_path`: entries already on disk
+// (e.g. written by concurrent processes, or for other GPU models) are
+// retained unless their version is stale, and the combined maps are written
+// atomically via a temporary file and rename.
+absl::Status MergeAutotuneMapsToFile(const std::string& file_path);
+
 }  // namespace tensorflow
 
 #endif  // TENSORFLOW_CORE_UTIL_AUTOTUNE_MAPS_AUTOTUNE_SERIALIZE_H_
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -38,6 +40,7 @@ limitations under the License.
 #include "tensorflow/core/platform/blocking_counter.h"
 #include "tensorflow/core/platform/byte_order.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/protobuf.h"
 #include "tensorflow/core/util/presized_cuckoo_map.h"
 #include "tensorflow/core/util/sparse/sparse_tensor.h"
@@ -567,6 +570,97 @@ struct SeededHasher {
   uint64 seed{0xDECAFCAFFE};
 };
 
+// Feature-name lookup state shared by FastParseExample and
+// FastParseSingleExample.
+struct ConfigIndex {
+  explicit ConfigIndex(size_t size) : map(size) {}
+
+  PresizedCuckooMap<std::pair<size_t, Type>> map;
+  SeededHasher hasher;
+};
+
+// Builds the feature-name index for `config`, reseeding the hasher until the
+// presized cuckoo map is collision free.
+absl::Status BuildConfigIndex(const Config& config, ConfigIndex* index) {
+  const size_t config_size =
+      config.dense.size() + config.sparse.size() + config.ragged.size();
+  bool ok = true;
+  for (size_t i = 0; i < 1000; ++i) {
+    for (size_t d = 0; d < config.dense.size(); ++d) {
+      ok &= index->map.InsertUnique(
+          index->hasher(config.dense[d].feature_name), {d, Type::Dense});
+    }
+    for (size_t d = 0; d < config.sparse.size(); ++d) {
+      ok &= index->map.InsertUnique(
+          index->hasher(config.sparse[d].feature_name), {d, Type::Sparse});
+    }
+    for (size_t d = 0; d < config.ragged.size(); ++d) {
+      ok &= index->map.InsertUnique(
+          index->hasher(config.ragged[d].feature_name), {d, Type::Ragged});
+    }
+    if (ok) break;
+    LOG(WARNING) << "Collision found. This should happen only if you have "
+                    "around 2^32 entries in your config.";
+    index->hasher.seed++;
+    index->map.Clear(config_size);
+    ok = true;
+  }
+  if (!ok) {
+    return errors::Internal(
+        "Could not avoid collision. This should not happen.");
+  }
+  return absl::OkStatus();
+}
+
+// Maximum number of distinct feature-name layouts whose indices are kept in
+// the process-wide cache below. Jobs typically use a handful of parse
+// configurations; the cache is dropped wholesale if this is exceeded.
+constexpr size_t kConfigIndexCacheMaxEntries = 64;
+
+// Returns the feature-name index for `config`, reusing a previously built
+// index if a config with the same feature names and kinds has been seen
+// before. The parsing kernels rebuild their config on every invocation, but
+// the feature names almost never change across batches, so the index --
+// whose construction seeds a cuckoo table with every feature name -- is
+// cached process-wide. The index depends only on feature names and kinds,
+// not on default values or batch contents.
+absl::Status GetOrCreateConfigIndex(const Config& config,
+                                    std::shared_ptr<const ConfigIndex>* index) {
+  static mutex& mu = *new mutex;
+  static auto& cache =
+      *new absl::flat_hash_map<string, std::shared_ptr<const ConfigIndex>>;
+
+  // The cache key encodes the kind and length-prefixed name of every feature,
+  // so no two distinct configs can alias.
+  string key;
+  const auto append_key = [&key](char kind, StringPiece name) {
+    key.push_back(kind);
+    key.append(std::to_string(name.size()));
+    key.push_back(':');
+    key.append(name.data(), name.size());
+  };
+  for (const auto& d : config.dense) append_key('d', d.feature_name);
+  for (const auto& s : config.sparse) append_key('s', s.feature_name);
+  for (const auto& r : config.ragged) append_key('r', r.feature_name);
+
+  {
+    mutex_lock l(mu);
+    auto iter = cache.find(key);
+    if (iter != cache.end()) {
+      *index = iter->second;
+      return absl::OkStatus();
+    }
+  }
+  // Built outside the lock, since construction may retry on hash collisions.
+  auto new_index = std::make_shared<ConfigIndex>(
+      config.dense.size() + config.sparse.size() + config.ragged.size());
+  TF_RETURN_IF_ERROR(BuildConfigIndex(config, new_index.get()));
+  mutex_lock l(mu);
+  if (cache.size() >= kConfigIndexCacheMaxEntries) cache.clear();
+  *index = cache.emplace(std::move(key), std::move(new_index)).first->second;
+  return absl::OkStatus();
+}
+
 void LogDenseFeatureDataLoss(StringPiece feature_name) {
   LOG(WARNING) << "Data loss! Feature '" << feature_name
                << "' is present in multiple concatenated "
@@ -589,6 +683,29 @@ void LogSparseFeatureDataLoss(StringPiece feature_name) {
   duplicated_sparse_feature->GetCell()->IncrementBy(1);
 }
 
+// Sentinel for a position in `config_index_hints` that has not matched a
+// config entry yet.
+constexpr size_t kNoConfigIndexHint = std::numeric_limits<size_t>::max();
+
+// Returns the feature name of the config entry that `entry` points at.
+const tstring& ConfigFeatureName(const Config& config,
+                                 const std::pair<size_t, Type>& entry) {
+  if (entry.second == Type::Dense) {
+    return config.dense[entry.first].feature_name;
+  }
+  if (entry.second == Type::Ragged) {
+    return config.ragged[entry.first].feature_name;
+  }
+  return config.sparse[entry.first].feature_name;
+}
+
+// If `config_index_hints` is non-null, it memoizes per feature position which
+// config entry the feature at that position matched in the previously parsed
+// example. Examples in a batch typically list their features in an identical
+// order, so in steady state the hint replaces the per-feature hashed lookup
+// with a single string compare; mispredictions fall back to the hash table.
+// The caller keeps one hint vector per sequentially-parsed stream of examples
+// (e.g. per minibatch).
 absl::Status FastParseSerializedExample(
     const tstring& serialized_example, const tstring& example_name,
     const size_t example_index, const Config& config,
@@ -597,7 +714,8 @@ absl::Status FastParseSerializedExample(
     std::vector<SparseBuffer>* output_varlen_dense,
     std::vector<SparseBuffer>* output_sparse,
     std::vector<SparseBuffer>* output_ragged,
-    PerExampleFeatureStats* output_stats) {
+    PerExampleFeatureStats* output_stats,
+    std::vector<std::pair<size_t, Type>>* config_index_hints = nullptr) {
   DCHECK(output_dense != nullptr);
   DCHECK(output_sparse != nullptr);
   DCHECK(output_ragged != nullptr);
@@ -613,6 +731,12 @@ absl::Status FastParseSerializedExample(
   // Handle features present in the example.
   const size_t parsed_example_size = parsed_example.size();
 
+  if (config_index_hints != nullptr &&
+      config_index_hints->size() < parsed_example_size) {
+    config_index_hints->resize(parsed_example_size,
+                               {kNoConfigIndexHint, Type::Dense});
+  }
+
   if (output_stats) {
     // TODO(b/111553342): This may over-count the number of features if there
     // are duplicate keys in the feature map. Consider deduplicating the keys
@@ -630,23 +754,35 @@ absl::Status FastParseSerializedExample(
     parsed::Feature& feature = name_and_feature.second;
 
     std::pair<size_t, Type> d_and_type;
-    uint64 h = hasher(feature_name);
-    if (!config_index.Find(h, &d_and_type)) continue;
+    // First try the config entry the previous example matched at this
+    // position, which exploits the (near-)identical field ordering of
+    // Examples from one source.
+    bool predicted = false;
+    if (config_index_hints != nullptr && i < config_index_hints->size()) {
+      const std::pair<size_t, Type>& hint = (*config_index_hints)[i];
+      if (hint.first != kNoConfigIndexHint &&
+          feature_name == ConfigFeatureName(config, hint)) {
+        d_and_type = hint;
+        predicted = true;
+      }
+    }
+    if (!predicted) {
+      uint64 h = hasher(feature_name);
+      if (!config_index.Find(h, &d_and_type)) continue;
 
-    size_t d = d_and_type.first;
-    bool is_dense = d_and_type.second == Type::Dense;
-    bool is_ragged = d_and_type.second == Type::Ragged;
-
-    {
       // Testing for PresizedCuckooMap collision.
       // TODO(lew): Use dense_hash_map and avoid this and hasher creation.
-      const tstring& config_feature_name =
-          is_dense ? config.dense[d].feature_name
-                   : (is_ragged ? config.ragged[d].feature_name
-                                : config.sparse[d].feature_name);
-      if (feature_name != config_feature_name) continue;
+      if (feature_name != ConfigFeatureName(config, d_and_type)) continue;
+
+      if (config_index_hints != nullptr && i < config_index_hints->size()) {
+        (*config_index_hints)[i] = d_and_type;
+      }
     }
 
+    size_t d = d_and_type.first;
+    bool is_dense = d_and_type.second == Type::Dense;
+    bool is_ragged = d_and_type.second == Type::Ragged;
+
     auto example_error = [&](StringPiece suffix) {
       return errors::InvalidArgument("Name: ", example_name,
                                      ", Key: ", feature_name,
@@ -1145,36 +1281,11 @@ absl::Status FastParseExample(const Config& config,
     result->feature_stats.resize(serialized.size());
   }
 
-  size_t config_size =
-      config.dense.size() + config.sparse.size() + config.ragged.size();
-  SeededHasher hasher;
-  // Build config index.
-  PresizedCuckooMap<std::pair<size_t, Type>> config_index(config_size);
-  bool ok = true;
-  for (size_t i = 0; i < 1000; ++i) {
-    for (size_t d = 0; d < config.dense.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.dense[d].feature_name),
-                                      {d, Type::Dense});
-    }
-    for (size_t d = 0; d < config.sparse.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.sparse[d].feature_name),
-                                      {d, Type::Sparse});
-    }
-    for (size_t d = 0; d < config.ragged.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.ragged[d].feature_name),
-                                      {d, Type::Ragged});
-    }
-    if (ok) break;
-    LOG(WARNING) << "Collision found. This should happen only if you have "
-                    "around 2^32 entries in your config.";
-    hasher.seed++;
-    config_index.Clear(config_size);
-    ok = true;
-  }
-  if (!ok) {
-    return errors::Internal(
-        "Could not avoid collision. This should not happen.");
-  }
+  // Get the cached config index, or build it for a new config.
+  std::shared_ptr<const ConfigIndex> index;
+  TF_RETURN_IF_ERROR(GetOrCreateConfigIndex(config, &index));
+  const PresizedCuckooMap<std::pair<size_t, Type>>& config_index = index->map;
+  const SeededHasher& hasher = index->hasher;
 
   // Allocate dense output for fixed length dense values
   // (variable-length dense and sparse and ragged have to be buffered).
@@ -1235,6 +1346,9 @@ absl::Status FastParseExample(const Config& config,
     sparse_buffers[minibatch].resize(config.sparse.size());
     varlen_dense_buffers[minibatch].resize(config.dense.size());
     ragged_buffers[minibatch].resize(config.ragged.size());
+    // Per-position lookup hints, carried from one example to the next within
+    // this minibatch. See FastParseSerializedExample.
+    std::vector<std::pair<size_t, Type>> config_index_hints;
     size_t start = first_example_of_minibatch(minibatch);
     size_t end = first_example_of_minibatch(minibatch + 1);
     for (size_t e = start; e < end; ++e) {
@@ -1247,7 +1361,7 @@ absl::Status FastParseExample(const Config& config,
           (!example_names.empty() ? example_names[e] : "<unknown>"), e, config,
           config_index, hasher, &fixed_dense_values,
           &varlen_dense_buffers[minibatch], &sparse_buffers[minibatch],
-          &ragged_buffers[minibatch], stats);
+          &ragged_buffers[minibatch], stats, &config_index_hints);
       if (!status_of_minibatch[minibatch].ok()) break;
     }
   };
@@ -1459,37 +1573,11 @@ absl::Status FastParseSingleExample(const Config& config,
     stats = &result->feature_stats.back();
   }
 
-  // TODO(mrry): Cache the construction of this map at Op construction time.
-  size_t config_size =
-      config.dense.size() + config.sparse.size() + config.ragged.size();
-  SeededHasher hasher;
-  // Build config index.
-  PresizedCuckooMap<std::pair<size_t, Type>> config_index(config_size);
-  bool ok = true;
-  for (size_t i = 0; i < 1000; ++i) {
-    for (size_t d = 0; d < config.dense.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.dense[d].feature_name),
-                                      {d, Type::Dense});
-    }
-    for (size_t d = 0; d < config.sparse.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.sparse[d].feature_name),
-                                      {d, Type::Sparse});
-    }
-    for (size_t d = 0; d < config.ragged.size(); ++d) {
-      ok &= config_index.InsertUnique(hasher(config.ragged[d].feature_name),
-                                      {d, Type::Ragged});
-    }
-    if (ok) break;
-    LOG(WARNING) << "Collision found. This should happen only if you have "
-                    "around 2^32 entries in your config.";
-    hasher.seed++;
-    config_index.Clear(config_size);
-    ok = true;
-  }
-  if (!ok) {
-    return errors::Internal(
-        "Could not avoid collision. This should not happen.");
-  }
+  // Get the cached config index, or build it for a new config.
+  std::shared_ptr<const ConfigIndex> index;
+  TF_RETURN_IF_ERROR(GetOrCreateConfigIndex(config, &index));
+  const PresizedCuckooMap<std::pair<size_t, Type>>& config_index = index->map;
+  const SeededHasher& hasher = index->hasher;
 
   result->sparse_indices.reserve(config.sparse.size());
   result->sparse_values.reserve(config.sparse.size());
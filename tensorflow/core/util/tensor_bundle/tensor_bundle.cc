@@ -15,15 +15,19 @@ limitations under the License.
 
 #include "tensorflow/core/util/tensor_bundle/tensor_bundle.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/base/call_once.h"
 #include "absl/synchronization/mutex.h"
 #include "xla/tsl/lib/io/buffered_file.h"
 #include "xla/tsl/util/byte_swap_array.h"
+#include "tensorflow/core/framework/allocation_description.pb.h"
 #include "tensorflow/core/framework/register_types.h"
 #include "tensorflow/core/framework/tensor.pb.h"
 #include "tensorflow/core/framework/tensor_shape.pb.h"
@@ -44,6 +48,7 @@ limitations under the License.
 #include "tensorflow/core/platform/bfloat16.h"
 #include "tensorflow/core/platform/cord.h"
 #include "tensorflow/core/platform/errors.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/mem.h"
 #include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/random.h"
@@ -454,18 +459,62 @@ BundleWriter::BundleWriter(Env* env, StringPiece prefix, const Options& options)
   out_ = std::make_unique<tsl::BufferedWritableFile>(
       std::move(wrapper), 8 << 20 /* 8MB write buffer */);
 
+  if (!options_.delta_base_prefix.empty()) {
+    if (options_.delta_base_prefix == prefix_) {
+      status_ = errors::InvalidArgument(
+          "Delta base prefix must differ from the bundle prefix: ", prefix_);
+      return;
+    }
+    base_reader_ =
+        std::make_unique<BundleReader>(env_, options_.delta_base_prefix);
+    status_ = base_reader_->status();
+    if (!status_.ok()) return;
+  }
+
   VLOG(1) << "Writing to file " << data_path_;
 }
 
+BundleWriter::~BundleWriter() = default;
+
 absl::Status BundleWriter::Add(StringPiece key, const Tensor& val) {
+  return AddTensor(key, val, /*try_delta_skip=*/true);
+}
+
+absl::Status BundleWriter::AddTensor(StringPiece key, const Tensor& val,
+                                     bool try_delta_skip) {
   if (!status_.ok()) return status_;
   CHECK_NE(key, kHeaderEntryKey);
   const string key_string(key);
-  if (entries_.find(key_string) != entries_.end()) {
+  if (entries_.find(key_string) != entries_.end() ||
+      delta_skipped_keys_.find(key_string) != delta_skipped_keys_.end()) {
     status_ = errors::InvalidArgument("Adding duplicate key: ", key);
     return status_;
   }
 
+  // Incremental save: if the base bundle already holds an identical tensor
+  // under this key, record nothing; readers fall back to the base.  Restricted
+  // to fixed-size dtypes, whose stored checksum covers exactly the tensor
+  // bytes (string and variant checksums also cover their length encodings).
+  if (try_delta_skip && base_reader_ != nullptr &&
+      DataTypeCanUseMemcpy(val.dtype())) {
+    BundleEntryProto base_entry;
+    absl::Status base_status =
+        base_reader_->GetBundleEntryProto(key, &base_entry);
+    if (base_status.ok()) {
+      if (base_entry.slices().empty() && base_entry.dtype() == val.dtype() &&
+          TensorShape(base_entry.shape()) == val.shape() &&
+          base_entry.size() == static_cast<int64_t>(val.TotalBytes()) &&
+          crc32c::Unmask(base_entry.crc32c()) ==
+              crc32c::Value(val.tensor_data().data(), val.TotalBytes())) {
+        delta_skipped_keys_.insert(key_string);
+        return absl::OkStatus();
+      }
+    } else if (!errors::IsNotFound(base_status)) {
+      status_ = base_status;
+      return status_;
+    }
+  }
+
   BundleEntryProto* entry = &entries_[key_string];
   entry->set_dtype(val.dtype());
   val.shape().AsProto(entry->mutable_shape());
@@ -528,10 +577,12 @@ absl::Status BundleWriter::AddSlice(StringPiece full_tensor_key,
   slice_spec.AsProto(slice_proto);
 
   // The slice itself is handled by a regular Add(), which includes adding its
-  // own metadata entry, and writing out the slice's values.
+  // own metadata entry, and writing out the slice's values.  Delta skipping
+  // is disabled here: the full tensor entry above lives in this bundle's
+  // index, so all of its slice entries must as well.
   const string slice_name =
       checkpoint::EncodeTensorNameSlice(full_tensor_key_string, slice_spec);
-  status_ = Add(slice_name, slice_tensor);
+  status_ = AddTensor(slice_name, slice_tensor, /*try_delta_skip=*/false);
   return status_;
 }
 
@@ -569,6 +620,9 @@ absl::Status BundleWriter::Finish() {
     VersionDef* version = header.mutable_version();
     version->set_producer(kTensorBundleVersion);
     version->set_min_consumer(kTensorBundleMinConsumer);
+    if (!options_.delta_base_prefix.empty()) {
+      header.set_delta_base_prefix(options_.delta_base_prefix);
+    }
 
     builder.Add(kHeaderEntryKey, header.SerializeAsString());
 
@@ -773,6 +827,92 @@ absl::Status MergeBundles(Env* env, absl::Span<const tstring> prefixes,
 
 // Interface for reading a tensor bundle.
 
+namespace {
+
+// Tensors smaller than this are never offered to the registry below: the
+// bookkeeping overhead would exceed the savings, and small tensors (step
+// counters, scalars) are also the ones most likely to collide by value
+// without actually being shared weights.
+constexpr int64_t kMinSharedTensorBytes = 4 << 10;
+
+// Process-wide registry that lets concurrently open BundleReaders share one
+// buffer for identical restored tensors, keyed by a 128-bit fingerprint of
+// the restored bytes folded with the dtype and shape.  When several models
+// duplicating a common backbone are loaded side by side, their weight
+// tensors then alias a single allocation (downstream consumers such as
+// AssignVariableOp keep the Tensor by reference, so the sharing survives
+// into resource variables).  Entries are refcounted by the readers that
+// interned them and erased when the last such reader closes, so the registry
+// only bridges overlapping loads and retains nothing afterwards.  Opt-in via
+// TF_ENABLE_RESTORED_TENSOR_SHARING: callers that mutate restored tensors in
+// place must leave this off.
+class RestoredTensorRegistry {
+ public:
+  static RestoredTensorRegistry* Global() {
+    static RestoredTensorRegistry* registry = new RestoredTensorRegistry;
+    return registry;
+  }
+
+  static bool Enabled() {
+    static const bool enabled = [] {
+      bool enable = false;
+      TF_CHECK_OK(ReadBoolFromEnvVar("TF_ENABLE_RESTORED_TENSOR_SHARING",
+                                     /*default_val=*/false, &enable));
+      return enable;
+    }();
+    return enabled;
+  }
+
+  // Fingerprint of `val`'s bytes folded with its dtype and shape.
+  // REQUIRES: DataTypeCanUseMemcpy(val.dtype()).
+  static Fprint128 Fingerprint(const Tensor& val) {
+    Fprint128 fp = Fingerprint128(val.tensor_data());
+    fp = tsl::FingerprintCat128(fp, static_cast<uint64>(val.dtype()));
+    for (int d = 0; d < val.dims(); ++d) {
+      fp = tsl::FingerprintCat128(fp, static_cast<uint64>(val.dim_size(d)));
+    }
+    return fp;
+  }
+
+  // Points `*val` at the tensor registered under `fp`, registering `*val`
+  // itself if the fingerprint is new.  Returns true if `*val` now aliases
+  // the registry entry, in which case the caller must balance this call with
+  // Release(); returns false (leaving `*val` alone) on the theoretical
+  // fingerprint collision where the stored tensor's dtype or shape differs.
+  bool Intern(const Fprint128& fp, Tensor* val) {
+    const std::pair<uint64, uint64> key(fp.low64, fp.high64);
+    absl::MutexLock l(&mu_);
+    auto result = entries_.emplace(key, Entry{*val, 0});
+    Entry& entry = result.first->second;
+    if (!result.second && (entry.tensor.dtype() != val->dtype() ||
+                           entry.tensor.shape() != val->shape())) {
+      return false;
+    }
+    ++entry.uses;
+    *val = entry.tensor;
+    return true;
+  }
+
+  void Release(const std::pair<uint64, uint64>& key) {
+    absl::MutexLock l(&mu_);
+    auto it = entries_.find(key);
+    if (it != entries_.end() && --it->second.uses == 0) {
+      entries_.erase(it);
+    }
+  }
+
+ private:
+  struct Entry {
+    Tensor tensor;
+    int64_t uses;
+  };
+
+  absl::Mutex mu_;
+  std::map<std::pair<uint64, uint64>, Entry> entries_ TF_GUARDED_BY(mu_);
+};
+
+}  // namespace
+
 BundleReader::BundleReader(
     Env* env, StringPiece prefix,
     bool enable_multi_threading_for_testing /* = false */)
@@ -789,7 +929,8 @@ BundleReader::BundleReader(Env* env, StringPiece prefix, Options options)
       iter_(nullptr),
       need_to_swap_bytes_(false),
       enable_multi_threading_for_testing_(
-          options.enable_multi_threading_for_testing) {
+          options.enable_multi_threading_for_testing),
+      use_mmap_(options.use_mmap) {
   if (cache_ == nullptr) {
     // Make a cache for use just by this BundleReader.
     owned_cache_ = std::make_unique<BundleCache>(env);
@@ -841,9 +982,32 @@ BundleReader::BundleReader(Env* env, StringPiece prefix, Options options)
   }
   status_ = CheckVersions(header.version(), kTensorBundleVersion,
                           kTensorBundleMinProducer, "Checkpoint", "checkpoint");
+  if (!status_.ok()) return;
+
+  // Delta bundle: chain a reader over the base bundle so that lookups of
+  // keys absent from this bundle's index fall back to it.
+  if (!header.delta_base_prefix().empty()) {
+    if (header.delta_base_prefix() == prefix_) {
+      status_ = CorruptFileError(absl::OkStatus(), filename,
+                                 "delta base prefix refers to the bundle "
+                                 "itself");
+      return;
+    }
+    Options base_options;
+    base_options.cache = cache_;
+    base_options.enable_multi_threading_for_testing =
+        enable_multi_threading_for_testing_;
+    base_options.use_mmap = use_mmap_;
+    base_reader_ = std::make_unique<BundleReader>(
+        env_, header.delta_base_prefix(), base_options);
+    status_ = base_reader_->status();
+  }
 }
 
 BundleReader::~BundleReader() {
+  for (const auto& key : shared_tensor_keys_) {
+    RestoredTensorRegistry::Global()->Release(key);
+  }
   delete metadata_;
   delete iter_;
   delete table_;
@@ -881,10 +1045,87 @@ absl::Status BundleReader::GetBundleEntryProto(StringPiece key,
   return absl::OkStatus();
 }
 
+namespace {
+
+// A TensorBuffer pointing into a read-only memory mapping of a bundle data
+// file. Holds a reference on the mapping so that it outlives the tensor.
+class MmapTensorBuffer : public TensorBuffer {
+ public:
+  MmapTensorBuffer(std::shared_ptr<ReadOnlyMemoryRegion> region, void* data,
+                   size_t size)
+      : TensorBuffer(data), region_(std::move(region)), size_(size) {}
+
+  size_t size() const override { return size_; }
+  TensorBuffer* root_buffer() override { return this; }
+  bool OwnsMemory() const override { return false; }
+  void FillAllocationDescription(AllocationDescription* proto) const override {
+    proto->set_requested_bytes(size_);
+    proto->set_allocator_name("mmap");
+  }
+
+ private:
+  std::shared_ptr<ReadOnlyMemoryRegion> region_;
+  size_t size_;
+};
+
+}  // namespace
+
+absl::Status BundleReader::GetMmapRegion(
+    int shard_id, std::shared_ptr<ReadOnlyMemoryRegion>* region) {
+  std::shared_ptr<ReadOnlyMemoryRegion>& opened = mmap_regions_[shard_id];
+  if (opened == nullptr) {
+    std::unique_ptr<ReadOnlyMemoryRegion> mapped;
+    TF_RETURN_IF_ERROR(env_->NewReadOnlyMemoryRegionFromFile(
+        DataFilename(prefix_, shard_id, num_shards_), &mapped));
+    opened = std::move(mapped);
+  }
+  *region = opened;
+  return absl::OkStatus();
+}
+
 absl::Status BundleReader::GetValue(const BundleEntryProto& entry,
                                     Tensor* val) {
   Tensor* ret = val;
   const TensorShape stored_shape(TensorShape(entry.shape()));
+
+  // Memory-mapped path: serves suitably aligned raw tensor data straight out
+  // of a read-only mapping of the data file, so nothing is copied and pages
+  // are faulted in lazily. The checksum is deliberately not validated here;
+  // doing so would read every page at load time.
+  if (use_mmap_ && DataTypeCanUseMemcpy(entry.dtype()) &&
+      !need_to_swap_bytes_ && entry.size() > 0 &&
+      entry.offset() % Allocator::kAllocatorAlignment == 0) {
+    std::shared_ptr<ReadOnlyMemoryRegion> region;
+    absl::Status mmap_status = GetMmapRegion(entry.shard_id(), &region);
+    if (!mmap_status.ok()) {
+      LOG(WARNING) << "Reading tensor bundle at " << prefix_
+                   << " without mmap: " << mmap_status;
+      use_mmap_ = false;
+    } else {
+      if (static_cast<uint64>(entry.offset()) + entry.size() >
+          region->length()) {
+        return errors::DataLoss("Invalid offset in bundle entry: key ", key(),
+                                "; offset ", entry.offset(), "; size ",
+                                entry.size(), "; data file length ",
+                                region->length());
+      }
+      const int64_t expected_size =
+          stored_shape.num_elements() * DataTypeSize(entry.dtype());
+      if (entry.size() != expected_size) {
+        return errors::DataLoss("Invalid size in bundle entry: key ", key(),
+                                "; stored size ", entry.size(),
+                                "; expected size ", expected_size);
+      }
+      char* data =
+          const_cast<char*>(static_cast<const char*>(region->data())) +
+          entry.offset();
+      auto* buffer =
+          new MmapTensorBuffer(std::move(region), data, entry.size());
+      *val = Tensor(entry.dtype(), stored_shape, buffer);
+      buffer->Unref();
+      return absl::OkStatus();
+    }
+  }
   if (val->NumElements() == 0) {
     ret = new Tensor(entry.dtype(), stored_shape);
   }
@@ -1021,13 +1262,26 @@ absl::Status BundleReader::GetValue(const BundleEntryProto& entry,
 
   *val = *ret;
   if (ret != val) delete ret;
+
+  if (RestoredTensorRegistry::Enabled() &&
+      DataTypeCanUseMemcpy(entry.dtype()) &&
+      entry.size() >= kMinSharedTensorBytes) {
+    const Fprint128 fp = RestoredTensorRegistry::Fingerprint(*val);
+    if (RestoredTensorRegistry::Global()->Intern(fp, val)) {
+      shared_tensor_keys_.emplace_back(fp.low64, fp.high64);
+    }
+  }
   return absl::OkStatus();
 }
 
 absl::Status BundleReader::Lookup(StringPiece key, Tensor* val) {
   CHECK(val != nullptr);
   BundleEntryProto entry;
-  TF_RETURN_IF_ERROR(GetBundleEntryProto(key, &entry));
+  absl::Status s = GetBundleEntryProto(key, &entry);
+  if (base_reader_ != nullptr && errors::IsNotFound(s)) {
+    return base_reader_->Lookup(key, val);
+  }
+  TF_RETURN_IF_ERROR(s);
 
   if (entry.slices().empty()) {
     return GetValue(entry, val);
@@ -1038,6 +1292,150 @@ absl::Status BundleReader::Lookup(StringPiece key, Tensor* val) {
   }
 }
 
+absl::Status BundleReader::ParallelLookup(absl::Span<const std::string> keys,
+                                          std::vector<Tensor>* values,
+                                          int max_parallelism) {
+  CHECK(values != nullptr);
+  values->clear();
+  values->resize(keys.size());
+
+  // Reads the metadata for all keys up front (the metadata iterator is not
+  // thread-safe) and allocates the result tensors. Raw fixed-size tensors are
+  // read concurrently below; string, variant, and partitioned tensors fall
+  // back to the sequential path.
+  struct RawRead {
+    size_t index;
+    BundleEntryProto entry;
+    // Set by the reader threads when restored-tensor sharing is enabled; the
+    // tensors are interned serially after the pool joins.
+    Fprint128 fingerprint = {0, 0};
+    bool fingerprinted = false;
+  };
+  std::vector<RawRead> raw_reads;
+  std::vector<size_t> sequential;
+  std::vector<std::string> base_keys;
+  std::vector<size_t> base_indices;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    BundleEntryProto entry;
+    absl::Status s = GetBundleEntryProto(keys[i], &entry);
+    if (base_reader_ != nullptr && errors::IsNotFound(s)) {
+      // Delta bundle: the key lives further down the chain.
+      base_keys.push_back(keys[i]);
+      base_indices.push_back(i);
+      continue;
+    }
+    TF_RETURN_IF_ERROR(s);
+    (*values)[i] = Tensor(entry.dtype(), TensorShape(entry.shape()));
+    if (!entry.slices().empty() || !DataTypeCanUseMemcpy(entry.dtype())) {
+      sequential.push_back(i);
+      continue;
+    }
+    if (entry.size() != (*values)[i].TotalBytes()) {
+      return errors::DataLoss("Invalid size in bundle entry: key ", keys[i],
+                              "; stored size ", entry.size(),
+                              "; expected size ", (*values)[i].TotalBytes());
+    }
+    raw_reads.push_back({i, std::move(entry)});
+  }
+
+  if (!raw_reads.empty()) {
+    // Distributes the entries across the threads balanced by size: largest
+    // entries first, each onto the least-loaded thread.
+    std::sort(raw_reads.begin(), raw_reads.end(),
+              [](const RawRead& a, const RawRead& b) {
+                return a.entry.size() > b.entry.size();
+              });
+    const int num_threads = std::min<size_t>(
+        std::max(1, max_parallelism), raw_reads.size());
+    std::vector<std::vector<RawRead*>> assignments(num_threads);
+    std::vector<int64_t> assigned_bytes(num_threads, 0);
+    for (RawRead& read : raw_reads) {
+      const int target =
+          std::min_element(assigned_bytes.begin(), assigned_bytes.end()) -
+          assigned_bytes.begin();
+      assignments[target].push_back(&read);
+      assigned_bytes[target] += read.entry.size();
+    }
+
+    std::vector<absl::Status> statuses(num_threads);
+    {
+      thread::ThreadPool reader_pool(env_, "parallel_restore", num_threads);
+      for (int t = 0; t < num_threads; ++t) {
+        reader_pool.Schedule([this, t, &assignments, &statuses, values]() {
+          // Each thread reads through its own file handles so that its reads
+          // proceed concurrently with other threads' reads of the same shard.
+          absl::flat_hash_map<int32_t, std::unique_ptr<RandomAccessFile>>
+              files;
+          for (RawRead* read : assignments[t]) {
+            const BundleEntryProto& entry = read->entry;
+            std::unique_ptr<RandomAccessFile>& file = files[entry.shard_id()];
+            if (file == nullptr) {
+              statuses[t] = env_->NewRandomAccessFile(
+                  DataFilename(prefix_, entry.shard_id(), num_shards_), &file);
+              if (!statuses[t].ok()) return;
+            }
+            Tensor& val = (*values)[read->index];
+            char* backing_buffer =
+                const_cast<char*>(val.tensor_data().data());
+            StringPiece sp;
+            statuses[t] =
+                file->Read(entry.offset(), entry.size(), &sp, backing_buffer);
+            if (!statuses[t].ok()) return;
+            if (sp.data() != backing_buffer) {
+              memmove(backing_buffer, sp.data(), entry.size());
+            }
+            const uint32 actual_crc32c =
+                crc32c::Value(backing_buffer, entry.size());
+            if (crc32c::Unmask(entry.crc32c()) != actual_crc32c) {
+              statuses[t] = errors::DataLoss(
+                  "TensorBundle at ", prefix_, " shard ", entry.shard_id(),
+                  " (", entry.size(), " bytes): Checksum does not match: ",
+                  "stored ",
+                  strings::Printf("%08u", crc32c::Unmask(entry.crc32c())),
+                  " vs. calculated on the restored bytes ", actual_crc32c);
+              return;
+            }
+            if (need_to_swap_bytes_) {
+              statuses[t] = ByteSwapTensor(&val);
+              if (!statuses[t].ok()) return;
+            }
+            if (RestoredTensorRegistry::Enabled() &&
+                entry.size() >= kMinSharedTensorBytes) {
+              read->fingerprint = RestoredTensorRegistry::Fingerprint(val);
+              read->fingerprinted = true;
+            }
+          }
+        });
+      }
+    }  // Joins the reader pool.
+    for (const absl::Status& status : statuses) {
+      TF_RETURN_IF_ERROR(status);
+    }
+    for (const RawRead& read : raw_reads) {
+      if (!read.fingerprinted) continue;
+      if (RestoredTensorRegistry::Global()->Intern(read.fingerprint,
+                                                   &(*values)[read.index])) {
+        shared_tensor_keys_.emplace_back(read.fingerprint.low64,
+                                         read.fingerprint.high64);
+      }
+    }
+  }
+
+  for (size_t index : sequential) {
+    TF_RETURN_IF_ERROR(Lookup(keys[index], &(*values)[index]));
+  }
+
+  if (!base_keys.empty()) {
+    std::vector<Tensor> base_values;
+    TF_RETURN_IF_ERROR(
+        base_reader_->ParallelLookup(base_keys, &base_values, max_parallelism));
+    for (size_t j = 0; j < base_indices.size(); ++j) {
+      (*values)[base_indices[j]] = std::move(base_values[j]);
+    }
+  }
+  return absl::OkStatus();
+}
+
 absl::Status BundleReader::ReadCurrent(Tensor* val) {
   CHECK(val != nullptr);
   BundleEntryProto entry;
@@ -1060,7 +1458,11 @@ absl::Status BundleReader::LookupTensorSlices(
     StringPiece key, std::vector<TensorSlice>* slices) {
   slices->clear();
   BundleEntryProto entry;
-  TF_RETURN_IF_ERROR(GetBundleEntryProto(key, &entry));
+  absl::Status s = GetBundleEntryProto(key, &entry);
+  if (base_reader_ != nullptr && errors::IsNotFound(s)) {
+    return base_reader_->LookupTensorSlices(key, slices);
+  }
+  TF_RETURN_IF_ERROR(s);
   slices->reserve(entry.slices_size());
   for (const auto& slice : entry.slices()) {
     slices->emplace_back(slice);
@@ -1073,7 +1475,11 @@ absl::Status BundleReader::LookupSlice(StringPiece full_tensor_key,
                                        Tensor* val) {
   CHECK(val != nullptr);
   BundleEntryProto entry;
-  TF_RETURN_IF_ERROR(GetBundleEntryProto(full_tensor_key, &entry));
+  absl::Status s = GetBundleEntryProto(full_tensor_key, &entry);
+  if (base_reader_ != nullptr && errors::IsNotFound(s)) {
+    return base_reader_->LookupSlice(full_tensor_key, slice_spec, val);
+  }
+  TF_RETURN_IF_ERROR(s);
   return GetSliceValue(full_tensor_key, entry, slice_spec, val);
 }
 
@@ -1196,13 +1602,18 @@ absl::Status BundleReader::GetSliceValue(
 
 bool BundleReader::Contains(StringPiece key) {
   Seek(key);
-  return Valid() && (this->key() == key);
+  if (Valid() && (this->key() == key)) return true;
+  return base_reader_ != nullptr && base_reader_->Contains(key);
 }
 
 absl::Status BundleReader::LookupDtypeAndShape(StringPiece key, DataType* dtype,
                                                TensorShape* shape) {
   BundleEntryProto entry;
-  TF_RETURN_IF_ERROR(GetBundleEntryProto(key, &entry));
+  absl::Status s = GetBundleEntryProto(key, &entry);
+  if (base_reader_ != nullptr && errors::IsNotFound(s)) {
+    return base_reader_->LookupDtypeAndShape(key, dtype, shape);
+  }
+  TF_RETURN_IF_ERROR(s);
   *dtype = entry.dtype();
   *shape = TensorShape(entry.shape());
   return absl::OkStatus();
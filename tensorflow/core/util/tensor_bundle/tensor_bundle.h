@@ -66,6 +66,8 @@ limitations under the License.
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "absl/algorithm/container.h"
@@ -106,6 +108,8 @@ extern const int kTensorBundleVersion;
 // corresponding value is a BundleHeaderProto.
 extern const char* const kHeaderEntryKey;
 
+class BundleReader;
+
 // Builds a string-string table of tensor names to BundleEntryProto (metadata).
 //
 // On construction, attempts to create a directory given by the dirname of
@@ -119,9 +123,23 @@ class BundleWriter {
     // Alignment, in bytes, for tensor data.
     // Must be >= 1. The default size of 1 densely packs tensors.
     int data_alignment{1};
+
+    // Iff non-empty, writes an incremental (delta) bundle over the existing
+    // bundle with this prefix.  A tensor passed to Add() whose dtype, shape
+    // and content checksum match the base bundle's entry is skipped entirely:
+    // no bytes are written and no index entry is produced.  The base prefix
+    // is recorded in this bundle's header, and BundleReader transparently
+    // chains lookups of missing keys back to the base bundle (which may
+    // itself be a delta).  The base bundle's files must outlive this bundle.
+    //
+    // Only tensors of fixed-size dtypes are deduplicated; string and variant
+    // tensors are always rewritten, as are individual non-full slices of
+    // partitioned tensors.
+    std::string delta_base_prefix;
   };
   BundleWriter(Env* env, absl::string_view prefix,
                const Options& options = Options());
+  ~BundleWriter();
 
   // Adds the tensor "val" under key "key".
   // Across calls "key" must be unique but can be added in any order.
@@ -154,6 +172,12 @@ class BundleWriter {
   absl::Status status() const { return status_; }
 
  private:
+  // Shared implementation of Add()/AddSlice().  Iff "try_delta_skip" is set
+  // and a delta base is configured, the write is elided when the base bundle
+  // already holds an identical tensor under "key".
+  absl::Status AddTensor(absl::string_view key, const Tensor& val,
+                         bool try_delta_skip);
+
   Env* const env_;  // Not owned.
   const Options options_;
   const std::string prefix_;
@@ -165,6 +189,13 @@ class BundleWriter {
   std::map<std::string, BundleEntryProto> entries_;
   absl::Status status_;
 
+  // Reader over the delta base bundle; null unless
+  // Options::delta_base_prefix is set.
+  std::unique_ptr<BundleReader> base_reader_;
+  // Keys elided because the base bundle holds identical content.  Tracked so
+  // that duplicate Add() calls are still rejected.
+  std::unordered_set<std::string> delta_skipped_keys_;
+
   BundleWriter(const BundleWriter&) = delete;
   void operator=(const BundleWriter&) = delete;
 };
@@ -200,6 +231,13 @@ class BundleCache;
 // On construction, silently attempts to read the metadata associated with
 // "prefix".  If caller intends to call any function afterwards, "status()"
 // must be checked.
+//
+// If the bundle is a delta bundle (see BundleWriter::Options::
+// delta_base_prefix), a chained reader over the base bundle is opened as
+// well, and the key-based lookup functions transparently fall back to it for
+// keys absent from this bundle.  The iteration interface (Seek()/Next()/
+// ReadCurrent()) and DebugString() cover only this bundle's own index.
+//
 // All threads accessing the same BundleReader must synchronize.
 class BundleReader {
  public:
@@ -213,6 +251,17 @@ class BundleReader {
 
     // For tests only.
     bool enable_multi_threading_for_testing = false;
+
+    // If true, suitably aligned raw tensor data is served out of read-only
+    // memory mappings of the data files instead of being copied into freshly
+    // allocated buffers. Processes restoring the same bundle then share one
+    // physical copy of the weights, and pages are faulted in lazily on first
+    // access. Tensors restored this way are backed by read-only memory and
+    // must not be mutated; checksums are not validated for them, since that
+    // would touch every page at load time. Entries whose offset is not
+    // aligned (see BundleWriter::Options::data_alignment), string and
+    // variant tensors, and byte-swapped bundles fall back to copying reads.
+    bool use_mmap = false;
   };
   BundleReader(Env* env, absl::string_view prefix, Options options);
 
@@ -265,6 +314,22 @@ class BundleReader {
   // REQUIRES: status().ok()
   absl::Status Lookup(absl::string_view key, Tensor* val) TF_MUST_USE_RESULT;
 
+  // Looks up the tensors keyed by "keys", reading their contents concurrently.
+  //
+  // Allocates the result tensors with their stored dtypes and shapes and
+  // returns them in "values", aligned with "keys". Raw tensor data is read by
+  // up to "max_parallelism" threads; entries are distributed across the
+  // threads balanced by size, and every thread reads through its own file
+  // handles, so concurrent reads can saturate storage bandwidth even within a
+  // single shard. String, variant, and partitioned tensors are restored
+  // through the sequential code path after the concurrent reads complete.
+  //
+  // Validates the stored crc32c checksums against the restored bytes.
+  // REQUIRES: status().ok()
+  absl::Status ParallelLookup(absl::Span<const std::string> keys,
+                              std::vector<Tensor>* values,
+                              int max_parallelism = 8) TF_MUST_USE_RESULT;
+
   // Looks up the tensor pointed to by the internal iterator.
   //
   // On error, "val" may contain nonsense data.
@@ -323,6 +388,12 @@ class BundleReader {
   absl::Status GetValue(const BundleEntryProto& entry,
                         Tensor* val) TF_MUST_USE_RESULT;
 
+  // Returns the (lazily opened) memory mapping of the given shard's data
+  // file. REQUIRES: Options::use_mmap
+  absl::Status GetMmapRegion(int shard_id,
+                             std::shared_ptr<ReadOnlyMemoryRegion>* region)
+      TF_MUST_USE_RESULT;
+
   // Reads the slice described by "slice_spec".  The corresponding full tensor
   // has key "ful_tensor_key" and metadata proto "full_tensor_entry".
   // REQUIRES: full_tensor_entry.slices_size() > 0
@@ -345,6 +416,11 @@ class BundleReader {
   // Owned InputBuffer objects. cache_ owns the underlying RandomAccessFiles.
   std::unordered_map<int32_t, io::InputBuffer*> data_;
 
+  // Memory mappings of the data files, opened on first use when `use_mmap_`
+  // is set. Shared with the buffers of the tensors served from them.
+  std::unordered_map<int32_t, std::shared_ptr<ReadOnlyMemoryRegion>>
+      mmap_regions_;
+
   // Maps each partitioned tensor's key to its stored slices (represented in a
   // TensorSliceSet).  Populated on-demand.
   std::unordered_map<std::string, checkpoint::TensorSliceSet*> tensor_slices_;
@@ -357,10 +433,26 @@ class BundleReader {
   // differs from that of the current system's processor architecture.
   bool need_to_swap_bytes_;
 
+  // Reader over the delta base bundle named in this bundle's header; null
+  // for ordinary (full) bundles.  Key-based lookups that miss this bundle's
+  // index are retried against it, recursively down the delta chain.
+  std::unique_ptr<BundleReader> base_reader_;
+
   friend class TensorBundleAlignmentTest;  // For testing data alignment.
+  friend class BundleWriter;  // Reads base bundle metadata for delta saves.
 
   bool enable_multi_threading_for_testing_ = false;
 
+  // Whether to serve aligned raw tensor data from memory mappings. Cleared
+  // if mapping a data file fails, in which case reads fall back to copying.
+  bool use_mmap_ = false;
+
+  // Fingerprints of the tensors this reader interned in the process-wide
+  // restored-tensor registry (see TF_ENABLE_RESTORED_TENSOR_SHARING in
+  // tensor_bundle.cc); the corresponding refcounts are released when this
+  // reader is destroyed.
+  std::vector<std::pair<uint64, uint64>> shared_tensor_keys_;
+
   BundleReader(const BundleReader&) = delete;
   void operator=(const BundleReader&) = delete;
 };
@@ -164,6 +164,14 @@ static constexpr char kEnableMultiDeviceMode[] =
 static constexpr char kAllReduceTopologicalDistance[] =
     "dtensor.all_reduce_combiner.topological_distance";
 
+// Attribute which stores the environment variable value for all_reduce
+// optimization bucket size: DTENSOR_ALLREDUCE_COMBINE_OPTIMIZATION_MAX_GROUP
+// _BYTES. This represents the maximum total payload in bytes of a combined
+// AllReduce. It is a determining factor used during
+// dtensor_allreduce_combine_optimization.
+static constexpr char kAllReduceMaxGroupBytes[] =
+    "dtensor.all_reduce_combiner.max_group_bytes";
+
 }  // namespace dtensor
 }  // namespace tensorflow
 
@@ -133,6 +133,12 @@ DTensorMlirPassRunner::ImportGraphToMlir(
       mlir::IntegerAttr::get(mlir::IntegerType::get(&context_, /*width=*/64),
                              topo_dist));
 
+  int64 max_group_bytes = dtensor::AllReduceCombineOptimizationMaxGroupBytes();
+  module->setAttr(
+      dtensor::kAllReduceMaxGroupBytes,
+      mlir::IntegerAttr::get(mlir::IntegerType::get(&context_, /*width=*/64),
+                             max_group_bytes));
+
   if (dtensor::EnableMultiDeviceMode()) {
     module->setAttr(dtensor::kEnableMultiDeviceMode,
                     mlir::BoolAttr::get(&context_, true));
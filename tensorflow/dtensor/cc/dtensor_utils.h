@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_DTENSOR_CC_DTENSOR_UTILS_H_
 #define TENSORFLOW_DTENSOR_CC_DTENSOR_UTILS_H_
 
+#include <cstdint>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -84,6 +85,15 @@ int AllReduceCombineOptimizationGroupSize();
 // extended grouping.
 int AllReduceCombineOptimizationTopologicalDistance();
 
+// Returns the maximum total payload, in bytes, of a combined AllReduce in
+// dtensor_allreduce_combine_optimization. Groups whose summed tensor sizes
+// exceed this value are split into multiple bucketed AllReduces, in the way
+// horovod-style fusion buffers bound their bucket size. Bounding the bucket
+// size keeps the first collective from waiting on every producer, so compute
+// can overlap with communication of earlier buckets. A value of 0 (default)
+// leaves the grouping unbounded.
+int64_t AllReduceCombineOptimizationMaxGroupBytes();
+
 // Returns whether to perform multi-device expansion.
 bool EnableMultiDeviceMode();
 }  // namespace dtensor
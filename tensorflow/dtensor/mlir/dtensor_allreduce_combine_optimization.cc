@@ -577,6 +577,49 @@ createSubgroupsByExtendedNumOps(
   return all_reduce_new_groups;
 }
 
+// Experimental extended grouping logics to bound the payload of each combined
+// all-reduce. This function further splits each group into buckets whose
+// summed tensor sizes do not exceed max_group_bytes, keeping ops in their
+// existing order, the way horovod-style fusion buffers bound their bucket
+// size. Bounding the bucket keeps the first collective from waiting on every
+// producer in the group, so independent compute can overlap with the
+// communication of earlier buckets. An all-reduce larger than max_group_bytes
+// gets a bucket of its own.
+std::vector<std::vector<mlir::TF::DTensorAllReduceOp>>
+createSubgroupsByMaxGroupBytes(
+    std::vector<std::vector<mlir::TF::DTensorAllReduceOp>> all_reduce_groups,
+    int64_t max_group_bytes) {
+  VLOG(4) << "max payload bytes of a all-reduce group: " << max_group_bytes;
+  // Disable bucketing if the maximum group size is set to zero or less.
+  if (max_group_bytes <= 0) return all_reduce_groups;
+  std::vector<std::vector<mlir::TF::DTensorAllReduceOp>> all_reduce_new_groups;
+  for (const auto& all_reduce_group : all_reduce_groups) {
+    std::vector<mlir::TF::DTensorAllReduceOp> new_group;
+    int64_t new_group_bytes = 0;
+    for (mlir::TF::DTensorAllReduceOp all_reduce : all_reduce_group) {
+      // Eligible all-reduces are guaranteed to have a ranked static shape by
+      // the time they are collected.
+      auto ranked_type =
+          mlir::cast<mlir::RankedTensorType>(all_reduce.getType());
+      const int64_t all_reduce_bytes =
+          ranked_type.getNumElements() *
+          ((ranked_type.getElementTypeBitWidth() + 7) / 8);
+      if (!new_group.empty() &&
+          new_group_bytes + all_reduce_bytes > max_group_bytes) {
+        all_reduce_new_groups.push_back(new_group);
+        new_group.clear();
+        new_group_bytes = 0;
+      }
+      new_group.push_back(all_reduce);
+      new_group_bytes += all_reduce_bytes;
+    }
+    if (!new_group.empty()) all_reduce_new_groups.push_back(new_group);
+  }
+  VLOG(4) << "current number of groups: " << all_reduce_new_groups.size()
+          << " after grouping by max group bytes.";
+  return all_reduce_new_groups;
+}
+
 // Experimental grouping logics to optimize from aggressive grouping.
 // This function first sort by topological level, then create AllReduce sub-
 // groups by accessing each topological distance from its previous AllReduce.
@@ -750,6 +793,15 @@ struct DTensorAllReduceCombineOptimization
                   .getInt());
         }
 
+        // Experimental extended grouping: maximum payload per combined
+        // all-reduce
+        if (module->hasAttrOfType<mlir::IntegerAttr>(kAllReduceMaxGroupBytes)) {
+          all_reduce_groups = createSubgroupsByMaxGroupBytes(
+              all_reduce_groups,
+              module->getAttrOfType<mlir::IntegerAttr>(kAllReduceMaxGroupBytes)
+                  .getInt());
+        }
+
         // Maintain relative order of ALLReduces within the block.
         std::sort(all_reduce_groups.begin(), all_reduce_groups.end(),
                   [](std::vector<mlir::TF::DTensorAllReduceOp> lhs,
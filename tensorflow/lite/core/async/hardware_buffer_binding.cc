@@ -0,0 +1,227 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/core/async/hardware_buffer_binding.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __ANDROID__
+#include <android/hardware_buffer.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#endif  // __ANDROID__
+
+#include "tensorflow/lite/core/async/interop/c/types.h"
+#include "tensorflow/lite/core/c/common.h"
+#include "tensorflow/lite/minimal_logging.h"
+
+namespace tflite {
+namespace async {
+namespace {
+
+#ifdef __ANDROID__
+// AHardwareBuffer entry points resolved from libnativewindow.so at runtime,
+// following delegates/gpu/android_hardware_buffer.h, so that this library has
+// no build- or load-time dependency on API level 26.
+struct AhwbApi {
+  bool supported = false;
+  void (*acquire)(AHardwareBuffer* buffer);
+  void (*release)(AHardwareBuffer* buffer);
+  void (*describe)(const AHardwareBuffer* buffer, AHardwareBuffer_Desc* desc);
+  int (*lock)(AHardwareBuffer* buffer, uint64_t usage, int32_t fence,
+              const ARect* rect, void** out_virtual_address);
+  int (*unlock)(AHardwareBuffer* buffer, int32_t* fence);
+};
+
+const AhwbApi& GetAhwbApi() {
+  static const AhwbApi api = [] {
+    AhwbApi api;
+    void* handle = ::dlopen("libnativewindow.so", RTLD_NOW);
+    if (handle == nullptr) return api;
+    api.acquire = reinterpret_cast<decltype(api.acquire)>(
+        ::dlsym(handle, "AHardwareBuffer_acquire"));
+    api.release = reinterpret_cast<decltype(api.release)>(
+        ::dlsym(handle, "AHardwareBuffer_release"));
+    api.describe = reinterpret_cast<decltype(api.describe)>(
+        ::dlsym(handle, "AHardwareBuffer_describe"));
+    api.lock = reinterpret_cast<decltype(api.lock)>(
+        ::dlsym(handle, "AHardwareBuffer_lock"));
+    api.unlock = reinterpret_cast<decltype(api.unlock)>(
+        ::dlsym(handle, "AHardwareBuffer_unlock"));
+    api.supported = api.acquire != nullptr && api.release != nullptr &&
+                    api.describe != nullptr && api.lock != nullptr &&
+                    api.unlock != nullptr;
+    return api;
+  }();
+  return api;
+}
+#endif  // __ANDROID__
+
+}  // namespace
+
+bool HardwareBufferTensorBinding::Supported() {
+#ifdef __ANDROID__
+  return GetAhwbApi().supported;
+#else
+  return false;
+#endif
+}
+
+#ifdef __ANDROID__
+
+HardwareBufferTensorBinding::~HardwareBufferTensorBinding() {
+  const AhwbApi& api = GetAhwbApi();
+  for (Binding& binding : bindings_) {
+    if (binding.acquire_fence_fd >= 0) ::close(binding.acquire_fence_fd);
+    api.release(static_cast<AHardwareBuffer*>(binding.ahwb));
+  }
+}
+
+TfLiteStatus HardwareBufferTensorBinding::Bind(
+    const char* name, bool is_input, const TfLiteBackendBuffer* buffer,
+    TfLiteSynchronization* acquire_sync) {
+  const AhwbApi& api = GetAhwbApi();
+  if (!api.supported || name == nullptr || buffer == nullptr) {
+    return kTfLiteError;
+  }
+  const TfLiteTensor* tensor = is_input
+                                   ? runner_->input_tensor(name)
+                                   : runner_->output_tensor(name);
+  if (tensor == nullptr) {
+    TFLITE_LOG_PROD(TFLITE_LOG_ERROR, "%s is not a signature %s.", name,
+                    is_input ? "input" : "output");
+    return kTfLiteError;
+  }
+  auto* ahwb = static_cast<AHardwareBuffer*>(TfLiteBackendBufferGetPtr(buffer));
+  if (ahwb == nullptr) {
+    return kTfLiteError;
+  }
+  AHardwareBuffer_Desc desc = {};
+  api.describe(ahwb, &desc);
+  if (desc.format != AHARDWAREBUFFER_FORMAT_BLOB) {
+    TFLITE_LOG_PROD(TFLITE_LOG_ERROR,
+                    "Buffer bound to tensor %s must be a blob buffer.", name);
+    return kTfLiteError;
+  }
+  if (desc.width < tensor->bytes) {
+    TFLITE_LOG_PROD(TFLITE_LOG_ERROR,
+                    "Buffer bound to tensor %s holds %u bytes, tensor needs "
+                    "%zu bytes.",
+                    name, desc.width, tensor->bytes);
+    return kTfLiteError;
+  }
+  int acquire_fence_fd = -1;
+  if (acquire_sync != nullptr) {
+    // By convention the synchronization wraps a pointer to a sync fence file
+    // descriptor (sync type "sync_fence_fd"). Ownership of the descriptor
+    // transfers to this binding.
+    int* fence_fd = static_cast<int*>(TfLiteSynchronizationGetPtr(acquire_sync));
+    if (fence_fd != nullptr) acquire_fence_fd = *fence_fd;
+  }
+
+  api.acquire(ahwb);
+  for (Binding& binding : bindings_) {
+    if (binding.is_input == is_input && binding.name == name) {
+      // Replace the existing binding for this tensor.
+      if (binding.acquire_fence_fd >= 0) ::close(binding.acquire_fence_fd);
+      api.release(static_cast<AHardwareBuffer*>(binding.ahwb));
+      binding.ahwb = ahwb;
+      binding.bytes = desc.width;
+      binding.acquire_fence_fd = acquire_fence_fd;
+      return kTfLiteOk;
+    }
+  }
+  bindings_.push_back(Binding{name, is_input, ahwb, desc.width,
+                              acquire_fence_fd});
+  return kTfLiteOk;
+}
+
+TfLiteStatus HardwareBufferTensorBinding::Invoke() {
+  const AhwbApi& api = GetAhwbApi();
+  if (!api.supported) return kTfLiteError;
+
+  // Map all bound buffers for CPU access. Locking waits on (and closes) any
+  // pending acquire fence, so producers' fences are honored without the
+  // application polling them.
+  TfLiteStatus status = kTfLiteOk;
+  for (Binding& binding : bindings_) {
+    const uint64_t usage = binding.is_input
+                               ? AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN
+                               : AHARDWAREBUFFER_USAGE_CPU_WRITE_OFTEN;
+    if (api.lock(static_cast<AHardwareBuffer*>(binding.ahwb), usage,
+                 binding.acquire_fence_fd, nullptr, &binding.mapped) != 0) {
+      TFLITE_LOG_PROD(TFLITE_LOG_ERROR, "Failed to lock buffer for tensor %s.",
+                      binding.name.c_str());
+      binding.mapped = nullptr;
+      status = kTfLiteError;
+      break;
+    }
+    // The lock consumed the fence.
+    binding.acquire_fence_fd = -1;
+    const TfLiteCustomAllocation allocation = {binding.mapped, binding.bytes};
+    // Blob buffer mappings are page aligned, so the default alignment check
+    // of custom allocations passes.
+    status = binding.is_input
+                 ? runner_->SetCustomAllocationForInputTensor(
+                       binding.name.c_str(), allocation)
+                 : runner_->SetCustomAllocationForOutputTensor(
+                       binding.name.c_str(), allocation);
+    if (status != kTfLiteOk) break;
+  }
+
+  if (status == kTfLiteOk) status = runner_->AllocateTensors();
+  if (status == kTfLiteOk) status = runner_->Invoke();
+
+  // Unmap synchronously; afterwards output contents are visible to all other
+  // readers of the buffers.
+  for (Binding& binding : bindings_) {
+    if (binding.mapped == nullptr) continue;
+    if (api.unlock(static_cast<AHardwareBuffer*>(binding.ahwb), nullptr) != 0) {
+      status = kTfLiteError;
+    }
+    binding.mapped = nullptr;
+  }
+  return status;
+}
+
+#else  // !__ANDROID__
+
+HardwareBufferTensorBinding::~HardwareBufferTensorBinding() = default;
+
+TfLiteStatus HardwareBufferTensorBinding::Bind(const char* name, bool is_input,
+                                               const TfLiteBackendBuffer*,
+                                               TfLiteSynchronization*) {
+  return kTfLiteError;
+}
+
+TfLiteStatus HardwareBufferTensorBinding::Invoke() { return kTfLiteError; }
+
+#endif  // __ANDROID__
+
+TfLiteStatus HardwareBufferTensorBinding::BindInput(
+    const char* input_name, const TfLiteBackendBuffer* buffer,
+    TfLiteSynchronization* acquire_sync) {
+  return Bind(input_name, /*is_input=*/true, buffer, acquire_sync);
+}
+
+TfLiteStatus HardwareBufferTensorBinding::BindOutput(
+    const char* output_name, const TfLiteBackendBuffer* buffer) {
+  return Bind(output_name, /*is_input=*/false, buffer,
+              /*acquire_sync=*/nullptr);
+}
+
+}  // namespace async
+}  // namespace tflite
@@ -0,0 +1,130 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_CORE_ASYNC_HARDWARE_BUFFER_BINDING_H_
+#define TENSORFLOW_LITE_CORE_ASYNC_HARDWARE_BUFFER_BINDING_H_
+
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/core/async/interop/c/types.h"
+#include "tensorflow/lite/core/c/common.h"
+#include "tensorflow/lite/core/signature_runner.h"
+
+namespace tflite {
+namespace async {
+
+/// WARNING: This is an experimental API and subject to change.
+///
+/// HardwareBufferTensorBinding binds AHardwareBuffers (e.g. camera frames or
+/// NNAPI shared memory) to the I/O tensors of a SignatureRunner without
+/// copies and without manual fence plumbing.
+///
+/// Buffers are passed as TfLiteBackendBuffer objects wrapping an
+/// AHardwareBuffer of AHARDWAREBUFFER_FORMAT_BLOB format whose size is at
+/// least the tensor's byte size. An optional TfLiteSynchronization wrapping a
+/// sync fence file descriptor (type "sync_fence_fd", stored as an int*) may
+/// accompany an input buffer; the binding waits on the fence when mapping the
+/// buffer for the next Invoke() and closes the descriptor, so the producer's
+/// fence does not have to be polled by the application.
+///
+/// Invoke() locks every bound buffer for CPU access, points the tensors at
+/// the mapped memory through the custom allocation mechanism (see
+/// SignatureRunner::SetCustomAllocationForInputTensor), runs the signature
+/// and unlocks the buffers again. When Invoke() returns, output buffer
+/// contents are visible to all other AHardwareBuffer readers.
+///
+/// Typical per-frame usage:
+///
+/// <pre><code>
+/// HardwareBufferTensorBinding binding(runner);
+/// while (camera.HasFrame()) {
+///   // `frame` wraps the AHardwareBuffer, `fence` the camera's ready fence.
+///   binding.BindInput("image", frame, fence);
+///   binding.BindOutput("detections", output_buffer);
+///   binding.Invoke();
+/// }
+/// </code></pre>
+///
+/// The binding acquires a reference on bound AHardwareBuffers and releases it
+/// when the buffer is re-bound or the binding is destroyed. The binding must
+/// not outlive the SignatureRunner. Like SignatureRunner, this class is not
+/// thread-safe.
+///
+/// Only supported on Android API level 26+; use Supported() to check at
+/// runtime. There is no build-time API level requirement.
+class HardwareBufferTensorBinding {
+ public:
+  /// Returns true if AHardwareBuffer tensor binding is supported on this
+  /// device. All other methods return kTfLiteError when unsupported.
+  static bool Supported();
+
+  /// The SignatureRunner is not owned and must outlive this object.
+  explicit HardwareBufferTensorBinding(impl::SignatureRunner* runner)
+      : runner_(runner) {}
+  ~HardwareBufferTensorBinding();
+
+  HardwareBufferTensorBinding(const HardwareBufferTensorBinding&) = delete;
+  HardwareBufferTensorBinding& operator=(const HardwareBufferTensorBinding&) =
+      delete;
+
+  /// Binds `buffer` to the signature input `input_name`, replacing any
+  /// previous binding for that input. If `acquire_sync` is not null and wraps
+  /// a sync fence file descriptor, the next Invoke() waits on the fence
+  /// before reading the buffer and takes ownership of the descriptor. The
+  /// caller keeps ownership of `buffer`, `acquire_sync` and the wrapped
+  /// AHardwareBuffer. Returns an error if the name is not a signature input
+  /// or the buffer is not a large enough blob buffer.
+  TfLiteStatus BindInput(const char* input_name,
+                         const TfLiteBackendBuffer* buffer,
+                         TfLiteSynchronization* acquire_sync = nullptr);
+
+  /// Binds `buffer` to the signature output `output_name`, replacing any
+  /// previous binding for that output. The caller keeps ownership of `buffer`
+  /// and the wrapped AHardwareBuffer.
+  TfLiteStatus BindOutput(const char* output_name,
+                          const TfLiteBackendBuffer* buffer);
+
+  /// Runs the signature with all bound buffers mapped for zero-copy CPU
+  /// access, waiting on pending input fences. Tensors that have no binding
+  /// use their regular allocations.
+  TfLiteStatus Invoke();
+
+ private:
+  struct Binding {
+    std::string name;
+    bool is_input;
+    // AHardwareBuffer*, kept as void* so this header has no Android
+    // dependency. Holds a reference acquired at bind time.
+    void* ahwb;
+    size_t bytes;
+    // Pending acquire fence fd, owned; -1 if none. Consumed by the next
+    // Invoke().
+    int acquire_fence_fd = -1;
+    // Mapped address while locked during Invoke().
+    void* mapped = nullptr;
+  };
+
+  TfLiteStatus Bind(const char* name, bool is_input,
+                    const TfLiteBackendBuffer* buffer,
+                    TfLiteSynchronization* acquire_sync);
+
+  impl::SignatureRunner* runner_;
+  std::vector<Binding> bindings_;
+};
+
+}  // namespace async
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_CORE_ASYNC_HARDWARE_BUFFER_BINDING_H_
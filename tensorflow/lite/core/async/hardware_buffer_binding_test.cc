@@ -0,0 +1,38 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/core/async/hardware_buffer_binding.h"
+
+#include <gtest/gtest.h>
+#include "tensorflow/lite/core/c/common.h"
+
+namespace tflite {
+namespace async {
+namespace {
+
+// The AHardwareBuffer functionality itself is only available on Android
+// devices; off Android this covers the unsupported-platform contract.
+#ifndef __ANDROID__
+TEST(HardwareBufferTensorBindingTest, UnsupportedOffAndroid) {
+  EXPECT_FALSE(HardwareBufferTensorBinding::Supported());
+  HardwareBufferTensorBinding binding(/*runner=*/nullptr);
+  EXPECT_EQ(binding.BindInput("input", /*buffer=*/nullptr), kTfLiteError);
+  EXPECT_EQ(binding.BindOutput("output", /*buffer=*/nullptr), kTfLiteError);
+  EXPECT_EQ(binding.Invoke(), kTfLiteError);
+}
+#endif  // !__ANDROID__
+
+}  // namespace
+}  // namespace async
+}  // namespace tflite
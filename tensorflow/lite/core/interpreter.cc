@@ -34,6 +34,7 @@ limitations under the License.
 #include "tensorflow/lite/core/c/c_api_types.h"
 #include "tensorflow/lite/core/signature_runner.h"
 #include "tensorflow/lite/core/subgraph.h"
+#include "tensorflow/lite/cpu_affinity.h"
 #include "tensorflow/lite/external_cpu_backend_context.h"
 #include "tensorflow/lite/internal/signature_def.h"
 #include "tensorflow/lite/interpreter_options.h"
@@ -243,6 +244,36 @@ TfLiteStatus Interpreter::Invoke() {
   // from happening.
   ruy::ScopedSuppressDenormals suppress_denormals;
 
+  // Pin this invocation to the configured core class (see
+  // InterpreterOptions::SetInvokeCpuAffinityPolicy); the previous affinity
+  // mask is restored when the invocation finishes.
+  ScopedCpuAffinity scoped_cpu_affinity(
+      options_ ? options_->GetInvokeCpuAffinityPolicy()
+               : InterpreterOptions::CpuAffinityPolicy::kNoAffinity);
+
+  // Under cooperative concurrency arbitration (see CpuConcurrencyArbiter),
+  // shrink this invocation's thread budget to its fair share of the cores
+  // while other interpreters in the process are mid-invoke, and restore the
+  // configured budget when this invocation finishes.
+  const int requested_num_threads =
+      primary_subgraph().context()->recommended_num_threads;
+  ScopedCpuConcurrencyGrant concurrency_grant(requested_num_threads);
+  struct ThreadBudgetRestorer {
+    Interpreter* interpreter;
+    int num_threads;
+    ~ThreadBudgetRestorer() {
+      if (num_threads != kRestoreNothing) {
+        interpreter->SetNumThreads(num_threads);
+      }
+    }
+    static constexpr int kRestoreNothing = -2;
+  } restorer{this, ThreadBudgetRestorer::kRestoreNothing};
+  if (concurrency_grant.active() &&
+      concurrency_grant.granted() != requested_num_threads) {
+    restorer.num_threads = requested_num_threads;
+    SetNumThreads(concurrency_grant.granted());
+  }
+
   TF_LITE_ENSURE_STATUS_WITH_SCOPED_INSTRUMENTATION(
       scoped_runtime_event, primary_subgraph().Invoke());
 
@@ -556,7 +587,18 @@ impl::SignatureRunner* Interpreter::GetSignatureRunner(
       auto status = signature_runner_map_.insert(
           {signature_key,
            SignatureRunner(&signature, subgraph(signature.subgraph_index))});
-      return &(status.first->second);
+      SignatureRunner& runner = status.first->second;
+      // When signatures are declared mutually exclusive, let the runner
+      // release the other signatures' arenas on invocation.
+      if (options_ &&
+          options_->GetReleaseNonPersistentMemoryOnSignatureSwitch() &&
+          signature_defs_.size() > 1) {
+        for (const auto& peer : signature_defs_) {
+          runner.exclusive_subgraphs_.push_back(
+              subgraph(peer.subgraph_index));
+        }
+      }
+      return &runner;
     }
   }
 
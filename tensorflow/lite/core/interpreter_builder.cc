@@ -20,9 +20,12 @@ limitations under the License.
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -30,6 +33,7 @@ limitations under the License.
 #include "flatbuffers/vector.h"  // from @flatbuffers
 #include "tensorflow/compiler/mlir/lite/allocation.h"
 #include "tensorflow/compiler/mlir/lite/schema/schema_utils.h"
+#include "tensorflow/lite/array.h"
 #include "tensorflow/lite/core/api/error_reporter.h"
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
 #include "tensorflow/lite/core/api/op_resolver.h"
@@ -308,6 +312,18 @@ std::vector<int> FlatBufferIntArrayToVector(T* flat_array) {
   return ret;
 }
 
+// As above, but builds a TfLiteIntArray directly so that per-node index
+// arrays can be handed to the subgraph without an intermediate copy.
+template <class T>
+IntArrayUniquePtr FlatBufferIntArrayToTfLiteIntArray(T* flat_array) {
+  const int size = flat_array == nullptr ? 0 : flat_array->size();
+  IntArrayUniquePtr ret = BuildTfLiteArray<int>(size);
+  for (int i = 0; i < size; i++) {
+    ret->data[i] = flat_array->Get(i);
+  }
+  return ret;
+}
+
 // Used to determine how the op data parsing function creates its working space.
 class MallocDataAllocator : public BuiltinDataAllocator {
  public:
@@ -329,6 +345,25 @@ class MallocDataAllocator : public BuiltinDataAllocator {
   void Deallocate(void* data) override { free(data); }
 };
 
+// Maximum size of the worker pool used to parse the subgraphs of a
+// multi-subgraph model in parallel.
+constexpr int kMaxSubgraphParseThreads = 4;
+
+// Serializes Report() calls while the per-subgraph parsing workers run, since
+// ErrorReporter implementations are not required to be thread-safe.
+class MutexedErrorReporter : public ErrorReporter {
+ public:
+  explicit MutexedErrorReporter(ErrorReporter* target) : target_(target) {}
+  int Report(const char* format, va_list args) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return target_->Report(format, args);
+  }
+
+ private:
+  ErrorReporter* const target_;
+  std::mutex mutex_;
+};
+
 }  // namespace
 
 TfLiteStatus InterpreterBuilder::ParseNodes(
@@ -395,9 +430,9 @@ TfLiteStatus InterpreterBuilder::ParseNodes(
                                         &malloc_allocator, &builtin_data));
     }
     subgraph->AddNodeWithParameters(
-        FlatBufferIntArrayToVector(op->inputs()),
-        FlatBufferIntArrayToVector(op->outputs()),
-        FlatBufferIntArrayToVector(op->intermediates()), init_data,
+        FlatBufferIntArrayToTfLiteIntArray(op->inputs()),
+        FlatBufferIntArrayToTfLiteIntArray(op->outputs()),
+        FlatBufferIntArrayToTfLiteIntArray(op->intermediates()), init_data,
         init_data_size, builtin_data, registration);
   }
 
@@ -588,7 +623,8 @@ TfLiteStatus InterpreterBuilder::ParseSignatureDefs(
 TfLiteStatus InterpreterBuilder::ParseTensors(
     const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
     const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
-    Subgraph* subgraph, TfLiteTelemetrySubgraphInfo* subgraph_info) {
+    Subgraph* subgraph, TfLiteTelemetrySubgraphInfo* subgraph_info,
+    int* num_fp32_tensors) {
   TfLiteStatus status = kTfLiteOk;
 
   // A little helper to get the names of inputs and outputs. Note that they
@@ -603,7 +639,7 @@ TfLiteStatus InterpreterBuilder::ParseTensors(
     subgraph_info->quantizations.resize(tensors->size());
   }
 
-  num_fp32_tensors_ = 0;
+  *num_fp32_tensors = 0;
   for (int i = 0; i < tensors->size(); ++i) {
     const auto* tensor = tensors->Get(i);
     std::vector<int> dims = FlatBufferIntArrayToVector(tensor->shape());
@@ -615,7 +651,7 @@ TfLiteStatus InterpreterBuilder::ParseTensors(
       continue;
     }
     if (type == kTfLiteFloat32) {
-      ++num_fp32_tensors_;
+      ++(*num_fp32_tensors);
     }
     auto get_readonly_data = [&](const char** buffer_data,
                                  size_t* buffer_size) {
@@ -826,8 +862,14 @@ TfLiteStatus InterpreterBuilder::operator()(
     telemetry_settings->subgraph_infos.resize(subgraphs->size());
   }
 
-  for (int subgraph_index = 0; subgraph_index < subgraphs->size();
-       ++subgraph_index) {
+  const int num_subgraphs = subgraphs->size();
+  std::vector<TfLiteStatus> parse_status(num_subgraphs, kTfLiteOk);
+  std::vector<int> num_fp32_tensors_per_subgraph(num_subgraphs, 0);
+
+  // Sets up the nodes and tensors of one subgraph. Touches only that
+  // subgraph (plus its dedicated slots in the vectors above), so distinct
+  // subgraphs can be parsed concurrently.
+  auto parse_subgraph = [&](int subgraph_index) {
     const tflite::SubGraph* subgraph = (*subgraphs)[subgraph_index];
     tflite::Subgraph* modified_subgraph =
         (*interpreter)->subgraph(subgraph_index);
@@ -842,10 +884,12 @@ TfLiteStatus InterpreterBuilder::operator()(
       TF_LITE_REPORT_ERROR(error_reporter_,
                            "Did not get tensors in subgraph %d.\n",
                            subgraph_index);
-      return cleanup_and_error();
+      parse_status[subgraph_index] = kTfLiteError;
+      return;
     }
     if (modified_subgraph->AddTensors(tensors->size()) != kTfLiteOk) {
-      return cleanup_and_error();
+      parse_status[subgraph_index] = kTfLiteError;
+      return;
     }
     // Parse inputs/outputs
     modified_subgraph->SetInputs(
@@ -856,11 +900,16 @@ TfLiteStatus InterpreterBuilder::operator()(
     // Finally setup nodes and tensors
     // Parse tensors before nodes as ParseNodes checks input tensors for the
     // nodes.
-    if (ParseTensors(buffers, tensors, modified_subgraph, subgraph_info) !=
-        kTfLiteOk)
-      return cleanup_and_error();
-    if (operators && ParseNodes(operators, modified_subgraph) != kTfLiteOk)
-      return cleanup_and_error();
+    if (ParseTensors(buffers, tensors, modified_subgraph, subgraph_info,
+                     &num_fp32_tensors_per_subgraph[subgraph_index]) !=
+        kTfLiteOk) {
+      parse_status[subgraph_index] = kTfLiteError;
+      return;
+    }
+    if (operators && ParseNodes(operators, modified_subgraph) != kTfLiteOk) {
+      parse_status[subgraph_index] = kTfLiteError;
+      return;
+    }
 
     std::vector<int> variables;
     for (int i = 0; i < modified_subgraph->tensors_size(); ++i) {
@@ -873,7 +922,51 @@ TfLiteStatus InterpreterBuilder::operator()(
     if (subgraph->name()) {
       modified_subgraph->SetName(subgraph->name()->c_str());
     }
+  };
+
+  // A user-provided thread count also bounds the parse pool, so builders
+  // configured for single-threaded operation construct serially (including
+  // any custom op Init callbacks).
+  const int pool_size =
+      std::min({kMaxSubgraphParseThreads, num_subgraphs,
+                num_threads_ >= 1 ? num_threads_ : kMaxSubgraphParseThreads,
+                std::max(1, static_cast<int>(
+                                std::thread::hardware_concurrency()))});
+  if (pool_size <= 1) {
+    for (int subgraph_index = 0; subgraph_index < num_subgraphs;
+         ++subgraph_index) {
+      parse_subgraph(subgraph_index);
+    }
+  } else {
+    // Parse the subgraphs across a small worker pool; construction of large
+    // multi-signature models is dominated by this phase. Subgraph indices
+    // stay deterministic since all subgraphs were added above and each
+    // worker only fills in its own. The error reporter is shared between
+    // workers, so serialize it for the duration of the phase.
+    ErrorReporter* const original_error_reporter = error_reporter_;
+    MutexedErrorReporter mutexed_error_reporter(original_error_reporter);
+    error_reporter_ = &mutexed_error_reporter;
+    std::atomic<int> next_subgraph_index(0);
+    std::vector<std::thread> workers;
+    workers.reserve(pool_size);
+    for (int i = 0; i < pool_size; ++i) {
+      workers.emplace_back([&] {
+        for (int subgraph_index = next_subgraph_index++;
+             subgraph_index < num_subgraphs;
+             subgraph_index = next_subgraph_index++) {
+          parse_subgraph(subgraph_index);
+        }
+      });
+    }
+    for (std::thread& worker : workers) worker.join();
+    error_reporter_ = original_error_reporter;
+  }
+  for (TfLiteStatus subgraph_status : parse_status) {
+    if (subgraph_status != kTfLiteOk) return cleanup_and_error();
   }
+  // Preserve the previous serial behavior of num_fp32_tensors_: it reflects
+  // the last parsed subgraph (the primary one for single-subgraph models).
+  num_fp32_tensors_ = num_fp32_tensors_per_subgraph.back();
 
   if (ParseSignatureDefs(model_->signature_defs(), interpreter->get()) !=
       kTfLiteOk) {
@@ -135,7 +135,8 @@ class InterpreterBuilder {
   TfLiteStatus ParseTensors(
       const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
       const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* tensors,
-      Subgraph* subgraph, TfLiteTelemetrySubgraphInfo* subgraph_info);
+      Subgraph* subgraph, TfLiteTelemetrySubgraphInfo* subgraph_info,
+      int* num_fp32_tensors);
   TfLiteStatus ApplyDelegates(Interpreter* interpreter);
   TfLiteStatus ParseQuantization(const QuantizationParameters* src_quantization,
                                  TfLiteQuantization* quantization,
@@ -21,7 +21,9 @@ limitations under the License.
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/core/c/c_api_types.h"
 #include "tensorflow/lite/core/subgraph.h"
+#include "tensorflow/lite/cpu_affinity.h"
 #include "tensorflow/lite/internal/signature_def.h"
+#include "tensorflow/lite/interpreter_options.h"
 
 namespace tflite {
 namespace impl {
@@ -101,7 +103,48 @@ TfLiteStatus SignatureRunner::ResizeInputTensorStrict(
   return subgraph_->ResizeInputTensorStrict(it->second, new_size);
 }
 
+TfLiteStatus SignatureRunner::SetBatchSize(int batch_size) {
+  if (batch_size <= 0) {
+    subgraph_->ReportError("Batch size %d must be positive", batch_size);
+    return kTfLiteError;
+  }
+  for (const auto& it : signature_def_->inputs) {
+    const TfLiteTensor* tensor = subgraph_->tensor(it.second);
+    if (tensor->dims == nullptr || tensor->dims->size < 1) {
+      subgraph_->ReportError("Input %s is a scalar and has no batch dimension",
+                             it.first.c_str());
+      return kTfLiteError;
+    }
+    std::vector<int> dims(tensor->dims->data,
+                          tensor->dims->data + tensor->dims->size);
+    dims[0] = batch_size;
+    TF_LITE_ENSURE_STATUS(subgraph_->ResizeInputTensor(it.second, dims));
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus SignatureRunner::Invoke() {
+  // Pin this invocation to the configured core class (see
+  // InterpreterOptions::SetInvokeCpuAffinityPolicy); the previous affinity
+  // mask is restored when the invocation finishes.
+  const InterpreterOptions* options = subgraph_->GetOptions();
+  ScopedCpuAffinity scoped_cpu_affinity(
+      options ? options->GetInvokeCpuAffinityPolicy()
+              : InterpreterOptions::CpuAffinityPolicy::kNoAffinity);
+
+  // If signatures were declared mutually exclusive, release the arenas of the
+  // other signature subgraphs and re-acquire this signature's arena in case a
+  // previous invocation of a peer released it. Re-acquisition goes through
+  // AllocateTensors, which is cheap when the memory plan is unchanged.
+  if (!exclusive_subgraphs_.empty()) {
+    for (Subgraph* peer : exclusive_subgraphs_) {
+      if (peer != subgraph_) {
+        TF_LITE_ENSURE_STATUS(peer->ReleaseNonPersistentMemory());
+      }
+    }
+    TF_LITE_ENSURE_STATUS(subgraph_->AllocateTensors());
+  }
+
   // "Resets" cancellation flag so cancellation happens before this invoke will
   // not take effect.
   if (subgraph_->continue_invocation_)
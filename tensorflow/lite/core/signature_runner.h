@@ -142,6 +142,19 @@ class SignatureRunner {
   TfLiteStatus ResizeInputTensorStrict(const char* input_name,
                                        const std::vector<int>& new_size);
 
+  /// Resizes the leading (batch) dimension of every input of the signature to
+  /// `batch_size` in one step, so that N examples can be scored with a single
+  /// Invoke() instead of N sequential ones. Batched invocation amortizes the
+  /// per-invoke overhead (resize checks, delegate handoff, output readback)
+  /// across all examples; kernels process the extra batch entries natively.
+  /// Returns an error if `batch_size` is not positive or an input is a scalar.
+  /// The caller must ensure the model is valid for a variable leading
+  /// dimension. Note that this doesn't actually resize any existing buffers.
+  /// A call to AllocateTensors() is required to change the tensor input
+  /// buffers.
+  /// WARNING: This is an experimental API and subject to change.
+  TfLiteStatus SetBatchSize(int batch_size);
+
   /// Updates allocations for all tensors, related to the given signature.
   TfLiteStatus AllocateTensors() { return subgraph_->AllocateTensors(); }
 
@@ -254,6 +267,11 @@ class SignatureRunner {
   const internal::SignatureDef* signature_def_;
   // The Subgraph object is owned by the interpreter.
   Subgraph* subgraph_;
+  // Signature subgraphs declared mutually exclusive with this one (see
+  // InterpreterOptions::SetReleaseNonPersistentMemoryOnSignatureSwitch).
+  // Their non-persistent arenas are released when this signature is invoked.
+  // Populated by the interpreter; empty when the feature is disabled.
+  std::vector<Subgraph*> exclusive_subgraphs_;
   // The list of input tensor names.
   std::vector<const char*> input_names_;
   // The list of output tensor names.
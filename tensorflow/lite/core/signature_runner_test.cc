@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/core/interpreter.h"
 #include "tensorflow/lite/core/interpreter_builder.h"
 #include "tensorflow/lite/core/kernels/register.h"
+#include "tensorflow/lite/interpreter_options.h"
 #include "tensorflow/lite/model_builder.h"
 #include "tensorflow/lite/testing/util.h"
 
@@ -96,6 +97,90 @@ TEST(SignatureRunnerTest, TestMultiSignatures) {
   ASSERT_EQ(sub_output->data.f[2], 3);
 }
 
+TEST(SignatureRunnerTest, TestSetBatchSize) {
+  TestErrorReporter reporter;
+  auto model = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/multi_signatures.bin", &reporter);
+  ASSERT_TRUE(model);
+  ops::builtin::BuiltinOpResolver resolver;
+  InterpreterBuilder builder(*model, resolver);
+
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(builder(&interpreter), kTfLiteOk);
+  ASSERT_NE(interpreter, nullptr);
+
+  SignatureRunner* add_runner = interpreter->GetSignatureRunner("add");
+  ASSERT_NE(add_runner, nullptr);
+  ASSERT_EQ(add_runner->SetBatchSize(0), kTfLiteError);
+  ASSERT_EQ(add_runner->SetBatchSize(4), kTfLiteOk);
+  ASSERT_EQ(add_runner->AllocateTensors(), kTfLiteOk);
+
+  TfLiteTensor* add_input = add_runner->input_tensor("x");
+  ASSERT_NE(add_input, nullptr);
+  ASSERT_EQ(add_input->dims->size, 1);
+  ASSERT_EQ(add_input->dims->data[0], 4);
+  for (int i = 0; i < 4; ++i) {
+    add_input->data.f[i] = i;
+  }
+  ASSERT_EQ(add_runner->Invoke(), kTfLiteOk);
+  const TfLiteTensor* add_output = add_runner->output_tensor("output_0");
+  ASSERT_NE(add_output, nullptr);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(add_output->data.f[i], i + 2);
+  }
+}
+
+TEST(SignatureRunnerTest, TestReleaseNonPersistentMemoryOnSignatureSwitch) {
+  TestErrorReporter reporter;
+  auto model = FlatBufferModel::BuildFromFile(
+      "tensorflow/lite/testdata/multi_signatures.bin", &reporter);
+  ASSERT_TRUE(model);
+  ops::builtin::BuiltinOpResolver resolver;
+  InterpreterBuilder builder(*model, resolver);
+
+  std::unique_ptr<Interpreter> interpreter;
+  ASSERT_EQ(builder(&interpreter), kTfLiteOk);
+  ASSERT_NE(interpreter, nullptr);
+
+  InterpreterOptions options;
+  options.SetReleaseNonPersistentMemoryOnSignatureSwitch();
+  ASSERT_EQ(interpreter->ApplyOptions(&options), kTfLiteOk);
+
+  SignatureRunner* add_runner = interpreter->GetSignatureRunner("add");
+  ASSERT_NE(add_runner, nullptr);
+  SignatureRunner* sub_runner = interpreter->GetSignatureRunner("sub");
+  ASSERT_NE(sub_runner, nullptr);
+  ASSERT_EQ(add_runner->ResizeInputTensor("x", {2}), kTfLiteOk);
+  ASSERT_EQ(add_runner->AllocateTensors(), kTfLiteOk);
+  ASSERT_EQ(sub_runner->ResizeInputTensor("x", {2}), kTfLiteOk);
+  ASSERT_EQ(sub_runner->AllocateTensors(), kTfLiteOk);
+
+  // Alternate between the two signatures. Each invocation releases the other
+  // signature's arena, so the next invocation of that signature must
+  // transparently re-acquire its memory.
+  for (int i = 0; i < 2; ++i) {
+    TfLiteTensor* add_input = add_runner->input_tensor("x");
+    ASSERT_NE(add_input, nullptr);
+    add_input->data.f[0] = 2;
+    add_input->data.f[1] = 4;
+    ASSERT_EQ(add_runner->Invoke(), kTfLiteOk);
+    const TfLiteTensor* add_output = add_runner->output_tensor("output_0");
+    ASSERT_NE(add_output, nullptr);
+    ASSERT_EQ(add_output->data.f[0], 4);
+    ASSERT_EQ(add_output->data.f[1], 6);
+
+    TfLiteTensor* sub_input = sub_runner->input_tensor("x");
+    ASSERT_NE(sub_input, nullptr);
+    sub_input->data.f[0] = 2;
+    sub_input->data.f[1] = 4;
+    ASSERT_EQ(sub_runner->Invoke(), kTfLiteOk);
+    const TfLiteTensor* sub_output = sub_runner->output_tensor("output_0");
+    ASSERT_NE(sub_output, nullptr);
+    ASSERT_EQ(sub_output->data.f[0], -1);
+    ASSERT_EQ(sub_output->data.f[1], 1);
+  }
+}
+
 }  // namespace
 }  // namespace impl
 }  // namespace tflite
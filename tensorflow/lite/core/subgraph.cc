@@ -1004,6 +1004,11 @@ TfLiteStatus Subgraph::AllocateTensors() {
     return kTfLiteOk;
   }
 
+  // The graph is being re-planned; any frozen dispatch plan refers to the
+  // previous plan and must be rebuilt with FreezeShapes() afterwards.
+  shapes_frozen_ = false;
+  frozen_dispatch_plan_.clear();
+
   // Profile "AllocateTensors" only when memory planning is needed.
   TFLITE_SCOPED_TAGGED_DEFAULT_PROFILE(profiler_.get(), "AllocateTensors");
 
@@ -1079,6 +1084,17 @@ TfLiteStatus Subgraph::AddNodeWithParameters(
     const std::vector<int>& intermediates, const char* init_data,
     size_t init_data_size, void* builtin_data,
     const TfLiteRegistration* registration, int* node_index) {
+  return AddNodeWithParameters(
+      BuildTfLiteArray(inputs), BuildTfLiteArray(outputs),
+      BuildTfLiteArray(intermediates), init_data, init_data_size, builtin_data,
+      registration, node_index);
+}
+
+TfLiteStatus Subgraph::AddNodeWithParameters(
+    IntArrayUniquePtr inputs, IntArrayUniquePtr outputs,
+    IntArrayUniquePtr intermediates, const char* init_data,
+    size_t init_data_size, void* builtin_data,
+    const TfLiteRegistration* registration, int* node_index) {
   std::unique_ptr<void, decltype(free)*> builtin_data_deleter(builtin_data,
                                                               free);
   if (state_ == kStateInvokableAndImmutable) {
@@ -1087,11 +1103,15 @@ TfLiteStatus Subgraph::AddNodeWithParameters(
   }
   state_ = kStateUninvokable;
 
-  TF_LITE_ENSURE_OK(&context_, CheckTensorIndices("node inputs", inputs.data(),
-                                                  inputs.size()));
+  if (!inputs) inputs = BuildTfLiteArray<int>(0);
+  if (!outputs) outputs = BuildTfLiteArray<int>(0);
+  if (!intermediates) intermediates = BuildTfLiteArray<int>(0);
+
+  TF_LITE_ENSURE_OK(&context_, CheckTensorIndices("node inputs", inputs->data,
+                                                  inputs->size));
   TF_LITE_ENSURE_OK(
       &context_,
-      CheckTensorIndices("node outputs", outputs.data(), outputs.size()));
+      CheckTensorIndices("node outputs", outputs->data, outputs->size));
 
   // For builtin ops, inputs and outputs must not overlap. Custom ops must do
   // this check by themselves if they don't support overlapping tensors. This
@@ -1099,8 +1119,8 @@ TfLiteStatus Subgraph::AddNodeWithParameters(
   // both input and output.
   if (builtin_data != nullptr) {
     TF_LITE_ENSURE_OK(&context_, CheckInputAndOutputForOverlap(
-                                     inputs.data(), inputs.size(),
-                                     outputs.data(), outputs.size()));
+                                     inputs->data, inputs->size, outputs->data,
+                                     outputs->size));
   }
 
   int new_node_index = nodes_and_registration_.size();
@@ -1109,12 +1129,9 @@ TfLiteStatus Subgraph::AddNodeWithParameters(
   auto& node_and_reg = nodes_and_registration_.back();
   TfLiteNode& node = node_and_reg.first;
 
-  // NOTE, here we are not using move semantics yet, since our internal
-  // representation isn't std::vector, but in the future we would like to avoid
-  // copies, so we want the interface to take r-value references now.
-  node.inputs = ConvertVectorToTfLiteIntArray(inputs);
-  node.outputs = ConvertVectorToTfLiteIntArray(outputs);
-  node.intermediates = ConvertVectorToTfLiteIntArray(intermediates);
+  node.inputs = inputs.release();
+  node.outputs = outputs.release();
+  node.intermediates = intermediates.release();
   node.temporaries = TfLiteIntArrayCreate(0);
   if (init_data) {
     node.user_data = OpInit(*registration, init_data, init_data_size);
@@ -1640,6 +1657,14 @@ TfLiteStatus Subgraph::InvokeImpl() {
     ReportError("Non-persistent memory is not available.");
     return kTfLiteError;
   }
+
+  // With frozen shapes, dispatch through the flat plan built by
+  // FreezeShapes(). The regular path is kept while a profiler is attached so
+  // per-op profiling continues to work.
+  if (shapes_frozen_ && profiler_ == nullptr) {
+    return InvokeFrozenImpl();
+  }
+
   TFLITE_SCOPED_TAGGED_DEFAULT_PROFILE(profiler_.get(), "Invoke");
 #ifdef TF_LITE_TENSORFLOW_PROFILER
   tensorflow::profiler::TraceMe* trace_subgraph =
@@ -1767,6 +1792,128 @@ TfLiteStatus Subgraph::InvokeImpl() {
   return status;
 }
 
+TfLiteStatus Subgraph::FreezeShapes() {
+  shapes_frozen_ = false;
+  frozen_dispatch_plan_.clear();
+  if (!consistent_) {
+    ReportError("FreezeShapes called on model that is not consistent.");
+    return kTfLiteError;
+  }
+  if (state_ == kStateUninvokable) {
+    ReportError("FreezeShapes called before AllocateTensors.");
+    return kTfLiteError;
+  }
+  if (memory_planner_ && !memory_planner_->HasNonPersistentMemory()) {
+    ReportError("Non-persistent memory is not available.");
+    return kTfLiteError;
+  }
+  if (next_execution_plan_index_to_prepare_ <
+      static_cast<int>(execution_plan_.size())) {
+    ReportError("FreezeShapes called on a partially prepared subgraph.");
+    return kTfLiteError;
+  }
+  if (has_dynamic_tensors_) {
+    ReportError("FreezeShapes called on a graph with dynamic tensors.");
+    return kTfLiteError;
+  }
+
+  frozen_dispatch_plan_.reserve(execution_plan_.size());
+  for (int execution_plan_index = 0;
+       execution_plan_index < execution_plan_.size(); execution_plan_index++) {
+    const int node_index = execution_plan_[execution_plan_index];
+    TfLiteNode& node = nodes_and_registration_[node_index].first;
+    const TfLiteRegistration& registration =
+        nodes_and_registration_[node_index].second;
+
+    // Hoist the per-invoke input checks out of Invoke(): every input must
+    // have backing data and be readable without cross-delegate copies.
+    for (int i = 0; i < node.inputs->size; ++i) {
+      const int tensor_index = node.inputs->data[i];
+      if (tensor_index == kTfLiteOptionalTensor) continue;
+      const TfLiteTensor* tensor = &tensors_[tensor_index];
+      if (tensor->delegate && tensor->delegate != node.delegate) {
+        ReportError(
+            "FreezeShapes does not support tensor %d shared across delegates.",
+            tensor_index);
+        return kTfLiteError;
+      }
+      if (tensor->data.raw == nullptr && tensor->bytes > 0 &&
+          !(registration.builtin_code == kTfLiteBuiltinReshape && i == 1 &&
+            tensor->dims->size != 1)) {
+        ReportError("Input tensor %d lacks data", tensor_index);
+        return kTfLiteError;
+      }
+    }
+    if (HasDynamicTensor(context_, node.outputs, nullptr)) {
+      ReportError("FreezeShapes called on a graph with dynamic tensors.");
+      return kTfLiteError;
+    }
+
+    FrozenDispatchEntry entry;
+    entry.node = &node;
+    entry.registration = &registration;
+    entry.node_index = node_index;
+    // Resolve the kernel entry point; nodes using the stable
+    // TfLiteOperator-based registration keep going through OpInvoke.
+    entry.invoke =
+        registration.registration_external ? nullptr : registration.invoke;
+    if (entry.invoke == nullptr &&
+        registration.registration_external == nullptr) {
+      ReportError("FreezeShapes encountered node %d with no invoke function.",
+                  node_index);
+      return kTfLiteError;
+    }
+    frozen_dispatch_plan_.push_back(entry);
+  }
+  shapes_frozen_ = true;
+  return kTfLiteOk;
+}
+
+TfLiteStatus Subgraph::InvokeFrozenImpl() {
+#ifdef TF_LITE_TENSORFLOW_PROFILER
+  tensorflow::profiler::TraceMe* trace_subgraph =
+      tflite::OnTfLiteSubgraphInvoke(name_.c_str(), subgraph_index_);
+#endif  // TF_LITE_TENSORFLOW_PROFILER
+  EnsureTensorsVectorCapacity();
+  TfLiteStatus status = kTfLiteOk;
+  for (const FrozenDispatchEntry& entry : frozen_dispatch_plan_) {
+    if (check_cancelled_func_ != nullptr &&
+        check_cancelled_func_(cancellation_data_)) {
+      ReportError("Client requested cancel during Invoke()");
+      return kTfLiteError;
+    }
+    if (continue_invocation_ && !continue_invocation_->test_and_set()) {
+      // `Cancel` is called and cancellation flag is flipped.
+      ReportError("Client requested cancel during Invoke()");
+      return kTfLiteCancelled;
+    }
+
+    tensor_resized_since_op_invoke_ = false;
+    const TfLiteStatus s = entry.invoke != nullptr
+                               ? entry.invoke(&context_, entry.node)
+                               : OpInvoke(*entry.registration, entry.node);
+    if (s != kTfLiteOk) {
+      auto err = ReportOpError(&context_, *entry.node, *entry.registration,
+                               entry.node_index, "failed to invoke");
+      return s == kTfLiteCancelled ? s : err;
+    }
+    if (tensor_resized_since_op_invoke_) {
+      // A kernel resized a tensor even though the graph was validated to be
+      // fully static when it was frozen; the plan is no longer trustworthy.
+      shapes_frozen_ = false;
+      frozen_dispatch_plan_.clear();
+      ReportError(
+          "Tensor was resized while shapes were frozen; call "
+          "AllocateTensors() and FreezeShapes() again.");
+      return kTfLiteError;
+    }
+  }
+#ifdef TF_LITE_TENSORFLOW_PROFILER
+  tflite::OnTfLiteSubgraphInvokeEnd(trace_subgraph);
+#endif  // TF_LITE_TENSORFLOW_PROFILER
+  return status;
+}
+
 TfLiteStatus Subgraph::ResizeTensor(TfLiteContext* context,
                                     TfLiteTensor* tensor,
                                     TfLiteIntArray* new_size) {
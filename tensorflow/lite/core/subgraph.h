@@ -120,6 +120,18 @@ class Subgraph {
                                      const TfLiteRegistration* registration,
                                      int* node_index = nullptr);
 
+  // Same as above but takes ownership of `inputs`, `outputs` and
+  // `intermediates` directly, avoiding a copy of each index array. Used on the
+  // model loading path where a temporary vector per node is measurable in
+  // startup time. Null arrays are treated as empty.
+  TfLiteStatus AddNodeWithParameters(IntArrayUniquePtr inputs,
+                                     IntArrayUniquePtr outputs,
+                                     IntArrayUniquePtr intermediates,
+                                     const char* init_data,
+                                     size_t init_data_size, void* builtin_data,
+                                     const TfLiteRegistration* registration,
+                                     int* node_index = nullptr);
+
   // Adds `tensors_to_add` tensors, preserving pre-existing Tensor entries.
   // The value pointed to by `first_new_tensor_index` will be set to the
   // index of the first new tensor if `first_new_tensor_index` is non-null.
@@ -388,6 +400,24 @@ class Subgraph {
   // Before `AllocateTensors` is called, this will always return true;
   bool HasDynamicTensors() { return has_dynamic_tensors_; }
 
+  // WARNING: This is an experimental API and subject to change.
+  // Freezes the current shapes and memory plan into a flat dispatch plan so
+  // that subsequent Invoke() calls skip per-invoke bookkeeping (preparation
+  // checks, per-input readiness checks, dynamic tensor handling) and only
+  // dispatch the kernels. Must be called after AllocateTensors(); fails if
+  // the graph has dynamic tensors, is not fully prepared, or shares tensors
+  // across delegates. The frozen plan is discarded automatically whenever the
+  // graph is re-planned (e.g. after ResizeInputTensor(), applying a delegate
+  // or adding ops); call FreezeShapes() again after the next
+  // AllocateTensors() to re-enable the fast path. While a profiler is
+  // attached, Invoke() uses the regular path so per-op profiling keeps
+  // working.
+  TfLiteStatus FreezeShapes();
+
+  // Returns true if a frozen dispatch plan is active (see FreezeShapes).
+  // WARNING: This is an experimental API and subject to change.
+  bool ShapesFrozen() const { return shapes_frozen_; }
+
   // Assigns (or reassigns) a custom memory allocation for the given tensor.
   // `flags` is a bitmask, see TfLiteCustomAllocationFlags.
   // The runtime does NOT take ownership of the underlying memory.
@@ -728,6 +758,11 @@ class Subgraph {
   // Does not report invoke status through profiler.
   TfLiteStatus InvokeImpl();
 
+  // Invoke the subgraph through the frozen dispatch plan built by
+  // FreezeShapes(). All shape, readiness and preparation checks were hoisted
+  // into FreezeShapes(); only kernel dispatch and cancellation checks remain.
+  TfLiteStatus InvokeFrozenImpl();
+
   // Allow a delegate to look at the graph and modify the graph to handle
   // parts of the graph themselves. After this is called, the graph may
   // contain new nodes that replace 1 more nodes.
@@ -1096,6 +1131,27 @@ class Subgraph {
   // trigger downstream reallocation after op invocation.
   bool tensor_resized_since_op_invoke_ = false;
 
+  // A node resolved to its invoke entry point for the frozen-shapes fast
+  // path (see FreezeShapes).
+  struct FrozenDispatchEntry {
+    // Direct kernel entry point; nullptr if the node must be dispatched
+    // through OpInvoke (e.g. stable delegate kernels).
+    TfLiteStatus (*invoke)(TfLiteContext*, TfLiteNode*);
+    TfLiteNode* node;
+    const TfLiteRegistration* registration;
+    int node_index;
+  };
+
+  // Flat dispatch plan in execution order, valid while shapes_frozen_ is
+  // true. Entries point into nodes_and_registration_, which cannot change
+  // while the plan is active: any graph mutation makes the subgraph
+  // uninvokable, and returning to an invokable state goes through the full
+  // AllocateTensors() path, which clears the plan.
+  std::vector<FrozenDispatchEntry> frozen_dispatch_plan_;
+
+  // Whether frozen_dispatch_plan_ is active (see FreezeShapes).
+  bool shapes_frozen_ = false;
+
   // Profiler for this interpreter instance.
   std::unique_ptr<SubgraphAwareProfiler> profiler_;
 
@@ -332,5 +332,71 @@ TEST_F(SubgraphResizeTensorTest,
   std::fill_n(tensor_.dims->data, tensor_.dims->size, 1);
 }
 
+// Builds a single-op NEG subgraph for exercising the frozen-shapes path.
+void BuildNegSubgraph(Subgraph* subgraph, const std::vector<int>& shape) {
+  subgraph->AddTensors(2);
+  subgraph->SetInputs({0});
+  subgraph->SetOutputs({1});
+  TfLiteQuantization quantization{};
+  ASSERT_EQ(subgraph->SetTensorParametersReadWrite(0, kTfLiteFloat32, "in",
+                                                   shape, quantization),
+            kTfLiteOk);
+  ASSERT_EQ(subgraph->SetTensorParametersReadWrite(1, kTfLiteFloat32, "out",
+                                                   shape, quantization),
+            kTfLiteOk);
+  TfLiteRegistration* neg_op = tflite::ops::builtin::Register_NEG();
+  ASSERT_EQ(
+      subgraph->AddNodeWithParameters({0}, {1}, {}, nullptr, 0, nullptr, neg_op),
+      kTfLiteOk);
+}
+
+TEST(FreezeShapes, FailsBeforeAllocateTensors) {
+  Interpreter interpreter;
+  auto& subgraph = interpreter.primary_subgraph();
+  BuildNegSubgraph(&subgraph, {2});
+
+  EXPECT_EQ(subgraph.FreezeShapes(), kTfLiteError);
+  EXPECT_FALSE(subgraph.ShapesFrozen());
+}
+
+TEST(FreezeShapes, FrozenInvokeMatchesRegularInvoke) {
+  Interpreter interpreter;
+  auto& subgraph = interpreter.primary_subgraph();
+  BuildNegSubgraph(&subgraph, {2});
+  ASSERT_EQ(subgraph.AllocateTensors(), kTfLiteOk);
+  ASSERT_EQ(subgraph.FreezeShapes(), kTfLiteOk);
+  EXPECT_TRUE(subgraph.ShapesFrozen());
+
+  subgraph.tensor(0)->data.f[0] = 1.0f;
+  subgraph.tensor(0)->data.f[1] = -3.0f;
+  ASSERT_EQ(subgraph.Invoke(), kTfLiteOk);
+  EXPECT_EQ(subgraph.tensor(1)->data.f[0], -1.0f);
+  EXPECT_EQ(subgraph.tensor(1)->data.f[1], 3.0f);
+}
+
+TEST(FreezeShapes, ResizingDiscardsFrozenPlan) {
+  Interpreter interpreter;
+  auto& subgraph = interpreter.primary_subgraph();
+  BuildNegSubgraph(&subgraph, {2});
+  ASSERT_EQ(subgraph.AllocateTensors(), kTfLiteOk);
+  ASSERT_EQ(subgraph.FreezeShapes(), kTfLiteOk);
+
+  ASSERT_EQ(subgraph.ResizeInputTensor(0, {3}), kTfLiteOk);
+  ASSERT_EQ(subgraph.AllocateTensors(), kTfLiteOk);
+  EXPECT_FALSE(subgraph.ShapesFrozen());
+
+  // The regular path still works after the plan is discarded, and the
+  // subgraph can be frozen again with the new shapes.
+  subgraph.tensor(0)->data.f[0] = 2.0f;
+  subgraph.tensor(0)->data.f[1] = 4.0f;
+  subgraph.tensor(0)->data.f[2] = -8.0f;
+  ASSERT_EQ(subgraph.Invoke(), kTfLiteOk);
+  EXPECT_EQ(subgraph.tensor(1)->data.f[2], 8.0f);
+
+  ASSERT_EQ(subgraph.FreezeShapes(), kTfLiteOk);
+  ASSERT_EQ(subgraph.Invoke(), kTfLiteOk);
+  EXPECT_EQ(subgraph.tensor(1)->data.f[0], -2.0f);
+}
+
 }  // namespace
 }  // namespace tflite
@@ -0,0 +1,121 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/cpu_affinity.h"
+
+#ifdef TFLITE_SUPPORTS_CPU_AFFINITY
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "tensorflow/lite/minimal_logging.h"
+
+namespace tflite {
+namespace {
+
+// Which cores the two affinity policies map to on this device. Computed once;
+// core topology does not change at runtime.
+struct CoreClassification {
+  cpu_set_t performance;
+  cpu_set_t efficiency;
+  // False on CPUs where all cores report the same maximum frequency; both
+  // policies are no-ops then.
+  bool heterogeneous = false;
+};
+
+// Returns the maximum frequency of `cpu` in kHz, or -1 if unavailable.
+long ReadMaxFrequency(int cpu) {
+  char path[128];
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu);
+  FILE* file = fopen(path, "re");
+  if (file == nullptr) return -1;
+  long freq = -1;
+  if (fscanf(file, "%ld", &freq) != 1) freq = -1;
+  fclose(file);
+  return freq;
+}
+
+const CoreClassification& GetCoreClassification() {
+  static const CoreClassification& classification = *[] {
+    auto* c = new CoreClassification;
+    CPU_ZERO(&c->performance);
+    CPU_ZERO(&c->efficiency);
+    long num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+    if (num_cpus > CPU_SETSIZE) num_cpus = CPU_SETSIZE;
+    std::vector<long> max_frequencies(num_cpus > 0 ? num_cpus : 0);
+    long highest = -1;
+    for (int cpu = 0; cpu < num_cpus; ++cpu) {
+      max_frequencies[cpu] = ReadMaxFrequency(cpu);
+      if (max_frequencies[cpu] > highest) highest = max_frequencies[cpu];
+    }
+    for (int cpu = 0; cpu < num_cpus; ++cpu) {
+      // Cores with unreadable frequency are conservatively treated as
+      // performance cores so the performance mask never ends up empty.
+      if (max_frequencies[cpu] < 0 || max_frequencies[cpu] == highest) {
+        CPU_SET(cpu, &c->performance);
+      } else {
+        CPU_SET(cpu, &c->efficiency);
+        c->heterogeneous = true;
+      }
+    }
+    return c;
+  }();
+  return classification;
+}
+
+}  // namespace
+
+ScopedCpuAffinity::ScopedCpuAffinity(
+    InterpreterOptions::CpuAffinityPolicy policy) {
+  if (policy == InterpreterOptions::CpuAffinityPolicy::kNoAffinity) return;
+  const CoreClassification& cores = GetCoreClassification();
+  if (!cores.heterogeneous) return;
+  const cpu_set_t& target =
+      policy == InterpreterOptions::CpuAffinityPolicy::kPerformanceCores
+          ? cores.performance
+          : cores.efficiency;
+  if (CPU_COUNT(&target) == 0) return;
+  if (sched_getaffinity(0, sizeof(previous_mask_), &previous_mask_) != 0) {
+    return;
+  }
+  if (sched_setaffinity(0, sizeof(target), &target) != 0) {
+    TFLITE_LOG_PROD_ONCE(TFLITE_LOG_WARNING,
+                         "Failed to apply invoke CPU affinity.");
+    return;
+  }
+  active_ = true;
+}
+
+ScopedCpuAffinity::~ScopedCpuAffinity() {
+  if (active_) {
+    sched_setaffinity(0, sizeof(previous_mask_), &previous_mask_);
+  }
+}
+
+}  // namespace tflite
+
+#else  // !TFLITE_SUPPORTS_CPU_AFFINITY
+
+namespace tflite {
+
+ScopedCpuAffinity::ScopedCpuAffinity(InterpreterOptions::CpuAffinityPolicy) {}
+
+ScopedCpuAffinity::~ScopedCpuAffinity() = default;
+
+}  // namespace tflite
+
+#endif  // TFLITE_SUPPORTS_CPU_AFFINITY
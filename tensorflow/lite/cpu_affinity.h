@@ -0,0 +1,56 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_CPU_AFFINITY_H_
+#define TENSORFLOW_LITE_CPU_AFFINITY_H_
+
+#include "tensorflow/lite/interpreter_options.h"
+
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sched.h>
+#define TFLITE_SUPPORTS_CPU_AFFINITY 1
+#endif
+
+namespace tflite {
+
+// Applies an invoke CPU affinity policy (see
+// InterpreterOptions::SetInvokeCpuAffinityPolicy) to the calling thread for
+// the lifetime of the object and restores the thread's previous affinity
+// mask on destruction. Cores are classified by their reported maximum
+// frequency: cores running at the highest maximum are performance cores, the
+// rest efficiency cores. A no-op for kNoAffinity, on platforms without
+// sched_setaffinity, and on CPUs with symmetric cores.
+//
+// WARNING: This is an experimental API and subject to change.
+class ScopedCpuAffinity {
+ public:
+  explicit ScopedCpuAffinity(InterpreterOptions::CpuAffinityPolicy policy);
+  ~ScopedCpuAffinity();
+
+  ScopedCpuAffinity(const ScopedCpuAffinity&) = delete;
+  ScopedCpuAffinity& operator=(const ScopedCpuAffinity&) = delete;
+
+  // True if an affinity mask was applied and will be restored.
+  bool active() const { return active_; }
+
+ private:
+  bool active_ = false;
+#ifdef TFLITE_SUPPORTS_CPU_AFFINITY
+  cpu_set_t previous_mask_;
+#endif
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_CPU_AFFINITY_H_
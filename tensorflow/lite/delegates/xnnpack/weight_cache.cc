@@ -33,6 +33,7 @@ limitations under the License.
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -749,4 +750,28 @@ PackIdentifier MMapWeightCacheProvider::BuildPackIdentifier(
                         /*bias_id=*/get_buffer_id(key.bias)};
 }
 
+std::shared_ptr<MMapWeightCacheProvider> GetSharedWeightCacheProvider(
+    const char* file_path) {
+  // The registry holds weak references: a provider is freed when the last
+  // delegate using it goes away and rebuilt if the path is requested again.
+  static std::mutex* mutex = new std::mutex;
+  static auto* providers =
+      new std::unordered_map<std::string,
+                             std::weak_ptr<MMapWeightCacheProvider>>;
+  if (!file_path) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(*mutex);
+  std::weak_ptr<MMapWeightCacheProvider>& entry = (*providers)[file_path];
+  if (std::shared_ptr<MMapWeightCacheProvider> provider = entry.lock()) {
+    return provider;
+  }
+  auto provider = std::make_shared<MMapWeightCacheProvider>();
+  if (!provider->LoadOrStartBuild(file_path)) {
+    return nullptr;
+  }
+  entry = provider;
+  return provider;
+}
+
 }  // namespace tflite::xnnpack
@@ -469,6 +469,29 @@ class MMapWeightCacheProvider {
   std::map<size_t, void*> offset_to_addr_;
 };
 
+// Returns the process-wide weight cache provider associated to `file_path`,
+// creating it on first use.
+//
+// Every delegate instance that requests the same path gets the same provider,
+// so packed weights are built (and held in memory) only once per process no
+// matter how many interpreters run the model. This is the only way to share
+// packed weights when using `kInMemoryCachePath`, since each provider backs
+// the in-memory cache with its own anonymous file.
+//
+// All delegates sharing a path must be created for the same model: cache
+// entries are keyed by tensor buffer identifiers, which are only unique
+// within one model. Use distinct paths for distinct models.
+//
+// The registry itself is thread-safe, but the provider is not synchronized
+// while the cache is being built. Create the delegates (and run the first
+// interpreter allocation that packs the weights) sequentially; concurrent
+// lookups on the finalized cache are safe.
+//
+// Returns nullptr if the cache could neither be loaded nor started.
+[[nodiscard]]
+std::shared_ptr<MMapWeightCacheProvider> GetSharedWeightCacheProvider(
+    const char* file_path);
+
 }  // namespace xnnpack
 }  // namespace tflite
 
@@ -1052,5 +1052,31 @@ TEST(MMapWeightCacheProviderTest, XnnpackCApiJourney) {
   }
 }
 
+TEST(SharedWeightCacheProviderTest, SamePathReturnsSameProvider) {
+  TempFileDesc tmp_file(TempFileDesc::kAutoClose);
+  const std::shared_ptr<MMapWeightCacheProvider> provider_1 =
+      GetSharedWeightCacheProvider(tmp_file.GetCPath());
+  ASSERT_NE(provider_1, nullptr);
+  const std::shared_ptr<MMapWeightCacheProvider> provider_2 =
+      GetSharedWeightCacheProvider(tmp_file.GetCPath());
+  EXPECT_EQ(provider_1, provider_2);
+}
+
+TEST(SharedWeightCacheProviderTest, DifferentPathsReturnDifferentProviders) {
+  TempFileDesc tmp_file_1(TempFileDesc::kAutoClose);
+  TempFileDesc tmp_file_2(TempFileDesc::kAutoClose);
+  const std::shared_ptr<MMapWeightCacheProvider> provider_1 =
+      GetSharedWeightCacheProvider(tmp_file_1.GetCPath());
+  const std::shared_ptr<MMapWeightCacheProvider> provider_2 =
+      GetSharedWeightCacheProvider(tmp_file_2.GetCPath());
+  ASSERT_NE(provider_1, nullptr);
+  ASSERT_NE(provider_2, nullptr);
+  EXPECT_NE(provider_1, provider_2);
+}
+
+TEST(SharedWeightCacheProviderTest, NullPathReturnsNull) {
+  EXPECT_EQ(GetSharedWeightCacheProvider(nullptr), nullptr);
+}
+
 }  // namespace
 }  // namespace tflite::xnnpack
@@ -550,13 +550,22 @@ class Delegate {
     // If no weight cache is provided, add one when requested.
     if (!options_.weights_cache) {
       if (options_.weight_cache_file_path) {
-        if (weight_cache_provider_.LoadOrStartBuild(
-                options_.weight_cache_file_path)) {
+        bool cache_is_ready;
+        if (options_.flags &
+            TFLITE_XNNPACK_DELEGATE_FLAG_SHARED_WEIGHT_CACHE_PROVIDER) {
+          shared_weight_cache_provider_ =
+              GetSharedWeightCacheProvider(options_.weight_cache_file_path);
+          cache_is_ready = shared_weight_cache_provider_ != nullptr;
+        } else {
+          cache_is_ready = weight_cache_provider_.LoadOrStartBuild(
+              options_.weight_cache_file_path);
+        }
+        if (cache_is_ready) {
           options_.weights_cache =
               reinterpret_cast<TfLiteXNNPackDelegateWeightsCache*>(
-                  weight_cache_provider_.GetCacheProvider().context);
+                  weight_cache_provider().GetCacheProvider().context);
           options_.weight_cache_file_path =
-              weight_cache_provider_.GetFilePath().data();
+              weight_cache_provider().GetFilePath().data();
         } else {
           TFLITE_LOG_PROD(tflite::TFLITE_LOG_ERROR,
                           "XNNPack weight cache could neither be loaded from "
@@ -665,6 +674,13 @@ class Delegate {
 
   xnn_workspace_t workspace() const { return workspace_.get(); }
 
+  // Returns the weight cache provider backing `options_.weights_cache`,
+  // which is either owned by this delegate or shared process-wide.
+  MMapWeightCacheProvider& weight_cache_provider() {
+    return shared_weight_cache_provider_ ? *shared_weight_cache_provider_
+                                         : weight_cache_provider_;
+  }
+
   TfLiteStatus AssociateVariableWithTensor(int local_id,
                                            const TfLiteTensor* tensor,
                                            TfLiteContext* logging_context) {
@@ -763,6 +779,10 @@ class Delegate {
   // this will be used as a weight cache.
   MMapWeightCacheProvider weight_cache_provider_;
 
+  // Set instead of `weight_cache_provider_` when the options request a
+  // process-wide provider shared with other delegate instances.
+  std::shared_ptr<MMapWeightCacheProvider> shared_weight_cache_provider_;
+
   // A map of `f16`->`f32` dequantization tensor indices that will be skipped in
   // the XNNPACK subgraph.
   std::unordered_map<int, int> f16_input_tensor_for_dequant_f32_tensor_;
@@ -843,8 +863,8 @@ class Subgraph {
       subgraph_index = this_subgraph->GetSubgraphIndex();
     }
     // Map tensors identifiers before packing anything.
-    if (delegate.weight_cache_provider_.IsActive()) {
-      delegate.weight_cache_provider_.MapTensorIdentifiers(
+    if (delegate.weight_cache_provider().IsActive()) {
+      delegate.weight_cache_provider().MapTensorIdentifiers(
           context->tensors, context->tensors_size,
           reinterpret_cast<tflite::Subgraph*>(context->impl_)
               ->GetTensorBufferIdentifiers());
@@ -1207,9 +1227,9 @@ class Subgraph {
       flags |= XNN_FLAG_SLINKY_ENABLED;
     }
 
-    if (delegate.weight_cache_provider_.IsActive() &&
-        delegate.weight_cache_provider_.CanStartBuildStep()) {
-      if (!delegate.weight_cache_provider_.StartBuildStep()) {
+    if (delegate.weight_cache_provider().IsActive() &&
+        delegate.weight_cache_provider().CanStartBuildStep()) {
+      if (!delegate.weight_cache_provider().StartBuildStep()) {
         TF_LITE_KERNEL_LOG(
             context, "XNNPack delegate failed to start cache build step.");
         return nullptr;
@@ -1218,9 +1238,9 @@ class Subgraph {
     status = xnn_create_runtime_v4(subgraph.get(), delegate.weights_cache(),
                                    delegate.workspace(), delegate.threadpool(),
                                    flags, &runtime_ptr);
-    if (delegate.weight_cache_provider_.IsActive() &&
-        delegate.weight_cache_provider_.CanStartBuildStep()) {
-      if (!delegate.weight_cache_provider_.StopBuildStep()) {
+    if (delegate.weight_cache_provider().IsActive() &&
+        delegate.weight_cache_provider().CanStartBuildStep()) {
+      if (!delegate.weight_cache_provider().StopBuildStep()) {
         TF_LITE_KERNEL_LOG(context,
                            "XNNPack delegate failed to stop cache build step.");
         return nullptr;
@@ -7622,7 +7642,7 @@ TfLiteIntArray* Delegate::PrepareOpsToDelegate(TfLiteContext* context) {
             ? static_unpacked_data_[subgraph_index].data() +
                   static_unpacked_input_it_->second
             : static_cast<const char*>(input_tensor.data.data);
-    weight_cache_provider_.RemapDataBuffer(packed_data, unpacked_data);
+    weight_cache_provider().RemapDataBuffer(packed_data, unpacked_data);
   }
 
   // Add nodes that unpack static data consumed by delegated nodes.
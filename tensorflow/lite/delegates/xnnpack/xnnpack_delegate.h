@@ -51,6 +51,13 @@ extern "C" {
 // If XNNPACK has been built with Slinky, enable Slinky usage.
 // (Ignored if XNNPACK is built without Slinky.)
 #define TFLITE_XNNPACK_DELEGATE_FLAG_ENABLE_SLINKY 0x00000100
+// Share the weight cache provider created for `weight_cache_file_path` with
+// every delegate instance in the process that uses the same path, so packed
+// weights are built and held in memory only once no matter how many
+// interpreters run the model. All delegates sharing a path must run the same
+// model, and their creation (including the first tensor allocation that packs
+// the weights) must be serialized by the caller.
+#define TFLITE_XNNPACK_DELEGATE_FLAG_SHARED_WEIGHT_CACHE_PROVIDER 0x00000200
 
 struct TfLiteXNNPackDelegateWeightsCache;
 
@@ -67,6 +74,7 @@ typedef struct {
   // - TFLITE_XNNPACK_DELEGATE_FLAG_TRANSIENT_INDIRECTION_BUFFER
   // - TFLITE_XNNPACK_DELEGATE_FLAG_ENABLE_LATEST_OPERATORS
   // - TFLITE_XNNPACK_DELEGATE_FLAG_ENABLE_SUBGRAPH_RESHAPING
+  // - TFLITE_XNNPACK_DELEGATE_FLAG_SHARED_WEIGHT_CACHE_PROVIDER
   uint32_t flags;
   // Cache for packed weights, can be shared between multiple instances of
   // delegates.
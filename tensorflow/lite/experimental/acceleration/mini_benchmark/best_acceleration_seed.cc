@@ -0,0 +1,132 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/best_acceleration_seed.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/acceleration/configuration/configuration_generated.h"
+#include "tensorflow/lite/experimental/acceleration/compatibility/android_info.h"
+#include "tensorflow/lite/experimental/acceleration/compatibility/canonicalize_value.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/fb_storage.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/status_codes.h"
+#include "tensorflow/lite/minimal_logging.h"
+
+namespace tflite {
+namespace acceleration {
+
+std::string GetDeviceModelKey() {
+  AndroidInfo android_info;
+  if (!RequestAndroidInfo(&android_info).ok()) {
+    return "/";
+  }
+  return CanonicalizeValue(android_info.manufacturer) + "/" +
+         CanonicalizeValue(android_info.model);
+}
+
+std::string LocalEventStorageFileName(const MinibenchmarkSettings& settings) {
+  if (settings.storage_paths() == nullptr ||
+      settings.storage_paths()->storage_file_path() == nullptr) {
+    return "mini_benchmark.default.extra.fb";
+  }
+  return settings.storage_paths()->storage_file_path()->str() + ".extra.fb";
+}
+
+MinibenchmarkStatus SeedBestAcceleration(
+    const MinibenchmarkSettings& settings,
+    const std::vector<BestAccelerationSeedEntry>& entries,
+    const std::string& device_model_key) {
+  if (settings.settings_to_test() == nullptr ||
+      settings.settings_to_test()->size() == 0 ||
+      settings.storage_paths() == nullptr ||
+      settings.storage_paths()->storage_file_path() == nullptr ||
+      settings.storage_paths()->storage_file_path()->str().empty()) {
+    return kMinibenchmarkPreconditionNotMet;
+  }
+
+  FlatbufferStorage<MiniBenchmarkEvent> storage(
+      LocalEventStorageFileName(settings));
+  MinibenchmarkStatus read_status = storage.Read();
+  if (read_status != kMinibenchmarkSuccess) {
+    return read_status;
+  }
+  for (int i = storage.Count() - 1; i >= 0; i--) {
+    const MiniBenchmarkEvent* event = storage.Get(i);
+    if (event != nullptr && event->best_acceleration_decision() != nullptr) {
+      // A decision based on actual mini-benchmark runs (or an earlier seed)
+      // is already stored; measured results always win over shipped ones.
+      return kMinibenchmarkSuccess;
+    }
+  }
+
+  const BestAccelerationSeedEntry* matching_entry = nullptr;
+  for (const BestAccelerationSeedEntry& entry : entries) {
+    if (entry.device_model_key == device_model_key) {
+      matching_entry = &entry;
+      break;
+    }
+  }
+  if (matching_entry == nullptr) {
+    return kMinibenchmarkNoSeedForDevice;
+  }
+
+  // Only seed configurations that the mini-benchmark is going to test anyway:
+  // this guarantees the seeded choice is validated on-device and that the
+  // selector can map the seeded event back to one of the settings_to_test.
+  bool is_to_be_tested = false;
+  for (int i = 0; i < settings.settings_to_test()->size(); i++) {
+    TFLiteSettingsT to_test_tflite_settings;
+    settings.settings_to_test()->Get(i)->UnPackTo(&to_test_tflite_settings);
+    if (to_test_tflite_settings == matching_entry->tflite_settings) {
+      is_to_be_tested = true;
+      break;
+    }
+  }
+  if (!is_to_be_tested) {
+    TFLITE_LOG_PROD_ONCE(TFLITE_LOG_WARNING,
+                         "Best acceleration seed for device %s doesn't match "
+                         "any of the settings to test, ignoring it.\n",
+                         device_model_key.c_str());
+    return kMinibenchmarkSeedNotInSettingsToTest;
+  }
+
+  flatbuffers::FlatBufferBuilder fbb;
+  BenchmarkEventT seed_event;
+  seed_event.event_type = BenchmarkEventType_END;
+  seed_event.tflite_settings =
+      std::make_unique<TFLiteSettingsT>(matching_entry->tflite_settings);
+  // A seeded decision is based on 0 source events, so the first completed
+  // mini-benchmark run supersedes it.
+  auto best_acceleration_decision = CreateBestAccelerationDecision(
+      fbb, /*number_of_source_events=*/0, CreateBenchmarkEvent(fbb, &seed_event),
+      /*min_inference_time_us=*/0);
+  TFLITE_LOG_PROD_ONCE(TFLITE_LOG_INFO,
+                       "Seeding best acceleration for device %s.\n",
+                       device_model_key.c_str());
+  return storage.Append(
+      &fbb, CreateMiniBenchmarkEvent(fbb, /*is_log_flushing_event=*/false,
+                                     best_acceleration_decision));
+}
+
+MinibenchmarkStatus SeedBestAcceleration(
+    const MinibenchmarkSettings& settings,
+    const std::vector<BestAccelerationSeedEntry>& entries) {
+  return SeedBestAcceleration(settings, entries, GetDeviceModelKey());
+}
+
+}  // namespace acceleration
+}  // namespace tflite
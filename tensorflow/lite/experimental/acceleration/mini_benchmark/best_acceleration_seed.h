@@ -0,0 +1,79 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_ACCELERATION_MINI_BENCHMARK_BEST_ACCELERATION_SEED_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_ACCELERATION_MINI_BENCHMARK_BEST_ACCELERATION_SEED_H_
+
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/acceleration/configuration/configuration_generated.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/status_codes.h"
+
+namespace tflite {
+namespace acceleration {
+
+// A known-good acceleration configuration for one device model, typically
+// gathered from mini-benchmark results on other installs of the same app and
+// shipped with the app. Seeding lets the first inference on a fresh install
+// use the right delegate immediately, instead of waiting for a full
+// mini-benchmark cycle on-device.
+struct BestAccelerationSeedEntry {
+  // Device model key this entry applies to, in the format returned by
+  // GetDeviceModelKey().
+  std::string device_model_key;
+  // Known-good settings for this device model. The settings are only applied
+  // when they match one of the settings_to_test of the MinibenchmarkSettings
+  // they are seeded into, so that the regular mini-benchmark still validates
+  // them on-device and can supersede them with measured results.
+  TFLiteSettingsT tflite_settings;
+};
+
+// Returns the key identifying this device model, in the form
+// "<manufacturer>/<model>" with both parts canonicalized the same way as in
+// the GPU compatibility database (lower-cased, spaces and dashes replaced).
+// Both parts are empty on non-Android platforms.
+std::string GetDeviceModelKey();
+
+// Name of the file used to store mini-benchmark events that are local to this
+// process (as opposed to events written by the separate validator process).
+// Shared with the mini-benchmark implementation; seeded decisions are written
+// here so that they are picked up on the next MiniBenchmark creation.
+std::string LocalEventStorageFileName(const MinibenchmarkSettings& settings);
+
+// Looks up `device_model_key` in `entries` and, when a matching known-good
+// configuration is found, records it as a best acceleration decision in the
+// local event storage of `settings`. Does nothing if the storage already
+// contains a best acceleration decision: measured results always win over
+// shipped ones. The seeded decision is based on 0 benchmark events, so the
+// first completed mini-benchmark run replaces it.
+//
+// Returns kMinibenchmarkSuccess if a decision was seeded or one was already
+// stored, kMinibenchmarkNoSeedForDevice if no entry matches this device, and
+// kMinibenchmarkSeedNotInSettingsToTest if the matching entry is not part of
+// the settings_to_test of `settings`.
+MinibenchmarkStatus SeedBestAcceleration(
+    const MinibenchmarkSettings& settings,
+    const std::vector<BestAccelerationSeedEntry>& entries,
+    const std::string& device_model_key);
+
+// Same as above, keyed on the device model of the device the code runs on.
+MinibenchmarkStatus SeedBestAcceleration(
+    const MinibenchmarkSettings& settings,
+    const std::vector<BestAccelerationSeedEntry>& entries);
+
+}  // namespace acceleration
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_EXPERIMENTAL_ACCELERATION_MINI_BENCHMARK_BEST_ACCELERATION_SEED_H_
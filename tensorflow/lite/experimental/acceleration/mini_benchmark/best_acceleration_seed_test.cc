@@ -0,0 +1,148 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/best_acceleration_seed.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/acceleration/configuration/configuration_generated.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/fb_storage.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/status_codes.h"
+
+namespace tflite {
+namespace acceleration {
+namespace {
+
+std::string GetTemporaryDirectory() {
+#ifdef __ANDROID__
+  return "/data/local/tmp";
+#else
+  if (getenv("TEST_TMPDIR")) {
+    return getenv("TEST_TMPDIR");
+  }
+  if (getenv("TEMP")) {
+    return getenv("TEMP");
+  }
+  return ".";
+#endif
+}
+
+class BestAccelerationSeedTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    storage_path_ = GetTemporaryDirectory() + "/acceleration_seed.fb";
+    unlink(storage_path_.c_str());
+    unlink((storage_path_ + ".extra.fb").c_str());
+
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<TFLiteSettings>> settings_to_test{
+        CreateTFLiteSettings(fbb, Delegate_XNNPACK),
+        CreateTFLiteSettings(fbb, Delegate_GPU)};
+    fbb.Finish(CreateMinibenchmarkSettings(
+        fbb, fbb.CreateVector(settings_to_test),
+        CreateModelFile(fbb, fbb.CreateString("model.tflite")),
+        CreateBenchmarkStoragePaths(fbb, fbb.CreateString(storage_path_),
+                                    fbb.CreateString(GetTemporaryDirectory()))));
+    settings_buffer_ = std::string(
+        reinterpret_cast<const char*>(fbb.GetBufferPointer()), fbb.GetSize());
+    settings_ = flatbuffers::GetRoot<MinibenchmarkSettings>(
+        settings_buffer_.data());
+  }
+
+  BestAccelerationSeedEntry GpuSeedEntry(const std::string& key) {
+    BestAccelerationSeedEntry entry;
+    entry.device_model_key = key;
+    entry.tflite_settings.delegate = Delegate_GPU;
+    return entry;
+  }
+
+  int CountStoredDecisions() {
+    FlatbufferStorage<MiniBenchmarkEvent> storage(
+        LocalEventStorageFileName(*settings_));
+    EXPECT_EQ(storage.Read(), kMinibenchmarkSuccess);
+    int count = 0;
+    for (int i = 0; i < storage.Count(); i++) {
+      if (storage.Get(i)->best_acceleration_decision() != nullptr) count++;
+    }
+    return count;
+  }
+
+  std::string storage_path_;
+  std::string settings_buffer_;
+  const MinibenchmarkSettings* settings_;
+};
+
+TEST_F(BestAccelerationSeedTest, SeedsMatchingEntry) {
+  std::vector<BestAccelerationSeedEntry> entries{GpuSeedEntry("google/pixel_7"),
+                                                 GpuSeedEntry("acme/phone_x")};
+  EXPECT_EQ(SeedBestAcceleration(*settings_, entries, "acme/phone_x"),
+            kMinibenchmarkSuccess);
+  EXPECT_EQ(CountStoredDecisions(), 1);
+
+  FlatbufferStorage<MiniBenchmarkEvent> storage(
+      LocalEventStorageFileName(*settings_));
+  ASSERT_EQ(storage.Read(), kMinibenchmarkSuccess);
+  const auto* decision = storage.Get(0)->best_acceleration_decision();
+  ASSERT_NE(decision, nullptr);
+  EXPECT_EQ(decision->number_of_source_events(), 0);
+  ASSERT_NE(decision->min_latency_event(), nullptr);
+  EXPECT_EQ(decision->min_latency_event()->tflite_settings()->delegate(),
+            Delegate_GPU);
+}
+
+TEST_F(BestAccelerationSeedTest, NoEntryForDevice) {
+  std::vector<BestAccelerationSeedEntry> entries{
+      GpuSeedEntry("google/pixel_7")};
+  EXPECT_EQ(SeedBestAcceleration(*settings_, entries, "acme/phone_x"),
+            kMinibenchmarkNoSeedForDevice);
+  EXPECT_EQ(CountStoredDecisions(), 0);
+}
+
+TEST_F(BestAccelerationSeedTest, EntryNotInSettingsToTest) {
+  BestAccelerationSeedEntry entry;
+  entry.device_model_key = "acme/phone_x";
+  entry.tflite_settings.delegate = Delegate_HEXAGON;
+  EXPECT_EQ(SeedBestAcceleration(*settings_, {entry}, "acme/phone_x"),
+            kMinibenchmarkSeedNotInSettingsToTest);
+  EXPECT_EQ(CountStoredDecisions(), 0);
+}
+
+TEST_F(BestAccelerationSeedTest, ExistingDecisionIsNotOverwritten) {
+  std::vector<BestAccelerationSeedEntry> entries{GpuSeedEntry("acme/phone_x")};
+  EXPECT_EQ(SeedBestAcceleration(*settings_, entries, "acme/phone_x"),
+            kMinibenchmarkSuccess);
+  EXPECT_EQ(SeedBestAcceleration(*settings_, entries, "acme/phone_x"),
+            kMinibenchmarkSuccess);
+  EXPECT_EQ(CountStoredDecisions(), 1);
+}
+
+TEST_F(BestAccelerationSeedTest, MissingStoragePathFailsPrecondition) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<TFLiteSettings>> settings_to_test{
+      CreateTFLiteSettings(fbb, Delegate_GPU)};
+  fbb.Finish(
+      CreateMinibenchmarkSettings(fbb, fbb.CreateVector(settings_to_test)));
+  const auto* settings =
+      flatbuffers::GetRoot<MinibenchmarkSettings>(fbb.GetBufferPointer());
+  EXPECT_EQ(SeedBestAcceleration(*settings, {GpuSeedEntry("acme/phone_x")},
+                                 "acme/phone_x"),
+            kMinibenchmarkPreconditionNotMet);
+}
+
+}  // namespace
+}  // namespace acceleration
+}  // namespace tflite
@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/acceleration/configuration/configuration_generated.h"
+#include "tensorflow/lite/experimental/acceleration/mini_benchmark/best_acceleration_seed.h"
 #include "tensorflow/lite/experimental/acceleration/mini_benchmark/fb_storage.h"
 #include "tensorflow/lite/experimental/acceleration/mini_benchmark/mini_benchmark.h"
 #include "tensorflow/lite/experimental/acceleration/mini_benchmark/status_codes.h"
@@ -81,14 +82,10 @@ class MemoizedBestAccelerationSelector {
   ComputeSettingsT GetBestAcceleration(
       const std::vector<const BenchmarkEvent*>& events) {
     ComputeSettingsT result;
-    if (events.empty()) {
-      TFLITE_LOG_PROD_ONCE(
-          TFLITE_LOG_INFO,
-          "No completed events are available to calculate best "
-          "acceleration result for model (%s, %s).\n",
-          model_namespace_.c_str(), model_id_.c_str());
-      return result;
-    }
+    // The memoized result is checked before the empty-events early return so
+    // that a decision restored from storage that was based on 0 events (a
+    // pre-seeded known-good configuration) is returned until actual
+    // mini-benchmark results supersede it.
     if (memoised_result_ != nullptr &&
         (events.size() == number_of_events_in_memoized_call_)) {
       TFLITE_LOG_PROD_ONCE(TFLITE_LOG_INFO,
@@ -99,6 +96,14 @@ class MemoizedBestAccelerationSelector {
       memoised_result_->UnPackTo(&result);
       return result;
     }
+    if (events.empty()) {
+      TFLITE_LOG_PROD_ONCE(
+          TFLITE_LOG_INFO,
+          "No completed events are available to calculate best "
+          "acceleration result for model (%s, %s).\n",
+          model_namespace_.c_str(), model_id_.c_str());
+      return result;
+    }
 
     TFLITE_LOG_PROD_ONCE(TFLITE_LOG_INFO,
                          "Calculating best acceleration result for model (%s, "
@@ -409,15 +414,6 @@ class MiniBenchmarkImpl : public MiniBenchmark {
   }
 
  private:
-  static std::string LocalEventStorageFileName(
-      const MinibenchmarkSettings& settings) {
-    if (settings.storage_paths() == nullptr ||
-        settings.storage_paths()->storage_file_path() == nullptr) {
-      return "mini_benchmark.default.extra.fb";
-    }
-    return settings.storage_paths()->storage_file_path()->str() + ".extra.fb";
-  }
-
   bool BenchmarkIsEnabled() const {
     if (settings_->settings_to_test() == nullptr) return false;
     if (settings_->settings_to_test()->size() <= 0) return false;
@@ -121,6 +121,12 @@ enum MinibenchmarkStatus {
   kMinibenchmarkUnableToSetCpuAffinity = 1601,
 
   kMinibenchmarkAbiMethodNotAvailable = 1701,
+
+  // Best acceleration seeding status codes.
+  //
+  // Next available code: 1803
+  kMinibenchmarkNoSeedForDevice = 1801,
+  kMinibenchmarkSeedNotInSettingsToTest = 1802,
 };
 }  // namespace acceleration
 }  // namespace tflite
@@ -23,6 +23,12 @@ namespace tflite {
 namespace ops {
 namespace custom {
 
+// Subgraph resource ids under which the KV cache op stores the key and value
+// cache buffers. Shared with the attention op so that it can query how many
+// cache entries are currently valid.
+inline constexpr int kKVCacheKeyResourceId = 42;
+inline constexpr int kKVCacheValueResourceId = 43;
+
 TfLiteRegistration* Register_KV_CACHE();
 TfLiteRegistration* Register_EXTERNAL_KV_CACHE();
 TfLiteRegistration* Register_SDPA();
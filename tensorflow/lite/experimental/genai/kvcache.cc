@@ -21,6 +21,7 @@ limitations under the License.
 #include "flatbuffers/flexbuffers.h"
 #include "tensorflow/lite/core/c/common.h"
 #include "tensorflow/lite/core/subgraph.h"
+#include "tensorflow/lite/experimental/genai/genai_ops.h"
 #include "tensorflow/lite/experimental/resource/cache_buffer.h"
 #include "tensorflow/lite/experimental/resource/resource_base.h"
 #include "tensorflow/lite/kernels/internal/runtime_shape.h"
@@ -42,9 +43,6 @@ static const int kDefaultMaxNumCacheEntries = 2048;
 static const int kDefaultNumTransformerLayers = 32;
 static const int kDefaultTransformerLayerId = 0;
 
-static const int KVCACHE_KEY_RESOURCE = 42;
-static const int KVCACHE_VALUE_RESOURCE = 43;
-
 struct OpData {
   int num_layers;
   int layer_index;
@@ -159,25 +157,25 @@ TfLiteStatus KVCachePrepare(TfLiteContext* context, TfLiteNode* node) {
   Subgraph* subgraph = reinterpret_cast<Subgraph*>(context->impl_);
   auto& resources = subgraph->resources();
 
-  if (resources.count(KVCACHE_KEY_RESOURCE) == 0) {
+  if (resources.count(kKVCacheKeyResourceId) == 0) {
     auto* cbuffer = new resource::CacheBuffer();
     cbuffer->Initialize(*kcache_buffer_dims);
-    resources.emplace(KVCACHE_KEY_RESOURCE, cbuffer);
+    resources.emplace(kKVCacheKeyResourceId, cbuffer);
     op_data->key_cache_buffer = cbuffer;
   } else {
     resource::ResourceBase* resourcePtr =
-        resources.at(KVCACHE_KEY_RESOURCE).get();
+        resources.at(kKVCacheKeyResourceId).get();
     resource::CacheBuffer* cbuffer = (resource::CacheBuffer*)(resourcePtr);
     op_data->key_cache_buffer = cbuffer;
   }
-  if (resources.count(KVCACHE_VALUE_RESOURCE) == 0) {
+  if (resources.count(kKVCacheValueResourceId) == 0) {
     auto* cbuffer = new resource::CacheBuffer();
     cbuffer->Initialize(*vcache_buffer_dims);
-    resources.emplace(KVCACHE_VALUE_RESOURCE, cbuffer);
+    resources.emplace(kKVCacheValueResourceId, cbuffer);
     op_data->value_cache_buffer = cbuffer;
   } else {
     resource::ResourceBase* resourcePtr =
-        resources.at(KVCACHE_VALUE_RESOURCE).get();
+        resources.at(kKVCacheValueResourceId).get();
     resource::CacheBuffer* cbuffer = (resource::CacheBuffer*)(resourcePtr);
     op_data->value_cache_buffer = cbuffer;
   }
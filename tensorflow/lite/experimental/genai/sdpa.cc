@@ -15,6 +15,7 @@ limitations under the License.
 
 #include <math.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -23,6 +24,9 @@ limitations under the License.
 #include "flatbuffers/flexbuffers.h"
 #include "tensorflow/lite/c/c_api_types.h"
 #include "tensorflow/lite/core/c/common.h"
+#include "tensorflow/lite/core/subgraph.h"
+#include "tensorflow/lite/experimental/genai/genai_ops.h"
+#include "tensorflow/lite/experimental/resource/cache_buffer.h"
 #include "tensorflow/lite/kernels/internal/common.h"
 #include "tensorflow/lite/kernels/internal/reference/add.h"
 #include "tensorflow/lite/kernels/internal/reference/batch_matmul.h"
@@ -473,6 +477,51 @@ TfLiteStatus SDPAEval(TfLiteContext* context, TfLiteNode* node) {
   bool mqa = key_tensor->dims->data[2] == 1;
   bool gqa = !mqa && (key_tensor->dims->data[2] != query_tensor->dims->data[2]);
 
+  // When the K/V tensors come from the in-subgraph KV cache, only a prefix of
+  // the padded sequence dimension holds valid entries. During token-by-token
+  // decode (query length 1) restrict the computation to that prefix so the
+  // attention cost scales with the actual context length instead of the
+  // maximum cache size. The cache fills its slots from the start, so the
+  // valid entries are contiguous and every sliced buffer below stays packed.
+  const int max_kv_len = key_tensor->dims->data[1];
+  int effective_kv_len = max_kv_len;
+  if (query_tensor->dims->data[1] == 1 &&
+      attention_mask_tensor->dims->data[2] == 1) {
+    Subgraph* this_subgraph = reinterpret_cast<Subgraph*>(context->impl_);
+    auto& resources = this_subgraph->resources();
+    auto resource_it = resources.find(kKVCacheKeyResourceId);
+    if (resource_it != resources.end()) {
+      auto* cache_buffer =
+          static_cast<resource::CacheBuffer*>(resource_it->second.get());
+      // Layers that already ran this step have one more entry than the ones
+      // that haven't; the maximum covers the layer this op belongs to.
+      size_t num_entries = 0;
+      for (size_t layer = 0; layer < cache_buffer->GetNumLayers(); ++layer) {
+        num_entries = std::max(num_entries, cache_buffer->GetNumEntries(layer));
+      }
+      if (num_entries > 0 && num_entries < static_cast<size_t>(max_kv_len)) {
+        effective_kv_len = num_entries;
+      }
+    }
+  }
+  if (effective_kv_len != max_kv_len) {
+    key_shape.SetDim(1, effective_kv_len);
+    value_shape.SetDim(1, effective_kv_len);
+    attention_mask_shape.SetDim(3, effective_kv_len);
+    transpose_k_out_shape.SetDim(2, effective_kv_len);
+    broadcast_k_out_shape.SetDim(2, effective_kv_len);
+    matmul1_out_shape.SetDim(3, effective_kv_len);
+    add_out_shape.SetDim(3, effective_kv_len);
+    transpose_v_out_shape.SetDim(3, effective_kv_len);
+    broadcast_v_out_shape.SetDim(3, effective_kv_len);
+    if (mqa) {
+      reshape_k_or_q_out_shape.SetDim(0, effective_kv_len);
+      reshape_v_or_add_out_shape.SetDim(1, effective_kv_len);
+    } else {
+      reshape_v_or_add_out_shape.SetDim(2, effective_kv_len);
+    }
+  }
+
   // scale * q
   float scale = op_data->scale;
   int flat_size = query_shape.FlatSize();
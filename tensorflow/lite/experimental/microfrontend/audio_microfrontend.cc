@@ -14,6 +14,7 @@ limitations under the License.
 ==============================================================================*/
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "flatbuffers/flexbuffers.h"  // from @flatbuffers
@@ -42,8 +43,19 @@ typedef struct {
   bool zero_padding;
   int out_scale;
   bool out_float;
+  bool streaming;
 } TfLiteAudioMicrofrontendParams;
 
+// Primes the window's overlap buffer with zeros so that the first
+// window_step-sized chunk of samples already completes a full window. From
+// then on the overlap buffer carries the trailing window_size - window_step
+// samples across invokes, so each invoke only has to supply the new hop.
+void PrimeWindowForStreaming(FrontendState* state) {
+  std::memset(state->window.input, 0,
+              state->window.size * sizeof(*state->window.input));
+  state->window.input_used = state->window.size - state->window.step;
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   auto* data = new TfLiteAudioMicrofrontendParams;
 
@@ -79,6 +91,15 @@ void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   data->zero_padding = m["zero_padding"].AsBool();
   data->out_scale = m["out_scale"].AsInt32();
   data->out_float = m["out_float"].AsBool();
+  // Streaming mode keeps the frontend state (window overlap buffer, noise
+  // reduction and PCAN gain state) alive across invokes, so each invoke only
+  // needs to supply the new window_step-sized hop of samples per frame
+  // instead of a full window. Missing key defaults to false, preserving the
+  // batch semantics of existing models.
+  data->streaming = m["streaming"].AsBool();
+  if (data->streaming) {
+    PrimeWindowForStreaming(data->state);
+  }
 
   return data;
 }
@@ -113,7 +134,21 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
 
   TfLiteIntArray* output_size = TfLiteIntArrayCreate(2);
   int num_frames = 0;
-  if (input->dims->data[0] >= data->state->window.size) {
+  if (data->streaming) {
+    // Context stacking would require feature frames from neighboring invokes,
+    // which are not available in streaming mode.
+    TF_LITE_ENSURE_MSG(
+        context, data->left_context == 0 && data->right_context == 0,
+        "Streaming mode does not support left/right context.");
+    // The overlap buffer is primed at init time, so every window_step samples
+    // yield one frame.
+    TF_LITE_ENSURE_EQ(
+        context,
+        input->dims->data[0] % (data->state->window.step * data->frame_stride),
+        0);
+    num_frames = input->dims->data[0] / data->state->window.step /
+                 data->frame_stride;
+  } else if (input->dims->data[0] >= data->state->window.size) {
     num_frames = (input->dims->data[0] - data->state->window.size) /
                      data->state->window.step / data->frame_stride +
                  1;
@@ -134,7 +169,9 @@ void GenerateFeatures(TfLiteAudioMicrofrontendParams* data,
   T* filterbanks_flat = GetTensorData<T>(output);
 
   int num_frames = 0;
-  if (audio_size >= data->state->window.size) {
+  if (data->streaming) {
+    num_frames = audio_size / data->state->window.step;
+  } else if (audio_size >= data->state->window.size) {
     num_frames = (input->dims->data[0] - data->state->window.size) /
                      data->state->window.step +
                  1;
@@ -187,7 +224,12 @@ void GenerateFeatures(TfLiteAudioMicrofrontendParams* data,
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   auto* data =
       reinterpret_cast<TfLiteAudioMicrofrontendParams*>(node->user_data);
-  FrontendReset(data->state);
+  // In streaming mode the frontend state carries over from the previous
+  // invoke; resetting it would discard the window overlap samples and force
+  // every frame to be recomputed from a full window of input.
+  if (!data->streaming) {
+    FrontendReset(data->state);
+  }
 
   const TfLiteTensor* input;
   TF_LITE_ENSURE_OK(context, GetInputSafe(context, node, kInputTensor, &input));
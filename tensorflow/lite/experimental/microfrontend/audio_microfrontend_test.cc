@@ -38,7 +38,8 @@ class MicroFrontendOpModel : public SingleOpModel {
   MicroFrontendOpModel(int n_input, int n_frame, int n_frequency_per_frame,
                        int n_left_context, int n_right_context,
                        int n_frame_stride,
-                       const std::vector<std::vector<int>>& input_shapes)
+                       const std::vector<std::vector<int>>& input_shapes,
+                       bool streaming = false)
       : n_input_(n_input),
         n_frame_(n_frame),
         n_frequency_per_frame_(n_frequency_per_frame),
@@ -76,6 +77,7 @@ class MicroFrontendOpModel : public SingleOpModel {
       fbb.Bool("zero_padding", true);
       fbb.Int("out_scale", 1);
       fbb.Bool("out_float", false);
+      fbb.Bool("streaming", streaming);
     });
     fbb.Finish();
     SetCustomOp("MICRO_FRONTEND", fbb.GetBuffer(),
@@ -193,6 +195,37 @@ TEST_F(TwoConsecutive36InputsMicroFrontendTest, MicroFrontendBlackBoxTest) {
                 &micro_frontend);
 }
 
+TEST(StreamingMicroFrontendTest, HopSizedInvokesMatchBatchProcessing) {
+  // 20 samples of signal, processed as two 10-sample (window_step-sized)
+  // hops by a streaming model.
+  const std::vector<int16_t> signal = {0, 32767, 0, -32768, 0, 32767, 0,
+                                       -32768, 0, 32767, 0, -32768, 0, 32767,
+                                       0, -32768, 0, 32767, 0, -32768};
+
+  // Streaming primes the window overlap buffer with window_size - window_step
+  // zeros, so the batch equivalent is the signal preceded by 15 zeros.
+  std::vector<int16_t> batch_input(15, 0);
+  batch_input.insert(batch_input.end(), signal.begin(), signal.end());
+  MicroFrontendOpModel batch(35, 2, 2, 0, 0, 1, {{35}});
+  batch.SetInput(batch_input);
+  ASSERT_EQ(batch.Invoke(), kTfLiteOk);
+  const std::vector<int> batch_output = batch.GetOutput();
+
+  MicroFrontendOpModel streaming(10, 1, 2, 0, 0, 1, {{10}},
+                                 /*streaming=*/true);
+  std::vector<int> streaming_output;
+  for (int hop = 0; hop < 2; ++hop) {
+    streaming.SetInput(std::vector<int16_t>(signal.begin() + hop * 10,
+                                            signal.begin() + (hop + 1) * 10));
+    ASSERT_EQ(streaming.Invoke(), kTfLiteOk);
+    const std::vector<int> frame = streaming.GetOutput();
+    streaming_output.insert(streaming_output.end(), frame.begin(),
+                            frame.end());
+  }
+
+  EXPECT_THAT(streaming_output, ElementsAreArray(batch_output));
+}
+
 }  // namespace
 }  // namespace custom
 }  // namespace ops
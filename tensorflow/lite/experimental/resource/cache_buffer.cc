@@ -43,6 +43,8 @@ size_t CacheBuffer::GetSize() { return sizeof(float) * NumElements(dims_); }
 
 size_t CacheBuffer::GetNumEntries(int idx) const { return num_entries_[idx]; }
 
+size_t CacheBuffer::GetNumLayers() const { return dims_->data[1]; }
+
 CacheBuffer::~CacheBuffer() { TfLiteIntArrayFree(dims_); }
 
 float* CacheBuffer::GetBuffer() { return buffer_.get(); }
@@ -40,6 +40,7 @@ class CacheBuffer : public ResourceVariable {
   // Initialize tensor of a certain shape using the provided type.
   TfLiteStatus Initialize(const TfLiteIntArray &shape);
   size_t GetNumEntries(int idx) const;
+  size_t GetNumLayers() const;
   float *GetBuffer();
   size_t GetSize();
   void SetNumEntries(int idx, size_t count);
@@ -14,11 +14,65 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/lite/external_cpu_backend_context.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 #include "tensorflow/lite/core/c/common.h"
 
 namespace tflite {
 namespace {
 
+int NumHardwareThreads() {
+  const int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  // hardware_concurrency() may return 0 when it cannot be determined.
+  return num_threads > 0 ? num_threads : 1;
+}
+
+}  // namespace
+
+CpuConcurrencyArbiter* CpuConcurrencyArbiter::GetInstance() {
+  static CpuConcurrencyArbiter* instance = new CpuConcurrencyArbiter;
+  return instance;
+}
+
+void CpuConcurrencyArbiter::SetEnabled(bool enabled) {
+  std::unique_lock<std::mutex> lock(mu_);
+  enabled_ = enabled;
+}
+
+bool CpuConcurrencyArbiter::IsEnabled() const {
+  std::unique_lock<std::mutex> lock(mu_);
+  return enabled_;
+}
+
+int CpuConcurrencyArbiter::StartInvocation(int requested_threads) {
+  const int num_cores = NumHardwareThreads();
+  if (requested_threads <= 0) requested_threads = num_cores;
+  std::unique_lock<std::mutex> lock(mu_);
+  ++active_invocations_;
+  const int fair_share = std::max(1, num_cores / active_invocations_);
+  return std::min(requested_threads, fair_share);
+}
+
+void CpuConcurrencyArbiter::EndInvocation() {
+  std::unique_lock<std::mutex> lock(mu_);
+  --active_invocations_;
+}
+
+ScopedCpuConcurrencyGrant::ScopedCpuConcurrencyGrant(int requested_threads) {
+  CpuConcurrencyArbiter* arbiter = CpuConcurrencyArbiter::GetInstance();
+  if (!arbiter->IsEnabled()) return;
+  active_ = true;
+  granted_ = arbiter->StartInvocation(requested_threads);
+}
+
+ScopedCpuConcurrencyGrant::~ScopedCpuConcurrencyGrant() {
+  if (active_) CpuConcurrencyArbiter::GetInstance()->EndInvocation();
+}
+
+namespace {
+
 TfLiteStatus RefreshExternalCpuBackendContext(TfLiteContext* context) {
   auto* const external_context = static_cast<ExternalCpuBackendContext*>(
       context->GetExternalContext(context, kTfLiteCpuBackendContext));
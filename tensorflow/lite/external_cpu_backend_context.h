@@ -16,12 +16,74 @@ limitations under the License.
 #define TENSORFLOW_LITE_EXTERNAL_CPU_BACKEND_CONTEXT_H_
 
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "tensorflow/lite/core/c/common.h"
 
 namespace tflite {
 
+// Process-wide arbiter for CPU parallelism across co-resident interpreters.
+//
+// When several interpreters run on the same device, each with its own thread
+// budget sized for the whole CPU, their simultaneous invocations oversubscribe
+// the cores and thrash each other. When enabled, the arbiter tracks how many
+// invocations are in flight process-wide and grants each one a fair share of
+// the cores for its duration, so four single-model interpreters on a four-core
+// phone each run single-threaded when invoked together but still use all four
+// cores when invoked alone.
+//
+// Disabled by default; enable once at startup with
+// `CpuConcurrencyArbiter::GetInstance()->SetEnabled(true)`. Interpreters
+// consult the arbiter automatically on each Invoke via
+// ScopedCpuConcurrencyGrant; no per-interpreter wiring is needed.
+class CpuConcurrencyArbiter {
+ public:
+  static CpuConcurrencyArbiter* GetInstance();
+
+  void SetEnabled(bool enabled);
+  bool IsEnabled() const;
+
+  // Registers an in-flight invocation requesting `requested_threads` threads
+  // (-1 or 0 means "as many as the hardware offers"). Returns the granted
+  // thread budget: at least 1, never more than requested, and no more than
+  // the number of cores divided by the number of concurrent invocations.
+  // Each call must be balanced by EndInvocation.
+  int StartInvocation(int requested_threads);
+  void EndInvocation();
+
+ private:
+  CpuConcurrencyArbiter() = default;
+
+  mutable std::mutex mu_;
+  bool enabled_ = false;
+  int active_invocations_ = 0;
+
+  CpuConcurrencyArbiter(const CpuConcurrencyArbiter&) = delete;
+  CpuConcurrencyArbiter& operator=(const CpuConcurrencyArbiter&) = delete;
+};
+
+// RAII helper marking one interpreter invocation with the arbiter. When the
+// arbiter is disabled this is a no-op and active() returns false.
+class ScopedCpuConcurrencyGrant {
+ public:
+  explicit ScopedCpuConcurrencyGrant(int requested_threads);
+  ~ScopedCpuConcurrencyGrant();
+
+  bool active() const { return active_; }
+  // The arbitrated thread budget for this invocation. Only meaningful when
+  // active() is true.
+  int granted() const { return granted_; }
+
+ private:
+  bool active_ = false;
+  int granted_ = 0;
+
+  ScopedCpuConcurrencyGrant(const ScopedCpuConcurrencyGrant&) = delete;
+  ScopedCpuConcurrencyGrant& operator=(const ScopedCpuConcurrencyGrant&) =
+      delete;
+};
+
 // This is the base class for TF Lite internal backend contexts (like a
 // RUY-based cpu backend context class). A derived internal backend context is
 // generally a collection of utilities (i.e. a thread pool etc.) for TF Lite to
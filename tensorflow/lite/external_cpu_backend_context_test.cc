@@ -0,0 +1,79 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/external_cpu_backend_context.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace tflite {
+namespace {
+
+int NumCores() {
+  const int num_cores = static_cast<int>(std::thread::hardware_concurrency());
+  return num_cores > 0 ? num_cores : 1;
+}
+
+TEST(CpuConcurrencyArbiterTest, DisabledGrantIsInactive) {
+  CpuConcurrencyArbiter::GetInstance()->SetEnabled(false);
+  ScopedCpuConcurrencyGrant grant(/*requested_threads=*/4);
+  EXPECT_FALSE(grant.active());
+}
+
+TEST(CpuConcurrencyArbiterTest, SoleInvocationGetsRequestedThreads) {
+  CpuConcurrencyArbiter* arbiter = CpuConcurrencyArbiter::GetInstance();
+  arbiter->SetEnabled(true);
+  {
+    ScopedCpuConcurrencyGrant grant(/*requested_threads=*/1);
+    EXPECT_TRUE(grant.active());
+    EXPECT_EQ(grant.granted(), 1);
+  }
+  arbiter->SetEnabled(false);
+}
+
+TEST(CpuConcurrencyArbiterTest, ConcurrentInvocationsShareCores) {
+  CpuConcurrencyArbiter* arbiter = CpuConcurrencyArbiter::GetInstance();
+  arbiter->SetEnabled(true);
+  const int num_cores = NumCores();
+  {
+    ScopedCpuConcurrencyGrant first(/*requested_threads=*/-1);
+    EXPECT_TRUE(first.active());
+    EXPECT_EQ(first.granted(), num_cores);
+    ScopedCpuConcurrencyGrant second(/*requested_threads=*/-1);
+    EXPECT_TRUE(second.active());
+    EXPECT_EQ(second.granted(), std::max(1, num_cores / 2));
+  }
+  // After both grants are released, a new invocation gets everything back.
+  {
+    ScopedCpuConcurrencyGrant grant(/*requested_threads=*/-1);
+    EXPECT_EQ(grant.granted(), num_cores);
+  }
+  arbiter->SetEnabled(false);
+}
+
+TEST(CpuConcurrencyArbiterTest, GrantNeverExceedsRequest) {
+  CpuConcurrencyArbiter* arbiter = CpuConcurrencyArbiter::GetInstance();
+  arbiter->SetEnabled(true);
+  {
+    ScopedCpuConcurrencyGrant grant(/*requested_threads=*/2);
+    EXPECT_LE(grant.granted(), 2);
+    EXPECT_GE(grant.granted(), 1);
+  }
+  arbiter->SetEnabled(false);
+}
+
+}  // namespace
+}  // namespace tflite
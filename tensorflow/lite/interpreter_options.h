@@ -87,6 +87,57 @@ class InterpreterOptions {
     experimental_disable_delegate_clustering_ = value;
   }
 
+  /// Treat signature subgraphs as mutually exclusive: invoking a signature
+  /// releases the non-persistent memory arenas of the other signature
+  /// subgraphs, so at most one signature's arena is resident at a time. This
+  /// reduces the peak memory footprint of multi-signature models from the sum
+  /// of the signature arenas to the largest one, at the cost of re-allocating
+  /// the arena on each signature switch. Only enable this if signatures are
+  /// never invoked concurrently.
+  /// WARNING: This is an experimental API and subject to change.
+  void SetReleaseNonPersistentMemoryOnSignatureSwitch(bool value = true) {
+    experimental_release_memory_on_signature_switch_ = value;
+  }
+
+  /// Returns if the `experimental_release_memory_on_signature_switch_`
+  /// feature is enabled.
+  /// WARNING: This is an experimental API and subject to change.
+  bool GetReleaseNonPersistentMemoryOnSignatureSwitch() {
+    return experimental_release_memory_on_signature_switch_;
+  }
+
+  /// Which CPU cores the thread calling `Interpreter::Invoke` (or
+  /// `SignatureRunner::Invoke`) should be pinned to for the duration of the
+  /// invocation.
+  /// WARNING: This is an experimental API and subject to change.
+  enum class CpuAffinityPolicy {
+    /// Leave the invoking thread's affinity mask untouched (default).
+    kNoAffinity = 0,
+    /// Pin the invocation to the cores with the highest reported maximum
+    /// frequency. On big.LITTLE devices this keeps inference off the
+    /// efficiency cores and reduces invoke-to-invoke latency variance.
+    kPerformanceCores,
+    /// Pin the invocation to the remaining (lower-frequency) cores, trading
+    /// latency for power.
+    kEfficiencyCores,
+  };
+
+  /// Pins the invoking thread to the selected core class at the start of each
+  /// `Invoke` and restores its previous affinity mask on return. CPU kernel
+  /// worker threads inherit the invoking thread's mask when they are created,
+  /// so they follow the policy as well. Only effective on Linux and Android,
+  /// and only on CPUs with asymmetric cores; a no-op everywhere else.
+  /// WARNING: This is an experimental API and subject to change.
+  void SetInvokeCpuAffinityPolicy(CpuAffinityPolicy policy) {
+    experimental_invoke_cpu_affinity_policy_ = policy;
+  }
+
+  /// Returns the configured invoke CPU affinity policy.
+  /// WARNING: This is an experimental API and subject to change.
+  CpuAffinityPolicy GetInvokeCpuAffinityPolicy() const {
+    return experimental_invoke_cpu_affinity_policy_;
+  }
+
   // If set to `true`, the CAST op will cache its output when its input is a
   // constant tensor.
   //
@@ -108,6 +159,9 @@ class InterpreterOptions {
   bool experimental_ensure_dynamic_tensors_are_released_ = false;
   int experimental_optimize_memory_for_large_tensors_ = 0;
   bool experimental_disable_delegate_clustering_ = false;
+  bool experimental_release_memory_on_signature_switch_ = false;
+  CpuAffinityPolicy experimental_invoke_cpu_affinity_policy_ =
+      CpuAffinityPolicy::kNoAffinity;
   bool experimental_cache_constant_cast_op_ = false;
 };
 
@@ -260,7 +260,7 @@ void EvalAdd(TfLiteContext* context, TfLiteNode* node, TfLiteAddParams* params,
       }
     } else {
       if (need_broadcast) {
-        TF_LITE_ADD(optimized_ops, BroadcastAdd6DSlow, int32_t);
+        TF_LITE_ADD(optimized_ops, BroadcastAddDispatch, int32_t);
       } else {
         TF_LITE_ADD(optimized_ops, Add, int32_t);
       }
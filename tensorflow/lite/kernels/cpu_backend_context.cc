@@ -147,6 +147,17 @@ void CpuBackendContext::SetMaxNumThreads(int max_num_threads) {
   max_num_threads_ = target_num_threads;
   ruy_context_->set_max_num_threads(target_num_threads);
   gemmlowp_context_->set_max_num_threads(target_num_threads);
+#ifdef TFLITE_KERNEL_USE_XNNPACK
+  // pthreadpool cannot be resized in place; drop an existing pool with the
+  // wrong size so the next get_xnnpack_threadpool() call recreates it with
+  // the new thread count. Like the rest of this function, this must not be
+  // called while an invocation using the pool is in flight.
+  if (xnnpack_threadpool_ &&
+      pthreadpool_get_threads_count(xnnpack_threadpool_.get()) !=
+          static_cast<size_t>(target_num_threads)) {
+    xnnpack_threadpool_.reset();
+  }
+#endif
 }
 
 void CpuBackendContext::SetUseCaching(bool flag) { use_caching_ = flag; }
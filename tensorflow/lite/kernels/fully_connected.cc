@@ -1586,6 +1586,17 @@ TfLiteStatus EvalFloat(TfLiteContext* context, TfLiteNode* node,
             bias_shape, GetTensorData<float>(bias),      // Disable formatting
             output_shape, GetTensorData<float>(output),
             CpuBackendContext::GetFromContext(context));
+      } else if (sparsity.dim_metadata_size == kDimMetadataSizeBlockSparse &&
+                 sparsity.dim_metadata[2].dense_size > 0 &&
+                 sparsity.dim_metadata[2].dense_size % 4 == 0) {
+        // Block sparse with a wider 1xN block, N a multiple of 4.
+        optimized_ops::FullyConnectedSparseWeightBlocked(
+            sparsity, op_params,                         // Disable formatting
+            input_shape, GetTensorData<float>(input),    // Disable formatting
+            filter_shape, GetTensorData<float>(filter),  // Disable formatting
+            bias_shape, GetTensorData<float>(bias),      // Disable formatting
+            output_shape, GetTensorData<float>(output),
+            CpuBackendContext::GetFromContext(context));
       } else {
         TF_LITE_KERNEL_LOG(context,
                            "Unsupported sparse fully-connected weight format.");
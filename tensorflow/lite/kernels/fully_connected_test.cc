@@ -2150,6 +2150,70 @@ TEST_P(SparseFullyConnectedOpTest, Simple1x4TestMultiThreadedMoreBatches) {
   }
 }
 
+TEST_P(SparseFullyConnectedOpTest, Simple1x8Test) {
+  std::initializer_list<float> weight_data = {
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 0
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 1
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 2
+  };
+  TensorData weight = {};
+  weight.type = TensorType_FLOAT32;
+  weight.shape = {3, 16};
+  weight.traversal_order = {0, 1, 2};
+  weight.format = {kTfLiteDimDense, kTfLiteDimSparseCSR};
+  weight.block_map = {1};
+  weight.block_size = {8};
+  SparseFullyConnectedOpModel<float> m(GetRegistration(),
+                                       /*units=*/3, /*batches=*/2,
+                                       /*input=*/{TensorType_FLOAT32, {2, 16}},
+                                       weight, weight_data);
+  m.SetBias({1, 2, 3});
+
+  m.SetInput({
+      1, 2, 3, 4, 5, 6, 7, 8,  9, 10,  11,  12, 13, 14,  15, 16,   // b = 0
+      1, 2, 3, 4, 5, 6, 7, -8, 9, -10, -11, 12, 13, -14, 15, -16,  // b = 1
+  });
+
+  ASSERT_EQ(m.Invoke(), kTfLiteOk);
+
+  EXPECT_THAT(m.GetOutputShape(), ElementsAre(2, 3));
+  EXPECT_THAT(m.GetOutput(), ElementsAre(1497, 1498, 1499, 23, 24, 25));
+}
+
+TEST_P(SparseFullyConnectedOpTest, Simple1x8TestMultiThreaded) {
+  std::initializer_list<float> weight_data = {
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 0
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 1
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,  // u = 2
+  };
+  TensorData weight = {};
+  weight.type = TensorType_FLOAT32;
+  weight.shape = {3, 16};
+  weight.traversal_order = {0, 1, 2};
+  weight.format = {kTfLiteDimDense, kTfLiteDimSparseCSR};
+  weight.block_map = {1};
+  weight.block_size = {8};
+  for (int num_threads = 1; num_threads <= 4; num_threads++) {
+    SparseFullyConnectedOpModel<float> m(
+        GetRegistration(),
+        /*units=*/3, /*batches=*/2,
+        /*input=*/{TensorType_FLOAT32, {2, 16}}, weight, weight_data,
+        /*output=*/{TensorType_FLOAT32},
+        /*bias_tensor_optional=*/false, /*num_threads=*/num_threads);
+    m.SetBias({1, 2, 3});
+
+    m.SetInput({
+        1, 2, 3, 4, 5, 6, 7, 8,  9, 10,  11,  12, 13, 14,  15, 16,   // b = 0
+        1, 2, 3, 4, 5, 6, 7, -8, 9, -10, -11, 12, 13, -14, 15, -16,  // b = 1
+    });
+
+    ASSERT_EQ(m.Invoke(), kTfLiteOk);
+
+    EXPECT_THAT(m.GetOutputShape(), ElementsAre(2, 3));
+    EXPECT_THAT(m.GetOutput(), ElementsAre(1497, 1498, 1499, 23, 24, 25));
+  }
+}
+
 TEST_P(SparseHybridFullyConnectedOpTest, SparseHybrid1x16Test) {
   std::initializer_list<float> weight_data = {
       /* 1st row */
@@ -1961,6 +1961,38 @@ void NeonSparseMatrixBatchVectorMultiplyAccumulate1x4(
   }
 }
 
+void NeonSparseMatrixBatchVectorMultiplyAccumulateBlocked(
+    const float* __restrict__ matrix, const int32_t* __restrict__ segments,
+    const int32_t* __restrict__ indices, int m_rows, int m_cols, int block_size,
+    const float* __restrict__ vector, int n_batch, float* __restrict__ result) {
+  TFLITE_DCHECK_GT(block_size, 0);
+  TFLITE_DCHECK_EQ(block_size % kFloatValuesPerNeonVector, 0);
+  TFLITE_DCHECK_EQ(m_cols % block_size, 0);
+
+  for (int batch = 0; batch < n_batch; batch++) {
+    const float* matrix_ptr = matrix;
+    for (int row = 0; row < m_rows; row++) {
+      float32x4_t acc_32x4 = vmovq_n_f32(0.0);
+      const float* vector_in_batch = vector + batch * m_cols;
+
+      for (int i = segments[row]; i < segments[row + 1]; i++) {
+        const int block_start_index = indices[i] * block_size;
+        const float* vector_block_in_batch_ptr =
+            vector_in_batch + block_start_index;
+
+        // Process the block 4 float values at a time.
+        for (int c = 0; c < block_size; c += kFloatValuesPerNeonVector) {
+          float32x4_t vector_f32x4 = vld1q_f32(vector_block_in_batch_ptr + c);
+          float32x4_t matrix_f32x4 = vld1q_f32(matrix_ptr);
+          acc_32x4 = vmlaq_f32(acc_32x4, matrix_f32x4, vector_f32x4);
+          matrix_ptr += kFloatValuesPerNeonVector;
+        }
+      }
+      result[batch * m_rows + row] += AccumulateNeonLane(acc_32x4);
+    }
+  }
+}
+
 void NeonSparseMatrixBatchVectorMultiplyAccumulate1x16(
     const int8_t* __restrict__ matrix, const int32_t* __restrict__ segments,
     const int32_t* __restrict__ indices, int m_rows, int m_cols,
@@ -71,6 +71,15 @@ void SparseMatrixBatchVectorMultiplyAccumulate1x4(
                    segments, indices, m_rows, m_cols, vector, n_batch, result);
 }
 
+void SparseMatrixBatchVectorMultiplyAccumulateBlocked(
+    const float* __restrict__ matrix, const int32_t* __restrict__ segments,
+    const int32_t* __restrict__ indices, int m_rows, int m_cols, int block_size,
+    const float* __restrict__ vector, int n_batch, float* __restrict__ result) {
+  NEON_OR_PORTABLE(SparseMatrixBatchVectorMultiplyAccumulateBlocked, matrix,
+                   segments, indices, m_rows, m_cols, block_size, vector,
+                   n_batch, result);
+}
+
 void SparseMatrixBatchVectorMultiplyAccumulate(
     const float* __restrict__ matrix, const uint8_t* __restrict__ ledger,
     int m_rows, int m_cols, const float* __restrict__ vector, int n_batch,
@@ -1521,6 +1521,60 @@ inline void AddElementwise(int size, const ArithmeticParams& params,
   }
 }
 
+inline void AddElementwise(int size, const ArithmeticParams& params,
+                           const int32_t* __restrict input1_data,
+                           const int32_t* __restrict input2_data,
+                           int32_t* __restrict output_data) {
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+
+  int i = 0;
+#ifdef USE_NEON
+  const int32x4_t activation_min_vec = vdupq_n_s32(activation_min);
+  const int32x4_t activation_max_vec = vdupq_n_s32(activation_max);
+  for (; i <= size - 16; i += 16) {
+    const int32x4_t a10 = vld1q_s32(input1_data + i);
+    const int32x4_t a11 = vld1q_s32(input1_data + i + 4);
+    const int32x4_t a12 = vld1q_s32(input1_data + i + 8);
+    const int32x4_t a13 = vld1q_s32(input1_data + i + 12);
+    const int32x4_t a20 = vld1q_s32(input2_data + i);
+    const int32x4_t a21 = vld1q_s32(input2_data + i + 4);
+    const int32x4_t a22 = vld1q_s32(input2_data + i + 8);
+    const int32x4_t a23 = vld1q_s32(input2_data + i + 12);
+    int32x4_t x0 = vaddq_s32(a10, a20);
+    int32x4_t x1 = vaddq_s32(a11, a21);
+    int32x4_t x2 = vaddq_s32(a12, a22);
+    int32x4_t x3 = vaddq_s32(a13, a23);
+    x0 = vmaxq_s32(activation_min_vec, x0);
+    x1 = vmaxq_s32(activation_min_vec, x1);
+    x2 = vmaxq_s32(activation_min_vec, x2);
+    x3 = vmaxq_s32(activation_min_vec, x3);
+    x0 = vminq_s32(activation_max_vec, x0);
+    x1 = vminq_s32(activation_max_vec, x1);
+    x2 = vminq_s32(activation_max_vec, x2);
+    x3 = vminq_s32(activation_max_vec, x3);
+    vst1q_s32(output_data + i, x0);
+    vst1q_s32(output_data + i + 4, x1);
+    vst1q_s32(output_data + i + 8, x2);
+    vst1q_s32(output_data + i + 12, x3);
+  }
+  for (; i <= size - 4; i += 4) {
+    const int32x4_t a1 = vld1q_s32(input1_data + i);
+    const int32x4_t a2 = vld1q_s32(input2_data + i);
+    int32x4_t x = vaddq_s32(a1, a2);
+    x = vmaxq_s32(activation_min_vec, x);
+    x = vminq_s32(activation_max_vec, x);
+    vst1q_s32(output_data + i, x);
+  }
+#endif  // NEON
+
+  for (; i < size; ++i) {
+    const int32_t x = input1_data[i] + input2_data[i];
+    output_data[i] =
+        ActivationFunctionWithMinMax(x, activation_min, activation_max);
+  }
+}
+
 inline void Add(const ArithmeticParams& params,
                 const RuntimeShape& input1_shape, const float* input1_data,
                 const RuntimeShape& input2_shape, const float* input2_data,
@@ -1758,6 +1812,37 @@ inline void AddScalarBroadcast(int size, const ArithmeticParams& params,
   }
 }
 
+// Scalar-broadcast add that can be used for inner loop of more general
+// broadcast add, so that, for example, scalar-broadcast with batch will still
+// be fast.
+inline void AddScalarBroadcast(int size, const ArithmeticParams& params,
+                               int32_t broadcast_value,
+                               const int32_t* input2_data,
+                               int32_t* output_data) {
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+
+  int i = 0;
+#ifdef USE_NEON
+  const int32x4_t activation_min_vec = vdupq_n_s32(activation_min);
+  const int32x4_t activation_max_vec = vdupq_n_s32(activation_max);
+  const int32x4_t broadcast_value_dup = vdupq_n_s32(broadcast_value);
+  for (; i <= size - 4; i += 4) {
+    const int32x4_t input2_val = vld1q_s32(input2_data + i);
+    int32x4_t x = vaddq_s32(input2_val, broadcast_value_dup);
+    x = vmaxq_s32(activation_min_vec, x);
+    x = vminq_s32(activation_max_vec, x);
+    vst1q_s32(output_data + i, x);
+  }
+#endif  // NEON
+
+  for (; i < size; ++i) {
+    const int32_t x = broadcast_value + input2_data[i];
+    output_data[i] =
+        ActivationFunctionWithMinMax(x, activation_min, activation_max);
+  }
+}
+
 inline void Add(const ArithmeticParams& params,
                 const RuntimeShape& input1_shape, const uint8_t* input1_data,
                 const RuntimeShape& input2_shape, const uint8_t* input2_data,
@@ -2285,6 +2370,36 @@ inline void MulSimpleBroadcast(int size, const ArithmeticParams& params,
   }
 }
 
+// Broadcast mul that can often be used for inner loop of broadcast Mul.
+// This function will handle scalar_value (LHS) * vector_values (RHS).
+inline void MulSimpleBroadcast(int size, const ArithmeticParams& params,
+                               const int32_t broadcast_value,
+                               const int32_t* input2_data,
+                               int32_t* output_data) {
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+
+  int i = 0;
+#ifdef USE_NEON
+  const int32x4_t activation_min_vec = vdupq_n_s32(activation_min);
+  const int32x4_t activation_max_vec = vdupq_n_s32(activation_max);
+  const int32x4_t broadcast_value_dup = vdupq_n_s32(broadcast_value);
+  for (; i <= size - 4; i += 4) {
+    const int32x4_t input2_val = vld1q_s32(input2_data + i);
+    int32x4_t x = vmulq_s32(input2_val, broadcast_value_dup);
+    x = vmaxq_s32(activation_min_vec, x);
+    x = vminq_s32(activation_max_vec, x);
+    vst1q_s32(output_data + i, x);
+  }
+#endif  // NEON
+
+  for (; i < size; ++i) {
+    const int32_t x = broadcast_value * input2_data[i];
+    output_data[i] =
+        ActivationFunctionWithMinMax(x, activation_min, activation_max);
+  }
+}
+
 inline void Mul(const ArithmeticParams& params,
                 const RuntimeShape& input1_shape, const uint8_t* input1_data,
                 const RuntimeShape& input2_shape, const uint8_t* input2_data,
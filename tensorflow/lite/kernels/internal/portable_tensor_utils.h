@@ -193,6 +193,16 @@ void SparseMatrixBatchVectorMultiplyAccumulate1x4(
     const int32_t* __restrict__ indices, int m_rows, int m_cols,
     const float* __restrict__ vector, int n_batch, float* __restrict__ result);
 
+// Same as the function above, but for an arbitrary block width `block_size`,
+// which must be a positive multiple of 4. Covers models pruned with wider
+// blocks (e.g. 1x8 or 1x16 float weights).
+// This function assumes that m_cols is a multiple of `block_size` so that
+// there's no incomplete block.
+void SparseMatrixBatchVectorMultiplyAccumulateBlocked(
+    const float* __restrict__ matrix, const int32_t* __restrict__ segments,
+    const int32_t* __restrict__ indices, int m_rows, int m_cols, int block_size,
+    const float* __restrict__ vector, int n_batch, float* __restrict__ result);
+
 // Same as the function above, but the matrix is stored in block compressed
 // sparse row format with block pattern 1x16 which consists of two arrays:
 //   1. A matrix array stores non-zero blocks of the matrix in row major.
@@ -95,6 +95,19 @@ struct IntegerLstmParameter {
   int32_t intermediate_zp[12];
 };
 
+// The LSTM kernels below implement the same fused gate computation at
+// different quantization levels. Which one runs is decided by the tensor types
+// produced by the converter:
+// - EvalFloat: float weights, activations and state.
+// - EvalHybrid: int8 weights with float activations and state
+//   (weights-only/"dynamic range" quantization). Activations and output state
+//   are re-quantized before every gate matmul and the gate math itself is
+//   float, so this path still pays float conversion costs on every step.
+// - EvalInteger8x8_16 / EvalInteger8x8_8: fully-integer paths with int8
+//   activations and state, int16 cell state and gate scratch, and no float
+//   anywhere in the step function. Models get here by being converted with
+//   full integer quantization (representative dataset), not weights-only
+//   quantization.
 TfLiteStatus EvalFloat(
     const TfLiteTensor* input, const TfLiteTensor* input_to_input_weights,
     const TfLiteTensor* input_to_forget_weights,
@@ -165,7 +165,7 @@ void EvalMul(TfLiteContext* context, TfLiteNode* node, TfLiteMulParams* params,
       }
     } else {
       if (need_broadcast) {
-        TF_LITE_MUL(optimized_ops, BroadcastMul6DSlow, int32_t);
+        TF_LITE_MUL(optimized_ops, BroadcastMulDispatch, int32_t);
       } else {
         TF_LITE_MUL(optimized_ops, Mul, int32_t);
       }
@@ -0,0 +1,147 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#include "tensorflow/lite/profiling/perf_counter_info.h"
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace tflite {
+namespace profiling {
+namespace perf_counters {
+
+namespace {
+
+std::atomic<bool> capture_enabled{false};
+
+#ifdef __linux__
+
+int OpenCounter(uint64_t config, int group_fd) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Counting the calling thread only, on any CPU it migrates to.
+  return syscall(__NR_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1, group_fd,
+                 /*flags=*/0);
+}
+
+// Holds one perf event group (cycles, instructions, cache misses) counting
+// the owning thread. Thread-local so that concurrent interpreter threads
+// each read their own counters without synchronization.
+class ThreadPerfCounters {
+ public:
+  static ThreadPerfCounters& Instance() {
+    static thread_local ThreadPerfCounters counters;
+    return counters;
+  }
+
+  PerfCounterValues Read() {
+    PerfCounterValues values;
+    if (group_fd_ < 0) return values;
+    // PERF_FORMAT_GROUP layout: nr followed by one value per counter, in the
+    // order the counters were attached to the group.
+    struct {
+      uint64_t nr;
+      uint64_t values[3];
+    } data;
+    if (read(group_fd_, &data, sizeof(data)) != sizeof(data) ||
+        data.nr != 3) {
+      return values;
+    }
+    values.cpu_cycles = data.values[0];
+    values.instructions = data.values[1];
+    values.cache_misses = data.values[2];
+    return values;
+  }
+
+ private:
+  ThreadPerfCounters() {
+    group_fd_ = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, /*group_fd=*/-1);
+    if (group_fd_ < 0) return;
+    instructions_fd_ = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, group_fd_);
+    cache_misses_fd_ = OpenCounter(PERF_COUNT_HW_CACHE_MISSES, group_fd_);
+    if (instructions_fd_ < 0 || cache_misses_fd_ < 0) {
+      Close();
+      return;
+    }
+    ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  ~ThreadPerfCounters() { Close(); }
+
+  void Close() {
+    if (cache_misses_fd_ >= 0) close(cache_misses_fd_);
+    if (instructions_fd_ >= 0) close(instructions_fd_);
+    if (group_fd_ >= 0) close(group_fd_);
+    group_fd_ = instructions_fd_ = cache_misses_fd_ = -1;
+  }
+
+  int group_fd_ = -1;
+  int instructions_fd_ = -1;
+  int cache_misses_fd_ = -1;
+};
+
+#endif  // __linux__
+
+}  // namespace
+
+bool PerfCounterValues::IsSupported() {
+#ifdef __linux__
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SetPerfCounterCaptureEnabled(bool enabled) {
+  capture_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool PerfCounterCaptureEnabled() {
+  return capture_enabled.load(std::memory_order_relaxed);
+}
+
+PerfCounterValues GetPerfCounterValues() {
+#ifdef __linux__
+  if (PerfCounterCaptureEnabled()) {
+    return ThreadPerfCounters::Instance().Read();
+  }
+#endif
+  return PerfCounterValues();
+}
+
+void PerfCounterValues::AllStatsToStream(std::ostream* stream) const {
+  *stream << "cpu_cycles=" << cpu_cycles << " instructions=" << instructions
+          << " cache_misses=" << cache_misses;
+}
+
+}  // namespace perf_counters
+}  // namespace profiling
+}  // namespace tflite
@@ -0,0 +1,94 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_PROFILING_PERF_COUNTER_INFO_H_
+#define TENSORFLOW_LITE_PROFILING_PERF_COUNTER_INFO_H_
+
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+
+namespace tflite {
+namespace profiling {
+namespace perf_counters {
+
+struct PerfCounterValues {
+  // Indicates whether reading hardware performance counters is supported on
+  // the platform (currently Linux/Android via perf_event_open), thus
+  // indicating whether the values defined in this struct make sense or not.
+  // Note that even on supported platforms counter access may be denied at
+  // runtime (e.g. by perf_event_paranoid or seccomp policies), in which case
+  // reads return all-zero values.
+  static bool IsSupported();
+
+  PerfCounterValues() : cpu_cycles(0), instructions(0), cache_misses(0) {}
+
+  // CPU cycles consumed by the calling thread
+  // (PERF_COUNT_HW_CPU_CYCLES).
+  uint64_t cpu_cycles;
+
+  // Instructions retired by the calling thread
+  // (PERF_COUNT_HW_INSTRUCTIONS).
+  uint64_t instructions;
+
+  // Last-level cache misses incurred by the calling thread
+  // (PERF_COUNT_HW_CACHE_MISSES).
+  uint64_t cache_misses;
+
+  PerfCounterValues operator+(PerfCounterValues const& obj) const {
+    PerfCounterValues res;
+    res.cpu_cycles = cpu_cycles + obj.cpu_cycles;
+    res.instructions = instructions + obj.instructions;
+    res.cache_misses = cache_misses + obj.cache_misses;
+    return res;
+  }
+
+  PerfCounterValues operator-(PerfCounterValues const& obj) const {
+    PerfCounterValues res;
+    res.cpu_cycles = cpu_cycles - obj.cpu_cycles;
+    res.instructions = instructions - obj.instructions;
+    res.cache_misses = cache_misses - obj.cache_misses;
+    return res;
+  }
+
+  void AllStatsToStream(std::ostream* stream) const;
+
+  friend std::ostream& operator<<(std::ostream& stream,
+                                  const PerfCounterValues& obj) {
+    obj.AllStatsToStream(&stream);
+    return stream;
+  }
+};
+
+// Enables or disables performance counter capture for the calling process.
+// Capture is disabled by default because opening the counters has a
+// per-thread cost and may require elevated privileges; benchmark harnesses
+// that want per-op counter statistics should enable it before the first
+// profiled invocation.
+void SetPerfCounterCaptureEnabled(bool enabled);
+
+// Returns whether performance counter capture has been enabled via
+// SetPerfCounterCaptureEnabled.
+bool PerfCounterCaptureEnabled();
+
+// Returns the current performance counter readings of the calling thread.
+// Returns all-zero values if capture is disabled, unsupported on the platform
+// or denied at runtime.
+PerfCounterValues GetPerfCounterValues();
+
+}  // namespace perf_counters
+}  // namespace profiling
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_PROFILING_PERF_COUNTER_INFO_H_
@@ -20,6 +20,7 @@ limitations under the License.
 #include "tensorflow/lite/logger.h"
 #include "tensorflow/lite/minimal_logging.h"
 #include "tensorflow/lite/profiling/memory_info.h"
+#include "tensorflow/lite/profiling/perf_counter_info.h"
 #include "tensorflow/lite/profiling/time.h"
 
 namespace tflite {
@@ -46,6 +47,9 @@ uint32_t ProfileBuffer::BeginEvent(const char* tag,
   event_buffer_[index].elapsed_time = 0;
   if (event_type != Profiler::EventType::OPERATOR_INVOKE_EVENT) {
     event_buffer_[index].begin_mem_usage = memory::GetMemoryUsage();
+  } else {
+    event_buffer_[index].begin_perf_counters =
+        perf_counters::GetPerfCounterValues();
   }
   current_index_++;
   return index;
@@ -70,6 +74,9 @@ void ProfileBuffer::EndEvent(uint32_t event_handle,
   if (event_buffer_[event_index].event_type !=
       Profiler::EventType::OPERATOR_INVOKE_EVENT) {
     event_buffer_[event_index].end_mem_usage = memory::GetMemoryUsage();
+  } else {
+    event_buffer_[event_index].end_perf_counters =
+        perf_counters::GetPerfCounterValues();
   }
   if (event_metadata1) {
     event_buffer_[event_index].event_metadata = *event_metadata1;
@@ -24,6 +24,7 @@ limitations under the License.
 
 #include "tensorflow/lite/core/api/profiler.h"
 #include "tensorflow/lite/profiling/memory_info.h"
+#include "tensorflow/lite/profiling/perf_counter_info.h"
 #include "tensorflow/lite/profiling/time.h"
 
 namespace tflite {
@@ -50,6 +51,13 @@ struct ProfileEvent {
   // The memory usage when the event ends.
   memory::MemoryUsage end_mem_usage;
 
+  // The hardware performance counter readings when the event begins and ends.
+  // Only captured for OPERATOR_INVOKE_EVENT events, and only when capture has
+  // been enabled via perf_counters::SetPerfCounterCaptureEnabled; all-zero
+  // otherwise.
+  perf_counters::PerfCounterValues begin_perf_counters;
+  perf_counters::PerfCounterValues end_perf_counters;
+
   // The field containing the type of event. This must be one of the event types
   // in EventType.
   EventType event_type;
@@ -144,6 +144,15 @@ void ProfileSummarizer::ProcessProfiles(
 
       stats_calculator->AddNodeStats(node_name_in_stats, type_in_stats,
                                      node_num, node_exec_time, 0 /*memory */);
+
+      const perf_counters::PerfCounterValues node_perf_counters =
+          event->end_perf_counters - event->begin_perf_counters;
+      if (node_perf_counters.cpu_cycles != 0 ||
+          node_perf_counters.instructions != 0) {
+        auto& accumulated =
+            per_op_perf_counters_map_[subgraph_index][node_name_in_stats];
+        accumulated = accumulated + node_perf_counters;
+      }
     } else if (event->event_type ==
                Profiler::EventType::DELEGATE_OPERATOR_INVOKE_EVENT) {
       const std::string node_name(event->tag);
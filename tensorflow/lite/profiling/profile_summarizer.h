@@ -24,6 +24,7 @@ limitations under the License.
 
 #include "tensorflow/core/util/stats_calculator.h"
 #include "tensorflow/lite/core/interpreter.h"
+#include "tensorflow/lite/profiling/perf_counter_info.h"
 #include "tensorflow/lite/profiling/profile_buffer.h"
 #include "tensorflow/lite/profiling/profile_summary_formatter.h"
 
@@ -56,6 +57,17 @@ class ProfileSummarizer {
 
   tensorflow::StatsCalculator* GetStatsCalculator(uint32_t subgraph_index);
 
+  // Returns the accumulated hardware performance counter readings per node of
+  // the given subgraph, keyed by the same node name used in the stats above.
+  // The map is empty unless counter capture was enabled via
+  // perf_counters::SetPerfCounterCaptureEnabled before the profiled
+  // invocations. Callers can combine these with tensor shapes to derive
+  // per-op operational intensity.
+  const std::map<std::string, perf_counters::PerfCounterValues>&
+  GetPerOpPerfCounters(uint32_t subgraph_index) {
+    return per_op_perf_counters_map_[subgraph_index];
+  }
+
   bool HasProfiles() {
     for (auto& stats_calc : stats_calculator_map_) {
       auto subgraph_stats = stats_calc.second.get();
@@ -71,6 +83,11 @@ class ProfileSummarizer {
 
   std::unique_ptr<tensorflow::StatsCalculator> delegate_stats_calculator_;
 
+  // Map storing accumulated per-node performance counter readings per
+  // subgraph.
+  std::map<uint32_t, std::map<std::string, perf_counters::PerfCounterValues>>
+      per_op_perf_counters_map_;
+
   // Summary formatter for customized output formats.
   std::shared_ptr<ProfileSummaryFormatter> summary_formatter_;
 
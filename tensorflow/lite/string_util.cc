@@ -17,9 +17,13 @@ limitations under the License.
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "tensorflow/compiler/mlir/lite/utils/string_utils.h"
@@ -95,4 +99,130 @@ void DynamicBuffer::WriteToTensor(TfLiteTensor* tensor,
 }
 #endif  // TF_LITE_STATIC_MEMORY
 
+void ChunkedDynamicBuffer::AppendBytes(const char* str, size_t len) {
+  while (len > 0) {
+    if (chunks_.empty() || chunks_.back().size == chunks_.back().capacity) {
+      Chunk chunk;
+      chunk.capacity = chunk_bytes_;
+      chunk.data = std::make_unique<char[]>(chunk.capacity);
+      chunks_.push_back(std::move(chunk));
+    }
+    Chunk& chunk = chunks_.back();
+    const size_t n = std::min(len, chunk.capacity - chunk.size);
+    memcpy(chunk.data.get() + chunk.size, str, n);
+    chunk.size += n;
+    str += n;
+    len -= n;
+  }
+}
+
+TfLiteStatus ChunkedDynamicBuffer::AddString(const StringRef& string) {
+  return AddString(string.str, string.len);
+}
+
+TfLiteStatus ChunkedDynamicBuffer::AddString(const char* str, size_t len) {
+  if (len > max_length_ || offset_.back() >= max_length_ - len) {
+    return kTfLiteError;
+  }
+  AppendBytes(str, len);
+  offset_.push_back(offset_.back() + len);
+  return kTfLiteOk;
+}
+
+TfLiteStatus ChunkedDynamicBuffer::AddStrings(
+    const std::vector<StringRef>& strings) {
+  offset_.reserve(offset_.size() + strings.size());
+  for (const StringRef& ref : strings) {
+    if (AddString(ref.str, ref.len) != kTfLiteOk) {
+      return kTfLiteError;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus ChunkedDynamicBuffer::AddJoinedString(
+    const std::vector<StringRef>& strings, char separator) {
+  StringRef ref;
+  ref.str = &separator;
+  ref.len = 1;
+  return AddJoinedString(strings, ref);
+}
+
+TfLiteStatus ChunkedDynamicBuffer::AddJoinedString(
+    const std::vector<StringRef>& strings, StringRef separator) {
+  size_t total_len = strings.empty() ? 0 : (strings.size() - 1) * separator.len;
+  for (const StringRef& ref : strings) {
+    total_len += ref.len;
+  }
+  if (total_len > max_length_ || offset_.back() >= max_length_ - total_len) {
+    return kTfLiteError;
+  }
+  for (size_t i = 0; i < strings.size(); ++i) {
+    // Fill separator if not first string.
+    if (i != 0) {
+      AppendBytes(separator.str, separator.len);
+    }
+    AppendBytes(strings[i].str, strings[i].len);
+  }
+  offset_.push_back(offset_.back() + total_len);
+  return kTfLiteOk;
+}
+
+int ChunkedDynamicBuffer::WriteToBuffer(char** buffer) {
+  // The layout written here matches SimpleDynamicBuffer::WriteToBuffer, but
+  // the string contents are copied chunk by chunk in a single pass.
+  int32_t num_strings = offset_.size() - 1;
+  const size_t data_size = offset_.back();
+  int32_t bytes = data_size                               // size of content
+                  + sizeof(int32_t) * (num_strings + 2);  // size of header
+  // Caller will take ownership of buffer.
+  *buffer = reinterpret_cast<char*>(malloc(bytes));
+  if (*buffer == nullptr) {
+    return -1;
+  }
+
+  // NOTE: The string buffer is accessed here as if it's native endian (instead
+  // of small endian, as documented in the header). This will potentially break
+  // when TFLite is ported to big endian platforms.
+  memcpy(*buffer, &num_strings, sizeof(int32_t));
+
+  // Set offset of strings.
+  int32_t start = sizeof(int32_t) * (num_strings + 2);
+  for (size_t i = 0; i < offset_.size(); i++) {
+    int32_t offset = start + offset_[i];
+    memcpy(*buffer + sizeof(int32_t) * (i + 1), &offset, sizeof(int32_t));
+  }
+
+  // Copy data of strings.
+  char* dst = *buffer + start;
+  for (const Chunk& chunk : chunks_) {
+    memcpy(dst, chunk.data.get(), chunk.size);
+    dst += chunk.size;
+  }
+  return bytes;
+}
+
+#ifndef TF_LITE_STATIC_MEMORY
+void ChunkedDynamicBuffer::WriteToTensorAsVector(TfLiteTensor* tensor) {
+  auto dims = TfLiteIntArrayCreate(1);
+  dims->data[0] = offset_.size() - 1;  // Store number of strings.
+  WriteToTensor(tensor, dims);
+}
+
+void ChunkedDynamicBuffer::WriteToTensor(TfLiteTensor* tensor,
+                                         TfLiteIntArray* new_shape) {
+  char* tensor_buffer;
+  int bytes = WriteToBuffer(&tensor_buffer);
+
+  if (new_shape == nullptr) {
+    new_shape = TfLiteIntArrayCopy(tensor->dims);
+  }
+
+  // Set tensor content pointer to tensor_buffer, and release original data.
+  TfLiteTensorReset(tensor->type, tensor->name, new_shape, tensor->params,
+                    tensor_buffer, bytes, kTfLiteDynamic, tensor->allocation,
+                    tensor->is_variable, tensor);
+}
+#endif  // TF_LITE_STATIC_MEMORY
+
 }  // namespace tflite
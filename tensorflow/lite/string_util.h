@@ -43,6 +43,7 @@ limitations under the License.
 
 #include <stddef.h>
 
+#include <memory>
 #include <vector>
 
 #include "tensorflow/compiler/mlir/lite/utils/string_utils.h"
@@ -86,6 +87,73 @@ class DynamicBuffer : public mlir::TFL::SimpleDynamicBuffer {
   void WriteToTensorAsVector(TfLiteTensor* tensor);
 };
 
+// ChunkedDynamicBuffer is an alternative to DynamicBuffer for building large
+// string tensors. Added strings are copied into a rope of fixed-size chunks,
+// so the buffer never relocates previously added content when it grows;
+// adding N bytes of strings performs O(N) work regardless of how many strings
+// are added. The string tensor layout is produced in a single pass in
+// WriteToBuffer()/WriteToTensor(). Prefer this over DynamicBuffer when
+// building tensors out of many strings (e.g. tokenizer output), where
+// DynamicBuffer's backing vector re-copies all existing content every time it
+// grows.
+class ChunkedDynamicBuffer {
+ public:
+  static constexpr size_t kDefaultChunkBytes = 1 << 16;
+
+  explicit ChunkedDynamicBuffer(size_t max_length = kDefaultMaxLength,
+                                size_t chunk_bytes = kDefaultChunkBytes)
+      : offset_({0}),
+        chunk_bytes_(chunk_bytes == 0 ? 1 : chunk_bytes),
+        max_length_(max_length) {}
+
+  // Add a string by copying the data into the chunked buffer.
+  TfLiteStatus AddString(const StringRef& string);
+  TfLiteStatus AddString(const char* str, size_t len);
+
+  // Add a batch of strings. Equivalent to calling AddString on every element,
+  // but reserves the offset bookkeeping for the whole batch up front.
+  TfLiteStatus AddStrings(const std::vector<StringRef>& strings);
+
+  // Join a list of strings with separator, and add as a single string to the
+  // buffer.
+  TfLiteStatus AddJoinedString(const std::vector<StringRef>& strings,
+                               char separator);
+  TfLiteStatus AddJoinedString(const std::vector<StringRef>& strings,
+                               StringRef separator);
+
+  // Fill content into a buffer in the string tensor format, in one pass, and
+  // return the number of bytes stored. The function allocates space for the
+  // buffer but does NOT take ownership.
+  int WriteToBuffer(char** buffer);
+
+  // Fill content into a string tensor, with the given new_shape. The new
+  // shape must match the number of strings in this object. Caller
+  // relinquishes ownership of new_shape. If 'new_shape' is nullptr, keep the
+  // tensor's existing shape.
+  void WriteToTensor(TfLiteTensor* tensor, TfLiteIntArray* new_shape);
+
+  // Fill content into a string tensor. Set shape to {num_strings}.
+  void WriteToTensorAsVector(TfLiteTensor* tensor);
+
+ private:
+  // Copies `len` bytes into the rope, spanning chunks as needed. The caller
+  // must have validated the length against max_length_.
+  void AppendBytes(const char* str, size_t len);
+
+  struct Chunk {
+    std::unique_ptr<char[]> data;
+    size_t size = 0;      // Bytes used.
+    size_t capacity = 0;  // Bytes allocated.
+  };
+  // Rope of chunks storing the contents of strings, not including headers.
+  std::vector<Chunk> chunks_;
+  // Offset of the starting index of each string in the rope.
+  std::vector<size_t> offset_;
+  const size_t chunk_bytes_;
+  // Max total length of added strings, see SimpleDynamicBuffer::max_length_.
+  const size_t max_length_;
+};
+
 // Return num of strings in a String tensor.
 inline int GetStringCount(const TfLiteTensor* tensor) {
   // The first integers in the raw buffer is the number of strings.
@@ -16,7 +16,9 @@ limitations under the License.
 
 #include <stdint.h>
 
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include "tensorflow/lite/core/c/c_api_types.h"
@@ -247,4 +249,116 @@ TEST(StringUtil, EmptyStringWithEmptyBuffer) {
   EXPECT_EQ(added_string.len, 0);
 }
 
+TEST(StringUtil, ChunkedBufferMatchesDynamicBufferLayout) {
+  Interpreter interpreter;
+  interpreter.AddTensors(2);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  t0->allocation_type = kTfLiteDynamic;
+  TfLiteTensor* t1 = interpreter.tensor(1);
+  t1->type = kTfLiteString;
+  t1->allocation_type = kTfLiteDynamic;
+
+  char s0[] = "ABC";
+  char s1[] = "DEFG";
+  char s2[] = "";
+
+  DynamicBuffer buf;
+  ChunkedDynamicBuffer chunked_buf;
+  for (auto& buffer_string : std::vector<StringRef>{
+           {s0, 3}, {s1, 4}, {s2, 0}}) {
+    ASSERT_EQ(buf.AddString(buffer_string), kTfLiteOk);
+    ASSERT_EQ(chunked_buf.AddString(buffer_string), kTfLiteOk);
+  }
+  buf.WriteToTensorAsVector(t0);
+  chunked_buf.WriteToTensorAsVector(t1);
+
+  ASSERT_EQ(t0->bytes, t1->bytes);
+  EXPECT_EQ(0, memcmp(t0->data.raw, t1->data.raw, t0->bytes));
+}
+
+TEST(StringUtil, ChunkedBufferSpansChunks) {
+  Interpreter interpreter;
+  interpreter.AddTensors(1);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  t0->allocation_type = kTfLiteDynamic;
+
+  // A chunk size of 4 bytes forces strings to span chunk boundaries.
+  ChunkedDynamicBuffer buf(kDefaultMaxLength, /*chunk_bytes=*/4);
+  ASSERT_EQ(buf.AddString("ABCDEFG", 7), kTfLiteOk);
+  ASSERT_EQ(buf.AddString("", 0), kTfLiteOk);
+  ASSERT_EQ(buf.AddString("HIJKLMNOPQ", 10), kTfLiteOk);
+  buf.WriteToTensorAsVector(t0);
+
+  ASSERT_EQ(GetStringCount(t0), 3);
+  StringRef str_ref = GetString(t0, 0);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "ABCDEFG");
+  str_ref = GetString(t0, 1);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "");
+  str_ref = GetString(t0, 2);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "HIJKLMNOPQ");
+}
+
+TEST(StringUtil, ChunkedBufferAddStrings) {
+  Interpreter interpreter;
+  interpreter.AddTensors(1);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  t0->allocation_type = kTfLiteDynamic;
+
+  char s0[] = "ABC";
+  char s1[] = "";
+  char s2[] = "DEFG";
+
+  ChunkedDynamicBuffer buf;
+  ASSERT_EQ(buf.AddStrings({{s0, 3}, {s1, 0}, {s2, 4}}), kTfLiteOk);
+  buf.WriteToTensorAsVector(t0);
+
+  ASSERT_EQ(GetStringCount(t0), 3);
+  StringRef str_ref = GetString(t0, 1);
+  EXPECT_EQ(str_ref.len, 0);
+  str_ref = GetString(t0, 2);
+  EXPECT_EQ(string(str_ref.str, str_ref.len), "DEFG");
+}
+
+TEST(StringUtil, ChunkedBufferAddJoinedString) {
+  Interpreter interpreter;
+  interpreter.AddTensors(1);
+  TfLiteTensor* t0 = interpreter.tensor(0);
+  t0->type = kTfLiteString;
+  t0->allocation_type = kTfLiteDynamic;
+
+  char s0[] = "";
+  char s1[] = "ABC";
+  char s2[] = "DEFG";
+  char s3[] = "";
+  char s4[] = "XYZ";
+
+  ChunkedDynamicBuffer buf(kDefaultMaxLength, /*chunk_bytes=*/4);
+  ASSERT_EQ(buf.AddJoinedString({{s0, 0}, {s1, 3}, {s2, 4}, {s3, 0}, {s4, 3}},
+                                ' '),
+            kTfLiteOk);
+  buf.WriteToTensorAsVector(t0);
+
+  ASSERT_EQ(GetStringCount(t0), 1);
+  StringRef str_ref = GetString(t0, 0);
+  ASSERT_EQ(string(str_ref.str, str_ref.len), " ABC DEFG  XYZ");
+  ASSERT_EQ(t0->bytes, 26);
+}
+
+TEST(StringUtil, ChunkedBufferOverflow) {
+  const size_t max_size = 100;
+  ChunkedDynamicBuffer buf(max_size);
+  std::string big_string(max_size + 1, 'A');
+  ASSERT_EQ(buf.AddString({big_string.data(), big_string.length()}),
+            kTfLiteError);
+
+  std::string half_string((max_size / 2) + 1, 'A');
+  ASSERT_EQ(buf.AddString({half_string.data(), half_string.length()}),
+            kTfLiteOk);
+  EXPECT_EQ(buf.AddString({half_string.data(), half_string.length()}),
+            kTfLiteError);
+}
+
 }  // namespace tflite
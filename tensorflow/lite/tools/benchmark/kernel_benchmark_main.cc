@@ -0,0 +1,452 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Microbenchmarks for builtin TFLite kernels across representative shapes and
+// quantization configurations, complementing the whole-model benchmark_model
+// tool with per-operator regression coverage. Each benchmark builds a
+// single-op interpreter from the registered builtin op resolver; ops that are
+// not registered (e.g. in selective builds) are reported as skipped.
+//
+// Benchmark names are stable across runs and runtime versions
+// (e.g. BM_Conv2D/int8/56/128/128), so JSON output can be used as a baseline:
+//   kernel_benchmark --benchmark_format=json > baseline.json
+// and compared against a later runtime with the benchmark library's
+// tools/compare.py, catching kernel-level regressions before release.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"  // from @com_google_benchmark
+#include "tensorflow/lite/core/c/builtin_op_data.h"
+#include "tensorflow/lite/core/c/common.h"
+#include "tensorflow/lite/core/kernels/register.h"
+#include "tensorflow/lite/interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace benchmark {
+namespace {
+
+// Per-tensor scales used for the quantized benchmark variants. The bias scale
+// must be the product of the input and filter scales, as required by the
+// convolution and fully-connected kernels.
+constexpr float kInputScale = 0.5f;
+constexpr float kFilterScale = 0.25f;
+constexpr float kBiasScale = kInputScale * kFilterScale;
+constexpr float kOutputScale = 0.5f;
+
+// A single-op interpreter together with the backing storage of its constant
+// tensors. The storage is declared before the interpreter so it outlives it.
+struct BenchmarkGraph {
+  std::vector<std::unique_ptr<std::vector<char>>> buffers;
+  std::unique_ptr<Interpreter> interpreter;
+};
+
+const TfLiteRegistration* FindRegistration(BuiltinOperator op, int version) {
+  static const ops::builtin::BuiltinOpResolver* resolver =
+      new ops::builtin::BuiltinOpResolver;
+  return resolver->FindOp(op, version);
+}
+
+size_t TypeSize(TfLiteType type) {
+  switch (type) {
+    case kTfLiteInt8:
+      return sizeof(int8_t);
+    case kTfLiteInt32:
+      return sizeof(int32_t);
+    default:
+      return sizeof(float);
+  }
+}
+
+int NumElements(const std::vector<int>& dims) {
+  int num_elements = 1;
+  for (int dim : dims) num_elements *= dim;
+  return num_elements;
+}
+
+TfLiteQuantizationParams Quant(TfLiteType type, float scale,
+                               int zero_point = 0) {
+  TfLiteQuantizationParams quantization = {};
+  if (type == kTfLiteInt8 || type == kTfLiteInt32) {
+    quantization.scale = scale;
+    quantization.zero_point = zero_point;
+  }
+  return quantization;
+}
+
+// Allocates a constant tensor buffer owned by `graph` and fills it with small
+// deterministic values so that quantized kernels don't saturate.
+const char* NewConstBuffer(BenchmarkGraph* graph, TfLiteType type,
+                           int num_elements) {
+  auto buffer =
+      std::make_unique<std::vector<char>>(num_elements * TypeSize(type));
+  std::minstd_rand rng(42);
+  if (type == kTfLiteFloat32) {
+    float* data = reinterpret_cast<float*>(buffer->data());
+    for (int i = 0; i < num_elements; ++i) {
+      data[i] = 0.1f * (static_cast<int>(rng() % 17) - 8);
+    }
+  } else if (type == kTfLiteInt32) {
+    int32_t* data = reinterpret_cast<int32_t*>(buffer->data());
+    for (int i = 0; i < num_elements; ++i) {
+      data[i] = static_cast<int>(rng() % 9) - 4;
+    }
+  } else {
+    int8_t* data = reinterpret_cast<int8_t*>(buffer->data());
+    for (int i = 0; i < num_elements; ++i) {
+      data[i] = static_cast<int>(rng() % 9) - 4;
+    }
+  }
+  graph->buffers.push_back(std::move(buffer));
+  return graph->buffers.back()->data();
+}
+
+template <typename ParamsT>
+ParamsT* NewParams() {
+  // The interpreter takes ownership of builtin data and destroys it with
+  // free(), so it has to be malloc'd.
+  auto* params = reinterpret_cast<ParamsT*>(malloc(sizeof(ParamsT)));
+  memset(params, 0, sizeof(ParamsT));
+  return params;
+}
+
+BenchmarkGraph BuildConv2D(TfLiteType type, int image_size, int input_depth,
+                           int output_depth, bool depthwise) {
+  BenchmarkGraph graph;
+  const BuiltinOperator op =
+      depthwise ? BuiltinOperator_DEPTHWISE_CONV_2D : BuiltinOperator_CONV_2D;
+  const TfLiteRegistration* registration =
+      FindRegistration(op, type == kTfLiteInt8 ? 3 : 1);
+  if (registration == nullptr) return graph;
+
+  const TfLiteType bias_type =
+      type == kTfLiteInt8 ? kTfLiteInt32 : kTfLiteFloat32;
+  const std::vector<int> filter_dims =
+      depthwise ? std::vector<int>{1, 3, 3, output_depth}
+                : std::vector<int>{output_depth, 3, 3, input_depth};
+  const int filter_elements = NumElements(filter_dims);
+
+  auto interpreter = std::make_unique<Interpreter>();
+  interpreter->AddTensors(4);
+  interpreter->SetTensorParametersReadWrite(
+      0, type, "input", {1, image_size, image_size, input_depth},
+      Quant(type, kInputScale));
+  interpreter->SetTensorParametersReadOnly(
+      1, type, "filter", filter_dims, Quant(type, kFilterScale),
+      NewConstBuffer(&graph, type, filter_elements),
+      filter_elements * TypeSize(type));
+  interpreter->SetTensorParametersReadOnly(
+      2, bias_type, "bias", {output_depth}, Quant(bias_type, kBiasScale),
+      NewConstBuffer(&graph, bias_type, output_depth),
+      output_depth * TypeSize(bias_type));
+  interpreter->SetTensorParametersReadWrite(
+      3, type, "output", {1, image_size, image_size, output_depth},
+      Quant(type, kOutputScale));
+
+  void* params = nullptr;
+  if (depthwise) {
+    auto* conv_params = NewParams<TfLiteDepthwiseConvParams>();
+    conv_params->padding = kTfLitePaddingSame;
+    conv_params->stride_width = 1;
+    conv_params->stride_height = 1;
+    conv_params->depth_multiplier = 1;
+    conv_params->dilation_width_factor = 1;
+    conv_params->dilation_height_factor = 1;
+    conv_params->activation = kTfLiteActNone;
+    params = conv_params;
+  } else {
+    auto* conv_params = NewParams<TfLiteConvParams>();
+    conv_params->padding = kTfLitePaddingSame;
+    conv_params->stride_width = 1;
+    conv_params->stride_height = 1;
+    conv_params->dilation_width_factor = 1;
+    conv_params->dilation_height_factor = 1;
+    conv_params->activation = kTfLiteActNone;
+    params = conv_params;
+  }
+  interpreter->AddNodeWithParameters({0, 1, 2}, {3}, nullptr, 0, params,
+                                     registration);
+  interpreter->SetInputs({0});
+  interpreter->SetOutputs({3});
+  graph.interpreter = std::move(interpreter);
+  return graph;
+}
+
+BenchmarkGraph BuildFullyConnected(TfLiteType type, int batch, int input_depth,
+                                   int output_depth) {
+  BenchmarkGraph graph;
+  const TfLiteRegistration* registration = FindRegistration(
+      BuiltinOperator_FULLY_CONNECTED, type == kTfLiteInt8 ? 4 : 1);
+  if (registration == nullptr) return graph;
+
+  const TfLiteType bias_type =
+      type == kTfLiteInt8 ? kTfLiteInt32 : kTfLiteFloat32;
+  const int weights_elements = output_depth * input_depth;
+
+  auto interpreter = std::make_unique<Interpreter>();
+  interpreter->AddTensors(4);
+  interpreter->SetTensorParametersReadWrite(
+      0, type, "input", {batch, input_depth}, Quant(type, kInputScale));
+  interpreter->SetTensorParametersReadOnly(
+      1, type, "weights", {output_depth, input_depth},
+      Quant(type, kFilterScale), NewConstBuffer(&graph, type, weights_elements),
+      weights_elements * TypeSize(type));
+  interpreter->SetTensorParametersReadOnly(
+      2, bias_type, "bias", {output_depth}, Quant(bias_type, kBiasScale),
+      NewConstBuffer(&graph, bias_type, output_depth),
+      output_depth * TypeSize(bias_type));
+  interpreter->SetTensorParametersReadWrite(
+      3, type, "output", {batch, output_depth}, Quant(type, kOutputScale));
+
+  auto* params = NewParams<TfLiteFullyConnectedParams>();
+  params->activation = kTfLiteActNone;
+  params->weights_format = kTfLiteFullyConnectedWeightsFormatDefault;
+  interpreter->AddNodeWithParameters({0, 1, 2}, {3}, nullptr, 0, params,
+                                     registration);
+  interpreter->SetInputs({0});
+  interpreter->SetOutputs({3});
+  graph.interpreter = std::move(interpreter);
+  return graph;
+}
+
+BenchmarkGraph BuildBinaryOp(BuiltinOperator op, TfLiteType type,
+                             int num_elements) {
+  BenchmarkGraph graph;
+  const TfLiteRegistration* registration =
+      FindRegistration(op, type == kTfLiteInt8 ? 2 : 1);
+  if (registration == nullptr) return graph;
+
+  auto interpreter = std::make_unique<Interpreter>();
+  interpreter->AddTensors(3);
+  for (int i = 0; i < 3; ++i) {
+    interpreter->SetTensorParametersReadWrite(i, type, "tensor", {num_elements},
+                                              Quant(type, kInputScale));
+  }
+
+  void* params = nullptr;
+  if (op == BuiltinOperator_MUL) {
+    auto* mul_params = NewParams<TfLiteMulParams>();
+    mul_params->activation = kTfLiteActNone;
+    params = mul_params;
+  } else {
+    auto* add_params = NewParams<TfLiteAddParams>();
+    add_params->activation = kTfLiteActNone;
+    params = add_params;
+  }
+  interpreter->AddNodeWithParameters({0, 1}, {2}, nullptr, 0, params,
+                                     registration);
+  interpreter->SetInputs({0, 1});
+  interpreter->SetOutputs({2});
+  graph.interpreter = std::move(interpreter);
+  return graph;
+}
+
+BenchmarkGraph BuildPool2D(BuiltinOperator op, TfLiteType type, int image_size,
+                           int depth) {
+  BenchmarkGraph graph;
+  const TfLiteRegistration* registration =
+      FindRegistration(op, type == kTfLiteInt8 ? 2 : 1);
+  if (registration == nullptr) return graph;
+
+  auto interpreter = std::make_unique<Interpreter>();
+  interpreter->AddTensors(2);
+  // Pooling kernels require matching input and output quantization.
+  interpreter->SetTensorParametersReadWrite(
+      0, type, "input", {1, image_size, image_size, depth},
+      Quant(type, kInputScale));
+  interpreter->SetTensorParametersReadWrite(
+      1, type, "output", {1, image_size / 2, image_size / 2, depth},
+      Quant(type, kInputScale));
+
+  auto* params = NewParams<TfLitePoolParams>();
+  params->padding = kTfLitePaddingValid;
+  params->stride_width = 2;
+  params->stride_height = 2;
+  params->filter_width = 2;
+  params->filter_height = 2;
+  params->activation = kTfLiteActNone;
+  interpreter->AddNodeWithParameters({0}, {1}, nullptr, 0, params,
+                                     registration);
+  interpreter->SetInputs({0});
+  interpreter->SetOutputs({1});
+  graph.interpreter = std::move(interpreter);
+  return graph;
+}
+
+BenchmarkGraph BuildSoftmax(TfLiteType type, int batch, int depth) {
+  BenchmarkGraph graph;
+  const TfLiteRegistration* registration =
+      FindRegistration(BuiltinOperator_SOFTMAX, type == kTfLiteInt8 ? 2 : 1);
+  if (registration == nullptr) return graph;
+
+  auto interpreter = std::make_unique<Interpreter>();
+  interpreter->AddTensors(2);
+  interpreter->SetTensorParametersReadWrite(0, type, "input", {batch, depth},
+                                            Quant(type, kInputScale));
+  // The int8 softmax kernel requires an output scale of 1/256 and a zero
+  // point of -128.
+  interpreter->SetTensorParametersReadWrite(
+      1, type, "output", {batch, depth},
+      Quant(type, 1.0f / 256, /*zero_point=*/-128));
+
+  auto* params = NewParams<TfLiteSoftmaxParams>();
+  params->beta = 1.0f;
+  interpreter->AddNodeWithParameters({0}, {1}, nullptr, 0, params,
+                                     registration);
+  interpreter->SetInputs({0});
+  interpreter->SetOutputs({1});
+  graph.interpreter = std::move(interpreter);
+  return graph;
+}
+
+void RunGraph(::benchmark::State& state, BenchmarkGraph graph) {
+  if (graph.interpreter == nullptr) {
+    state.SkipWithError("kernel not registered");
+    return;
+  }
+  Interpreter* interpreter = graph.interpreter.get();
+  if (interpreter->AllocateTensors() != kTfLiteOk) {
+    state.SkipWithError("AllocateTensors failed");
+    return;
+  }
+  // Fill runtime inputs with deterministic data.
+  std::minstd_rand rng(123);
+  for (int tensor_index : interpreter->inputs()) {
+    TfLiteTensor* tensor = interpreter->tensor(tensor_index);
+    const int num_elements = NumElements(
+        std::vector<int>(tensor->dims->data,
+                         tensor->dims->data + tensor->dims->size));
+    if (tensor->type == kTfLiteFloat32) {
+      for (int i = 0; i < num_elements; ++i) {
+        tensor->data.f[i] = 0.1f * (static_cast<int>(rng() % 17) - 8);
+      }
+    } else {
+      for (int i = 0; i < num_elements; ++i) {
+        tensor->data.int8[i] = static_cast<int>(rng() % 255) - 127;
+      }
+    }
+  }
+  // Warm up once so one-time kernel preparation is kept out of the
+  // measurement.
+  if (interpreter->Invoke() != kTfLiteOk) {
+    state.SkipWithError("Invoke failed");
+    return;
+  }
+  for (auto _ : state) {
+    interpreter->Invoke();
+  }
+}
+
+void BM_Conv2D(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildConv2D(type, state.range(0), state.range(1),
+                              state.range(2), /*depthwise=*/false));
+}
+BENCHMARK_CAPTURE(BM_Conv2D, float32, kTfLiteFloat32)
+    ->Args({112, 32, 64})
+    ->Args({56, 128, 128})
+    ->Args({14, 256, 256});
+BENCHMARK_CAPTURE(BM_Conv2D, int8, kTfLiteInt8)
+    ->Args({112, 32, 64})
+    ->Args({56, 128, 128})
+    ->Args({14, 256, 256});
+
+void BM_DepthwiseConv2D(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildConv2D(type, state.range(0), state.range(1),
+                              state.range(1), /*depthwise=*/true));
+}
+BENCHMARK_CAPTURE(BM_DepthwiseConv2D, float32, kTfLiteFloat32)
+    ->Args({112, 32})
+    ->Args({56, 128});
+BENCHMARK_CAPTURE(BM_DepthwiseConv2D, int8, kTfLiteInt8)
+    ->Args({112, 32})
+    ->Args({56, 128});
+
+void BM_FullyConnected(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildFullyConnected(type, state.range(0), state.range(1),
+                                      state.range(2)));
+}
+BENCHMARK_CAPTURE(BM_FullyConnected, float32, kTfLiteFloat32)
+    ->Args({1, 1024, 1024})
+    ->Args({4, 256, 1024})
+    ->Args({1, 512, 2048});
+BENCHMARK_CAPTURE(BM_FullyConnected, int8, kTfLiteInt8)
+    ->Args({1, 1024, 1024})
+    ->Args({4, 256, 1024})
+    ->Args({1, 512, 2048});
+
+void BM_Add(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildBinaryOp(BuiltinOperator_ADD, type, state.range(0)));
+}
+BENCHMARK_CAPTURE(BM_Add, float32, kTfLiteFloat32)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_Add, int8, kTfLiteInt8)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_Mul(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildBinaryOp(BuiltinOperator_MUL, type, state.range(0)));
+}
+BENCHMARK_CAPTURE(BM_Mul, float32, kTfLiteFloat32)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20);
+BENCHMARK_CAPTURE(BM_Mul, int8, kTfLiteInt8)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_AveragePool2D(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildPool2D(BuiltinOperator_AVERAGE_POOL_2D, type,
+                              state.range(0), state.range(1)));
+}
+BENCHMARK_CAPTURE(BM_AveragePool2D, float32, kTfLiteFloat32)
+    ->Args({112, 64})
+    ->Args({56, 128});
+BENCHMARK_CAPTURE(BM_AveragePool2D, int8, kTfLiteInt8)
+    ->Args({112, 64})
+    ->Args({56, 128});
+
+void BM_MaxPool2D(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildPool2D(BuiltinOperator_MAX_POOL_2D, type,
+                              state.range(0), state.range(1)));
+}
+BENCHMARK_CAPTURE(BM_MaxPool2D, float32, kTfLiteFloat32)
+    ->Args({112, 64})
+    ->Args({56, 128});
+BENCHMARK_CAPTURE(BM_MaxPool2D, int8, kTfLiteInt8)
+    ->Args({112, 64})
+    ->Args({56, 128});
+
+void BM_Softmax(::benchmark::State& state, TfLiteType type) {
+  RunGraph(state, BuildSoftmax(type, state.range(0), state.range(1)));
+}
+BENCHMARK_CAPTURE(BM_Softmax, float32, kTfLiteFloat32)
+    ->Args({1, 1000})
+    ->Args({16, 128});
+BENCHMARK_CAPTURE(BM_Softmax, int8, kTfLiteInt8)
+    ->Args({1, 1000})
+    ->Args({16, 128});
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace tflite
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -36,6 +36,7 @@ limitations under the License.
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/substitute.h"
@@ -60,6 +61,14 @@ ABSL_FLAG(
     bool, coordination_agent_recoverable, false,
     "If true, allow it to silently reconnect to the service after a restart.");
 
+ABSL_FLAG(
+    bool, coordination_agent_kv_cache, false,
+    "If true, cache successful key-value reads locally in the agent so that "
+    "repeated reads of hot keys skip the leader round trip. Only safe when "
+    "the keys read through this agent are write-once: the cache is "
+    "invalidated by this agent's own inserts and deletes only, so another "
+    "task's overwrite or delete of a cached key is never observed here.");
+
 namespace tsl {
 using tensorflow::CoordinatedTask;
 using tensorflow::CoordinatedTaskState;
@@ -185,6 +194,19 @@ class CoordinationServiceAgentImpl : public CoordinationServiceAgent {
       ABSL_GUARDED_BY(state_mu_);
   absl::flat_hash_set<std::string> ongoing_barriers_ ABSL_GUARDED_BY(state_mu_);
 
+  // Caches successful key-value reads so that repeated reads of unchanged hot
+  // keys (e.g. during a startup barrier storm) are served locally instead of
+  // each paying a leader round trip. Entries are invalidated only when this
+  // agent overwrites or deletes the key, and when the agent resets or shuts
+  // down — a mutation by another task is never observed here, so the cache is
+  // incoherent for keys that are rewritten cross-task (e.g. the PjRt
+  // distributed KV store's Set(allow_overwrite=true)/Delete). It is therefore
+  // off by default and opted into with --coordination_agent_kv_cache, which
+  // requires the cached keys to be write-once.
+  absl::Mutex kv_cache_mu_;
+  absl::flat_hash_map<std::string, std::string> kv_cache_
+      ABSL_GUARDED_BY(kv_cache_mu_);
+
   uint64_t leader_incarnation_ = 0;
   DeviceInfo cluster_devices_;
 
@@ -680,6 +702,11 @@ absl::Status CoordinationServiceAgentImpl::ShutdownInternal() {
 
   // Cancel all pending GetKeyValue() and WaitAtBarrier() RPC calls.
   cancellation_manager_.StartCancel();
+  // The service may restart with fresh key-values; drop the local copies.
+  {
+    absl::MutexLock l(&kv_cache_mu_);
+    kv_cache_.clear();
+  }
   return status;
 }
 
@@ -722,6 +749,11 @@ absl::Status CoordinationServiceAgentImpl::Reset() {
     absl::MutexLock l(&heartbeat_thread_shutdown_mu_);
     shutting_down_ = false;
   }
+  // The service may restart with fresh key-values; drop the local copies.
+  {
+    absl::MutexLock l(&kv_cache_mu_);
+    kv_cache_.clear();
+  }
 
   LOG(INFO) << "Coordination agent has been reset.";
   return status;
@@ -754,6 +786,25 @@ absl::StatusOr<std::string> CoordinationServiceAgentImpl::GetKeyValue(
 
 std::shared_ptr<CallOptions> CoordinationServiceAgentImpl::GetKeyValueAsync(
     std::string_view key, StatusOrValueCallback done) {
+  // With the opt-in read cache, serve repeated reads of an unchanged key
+  // locally without a leader round trip. The callback is invoked outside the
+  // lock since it may re-enter the key-value API.
+  const bool kv_cache_enabled =
+      absl::GetFlag(FLAGS_coordination_agent_kv_cache);
+  if (kv_cache_enabled) {
+    std::optional<std::string> cached_value;
+    {
+      absl::MutexLock l(&kv_cache_mu_);
+      auto iter = kv_cache_.find(key);
+      if (iter != kv_cache_.end()) cached_value = iter->second;
+    }
+    if (cached_value.has_value()) {
+      VLOG(3) << "GetKeyValueResponse (served from local cache): key: " << key;
+      done(*std::move(cached_value));
+      return std::make_shared<CallOptions>();
+    }
+  }
+
   auto request = std::make_shared<GetKeyValueRequest>();
   request->set_key(key.data(), key.size());
   VLOG(3) << "GetKeyValueRequest: " << request->DebugString();
@@ -770,8 +821,9 @@ std::shared_ptr<CallOptions> CoordinationServiceAgentImpl::GetKeyValueAsync(
   }
   leader_client_->GetKeyValueAsync(
       call_opts.get(), request.get(), response.get(),
-      [call_opts, request, response, done = std::move(done),
-       &cm = cancellation_manager_, token](const absl::Status& s) {
+      [call_opts, request, response, done = std::move(done), this,
+       kv_cache_enabled, &cm = cancellation_manager_,
+       token](const absl::Status& s) {
         // RPC call has completed (no longer needs to be cancelled if agent is
         // destroyed).
         cm.TryDeregisterCallback(token);
@@ -781,6 +833,10 @@ std::shared_ptr<CallOptions> CoordinationServiceAgentImpl::GetKeyValueAsync(
           done(s);
           VLOG(3) << "GetKeyValueResponse: " << s;
         } else {
+          if (kv_cache_enabled) {
+            absl::MutexLock l(&kv_cache_mu_);
+            kv_cache_[request->key()] = response->kv().value();
+          }
           done(response->kv().value());
           VLOG(3) << "GetKeyValueResponse: " << response->DebugString();
         }
@@ -790,6 +846,17 @@ std::shared_ptr<CallOptions> CoordinationServiceAgentImpl::GetKeyValueAsync(
 
 absl::StatusOr<std::string> CoordinationServiceAgentImpl::TryGetKeyValue(
     std::string_view key) {
+  const bool kv_cache_enabled =
+      absl::GetFlag(FLAGS_coordination_agent_kv_cache);
+  if (kv_cache_enabled) {
+    absl::MutexLock l(&kv_cache_mu_);
+    auto iter = kv_cache_.find(key);
+    if (iter != kv_cache_.end()) {
+      VLOG(3) << "TryGetKeyValueResponse (served from local cache): key: "
+              << key;
+      return iter->second;
+    }
+  }
   absl::Notification n;
   absl::StatusOr<std::string> result;
   TryGetKeyValueRequest request;
@@ -809,6 +876,10 @@ absl::StatusOr<std::string> CoordinationServiceAgentImpl::TryGetKeyValue(
       });
   n.WaitForNotification();
 
+  if (kv_cache_enabled && result.ok()) {
+    absl::MutexLock l(&kv_cache_mu_);
+    kv_cache_[std::string(key)] = *result;
+  }
   return result;
 }
 
@@ -872,6 +943,12 @@ absl::Status CoordinationServiceAgentImpl::InsertKeyValue(
                                       });
   n.WaitForNotification();
   VLOG(3) << "InsertKeyValueResponse: " << status;
+  if (status.ok() && absl::GetFlag(FLAGS_coordination_agent_kv_cache)) {
+    // The inserted value is now the authoritative one; serve later reads of
+    // this key locally.
+    absl::MutexLock l(&kv_cache_mu_);
+    kv_cache_[std::string(key)] = std::string(value);
+  }
   return status;
 }
 
@@ -892,6 +969,19 @@ absl::Status CoordinationServiceAgentImpl::DeleteKeyValue(
                                       });
   n.WaitForNotification();
   VLOG(3) << "DeleteKeyValueResponse " << status;
+  {
+    // Invalidate local copies of the key and any keys under its directory,
+    // regardless of the RPC outcome.
+    absl::MutexLock l(&kv_cache_mu_);
+    const std::string directory = absl::StrCat(key, "/");
+    for (auto iter = kv_cache_.begin(); iter != kv_cache_.end();) {
+      if (iter->first == key || absl::StartsWith(iter->first, directory)) {
+        kv_cache_.erase(iter++);
+      } else {
+        ++iter;
+      }
+    }
+  }
   return absl::OkStatus();
 }
 
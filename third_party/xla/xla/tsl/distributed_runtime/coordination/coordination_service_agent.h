@@ -175,6 +175,10 @@ class CoordinationServiceAgent {
   // Get config key-value from the service.
   // If the key-value is not inserted yet, this is a blocking call that waits
   // until the corresponding key is inserted.
+  // Successful reads are cached in the agent, so repeated reads of an
+  // unchanged key are served locally without a leader round trip. A cached
+  // entry is invalidated when this agent overwrites or deletes the key, and
+  // when the agent resets or shuts down.
   //   - DeadlineExceeded: timed out waiting for key.
   virtual absl::StatusOr<std::string> GetKeyValue(std::string_view key) = 0;
   virtual absl::StatusOr<std::string> GetKeyValue(std::string_view key,
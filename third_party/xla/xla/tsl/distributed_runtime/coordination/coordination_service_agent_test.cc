@@ -21,6 +21,9 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "absl/flags/declare.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/reflection.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/memory/memory.h"
@@ -37,6 +40,8 @@ limitations under the License.
 #include "tsl/platform/status.h"
 #include "tsl/platform/test.h"
 
+ABSL_DECLARE_FLAG(bool, coordination_agent_kv_cache);
+
 namespace tsl {
 namespace {
 using tensorflow::CoordinatedTask;
@@ -238,6 +243,41 @@ TEST_F(CoordinationServiceAgentTest, GetKeyValue_Simple_Success) {
   EXPECT_EQ(*result, test_value);
 }
 
+TEST_F(CoordinationServiceAgentTest, GetKeyValue_ServedFromLocalCache) {
+  // The read cache is opt-in; restore the default when the test exits.
+  absl::FlagSaver flag_saver;
+  absl::SetFlag(&FLAGS_coordination_agent_kv_cache, true);
+  const std::string test_key = "test_key";
+  const std::string test_value = "test_value";
+  GetKeyValueResponse mocked_response;
+  auto kv = mocked_response.mutable_kv();
+  kv->set_key(test_key);
+  kv->set_value(test_value);
+  // The leader should only see two reads: the initial miss, and the re-fetch
+  // after DeleteKeyValue() invalidates the cached entry.
+  EXPECT_CALL(*GetClient(), GetKeyValueAsync(_, _, _, _))
+      .Times(2)
+      .WillRepeatedly(DoAll(SetArgPointee<2>(mocked_response),
+                            InvokeArgument<3>(absl::OkStatus())));
+  ON_CALL(*GetClient(), DeleteKeyValueAsync(_, _, _))
+      .WillByDefault(InvokeArgument<2>(absl::OkStatus()));
+  InitializeAgent();
+
+  // Repeated reads of the same key are served from the local cache.
+  for (int i = 0; i < 3; ++i) {
+    auto result = agent_->GetKeyValue(test_key);
+    TF_ASSERT_OK(result.status());
+    EXPECT_EQ(*result, test_value);
+  }
+
+  // Deleting the key invalidates the cached entry, so the next read goes to
+  // the leader again.
+  TF_ASSERT_OK(agent_->DeleteKeyValue(test_key));
+  auto result = agent_->GetKeyValue(test_key);
+  TF_ASSERT_OK(result.status());
+  EXPECT_EQ(*result, test_value);
+}
+
 TEST_F(CoordinationServiceAgentTest, GetKeyValue_WithTimeout_Success) {
   const std::string& test_key = "test_key";
   const std::string& test_value = "test_value";
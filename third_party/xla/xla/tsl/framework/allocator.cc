@@ -36,7 +36,8 @@ string AllocatorStats::DebugString() const {
       "MaxAllocSize:     %20lld\n"
       "Reserved:         %20lld\n"
       "PeakReserved:     %20lld\n"
-      "LargestFreeBlock: %20lld\n",
+      "LargestFreeBlock: %20lld\n"
+      "Fragmentation:    %20.3f\n",
       static_cast<long long>(this->bytes_limit ? *this->bytes_limit : 0),
       static_cast<long long>(this->bytes_in_use),
       static_cast<long long>(this->peak_bytes_in_use),
@@ -44,7 +45,8 @@ string AllocatorStats::DebugString() const {
       static_cast<long long>(this->largest_alloc_size),
       static_cast<long long>(this->bytes_reserved),
       static_cast<long long>(this->peak_bytes_reserved),
-      static_cast<long long>(this->largest_free_block_bytes));
+      static_cast<long long>(this->largest_free_block_bytes),
+      this->fragmentation);
 }
 
 constexpr size_t Allocator::kAllocatorAlignment;
@@ -21,6 +21,7 @@ limitations under the License.
 #include <functional>
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -88,6 +89,25 @@ struct AllocatorStats {
 
   int64_t largest_free_block_bytes;  // Largest free block's size in heap.
 
+  // External fragmentation within [0, 1]: the fraction of free memory that is
+  // not part of the largest free block. Only populated by allocators that
+  // manage a pool of memory (e.g. BFCAllocator); 0 otherwise.
+  double fragmentation;
+
+  // Occupancy of one chunk-size bin, for allocators that keep free chunks
+  // binned by size (e.g. BFCAllocator).
+  struct BinStats {
+    int64_t bin_size;              // Smallest chunk size the bin holds.
+    int64_t total_bytes_in_bin;    // Bytes in all chunks binned at this size.
+    int64_t total_bytes_in_use;    // Bytes in chunks currently in use.
+    int64_t total_chunks_in_bin;   // Number of chunks binned at this size.
+    int64_t total_chunks_in_use;   // Number of chunks currently in use.
+  };
+
+  // Per-bin occupancy, ordered by increasing bin_size. Empty for allocators
+  // that do not maintain size bins.
+  std::vector<BinStats> bin_stats;
+
   // Number of bytes of memory held by the allocator.  This may be higher than
   // bytes_in_use if the allocator holds a pool of memory (e.g. BFCAllocator).
   std::optional<int64_t> pool_bytes;
@@ -100,7 +120,8 @@ struct AllocatorStats {
         largest_alloc_size(0),
         bytes_reserved(0),
         peak_bytes_reserved(0),
-        largest_free_block_bytes(0) {}
+        largest_free_block_bytes(0),
+        fragmentation(0) {}
 
   std::string DebugString() const;
 };
@@ -35,6 +35,7 @@ limitations under the License.
 #include "absl/synchronization/mutex.h"
 #include "xla/tsl/framework/allocator.h"
 #include "xla/tsl/framework/allocator_retry.h"
+#include "xla/tsl/framework/metrics.h"
 #include "xla/tsl/profiler/utils/trace_filter_utils.h"
 #include "xla/tsl/protobuf/bfc_memory_map.pb.h"
 #include "tsl/platform/env.h"
@@ -447,6 +448,7 @@ void* BFCAllocator::AllocateRawInternal(size_t unused_alignment,
   BinNum bin_num = BinNumForSize(rounded_bytes);
 
   absl::MutexLock l(&mutex_);
+  MaybeExportFragmentationMetrics();
   if (!timestamped_chunks_.empty()) {
     // Merge timestamped chunks whose counts have become safe for general use.
     MergeTimestampedChunks(0);
@@ -530,6 +532,20 @@ double BFCAllocator::GetFragmentation() {
          bytes_available;
 }
 
+void BFCAllocator::MaybeExportFragmentationMetrics() {
+  constexpr uint64 kExportIntervalMicros = 10 * 1000 * 1000;
+  uint64 now_micros = Env::Default()->NowMicros();
+  if (now_micros < next_fragmentation_export_micros_) {
+    return;
+  }
+  next_fragmentation_export_micros_ = now_micros + kExportIntervalMicros;
+  if (!stats_.pool_bytes || *stats_.pool_bytes <= stats_.bytes_in_use) {
+    return;
+  }
+  metrics::UpdateBfcAllocatorFragmentation(name_, GetFragmentation(),
+                                           LargestFreeChunk());
+}
+
 void BFCAllocator::AddTraceMe(absl::string_view traceme_name, const void* ptr) {
   BFCAllocator::Chunk* chunk = ChunkFromHandle(region_manager_.get_handle(ptr));
   AddTraceMe(traceme_name, chunk->ptr, chunk->requested_size, chunk->size);
@@ -557,6 +573,7 @@ void BFCAllocator::AddTraceMe(absl::string_view traceme_name,
                                {"bytes_allocated", stats_.bytes_in_use},
                                {"bytes_available", bytes_available},
                                {"fragmentation", GetFragmentation()},
+                               {"largest_free_block_bytes", LargestFreeChunk()},
                                {"peak_bytes_in_use", stats_.peak_bytes_in_use},
                                {"requested_bytes", req_bytes},
                                {"allocation_bytes", alloc_bytes},
@@ -1227,7 +1244,28 @@ MemoryDump BFCAllocator::RecordMemoryMapInternal() {
 
 std::optional<AllocatorStats> BFCAllocator::GetStats() {
   absl::MutexLock l(&mutex_);
-  return stats_;
+  AllocatorStats stats = stats_;
+  stats.largest_free_block_bytes = LargestFreeChunk();
+  if (stats_.pool_bytes && *stats_.pool_bytes > stats_.bytes_in_use) {
+    stats.fragmentation = GetFragmentation();
+  }
+  const std::array<BinDebugInfo, kNumBins> bin_infos = get_bin_debug_info();
+  stats.bin_stats.reserve(kNumBins);
+  for (BinNum b = 0; b < kNumBins; b++) {
+    const BinDebugInfo& bin_info = bin_infos[b];
+    AllocatorStats::BinStats bin_stats;
+    bin_stats.bin_size = static_cast<int64_t>(BinNumToSize(b));
+    bin_stats.total_bytes_in_bin =
+        static_cast<int64_t>(bin_info.total_bytes_in_bin);
+    bin_stats.total_bytes_in_use =
+        static_cast<int64_t>(bin_info.total_bytes_in_use);
+    bin_stats.total_chunks_in_bin =
+        static_cast<int64_t>(bin_info.total_chunks_in_bin);
+    bin_stats.total_chunks_in_use =
+        static_cast<int64_t>(bin_info.total_chunks_in_use);
+    stats.bin_stats.push_back(bin_stats);
+  }
+  return stats;
 }
 
 bool BFCAllocator::ClearStats() {
@@ -525,6 +525,10 @@ class BFCAllocator : public Allocator {
   // size over total free memory, and returns a value within [0, 1].
   double GetFragmentation() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Exports the current fragmentation and largest free block size as
+  // monitoring gauges, rate-limited so the allocation path stays cheap.
+  void MaybeExportFragmentationMetrics() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // Information about a Bin that is useful for debugging.
   struct BinDebugInfo {
     size_t total_bytes_in_use = 0;
@@ -594,6 +598,10 @@ class BFCAllocator : public Allocator {
   // Stats.
   AllocatorStats stats_ ABSL_GUARDED_BY(mutex_);
 
+  // Earliest time at which MaybeExportFragmentationMetrics will export again,
+  // in microseconds since the epoch.
+  uint64 next_fragmentation_export_micros_ ABSL_GUARDED_BY(mutex_) = 0;
+
 #ifdef TENSORFLOW_MEM_DEBUG
   int64 action_counter_ ABSL_GUARDED_BY(mutex_);
 #define MEM_DEBUG_SIZE_HISTORY_SIZE 4096
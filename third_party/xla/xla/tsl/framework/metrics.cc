@@ -16,8 +16,10 @@ limitations under the License.
 #include "xla/tsl/framework/metrics.h"
 
 #include <cstdint>
+#include <string>
 
 #include "xla/tsl/lib/monitoring/counter.h"
+#include "xla/tsl/lib/monitoring/gauge.h"
 
 namespace tsl {
 namespace metrics {
@@ -28,6 +30,17 @@ auto* bfc_allocator_delay =
                                 "The total time spent running each graph "
                                 "optimization pass in microseconds.");
 
+auto* bfc_allocator_fragmentation = monitoring::Gauge<double, 1>::New(
+    "/tensorflow/core/bfc_allocator_fragmentation",
+    "The fraction of free memory in a BFC allocator that is not part of its "
+    "largest free block, within [0, 1].",
+    "allocator_name");
+
+auto* bfc_allocator_largest_free_block = monitoring::Gauge<int64_t, 1>::New(
+    "/tensorflow/core/bfc_allocator_largest_free_block_bytes",
+    "The size in bytes of the largest free block in a BFC allocator.",
+    "allocator_name");
+
 }  // namespace
 
 void UpdateBfcAllocatorDelayTime(const uint64_t delay_usecs) {
@@ -37,5 +50,13 @@ void UpdateBfcAllocatorDelayTime(const uint64_t delay_usecs) {
   }
 }
 
+void UpdateBfcAllocatorFragmentation(const std::string& allocator_name,
+                                     double fragmentation,
+                                     int64_t largest_free_block_bytes) {
+  bfc_allocator_fragmentation->GetCell(allocator_name)->Set(fragmentation);
+  bfc_allocator_largest_free_block->GetCell(allocator_name)
+      ->Set(largest_free_block_bytes);
+}
+
 }  // namespace metrics
 }  // namespace tsl
@@ -17,6 +17,7 @@ limitations under the License.
 #define XLA_TSL_FRAMEWORK_METRICS_H_
 
 #include <cstdint>
+#include <string>
 
 namespace tsl {
 namespace metrics {
@@ -24,6 +25,12 @@ namespace metrics {
 // Updates the metrics stored about time BFC allocator spents during delay.
 void UpdateBfcAllocatorDelayTime(const uint64_t delay_usecs);
 
+// Updates the gauges tracking the current fragmentation state of a BFC
+// allocator, keyed by allocator name.
+void UpdateBfcAllocatorFragmentation(const std::string& allocator_name,
+                                     double fragmentation,
+                                     int64_t largest_free_block_bytes);
+
 }  // namespace metrics
 }  // namespace tsl
 
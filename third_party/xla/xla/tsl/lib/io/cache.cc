@@ -445,6 +445,22 @@ class ShardedLRUCache : public Cache {
 
 Cache* NewLRUCache(size_t capacity) { return new ShardedLRUCache(capacity); }
 
+Cache* GetSharedBlockCache() {
+  static Cache* const shared_cache = [] {
+    int64_t capacity = 64 << 20;
+    const char* env = getenv("TF_TABLE_SHARED_BLOCK_CACHE_BYTES");
+    if (env != nullptr) {
+      char* end = nullptr;
+      const int64_t parsed = strtoll(env, &end, 10);
+      if (end != env && *end == '\0' && parsed > 0) {
+        capacity = parsed;
+      }
+    }
+    return NewLRUCache(static_cast<size_t>(capacity));
+  }();
+  return shared_cache;
+}
+
 }  // namespace table
 
 }  // namespace tsl
@@ -45,6 +45,17 @@ class Cache;
 // of Cache uses a least-recently-used eviction policy.
 Cache* NewLRUCache(size_t capacity);
 
+// Return a process-wide LRU cache, created on first use and never
+// destroyed.  Readers that each open their own table can point
+// Options::block_cache at this cache so identical hot blocks (e.g. the
+// index blocks of many concurrently open tables) are stored once per
+// process instead of once per reader.  Tables partition the key space via
+// NewId(), so sharing one cache across tables is safe.
+//
+// The capacity defaults to 64MB and can be overridden by setting the
+// TF_TABLE_SHARED_BLOCK_CACHE_BYTES environment variable before first use.
+Cache* GetSharedBlockCache();
+
 class Cache {
  public:
   Cache() = default;
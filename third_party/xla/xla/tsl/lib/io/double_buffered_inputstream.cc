@@ -0,0 +1,189 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "xla/tsl/lib/io/double_buffered_inputstream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "tsl/platform/errors.h"
+
+namespace tsl {
+namespace io {
+
+DoubleBufferedInputStream::DoubleBufferedInputStream(RandomAccessFile* file,
+                                                     size_t buffer_bytes,
+                                                     bool owns_file, Env* env)
+    : file_(file), buffer_bytes_(buffer_bytes), owns_file_(owns_file) {
+  thread_.reset(env->StartThread(ThreadOptions(),
+                                 "double_buffered_inputstream",
+                                 [this]() { PrefetchLoop(); }));
+  StartFetch(0);
+}
+
+DoubleBufferedInputStream::~DoubleBufferedInputStream() {
+  {
+    mutex_lock l(mu_);
+    cancelled_ = true;
+    work_cv_.notify_all();
+  }
+  thread_.reset();  // Joins the prefetch thread.
+  if (owns_file_) {
+    delete file_;
+  }
+}
+
+void DoubleBufferedInputStream::PrefetchLoop() {
+  while (true) {
+    uint64 offset;
+    {
+      mutex_lock l(mu_);
+      while (!cancelled_ && !fetch_requested_) {
+        work_cv_.wait(l);
+      }
+      if (cancelled_) {
+        return;
+      }
+      fetch_requested_ = false;
+      offset = fetch_offset_;
+    }
+    // Read the window outside the lock so the consumer can keep draining the
+    // current one while this read is in flight.
+    tstring data;
+    data.resize_uninitialized(buffer_bytes_);
+    absl::string_view result;
+    absl::Status s = file_->Read(offset, buffer_bytes_, &result, &data[0]);
+    if (result.data() != data.data()) {
+      memmove(&data[0], result.data(), result.size());
+    }
+    data.resize(result.size());
+    // A short read with OUT_OF_RANGE is a normal end-of-file window; the
+    // consumer detects end of file from the window size.
+    if (errors::IsOutOfRange(s)) {
+      s = absl::OkStatus();
+    }
+    {
+      mutex_lock l(mu_);
+      fetch_buf_ = std::move(data);
+      fetch_status_ = s;
+      fetch_done_ = true;
+      done_cv_.notify_all();
+    }
+  }
+}
+
+void DoubleBufferedInputStream::StartFetch(uint64 offset) {
+  mutex_lock l(mu_);
+  fetch_offset_ = offset;
+  fetch_requested_ = true;
+  fetch_done_ = false;
+  fetch_outstanding_ = true;
+  work_cv_.notify_one();
+}
+
+absl::Status DoubleBufferedInputStream::WaitForFetch() {
+  mutex_lock l(mu_);
+  while (!fetch_done_) {
+    done_cv_.wait(l);
+  }
+  fetch_outstanding_ = false;
+  buf_ = std::move(fetch_buf_);
+  fetch_buf_.clear();
+  pos_in_buf_ = 0;
+  buf_offset_ = fetch_offset_;
+  return fetch_status_;
+}
+
+void DoubleBufferedInputStream::RestartAt(uint64 pos) {
+  if (fetch_outstanding_) {
+    WaitForFetch().IgnoreError();
+  }
+  buf_.clear();
+  pos_in_buf_ = 0;
+  buf_offset_ = pos;
+  fetch_error_ = absl::OkStatus();
+  StartFetch(pos);
+}
+
+absl::Status DoubleBufferedInputStream::Consume(int64_t bytes,
+                                                tstring* result) {
+  int64_t remaining = bytes;
+  while (remaining > 0) {
+    if (pos_in_buf_ < buf_.size()) {
+      const int64_t bytes_to_copy =
+          std::min<int64_t>(buf_.size() - pos_in_buf_, remaining);
+      if (result != nullptr) {
+        result->append(buf_.data() + pos_in_buf_, bytes_to_copy);
+      }
+      pos_in_buf_ += bytes_to_copy;
+      remaining -= bytes_to_copy;
+      continue;
+    }
+    // The current window is drained; move to the prefetched one.
+    if (!fetch_error_.ok()) {
+      return fetch_error_;
+    }
+    if (!fetch_outstanding_) {
+      // The previous window was short, so no further fetch was issued.
+      return errors::OutOfRange("reached end of file");
+    }
+    absl::Status s = WaitForFetch();
+    if (!s.ok()) {
+      fetch_error_ = s;
+      return s;
+    }
+    if (buf_.size() == buffer_bytes_) {
+      // Full window; keep the pipeline primed with the next one.
+      StartFetch(buf_offset_ + buffer_bytes_);
+    }
+    if (buf_.empty()) {
+      return errors::OutOfRange("reached end of file");
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::Status DoubleBufferedInputStream::ReadNBytes(int64_t bytes_to_read,
+                                                   tstring* result) {
+  if (bytes_to_read < 0) {
+    return errors::InvalidArgument("Can't read a negative number of bytes: ",
+                                   bytes_to_read);
+  }
+  result->clear();
+  result->reserve(bytes_to_read);
+  return Consume(bytes_to_read, result);
+}
+
+absl::Status DoubleBufferedInputStream::SkipNBytes(int64_t bytes_to_skip) {
+  if (bytes_to_skip < 0) {
+    return errors::InvalidArgument("Can only skip forward, not ",
+                                   bytes_to_skip);
+  }
+  return Consume(bytes_to_skip, /*result=*/nullptr);
+}
+
+int64_t DoubleBufferedInputStream::Tell() const {
+  return buf_offset_ + pos_in_buf_;
+}
+
+absl::Status DoubleBufferedInputStream::Reset() {
+  RestartAt(0);
+  return absl::OkStatus();
+}
+
+}  // namespace io
+}  // namespace tsl
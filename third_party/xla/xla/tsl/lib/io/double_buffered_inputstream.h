@@ -0,0 +1,109 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef XLA_TSL_LIB_IO_DOUBLE_BUFFERED_INPUTSTREAM_H_
+#define XLA_TSL_LIB_IO_DOUBLE_BUFFERED_INPUTSTREAM_H_
+
+#include <memory>
+
+#include "xla/tsl/lib/io/inputstream_interface.h"
+#include "tsl/platform/env.h"
+#include "tsl/platform/mutex.h"
+
+namespace tsl {
+namespace io {
+
+// Provides a double buffer on top of a RandomAccessFile: while the caller
+// consumes the current window of `buffer_bytes`, a background thread reads
+// the next window, hiding storage latency behind the caller's processing.
+// Only sequential access (ReadNBytes/SkipNBytes) is supported; seeking
+// backwards requires Reset() followed by SkipNBytes(), like other input
+// streams.
+//
+// A single instance is NOT safe for concurrent use by multiple threads.
+class DoubleBufferedInputStream : public InputStreamInterface {
+ public:
+  // Does not take ownership of file unless owns_file is true; file must
+  // outlive *this otherwise. The file's positional Read is only called from
+  // the background thread, never concurrently.
+  DoubleBufferedInputStream(RandomAccessFile* file, size_t buffer_bytes,
+                            bool owns_file = false, Env* env = Env::Default());
+
+  ~DoubleBufferedInputStream() override;
+
+  absl::Status ReadNBytes(int64_t bytes_to_read, tstring* result) override;
+
+  absl::Status SkipNBytes(int64_t bytes_to_skip) override;
+
+  int64_t Tell() const override;
+
+  absl::Status Reset() override;
+
+ private:
+  // Runs on the background thread; serves one window read per request.
+  void PrefetchLoop();
+
+  // Asks the background thread to read `buffer_bytes_` starting at `offset`.
+  // There can be at most one outstanding request.
+  void StartFetch(uint64 offset);
+
+  // Blocks until the outstanding request completes and makes its window the
+  // current one. Requires an outstanding request.
+  absl::Status WaitForFetch();
+
+  // Discards buffered data and makes the consumed position `pos`; the next
+  // window is fetched starting there. Requires no outstanding request.
+  void RestartAt(uint64 pos);
+
+  // Consumes up to `bytes` from the buffers, copying into `result` if it is
+  // non-null. Shared implementation of ReadNBytes and SkipNBytes.
+  absl::Status Consume(int64_t bytes, tstring* result);
+
+  RandomAccessFile* file_;  // possibly owned, see owns_file_.
+  const size_t buffer_bytes_;
+  const bool owns_file_;
+
+  // Current window being consumed; only touched by the consumer thread.
+  tstring buf_;
+  size_t pos_in_buf_ = 0;
+  // Offset in the file of the first byte of buf_.
+  uint64 buf_offset_ = 0;
+  // Sticky error from a failed fetch, returned on all subsequent reads until
+  // Reset().
+  absl::Status fetch_error_;
+
+  mutex mu_;
+  condition_variable work_cv_;
+  condition_variable done_cv_;
+  bool fetch_requested_ TF_GUARDED_BY(mu_) = false;
+  bool fetch_done_ TF_GUARDED_BY(mu_) = false;
+  bool cancelled_ TF_GUARDED_BY(mu_) = false;
+  uint64 fetch_offset_ TF_GUARDED_BY(mu_) = 0;
+  tstring fetch_buf_ TF_GUARDED_BY(mu_);
+  absl::Status fetch_status_ TF_GUARDED_BY(mu_);
+
+  // Whether StartFetch was called without a matching WaitForFetch yet.
+  bool fetch_outstanding_ = false;
+
+  std::unique_ptr<Thread> thread_;
+
+  DoubleBufferedInputStream(const DoubleBufferedInputStream&) = delete;
+  void operator=(const DoubleBufferedInputStream&) = delete;
+};
+
+}  // namespace io
+}  // namespace tsl
+
+#endif  // XLA_TSL_LIB_IO_DOUBLE_BUFFERED_INPUTSTREAM_H_
@@ -0,0 +1,70 @@
+/* Copyright 2025 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef XLA_TSL_LIB_IO_MMAP_RANDOM_ACCESS_FILE_H_
+#define XLA_TSL_LIB_IO_MMAP_RANDOM_ACCESS_FILE_H_
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "tsl/platform/errors.h"
+#include "tsl/platform/file_system.h"
+#include "tsl/platform/status.h"
+
+namespace tsl {
+
+// A RandomAccessFile serving reads directly out of a ReadOnlyMemoryRegion,
+// typically created with Env::NewReadOnlyMemoryRegionFromFile. Read()
+// returns views into the mapping without copying into the caller's scratch
+// buffer, so consumers that can use file-backed bytes in place (e.g.
+// table::ReadBlock for uncompressed blocks) avoid a per-reader copy; the
+// page cache backs the mapping, shared across all readers of the file.
+class MmapRandomAccessFile : public RandomAccessFile {
+ public:
+  explicit MmapRandomAccessFile(std::unique_ptr<ReadOnlyMemoryRegion> region)
+      : region_(std::move(region)) {}
+
+  absl::Status Name(absl::string_view* result) const override {
+    return errors::Unimplemented(
+        "MmapRandomAccessFile does not support Name()");
+  }
+
+  absl::Status Read(uint64 offset, size_t n, absl::string_view* result,
+                    char* scratch) const override {
+    const uint64 length = region_->length();
+    if (offset > length) {
+      *result = absl::string_view();
+      return errors::OutOfRange("Read past end of mapped region");
+    }
+    const size_t bytes = std::min(n, static_cast<size_t>(length - offset));
+    *result = absl::string_view(
+        reinterpret_cast<const char*>(region_->data()) + offset, bytes);
+    if (bytes < n) {
+      return errors::OutOfRange("Read fewer bytes than requested");
+    }
+    return absl::OkStatus();
+  }
+
+ private:
+  std::unique_ptr<ReadOnlyMemoryRegion> region_;
+
+  MmapRandomAccessFile(const MmapRandomAccessFile&) = delete;
+  void operator=(const MmapRandomAccessFile&) = delete;
+};
+
+}  // namespace tsl
+
+#endif  // XLA_TSL_LIB_IO_MMAP_RANDOM_ACCESS_FILE_H_
@@ -20,6 +20,7 @@ limitations under the License.
 #include "xla/tsl/lib/hash/crc32c.h"
 #include "xla/tsl/lib/io/buffered_inputstream.h"
 #include "xla/tsl/lib/io/compression.h"
+#include "xla/tsl/lib/io/double_buffered_inputstream.h"
 #include "xla/tsl/lib/io/random_inputstream.h"
 #include "tsl/platform/env.h"
 #include "tsl/platform/errors.h"
@@ -60,8 +61,15 @@ RecordReader::RecordReader(RandomAccessFile* file,
       input_stream_(new RandomAccessInputStream(file)),
       last_read_failed_(false) {
   if (options.buffer_size > 0) {
-    input_stream_.reset(new BufferedInputStream(input_stream_.release(),
-                                                options.buffer_size, true));
+    if (options.async_prefetch) {
+      // Reads directly from the file so the background thread can use
+      // positional reads; replaces the random access stream entirely.
+      input_stream_.reset(
+          new DoubleBufferedInputStream(file, options.buffer_size));
+    } else {
+      input_stream_.reset(new BufferedInputStream(input_stream_.release(),
+                                                  options.buffer_size, true));
+    }
   }
 #if defined(IS_SLIM_BUILD)
   if (options.compression_type != RecordReaderOptions::NONE) {
@@ -224,6 +232,43 @@ absl::Status RecordReader::ReadRecord(uint64* offset, tstring* record) {
   return absl::OkStatus();
 }
 
+absl::Status RecordReader::ReadRecords(uint64* offset, int num_to_read,
+                                       int* num_read,
+                                       std::vector<tstring>* records) {
+  TF_RETURN_IF_ERROR(PositionInputStream(*offset));
+
+  absl::Status s;
+  tstring header;
+  *num_read = 0;
+  for (int i = 0; i < num_to_read; ++i) {
+    // Read header data.
+    s = ReadChecksummed(*offset, sizeof(uint64), &header);
+    if (!s.ok()) {
+      last_read_failed_ = true;
+      return s;
+    }
+    const uint64 length = core::DecodeFixed64(header.data());
+
+    // Read data.
+    records->emplace_back();
+    s = ReadChecksummed(*offset + kHeaderSize, length, &records->back());
+    if (!s.ok()) {
+      records->pop_back();
+      last_read_failed_ = true;
+      if (errors::IsOutOfRange(s)) {
+        s = errors::DataLoss("truncated record at ", *offset, "' failed with ",
+                             s.message());
+      }
+      return s;
+    }
+
+    *offset += kHeaderSize + length + kFooterSize;
+    (*num_read)++;
+  }
+  DCHECK_EQ(*offset, input_stream_->Tell());
+  return absl::OkStatus();
+}
+
 absl::Status RecordReader::SkipRecords(uint64* offset, int num_to_skip,
                                        int* num_skipped) {
   TF_RETURN_IF_ERROR(PositionInputStream(*offset));
@@ -16,6 +16,8 @@ limitations under the License.
 #ifndef XLA_TSL_LIB_IO_RECORD_READER_H_
 #define XLA_TSL_LIB_IO_RECORD_READER_H_
 
+#include <vector>
+
 #include "xla/tsl/lib/io/inputstream_interface.h"
 #include "tsl/platform/errors.h"
 #include "tsl/platform/stringpiece.h"
@@ -46,6 +48,11 @@ struct RecordReaderOptions {
   // compressed files.) Consider using SequentialRecordReader.
   int64_t buffer_size = 0;
 
+  // If true (and buffer_size is non-zero), the next buffer window is read on
+  // a background thread while the current one is decoded, hiding storage
+  // latency behind record processing. Useful on high-latency filesystems.
+  bool async_prefetch = false;
+
   static RecordReaderOptions CreateRecordReaderOptions(
       const string& compression_type);
 
@@ -103,6 +110,17 @@ class RecordReader {
   // are actually skipped. It should be equal to num_to_skip on success.
   absl::Status SkipRecords(uint64* offset, int num_to_skip, int* num_skipped);
 
+  // Read up to num_to_read records starting at "*offset", appending them to
+  // "*records", and update *offset to point past the last record read.
+  // Returns OK on success, OUT_OF_RANGE for end of file, or something else
+  // for an error. "*num_read" records the number of records actually read
+  // and appended; it equals num_to_read on success. Unlike calling
+  // ReadRecord() in a loop, the input stream is positioned and verified once
+  // per batch rather than once per record, which matters when reading many
+  // small records.
+  absl::Status ReadRecords(uint64* offset, int num_to_read, int* num_read,
+                           std::vector<tstring>* records);
+
   // Return the metadata of the Record file.
   //
   // The current implementation scans the file to completion,
@@ -155,6 +173,15 @@ class SequentialRecordReader {
     return underlying_.SkipRecords(&offset_, num_to_skip, num_skipped);
   }
 
+  // Read up to the next num_to_read records in the file, appending them to
+  // "*records". Returns OK on success, OUT_OF_RANGE for end of file, or
+  // something else for an error. "*num_read" records the number of records
+  // actually read; it equals num_to_read on success.
+  absl::Status ReadRecords(int num_to_read, int* num_read,
+                           std::vector<tstring>* records) {
+    return underlying_.ReadRecords(&offset_, num_to_read, num_read, records);
+  }
+
   // Return the current offset in the file.
   uint64 TellOffset() { return offset_; }
 
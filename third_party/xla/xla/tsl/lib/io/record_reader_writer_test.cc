@@ -233,6 +233,86 @@ TEST(RecordReaderWriterTest, TestSkipOutOfRange) {
   }
 }
 
+TEST(RecordReaderWriterTest, TestReadRecordsBasic) {
+  Env* env = Env::Default();
+  string fname =
+      testing::TmpDir() + "/record_reader_writer_read_records_basic_test";
+
+  for (auto buf_size : BufferSizes()) {
+    {
+      std::unique_ptr<WritableFile> file;
+      TF_CHECK_OK(env->NewWritableFile(fname, &file));
+
+      io::RecordWriterOptions options;
+      options.zlib_options.output_buffer_size = buf_size;
+      io::RecordWriter writer(file.get(), options);
+      TF_EXPECT_OK(writer.WriteRecord("abc"));
+      TF_EXPECT_OK(writer.WriteRecord("defg"));
+      TF_EXPECT_OK(writer.WriteRecord("hij"));
+      TF_CHECK_OK(writer.Flush());
+    }
+
+    {
+      std::unique_ptr<RandomAccessFile> read_file;
+      // Read it back with the RecordReader.
+      TF_CHECK_OK(env->NewRandomAccessFile(fname, &read_file));
+      io::RecordReaderOptions options;
+      options.zlib_options.input_buffer_size = buf_size;
+      io::RecordReader reader(read_file.get(), options);
+      uint64 offset = 0;
+      int num_read;
+      std::vector<tstring> records;
+      TF_CHECK_OK(reader.ReadRecords(&offset, 2, &num_read, &records));
+      EXPECT_EQ(2, num_read);
+      ASSERT_EQ(2, records.size());
+      EXPECT_EQ("abc", records[0]);
+      EXPECT_EQ("defg", records[1]);
+      // Batched and single-record reads can be interleaved.
+      tstring record;
+      TF_CHECK_OK(reader.ReadRecord(&offset, &record));
+      EXPECT_EQ("hij", record);
+    }
+  }
+}
+
+TEST(RecordReaderWriterTest, TestReadRecordsOutOfRange) {
+  Env* env = Env::Default();
+  string fname = testing::TmpDir() +
+                 "/record_reader_writer_read_records_out_of_range_test";
+
+  for (auto buf_size : BufferSizes()) {
+    {
+      std::unique_ptr<WritableFile> file;
+      TF_CHECK_OK(env->NewWritableFile(fname, &file));
+
+      io::RecordWriterOptions options;
+      options.zlib_options.output_buffer_size = buf_size;
+      io::RecordWriter writer(file.get(), options);
+      TF_EXPECT_OK(writer.WriteRecord("abc"));
+      TF_EXPECT_OK(writer.WriteRecord("defg"));
+      TF_CHECK_OK(writer.Flush());
+    }
+
+    {
+      std::unique_ptr<RandomAccessFile> read_file;
+      // Read it back with the RecordReader.
+      TF_CHECK_OK(env->NewRandomAccessFile(fname, &read_file));
+      io::RecordReaderOptions options;
+      options.zlib_options.input_buffer_size = buf_size;
+      io::RecordReader reader(read_file.get(), options);
+      uint64 offset = 0;
+      int num_read;
+      std::vector<tstring> records;
+      absl::Status s = reader.ReadRecords(&offset, 3, &num_read, &records);
+      EXPECT_EQ(error::OUT_OF_RANGE, s.code());
+      EXPECT_EQ(2, num_read);
+      ASSERT_EQ(2, records.size());
+      EXPECT_EQ("abc", records[0]);
+      EXPECT_EQ("defg", records[1]);
+    }
+  }
+}
+
 TEST(RecordReaderWriterTest, TestMalformedInput) {
   Env* env = Env::Default();
   string fname =
@@ -305,6 +385,76 @@ TEST(RecordReaderWriterTest, TestSnappy) {
   }
 }
 
+TEST(RecordReaderWriterTest, TestPipelinedSnappy) {
+  Env* env = Env::Default();
+  string fname = testing::TmpDir() + "/record_reader_writer_pipelined_snappy";
+
+  {
+    std::unique_ptr<WritableFile> file;
+    TF_CHECK_OK(env->NewWritableFile(fname, &file));
+
+    io::RecordWriterOptions options;
+    options.compression_type = io::RecordWriterOptions::SNAPPY_COMPRESSION;
+    options.num_threads = 4;
+    // Small chunks force several batches through the worker pool.
+    options.snappy_options.input_buffer_size = 64;
+    io::RecordWriter writer(file.get(), options);
+    for (int i = 0; i < 100; i++) {
+      TF_EXPECT_OK(writer.WriteRecord(strings::StrCat("record-", i)));
+    }
+    TF_CHECK_OK(writer.Close());
+  }
+
+  {
+    std::unique_ptr<RandomAccessFile> read_file;
+    // The output must be readable with the standard snappy reader options.
+    TF_CHECK_OK(env->NewRandomAccessFile(fname, &read_file));
+    io::RecordReaderOptions options;
+    options.compression_type = io::RecordReaderOptions::SNAPPY_COMPRESSION;
+    io::RecordReader reader(read_file.get(), options);
+    uint64 offset = 0;
+    tstring record;
+    for (int i = 0; i < 100; i++) {
+      TF_CHECK_OK(reader.ReadRecord(&offset, &record));
+      EXPECT_EQ(strings::StrCat("record-", i), record);
+    }
+    EXPECT_TRUE(errors::IsOutOfRange(reader.ReadRecord(&offset, &record)));
+  }
+}
+
+TEST(RecordReaderWriterTest, TestPipelinedUncompressed) {
+  Env* env = Env::Default();
+  string fname = testing::TmpDir() + "/record_reader_writer_pipelined_none";
+
+  {
+    std::unique_ptr<WritableFile> file;
+    TF_CHECK_OK(env->NewWritableFile(fname, &file));
+
+    io::RecordWriterOptions options;
+    options.num_threads = 2;
+    io::RecordWriter writer(file.get(), options);
+    TF_EXPECT_OK(writer.WriteRecord("abc"));
+    TF_EXPECT_OK(writer.WriteRecord("defg"));
+    TF_CHECK_OK(writer.Flush());
+    TF_CHECK_OK(writer.Close());
+
+    CHECK_EQ(writer.WriteRecord("abc").code(), error::FAILED_PRECONDITION);
+    CHECK_EQ(writer.Flush().code(), error::FAILED_PRECONDITION);
+  }
+
+  {
+    std::unique_ptr<RandomAccessFile> read_file;
+    TF_CHECK_OK(env->NewRandomAccessFile(fname, &read_file));
+    io::RecordReader reader(read_file.get());
+    uint64 offset = 0;
+    tstring record;
+    TF_CHECK_OK(reader.ReadRecord(&offset, &record));
+    EXPECT_EQ("abc", record);
+    TF_CHECK_OK(reader.ReadRecord(&offset, &record));
+    EXPECT_EQ("defg", record);
+  }
+}
+
 TEST(RecordReaderWriterTest, TestZlib) {
   Env* env = Env::Default();
   string fname = testing::TmpDir() + "/record_reader_writer_zlib_test";
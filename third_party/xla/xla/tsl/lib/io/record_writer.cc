@@ -15,10 +15,19 @@ limitations under the License.
 
 #include "xla/tsl/lib/io/record_writer.h"
 
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "xla/tsl/lib/hash/crc32c.h"
 #include "xla/tsl/lib/io/compression.h"
 #include "tsl/platform/coding.h"
 #include "tsl/platform/env.h"
+#include "tsl/platform/errors.h"
+#include "tsl/platform/mutex.h"
+#include "tsl/platform/threadpool.h"
 
 namespace tsl {
 namespace io {
@@ -32,6 +41,194 @@ bool IsSnappyCompressed(const RecordWriterOptions& options) {
 }
 }  // namespace
 
+// Frames and compresses records on a worker pool while preserving record
+// order in the output stream. Records are accumulated into batches; each
+// batch is framed (header/payload/footer with CRCs) and, for snappy,
+// compressed into self-contained chunks identical to those produced by
+// SnappyOutputBuffer, so the resulting file is readable by RecordReader
+// with the usual options. Zlib is not supported: it produces a single
+// stateful stream that cannot be split across threads without changing the
+// on-disk format.
+//
+// Like RecordWriter itself, not safe for concurrent use; one caller thread.
+class RecordWriterPipeline {
+ public:
+  RecordWriterPipeline(WritableFile* dest, const RecordWriterOptions& options)
+      : dest_(dest),
+#if !defined(IS_SLIM_BUILD)
+        snappy_(IsSnappyCompressed(options)),
+        chunk_bytes_(
+            static_cast<size_t>(options.snappy_options.input_buffer_size)),
+#else
+        snappy_(false),
+        chunk_bytes_(256 << 10),
+#endif
+        max_outstanding_(2 * options.num_threads),
+        pool_(Env::Default(), "record_writer_pipeline", options.num_threads) {}
+
+  ~RecordWriterPipeline() {
+    absl::Status s = Close();
+    if (!s.ok()) {
+      LOG(ERROR) << "Could not finish writing file: " << s;
+    }
+  }
+
+  absl::Status WriteRecord(absl::string_view data) {
+    TF_RETURN_IF_ERROR(output_status_);
+    batch_.emplace_back(data.data(), data.size());
+    batch_bytes_ +=
+        RecordWriter::kHeaderSize + data.size() + RecordWriter::kFooterSize;
+    if (batch_bytes_ >= chunk_bytes_) {
+      return SubmitBatch();
+    }
+    return absl::OkStatus();
+  }
+
+  // Submits any pending records, appends all outstanding batches in order,
+  // then flushes buffered data to the file.
+  absl::Status Flush() {
+    TF_RETURN_IF_ERROR(SubmitBatch());
+    while (!queue_.empty()) {
+      AppendFront();
+    }
+    TF_RETURN_IF_ERROR(output_status_);
+    return dest_->Flush();
+  }
+
+  // Writes all output to the file. Does *not* close the WritableFile.
+  absl::Status Close() {
+    if (dest_ == nullptr) return absl::OkStatus();
+    absl::Status s = Flush();
+    dest_ = nullptr;
+    return s;
+  }
+
+ private:
+  struct Batch {
+    std::vector<tstring> records;
+    // Written by the worker, read by the caller once done is true.
+    tstring out;
+    absl::Status status;
+    bool done = false;
+  };
+
+  // Hands the pending records to a worker and bounds the number of batches
+  // in flight so a slow file does not let compressed output accumulate
+  // without limit.
+  absl::Status SubmitBatch() {
+    if (batch_.empty()) return output_status_;
+    auto batch = std::make_shared<Batch>();
+    batch->records = std::move(batch_);
+    batch_.clear();
+    batch_bytes_ = 0;
+    queue_.push_back(batch);
+    pool_.Schedule([this, batch] { RunBatch(batch.get()); });
+    while (queue_.size() > max_outstanding_) {
+      AppendFront();
+    }
+    return output_status_;
+  }
+
+  // Waits for the oldest outstanding batch and appends its bytes to the
+  // file, preserving submission order. Records the first failure in
+  // output_status_ and stops appending after that.
+  void AppendFront() {
+    std::shared_ptr<Batch> batch = queue_.front();
+    {
+      mutex_lock l(mu_);
+      while (!batch->done) {
+        done_cv_.wait(l);
+      }
+    }
+    queue_.pop_front();
+    if (!output_status_.ok()) return;
+    if (!batch->status.ok()) {
+      output_status_ = batch->status;
+      return;
+    }
+    output_status_ = dest_->Append(batch->out);
+  }
+
+  // Runs on a worker thread: frames the batch's records and compresses the
+  // framed bytes if needed.
+  void RunBatch(Batch* batch) {
+    size_t framed_bytes = 0;
+    for (const tstring& record : batch->records) {
+      framed_bytes +=
+          RecordWriter::kHeaderSize + record.size() + RecordWriter::kFooterSize;
+    }
+    tstring framed;
+    framed.reserve(framed_bytes);
+    char header[RecordWriter::kHeaderSize];
+    char footer[RecordWriter::kFooterSize];
+    for (const tstring& record : batch->records) {
+      RecordWriter::PopulateHeader(header, record.data(), record.size());
+      RecordWriter::PopulateFooter(footer, record.data(), record.size());
+      framed.append(header, sizeof(header));
+      framed.append(record);
+      framed.append(footer, sizeof(footer));
+    }
+    absl::Status status;
+    tstring out;
+    if (!snappy_) {
+      out = std::move(framed);
+    } else {
+#if !defined(IS_SLIM_BUILD)
+      // Mirrors SnappyOutputBuffer::Deflate(): each chunk of at most
+      // chunk_bytes_ input is compressed independently and preceded by its
+      // compressed length, so readers decode the stream unchanged.
+      size_t pos = 0;
+      while (pos < framed.size()) {
+        const size_t chunk = std::min(chunk_bytes_, framed.size() - pos);
+        string compressed;
+        if (!port::Snappy_Compress(framed.data() + pos, chunk, &compressed)) {
+          status = errors::DataLoss("Snappy compression failed");
+          break;
+        }
+        char compressed_length_array[4];
+        for (int i = 0; i < 4; i++) {
+          compressed_length_array[i] = compressed.length() >> (8 * (3 - i));
+        }
+        out.append(compressed_length_array, sizeof(compressed_length_array));
+        out.append(compressed);
+        pos += chunk;
+      }
+#endif
+    }
+    mutex_lock l(mu_);
+    batch->out = std::move(out);
+    batch->status = status;
+    batch->done = true;
+    done_cv_.notify_all();
+  }
+
+  WritableFile* dest_;  // not owned; nulled by Close().
+  const bool snappy_;
+  const size_t chunk_bytes_;
+  const size_t max_outstanding_;
+
+  // Records accumulated since the last submitted batch; caller thread only.
+  std::vector<tstring> batch_;
+  size_t batch_bytes_ = 0;
+
+  // Batches in submission order; the front is the next to hit the file. The
+  // deque itself is only touched by the caller thread; workers touch batch
+  // fields under mu_.
+  std::deque<std::shared_ptr<Batch>> queue_;
+  // First failure from a worker or from an Append; sticky.
+  absl::Status output_status_;
+
+  mutex mu_;
+  condition_variable done_cv_;
+
+  // Declared last so its destructor joins the workers before the state above
+  // is destroyed.
+  thread::ThreadPool pool_;
+
+  RecordWriterPipeline(const RecordWriterPipeline&) = delete;
+  void operator=(const RecordWriterPipeline&) = delete;
+};
+
 RecordWriterOptions RecordWriterOptions::CreateRecordWriterOptions(
     const string& compression_type) {
   RecordWriterOptions options;
@@ -65,6 +262,16 @@ RecordWriter::RecordWriter(WritableFile* dest,
     LOG(FATAL) << "Compression is unsupported on mobile platforms.";
   }
 #else
+  if (options.num_threads > 1) {
+    if (IsZlibCompressed(options)) {
+      LOG(WARNING) << "RecordWriterOptions::num_threads is ignored with zlib "
+                      "compression; zlib produces a single stateful stream "
+                      "that cannot be compressed in parallel.";
+    } else {
+      pipeline_.reset(new RecordWriterPipeline(dest, options));
+      return;
+    }
+  }
   if (IsZlibCompressed(options)) {
     ZlibOutputBuffer* zlib_output_buffer = new ZlibOutputBuffer(
         dest, options.zlib_options.input_buffer_size,
@@ -96,6 +303,9 @@ RecordWriter::~RecordWriter() {
 }
 
 absl::Status RecordWriter::WriteRecord(absl::string_view data) {
+  if (pipeline_ != nullptr) {
+    return pipeline_->WriteRecord(data);
+  }
   if (dest_ == nullptr) {
     return absl::Status(absl::StatusCode::kFailedPrecondition,
                         "Writer not initialized or previously closed");
@@ -116,6 +326,9 @@ absl::Status RecordWriter::WriteRecord(absl::string_view data) {
 
 #if defined(TF_CORD_SUPPORT)
 absl::Status RecordWriter::WriteRecord(const absl::Cord& data) {
+  if (pipeline_ != nullptr) {
+    return pipeline_->WriteRecord(std::string(data));
+  }
   if (dest_ == nullptr) {
     return absl::Status(absl::StatusCode::kFailedPrecondition,
                         "Writer not initialized or previously closed");
@@ -136,6 +349,12 @@ absl::Status RecordWriter::WriteRecord(const absl::Cord& data) {
 #endif
 
 absl::Status RecordWriter::Close() {
+  if (pipeline_ != nullptr) {
+    absl::Status s = pipeline_->Close();
+    pipeline_.reset();
+    dest_ = nullptr;
+    return s;
+  }
   if (dest_ == nullptr) return absl::OkStatus();
   if (IsZlibCompressed(options_) || IsSnappyCompressed(options_)) {
     absl::Status s = dest_->Close();
@@ -147,6 +366,9 @@ absl::Status RecordWriter::Close() {
 }
 
 absl::Status RecordWriter::Flush() {
+  if (pipeline_ != nullptr) {
+    return pipeline_->Flush();
+  }
   if (dest_ == nullptr) {
     return absl::Status(absl::StatusCode::kFailedPrecondition,
                         "Writer not initialized or previously closed");
@@ -16,6 +16,8 @@ limitations under the License.
 #ifndef XLA_TSL_LIB_IO_RECORD_WRITER_H_
 #define XLA_TSL_LIB_IO_RECORD_WRITER_H_
 
+#include <memory>
+
 #include "xla/tsl/lib/hash/crc32c.h"
 #include "tsl/platform/coding.h"
 #include "tsl/platform/status.h"
@@ -45,6 +47,14 @@ struct RecordWriterOptions {
   };
   CompressionType compression_type = NONE;
 
+  // If greater than 1, records are framed and compressed by a pool of that
+  // many worker threads and appended to the file in submission order, so a
+  // single output stream can sustain multi-core compression throughput.
+  // Supported for NONE and snappy compression; ignored for zlib, which
+  // produces a single stateful stream that cannot be compressed in parallel.
+  // The produced file is byte-compatible with the single-threaded format.
+  int num_threads = 0;
+
   static RecordWriterOptions CreateRecordWriterOptions(
       const string& compression_type);
 
@@ -55,6 +65,8 @@ struct RecordWriterOptions {
 #endif  // IS_SLIM_BUILD
 };
 
+class RecordWriterPipeline;
+
 class RecordWriter {
  public:
   // Format of a single record:
@@ -113,6 +125,10 @@ class RecordWriter {
  private:
   WritableFile* dest_;
   RecordWriterOptions options_;
+  // Non-null iff options_.num_threads > 1 with a supported compression type;
+  // owns the worker pool that frames and compresses records off the caller
+  // thread. See RecordWriterOptions::num_threads.
+  std::unique_ptr<RecordWriterPipeline> pipeline_;
 
   inline static uint32 MaskedCrc(const char* data, size_t n) {
     return crc32c::Mask(crc32c::Value(data, n));
@@ -127,8 +127,14 @@ Iterator* Table::BlockReader(void* arg, const absl::string_view& index_value) {
         s = ReadBlock(table->rep_->file, handle, &contents);
         if (s.ok()) {
           block = new Block(contents);
-          cache_handle = block_cache->Insert(key, block, block->size(),
-                                             &DeleteCachedBlock);
+          // Blocks whose bytes live in the file mapping (e.g. uncompressed
+          // blocks read through an mmap-backed file) are not cacheable:
+          // caching them would charge the cache for bytes it does not own
+          // and evict blocks it does.
+          if (contents.cacheable) {
+            cache_handle = block_cache->Insert(key, block, block->size(),
+                                               &DeleteCachedBlock);
+          }
         }
       }
     } else {
@@ -17,14 +17,18 @@ limitations under the License.
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/escaping.h"
 #include "xla/tsl/lib/io/block.h"
 #include "xla/tsl/lib/io/block_builder.h"
+#include "xla/tsl/lib/io/cache.h"
 #include "xla/tsl/lib/io/format.h"
 #include "xla/tsl/lib/io/iterator.h"
+#include "xla/tsl/lib/io/mmap_random_access_file.h"
 #include "xla/tsl/lib/io/table_builder.h"
 #include "xla/tsl/lib/random/simple_philox.h"
 #include "tsl/platform/env.h"
@@ -634,5 +638,53 @@ TEST(TableTest, SeekToFirstKeyDoesNotReadTooMuch) {
   EXPECT_LT(c.BytesRead(), 200);
 }
 
+TEST(TableTest, MmapFileAndSharedBlockCache) {
+  Env* env = Env::Default();
+  string fname = testing::TmpDir() + "/table_mmap_shared_cache_test";
+
+  std::map<string, string> expected;
+  {
+    std::unique_ptr<WritableFile> sink;
+    ASSERT_TRUE(env->NewWritableFile(fname, &sink).ok());
+    Options options;
+    options.block_size = 256;
+    options.compression = kNoCompression;
+    TableBuilder builder(options, sink.get());
+    for (int i = 0; i < 100; i++) {
+      string key = {'k', static_cast<char>('0' + i / 10),
+                    static_cast<char>('0' + i % 10)};
+      string value = "value-" + key;
+      builder.Add(key, value);
+      expected[key] = value;
+    }
+    ASSERT_TRUE(builder.Finish().ok());
+    ASSERT_TRUE(sink->Close().ok());
+  }
+
+  uint64 file_size = 0;
+  ASSERT_TRUE(env->GetFileSize(fname, &file_size).ok());
+  std::unique_ptr<ReadOnlyMemoryRegion> region;
+  ASSERT_TRUE(env->NewReadOnlyMemoryRegionFromFile(fname, &region).ok());
+  MmapRandomAccessFile file(std::move(region));
+
+  Options options;
+  options.block_cache = GetSharedBlockCache();
+  Table* table = nullptr;
+  ASSERT_TRUE(Table::Open(options, &file, file_size, &table).ok());
+
+  Iterator* iter = table->NewIterator();
+  auto want = expected.begin();
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    ASSERT_TRUE(want != expected.end());
+    EXPECT_EQ(want->first, iter->key());
+    EXPECT_EQ(want->second, iter->value());
+    ++want;
+  }
+  ASSERT_TRUE(iter->status().ok());
+  EXPECT_TRUE(want == expected.end());
+  delete iter;
+  delete table;
+}
+
 }  // namespace table
 }  // namespace tsl
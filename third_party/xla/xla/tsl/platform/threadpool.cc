@@ -15,8 +15,10 @@ limitations under the License.
 
 #include "xla/tsl/platform/threadpool.h"
 
+#include <algorithm>
 #include <cfenv>  // NOLINT
 #include <cstdint>
+#include <memory>
 #include <functional>
 #include <string>
 #include <utility>
@@ -113,6 +115,47 @@ struct EigenEnvironment {
   }
 };
 
+namespace {
+
+// Forwards all work onto a fixed slice of a parent pool's threads using
+// scheduling hints. See ThreadPool::CreatePartition.
+class ThreadPoolPartition : public ThreadPoolInterface {
+ public:
+  ThreadPoolPartition(Eigen::ThreadPoolInterface* parent, int start, int limit)
+      : parent_(parent), start_(start), limit_(limit) {}
+
+  void Schedule(std::function<void()> fn) override {
+    parent_->ScheduleWithHint(std::move(fn), start_, limit_);
+  }
+
+  void ScheduleWithHint(std::function<void()> fn, int start,
+                        int limit) override {
+    // Hints arrive in partition-relative thread ids; translate and clamp
+    // them to the partition's slice of the parent pool.
+    const int lo = std::min(std::max(start_ + start, start_), limit_ - 1);
+    const int hi = std::min(std::max(start_ + limit, lo + 1), limit_);
+    parent_->ScheduleWithHint(std::move(fn), lo, hi);
+  }
+
+  // A partition is a view; cancelling it must not cancel the shared parent.
+  void Cancel() override {}
+
+  int NumThreads() const override { return limit_ - start_; }
+
+  int CurrentThreadId() const override {
+    const int id = parent_->CurrentThreadId();
+    if (id >= start_ && id < limit_) return id - start_;
+    return -1;
+  }
+
+ private:
+  Eigen::ThreadPoolInterface* const parent_;
+  const int start_;
+  const int limit_;
+};
+
+}  // namespace
+
 ThreadPool::ThreadPool(Env* env, const std::string& name, int num_threads)
     : ThreadPool(env, ThreadOptions(), name, num_threads, true, nullptr) {}
 
@@ -310,5 +353,16 @@ Eigen::ThreadPoolInterface* ThreadPool::AsEigenThreadPool() const {
   DCHECK(underlying_threadpool_ != nullptr);
   return underlying_threadpool_;
 }
+
+std::unique_ptr<ThreadPool> ThreadPool::CreatePartition(int start, int limit) {
+  CHECK_GE(start, 0);
+  CHECK_LT(start, limit);
+  CHECK_LE(limit, NumThreads());
+  auto partition = std::make_unique<ThreadPoolPartition>(underlying_threadpool_,
+                                                         start, limit);
+  auto pool = std::make_unique<ThreadPool>(partition.get());
+  pool->partition_interface_ = std::move(partition);
+  return pool;
+}
 }  // namespace thread
 }  // namespace tsl
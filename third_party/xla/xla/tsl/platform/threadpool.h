@@ -216,6 +216,16 @@ class ThreadPool {
   // pointer points to, and should not attempt to delete.
   Eigen::ThreadPoolInterface* AsEigenThreadPool() const;
 
+  // Returns a pool that schedules all of its work onto threads
+  // [start, limit) of this pool via scheduling hints. The partition owns no
+  // threads of its own; it is a view that callers hand to nested parallel
+  // code (e.g. a ParallelFor issued from inside an already-parallel kernel)
+  // so that composed parallelism stays within a reserved slice of the pool
+  // instead of oversubscribing the machine. Disjoint partitions can run
+  // concurrently. The returned pool must not outlive this pool.
+  // REQUIRES: 0 <= start < limit <= NumThreads()
+  std::unique_ptr<ThreadPool> CreatePartition(int start, int limit);
+
  private:
   // Divides the work represented by the range [0, total) into k shards.
   // Calls fn(i*block_size, (i+1)*block_size) from the ith shard (0 <= i < k).
@@ -235,6 +245,9 @@ class ThreadPool {
   // user_threadpool is not in the constructor.
   std::unique_ptr<Eigen::ThreadPoolTempl<EigenEnvironment>> eigen_threadpool_;
   std::unique_ptr<Eigen::ThreadPoolDevice> threadpool_device_;
+  // When this pool is a partition view created by CreatePartition, owns the
+  // forwarding interface that underlying_threadpool_ points at.
+  std::unique_ptr<ThreadPoolInterface> partition_interface_;
   ThreadPool(const ThreadPool&) = delete;
   void operator=(const ThreadPool&) = delete;
 };
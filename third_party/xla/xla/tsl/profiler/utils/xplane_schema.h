@@ -346,7 +346,8 @@ enum StatType {
   kDeviceOffsetPs,
   kDeviceDurationPs,
   kScopeRangeId,
-  kLastStatType = kScopeRangeId,
+  kLargestFreeBlockBytes,
+  kLastStatType = kLargestFreeBlockBytes,
 };
 
 enum MegaScaleStatType : uint8_t {